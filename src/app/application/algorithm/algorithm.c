@@ -80,15 +80,43 @@ static bool algo_initializationRequested = false;
  */
 static void ALGO_Initialization(void);
 
+/**
+ * @brief   checks whether an algorithm is activated in the current tick and
+ *          advances its activation timer
+ * @param[in,out]   pAlgorithm  algorithm to be checked
+ * @returns true if the algorithm is activated in the current tick, otherwise false
+ */
+static bool ALGO_IsActivationDue(ALGO_TASKS_s *pAlgorithm);
+
+/**
+ * @brief   executes the steps of a resumable algorithm until it is finished or
+ *          the step budget of the current tick is exhausted
+ * @param[in]   algorithmIndex  index entry of the algorithm
+ */
+static void ALGO_RunSteps(uint32_t algorithmIndex);
+
+/**
+ * @brief   updates the runtime statistics of a finished computation cycle
+ * @param[in,out]   pAlgorithm  algorithm that finished its computation cycle
+ */
+static void ALGO_RecordCompletion(ALGO_TASKS_s *pAlgorithm);
+
 /*========== Static Function Implementations ================================*/
 static void ALGO_Initialization(void) {
     /* iterate over all algorithms */
     for (uint16_t i = 0u; i < algo_length; i++) {
         /* check if the cycle time is valid */
         FAS_ASSERT((algo_algorithms[i].cycleTime_ms % ALGO_TICK_ms) == 0u);
+        /* check if the phase is valid */
+        FAS_ASSERT((algo_algorithms[i].phase_ms % ALGO_TICK_ms) == 0u);
+        FAS_ASSERT(
+            (algo_algorithms[i].phase_ms == 0u) || (algo_algorithms[i].phase_ms < algo_algorithms[i].cycleTime_ms));
+        /* exactly one of the computation functions has to be configured */
+        FAS_ASSERT((algo_algorithms[i].fpAlgorithm == NULL_PTR) != (algo_algorithms[i].fpStep == NULL_PTR));
 
         /* check only uninitialized algorithms */
         if (algo_algorithms[i].state == ALGO_UNINITIALIZED) {
+            algo_algorithms[i].runtime.timeUntilActivation_ms = algo_algorithms[i].phase_ms;
             /* directly make ready when init function is a null pointer otherwise run init */
             if (algo_algorithms[i].fpInitialization == NULL_PTR) {
                 algo_algorithms[i].state = ALGO_READY;
@@ -105,6 +133,53 @@ static void ALGO_Initialization(void) {
     }
 }
 
+static bool ALGO_IsActivationDue(ALGO_TASKS_s *pAlgorithm) {
+    FAS_ASSERT(pAlgorithm != NULL_PTR);
+    bool isDue = false;
+    /* a count-down timer per algorithm replaces the modulo of a global tick
+       counter; algorithms with a cycle time of zero are activated in every tick */
+    if (pAlgorithm->runtime.timeUntilActivation_ms == 0u) {
+        isDue                                     = true;
+        pAlgorithm->runtime.timeUntilActivation_ms = pAlgorithm->cycleTime_ms;
+    }
+    if (pAlgorithm->runtime.timeUntilActivation_ms >= ALGO_TICK_ms) {
+        pAlgorithm->runtime.timeUntilActivation_ms -= ALGO_TICK_ms;
+    }
+    return isDue;
+}
+
+static void ALGO_RunSteps(uint32_t algorithmIndex) {
+    FAS_ASSERT(algorithmIndex < algo_length);
+    ALGO_TASKS_s *pAlgorithm = &algo_algorithms[algorithmIndex];
+
+    const uint32_t tickStart_ms = OS_GetTickCount();
+    ALGO_STEP_RESULT_e result   = ALGO_STEP_PENDING;
+    bool budgetLeft             = true;
+    while ((result == ALGO_STEP_PENDING) && (budgetLeft == true)) {
+        result = pAlgorithm->fpStep();
+        FAS_ASSERT((result == ALGO_STEP_FINISHED) || (result == ALGO_STEP_PENDING));
+        pAlgorithm->runtime.steps++;
+        budgetLeft = ((OS_GetTickCount() - tickStart_ms) < pAlgorithm->stepBudget_ms);
+    }
+
+    if (result == ALGO_STEP_FINISHED) {
+        ALGO_RecordCompletion(pAlgorithm);
+        ALGO_MarkAsDone(algorithmIndex);
+    } else {
+        /* budget of this tick is exhausted, continue in the next tick */
+        pAlgorithm->runtime.suspensions++;
+    }
+}
+
+static void ALGO_RecordCompletion(ALGO_TASKS_s *pAlgorithm) {
+    FAS_ASSERT(pAlgorithm != NULL_PTR);
+    const uint32_t duration_ms         = OS_GetTickCount() - pAlgorithm->startTime;
+    pAlgorithm->runtime.lastDuration_ms = duration_ms;
+    if (duration_ms > pAlgorithm->runtime.maxDuration_ms) {
+        pAlgorithm->runtime.maxDuration_ms = duration_ms;
+    }
+}
+
 /*========== Extern Function Implementations ================================*/
 
 extern void ALGO_UnlockInitialization(void) {
@@ -124,32 +199,40 @@ extern void ALGO_MainFunction(void) {
         OS_ExitTaskCritical();
     }
 
-    static uint32_t counter_ticks = 0u;
-
     for (uint16_t i = 0u; i < algo_length; i++) {
-        const bool runAlgorithmAsap = (algo_algorithms[i].cycleTime_ms == 0u);
-        const bool runAlgorithmCycleElapsed =
-            ((algo_algorithms[i].cycleTime_ms != 0u) && ((counter_ticks % algo_algorithms[i].cycleTime_ms) == 0u));
-        if ((runAlgorithmAsap != false) || (runAlgorithmCycleElapsed != false)) {
+        const bool isResumable = (algo_algorithms[i].fpStep != NULL_PTR);
+        if (ALGO_IsActivationDue(&algo_algorithms[i]) == true) {
             /* Cycle time elapsed -> call function */
             if (algo_algorithms[i].state == ALGO_READY) {
                 /* Set state to running -> reset to READY before leaving algorithm function */
                 algo_algorithms[i].state     = ALGO_RUNNING;
                 algo_algorithms[i].startTime = OS_GetTickCount();
-                algo_algorithms[i].fpAlgorithm();
-                ALGO_MarkAsDone(i);
+                algo_algorithms[i].runtime.activations++;
+                if (isResumable == false) {
+                    algo_algorithms[i].fpAlgorithm();
+                    algo_algorithms[i].runtime.steps++;
+                    ALGO_RecordCompletion(&algo_algorithms[i]);
+                    ALGO_MarkAsDone(i);
+                }
+            } else if ((algo_algorithms[i].state == ALGO_RUNNING) && (isResumable == true)) {
+                /* previous cycle of a resumable algorithm is still pending */
+                algo_algorithms[i].runtime.missedActivations++;
+            } else {
+                /* algorithm is not ready, nothing to do */
             }
-            /* check if we need to reinitialize */
-            if (algo_algorithms[i].state == ALGO_REINIT_REQUESTED) {
-                /* set to uninitialized so that the algorithm can be reinitialized */
-                algo_algorithms[i].state = ALGO_UNINITIALIZED;
+        }
+        /* continue (or start) resumable algorithms within their budget */
+        if ((algo_algorithms[i].state == ALGO_RUNNING) && (isResumable == true)) {
+            ALGO_RunSteps(i);
+        }
+        /* check if we need to reinitialize */
+        if (algo_algorithms[i].state == ALGO_REINIT_REQUESTED) {
+            /* set to uninitialized so that the algorithm can be reinitialized */
+            algo_algorithms[i].state = ALGO_UNINITIALIZED;
 
-                ALGO_UnlockInitialization();
-            }
+            ALGO_UnlockInitialization();
         }
     }
-
-    counter_ticks += ALGO_TICK_ms;
 }
 
 extern void ALGO_MonitorExecutionTime(void) {
@@ -166,6 +249,14 @@ extern void ALGO_MonitorExecutionTime(void) {
     }
 }
 
+extern void ALGO_GetRuntimeStatistics(uint32_t algorithmIndex, ALGO_RUNTIME_s *pRuntime) {
+    FAS_ASSERT(algorithmIndex < algo_length);
+    FAS_ASSERT(pRuntime != NULL_PTR);
+    OS_EnterTaskCritical();
+    *pRuntime = algo_algorithms[algorithmIndex].runtime;
+    OS_ExitTaskCritical();
+}
+
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
 extern void TEST_ALGO_ResetInitializationRequest() {
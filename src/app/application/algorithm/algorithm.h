@@ -84,6 +84,13 @@ extern void ALGO_MainFunction(void);
  */
 extern void ALGO_MonitorExecutionTime(void);
 
+/**
+ * @brief   copies the runtime statistics of an algorithm
+ * @param[in]   algorithmIndex  index entry of the algorithm
+ * @param[out]  pRuntime        pointer where the statistics are copied to
+ */
+extern void ALGO_GetRuntimeStatistics(uint32_t algorithmIndex, ALGO_RUNTIME_s *pRuntime);
+
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
 extern void TEST_ALGO_ResetInitializationRequest(void);
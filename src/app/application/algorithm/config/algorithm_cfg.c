@@ -43,7 +43,7 @@
  * @file    algorithm_cfg.c
  * @author  foxBMS Team
  * @date    2017-12-18 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup ALGORITHMS_CONFIGURATION
  * @prefix  ALGO
@@ -56,6 +56,7 @@
 #include "algorithm_cfg.h"
 
 #include "fassert.h"
+#include "load_spectrum.h"
 #include "moving_average.h"
 #include "os.h"
 
@@ -68,7 +69,30 @@
 /*========== Extern Constant and Variable Definitions =======================*/
 /** array of algorithms that should be executed */
 ALGO_TASKS_s algo_algorithms[] = {
-    {ALGO_UNINITIALIZED, 100, 1000, 0, NULL_PTR, &ALGO_MovAverage},
+    {
+        .state                     = ALGO_UNINITIALIZED,
+        .cycleTime_ms              = 100u,
+        .phase_ms                  = 0u,
+        .maxCalculationDuration_ms = 1000u,
+        .stepBudget_ms             = 0u,
+        .startTime                 = 0u,
+        .fpInitialization          = NULL_PTR,
+        .fpAlgorithm               = &ALGO_MovAverage,
+        .fpStep                    = NULL_PTR,
+        .runtime                   = ALGO_RUNTIME_INITIALIZER,
+    },
+    {
+        .state                     = ALGO_UNINITIALIZED,
+        .cycleTime_ms              = LSP_SAMPLE_PERIOD_s * 1000u,
+        .phase_ms                  = 0u,
+        .maxCalculationDuration_ms = 1000u,
+        .stepBudget_ms             = 0u,
+        .startTime                 = 0u,
+        .fpInitialization          = &LSP_Initialize,
+        .fpAlgorithm               = &LSP_UpdateLoadSpectrum,
+        .fpStep                    = NULL_PTR,
+        .runtime                   = ALGO_RUNTIME_INITIALIZER,
+    },
 };
 
 const uint16_t algo_length = sizeof(algo_algorithms) / sizeof(algo_algorithms[0]);
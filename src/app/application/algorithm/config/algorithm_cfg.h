@@ -79,6 +79,21 @@ typedef STD_RETURN_TYPE_e ALGO_INITIALIZATION_FUNCTION_f(void);
  */
 typedef void ALGO_COMPUTATION_FUNCTION_f(void);
 
+/** result of one step of a resumable algorithm */
+typedef enum {
+    ALGO_STEP_FINISHED, /*!< the computation of the current cycle is complete */
+    ALGO_STEP_PENDING,  /*!< further steps are needed to complete the computation of the current cycle */
+} ALGO_STEP_RESULT_e;
+
+/**
+ * function type for one step of a resumable algorithm
+ * @details The scheduler calls the step function repeatedly until it returns
+ *          #ALGO_STEP_FINISHED. If the time budget of a tick is exhausted,
+ *          the remaining steps are executed in the following ticks.
+ * @returns #ALGO_STEP_PENDING as long as the computation is not complete
+ */
+typedef ALGO_STEP_RESULT_e ALGO_COMPUTATION_STEP_FUNCTION_f(void);
+
 /** states that an algorithm can take */
 typedef enum {
     ALGO_UNINITIALIZED,    /*!< This is the default value indicating that initialization has not run yet */
@@ -90,17 +105,42 @@ typedef enum {
     ALGO_REINIT_REQUESTED, /*!< This indicates that a reinitialization of the algorithm has been requested. */
 } ALGO_STATE_e;
 
+/** runtime statistics and scheduling bookkeeping of an algorithm */
+typedef struct {
+    uint32_t timeUntilActivation_ms; /*!< remaining time until the next activation of the algorithm */
+    uint32_t activations;            /*!< number of started computation cycles */
+    uint32_t steps;                  /*!< number of calls of the computation (step) function */
+    uint32_t lastDuration_ms;        /*!< duration of the last completed computation cycle */
+    uint32_t maxDuration_ms;         /*!< longest completed computation cycle */
+    uint32_t suspensions;            /*!< number of times a cycle was continued in the next tick */
+    uint32_t missedActivations;      /*!< number of activations skipped as the previous cycle was not finished */
+} ALGO_RUNTIME_s;
+
 /** Struct representing the key parameters of an algorithm */
 typedef struct {
     ALGO_STATE_e state;                               /*!< current execution state */
     uint32_t cycleTime_ms;                            /*!< cycle time of algorithm */
-    uint32_t maxCalculationDuration_ms;               /*!< maximum allowed calculation duration for task */
+    uint32_t phase_ms;                                /*!< offset of the activations within the cycle;
+        must be a multiple of #ALGO_TICK_ms and smaller than the cycle time */
+    uint32_t maxCalculationDuration_ms;               /*!< maximum allowed calculation duration for task, measured
+        from the activation of the algorithm (deadline) */
+    uint32_t stepBudget_ms;                           /*!< time per tick that may be spent in steps of a resumable
+        algorithm; at least one step is executed per tick */
     uint32_t startTime;                               /*!< start time when executing algorithm */
     ALGO_INITIALIZATION_FUNCTION_f *fpInitialization; /*!< callback function for init;
         set to #NULL_PTR if not needed; return #STD_OK if init successful */
-    ALGO_COMPUTATION_FUNCTION_f *fpAlgorithm;         /*!< callback function */
+    ALGO_COMPUTATION_FUNCTION_f *fpAlgorithm;         /*!< callback function; set to #NULL_PTR for
+        resumable algorithms */
+    ALGO_COMPUTATION_STEP_FUNCTION_f *fpStep;         /*!< step function of resumable algorithms; set to
+        #NULL_PTR if the algorithm runs to completion in #ALGO_TASKS_s::fpAlgorithm */
+    ALGO_RUNTIME_s runtime;                           /*!< runtime statistics; initialize with
+        #ALGO_RUNTIME_INITIALIZER */
 } ALGO_TASKS_s;
 
+/** initializer for #ALGO_TASKS_s::runtime */
+#define ALGO_RUNTIME_INITIALIZER \
+    { 0u, 0u, 0u, 0u, 0u, 0u, 0u }
+
 /*========== Extern Constant and Variable Declarations ======================*/
 /** Array with pointer to the different algorithms */
 extern ALGO_TASKS_s algo_algorithms[];
@@ -0,0 +1,339 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    load_spectrum.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup ALGORITHMS
+ * @prefix  LSP
+ *
+ * @brief   Lifetime load spectrum of the battery strings
+ * @details The time spent per maximum cell temperature, average SOC and
+ *          C-rate bin is accumulated in integer histograms. The SOC is cycle
+ *          counted with a streaming rainflow counting: the SOC reversals are
+ *          kept on a bounded stack (residue) and every closed cycle is
+ *          counted in its depth of discharge bin as soon as it is detected.
+ *          The histograms and the residue are periodically stored in the
+ *          FRAM.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "load_spectrum.h"
+
+#include "load_spectrum_cfg.h"
+
+#include "database.h"
+#include "database_helper.h"
+#include "diag.h"
+#include "fassert.h"
+#include "foxmath.h"
+#include "fram.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** maximum SOC in 0.1% */
+#define LSP_MAXIMUM_SOC_dperc (1000u)
+
+/** C-rate bins converted to currents in mA @{*/
+#define LSP_C_RATE_LOWER_LIMIT_mA ((LSP_C_RATE_LOWER_LIMIT_dC * LSP_NOMINAL_CAPACITY_mAh) / 10)
+#define LSP_C_RATE_BIN_WIDTH_mA   ((LSP_C_RATE_BIN_WIDTH_dC * LSP_NOMINAL_CAPACITY_mAh) / 10)
+/**@}*/
+
+/** This structure contains all the variables relevant for the load spectrum */
+typedef struct {
+    /** true if the initialization has passed, false otherwise */
+    bool isInitialized;
+    /** time since the last checkpoint in the FRAM */
+    uint32_t timeSinceCheckpoint_s;
+} LSP_STATE_s;
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** state variable for the load spectrum */
+static LSP_STATE_s lsp_state = {
+    .isInitialized         = false,
+    .timeSinceCheckpoint_s = 0u,
+};
+
+/** local copies of database tables */
+/**@{*/
+static DATA_BLOCK_MIN_MAX_s lsp_tableMinMax               = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+static DATA_BLOCK_SOC_s lsp_tableSoc                      = {.header.uniqueId = DATA_BLOCK_ID_SOC};
+static DATA_BLOCK_CURRENT_SENSOR_s lsp_tableCurrentSensor = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_SENSOR};
+/**@}*/
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   returns the bin of a value
+ * @details Values below the lower limit are counted in the first bin, values
+ *          above the range of the bins in the last bin.
+ * @param[in]   value       value to be sorted
+ * @param[in]   lowerLimit  lower limit of the first bin
+ * @param[in]   binWidth    width of the bins (must be positive)
+ * @param[in]   nrOfBins    number of bins
+ * @return  index of the bin
+ */
+static uint8_t LSP_GetBin(int32_t value, int32_t lowerLimit, int32_t binWidth, uint8_t nrOfBins);
+
+/** @brief   clears the load spectrum of all strings */
+static void LSP_ClearLoadSpectrum(void);
+
+/**
+ * @brief   counts the cycle between two reversals
+ * @param[in]   stringNumber    addressed string
+ * @param[in]   from_dperc      SOC at the first reversal
+ * @param[in]   to_dperc        SOC at the second reversal
+ * @param[in]   nrOfHalfCycles  1 for a half cycle, 2 for a full cycle
+ */
+static void LSP_AddCycle(uint8_t stringNumber, uint16_t from_dperc, uint16_t to_dperc, uint32_t nrOfHalfCycles);
+
+/**
+ * @brief   removes all closed cycles from the residue
+ * @details Rainflow counting (ASTM E1049): as long as the last range is not
+ *          smaller than the range before, the range before is a closed
+ *          cycle. If it contains the first reversal of the residue, it is
+ *          counted as half cycle and the first reversal is removed.
+ *          Otherwise it is counted as full cycle and both of its reversals
+ *          are removed.
+ * @param[in]   stringNumber    addressed string
+ */
+static void LSP_ReduceResidue(uint8_t stringNumber);
+
+/**
+ * @brief   adds an SOC sample to the rainflow counting
+ * @details The last entry of the residue is the extreme SOC since the last
+ *          reversal. It is confirmed as reversal as soon as the SOC changes
+ *          by at least #LSP_REVERSAL_HYSTERESIS_dperc against the current
+ *          direction. If the residue is full, its first range is counted as
+ *          half cycle to keep the stack bounded.
+ * @param[in]   stringNumber    addressed string
+ * @param[in]   soc_dperc       SOC in 0.1%
+ */
+static void LSP_CountCycles(uint8_t stringNumber, uint16_t soc_dperc);
+
+/*========== Static Function Implementations ================================*/
+static uint8_t LSP_GetBin(int32_t value, int32_t lowerLimit, int32_t binWidth, uint8_t nrOfBins) {
+    uint8_t bin = 0u;
+    if (value >= lowerLimit) {
+        const int32_t index = (value - lowerLimit) / binWidth;
+        bin                 = (index < (int32_t)nrOfBins) ? (uint8_t)index : (nrOfBins - 1u);
+    }
+    return bin;
+}
+
+static void LSP_ClearLoadSpectrum(void) {
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        for (uint8_t i = 0u; i < FRAM_LOAD_SPECTRUM_NR_OF_TEMPERATURE_BINS; i++) {
+            fram_loadSpectrum.temperatureResidency_s[s][i] = 0u;
+        }
+        for (uint8_t i = 0u; i < FRAM_LOAD_SPECTRUM_NR_OF_SOC_BINS; i++) {
+            fram_loadSpectrum.socResidency_s[s][i] = 0u;
+        }
+        for (uint8_t i = 0u; i < FRAM_LOAD_SPECTRUM_NR_OF_C_RATE_BINS; i++) {
+            fram_loadSpectrum.cRateResidency_s[s][i] = 0u;
+        }
+        for (uint8_t i = 0u; i < FRAM_LOAD_SPECTRUM_NR_OF_CYCLE_BINS; i++) {
+            fram_loadSpectrum.halfCycles[s][i] = 0u;
+        }
+        fram_loadSpectrum.nrOfResidues[s] = 0u;
+    }
+}
+
+static void LSP_AddCycle(uint8_t stringNumber, uint16_t from_dperc, uint16_t to_dperc, uint32_t nrOfHalfCycles) {
+    const int32_t range_dperc = MATH_AbsInt32_t((int32_t)to_dperc - (int32_t)from_dperc);
+    const uint8_t bin =
+        LSP_GetBin(range_dperc, 0, LSP_CYCLE_BIN_WIDTH_dperc, (uint8_t)FRAM_LOAD_SPECTRUM_NR_OF_CYCLE_BINS);
+    fram_loadSpectrum.halfCycles[stringNumber][bin] += nrOfHalfCycles;
+}
+
+static void LSP_ReduceResidue(uint8_t stringNumber) {
+    uint16_t *pResidue = fram_loadSpectrum.residue_dperc[stringNumber];
+    uint8_t n          = fram_loadSpectrum.nrOfResidues[stringNumber];
+    bool isReduced     = false;
+    while ((n >= 3u) && (isReduced == false)) {
+        const int32_t lastRange     = MATH_AbsInt32_t((int32_t)pResidue[n - 1u] - (int32_t)pResidue[n - 2u]);
+        const int32_t previousRange = MATH_AbsInt32_t((int32_t)pResidue[n - 2u] - (int32_t)pResidue[n - 3u]);
+        if (lastRange < previousRange) {
+            isReduced = true;
+        } else if (n == 3u) {
+            LSP_AddCycle(stringNumber, pResidue[0u], pResidue[1u], 1u);
+            pResidue[0u] = pResidue[1u];
+            pResidue[1u] = pResidue[2u];
+            n            = 2u;
+        } else {
+            LSP_AddCycle(stringNumber, pResidue[n - 3u], pResidue[n - 2u], 2u);
+            pResidue[n - 3u] = pResidue[n - 1u];
+            n -= 2u;
+        }
+    }
+    fram_loadSpectrum.nrOfResidues[stringNumber] = n;
+}
+
+static void LSP_CountCycles(uint8_t stringNumber, uint16_t soc_dperc) {
+    uint16_t *pResidue = fram_loadSpectrum.residue_dperc[stringNumber];
+    const uint8_t n    = fram_loadSpectrum.nrOfResidues[stringNumber];
+    if (n == 0u) {
+        /* first sample is the start of the first range */
+        pResidue[0u]                                 = soc_dperc;
+        fram_loadSpectrum.nrOfResidues[stringNumber] = 1u;
+    } else if (n == 1u) {
+        /* the direction is set as soon as the SOC leaves the hysteresis */
+        if ((uint32_t)MATH_AbsInt32_t((int32_t)soc_dperc - (int32_t)pResidue[0u]) >= LSP_REVERSAL_HYSTERESIS_dperc) {
+            pResidue[1u]                                 = soc_dperc;
+            fram_loadSpectrum.nrOfResidues[stringNumber] = 2u;
+        }
+    } else {
+        const int32_t extreme_dperc = (int32_t)pResidue[n - 1u];
+        const int32_t change_dperc  = (int32_t)soc_dperc - extreme_dperc;
+        const bool isRising         = pResidue[n - 1u] > pResidue[n - 2u];
+        if (((isRising == true) && (change_dperc > 0)) || ((isRising == false) && (change_dperc < 0))) {
+            /* the current range continues */
+            pResidue[n - 1u] = soc_dperc;
+        } else if ((uint32_t)MATH_AbsInt32_t(change_dperc) >= LSP_REVERSAL_HYSTERESIS_dperc) {
+            /* the extreme is a reversal, the new sample the extreme of the next range */
+            LSP_ReduceResidue(stringNumber);
+            if (fram_loadSpectrum.nrOfResidues[stringNumber] == FRAM_LOAD_SPECTRUM_NR_OF_RESIDUES) {
+                LSP_AddCycle(stringNumber, pResidue[0u], pResidue[1u], 1u);
+                for (uint8_t i = 1u; i < FRAM_LOAD_SPECTRUM_NR_OF_RESIDUES; i++) {
+                    pResidue[i - 1u] = pResidue[i];
+                }
+                fram_loadSpectrum.nrOfResidues[stringNumber]--;
+            }
+            pResidue[fram_loadSpectrum.nrOfResidues[stringNumber]] = soc_dperc;
+            fram_loadSpectrum.nrOfResidues[stringNumber]++;
+        } else {
+            /* change within the hysteresis */
+        }
+    }
+}
+
+/*========== Extern Function Implementations ================================*/
+extern STD_RETURN_TYPE_e LSP_Initialize(void) {
+    STD_RETURN_TYPE_e retVal            = STD_OK;
+    const FRAM_RETURN_TYPE_e framAccess = FRAM_ReadData(FRAM_BLOCK_ID_LOAD_SPECTRUM);
+    if (framAccess == FRAM_ACCESS_CRC_ERROR) {
+        /* the load spectrum has never been stored or is corrupt: the lifetime data is lost */
+        LSP_ClearLoadSpectrum();
+        (void)DIAG_Handler(DIAG_ID_LOAD_SPECTRUM_RESET, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u);
+    } else if (framAccess == FRAM_ACCESS_OK) {
+        for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+            bool isResidueValid = fram_loadSpectrum.nrOfResidues[s] <= FRAM_LOAD_SPECTRUM_NR_OF_RESIDUES;
+            for (uint8_t i = 0u; (i < fram_loadSpectrum.nrOfResidues[s]) && (isResidueValid == true); i++) {
+                isResidueValid = fram_loadSpectrum.residue_dperc[s][i] <= LSP_MAXIMUM_SOC_dperc;
+            }
+            if (isResidueValid == false) {
+                /* the counted cycles remain valid, the open reversals are discarded */
+                fram_loadSpectrum.nrOfResidues[s] = 0u;
+            }
+        }
+    } else {
+        /* the stored load spectrum is unknown and must not be overwritten */
+        retVal = STD_NOT_OK;
+    }
+    lsp_state.timeSinceCheckpoint_s = 0u;
+    lsp_state.isInitialized         = (retVal == STD_OK);
+    return retVal;
+}
+
+extern void LSP_UpdateLoadSpectrum(void) {
+    if (lsp_state.isInitialized == true) {
+        DATA_READ_DATA(&lsp_tableMinMax, &lsp_tableSoc, &lsp_tableCurrentSensor);
+        /* until the state estimation has been initialized and the first current has been measured, the entries hold
+         * their default values; counting them would add spurious residency and cycles to the lifetime data */
+        const bool isSocAvailable     = DATA_DatabaseEntryUpdatedAtLeastOnce(lsp_tableSoc.header);
+        const bool isCurrentAvailable = DATA_DatabaseEntryUpdatedAtLeastOnce(lsp_tableCurrentSensor.header);
+        for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+            if (lsp_tableMinMax.validMeasuredCellTemperatures[s] > 0u) {
+                const uint8_t bin = LSP_GetBin(
+                    (int32_t)lsp_tableMinMax.maximumTemperature_ddegC[s],
+                    LSP_TEMPERATURE_LOWER_LIMIT_ddegC,
+                    LSP_TEMPERATURE_BIN_WIDTH_ddegC,
+                    (uint8_t)FRAM_LOAD_SPECTRUM_NR_OF_TEMPERATURE_BINS);
+                fram_loadSpectrum.temperatureResidency_s[s][bin] += LSP_SAMPLE_PERIOD_s;
+            }
+
+            if (isSocAvailable == true) {
+                const float_t soc_dperc =
+                    fminf(fmaxf(10.0f * lsp_tableSoc.averageSoc_perc[s], 0.0f), (float_t)LSP_MAXIMUM_SOC_dperc);
+                const uint16_t socSample_dperc = (uint16_t)lroundf(soc_dperc);
+                const uint8_t socBin           = LSP_GetBin(
+                    (int32_t)socSample_dperc, 0, LSP_SOC_BIN_WIDTH_dperc, (uint8_t)FRAM_LOAD_SPECTRUM_NR_OF_SOC_BINS);
+                fram_loadSpectrum.socResidency_s[s][socBin] += LSP_SAMPLE_PERIOD_s;
+                LSP_CountCycles(s, socSample_dperc);
+            }
+
+            if ((isCurrentAvailable == true) && (lsp_tableCurrentSensor.invalidCurrentMeasurement[s] == 0u)) {
+                int32_t current_mA = lsp_tableCurrentSensor.current_mA[s];
+#if BS_POSITIVE_DISCHARGE_CURRENT == false
+                current_mA *= (-1);
+#endif /* BS_POSITIVE_DISCHARGE_CURRENT == false */
+                const uint8_t bin = LSP_GetBin(
+                    current_mA,
+                    LSP_C_RATE_LOWER_LIMIT_mA,
+                    LSP_C_RATE_BIN_WIDTH_mA,
+                    (uint8_t)FRAM_LOAD_SPECTRUM_NR_OF_C_RATE_BINS);
+                fram_loadSpectrum.cRateResidency_s[s][bin] += LSP_SAMPLE_PERIOD_s;
+            }
+        }
+
+        lsp_state.timeSinceCheckpoint_s += LSP_SAMPLE_PERIOD_s;
+        if (lsp_state.timeSinceCheckpoint_s >= LSP_CHECKPOINT_PERIOD_s) {
+            if (FRAM_WriteData(FRAM_BLOCK_ID_LOAD_SPECTRUM) == FRAM_ACCESS_OK) {
+                lsp_state.timeSinceCheckpoint_s = 0u;
+            }
+        }
+    }
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern void TEST_LSP_CountCycles(uint8_t stringNumber, uint16_t soc_dperc) {
+    LSP_CountCycles(stringNumber, soc_dperc);
+}
+#endif
@@ -0,0 +1,96 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    load_spectrum.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup ALGORITHMS
+ * @prefix  LSP
+ *
+ * @brief   Header for the lifetime load spectrum
+ *
+ */
+
+#ifndef FOXBMS__LOAD_SPECTRUM_H_
+#define FOXBMS__LOAD_SPECTRUM_H_
+
+/*========== Includes =======================================================*/
+#include "load_spectrum_cfg.h"
+
+#include "fstd_types.h"
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   Restores the load spectrum from the FRAM
+ * @details A load spectrum that has never been stored (CRC error) is started
+ *          from zero.
+ * @return  #STD_NOT_OK if the FRAM could not be accessed, i.e., the load
+ *          spectrum is not recorded to not overwrite the stored one,
+ *          #STD_OK otherwise
+ */
+extern STD_RETURN_TYPE_e LSP_Initialize(void);
+
+/**
+ * @brief   Adds one sample of all strings to the load spectrum
+ * @details Every sample is sorted into the temperature, SOC and C-rate bins
+ *          with a constant number of integer operations. The SOC is cycle
+ *          counted with streaming rainflow counting on the reversals. The
+ *          load spectrum is stored in the FRAM every
+ *          #LSP_CHECKPOINT_PERIOD_s. Has to be called every
+ *          #LSP_SAMPLE_PERIOD_s.
+ */
+extern void LSP_UpdateLoadSpectrum(void);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern void TEST_LSP_CountCycles(uint8_t stringNumber, uint16_t soc_dperc);
+#endif
+
+#endif /* FOXBMS__LOAD_SPECTRUM_H_ */
@@ -0,0 +1,113 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    load_spectrum_cfg.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup ALGORITHMS_CONFIGURATION
+ * @prefix  LSP
+ *
+ * @brief   Configuration of the bins of the lifetime load spectrum
+ * @details A value is sorted into bin (value - lower limit) / bin width.
+ *          Values outside of the configured range are counted in the first
+ *          or last bin. The number of bins is part of the FRAM layout and
+ *          is therefore defined in fram_cfg.h.
+ *
+ */
+
+#ifndef FOXBMS__LOAD_SPECTRUM_CFG_H_
+#define FOXBMS__LOAD_SPECTRUM_CFG_H_
+
+/*========== Includes =======================================================*/
+
+#include "battery_cell_cfg.h"
+#include "battery_system_cfg.h"
+#include "fram_cfg.h"
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** Time between two samples of the load spectrum in s, i.e., the cycle time of the algorithm */
+#define LSP_SAMPLE_PERIOD_s (1u)
+
+/** Time between two checkpoints of the load spectrum in the FRAM in s */
+#define LSP_CHECKPOINT_PERIOD_s (600u)
+
+/** Lower limit of the maximum cell temperature bins in 0.1 &deg;C (bins from -20 &deg;C to 80 &deg;C) */
+#define LSP_TEMPERATURE_LOWER_LIMIT_ddegC (-200)
+
+/** Width of the maximum cell temperature bins in 0.1 &deg;C */
+#define LSP_TEMPERATURE_BIN_WIDTH_ddegC (100)
+
+/** Width of the SOC bins in 0.1% (bins from 0% to 100%) */
+#define LSP_SOC_BIN_WIDTH_dperc (100)
+
+/** Lower limit of the C-rate bins in 0.1C, positive in discharge direction (bins from -3C to 3C) */
+#define LSP_C_RATE_LOWER_LIMIT_dC (-30)
+
+/** Width of the C-rate bins in 0.1C */
+#define LSP_C_RATE_BIN_WIDTH_dC (5)
+
+/** Width of the depth of discharge bins of the rainflow counting in 0.1% */
+#define LSP_CYCLE_BIN_WIDTH_dperc (100)
+
+/**
+ * Minimum SOC change in 0.1% against the current direction that is detected
+ * as reversal; smaller changes are considered as noise
+ */
+#define LSP_REVERSAL_HYSTERESIS_dperc (5u)
+
+/** Nominal capacity of a cell block in mAh that corresponds to 1C */
+#define LSP_NOMINAL_CAPACITY_mAh ((int32_t)(BS_NR_OF_PARALLEL_CELLS_PER_CELL_BLOCK * BC_CAPACITY_mAh))
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+#endif
+
+#endif /* FOXBMS__LOAD_SPECTRUM_CFG_H_ */
@@ -43,7 +43,7 @@
  * @file    moving_average.c
  * @author  foxBMS Team
  * @date    2017-12-18 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup ALGORITHMS
  * @prefix  ALGO
@@ -58,6 +58,7 @@
 #include "algorithm_cfg.h"
 
 #include "database.h"
+#include "fassert.h"
 #include "fstd_types.h"
 
 #include <math.h>
@@ -100,56 +101,30 @@
 #define ALGO_NUMBER_AVERAGE_VALUES_POW_CFG (MOVING_AVERAGE_DURATION_POWER_CONFIG_ms / ISA_POWER_CYCLE_TIME_ms)
 #endif
 
+/**
+ * configurable windows that are longer than the 60s ring buffer are evaluated
+ * with a cascaded moving average with a resolution of 1s @{
+ */
+#define ALGO_CASCADE_CURRENT_CFG (ALGO_NUMBER_AVERAGE_VALUES_CUR_CFG > ALGO_NUMBER_AVERAGE_VALUES_CUR_60s)
+#define ALGO_CASCADE_POWER_CFG   (ALGO_NUMBER_AVERAGE_VALUES_POW_CFG > ALGO_NUMBER_AVERAGE_VALUES_POW_60s)
+/**@}*/
+
 /*========== Static Constant and Variable Definitions =======================*/
 
-/* Arrays in extern SDRAM to calculate moving average current and power */
+/* Arrays in extern SDRAM to calculate moving average current and power over up to 60s */
+static float_t MEM_EXT_SDRAM curValues[ALGO_NUMBER_AVERAGE_VALUES_CUR_60s + 1u] = {0.0f};
+static float_t MEM_EXT_SDRAM powValues[ALGO_NUMBER_AVERAGE_VALUES_POW_60s + 1u] = {0.0f};
 
-/* Check if minimum algorithm cycle time > current sensor sample time */
-#if ALGO_TICK_ms > ISA_CURRENT_CYCLE_TIME_ms
-#if MOVING_AVERAGE_DURATION_CURRENT_CONFIG_ms / ALGO_TICK_ms > 60000u / ALGO_TICK_ms
-/* If array length of configured time > 60s array take this array size */
-static float_t MEM_EXT_SDRAM curValues[(MOVING_AVERAGE_DURATION_CURRENT_CONFIG_ms / ALGO_TICK_ms) + 1u] = {};
-static uint32_t movingAverageCurrentLength = (MOVING_AVERAGE_DURATION_CURRENT_CONFIG_ms / ALGO_TICK_ms) + 1u;
-#else
-/* Take array size of 60s moving average */
-static float_t MEM_EXT_SDRAM curValues[(60000u / ALGO_TICK_ms) + 1u] = {};
-static uint32_t movingAverageCurrentLength                           = (60000u / ALGO_TICK_ms) + 1;
-#endif
-#else
-/* If array length of configured time > 60s array take this array size */
-#if (MOVING_AVERAGE_DURATION_CURRENT_CONFIG_ms / ISA_CURRENT_CYCLE_TIME_ms) > (60000u / ISA_CURRENT_CYCLE_TIME_ms)
-static float_t MEM_EXT_SDRAM
-    curValues[(MOVING_AVERAGE_DURATION_CURRENT_CONFIG_ms / ISA_CURRENT_CYCLE_TIME_ms) + 1u] = {};
-static uint32_t movingAverageCurrentLength = (MOVING_AVERAGE_DURATION_CURRENT_CONFIG_ms / ISA_CURRENT_CYCLE_TIME_ms) +
-                                             1u;
-#else
-/* Take array size of 60s moving average */
-static float_t MEM_EXT_SDRAM curValues[(60000u / ISA_CURRENT_CYCLE_TIME_ms) + 1u] = {0.0f};
-static uint32_t movingAverageCurrentLength = (60000u / ISA_CURRENT_CYCLE_TIME_ms) + 1u;
-#endif
-#endif
+static uint32_t movingAverageCurrentLength = ALGO_NUMBER_AVERAGE_VALUES_CUR_60s + 1u;
+static uint32_t movingAveragePowerLength   = ALGO_NUMBER_AVERAGE_VALUES_POW_60s + 1u;
 
-/* Check if minimum algorithm cycle time > current sensor sample time */
-#if ALGO_TICK_ms > ISA_POWER_CYCLE_TIME_ms
-#if (MOVING_AVERAGE_DURATION_POWER_CONFIG_ms / ALGO_TICK_ms) > (60000u / ALGO_TICK_ms)
-/* If array length of configured time > 60s array take this array size */
-static float_t MEM_EXT_SDRAM powValues[(MOVING_AVERAGE_DURATION_POWER_CONFIG_ms / ALGO_TICK_ms) + 1u] = {};
-static uint32_t movingAveragePowerLength = (MOVING_AVERAGE_DURATION_POWER_CONFIG_ms / ALGO_TICK_ms) + 1u;
-#else
-/* Take array size of 60s moving average */
-static float_t MEM_EXT_SDRAM powValues[(60000u / ALGO_TICK_ms) + 1] = {};
-static uint32_t movingAveragePowerLength                            = (60000u / ALGO_TICK_ms) + 1u;
-#endif
-#else
-#if (MOVING_AVERAGE_DURATION_POWER_CONFIG_ms / ISA_POWER_CYCLE_TIME_ms) > (60000u / ISA_POWER_CYCLE_TIME_ms)
-/* If array length of configured time > 60s array take this array size */
-static float_t MEM_EXT_SDRAM powValues[(MOVING_AVERAGE_DURATION_POWER_CONFIG_ms / ISA_POWER_CYCLE_TIME_ms) + 1u] = {};
-static uint32_t movingAveragePowerLength = (MOVING_AVERAGE_DURATION_POWER_CONFIG_ms / ISA_POWER_CYCLE_TIME_ms) + 1u;
-#else
-/* Take array size of 60s moving average */
-static float_t MEM_EXT_SDRAM powValues[(60000u / ISA_POWER_CYCLE_TIME_ms) + 1u] = {0.0f};
-static uint32_t movingAveragePowerLength = (60000u / ISA_POWER_CYCLE_TIME_ms) + 1u;
+#if ALGO_CASCADE_CURRENT_CFG
+/** cascaded moving average of the current for the configurable window */
+static ALGO_CASCADED_AVERAGE_s algo_currentCascade = {.samplesPerBucket = ALGO_NUMBER_AVERAGE_VALUES_CUR_1s};
 #endif
+#if ALGO_CASCADE_POWER_CFG
+/** cascaded moving average of the power for the configurable window */
+static ALGO_CASCADED_AVERAGE_s algo_powerCascade = {.samplesPerBucket = ALGO_NUMBER_AVERAGE_VALUES_POW_1s};
 #endif
 
 /** Pointer for current moving average calculation @{*/
@@ -159,7 +134,9 @@ static float_t *pMovingAverageCurrent_5s  = &curValues[0];
 static float_t *pMovingAverageCurrent_10s = &curValues[0];
 static float_t *pMovingAverageCurrent_30s = &curValues[0];
 static float_t *pMovingAverageCurrent_60s = &curValues[0];
+#if !ALGO_CASCADE_CURRENT_CFG
 static float_t *pMovingAverageCurrent_cfg = &curValues[0];
+#endif
 /**@}*/
 
 /** Pointer for power moving average calculation @{*/
@@ -169,7 +146,9 @@ static float_t *pMovingAveragePower_5s  = &powValues[0];
 static float_t *pMovingAveragePower_10s = &powValues[0];
 static float_t *pMovingAveragePower_30s = &powValues[0];
 static float_t *pMovingAveragePower_60s = &powValues[0];
+#if !ALGO_CASCADE_POWER_CFG
 static float_t *pMovingAveragePower_cfg = &powValues[0];
+#endif
 /**@}*/
 
 /*========== Extern Constant and Variable Definitions =======================*/
@@ -227,8 +206,14 @@ extern void ALGO_MovAverage(void) {
             movingAverage_tab.movingAverageCurrent30sInterval_mA += (*pMovingAverageCurrentNew) / divider;
             divider = ALGO_NUMBER_AVERAGE_VALUES_CUR_60s;
             movingAverage_tab.movingAverageCurrent60sInterval_mA += (*pMovingAverageCurrentNew) / divider;
+#if ALGO_CASCADE_CURRENT_CFG
+            ALGO_AddToCascadedAverage(&algo_currentCascade, *pMovingAverageCurrentNew);
+            movingAverage_tab.movingAverageCurrentConfigurableInterval_mA =
+                ALGO_GetCascadedAverage(&algo_currentCascade, ALGO_NUMBER_AVERAGE_VALUES_CUR_CFG);
+#else
             divider = ALGO_NUMBER_AVERAGE_VALUES_CUR_CFG;
             movingAverage_tab.movingAverageCurrentConfigurableInterval_mA += (*pMovingAverageCurrentNew) / divider;
+#endif
 
             /* Then, increment pointer and subtract oldest value when respective window is filled with data */
             pMovingAverageCurrentNew++;
@@ -277,6 +262,7 @@ extern void ALGO_MovAverage(void) {
                     curInit |= 0x10u;
                 }
             }
+#if !ALGO_CASCADE_CURRENT_CFG
             if ((curInit & 0x20u) == 0x20u) {
                 divider = ALGO_NUMBER_AVERAGE_VALUES_CUR_CFG;
                 movingAverage_tab.movingAverageCurrentConfigurableInterval_mA -= (*pMovingAverageCurrent_cfg) / divider;
@@ -286,6 +272,7 @@ extern void ALGO_MovAverage(void) {
                     curInit |= 0x20u;
                 }
             }
+#endif
 
             /* Check pointer for buffer overflow */
             if (pMovingAverageCurrentNew > &curValues[movingAverageCurrentLength - 1u]) {
@@ -306,9 +293,11 @@ extern void ALGO_MovAverage(void) {
             if (pMovingAverageCurrent_60s > &curValues[movingAverageCurrentLength - 1u]) {
                 pMovingAverageCurrent_60s = &curValues[0u];
             }
+#if !ALGO_CASCADE_CURRENT_CFG
             if (pMovingAverageCurrent_cfg > &curValues[movingAverageCurrentLength - 1u]) {
                 pMovingAverageCurrent_cfg = &curValues[0u];
             }
+#endif
         }
     }
 
@@ -346,8 +335,14 @@ extern void ALGO_MovAverage(void) {
             movingAverage_tab.movingAveragePower30sInterval_mA += (*pMovingAveragePowerNew) / divider;
             divider = ALGO_NUMBER_AVERAGE_VALUES_POW_60s;
             movingAverage_tab.movingAveragePower60sInterval_mA += (*pMovingAveragePowerNew) / divider;
+#if ALGO_CASCADE_POWER_CFG
+            ALGO_AddToCascadedAverage(&algo_powerCascade, *pMovingAveragePowerNew);
+            movingAverage_tab.movingAveragePowerConfigurableInterval_mA =
+                ALGO_GetCascadedAverage(&algo_powerCascade, ALGO_NUMBER_AVERAGE_VALUES_POW_CFG);
+#else
             divider = ALGO_NUMBER_AVERAGE_VALUES_POW_CFG;
             movingAverage_tab.movingAveragePowerConfigurableInterval_mA += (*pMovingAveragePowerNew) / divider;
+#endif
 
             /* Then, increment pointer and subtract oldest value when respective window is filled with data */
             pMovingAveragePowerNew++;
@@ -396,6 +391,7 @@ extern void ALGO_MovAverage(void) {
                     powInit |= 0x10u;
                 }
             }
+#if !ALGO_CASCADE_POWER_CFG
             if ((powInit & 0x20u) == 0x20u) {
                 divider = ALGO_NUMBER_AVERAGE_VALUES_POW_CFG;
                 movingAverage_tab.movingAveragePowerConfigurableInterval_mA -= ((*pMovingAveragePower_cfg) / divider);
@@ -405,6 +401,7 @@ extern void ALGO_MovAverage(void) {
                     powInit |= 0x20u;
                 }
             }
+#endif
 
             /* Check pointer for buffer overflow */
             if (pMovingAveragePowerNew > &powValues[movingAveragePowerLength - 1u]) {
@@ -425,9 +422,11 @@ extern void ALGO_MovAverage(void) {
             if (pMovingAveragePower_60s > &powValues[movingAveragePowerLength - 1u]) {
                 pMovingAveragePower_60s = &powValues[0u];
             }
+#if !ALGO_CASCADE_POWER_CFG
             if (pMovingAveragePower_cfg > &powValues[movingAveragePowerLength - 1u]) {
                 pMovingAveragePower_cfg = &powValues[0u];
             }
+#endif
         }
     }
 
@@ -438,6 +437,94 @@ extern void ALGO_MovAverage(void) {
     }
 }
 
+extern void ALGO_InitializeCascadedAverage(ALGO_CASCADED_AVERAGE_s *pCascade, uint32_t samplesPerBucket) {
+    FAS_ASSERT(pCascade != NULL_PTR);
+    FAS_ASSERT(samplesPerBucket > 0u);
+    pCascade->samplesPerBucket = samplesPerBucket;
+    for (uint8_t l = 0u; l < ALGO_CASCADE_NR_OF_LEVELS; l++) {
+        for (uint16_t b = 0u; b < ALGO_CASCADE_BUCKETS_PER_LEVEL; b++) {
+            pCascade->level[l].bucketSum[b] = 0.0f;
+        }
+        pCascade->level[l].partialSum     = 0.0f;
+        pCascade->level[l].partialSamples = 0u;
+        pCascade->level[l].newestBucket   = 0u;
+        pCascade->level[l].nrOfBuckets    = 0u;
+    }
+}
+
+extern void ALGO_AddToCascadedAverage(ALGO_CASCADED_AVERAGE_s *pCascade, float_t sample) {
+    FAS_ASSERT(pCascade != NULL_PTR);
+    FAS_ASSERT(pCascade->samplesPerBucket > 0u);
+    /* AXIVION Routine Generic-MissingParameterAssert: sample: parameter accepts whole range */
+    pCascade->level[0u].partialSum += sample;
+    pCascade->level[0u].partialSamples++;
+
+    /* pass completed buckets on to the next coarser level */
+    uint32_t bucketSamples = pCascade->samplesPerBucket;
+    for (uint8_t l = 0u; (l < ALGO_CASCADE_NR_OF_LEVELS) && (pCascade->level[l].partialSamples == bucketSamples);
+         l++) {
+        ALGO_CASCADE_LEVEL_s *pLevel = &pCascade->level[l];
+        /* the completed bucket replaces the oldest bucket of the ring buffer */
+        pLevel->newestBucket                   = (pLevel->newestBucket + 1u) % ALGO_CASCADE_BUCKETS_PER_LEVEL;
+        pLevel->bucketSum[pLevel->newestBucket] = pLevel->partialSum;
+        if (pLevel->nrOfBuckets < ALGO_CASCADE_BUCKETS_PER_LEVEL) {
+            pLevel->nrOfBuckets++;
+        }
+        if ((l + 1u) < ALGO_CASCADE_NR_OF_LEVELS) {
+            pCascade->level[l + 1u].partialSum += pLevel->partialSum;
+            pCascade->level[l + 1u].partialSamples += bucketSamples;
+        }
+        pLevel->partialSum     = 0.0f;
+        pLevel->partialSamples = 0u;
+        bucketSamples *= ALGO_CASCADE_BUCKETS_PER_LEVEL;
+    }
+}
+
+extern float_t ALGO_GetCascadedAverage(const ALGO_CASCADED_AVERAGE_s *const kpkCascade, uint32_t windowSamples) {
+    FAS_ASSERT(kpkCascade != NULL_PTR);
+    FAS_ASSERT(kpkCascade->samplesPerBucket > 0u);
+    FAS_ASSERT(windowSamples > 0u);
+
+    /* find the finest level whose ring buffer spans the window */
+    uint8_t level          = 0u;
+    uint32_t bucketSamples = kpkCascade->samplesPerBucket;
+    while (((level + 1u) < ALGO_CASCADE_NR_OF_LEVELS) &&
+           (windowSamples > (bucketSamples * ALGO_CASCADE_BUCKETS_PER_LEVEL))) {
+        level++;
+        bucketSamples *= ALGO_CASCADE_BUCKETS_PER_LEVEL;
+    }
+
+    /* samples that have not been passed on to this level yet */
+    float_t sum      = 0.0f;
+    uint32_t samples = 0u;
+    for (uint8_t l = 0u; l <= level; l++) {
+        sum += kpkCascade->level[l].partialSum;
+        samples += kpkCascade->level[l].partialSamples;
+    }
+
+    /* completed buckets, starting with the newest one */
+    const ALGO_CASCADE_LEVEL_s *const kpkLevel = &kpkCascade->level[level];
+    uint16_t bucket                            = kpkLevel->newestBucket;
+    for (uint16_t b = 0u; (b < kpkLevel->nrOfBuckets) && (samples < windowSamples); b++) {
+        const uint32_t missingSamples = windowSamples - samples;
+        if (missingSamples >= bucketSamples) {
+            sum += kpkLevel->bucketSum[bucket];
+            samples += bucketSamples;
+        } else {
+            /* share of the oldest bucket that is still inside the window */
+            sum += (kpkLevel->bucketSum[bucket] * (float_t)missingSamples) / (float_t)bucketSamples;
+            samples += missingSamples;
+        }
+        bucket = (bucket + ALGO_CASCADE_BUCKETS_PER_LEVEL - 1u) % ALGO_CASCADE_BUCKETS_PER_LEVEL;
+    }
+
+    float_t average = 0.0f;
+    if (samples > 0u) {
+        average = sum / (float_t)samples;
+    }
+    return average;
+}
+
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
 #endif
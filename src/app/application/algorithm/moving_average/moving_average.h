@@ -43,7 +43,7 @@
  * @file    moving_average.h
  * @author  foxBMS Team
  * @date    2017-12-18 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup ALGORITHMS
  * @prefix  ALGO
@@ -57,6 +57,7 @@
 
 /*========== Includes =======================================================*/
 
+#include <math.h>
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
@@ -67,12 +68,79 @@
 #define ISA_CURRENT_CYCLE_TIME_ms (200u)
 #define ISA_POWER_CYCLE_TIME_ms   (200u)
 
+/**
+ * number of levels of the cascaded moving average, each level aggregates
+ * #ALGO_CASCADE_BUCKETS_PER_LEVEL buckets of the next finer level into one
+ * bucket (e.g., 1s, 1min and 1h buckets)
+ */
+#define ALGO_CASCADE_NR_OF_LEVELS (3u)
+
+/** number of buckets per level of the cascaded moving average */
+#define ALGO_CASCADE_BUCKETS_PER_LEVEL (60u)
+
+/** one level of the cascaded moving average */
+typedef struct {
+    float_t bucketSum[ALGO_CASCADE_BUCKETS_PER_LEVEL]; /*!< sums of the completed buckets (ring buffer) */
+    float_t partialSum;                                /*!< sum of the completed finer buckets of the current bucket */
+    uint32_t partialSamples;                           /*!< number of samples in partialSum */
+    uint16_t newestBucket;                             /*!< index of the newest completed bucket */
+    uint16_t nrOfBuckets;                              /*!< number of completed buckets in the ring buffer */
+} ALGO_CASCADE_LEVEL_s;
+
+/**
+ * @brief   cascaded moving average
+ * @details The samples are summed up in buckets of samplesPerBucket samples.
+ *          A completed bucket is stored in the ring buffer of its level and
+ *          added to the current bucket of the next coarser level. The memory
+ *          therefore grows with the logarithm of the longest window instead
+ *          of linearly with the number of samples in the window.
+ */
+typedef struct {
+    uint32_t samplesPerBucket;                            /*!< number of samples per bucket of the finest level */
+    ALGO_CASCADE_LEVEL_s level[ALGO_CASCADE_NR_OF_LEVELS]; /*!< levels from fine to coarse */
+} ALGO_CASCADED_AVERAGE_s;
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
 /** moving average function for the algorithm module */
 extern void ALGO_MovAverage(void);
 
+/**
+ * @brief   Clears a cascaded moving average
+ * @param[out]  pCascade            cascaded moving average
+ * @param[in]   samplesPerBucket    number of samples per bucket of the finest
+ *                                  level, i.e., the time resolution of the
+ *                                  moving average
+ */
+extern void ALGO_InitializeCascadedAverage(ALGO_CASCADED_AVERAGE_s *pCascade, uint32_t samplesPerBucket);
+
+/**
+ * @brief   Adds a sample to a cascaded moving average
+ * @details Only the current bucket of the finest level is updated, unless
+ *          the sample completes a bucket, which is then passed on to the
+ *          coarser levels.
+ * @param[in,out]   pCascade    cascaded moving average
+ * @param[in]       sample      new sample
+ */
+extern void ALGO_AddToCascadedAverage(ALGO_CASCADED_AVERAGE_s *pCascade, float_t sample);
+
+/**
+ * @brief   Returns the average of the latest samples of a cascaded moving
+ *          average
+ * @details The window is evaluated on the finest level that spans it: the
+ *          current buckets, the completed buckets and a share of the oldest
+ *          bucket, assuming that its samples are evenly distributed. As long
+ *          as fewer samples than the window have been added, the average of
+ *          all samples is returned.
+ * @param[in]   kpkCascade      cascaded moving average
+ * @param[in]   windowSamples   length of the window in samples, limited to
+ *                              the span of the coarsest level
+ * @return  average of the samples in the window, 0 if no sample has been
+ *          added
+ */
+extern float_t ALGO_GetCascadedAverage(const ALGO_CASCADED_AVERAGE_s *const kpkCascade, uint32_t windowSamples);
+
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
 #endif
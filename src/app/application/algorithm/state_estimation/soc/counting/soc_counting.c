@@ -76,6 +76,8 @@ typedef struct {
     float_t ccScalingMinimum[BS_NR_OF_STRINGS];   /*!< current sensor offset scaling value for minimum SOC */
     float_t ccScalingMaximum[BS_NR_OF_STRINGS];   /*!< current sensor offset scaling value for maximum SOC */
     uint32_t previousTimestamp[BS_NR_OF_STRINGS]; /*!< timestamp buffer to check if current/CC data has been updated */
+    /** integrated charge that is smaller than the resolution of the SOC (fixed-point arithmetic only) */
+    int64_t chargeRemainder[BS_NR_OF_STRINGS];
 } SOC_STATE_s;
 
 /** Maximum SOC in percentage */
@@ -83,6 +85,14 @@ typedef struct {
 /** Minimum SOC in percentage */
 #define SOC_MINIMUM_SOC_perc (0.0f)
 
+#if SE_USE_FIXED_POINT_ARITHMETIC == true
+/**
+ * The integrated charge is passed in 2^-16 uAs, therefore one LSB of the SOC
+ * in Q16.16 percent corresponds to 1/100 of the string capacity in uAs
+ */
+#define SOC_CHARGE_PER_LSB (SOC_STRING_CAPACITY_uAs / 100)
+#endif /* SE_USE_FIXED_POINT_ARITHMETIC == true */
+
 /*========== Static Constant and Variable Definitions =======================*/
 /** state variable for SOC module */
 static SOC_STATE_s soc_state = {
@@ -92,6 +102,7 @@ static SOC_STATE_s soc_state = {
     .ccScalingMinimum  = {GEN_REPEAT_U(0.0f, GEN_STRIP(BS_NR_OF_STRINGS))},
     .ccScalingMaximum  = {GEN_REPEAT_U(0.0f, GEN_STRIP(BS_NR_OF_STRINGS))},
     .previousTimestamp = {GEN_REPEAT_U(0u, GEN_STRIP(BS_NR_OF_STRINGS))},
+    .chargeRemainder   = {GEN_REPEAT_U(0, GEN_STRIP(BS_NR_OF_STRINGS))},
 };
 
 /** local copies of database tables */
@@ -143,6 +154,32 @@ static void SOC_SetValue(
  */
 static void SOC_CheckDatabaseSocPercentageLimits(DATA_BLOCK_SOC_s *pTableSoc, uint8_t stringNumber);
 
+/**
+ * @brief   Updates the SOC values with the charge that has flowed with the
+ *          passed current during the passed time step
+ * @details With fixed-point arithmetic, the charge that is smaller than the
+ *          resolution of the SOC is kept for the next time step.
+ *          The SOC values are *NOT* limited to [0.0, 100.0].
+ * @param[in,out] pTableSoc      pointer to database struct with SOC values
+ * @param[in]     current_mA     string current
+ * @param[in]     timeStep_ms    time step since the previous update
+ * @param[in]     stringNumber   addressed string
+ */
+static void SOC_IntegrateCurrent(
+    DATA_BLOCK_SOC_s *pTableSoc,
+    int32_t current_mA,
+    uint32_t timeStep_ms,
+    uint8_t stringNumber);
+
+/**
+ * @brief   Sets the SOC values from the coulomb counter of the current sensor
+ * @details The SOC values are *NOT* limited to [0.0, 100.0].
+ * @param[out] pTableSoc           pointer to database struct with SOC values
+ * @param[in]  currentCounter_As   coulomb counter of the current sensor
+ * @param[in]  stringNumber        addressed string
+ */
+static void SOC_ApplyCurrentCounter(DATA_BLOCK_SOC_s *pTableSoc, int32_t currentCounter_As, uint8_t stringNumber);
+
 /**
  * @brief   Set SOC-related values in non-volatile memory
  * @param[in] pTableSoc      pointer to database struct with SOC values
@@ -240,6 +277,106 @@ static void SOC_UpdateNvmValues(DATA_BLOCK_SOC_s *pTableSoc, uint8_t stringNumbe
     fram_soc.maximumSoc_perc[stringNumber] = pTableSoc->maximumSoc_perc[stringNumber];
 }
 
+#if SE_USE_FIXED_POINT_ARITHMETIC == true
+static void SOC_IntegrateCurrent(
+    DATA_BLOCK_SOC_s *pTableSoc,
+    int32_t current_mA,
+    uint32_t timeStep_ms,
+    uint8_t stringNumber) {
+    FAS_ASSERT(pTableSoc != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    /* AXIVION Routine Generic-MissingParameterAssert: current_mA: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: timeStep_ms: parameter accepts whole range */
+
+    /* A charge larger than the string capacity saturates the SOC anyway */
+    int64_t charge_uAs = (int64_t)current_mA * (int64_t)timeStep_ms;
+    if (charge_uAs > SOC_STRING_CAPACITY_uAs) {
+        charge_uAs = SOC_STRING_CAPACITY_uAs;
+    } else if (charge_uAs < -SOC_STRING_CAPACITY_uAs) {
+        charge_uAs = -SOC_STRING_CAPACITY_uAs;
+    } else {
+        /* charge within range */
+    }
+
+#if BS_POSITIVE_DISCHARGE_CURRENT == false
+    charge_uAs *= -1;
+#endif /* BS_POSITIVE_DISCHARGE_CURRENT == false */
+
+    /* Current in charge direction negative means SOC increasing --> BAT naming, not ROB */
+    const MATH_Q16_16 deltaSoc_perc = MATH_AccumulateQ16_16(
+        &soc_state.chargeRemainder[stringNumber], charge_uAs * MATH_Q16_16_ONE, SOC_CHARGE_PER_LSB);
+
+    pTableSoc->averageSoc_perc[stringNumber] = MATH_Q16_16ToFloat(
+        MATH_SubtractQ16_16(MATH_FloatToQ16_16(pTableSoc->averageSoc_perc[stringNumber]), deltaSoc_perc));
+    pTableSoc->minimumSoc_perc[stringNumber] = MATH_Q16_16ToFloat(
+        MATH_SubtractQ16_16(MATH_FloatToQ16_16(pTableSoc->minimumSoc_perc[stringNumber]), deltaSoc_perc));
+    pTableSoc->maximumSoc_perc[stringNumber] = MATH_Q16_16ToFloat(
+        MATH_SubtractQ16_16(MATH_FloatToQ16_16(pTableSoc->maximumSoc_perc[stringNumber]), deltaSoc_perc));
+}
+
+static void SOC_ApplyCurrentCounter(DATA_BLOCK_SOC_s *pTableSoc, int32_t currentCounter_As, uint8_t stringNumber) {
+    FAS_ASSERT(pTableSoc != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    /* AXIVION Routine Generic-MissingParameterAssert: currentCounter_As: parameter accepts whole range */
+
+    /* factor 10^8: conversion As -> uAs (10^6) and fraction -> percent (100) */
+    MATH_Q16_16 deltaSoc_perc =
+        MATH_DivideInt64ToQ16_16((int64_t)currentCounter_As * 100000000LL, SOC_STRING_CAPACITY_uAs);
+
+#if BS_POSITIVE_DISCHARGE_CURRENT == false
+    deltaSoc_perc = MATH_SubtractQ16_16(0, deltaSoc_perc);
+#endif /* BS_POSITIVE_DISCHARGE_CURRENT == false */
+
+    pTableSoc->averageSoc_perc[stringNumber] = MATH_Q16_16ToFloat(
+        MATH_SubtractQ16_16(MATH_FloatToQ16_16(soc_state.ccScalingAverage[stringNumber]), deltaSoc_perc));
+    pTableSoc->minimumSoc_perc[stringNumber] = MATH_Q16_16ToFloat(
+        MATH_SubtractQ16_16(MATH_FloatToQ16_16(soc_state.ccScalingMinimum[stringNumber]), deltaSoc_perc));
+    pTableSoc->maximumSoc_perc[stringNumber] = MATH_Q16_16ToFloat(
+        MATH_SubtractQ16_16(MATH_FloatToQ16_16(soc_state.ccScalingMaximum[stringNumber]), deltaSoc_perc));
+}
+#else
+static void SOC_IntegrateCurrent(
+    DATA_BLOCK_SOC_s *pTableSoc,
+    int32_t current_mA,
+    uint32_t timeStep_ms,
+    uint8_t stringNumber) {
+    FAS_ASSERT(pTableSoc != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    /* AXIVION Routine Generic-MissingParameterAssert: current_mA: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: timeStep_ms: parameter accepts whole range */
+
+    const float_t timeStep_s = (float_t)timeStep_ms / UNIT_CONVERSION_FACTOR_1000_FLOAT;
+
+    /* Current in charge direction negative means SOC increasing --> BAT naming, not ROB */
+    float_t deltaSoc_perc = (((float_t)current_mA * timeStep_s) / SOC_STRING_CAPACITY_mAs) *
+                            UNIT_CONVERSION_FACTOR_100_FLOAT; /* ((mA * s) / mAs) * 100% */
+
+#if BS_POSITIVE_DISCHARGE_CURRENT == false
+    deltaSoc_perc *= (-1.0f);
+#endif /* BS_POSITIVE_DISCHARGE_CURRENT == false */
+
+    pTableSoc->averageSoc_perc[stringNumber] = pTableSoc->averageSoc_perc[stringNumber] - deltaSoc_perc;
+    pTableSoc->minimumSoc_perc[stringNumber] = pTableSoc->minimumSoc_perc[stringNumber] - deltaSoc_perc;
+    pTableSoc->maximumSoc_perc[stringNumber] = pTableSoc->maximumSoc_perc[stringNumber] - deltaSoc_perc;
+}
+
+static void SOC_ApplyCurrentCounter(DATA_BLOCK_SOC_s *pTableSoc, int32_t currentCounter_As, uint8_t stringNumber) {
+    FAS_ASSERT(pTableSoc != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    /* AXIVION Routine Generic-MissingParameterAssert: currentCounter_As: parameter accepts whole range */
+
+    float_t deltaSoc_perc = ((float_t)currentCounter_As / SOC_STRING_CAPACITY_As) * UNIT_CONVERSION_FACTOR_100_FLOAT;
+
+#if BS_POSITIVE_DISCHARGE_CURRENT == false
+    deltaSoc_perc *= (-1.0f);
+#endif /* BS_POSITIVE_DISCHARGE_CURRENT == false */
+
+    pTableSoc->averageSoc_perc[stringNumber] = soc_state.ccScalingAverage[stringNumber] - deltaSoc_perc;
+    pTableSoc->minimumSoc_perc[stringNumber] = soc_state.ccScalingMinimum[stringNumber] - deltaSoc_perc;
+    pTableSoc->maximumSoc_perc[stringNumber] = soc_state.ccScalingMaximum[stringNumber] - deltaSoc_perc;
+}
+#endif /* SE_USE_FIXED_POINT_ARITHMETIC == true */
+
 /*========== Extern Function Implementations ================================*/
 
 void SE_InitializeStateOfCharge(DATA_BLOCK_SOC_s *pSocValues, bool ccPresent, uint8_t stringNumber) {
@@ -269,6 +406,7 @@ void SE_InitializeStateOfCharge(DATA_BLOCK_SOC_s *pSocValues, bool ccPresent, ui
     } else {
         soc_state.previousTimestamp[stringNumber] = soc_tableCurrentSensor.timestampCurrent[stringNumber];
         soc_state.sensorCcUsed[stringNumber]      = false;
+        soc_state.chargeRemainder[stringNumber]   = 0;
     }
 
     pSocValues->averageSoc_perc[stringNumber] = fram_soc.averageSoc_perc[stringNumber];
@@ -305,47 +443,25 @@ void SE_CalculateStateOfCharge(DATA_BLOCK_SOC_s *pSocValues) {
                 if (soc_state.sensorCcUsed[s] == false) {
                     /* check if current measurement has been updated */
                     if (soc_state.previousTimestamp[s] != soc_tableCurrentSensor.timestampCurrent[s]) {
-                        float_t timeStep_s =
-                            ((float_t)(soc_tableCurrentSensor.timestampCurrent[s] - soc_state.previousTimestamp[s])) /
-                            1000.0f;
-
-                        if (timeStep_s > 0.0f) {
-                            /* Current in charge direction negative means SOC increasing --> BAT naming, not ROB */
+                        /* the unsigned difference is also valid if the timestamp has overflowed */
+                        const uint32_t timeStep_ms =
+                            soc_tableCurrentSensor.timestampCurrent[s] - soc_state.previousTimestamp[s];
 
-                            float_t deltaSOC_perc = (((float_t)soc_tableCurrentSensor.current_mA[s] * timeStep_s) /
-                                                     SOC_STRING_CAPACITY_mAs) *
-                                                    100.0f / 1000.0f; /* ((mA) * 1s) / 1As) * 100% */
-
-#if BS_POSITIVE_DISCHARGE_CURRENT == false
-                            deltaSOC_perc *= (-1.0f);
-#endif /* BS_POSITIVE_DISCHARGE_CURRENT == false */
+                        SOC_IntegrateCurrent(pSocValues, soc_tableCurrentSensor.current_mA[s], timeStep_ms, s);
 
-                            pSocValues->averageSoc_perc[s] = pSocValues->averageSoc_perc[s] - deltaSOC_perc;
-                            pSocValues->minimumSoc_perc[s] = pSocValues->minimumSoc_perc[s] - deltaSOC_perc;
-                            pSocValues->maximumSoc_perc[s] = pSocValues->maximumSoc_perc[s] - deltaSOC_perc;
+                        /* Limit SOC calculation to 0% respectively 100% */
+                        SOC_CheckDatabaseSocPercentageLimits(pSocValues, s);
 
-                            /* Limit SOC calculation to 0% respectively 100% */
-                            SOC_CheckDatabaseSocPercentageLimits(pSocValues, s);
+                        /* Update values in non-volatile memory */
+                        SOC_UpdateNvmValues(pSocValues, s);
 
-                            /* Update values in non-volatile memory */
-                            SOC_UpdateNvmValues(pSocValues, s);
-                        }
                         soc_state.previousTimestamp[s] = soc_tableCurrentSensor.timestampCurrent[s];
                     } /* end check if current measurement has been updated */
                     /* update the variable for the next check */
                 } else {
                     /* check if cc measurement has been updated */
                     if (soc_state.previousTimestamp[s] != soc_tableCurrentSensor.timestampCurrentCounting[s]) {
-                        float_t deltaSoc_perc =
-                            ((float_t)soc_tableCurrentSensor.currentCounter_As[s] / SOC_STRING_CAPACITY_As) * 100.0f;
-
-#if BS_POSITIVE_DISCHARGE_CURRENT == false
-                        deltaSoc_perc *= (-1.0f);
-#endif /* BS_POSITIVE_DISCHARGE_CURRENT == false */
-
-                        pSocValues->averageSoc_perc[s] = soc_state.ccScalingAverage[s] - deltaSoc_perc;
-                        pSocValues->minimumSoc_perc[s] = soc_state.ccScalingMinimum[s] - deltaSoc_perc;
-                        pSocValues->maximumSoc_perc[s] = soc_state.ccScalingMaximum[s] - deltaSoc_perc;
+                        SOC_ApplyCurrentCounter(pSocValues, soc_tableCurrentSensor.currentCounter_As[s], s);
 
                         /* Limit SOC values to [0.0, 100.0] */
                         SOC_CheckDatabaseSocPercentageLimits(pSocValues, s);
@@ -381,12 +497,21 @@ extern float_t SE_GetStateOfChargeFromVoltage(int16_t voltage_mV) {
     /* Interpolate between LUT values, but do not extrapolate LUT! */
     if (!(((between_high == 0u) && (between_low == 0u)) ||       /* cell voltage > maximum LUT voltage */
           (between_low >= bc_stateOfChargeLookupTableLength))) { /* cell voltage < minimum LUT voltage */
+#if SE_USE_FIXED_POINT_ARITHMETIC == true
+        soc_perc = MATH_Q16_16ToFloat(MATH_LinearInterpolationQ16_16(
+            MATH_Int32ToQ16_16(bc_stateOfChargeLookupTable[between_low].voltage_mV),
+            MATH_FloatToQ16_16(bc_stateOfChargeLookupTable[between_low].value),
+            MATH_Int32ToQ16_16(bc_stateOfChargeLookupTable[between_high].voltage_mV),
+            MATH_FloatToQ16_16(bc_stateOfChargeLookupTable[between_high].value),
+            MATH_Int32ToQ16_16(voltage_mV)));
+#else
         soc_perc = MATH_LinearInterpolation(
             (float_t)bc_stateOfChargeLookupTable[between_low].voltage_mV,
             bc_stateOfChargeLookupTable[between_low].value,
             (float_t)bc_stateOfChargeLookupTable[between_high].voltage_mV,
             bc_stateOfChargeLookupTable[between_high].value,
             (float_t)voltage_mV);
+#endif /* SE_USE_FIXED_POINT_ARITHMETIC == true */
     } else if ((between_low >= bc_stateOfChargeLookupTableLength)) {
         /* LUT SOE values are in descending order: cell voltage < minimum LUT voltage */
         soc_perc = SOC_MINIMUM_SOC_perc;
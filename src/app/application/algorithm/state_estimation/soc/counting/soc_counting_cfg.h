@@ -61,6 +61,7 @@
 #include "battery_system_cfg.h"
 
 #include <math.h>
+#include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
 
@@ -75,6 +76,13 @@
 /** #SOC_STRING_CAPACITY_mAs in As */
 #define SOC_STRING_CAPACITY_As ((float_t)(SOC_STRING_CAPACITY_mAs / 1000.0f))
 
+/**
+ * #SOC_STRING_CAPACITY_mAh in uAs as integer for the fixed-point arithmetic
+ * (see #SE_USE_FIXED_POINT_ARITHMETIC), must be smaller than 2^47 uAs
+ */
+#define SOC_STRING_CAPACITY_uAs \
+    ((int64_t)BS_NR_OF_PARALLEL_CELLS_PER_CELL_BLOCK * (int64_t)BC_CAPACITY_mAh * 3600000LL)
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
@@ -0,0 +1,550 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    soc_ekf.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup APPLICATION
+ * @prefix  SOC
+ *
+ * @brief   SOC module estimating the SOC with an extended Kalman filter
+ * @details The cell is modeled as 1RC equivalent circuit with the state
+ *          vector x = [SOC, RC voltage]. The SOC is predicted by integrating
+ *          the string current and corrected with the measured cell voltage.
+ *          All filters use fixed-size 2x2 matrices that are statically
+ *          allocated.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "general.h"
+
+#include "soc_ekf.h"
+#include "soc_ekf_cfg.h"
+
+#include "database.h"
+#include "foxmath.h"
+#include "fram.h"
+#include "state_estimation.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** Maximum SOC in percentage */
+#define SOC_MAXIMUM_SOC_perc (100.0f)
+/** Minimum SOC in percentage */
+#define SOC_MINIMUM_SOC_perc (0.0f)
+
+/** number of states of the filter */
+#define SOC_EKF_NUMBER_OF_STATES (2u)
+/** index of the SOC in the state vector */
+#define SOC_EKF_STATE_SOC (0u)
+/** index of the RC voltage in the state vector */
+#define SOC_EKF_STATE_RC_VOLTAGE (1u)
+
+#if SOC_EKF_ESTIMATE_PER_CELL_BLOCK == true
+/** one filter per cell block */
+#define SOC_EKF_NR_OF_FILTERS_PER_STRING (BS_NR_OF_CELL_BLOCKS_PER_STRING)
+#else
+/** one filter each for the minimum, maximum and average cell voltage */
+#define SOC_EKF_NR_OF_FILTERS_PER_STRING (3u)
+/** filter that is fed with the minimum cell voltage of a string */
+#define SOC_EKF_FILTER_MINIMUM (0u)
+/** filter that is fed with the maximum cell voltage of a string */
+#define SOC_EKF_FILTER_MAXIMUM (1u)
+/** filter that is fed with the average cell voltage of a string */
+#define SOC_EKF_FILTER_AVERAGE (2u)
+#endif
+
+/** state of one extended Kalman filter */
+typedef struct {
+    float_t state[SOC_EKF_NUMBER_OF_STATES];                                /*!< SOC in % and RC voltage in V */
+    float_t covariance[SOC_EKF_NUMBER_OF_STATES][SOC_EKF_NUMBER_OF_STATES]; /*!< error covariance matrix */
+    uint16_t lookupTableIndex; /*!< segment of the OCV lookup table used in the last update */
+} SOC_EKF_FILTER_s;
+
+/**
+ * model quantities of one time step; they only depend on the current and
+ * the time step and are therefore shared by all filters of a string
+ */
+typedef struct {
+    float_t socDecrease_perc;      /*!< decrease of the SOC during the time step */
+    float_t rcDecay;               /*!< decay factor of the RC voltage during the time step */
+    float_t rcInput_V;             /*!< increase of the RC voltage due to the current during the time step */
+    float_t ohmicVoltage_V;        /*!< voltage drop over the ohmic resistance */
+    float_t processNoiseSoc;       /*!< process noise variance of the SOC during the time step */
+    float_t processNoiseRcVoltage; /*!< process noise variance of the RC voltage during the time step */
+} SOC_EKF_STEP_s;
+
+/** This structure contains all the variables relevant for the SOC estimation */
+typedef struct {
+    bool socInitialized;                          /*!< true if the initialization has passed, false otherwise */
+    uint32_t previousTimestamp[BS_NR_OF_STRINGS]; /*!< timestamp of the last processed current measurement */
+    SOC_EKF_FILTER_s filter[BS_NR_OF_STRINGS][SOC_EKF_NR_OF_FILTERS_PER_STRING]; /*!< filter states */
+    uint32_t numberOfFilterUpdates; /*!< number of filter updates since startup */
+} SOC_STATE_s;
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** state variable for SOC module */
+static SOC_STATE_s soc_state = {
+    .socInitialized        = false,
+    .previousTimestamp     = {GEN_REPEAT_U(0u, GEN_STRIP(BS_NR_OF_STRINGS))},
+    .numberOfFilterUpdates = 0u,
+};
+
+/** local copies of database tables */
+/**@{*/
+static DATA_BLOCK_CURRENT_SENSOR_s soc_tableCurrentSensor = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_SENSOR};
+#if SOC_EKF_ESTIMATE_PER_CELL_BLOCK == true
+static DATA_BLOCK_CELL_VOLTAGE_s soc_tableCellVoltage = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+#else
+static DATA_BLOCK_MIN_MAX_s soc_tableMinMax = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+#endif
+/**@}*/
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   limits a SOC value to [0.0, 100.0]
+ * @param[in]   soc_perc    SOC in percentage
+ * @return  limited SOC in percentage
+ */
+static float_t SOC_LimitSoc(float_t soc_perc);
+
+/**
+ * @brief   initializes a filter with a SOC value
+ * @param[out]  pFilter     filter to be initialized
+ * @param[in]   soc_perc    initial SOC in percentage
+ */
+static void SOC_InitializeFilter(SOC_EKF_FILTER_s *pFilter, float_t soc_perc);
+
+/**
+ * @brief   calculates the open-circuit voltage and its slope from the SOC
+ *          lookup table
+ * @details The search starts at the segment that has been used in the last
+ *          call, as the SOC only changes slowly. Outside of the lookup table
+ *          the first respectively last segment is extrapolated.
+ * @param[in]       soc_perc            SOC in percentage
+ * @param[in,out]   pIndex              segment of the lookup table
+ * @param[out]      pSlope_VPerPerc     slope of the open-circuit voltage in V/%
+ * @return  open-circuit voltage in V
+ */
+static float_t SOC_GetOpenCircuitVoltage_V(float_t soc_perc, uint16_t *pIndex, float_t *pSlope_VPerPerc);
+
+/**
+ * @brief   calculates the model quantities of a time step
+ * @param[out]  pStep           model quantities of the time step
+ * @param[in]   current_mA      string current in mA
+ * @param[in]   timeStep_s      time step in s
+ */
+static void SOC_PrepareStep(SOC_EKF_STEP_s *pStep, int32_t current_mA, float_t timeStep_s);
+
+/**
+ * @brief   runs prediction and correction of one filter
+ * @details Without a valid cell voltage only the prediction is run, i.e.,
+ *          the SOC is coulomb counted.
+ * @param[in,out]   pFilter         filter to be updated
+ * @param[in]       pStep           model quantities of the time step
+ * @param[in]       cellVoltage_mV  measured cell voltage in mV
+ * @param[in]       isVoltageValid  true if the cell voltage can be used for the correction
+ */
+static void SOC_UpdateFilter(
+    SOC_EKF_FILTER_s *pFilter,
+    const SOC_EKF_STEP_s *pStep,
+    int16_t cellVoltage_mV,
+    bool isVoltageValid);
+
+/**
+ * @brief   corrects the predicted state of one filter with a cell voltage
+ * @param[in,out]   pFilter         filter to be corrected
+ * @param[in]       pStep           model quantities of the time step
+ * @param[in]       cellVoltage_mV  measured cell voltage in mV
+ */
+static void SOC_CorrectFilter(SOC_EKF_FILTER_s *pFilter, const SOC_EKF_STEP_s *pStep, int16_t cellVoltage_mV);
+
+#if SOC_EKF_ESTIMATE_PER_CELL_BLOCK == true
+/**
+ * @brief   checks if the voltage of one cell block is valid
+ * @param[in]   stringNumber        addressed string
+ * @param[in]   moduleNumber        addressed module
+ * @param[in]   cellBlockNumber     addressed cell block in the module
+ * @return  true if the cell voltage is valid, false otherwise
+ */
+static bool SOC_IsCellVoltageValid(uint8_t stringNumber, uint8_t moduleNumber, uint16_t cellBlockNumber);
+#else
+/**
+ * @brief   checks if the minimum, maximum and average cell voltage of a string are valid
+ * @details The values are calculated from the valid cell voltages only, therefore
+ *          they are valid as long as at least one cell voltage is valid.
+ * @param[in]   stringNumber    addressed string
+ * @return  true if the minimum, maximum and average cell voltage are valid, false otherwise
+ */
+static bool SOC_AreMinMaxCellVoltagesValid(uint8_t stringNumber);
+#endif
+
+/**
+ * @brief   updates all filters of a string and sets the SOC values
+ * @param[out]  pTableSoc       pointer to SOC database entry
+ * @param[in]   pStep           model quantities of the time step
+ * @param[in]   stringNumber    addressed string
+ */
+static void SOC_UpdateString(DATA_BLOCK_SOC_s *pTableSoc, const SOC_EKF_STEP_s *pStep, uint8_t stringNumber);
+
+/**
+ * @brief   Set SOC-related values in non-volatile memory
+ * @param[in] pTableSoc      pointer to database struct with SOC values
+ * @param[in] stringNumber   addressed string
+ */
+static void SOC_UpdateNvmValues(DATA_BLOCK_SOC_s *pTableSoc, uint8_t stringNumber);
+
+/*========== Static Function Implementations ================================*/
+static float_t SOC_LimitSoc(float_t soc_perc) {
+    float_t limitedSoc_perc = soc_perc;
+    if (soc_perc > SOC_MAXIMUM_SOC_perc) {
+        limitedSoc_perc = SOC_MAXIMUM_SOC_perc;
+    }
+    if (soc_perc < SOC_MINIMUM_SOC_perc) {
+        limitedSoc_perc = SOC_MINIMUM_SOC_perc;
+    }
+    return limitedSoc_perc;
+}
+
+static void SOC_InitializeFilter(SOC_EKF_FILTER_s *pFilter, float_t soc_perc) {
+    FAS_ASSERT(pFilter != NULL_PTR);
+    const uint8_t soc = SOC_EKF_STATE_SOC;
+    const uint8_t rc  = SOC_EKF_STATE_RC_VOLTAGE;
+
+    pFilter->state[soc]           = SOC_LimitSoc(soc_perc);
+    pFilter->state[rc]            = 0.0f;
+    pFilter->covariance[soc][soc] = SOC_EKF_INITIAL_COVARIANCE_SOC;
+    pFilter->covariance[soc][rc]  = 0.0f;
+    pFilter->covariance[rc][soc]  = 0.0f;
+    pFilter->covariance[rc][rc]   = SOC_EKF_INITIAL_COVARIANCE_RC_VOLTAGE;
+    pFilter->lookupTableIndex     = 0u;
+}
+
+static float_t SOC_GetOpenCircuitVoltage_V(float_t soc_perc, uint16_t *pIndex, float_t *pSlope_VPerPerc) {
+    FAS_ASSERT(pIndex != NULL_PTR);
+    FAS_ASSERT(pSlope_VPerPerc != NULL_PTR);
+    FAS_ASSERT(bc_stateOfChargeLookupTableLength >= 2u);
+    /* segment i is enclosed by the entries i and i + 1; LUT values are in descending order */
+    const uint16_t lastSegment = bc_stateOfChargeLookupTableLength - 2u;
+    uint16_t i                 = *pIndex;
+    if (i > lastSegment) {
+        i = lastSegment;
+    }
+    while ((i > 0u) && (soc_perc > bc_stateOfChargeLookupTable[i].value)) {
+        i--;
+    }
+    while ((i < lastSegment) && (soc_perc < bc_stateOfChargeLookupTable[i + 1u].value)) {
+        i++;
+    }
+    *pIndex = i;
+
+    const float_t upperVoltage_V     = (float_t)bc_stateOfChargeLookupTable[i].voltage_mV / 1000.0f;
+    const float_t lowerVoltage_V     = (float_t)bc_stateOfChargeLookupTable[i + 1u].voltage_mV / 1000.0f;
+    const float_t socDifference_perc = bc_stateOfChargeLookupTable[i].value - bc_stateOfChargeLookupTable[i + 1u].value;
+    FAS_ASSERT(socDifference_perc > 0.0f);
+
+    *pSlope_VPerPerc = (upperVoltage_V - lowerVoltage_V) / socDifference_perc;
+    return lowerVoltage_V + ((*pSlope_VPerPerc) * (soc_perc - bc_stateOfChargeLookupTable[i + 1u].value));
+}
+
+static void SOC_PrepareStep(SOC_EKF_STEP_s *pStep, int32_t current_mA, float_t timeStep_s) {
+    FAS_ASSERT(pStep != NULL_PTR);
+    FAS_ASSERT(timeStep_s > 0.0f);
+    /* the model uses positive currents in discharge direction */
+    float_t current_A = (float_t)current_mA / UNIT_CONVERSION_FACTOR_1000_FLOAT;
+#if BS_POSITIVE_DISCHARGE_CURRENT == false
+    current_A *= (-1.0f);
+#endif /* BS_POSITIVE_DISCHARGE_CURRENT == false */
+
+    pStep->socDecrease_perc      = UNIT_CONVERSION_FACTOR_100_FLOAT * current_A * timeStep_s /
+                              SOC_EKF_CELL_BLOCK_CAPACITY_As;
+    pStep->rcDecay               = expf(-timeStep_s / SOC_EKF_RC_TIME_CONSTANT_s);
+    pStep->rcInput_V             = SOC_EKF_RC_RESISTANCE_ohm * (1.0f - pStep->rcDecay) * current_A;
+    pStep->ohmicVoltage_V        = SOC_EKF_OHMIC_RESISTANCE_ohm * current_A;
+    pStep->processNoiseSoc       = SOC_EKF_PROCESS_NOISE_SOC_PER_s * timeStep_s;
+    pStep->processNoiseRcVoltage = SOC_EKF_PROCESS_NOISE_RC_VOLTAGE_PER_s * timeStep_s;
+}
+
+static void SOC_UpdateFilter(
+    SOC_EKF_FILTER_s *pFilter,
+    const SOC_EKF_STEP_s *pStep,
+    int16_t cellVoltage_mV,
+    bool isVoltageValid) {
+    FAS_ASSERT(pFilter != NULL_PTR);
+    FAS_ASSERT(pStep != NULL_PTR);
+    float_t *pX             = pFilter->state;
+    float_t(*pP)[SOC_EKF_NUMBER_OF_STATES] = pFilter->covariance;
+    const uint8_t soc = SOC_EKF_STATE_SOC;
+    const uint8_t rc  = SOC_EKF_STATE_RC_VOLTAGE;
+
+    /* prediction: x = f(x, i), P = F * P * F' + Q with F = [1, 0; 0, rcDecay] */
+    pX[soc]      = pX[soc] - pStep->socDecrease_perc;
+    pX[rc]       = (pStep->rcDecay * pX[rc]) + pStep->rcInput_V;
+    pP[soc][soc] = pP[soc][soc] + pStep->processNoiseSoc;
+    pP[soc][rc]  = pStep->rcDecay * pP[soc][rc];
+    pP[rc][soc]  = pP[soc][rc];
+    pP[rc][rc]   = (pStep->rcDecay * pStep->rcDecay * pP[rc][rc]) + pStep->processNoiseRcVoltage;
+    soc_state.numberOfFilterUpdates++;
+
+    if (isVoltageValid == true) {
+        SOC_CorrectFilter(pFilter, pStep, cellVoltage_mV);
+    } else {
+        pX[soc] = SOC_LimitSoc(pX[soc]);
+    }
+}
+
+static void SOC_CorrectFilter(SOC_EKF_FILTER_s *pFilter, const SOC_EKF_STEP_s *pStep, int16_t cellVoltage_mV) {
+    FAS_ASSERT(pFilter != NULL_PTR);
+    FAS_ASSERT(pStep != NULL_PTR);
+    float_t *pX             = pFilter->state;
+    float_t(*pP)[SOC_EKF_NUMBER_OF_STATES] = pFilter->covariance;
+    const uint8_t soc = SOC_EKF_STATE_SOC;
+    const uint8_t rc  = SOC_EKF_STATE_RC_VOLTAGE;
+
+    /* correction: y = OCV(SOC) - u_RC - R0 * i with H = [dOCV/dSOC, -1] */
+    float_t slope_VPerPerc = 0.0f;
+    const float_t ocv_V    = SOC_GetOpenCircuitVoltage_V(pX[soc], &pFilter->lookupTableIndex, &slope_VPerPerc);
+    const float_t innovation_V =
+        ((float_t)cellVoltage_mV / UNIT_CONVERSION_FACTOR_1000_FLOAT) - (ocv_V - pX[rc] - pStep->ohmicVoltage_V);
+
+    /* P * H' */
+    const float_t pHt0 = (pP[soc][soc] * slope_VPerPerc) - pP[soc][rc];
+    const float_t pHt1 = (pP[rc][soc] * slope_VPerPerc) - pP[rc][rc];
+    /* S = H * P * H' + R, always positive as P is positive semi-definite */
+    const float_t innovationCovariance = (slope_VPerPerc * pHt0) - pHt1 + SOC_EKF_MEASUREMENT_NOISE_V2;
+    const float_t gain0                = pHt0 / innovationCovariance;
+    const float_t gain1                = pHt1 / innovationCovariance;
+
+    pX[soc] = SOC_LimitSoc(pX[soc] + (gain0 * innovation_V));
+    pX[rc]  = pX[rc] + (gain1 * innovation_V);
+
+    /* P = P - K * S * K' = P - (P * H') * (P * H')' / S */
+    pP[soc][soc] = pP[soc][soc] - (gain0 * pHt0);
+    pP[soc][rc]  = pP[soc][rc] - (gain0 * pHt1);
+    pP[rc][soc]  = pP[soc][rc];
+    pP[rc][rc]   = pP[rc][rc] - (gain1 * pHt1);
+}
+
+#if SOC_EKF_ESTIMATE_PER_CELL_BLOCK == true
+static bool SOC_IsCellVoltageValid(uint8_t stringNumber, uint8_t moduleNumber, uint16_t cellBlockNumber) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    FAS_ASSERT(moduleNumber < BS_NR_OF_MODULES_PER_STRING);
+    FAS_ASSERT(cellBlockNumber < BS_NR_OF_CELL_BLOCKS_PER_MODULE);
+    const uint64_t cellBit = (uint64_t)1u << cellBlockNumber;
+    return (soc_tableCellVoltage.invalidCellVoltage[stringNumber][moduleNumber] & cellBit) == 0u;
+}
+#else
+static bool SOC_AreMinMaxCellVoltagesValid(uint8_t stringNumber) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    return soc_tableMinMax.validMeasuredCellVoltages[stringNumber] > 0u;
+}
+#endif
+
+static void SOC_UpdateString(DATA_BLOCK_SOC_s *pTableSoc, const SOC_EKF_STEP_s *pStep, uint8_t stringNumber) {
+    FAS_ASSERT(pTableSoc != NULL_PTR);
+    FAS_ASSERT(pStep != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    SOC_EKF_FILTER_s *pFilter = soc_state.filter[stringNumber];
+    /* open-wire or implausible cells must not be fused into the estimate, their filters are only coulomb counted */
+#if SOC_EKF_ESTIMATE_PER_CELL_BLOCK == true
+    float_t minimumSoc_perc = SOC_MAXIMUM_SOC_perc;
+    float_t maximumSoc_perc = SOC_MINIMUM_SOC_perc;
+    float_t sumSoc_perc     = 0.0f;
+    for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+        for (uint16_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+            const uint16_t c          = (m * BS_NR_OF_CELL_BLOCKS_PER_MODULE) + cb;
+            const bool isVoltageValid = SOC_IsCellVoltageValid(stringNumber, m, cb);
+            SOC_UpdateFilter(
+                &pFilter[c], pStep, soc_tableCellVoltage.cellVoltage_mV[stringNumber][m][cb], isVoltageValid);
+            const float_t soc_perc = pFilter[c].state[SOC_EKF_STATE_SOC];
+            minimumSoc_perc        = MATH_MinimumOfTwoFloats(minimumSoc_perc, soc_perc);
+            if (soc_perc > maximumSoc_perc) {
+                maximumSoc_perc = soc_perc;
+            }
+            sumSoc_perc += soc_perc;
+        }
+    }
+    pTableSoc->minimumSoc_perc[stringNumber] = minimumSoc_perc;
+    pTableSoc->maximumSoc_perc[stringNumber] = maximumSoc_perc;
+    pTableSoc->averageSoc_perc[stringNumber] = sumSoc_perc / (float_t)BS_NR_OF_CELL_BLOCKS_PER_STRING;
+#else
+    const bool isVoltageValid = SOC_AreMinMaxCellVoltagesValid(stringNumber);
+    SOC_UpdateFilter(
+        &pFilter[SOC_EKF_FILTER_MINIMUM], pStep, soc_tableMinMax.minimumCellVoltage_mV[stringNumber], isVoltageValid);
+    SOC_UpdateFilter(
+        &pFilter[SOC_EKF_FILTER_MAXIMUM], pStep, soc_tableMinMax.maximumCellVoltage_mV[stringNumber], isVoltageValid);
+    SOC_UpdateFilter(
+        &pFilter[SOC_EKF_FILTER_AVERAGE], pStep, soc_tableMinMax.averageCellVoltage_mV[stringNumber], isVoltageValid);
+    pTableSoc->minimumSoc_perc[stringNumber] = pFilter[SOC_EKF_FILTER_MINIMUM].state[SOC_EKF_STATE_SOC];
+    pTableSoc->maximumSoc_perc[stringNumber] = pFilter[SOC_EKF_FILTER_MAXIMUM].state[SOC_EKF_STATE_SOC];
+    pTableSoc->averageSoc_perc[stringNumber] = pFilter[SOC_EKF_FILTER_AVERAGE].state[SOC_EKF_STATE_SOC];
+#endif
+}
+
+static void SOC_UpdateNvmValues(DATA_BLOCK_SOC_s *pTableSoc, uint8_t stringNumber) {
+    FAS_ASSERT(pTableSoc != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    fram_soc.averageSoc_perc[stringNumber] = pTableSoc->averageSoc_perc[stringNumber];
+    fram_soc.minimumSoc_perc[stringNumber] = pTableSoc->minimumSoc_perc[stringNumber];
+    fram_soc.maximumSoc_perc[stringNumber] = pTableSoc->maximumSoc_perc[stringNumber];
+}
+
+/*========== Extern Function Implementations ================================*/
+void SE_InitializeStateOfCharge(DATA_BLOCK_SOC_s *pSocValues, bool ccPresent, uint8_t stringNumber) {
+    FAS_ASSERT(pSocValues != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    /* the filter integrates the current measurements itself, the coulomb counter of the sensor is not needed */
+    (void)ccPresent;
+    DATA_READ_DATA(&soc_tableCurrentSensor);
+
+    FRAM_ReadData(FRAM_BLOCK_ID_SOC);
+
+    pSocValues->averageSoc_perc[stringNumber] = SOC_LimitSoc(fram_soc.averageSoc_perc[stringNumber]);
+    pSocValues->minimumSoc_perc[stringNumber] = SOC_LimitSoc(fram_soc.minimumSoc_perc[stringNumber]);
+    pSocValues->maximumSoc_perc[stringNumber] = SOC_LimitSoc(fram_soc.maximumSoc_perc[stringNumber]);
+
+    SOC_EKF_FILTER_s *pFilter = soc_state.filter[stringNumber];
+#if SOC_EKF_ESTIMATE_PER_CELL_BLOCK == true
+    for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+        SOC_InitializeFilter(&pFilter[c], pSocValues->averageSoc_perc[stringNumber]);
+    }
+#else
+    SOC_InitializeFilter(&pFilter[SOC_EKF_FILTER_MINIMUM], pSocValues->minimumSoc_perc[stringNumber]);
+    SOC_InitializeFilter(&pFilter[SOC_EKF_FILTER_MAXIMUM], pSocValues->maximumSoc_perc[stringNumber]);
+    SOC_InitializeFilter(&pFilter[SOC_EKF_FILTER_AVERAGE], pSocValues->averageSoc_perc[stringNumber]);
+#endif
+
+    soc_state.previousTimestamp[stringNumber] = soc_tableCurrentSensor.timestampCurrent[stringNumber];
+    soc_state.socInitialized                  = true;
+}
+
+void SE_CalculateStateOfCharge(DATA_BLOCK_SOC_s *pSocValues) {
+    FAS_ASSERT(pSocValues != NULL_PTR);
+    if (soc_state.socInitialized == true) {
+#if SOC_EKF_ESTIMATE_PER_CELL_BLOCK == true
+        DATA_READ_DATA(&soc_tableCurrentSensor, &soc_tableCellVoltage);
+#else
+        DATA_READ_DATA(&soc_tableCurrentSensor, &soc_tableMinMax);
+#endif
+        bool hasUpdated = false;
+        for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+            /* filters are only updated with new and valid current measurements */
+            if ((soc_state.previousTimestamp[s] != soc_tableCurrentSensor.timestampCurrent[s]) &&
+                (soc_tableCurrentSensor.invalidCurrentMeasurement[s] == 0u)) {
+                float_t timeStep_s = (float_t)(soc_tableCurrentSensor.timestampCurrent[s] -
+                                               soc_state.previousTimestamp[s]) /
+                                     UNIT_CONVERSION_FACTOR_1000_FLOAT;
+                timeStep_s = MATH_MinimumOfTwoFloats(timeStep_s, SOC_EKF_MAXIMUM_TIME_STEP_s);
+
+                SOC_EKF_STEP_s step = {0};
+                SOC_PrepareStep(&step, soc_tableCurrentSensor.current_mA[s], timeStep_s);
+                SOC_UpdateString(pSocValues, &step, s);
+                SOC_UpdateNvmValues(pSocValues, s);
+
+                soc_state.previousTimestamp[s] = soc_tableCurrentSensor.timestampCurrent[s];
+                hasUpdated                     = true;
+            }
+        }
+        if (hasUpdated == true) {
+            FRAM_WriteData(FRAM_BLOCK_ID_SOC);
+        }
+    }
+}
+
+extern float_t SE_GetStateOfChargeFromVoltage(int16_t voltage_mV) {
+    float_t soc_perc = 0.50f;
+
+    /* Variables for interpolating LUT value */
+    uint16_t between_high = 0;
+    uint16_t between_low  = 0;
+
+    /* Cell voltages are inserted in LUT in descending order -> start with 1 as we do not want to extrapolate. */
+    for (uint16_t i = 1u; i < bc_stateOfChargeLookupTableLength; i++) {
+        if (voltage_mV < bc_stateOfChargeLookupTable[i].voltage_mV) {
+            between_low  = i + 1u;
+            between_high = i;
+        }
+    }
+
+    /* Interpolate between LUT values, but do not extrapolate LUT! */
+    if (!(((between_high == 0u) && (between_low == 0u)) ||       /* cell voltage > maximum LUT voltage */
+          (between_low >= bc_stateOfChargeLookupTableLength))) { /* cell voltage < minimum LUT voltage */
+        soc_perc = MATH_LinearInterpolation(
+            (float_t)bc_stateOfChargeLookupTable[between_low].voltage_mV,
+            bc_stateOfChargeLookupTable[between_low].value,
+            (float_t)bc_stateOfChargeLookupTable[between_high].voltage_mV,
+            bc_stateOfChargeLookupTable[between_high].value,
+            (float_t)voltage_mV);
+    } else if ((between_low >= bc_stateOfChargeLookupTableLength)) {
+        /* LUT SOC values are in descending order: cell voltage < minimum LUT voltage */
+        soc_perc = SOC_MINIMUM_SOC_perc;
+    } else {
+        /* cell voltage > maximum LUT voltage */
+        soc_perc = SOC_MAXIMUM_SOC_perc;
+    }
+    return soc_perc;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern float_t TEST_SOC_GetOpenCircuitVoltage_V(float_t soc_perc, float_t *pSlope_VPerPerc) {
+    uint16_t index = 0u;
+    return SOC_GetOpenCircuitVoltage_V(soc_perc, &index, pSlope_VPerPerc);
+}
+extern float_t TEST_SOC_GetFilterSoc_perc(uint8_t stringNumber, uint16_t filterNumber) {
+    return soc_state.filter[stringNumber][filterNumber].state[SOC_EKF_STATE_SOC];
+}
+extern float_t TEST_SOC_GetFilterSocVariance(uint8_t stringNumber, uint16_t filterNumber) {
+    return soc_state.filter[stringNumber][filterNumber].covariance[SOC_EKF_STATE_SOC][SOC_EKF_STATE_SOC];
+}
+extern uint32_t TEST_SOC_GetNumberOfFilterUpdates(void) {
+    return soc_state.numberOfFilterUpdates;
+}
+#endif
@@ -0,0 +1,78 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    soc_ekf.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup APPLICATION
+ * @prefix  SOC
+ *
+ * @brief   Header for the extended Kalman filter based SOC estimation
+ *
+ */
+
+#ifndef FOXBMS__SOC_EKF_H_
+#define FOXBMS__SOC_EKF_H_
+
+/*========== Includes =======================================================*/
+#include "soc_ekf_cfg.h"
+
+#include <math.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern float_t TEST_SOC_GetOpenCircuitVoltage_V(float_t soc_perc, float_t *pSlope_VPerPerc);
+extern float_t TEST_SOC_GetFilterSoc_perc(uint8_t stringNumber, uint16_t filterNumber);
+extern float_t TEST_SOC_GetFilterSocVariance(uint8_t stringNumber, uint16_t filterNumber);
+extern uint32_t TEST_SOC_GetNumberOfFilterUpdates(void);
+#endif
+
+#endif /* FOXBMS__SOC_EKF_H_ */
@@ -0,0 +1,127 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    soc_ekf_cfg.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup APPLICATION
+ * @prefix  SOC
+ *
+ * @brief   Header for the configuration of the extended Kalman filter based
+ *          SOC estimation
+ * @details The cell is described by an equivalent circuit with an ohmic
+ *          resistance and one RC element in series with the open-circuit
+ *          voltage. The open-circuit voltage is taken from the SOC lookup
+ *          table of the battery cell configuration.
+ *
+ */
+
+#ifndef FOXBMS__SOC_EKF_CFG_H_
+#define FOXBMS__SOC_EKF_CFG_H_
+
+/*========== Includes =======================================================*/
+
+#include "battery_cell_cfg.h"
+#include "battery_system_cfg.h"
+
+#include <math.h>
+#include <stdbool.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/**
+ * @brief   Selects the granularity of the estimation
+ * @details If set to false, three filters per string are run on the minimum,
+ *          maximum and average cell voltage of the string. If set to true, one
+ *          filter is run per cell block and the minimum, maximum and average
+ *          SOC of the string are derived from the cell block SOCs.
+ */
+#ifndef SOC_EKF_ESTIMATE_PER_CELL_BLOCK
+#define SOC_EKF_ESTIMATE_PER_CELL_BLOCK (false)
+#endif
+
+/** Capacity of a cell block in As */
+#define SOC_EKF_CELL_BLOCK_CAPACITY_As \
+    ((float_t)(BS_NR_OF_PARALLEL_CELLS_PER_CELL_BLOCK * BC_CAPACITY_mAh) * 3.6f)
+
+/** Ohmic resistance of a cell block in ohm */
+#define SOC_EKF_OHMIC_RESISTANCE_ohm (0.030f / (float_t)BS_NR_OF_PARALLEL_CELLS_PER_CELL_BLOCK)
+
+/** Resistance of the RC element of a cell block in ohm */
+#define SOC_EKF_RC_RESISTANCE_ohm (0.015f / (float_t)BS_NR_OF_PARALLEL_CELLS_PER_CELL_BLOCK)
+
+/** Time constant of the RC element in s */
+#define SOC_EKF_RC_TIME_CONSTANT_s (40.0f)
+
+/** Process noise variance of the SOC in %^2 per second */
+#define SOC_EKF_PROCESS_NOISE_SOC_PER_s (1.0e-4f)
+
+/** Process noise variance of the RC voltage in V^2 per second */
+#define SOC_EKF_PROCESS_NOISE_RC_VOLTAGE_PER_s (1.0e-7f)
+
+/** Variance of the cell voltage measurement in V^2 (i.e., 5mV standard deviation) */
+#define SOC_EKF_MEASUREMENT_NOISE_V2 (2.5e-5f)
+
+/** Initial variance of the SOC in %^2 after startup (i.e., 10% standard deviation) */
+#define SOC_EKF_INITIAL_COVARIANCE_SOC (100.0f)
+
+/** Initial variance of the RC voltage in V^2 after startup */
+#define SOC_EKF_INITIAL_COVARIANCE_RC_VOLTAGE (1.0e-4f)
+
+/**
+ * Maximum time step in s that is integrated at once. Larger gaps between two
+ * current measurements (e.g., after a communication loss) are limited to this
+ * value.
+ */
+#define SOC_EKF_MAXIMUM_TIME_STEP_s (10.0f)
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+#endif
+
+#endif /* FOXBMS__SOC_EKF_CFG_H_ */
@@ -79,12 +79,19 @@ typedef struct {
     float_t ecScalingMaximum[BS_NR_OF_STRINGS]; /*!< current sensor offset scaling for maximum SOE */
     uint32_t previousTimestamp
         [BS_NR_OF_STRINGS]; /*!< last used timestamp of current or energy counting value for SOE estimation */
+    /** integrated energy that is smaller than the resolution of the SOE (fixed-point arithmetic only) */
+    int64_t energyRemainder[BS_NR_OF_STRINGS];
 } SOE_STATE_s;
 
 /** defines for maximum and minimum SOE */
 #define MAXIMUM_SOE_PERC (100.0f)
 #define MINIMUM_SOE_PERC (0.0f)
 
+#if SE_USE_FIXED_POINT_ARITHMETIC == true
+/** energy in nJ that corresponds to one LSB of the SOE in Q16.16 percent */
+#define SOE_ENERGY_PER_LSB_nJ ((SOE_STRING_ENERGY_mWh * 3600000000LL) / (100LL * MATH_Q16_16_ONE))
+#endif /* SE_USE_FIXED_POINT_ARITHMETIC == true */
+
 /*========== Static Constant and Variable Definitions =======================*/
 
 /**
@@ -97,6 +104,7 @@ static SOE_STATE_s soe_state = {
     .ecScalingMinimum  = {GEN_REPEAT_U(0.0f, GEN_STRIP(BS_NR_OF_STRINGS))},
     .ecScalingMaximum  = {GEN_REPEAT_U(0.0f, GEN_STRIP(BS_NR_OF_STRINGS))},
     .previousTimestamp = {GEN_REPEAT_U(0u, GEN_STRIP(BS_NR_OF_STRINGS))},
+    .energyRemainder   = {GEN_REPEAT_U(0, GEN_STRIP(BS_NR_OF_STRINGS))},
 };
 
 /** local copies of database tables */
@@ -168,6 +176,34 @@ static void SOE_SetValue(
  */
 static void SOE_CheckDatabaseSoePercentageLimits(DATA_BLOCK_SOE_s *pTableSoe, uint8_t stringNumber);
 
+/**
+ * @brief   Updates the SOE values with the energy that has flowed with the
+ *          passed current and voltage during the passed time step
+ * @details With fixed-point arithmetic, the energy that is smaller than the
+ *          resolution of the SOE is kept for the next time step.
+ *          The SOE values are *NOT* limited to [0.0, 100.0].
+ * @param[in,out] pSoeValues     pointer to SOE database entry
+ * @param[in]     current_mA     string current
+ * @param[in]     voltage_mV     string voltage
+ * @param[in]     timeStep_ms    time step since the previous update
+ * @param[in]     stringNumber   addressed string
+ */
+static void SOE_IntegratePower(
+    DATA_BLOCK_SOE_s *pSoeValues,
+    int32_t current_mA,
+    int32_t voltage_mV,
+    uint32_t timeStep_ms,
+    uint8_t stringNumber);
+
+/**
+ * @brief   Sets the SOE values from the energy counter of the current sensor
+ * @details The SOE values are *NOT* limited to [0.0, 100.0].
+ * @param[out] pSoeValues         pointer to SOE database entry
+ * @param[in]  energyCounter_Wh   energy counter of the current sensor
+ * @param[in]  stringNumber       addressed string
+ */
+static void SOE_ApplyEnergyCounter(DATA_BLOCK_SOE_s *pSoeValues, int32_t energyCounter_Wh, uint8_t stringNumber);
+
 /*========== Static Function Implementations ================================*/
 static float_t SOE_GetStringSoePercentageFromEnergy(uint32_t energy_Wh) {
     float_t stringSoe_perc        = 0.0f;
@@ -226,12 +262,21 @@ static float_t SOE_GetFromVoltage(int16_t voltage_mV) {
     /* Interpolate between LUT values, but do not extrapolate LUT! */
     if (!(((between_high == 0u) && (between_low == 0u)) ||       /* cell voltage > maximum LUT voltage */
           (between_low >= bc_stateOfEnergyLookupTableLength))) { /* cell voltage < minimum LUT voltage */
+#if SE_USE_FIXED_POINT_ARITHMETIC == true
+        soe_perc = MATH_Q16_16ToFloat(MATH_LinearInterpolationQ16_16(
+            MATH_Int32ToQ16_16(bc_stateOfEnergyLookupTable[between_low].voltage_mV),
+            MATH_FloatToQ16_16(bc_stateOfEnergyLookupTable[between_low].value),
+            MATH_Int32ToQ16_16(bc_stateOfEnergyLookupTable[between_high].voltage_mV),
+            MATH_FloatToQ16_16(bc_stateOfEnergyLookupTable[between_high].value),
+            MATH_Int32ToQ16_16(voltage_mV)));
+#else
         soe_perc = MATH_LinearInterpolation(
             (float_t)bc_stateOfEnergyLookupTable[between_low].voltage_mV,
             bc_stateOfEnergyLookupTable[between_low].value,
             (float_t)bc_stateOfEnergyLookupTable[between_high].voltage_mV,
             bc_stateOfEnergyLookupTable[between_high].value,
             (float_t)voltage_mV);
+#endif /* SE_USE_FIXED_POINT_ARITHMETIC == true */
     } else if ((between_low >= bc_stateOfEnergyLookupTableLength)) {
         /* LUT SOE values are in descending order: cell voltage < minimum LUT voltage */
         soe_perc = MINIMUM_SOE_PERC;
@@ -310,6 +355,118 @@ static void SOE_CheckDatabaseSoePercentageLimits(DATA_BLOCK_SOE_s *pTableSoe, ui
     }
 }
 
+#if SE_USE_FIXED_POINT_ARITHMETIC == true
+static void SOE_IntegratePower(
+    DATA_BLOCK_SOE_s *pSoeValues,
+    int32_t current_mA,
+    int32_t voltage_mV,
+    uint32_t timeStep_ms,
+    uint8_t stringNumber) {
+    FAS_ASSERT(pSoeValues != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    /* AXIVION Routine Generic-MissingParameterAssert: current_mA: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: voltage_mV: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: timeStep_ms: parameter accepts whole range */
+
+    /* mA * mV = uW and uW * ms = nJ */
+    const int64_t power_uW = (int64_t)current_mA * (int64_t)voltage_mV;
+    int64_t energy_nJ      = power_uW * (int64_t)timeStep_ms;
+    if ((timeStep_ms > 0u) && (MATH_AbsInt64_t(power_uW) > (INT64_MAX / (int64_t)timeStep_ms))) {
+        /* An energy out of range saturates the SOE anyway */
+        if (power_uW > 0) {
+            energy_nJ = INT64_MAX;
+        } else {
+            energy_nJ = -INT64_MAX;
+        }
+    }
+
+#if BS_POSITIVE_DISCHARGE_CURRENT == false
+    energy_nJ *= -1;
+#endif /* BS_POSITIVE_DISCHARGE_CURRENT == false */
+
+    /* Current in charge direction negative means SOE increasing --> BAT naming, not ROB */
+    const MATH_Q16_16 deltaSoe_perc =
+        MATH_AccumulateQ16_16(&soe_state.energyRemainder[stringNumber], energy_nJ, SOE_ENERGY_PER_LSB_nJ);
+
+    pSoeValues->averageSoe_perc[stringNumber] = MATH_Q16_16ToFloat(
+        MATH_SubtractQ16_16(MATH_FloatToQ16_16(pSoeValues->averageSoe_perc[stringNumber]), deltaSoe_perc));
+    pSoeValues->minimumSoe_perc[stringNumber] = MATH_Q16_16ToFloat(
+        MATH_SubtractQ16_16(MATH_FloatToQ16_16(pSoeValues->minimumSoe_perc[stringNumber]), deltaSoe_perc));
+    pSoeValues->maximumSoe_perc[stringNumber] = MATH_Q16_16ToFloat(
+        MATH_SubtractQ16_16(MATH_FloatToQ16_16(pSoeValues->maximumSoe_perc[stringNumber]), deltaSoe_perc));
+}
+
+static void SOE_ApplyEnergyCounter(DATA_BLOCK_SOE_s *pSoeValues, int32_t energyCounter_Wh, uint8_t stringNumber) {
+    FAS_ASSERT(pSoeValues != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    /* AXIVION Routine Generic-MissingParameterAssert: energyCounter_Wh: parameter accepts whole range */
+
+    /* factor 10^5: conversion Wh -> mWh (1000) and fraction -> percent (100) */
+    MATH_Q16_16 deltaSoe_perc =
+        MATH_DivideInt64ToQ16_16((int64_t)energyCounter_Wh * 100000LL, SOE_STRING_ENERGY_mWh);
+
+#if BS_POSITIVE_DISCHARGE_CURRENT == false
+    deltaSoe_perc = MATH_SubtractQ16_16(0, deltaSoe_perc);
+#endif /* BS_POSITIVE_DISCHARGE_CURRENT == false */
+
+    /* Apply EC scaling offset to get actual string energy */
+    pSoeValues->averageSoe_perc[stringNumber] = MATH_Q16_16ToFloat(
+        MATH_SubtractQ16_16(MATH_FloatToQ16_16(soe_state.ecScalingAverage[stringNumber]), deltaSoe_perc));
+    pSoeValues->minimumSoe_perc[stringNumber] = MATH_Q16_16ToFloat(
+        MATH_SubtractQ16_16(MATH_FloatToQ16_16(soe_state.ecScalingMinimum[stringNumber]), deltaSoe_perc));
+    pSoeValues->maximumSoe_perc[stringNumber] = MATH_Q16_16ToFloat(
+        MATH_SubtractQ16_16(MATH_FloatToQ16_16(soe_state.ecScalingMaximum[stringNumber]), deltaSoe_perc));
+}
+#else
+static void SOE_IntegratePower(
+    DATA_BLOCK_SOE_s *pSoeValues,
+    int32_t current_mA,
+    int32_t voltage_mV,
+    uint32_t timeStep_ms,
+    uint8_t stringNumber) {
+    FAS_ASSERT(pSoeValues != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    /* AXIVION Routine Generic-MissingParameterAssert: current_mA: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: voltage_mV: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: timeStep_ms: parameter accepts whole range */
+
+    const float_t energy_Ws = ((float_t)current_mA / UNIT_CONVERSION_FACTOR_1000_FLOAT) * /* convert to A */
+                              ((float_t)voltage_mV / UNIT_CONVERSION_FACTOR_1000_FLOAT) * /* convert to V */
+                              ((float_t)timeStep_ms / UNIT_CONVERSION_FACTOR_1000_FLOAT); /* convert to s */
+
+    /* Current in charge direction negative means SOE increasing --> BAT naming, not ROB */
+    float_t deltaSoe_perc = (energy_Ws / (SOE_STRING_ENERGY_Wh * 3600.0f)) * UNIT_CONVERSION_FACTOR_100_FLOAT;
+
+#if BS_POSITIVE_DISCHARGE_CURRENT == false
+    /* negate calculated delta SOE_perc */
+    deltaSoe_perc *= (-1.0f);
+#endif /* BS_POSITIVE_DISCHARGE_CURRENT == false */
+
+    pSoeValues->averageSoe_perc[stringNumber] = pSoeValues->averageSoe_perc[stringNumber] - deltaSoe_perc;
+    pSoeValues->minimumSoe_perc[stringNumber] = pSoeValues->minimumSoe_perc[stringNumber] - deltaSoe_perc;
+    pSoeValues->maximumSoe_perc[stringNumber] = pSoeValues->maximumSoe_perc[stringNumber] - deltaSoe_perc;
+}
+
+static void SOE_ApplyEnergyCounter(DATA_BLOCK_SOE_s *pSoeValues, int32_t energyCounter_Wh, uint8_t stringNumber) {
+    FAS_ASSERT(pSoeValues != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    /* AXIVION Routine Generic-MissingParameterAssert: energyCounter_Wh: parameter accepts whole range */
+
+    float_t deltaSoe_perc =
+        (((float_t)energyCounter_Wh / SOE_STRING_ENERGY_Wh) * UNIT_CONVERSION_FACTOR_100_FLOAT);
+
+#if BS_POSITIVE_DISCHARGE_CURRENT == false
+    /* negate calculated delta SOE_perc */
+    deltaSoe_perc *= (-1.0f);
+#endif /* BS_POSITIVE_DISCHARGE_CURRENT == false */
+
+    /* Apply EC scaling offset to get actual string energy */
+    pSoeValues->averageSoe_perc[stringNumber] = soe_state.ecScalingAverage[stringNumber] - deltaSoe_perc;
+    pSoeValues->minimumSoe_perc[stringNumber] = soe_state.ecScalingMinimum[stringNumber] - deltaSoe_perc;
+    pSoeValues->maximumSoe_perc[stringNumber] = soe_state.ecScalingMaximum[stringNumber] - deltaSoe_perc;
+}
+#endif /* SE_USE_FIXED_POINT_ARITHMETIC == true */
+
 /*========== Extern Function Implementations ================================*/
 
 extern void SE_InitializeStateOfEnergy(DATA_BLOCK_SOE_s *pSoeValues, bool ec_present, uint8_t stringNumber) {
@@ -332,8 +489,8 @@ extern void SE_InitializeStateOfEnergy(DATA_BLOCK_SOE_s *pSoeValues, bool ec_pre
     pSoeValues->averageSoe_Wh[stringNumber] =
         SOE_GetStringEnergyFromSoePercentage(pSoeValues->averageSoe_perc[stringNumber]);
 
+    DATA_READ_DATA(&soe_tableCurrentSensor);
     if (ec_present == true) {
-        DATA_READ_DATA(&soe_tableCurrentSensor);
         soe_state.sensorEcUsed[stringNumber] = true;
 
         /* Set scaling values */
@@ -352,6 +509,10 @@ extern void SE_InitializeStateOfEnergy(DATA_BLOCK_SOE_s *pSoeValues, bool ec_pre
         soe_state.ecScalingMinimum[stringNumber] = fram_soe.minimumSoe_perc[stringNumber] + ecOffset;
         soe_state.ecScalingMaximum[stringNumber] = fram_soe.maximumSoe_perc[stringNumber] + ecOffset;
         soe_state.ecScalingAverage[stringNumber] = fram_soe.averageSoe_perc[stringNumber] + ecOffset;
+    } else {
+        soe_state.previousTimestamp[stringNumber] = soe_tableCurrentSensor.timestampCurrent[stringNumber];
+        soe_state.sensorEcUsed[stringNumber]      = false;
+        soe_state.energyRemainder[stringNumber]   = 0;
     }
     soe_state.soeInitialized = true;
 }
@@ -375,56 +536,38 @@ void SE_CalculateStateOfEnergy(DATA_BLOCK_SOE_s *pSoeValues) {
             for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
                 if (soe_state.sensorEcUsed[s] == false) {
                     /* no energy counting activated -> manually integrate energy */
-                    uint32_t timestamp          = soe_tableCurrentSensor.timestampCurrent[s];
-                    uint32_t previous_timestamp = soe_tableCurrentSensor.previousTimestampCurrent[s];
-
                     /* check if current measurement has been updated */
-                    if (soe_state.previousTimestamp[s] != timestamp) {
-                        float_t timestep_s = (((float_t)timestamp - (float_t)previous_timestamp)) / 1000.0f;
-                        if (timestep_s > 0.0f) {
-                            /* Current in charge direction negative means SOE increasing --> BAT naming, not ROB */
-                            float_t deltaSOE_Wh =
-                                ((((float_t)soe_tableCurrentSensor.current_mA[s] / 1000.0f) *         /* convert to A */
-                                  ((float_t)soe_tableCurrentSensor.highVoltage_mV[s][0] / 1000.0f)) / /* convert to V */
-                                 timestep_s) /                                                        /* unit: s */
-                                3600.0f; /* convert Ws -> Wh */
-
-#if BS_POSITIVE_DISCHARGE_CURRENT == false
-                            /* negate calculated delta SOE_Wh */
-                            deltaSOE_Wh *= (-1.0f);
-#endif /* BS_POSITIVE_DISCHARGE_CURRENT == false */
+                    if (soe_state.previousTimestamp[s] != soe_tableCurrentSensor.timestampCurrent[s]) {
+                        /* the unsigned difference is also valid if the timestamp has overflowed */
+                        const uint32_t timeStep_ms =
+                            soe_tableCurrentSensor.timestampCurrent[s] - soe_state.previousTimestamp[s];
+
+                        SOE_IntegratePower(
+                            pSoeValues,
+                            soe_tableCurrentSensor.current_mA[s],
+                            soe_tableCurrentSensor.highVoltage_mV[s][0],
+                            timeStep_ms,
+                            s);
 
-                            pSoeValues->averageSoe_Wh[s] -= (uint32_t)deltaSOE_Wh;
-                            pSoeValues->minimumSoe_Wh[s] -= (uint32_t)deltaSOE_Wh;
-                            pSoeValues->maximumSoe_Wh[s] -= (uint32_t)deltaSOE_Wh;
+                        /* Limit SOE values to [0.0, 100.0] */
+                        SOE_CheckDatabaseSoePercentageLimits(pSoeValues, s);
 
-                            pSoeValues->averageSoe_perc[s] =
-                                SOE_GetStringSoePercentageFromEnergy(pSoeValues->averageSoe_Wh[s]);
-                            pSoeValues->minimumSoe_perc[s] =
-                                SOE_GetStringSoePercentageFromEnergy(pSoeValues->minimumSoe_Wh[s]);
-                            pSoeValues->maximumSoe_perc[s] =
-                                SOE_GetStringSoePercentageFromEnergy(pSoeValues->maximumSoe_Wh[s]);
+                        /* Calculate new Wh values */
+                        pSoeValues->maximumSoe_Wh[s] =
+                            SOE_GetStringEnergyFromSoePercentage(pSoeValues->maximumSoe_perc[s]);
+                        pSoeValues->averageSoe_Wh[s] =
+                            SOE_GetStringEnergyFromSoePercentage(pSoeValues->averageSoe_perc[s]);
+                        pSoeValues->minimumSoe_Wh[s] =
+                            SOE_GetStringEnergyFromSoePercentage(pSoeValues->minimumSoe_perc[s]);
 
-                            /* update timestamp SOE state variable for next iteration */
-                            soe_state.previousTimestamp[s] = timestamp;
-                        }
+                        /* update timestamp SOE state variable for next iteration */
+                        soe_state.previousTimestamp[s] = soe_tableCurrentSensor.timestampCurrent[s];
                     } /* end check if current measurement has been updated */
                 } else {
                     /* check if ec measurement has been updated */
                     if (soe_state.previousTimestamp[s] != soe_tableCurrentSensor.timestampEnergyCounting[s]) {
                         /* Calculate SOE value with current sensor EC value */
-                        float_t deltaSoe_perc =
-                            (((float_t)soe_tableCurrentSensor.energyCounter_Wh[s] / SOE_STRING_ENERGY_Wh) *
-                             UNIT_CONVERSION_FACTOR_100_FLOAT);
-
-#if BS_POSITIVE_DISCHARGE_CURRENT == false
-                        /* negate calculated delta SOE_perc */
-                        deltaSoe_perc *= (-1.0f);
-#endif
-                        /* Apply EC scaling offset to get actual string energy */
-                        pSoeValues->averageSoe_perc[s] = soe_state.ecScalingAverage[s] - deltaSoe_perc;
-                        pSoeValues->minimumSoe_perc[s] = soe_state.ecScalingMinimum[s] - deltaSoe_perc;
-                        pSoeValues->maximumSoe_perc[s] = soe_state.ecScalingMaximum[s] - deltaSoe_perc;
+                        SOE_ApplyEnergyCounter(pSoeValues, soe_tableCurrentSensor.energyCounter_Wh[s], s);
 
                         /* Limit SOE values to [0.0, 100.0] */
                         SOE_CheckDatabaseSoePercentageLimits(pSoeValues, s);
@@ -74,6 +74,9 @@
 #define SOE_STRING_ENERGY_Wh \
     (BC_ENERGY_Wh * (float_t)(BS_NR_OF_CELL_BLOCKS_PER_STRING * BS_NR_OF_PARALLEL_CELLS_PER_CELL_BLOCK))
 
+/** #SOE_STRING_ENERGY_Wh in mWh as integer for the fixed-point arithmetic (see #SE_USE_FIXED_POINT_ARITHMETIC) */
+#define SOE_STRING_ENERGY_mWh ((int64_t)(SOE_STRING_ENERGY_Wh * 1000.0f))
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
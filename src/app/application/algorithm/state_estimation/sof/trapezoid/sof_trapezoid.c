@@ -139,6 +139,26 @@ static SOF_CURRENT_LIMITS_s SOF_MinimumOfTwoSofValues(
     SOF_CURRENT_LIMITS_s voltageBasedLimits,
     SOF_CURRENT_LIMITS_s temperatureBasedLimits);
 
+#if SE_USE_FIXED_POINT_ARITHMETIC == true
+/**
+ * @brief   interpolates the current limit on a derating ramp in fixed-point
+ *          arithmetic
+ * @details The current is interpolated in A in the format Q16.16.
+ * @param[in]  x1              voltage or temperature where the ramp starts
+ * @param[in]  y1_mA           current limit at x1
+ * @param[in]  x2              voltage or temperature where the ramp ends
+ * @param[in]  y2_mA           current limit at x2
+ * @param[in]  x_interpolate   voltage or temperature on the ramp
+ * @return  interpolated current limit in mA
+ */
+static float_t SOF_InterpolateCurrentLimit(
+    int16_t x1,
+    float_t y1_mA,
+    int16_t x2,
+    float_t y2_mA,
+    int16_t x_interpolate);
+#endif /* SE_USE_FIXED_POINT_ARITHMETIC == true */
+
 /*========== Static Function Implementations ================================*/
 static void SOF_CalculateCurves(const SOF_CONFIG_s *pConfigurationValues, SOF_CURVE_s *pCalculatedSofCurveValues) {
     FAS_ASSERT(pConfigurationValues != NULL_PTR);
@@ -206,9 +226,18 @@ static void SOF_CalculateVoltageBasedCurrentLimit(
         pAllowedVoltageBasedCurrent->peakDischargeCurrent_mA       = 0.0f;
     } else {
         if (minimumCellVoltage_mV <= pConfigLimitValues->cutoffLowerCellVoltage_mV) {
+#if SE_USE_FIXED_POINT_ARITHMETIC == true
+            pAllowedVoltageBasedCurrent->continuousDischargeCurrent_mA = SOF_InterpolateCurrentLimit(
+                pConfigLimitValues->limitLowerCellVoltage_mV,
+                0.0f,
+                pConfigLimitValues->cutoffLowerCellVoltage_mV,
+                pConfigLimitValues->maximumDischargeCurrent_mA,
+                minimumCellVoltage_mV);
+#else
             pAllowedVoltageBasedCurrent->continuousDischargeCurrent_mA =
                 (pCalculatedSofCurves->slopeUpperCellVoltage *
                  (minimumCellVoltage_mV - pConfigLimitValues->limitLowerCellVoltage_mV));
+#endif /* SE_USE_FIXED_POINT_ARITHMETIC == true */
             pAllowedVoltageBasedCurrent->peakDischargeCurrent_mA =
                 pAllowedVoltageBasedCurrent->continuousDischargeCurrent_mA;
         } else {
@@ -222,9 +251,18 @@ static void SOF_CalculateVoltageBasedCurrentLimit(
         pAllowedVoltageBasedCurrent->peakChargeCurrent_mA       = 0.0f;
     } else {
         if (maximumCellVoltage_mV >= pConfigLimitValues->cutoffUpperCellVoltage_mV) {
+#if SE_USE_FIXED_POINT_ARITHMETIC == true
+            pAllowedVoltageBasedCurrent->continuousChargeCurrent_mA = SOF_InterpolateCurrentLimit(
+                pConfigLimitValues->limitUpperCellVoltage_mV,
+                0.0f,
+                pConfigLimitValues->cutoffUpperCellVoltage_mV,
+                pConfigLimitValues->maximumChargeCurrent_mA,
+                maximumCellVoltage_mV);
+#else
             pAllowedVoltageBasedCurrent->continuousChargeCurrent_mA =
                 (pCalculatedSofCurves->slopeLowerCellVoltage *
                  (maximumCellVoltage_mV - pConfigLimitValues->limitUpperCellVoltage_mV));
+#endif /* SE_USE_FIXED_POINT_ARITHMETIC == true */
             pAllowedVoltageBasedCurrent->peakChargeCurrent_mA = pAllowedVoltageBasedCurrent->continuousChargeCurrent_mA;
         } else {
             pAllowedVoltageBasedCurrent->continuousChargeCurrent_mA = pConfigLimitValues->maximumChargeCurrent_mA;
@@ -252,9 +290,18 @@ static void SOF_CalculateTemperatureBasedCurrentLimit(
         pAllowedTemperatureBasedCurrent->peakDischargeCurrent_mA       = pConfigLimitValues->limpHomeCurrent_mA;
     } else {
         if (minimumCellTemperature_ddegC <= pConfigLimitValues->cutoffLowTemperatureDischarge_ddegC) {
+#if SE_USE_FIXED_POINT_ARITHMETIC == true
+            pAllowedTemperatureBasedCurrent->continuousDischargeCurrent_mA = SOF_InterpolateCurrentLimit(
+                pConfigLimitValues->limitLowTemperatureDischarge_ddegC,
+                pConfigLimitValues->limpHomeCurrent_mA,
+                pConfigLimitValues->cutoffLowTemperatureDischarge_ddegC,
+                pConfigLimitValues->maximumDischargeCurrent_mA,
+                minimumCellTemperature_ddegC);
+#else
             pAllowedTemperatureBasedCurrent->continuousDischargeCurrent_mA =
                 (pCalculatedSofCurves->slopeLowTemperatureDischarge * minimumCellTemperature_ddegC) +
                 pCalculatedSofCurves->offsetLowTemperatureDischarge;
+#endif /* SE_USE_FIXED_POINT_ARITHMETIC == true */
             pAllowedTemperatureBasedCurrent->peakDischargeCurrent_mA =
                 pAllowedTemperatureBasedCurrent->continuousDischargeCurrent_mA;
         } else {
@@ -269,9 +316,18 @@ static void SOF_CalculateTemperatureBasedCurrentLimit(
         pAllowedTemperatureBasedCurrent->peakChargeCurrent_mA       = 0;
     } else {
         if (minimumCellTemperature_ddegC <= pConfigLimitValues->cutoffLowTemperatureCharge_ddegC) {
+#if SE_USE_FIXED_POINT_ARITHMETIC == true
+            pAllowedTemperatureBasedCurrent->continuousChargeCurrent_mA = SOF_InterpolateCurrentLimit(
+                pConfigLimitValues->limitLowTemperatureCharge_ddegC,
+                0.0f,
+                pConfigLimitValues->cutoffLowTemperatureCharge_ddegC,
+                pConfigLimitValues->maximumChargeCurrent_mA,
+                minimumCellTemperature_ddegC);
+#else
             pAllowedTemperatureBasedCurrent->continuousChargeCurrent_mA =
                 (pCalculatedSofCurves->slopeLowTemperatureCharge * minimumCellTemperature_ddegC) +
                 pCalculatedSofCurves->offsetLowTemperatureCharge;
+#endif /* SE_USE_FIXED_POINT_ARITHMETIC == true */
             pAllowedTemperatureBasedCurrent->peakChargeCurrent_mA =
                 pAllowedTemperatureBasedCurrent->continuousChargeCurrent_mA;
         } else {
@@ -285,9 +341,18 @@ static void SOF_CalculateTemperatureBasedCurrentLimit(
         pAllowedTemperatureBasedCurrent->peakDischargeCurrent_mA       = 0.0f;
     } else {
         if (maximumCellTemperature_ddegC >= pConfigLimitValues->cutoffHighTemperatureDischarge_ddegC) {
+#if SE_USE_FIXED_POINT_ARITHMETIC == true
+            temporaryCurrentLimits.continuousDischargeCurrent_mA = SOF_InterpolateCurrentLimit(
+                pConfigLimitValues->limitHighTemperatureDischarge_ddegC,
+                0.0f,
+                pConfigLimitValues->cutoffHighTemperatureDischarge_ddegC,
+                pConfigLimitValues->maximumDischargeCurrent_mA,
+                maximumCellTemperature_ddegC);
+#else
             temporaryCurrentLimits.continuousDischargeCurrent_mA =
                 (pCalculatedSofCurves->slopeHighTemperatureDischarge * maximumCellTemperature_ddegC) +
                 pCalculatedSofCurves->offsetHighTemperatureDischarge;
+#endif /* SE_USE_FIXED_POINT_ARITHMETIC == true */
             temporaryCurrentLimits.peakDischargeCurrent_mA = temporaryCurrentLimits.continuousDischargeCurrent_mA;
         } else {
             /* do nothing because this situation is handled with minimumCellTemperature_ddegC */
@@ -309,9 +374,18 @@ static void SOF_CalculateTemperatureBasedCurrentLimit(
         pAllowedTemperatureBasedCurrent->peakChargeCurrent_mA       = 0.0f;
     } else {
         if (maximumCellTemperature_ddegC >= pConfigLimitValues->cutoffHighTemperatureCharge_ddegC) {
+#if SE_USE_FIXED_POINT_ARITHMETIC == true
+            temporaryCurrentLimits.continuousChargeCurrent_mA = SOF_InterpolateCurrentLimit(
+                pConfigLimitValues->limitHighTemperatureCharge_ddegC,
+                0.0f,
+                pConfigLimitValues->cutoffHighTemperatureCharge_ddegC,
+                pConfigLimitValues->maximumChargeCurrent_mA,
+                maximumCellTemperature_ddegC);
+#else
             temporaryCurrentLimits.continuousChargeCurrent_mA =
                 (pCalculatedSofCurves->slopeHighTemperatureCharge * maximumCellTemperature_ddegC) +
                 pCalculatedSofCurves->offsetHighTemperatureCharge;
+#endif /* SE_USE_FIXED_POINT_ARITHMETIC == true */
             temporaryCurrentLimits.peakChargeCurrent_mA = temporaryCurrentLimits.continuousChargeCurrent_mA;
         } else {
             /* do nothing because this situation is handled with minimumCellTemperature_ddegC */
@@ -329,6 +403,28 @@ static void SOF_CalculateTemperatureBasedCurrentLimit(
     }
 }
 
+#if SE_USE_FIXED_POINT_ARITHMETIC == true
+static float_t SOF_InterpolateCurrentLimit(
+    int16_t x1,
+    float_t y1_mA,
+    int16_t x2,
+    float_t y2_mA,
+    int16_t x_interpolate) {
+    /* AXIVION Routine Generic-MissingParameterAssert: x1: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: y1_mA: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: x2: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: y2_mA: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: x_interpolate: parameter accepts whole range */
+    const MATH_Q16_16 current_A = MATH_LinearInterpolationQ16_16(
+        MATH_Int32ToQ16_16((int32_t)x1),
+        MATH_FloatToQ16_16(y1_mA / UNIT_CONVERSION_FACTOR_1000_FLOAT),
+        MATH_Int32ToQ16_16((int32_t)x2),
+        MATH_FloatToQ16_16(y2_mA / UNIT_CONVERSION_FACTOR_1000_FLOAT),
+        MATH_Int32ToQ16_16((int32_t)x_interpolate));
+    return MATH_Q16_16ToFloat(current_A) * UNIT_CONVERSION_FACTOR_1000_FLOAT;
+}
+#endif /* SE_USE_FIXED_POINT_ARITHMETIC == true */
+
 static SOF_CURRENT_LIMITS_s SOF_MinimumOfTwoSofValues(
     SOF_CURRENT_LIMITS_s voltageBasedLimits,
     SOF_CURRENT_LIMITS_s temperatureBasedLimits) {
@@ -0,0 +1,468 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    soh_rls.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup APPLICATION
+ * @prefix  SOH
+ *
+ * @brief   SOH module estimating capacity and internal resistance of every
+ *          cell block with recursive least squares
+ * @details The capacity is estimated from the charge that has been counted
+ *          between two rest points and the SOC difference of the rest points
+ *          that is looked up from the relaxed cell voltages. The internal
+ *          resistance is estimated from the voltage response to current
+ *          steps. Both estimations are scalar recursive least squares with a
+ *          forgetting factor, i.e., every cell block needs a constant amount
+ *          of memory and a constant number of operations per observation.
+ *          Estimates and variances are stored in the FRAM at most every
+ *          #SOH_RLS_CHECKPOINT_PERIOD_ms.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "general.h"
+
+#include "soh_rls.h"
+#include "soh_rls_cfg.h"
+
+#include "database.h"
+#include "foxmath.h"
+#include "fram.h"
+#include "os.h"
+#include "state_estimation.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** Maximum SOH in percentage */
+#define SOH_MAXIMUM_SOH_perc (100.0f)
+/** Minimum SOH in percentage */
+#define SOH_MINIMUM_SOH_perc (0.0f)
+
+/** This structure contains all the variables relevant for the SOH estimation */
+typedef struct {
+    /** true if the initialization has passed, false otherwise */
+    bool sohInitialized;
+    /** previous sample can be used for the current step detection */
+    bool isPreviousSampleValid[BS_NR_OF_STRINGS];
+    /** timestamp of the last processed current measurement */
+    uint32_t previousTimestamp[BS_NR_OF_STRINGS];
+    /** timestamp of the current measurement of the previous sample */
+    uint32_t previousSampleTimestamp[BS_NR_OF_STRINGS];
+    /** timestamp of the cell voltage measurement of the previous sample */
+    uint32_t previousCellVoltageTimestamp[BS_NR_OF_STRINGS];
+    /** current of the previous sample, positive in discharge direction */
+    int32_t previousCurrent_mA[BS_NR_OF_STRINGS];
+    /** cell voltages of the previous sample */
+    int16_t previousCellVoltage_mV[BS_NR_OF_STRINGS][BS_NR_OF_CELL_BLOCKS_PER_STRING];
+    /** invalid flags of the cell voltages of the previous sample */
+    uint64_t previousInvalidCellVoltage[BS_NR_OF_STRINGS][BS_NR_OF_MODULES_PER_STRING];
+    /** current is below the rest current */
+    bool isResting[BS_NR_OF_STRINGS];
+    /** rest point of the current rest phase has been taken */
+    bool isRestPointTaken[BS_NR_OF_STRINGS];
+    /** timestamp of the start of the current rest phase */
+    uint32_t restStartTimestamp[BS_NR_OF_STRINGS];
+    /** a rest point is available for the capacity estimation */
+    bool isRestPointValid[BS_NR_OF_STRINGS];
+    /** SOC of the cell blocks at the last rest point */
+    float_t restPointSoc_perc[BS_NR_OF_STRINGS][BS_NR_OF_CELL_BLOCKS_PER_STRING];
+    /** charge counted since the last rest point, positive in discharge direction */
+    float_t chargeSinceRestPoint_As[BS_NR_OF_STRINGS];
+    /** number of capacity observations since startup */
+    uint32_t numberOfCapacityUpdates;
+    /** number of resistance observations since startup */
+    uint32_t numberOfResistanceUpdates;
+    /** estimates have been updated since they have been stored in the FRAM */
+    bool hasUnsavedUpdates;
+    /** time when the estimates have been stored in the FRAM */
+    uint32_t checkpointTimestamp;
+} SOH_STATE_s;
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** state variable for SOH module */
+static SOH_STATE_s soh_state = {
+    .sohInitialized            = false,
+    .numberOfCapacityUpdates   = 0u,
+    .numberOfResistanceUpdates = 0u,
+    .hasUnsavedUpdates         = false,
+    .checkpointTimestamp       = 0u,
+};
+
+/** local copies of database tables */
+/**@{*/
+static DATA_BLOCK_CURRENT_SENSOR_s soh_tableCurrentSensor = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_SENSOR};
+static DATA_BLOCK_CELL_VOLTAGE_s soh_tableCellVoltage     = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+/**@}*/
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   limits a value to the SOH range [0.0, 100.0]
+ * @param[in]   value_perc  value in percentage
+ * @return  limited value in percentage
+ */
+static float_t SOH_LimitSoh(float_t value_perc);
+
+/**
+ * @brief   updates a scalar estimate with one observation
+ * @details Model: observation = regressor * estimate. The variance is bounded
+ *          by its initial value, so that it can not wind up during long
+ *          phases without excitation.
+ * @param[in,out]   pEstimate       estimate to be updated
+ * @param[in,out]   pVariance       variance of the estimate
+ * @param[in]       maximumVariance upper bound of the variance
+ * @param[in]       regressor       regressor of the observation
+ * @param[in]       observation     observed value
+ */
+static void SOH_UpdateRecursiveLeastSquares(
+    float_t *pEstimate,
+    float_t *pVariance,
+    float_t maximumVariance,
+    float_t regressor,
+    float_t observation);
+
+/**
+ * @brief   checks whether the voltage of a cell block is valid
+ * @param[in]   pInvalidFlags   invalid flags of the modules of the string
+ * @param[in]   cellBlock       addressed cell block of the string
+ * @return  true if valid, false otherwise
+ */
+static bool SOH_IsCellVoltageValid(const uint64_t *pInvalidFlags, uint16_t cellBlock);
+
+/**
+ * @brief   returns the voltage of a cell block
+ * @param[in]   stringNumber    addressed string
+ * @param[in]   cellBlock       addressed cell block of the string
+ * @return  cell voltage in mV
+ */
+static int16_t SOH_GetCellVoltage_mV(uint8_t stringNumber, uint16_t cellBlock);
+
+/**
+ * @brief   updates the resistance estimations of a string with a current step
+ * @param[in]   stringNumber    addressed string
+ * @param[in]   current_mA      current, positive in discharge direction
+ * @return  true if the estimations have been updated, false otherwise
+ */
+static bool SOH_TrackResistance(uint8_t stringNumber, int32_t current_mA);
+
+/**
+ * @brief   detects rest points and updates the capacity estimations of a
+ *          string between two rest points
+ * @param[in]   stringNumber    addressed string
+ * @param[in]   current_mA      current, positive in discharge direction
+ * @param[in]   timestamp       timestamp of the current measurement
+ * @return  true if the estimations have been updated, false otherwise
+ */
+static bool SOH_TrackCapacity(uint8_t stringNumber, int32_t current_mA, uint32_t timestamp);
+
+/**
+ * @brief   calculates the SOH of all cell blocks of a string and sets the
+ *          minimum, maximum and average value
+ * @param[out]  pSohValues      pointer to SOH database entry
+ * @param[in]   stringNumber    addressed string
+ */
+static void SOH_SetStringValues(DATA_BLOCK_SOH_s *pSohValues, uint8_t stringNumber);
+
+/*========== Static Function Implementations ================================*/
+static float_t SOH_LimitSoh(float_t value_perc) {
+    float_t limitedValue_perc = value_perc;
+    if (value_perc > SOH_MAXIMUM_SOH_perc) {
+        limitedValue_perc = SOH_MAXIMUM_SOH_perc;
+    }
+    if (value_perc < SOH_MINIMUM_SOH_perc) {
+        limitedValue_perc = SOH_MINIMUM_SOH_perc;
+    }
+    return limitedValue_perc;
+}
+
+static void SOH_UpdateRecursiveLeastSquares(
+    float_t *pEstimate,
+    float_t *pVariance,
+    float_t maximumVariance,
+    float_t regressor,
+    float_t observation) {
+    FAS_ASSERT(pEstimate != NULL_PTR);
+    FAS_ASSERT(pVariance != NULL_PTR);
+    const float_t gain =
+        ((*pVariance) * regressor) / (SOH_RLS_FORGETTING_FACTOR + (regressor * (*pVariance) * regressor));
+    *pEstimate = (*pEstimate) + (gain * (observation - (regressor * (*pEstimate))));
+    *pVariance = ((*pVariance) - (gain * regressor * (*pVariance))) / SOH_RLS_FORGETTING_FACTOR;
+    *pVariance = MATH_MinimumOfTwoFloats(*pVariance, maximumVariance);
+}
+
+static bool SOH_IsCellVoltageValid(const uint64_t *pInvalidFlags, uint16_t cellBlock) {
+    FAS_ASSERT(pInvalidFlags != NULL_PTR);
+    FAS_ASSERT(cellBlock < BS_NR_OF_CELL_BLOCKS_PER_STRING);
+    const uint8_t m  = (uint8_t)(cellBlock / BS_NR_OF_CELL_BLOCKS_PER_MODULE);
+    const uint8_t cb = (uint8_t)(cellBlock % BS_NR_OF_CELL_BLOCKS_PER_MODULE);
+    return ((pInvalidFlags[m] & ((uint64_t)1u << cb)) == 0u);
+}
+
+static int16_t SOH_GetCellVoltage_mV(uint8_t stringNumber, uint16_t cellBlock) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    FAS_ASSERT(cellBlock < BS_NR_OF_CELL_BLOCKS_PER_STRING);
+    return soh_tableCellVoltage.cellVoltage_mV[stringNumber][cellBlock / BS_NR_OF_CELL_BLOCKS_PER_MODULE]
+                                              [cellBlock % BS_NR_OF_CELL_BLOCKS_PER_MODULE];
+}
+
+static bool SOH_TrackResistance(uint8_t stringNumber, int32_t current_mA) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    bool hasUpdated              = false;
+    const int32_t currentStep_mA = current_mA - soh_state.previousCurrent_mA[stringNumber];
+    if ((currentStep_mA >= SOH_RLS_MINIMUM_CURRENT_STEP_mA) || (currentStep_mA <= -SOH_RLS_MINIMUM_CURRENT_STEP_mA)) {
+        const float_t currentStep_A = (float_t)currentStep_mA / UNIT_CONVERSION_FACTOR_1000_FLOAT;
+        for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+            /* both samples of the step have to be valid */
+            if ((SOH_IsCellVoltageValid(soh_tableCellVoltage.invalidCellVoltage[stringNumber], c) == true) &&
+                (SOH_IsCellVoltageValid(soh_state.previousInvalidCellVoltage[stringNumber], c) == true)) {
+                /* the voltage drops with increasing discharge current: dU = -R * dI */
+                const float_t voltageStep_mV = (float_t)soh_state.previousCellVoltage_mV[stringNumber][c] -
+                                               (float_t)SOH_GetCellVoltage_mV(stringNumber, c);
+                SOH_UpdateRecursiveLeastSquares(
+                    &fram_soh.resistance_mOhm[stringNumber][c],
+                    &fram_soh.resistanceVariance[stringNumber][c],
+                    SOH_RLS_INITIAL_RESISTANCE_VARIANCE,
+                    currentStep_A,
+                    voltageStep_mV);
+                soh_state.numberOfResistanceUpdates++;
+            }
+        }
+        hasUpdated = true;
+    }
+    return hasUpdated;
+}
+
+static bool SOH_TrackCapacity(uint8_t stringNumber, int32_t current_mA, uint32_t timestamp) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    bool hasUpdated = false;
+    if ((current_mA <= SOH_RLS_REST_CURRENT_mA) && (current_mA >= -SOH_RLS_REST_CURRENT_mA)) {
+        if (soh_state.isResting[stringNumber] == false) {
+            soh_state.isResting[stringNumber]          = true;
+            soh_state.isRestPointTaken[stringNumber]   = false;
+            soh_state.restStartTimestamp[stringNumber] = timestamp;
+        } else if (
+            (soh_state.isRestPointTaken[stringNumber] == false) &&
+            ((timestamp - soh_state.restStartTimestamp[stringNumber]) >= SOH_RLS_REST_TIME_ms)) {
+            /* cell voltages are relaxed: take a rest point */
+            const float_t charge_perc = UNIT_CONVERSION_FACTOR_100_FLOAT *
+                                        soh_state.chargeSinceRestPoint_As[stringNumber] / SOH_RLS_NOMINAL_CAPACITY_As;
+            for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+                if (SOH_IsCellVoltageValid(soh_tableCellVoltage.invalidCellVoltage[stringNumber], c) == true) {
+                    const int16_t voltage_mV         = SOH_GetCellVoltage_mV(stringNumber, c);
+                    const float_t soc_perc           = SE_GetStateOfChargeFromVoltage(voltage_mV);
+                    const float_t socDifference_perc = soh_state.restPointSoc_perc[stringNumber][c] - soc_perc;
+                    if ((soh_state.isRestPointValid[stringNumber] == true) &&
+                        ((socDifference_perc >= SOH_RLS_MINIMUM_SOC_DIFFERENCE_perc) ||
+                         (socDifference_perc <= -SOH_RLS_MINIMUM_SOC_DIFFERENCE_perc))) {
+                        /* counted charge = capacity * SOC difference */
+                        SOH_UpdateRecursiveLeastSquares(
+                            &fram_soh.capacity_perc[stringNumber][c],
+                            &fram_soh.capacityVariance[stringNumber][c],
+                            SOH_RLS_INITIAL_CAPACITY_VARIANCE,
+                            socDifference_perc / UNIT_CONVERSION_FACTOR_100_FLOAT,
+                            charge_perc);
+                        soh_state.numberOfCapacityUpdates++;
+                        hasUpdated = true;
+                    }
+                    soh_state.restPointSoc_perc[stringNumber][c] = soc_perc;
+                }
+            }
+            soh_state.isRestPointValid[stringNumber]        = true;
+            soh_state.isRestPointTaken[stringNumber]        = true;
+            soh_state.chargeSinceRestPoint_As[stringNumber] = 0.0f;
+        } else {
+            /* waiting for the cell voltages to relax or rest point already taken */
+        }
+    } else {
+        soh_state.isResting[stringNumber] = false;
+    }
+    return hasUpdated;
+}
+
+static void SOH_SetStringValues(DATA_BLOCK_SOH_s *pSohValues, uint8_t stringNumber) {
+    FAS_ASSERT(pSohValues != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    float_t minimumSoh_perc = SOH_MAXIMUM_SOH_perc;
+    float_t maximumSoh_perc = SOH_MINIMUM_SOH_perc;
+    float_t sumSoh_perc     = 0.0f;
+    for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+        /* the SOH of a cell block is limited by both capacity fade and resistance increase */
+        const float_t resistanceSoh_perc =
+            UNIT_CONVERSION_FACTOR_100_FLOAT *
+            (SOH_RLS_END_OF_LIFE_RESISTANCE_mOhm - fram_soh.resistance_mOhm[stringNumber][c]) /
+            (SOH_RLS_END_OF_LIFE_RESISTANCE_mOhm - SOH_RLS_BEGIN_OF_LIFE_RESISTANCE_mOhm);
+        const float_t soh_perc =
+            SOH_LimitSoh(MATH_MinimumOfTwoFloats(fram_soh.capacity_perc[stringNumber][c], resistanceSoh_perc));
+        minimumSoh_perc = MATH_MinimumOfTwoFloats(minimumSoh_perc, soh_perc);
+        if (soh_perc > maximumSoh_perc) {
+            maximumSoh_perc = soh_perc;
+        }
+        sumSoh_perc += soh_perc;
+    }
+    pSohValues->minimumSoh_perc[stringNumber] = minimumSoh_perc;
+    pSohValues->maximumSoh_perc[stringNumber] = maximumSoh_perc;
+    pSohValues->averageSoh_perc[stringNumber] = sumSoh_perc / (float_t)BS_NR_OF_CELL_BLOCKS_PER_STRING;
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void SE_InitializeStateOfHealth(DATA_BLOCK_SOH_s *pSohValues, uint8_t stringNumber) {
+    FAS_ASSERT(pSohValues != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    DATA_READ_DATA(&soh_tableCurrentSensor);
+    FRAM_ReadData(FRAM_BLOCK_ID_SOH);
+
+    for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+        /* start from a new cell if the FRAM has never been written or holds implausible values */
+        if ((fram_soh.capacityVariance[stringNumber][c] <= 0.0f) ||
+            (fram_soh.capacityVariance[stringNumber][c] > SOH_RLS_INITIAL_CAPACITY_VARIANCE) ||
+            (fram_soh.resistanceVariance[stringNumber][c] <= 0.0f) ||
+            (fram_soh.resistanceVariance[stringNumber][c] > SOH_RLS_INITIAL_RESISTANCE_VARIANCE)) {
+            fram_soh.capacity_perc[stringNumber][c]      = SOH_MAXIMUM_SOH_perc;
+            fram_soh.capacityVariance[stringNumber][c]   = SOH_RLS_INITIAL_CAPACITY_VARIANCE;
+            fram_soh.resistance_mOhm[stringNumber][c]    = SOH_RLS_BEGIN_OF_LIFE_RESISTANCE_mOhm;
+            fram_soh.resistanceVariance[stringNumber][c] = SOH_RLS_INITIAL_RESISTANCE_VARIANCE;
+        }
+    }
+
+    soh_state.previousTimestamp[stringNumber]            = soh_tableCurrentSensor.timestampCurrent[stringNumber];
+    soh_state.isPreviousSampleValid[stringNumber]        = false;
+    soh_state.previousCellVoltageTimestamp[stringNumber] = 0u;
+    soh_state.isResting[stringNumber]                    = false;
+    soh_state.isRestPointValid[stringNumber]             = false;
+    soh_state.chargeSinceRestPoint_As[stringNumber]      = 0.0f;
+    soh_state.checkpointTimestamp                        = OS_GetTickCount();
+    soh_state.sohInitialized                             = true;
+
+    SOH_SetStringValues(pSohValues, stringNumber);
+}
+
+extern void SE_CalculateStateOfHealth(DATA_BLOCK_SOH_s *pSohValues) {
+    FAS_ASSERT(pSohValues != NULL_PTR);
+    if (soh_state.sohInitialized == true) {
+        DATA_READ_DATA(&soh_tableCurrentSensor, &soh_tableCellVoltage);
+        bool hasUpdated = false;
+        for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+            const uint32_t timestamp = soh_tableCurrentSensor.timestampCurrent[s];
+            if (soh_tableCurrentSensor.invalidCurrentMeasurement[s] != 0u) {
+                /* a gap in the measurements invalidates the step detection and the counted charge */
+                soh_state.isPreviousSampleValid[s] = false;
+                soh_state.isRestPointValid[s]      = false;
+            } else if (soh_state.previousTimestamp[s] != timestamp) {
+                const uint32_t timeStep_ms = timestamp - soh_state.previousTimestamp[s];
+                int32_t current_mA         = soh_tableCurrentSensor.current_mA[s];
+#if BS_POSITIVE_DISCHARGE_CURRENT == false
+                current_mA *= (-1);
+#endif /* BS_POSITIVE_DISCHARGE_CURRENT == false */
+                soh_state.chargeSinceRestPoint_As[s] += ((float_t)current_mA * (float_t)timeStep_ms) /
+                                                        (UNIT_CONVERSION_FACTOR_1000_FLOAT *
+                                                         UNIT_CONVERSION_FACTOR_1000_FLOAT);
+
+                /* a sample for the step detection needs a new current and a new cell voltage measurement;
+                 * otherwise, a stale voltage would pair dI != 0 with dU = 0 and drag the resistance towards 0 */
+                const uint32_t cellVoltageTimestamp = soh_tableCellVoltage.header.timestamp;
+                if (soh_state.previousCellVoltageTimestamp[s] != cellVoltageTimestamp) {
+                    if ((soh_state.isPreviousSampleValid[s] == true) &&
+                        ((timestamp - soh_state.previousSampleTimestamp[s]) <= SOH_RLS_MAXIMUM_CURRENT_STEP_TIME_ms)) {
+                        if (SOH_TrackResistance(s, current_mA) == true) {
+                            hasUpdated = true;
+                        }
+                    }
+                    for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+                        soh_state.previousCellVoltage_mV[s][c] = SOH_GetCellVoltage_mV(s, c);
+                    }
+                    for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+                        soh_state.previousInvalidCellVoltage[s][m] = soh_tableCellVoltage.invalidCellVoltage[s][m];
+                    }
+                    soh_state.previousCurrent_mA[s]           = current_mA;
+                    soh_state.previousSampleTimestamp[s]      = timestamp;
+                    soh_state.previousCellVoltageTimestamp[s] = cellVoltageTimestamp;
+                    soh_state.isPreviousSampleValid[s]        = true;
+                }
+                if (SOH_TrackCapacity(s, current_mA, timestamp) == true) {
+                    hasUpdated = true;
+                }
+
+                soh_state.previousTimestamp[s] = timestamp;
+                SOH_SetStringValues(pSohValues, s);
+            } else {
+                /* no new current measurement */
+            }
+        }
+        if (hasUpdated == true) {
+            soh_state.hasUnsavedUpdates = true;
+        }
+        /* the whole SOH block is written, therefore the updates are collected over the checkpoint period */
+        const uint32_t timestamp = OS_GetTickCount();
+        if ((soh_state.hasUnsavedUpdates == true) &&
+            ((timestamp - soh_state.checkpointTimestamp) >= SOH_RLS_CHECKPOINT_PERIOD_ms)) {
+            if (FRAM_WriteData(FRAM_BLOCK_ID_SOH) == FRAM_ACCESS_OK) {
+                soh_state.hasUnsavedUpdates   = false;
+                soh_state.checkpointTimestamp = timestamp;
+            }
+        }
+    }
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern void TEST_SOH_UpdateRecursiveLeastSquares(
+    float_t *pEstimate,
+    float_t *pVariance,
+    float_t regressor,
+    float_t observation) {
+    SOH_UpdateRecursiveLeastSquares(pEstimate, pVariance, SOH_RLS_INITIAL_CAPACITY_VARIANCE, regressor, observation);
+}
+extern uint32_t TEST_SOH_GetNumberOfCapacityUpdates(void) {
+    return soh_state.numberOfCapacityUpdates;
+}
+extern uint32_t TEST_SOH_GetNumberOfResistanceUpdates(void) {
+    return soh_state.numberOfResistanceUpdates;
+}
+#endif
@@ -0,0 +1,129 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    soh_rls_cfg.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup APPLICATION
+ * @prefix  SOH
+ *
+ * @brief   Header for the configuration of the SOH estimation based on
+ *          recursive least squares
+ *
+ */
+
+#ifndef FOXBMS__SOH_RLS_CFG_H_
+#define FOXBMS__SOH_RLS_CFG_H_
+
+/*========== Includes =======================================================*/
+
+#include "battery_cell_cfg.h"
+#include "battery_system_cfg.h"
+
+#include <math.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** Nominal capacity of a cell block in As */
+#define SOH_RLS_NOMINAL_CAPACITY_As ((float_t)(BS_NR_OF_PARALLEL_CELLS_PER_CELL_BLOCK * BC_CAPACITY_mAh) * 3.6f)
+
+/** Internal resistance of a cell block at begin of life in mOhm (SOH of 100%) */
+#define SOH_RLS_BEGIN_OF_LIFE_RESISTANCE_mOhm (30.0f / (float_t)BS_NR_OF_PARALLEL_CELLS_PER_CELL_BLOCK)
+
+/** Internal resistance of a cell block at end of life in mOhm (SOH of 0%) */
+#define SOH_RLS_END_OF_LIFE_RESISTANCE_mOhm (60.0f / (float_t)BS_NR_OF_PARALLEL_CELLS_PER_CELL_BLOCK)
+
+/**
+ * Forgetting factor of the recursive least squares estimation. Older
+ * observations are weighted with this factor on every new observation, i.e.,
+ * the estimation roughly considers the last 1 / (1 - factor) observations.
+ */
+#define SOH_RLS_FORGETTING_FACTOR (0.95f)
+
+/** Initial variance of the capacity estimation in %^2 */
+#define SOH_RLS_INITIAL_CAPACITY_VARIANCE (100.0f)
+
+/** Initial variance of the resistance estimation in mOhm^2 */
+#define SOH_RLS_INITIAL_RESISTANCE_VARIANCE (100.0f)
+
+/**
+ * Maximum current in mA that is considered as rest. The cell voltage after
+ * #SOH_RLS_REST_TIME_ms of rest is taken as open-circuit voltage.
+ */
+#define SOH_RLS_REST_CURRENT_mA (100)
+
+/** Time in ms after which the cell voltage is considered to be relaxed */
+#define SOH_RLS_REST_TIME_ms (1800000u)
+
+/**
+ * Minimum SOC difference between two rest points that is required to update
+ * the capacity estimation
+ */
+#define SOH_RLS_MINIMUM_SOC_DIFFERENCE_perc (20.0f)
+
+/** Minimum current step in mA between two samples to update the resistance estimation */
+#define SOH_RLS_MINIMUM_CURRENT_STEP_mA ((int32_t)BC_CAPACITY_mAh / 2)
+
+/**
+ * Maximum time in ms between two samples of a current step. The longer the
+ * time, the more the relaxation of the cell falsifies the resistance.
+ */
+#define SOH_RLS_MAXIMUM_CURRENT_STEP_TIME_ms (1500u)
+
+/**
+ * Minimum time in ms between two writes of the estimates into the FRAM. The
+ * estimates change slowly, a restart loses at most the observations of this
+ * time.
+ */
+#define SOH_RLS_CHECKPOINT_PERIOD_ms (600000u)
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+#endif
+
+#endif /* FOXBMS__SOH_RLS_CFG_H_ */
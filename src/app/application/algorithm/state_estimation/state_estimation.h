@@ -68,6 +68,20 @@
 
 /*========== Macros and Definitions =========================================*/
 
+/**
+ * @brief   Selects the arithmetic of the counting based SOC and SOE
+ *          estimations and of the trapezoid based SOF estimation
+ * @details If set to true, these estimators integrate and interpolate with
+ *          the saturating fixed-point functions of foxmath instead of
+ *          floating point arithmetic. The results are then identical on the
+ *          host and on the target. The values in the database remain floating
+ *          point values. The define can be overridden by the build, e.g., with
+ *          the compiler option -DSE_USE_FIXED_POINT_ARITHMETIC=true.
+ */
+#ifndef SE_USE_FIXED_POINT_ARITHMETIC
+#define SE_USE_FIXED_POINT_ARITHMETIC (false)
+#endif
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
@@ -239,6 +239,11 @@ extern BAL_STATE_s *TEST_BAL_GetBalancingState(void);
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
 extern BAL_STATEMACH_e BAL_GetState(void);
+/* only implemented by the history based balancing strategy */
+extern void TEST_BAL_ComputeImbalances(void);
+extern void TEST_BAL_ResetImbalanceCache(void);
+extern uint32_t TEST_BAL_GetNumberOfDodComputations(void);
+extern uint16_t TEST_BAL_GetMinimumCellBlock(uint8_t stringNumber);
 #endif
 
 #endif /* FOXBMS__BAL_H_ */
@@ -43,7 +43,7 @@
  * @file    bal_strategy_history.c
  * @author  foxBMS Team
  * @date    2020-05-29 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup APPLICATION
  * @prefix  BAL
@@ -58,6 +58,7 @@
 #include "bal.h"
 #include "bms.h"
 #include "database.h"
+#include "database_helper.h"
 #include "os.h"
 #include "state_estimation.h"
 
@@ -66,12 +67,38 @@
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
+/** number of nodes of the tournament tree that tracks the minimum cell voltage of a string */
+#define BAL_MINIMUM_TREE_SIZE (2u * BS_NR_OF_CELL_BLOCKS_PER_STRING)
+
+/** index of the root node of the tournament tree */
+#define BAL_MINIMUM_TREE_ROOT (1u)
+
+/** conversion factor from capacity in mAh to charge in mAs */
+#define BAL_SECONDS_PER_HOUR (3600u)
+
+/**
+ * cache of the imbalance computation
+ * @details The depth-of-discharge of a cell block is only recomputed when its
+ *          voltage has changed by more than
+ *          #BAL_DOD_RECOMPUTATION_QUANTUM_mV since the last computation.
+ *          The minimum cell voltage per string is tracked in a tournament
+ *          tree: leaf n (node #BS_NR_OF_CELL_BLOCKS_PER_STRING + n) holds
+ *          cell block n, every inner node holds the index of the cell block
+ *          with the lower voltage of its two children and the root node holds
+ *          the cell block with the minimum voltage of the string.
+ */
+typedef struct {
+    bool isValid;                                                             /*!< cache has been filled */
+    int16_t voltage_mV[BS_NR_OF_STRINGS][BS_NR_OF_CELL_BLOCKS_PER_STRING];    /*!< last cell voltage */
+    int16_t dodVoltage_mV[BS_NR_OF_STRINGS][BS_NR_OF_CELL_BLOCKS_PER_STRING]; /*!< voltage of the cached DOD */
+    uint32_t dod_mAs[BS_NR_OF_STRINGS][BS_NR_OF_CELL_BLOCKS_PER_STRING];      /*!< cached depth-of-discharge */
+    uint16_t minimumTree[BS_NR_OF_STRINGS][BAL_MINIMUM_TREE_SIZE];            /*!< tournament tree */
+    uint32_t numberOfDodComputations;                                         /*!< number of SOC look-ups */
+} BAL_IMBALANCE_CACHE_s;
 
 /*========== Static Constant and Variable Definitions =======================*/
 /** local storage of the #DATA_BLOCK_BALANCING_CONTROL_s table */
 static DATA_BLOCK_BALANCING_CONTROL_s bal_balancing = {.header.uniqueId = DATA_BLOCK_ID_BALANCING_CONTROL};
-/** local storage of the #DATA_BLOCK_CELL_VOLTAGE_s table */
-static DATA_BLOCK_CELL_VOLTAGE_s bal_cellVoltage = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
 
 /** contains the state of the contactor state machine */
 static BAL_STATE_s bal_state = {
@@ -90,12 +117,24 @@ static BAL_STATE_s bal_state = {
     .balancingGlobalAllowed = false,
 };
 
+/** cache of cell voltages, depth-of-discharge and minimum cell voltage per string */
+static BAL_IMBALANCE_CACHE_s bal_imbalanceCache = {.isValid = false, .numberOfDodComputations = 0u};
+
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
 /** Activates history based balancing */
 static void BAL_ActivateBalancing(void);
 
+/**
+ * @brief   Sets the balancing state and decreases the delta charge of the cells
+ *          that are balanced
+ * @details The balancing control is updated in place, therefore it has to be
+ *          read from the database again before the evaluation is repeated.
+ * @param[in]   kpkCellVoltage  lent cell voltages (see #DATA_BorrowDataBlock())
+ */
+static void BAL_EvaluateBalancing(const DATA_BLOCK_CELL_VOLTAGE_s *const kpkCellVoltage);
+
 /**
  * @brief   Deactivates history based balancing
  * @details The balancing state of all cells in all strings set to inactivate
@@ -120,14 +159,75 @@ static bool BAL_CheckImbalances(void);
 /** State machine subfunction to compute the imbalance of all cells */
 static void BAL_ComputeImbalances(void);
 
+/** Invalidates the imbalance cache, so that it is completely refilled on the next computation */
+static void BAL_ResetImbalanceCache(void);
+
+/**
+ * @brief   Computes the depth-of-discharge of a cell from its voltage
+ * @param[in]   voltage_mV  cell voltage in mV
+ * @returns depth-of-discharge in mAs
+ */
+static uint32_t BAL_GetDepthOfDischarge_mAs(int16_t voltage_mV);
+
+/**
+ * @brief   Checks whether a cell block wins against another cell block in the
+ *          tournament tree of a string
+ * @details A cell block wins if its voltage is lower. If the voltages are
+ *          equal, the cell block with the higher index wins.
+ * @param[in]   stringNumber    string addressed
+ * @param[in]   cellBlockA      first cell block
+ * @param[in]   cellBlockB      second cell block
+ * @returns index of the winning cell block
+ */
+static uint16_t BAL_GetLowerCellBlock(uint8_t stringNumber, uint16_t cellBlockA, uint16_t cellBlockB);
+
+/**
+ * @brief   Propagates the change of the voltage of a cell block in the
+ *          tournament tree to the root node
+ * @param[in]   stringNumber    string addressed
+ * @param[in]   cellBlock       cell block whose voltage has changed
+ */
+static void BAL_UpdateMinimumTree(uint8_t stringNumber, uint16_t cellBlock);
+
+/**
+ * @brief   Updates the cached cell voltages, depth-of-discharge and
+ *          tournament tree of a string with the latest cell voltages
+ * @param[in]   stringNumber    string addressed
+ * @param[in]   kpkCellVoltage  lent cell voltages (see #DATA_BorrowDataBlock())
+ */
+static void BAL_UpdateImbalanceCache(uint8_t stringNumber, const DATA_BLOCK_CELL_VOLTAGE_s *const kpkCellVoltage);
+
+/**
+ * @brief   Sets the delta charge of a cell block
+ * @param[in]   stringNumber        string addressed
+ * @param[in]   cellBlock           cell block addressed
+ * @param[in]   deltaCharge_mAs     delta charge to be set
+ * @returns true if the value has changed, otherwise false
+ */
+static bool BAL_SetDeltaCharge(uint8_t stringNumber, uint16_t cellBlock, uint32_t deltaCharge_mAs);
+
 /*========== Static Function Implementations ================================*/
 
 static void BAL_ActivateBalancing(void) {
+    bool isConsistent = false;
+    DATA_READ_VIEW_s cellVoltageView;
+
+    /* the balancing control is read again, if the cell voltages have been written during the evaluation */
+    for (uint8_t attempt = 0u; (attempt < DATA_MAXIMUM_BORROW_ATTEMPTS) && (isConsistent == false); attempt++) {
+        DATA_READ_DATA(&bal_balancing);
+        DATA_BorrowDataBlock(DATA_BLOCK_ID_CELL_VOLTAGE, &cellVoltageView);
+        BAL_EvaluateBalancing(cellVoltageView.pkDataBlock);
+        isConsistent = (DATA_ReturnDataBlock(&cellVoltageView) == STD_OK);
+    }
+
+    DATA_WRITE_DATA(&bal_balancing);
+}
+
+static void BAL_EvaluateBalancing(const DATA_BLOCK_CELL_VOLTAGE_s *const kpkCellVoltage) {
+    FAS_ASSERT(kpkCellVoltage != NULL_PTR);
     float_t cellBalancingCurrent = 0.0f;
     uint32_t difference          = 0;
 
-    DATA_READ_DATA(&bal_balancing, &bal_cellVoltage);
-
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
         uint16_t nrBalancedCells = 0u;
         for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
@@ -138,7 +238,8 @@ static void BAL_ActivateBalancing(void) {
                     bal_balancing.balancingState[s][c] = 1;
                     nrBalancedCells++;
                     uint8_t moduleNumber = c / BS_NR_OF_CELL_BLOCKS_PER_MODULE;
-                    cellBalancingCurrent = ((float_t)(bal_cellVoltage.cellVoltage_mV[s][moduleNumber][c])) /
+                    uint16_t cellBlock   = c % BS_NR_OF_CELL_BLOCKS_PER_MODULE;
+                    cellBalancingCurrent = ((float_t)(kpkCellVoltage->cellVoltage_mV[s][moduleNumber][cellBlock])) /
                                            BS_BALANCING_RESISTANCE_ohm;
                     difference       = (BAL_STATEMACH_BALANCINGTIME_100ms / 10u) * (uint32_t)(cellBalancingCurrent);
                     bal_state.active = true;
@@ -156,8 +257,6 @@ static void BAL_ActivateBalancing(void) {
         }
         bal_balancing.nrBalancedCells[s] = nrBalancedCells;
     }
-
-    DATA_WRITE_DATA(&bal_balancing);
 }
 
 static void BAL_Deactivate(void) {
@@ -268,56 +367,144 @@ static bool BAL_CheckImbalances(void) {
 }
 
 static void BAL_ComputeImbalances(void) {
-    int16_t voltageMin_mV                   = 0;
-    uint16_t minVoltageModuleIndex          = 0;
-    uint16_t minVoltageModuleCellBlockIndex = 0;
-    float_t SOC                             = 0.0f;
-    uint32_t DOD                            = 0;
-    uint32_t maxDOD                         = 0;
+    bool hasChanged   = false;
+    bool isConsistent = false;
+    DATA_READ_VIEW_s cellVoltageView;
+
+    DATA_READ_DATA(&bal_balancing);
+
+    /* updating the cache again with the written cell voltages makes it consistent */
+    for (uint8_t attempt = 0u; (attempt < DATA_MAXIMUM_BORROW_ATTEMPTS) && (isConsistent == false); attempt++) {
+        DATA_BorrowDataBlock(DATA_BLOCK_ID_CELL_VOLTAGE, &cellVoltageView);
+        for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+            BAL_UpdateImbalanceCache(s, cellVoltageView.pkDataBlock);
+        }
+        isConsistent = (DATA_ReturnDataBlock(&cellVoltageView) == STD_OK);
+    }
 
-    DATA_READ_DATA(&bal_balancing, &bal_cellVoltage);
+    /* update balancing threshold */
+    bal_state.balancingThreshold = BAL_GetBalancingThreshold_mV() + BAL_HYSTERESIS_mV;
 
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
-        /* Assign first cell voltage to*/
-        voltageMin_mV                  = INT16_MAX;
-        minVoltageModuleIndex          = 0u;
-        minVoltageModuleCellBlockIndex = 0u;
-        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
-            for (uint16_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                if (bal_cellVoltage.cellVoltage_mV[s][m][cb] <= voltageMin_mV) {
-                    voltageMin_mV                  = bal_cellVoltage.cellVoltage_mV[s][m][cb];
-                    minVoltageModuleIndex          = m;
-                    minVoltageModuleCellBlockIndex = cb;
+
+        const uint16_t minimumCellBlock = bal_imbalanceCache.minimumTree[s][BAL_MINIMUM_TREE_ROOT];
+        const int32_t voltageMin_mV     = (int32_t)bal_imbalanceCache.voltage_mV[s][minimumCellBlock];
+        const uint32_t maxDod_mAs       = bal_imbalanceCache.dod_mAs[s][minimumCellBlock];
+
+        if (BAL_SetDeltaCharge(s, minimumCellBlock, 0u) == true) {
+            hasChanged = true;
+        }
+
+        for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+            if ((c != minimumCellBlock) &&
+                ((int32_t)bal_imbalanceCache.voltage_mV[s][c] >= (voltageMin_mV + bal_state.balancingThreshold))) {
+                const uint32_t dod_mAs = bal_imbalanceCache.dod_mAs[s][c];
+                /* we are working with unsigned integers */
+                const uint32_t deltaCharge_mAs = (maxDod_mAs > dod_mAs) ? (maxDod_mAs - dod_mAs) : 0u;
+                if (BAL_SetDeltaCharge(s, c, deltaCharge_mAs) == true) {
+                    hasChanged = true;
                 }
             }
         }
+    }
 
-        SOC = SE_GetStateOfChargeFromVoltage(
-            ((float_t)(bal_cellVoltage.cellVoltage_mV[s][minVoltageModuleIndex][minVoltageModuleCellBlockIndex])) /
-            1000.0f);
-        maxDOD = BC_CAPACITY_mAh * (uint32_t)((1.0f - SOC) * 3600.0f);
-        bal_balancing.deltaCharge_mAs[s]
-                                     [(minVoltageModuleIndex * BS_NR_OF_CELL_BLOCKS_PER_MODULE) +
-                                      minVoltageModuleCellBlockIndex] = 0u;
-
-        /* update balancing threshold */
-        bal_state.balancingThreshold = BAL_GetBalancingThreshold_mV() + BAL_HYSTERESIS_mV;
-
-        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
-            for (uint16_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                if ((m != minVoltageModuleIndex) || (cb != minVoltageModuleCellBlockIndex)) {
-                    if (bal_cellVoltage.cellVoltage_mV[s][m][cb] >= (voltageMin_mV + bal_state.balancingThreshold)) {
-                        SOC = SE_GetStateOfChargeFromVoltage(
-                            ((float_t)(bal_cellVoltage.cellVoltage_mV[s][m][cb])) / 1000.0f);
-                        DOD = BC_CAPACITY_mAh * (uint32_t)((1.0f - SOC) * 3600.0f);
-                        bal_balancing.deltaCharge_mAs[s][(m * BS_NR_OF_CELL_BLOCKS_PER_MODULE) + cb] = (maxDOD - DOD);
-                    }
-                }
+    /* only publish the balancing control if an imbalance has changed */
+    if (hasChanged == true) {
+        DATA_WRITE_DATA(&bal_balancing);
+    }
+}
+
+static void BAL_ResetImbalanceCache(void) {
+    bal_imbalanceCache.isValid = false;
+}
+
+static uint32_t BAL_GetDepthOfDischarge_mAs(int16_t voltage_mV) {
+    float_t soc_perc = SE_GetStateOfChargeFromVoltage(voltage_mV);
+    if (soc_perc < 0.0f) {
+        soc_perc = 0.0f;
+    } else if (soc_perc > 100.0f) {
+        soc_perc = 100.0f;
+    } else {
+        /* SOC is in the valid range */
+    }
+    bal_imbalanceCache.numberOfDodComputations++;
+    return (uint32_t)(((100.0f - soc_perc) / 100.0f) * (float_t)(BC_CAPACITY_mAh * BAL_SECONDS_PER_HOUR));
+}
+
+static uint16_t BAL_GetLowerCellBlock(uint8_t stringNumber, uint16_t cellBlockA, uint16_t cellBlockB) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    FAS_ASSERT(cellBlockA < BS_NR_OF_CELL_BLOCKS_PER_STRING);
+    FAS_ASSERT(cellBlockB < BS_NR_OF_CELL_BLOCKS_PER_STRING);
+    const int16_t voltageA_mV = bal_imbalanceCache.voltage_mV[stringNumber][cellBlockA];
+    const int16_t voltageB_mV = bal_imbalanceCache.voltage_mV[stringNumber][cellBlockB];
+    uint16_t winner           = cellBlockB;
+    if ((voltageA_mV < voltageB_mV) || ((voltageA_mV == voltageB_mV) && (cellBlockA > cellBlockB))) {
+        winner = cellBlockA;
+    }
+    return winner;
+}
+
+static void BAL_UpdateMinimumTree(uint8_t stringNumber, uint16_t cellBlock) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    FAS_ASSERT(cellBlock < BS_NR_OF_CELL_BLOCKS_PER_STRING);
+    uint16_t *pTree = bal_imbalanceCache.minimumTree[stringNumber];
+    /* leaves are fixed, only the inner nodes on the path to the root change */
+    uint16_t node = (BS_NR_OF_CELL_BLOCKS_PER_STRING + cellBlock) / 2u;
+    while (node >= BAL_MINIMUM_TREE_ROOT) {
+        pTree[node] = BAL_GetLowerCellBlock(stringNumber, pTree[2u * node], pTree[(2u * node) + 1u]);
+        node /= 2u;
+    }
+}
+
+static void BAL_UpdateImbalanceCache(uint8_t stringNumber, const DATA_BLOCK_CELL_VOLTAGE_s *const kpkCellVoltage) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    FAS_ASSERT(kpkCellVoltage != NULL_PTR);
+    const bool isRefill = (bal_imbalanceCache.isValid == false);
+
+    for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+        const DATA_POSITION_s *const kpkPosition =
+            &data_kCellBlockPosition[(stringNumber * BS_NR_OF_CELL_BLOCKS_PER_STRING) + c];
+        const int16_t voltage_mV =
+            kpkCellVoltage->cellVoltage_mV[stringNumber][kpkPosition->moduleNumber][kpkPosition->number];
+        const int32_t dodDelta_mV = (int32_t)voltage_mV - (int32_t)bal_imbalanceCache.dodVoltage_mV[stringNumber][c];
+
+        if ((isRefill == true) || (voltage_mV != bal_imbalanceCache.voltage_mV[stringNumber][c])) {
+            bal_imbalanceCache.voltage_mV[stringNumber][c] = voltage_mV;
+            if (isRefill == false) {
+                BAL_UpdateMinimumTree(stringNumber, c);
             }
         }
+        if ((isRefill == true) || (dodDelta_mV > BAL_DOD_RECOMPUTATION_QUANTUM_mV) ||
+            (dodDelta_mV < -BAL_DOD_RECOMPUTATION_QUANTUM_mV)) {
+            bal_imbalanceCache.dodVoltage_mV[stringNumber][c] = voltage_mV;
+            bal_imbalanceCache.dod_mAs[stringNumber][c]       = BAL_GetDepthOfDischarge_mAs(voltage_mV);
+        }
     }
 
-    DATA_WRITE_DATA(&bal_balancing);
+    if (isRefill == true) {
+        /* build the complete tournament tree bottom-up */
+        uint16_t *pTree = bal_imbalanceCache.minimumTree[stringNumber];
+        for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+            pTree[BS_NR_OF_CELL_BLOCKS_PER_STRING + c] = c;
+        }
+        for (uint16_t node = BS_NR_OF_CELL_BLOCKS_PER_STRING - 1u; node >= BAL_MINIMUM_TREE_ROOT; node--) {
+            pTree[node] = BAL_GetLowerCellBlock(stringNumber, pTree[2u * node], pTree[(2u * node) + 1u]);
+        }
+        if (stringNumber == (BS_NR_OF_STRINGS - 1u)) {
+            bal_imbalanceCache.isValid = true;
+        }
+    }
+}
+
+static bool BAL_SetDeltaCharge(uint8_t stringNumber, uint16_t cellBlock, uint32_t deltaCharge_mAs) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    FAS_ASSERT(cellBlock < BS_NR_OF_CELL_BLOCKS_PER_STRING);
+    bool hasChanged = false;
+    if (bal_balancing.deltaCharge_mAs[stringNumber][cellBlock] != deltaCharge_mAs) {
+        bal_balancing.deltaCharge_mAs[stringNumber][cellBlock] = deltaCharge_mAs;
+        hasChanged                                             = true;
+    }
+    return hasChanged;
 }
 
 /*========== Extern Function Implementations ================================*/
@@ -363,6 +550,7 @@ extern void BAL_Trigger(void) {
         case BAL_STATEMACH_INITIALIZATION:
             BAL_SaveLastStates(&bal_state);
             BAL_Init(&bal_balancing);
+            BAL_ResetImbalanceCache();
             BAL_ProcessStateInitialization(&bal_state);
             break;
         case BAL_STATEMACH_INITIALIZED:
@@ -401,4 +589,16 @@ extern BAL_STATE_s *TEST_BAL_GetBalancingState(void) {
 extern BAL_STATEMACH_e BAL_GetState(void) {
     return bal_state.state;
 }
+extern void TEST_BAL_ComputeImbalances(void) {
+    BAL_ComputeImbalances();
+}
+extern void TEST_BAL_ResetImbalanceCache(void) {
+    BAL_ResetImbalanceCache();
+}
+extern uint32_t TEST_BAL_GetNumberOfDodComputations(void) {
+    return bal_imbalanceCache.numberOfDodComputations;
+}
+extern uint16_t TEST_BAL_GetMinimumCellBlock(uint8_t stringNumber) {
+    return bal_imbalanceCache.minimumTree[stringNumber][BAL_MINIMUM_TREE_ROOT];
+}
 #endif
@@ -43,7 +43,7 @@
  * @file    bal_strategy_voltage.c
  * @author  foxBMS Team
  * @date    2020-05-29 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup APPLICATION
  * @prefix  BAL
@@ -59,6 +59,7 @@
 
 #include "bms.h"
 #include "database.h"
+#include "database_helper.h"
 #include "os.h"
 
 #include <stdbool.h>
@@ -121,32 +122,52 @@ static void BAL_ProcessStateBalancing(BAL_STATE_REQUEST_e state_request);
 
 /*========== Static Function Implementations ================================*/
 static bool BAL_ActivateBalancing(void) {
-    bool finished               = true;
-    DATA_BLOCK_MIN_MAX_s minMax = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
-    /* Database entry is declared static, to place it in the data segment and not on the stack */
-    static DATA_BLOCK_CELL_VOLTAGE_s cellVoltage = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+    bool finished                 = true;
+    bool isConsistent             = false;
+    int32_t balancingThreshold_mV = bal_state.balancingThreshold;
+    DATA_READ_VIEW_s cellVoltageView;
+    DATA_READ_VIEW_s minMaxView;
+
+    /* evaluate the lent database entries again if they have been written during the evaluation */
+    for (uint8_t attempt = 0u; (attempt < DATA_MAXIMUM_BORROW_ATTEMPTS) && (isConsistent == false); attempt++) {
+        DATA_BorrowDataBlock(DATA_BLOCK_ID_CELL_VOLTAGE, &cellVoltageView);
+        DATA_BorrowDataBlock(DATA_BLOCK_ID_MIN_MAX, &minMaxView);
+        const DATA_BLOCK_CELL_VOLTAGE_s *const pkCellVoltage = cellVoltageView.pkDataBlock;
+        const DATA_BLOCK_MIN_MAX_s *const pkMinMax           = minMaxView.pkDataBlock;
+
+        finished              = true;
+        balancingThreshold_mV = bal_state.balancingThreshold;
 
-    DATA_READ_DATA(&cellVoltage, &minMax);
-
-    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
-        int16_t min              = minMax.minimumCellVoltage_mV[s];
-        uint16_t nrBalancedCells = 0u;
-        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
-            for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                if (cellVoltage.cellVoltage_mV[s][m][cb] > (min + bal_state.balancingThreshold)) {
-                    bal_balancing.balancingState[s][(m * BS_NR_OF_CELL_BLOCKS_PER_MODULE) + cb] = 1u;
-                    finished                                                                    = false;
-                    /* set without hysteresis so that we now balance all cells that are below the initial threshold */
-                    bal_state.balancingThreshold  = BAL_GetBalancingThreshold_mV();
-                    bal_state.active              = true;
-                    bal_balancing.enableBalancing = 1;
+        for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+            int16_t min              = pkMinMax->minimumCellVoltage_mV[s];
+            uint16_t nrBalancedCells = 0u;
+            for (uint16_t cell = 0u; cell < BS_NR_OF_CELL_BLOCKS_PER_STRING; cell++) {
+                const DATA_POSITION_s *const kpkPosition =
+                    &data_kCellBlockPosition[(s * BS_NR_OF_CELL_BLOCKS_PER_STRING) + cell];
+                if (pkCellVoltage->cellVoltage_mV[s][kpkPosition->moduleNumber][kpkPosition->number] >
+                    (min + balancingThreshold_mV)) {
+                    bal_balancing.balancingState[s][cell] = 1u;
+                    finished                              = false;
+                    /* set without hysteresis so that we now balance all cells that are below the initial
+                     * threshold */
+                    balancingThreshold_mV = BAL_GetBalancingThreshold_mV();
                     nrBalancedCells++;
                 } else {
-                    bal_balancing.balancingState[s][(m * BS_NR_OF_CELL_BLOCKS_PER_MODULE) + cb] = 0;
+                    bal_balancing.balancingState[s][cell] = 0;
                 }
             }
+            bal_balancing.nrBalancedCells[s] = nrBalancedCells;
         }
-        bal_balancing.nrBalancedCells[s] = nrBalancedCells;
+        isConsistent = (DATA_ReturnDataBlock(&cellVoltageView) == STD_OK);
+        if (DATA_ReturnDataBlock(&minMaxView) != STD_OK) {
+            isConsistent = false;
+        }
+    }
+    /* after the last attempt, every evaluated value is still a complete measurement of the respective cell */
+    if (finished == false) {
+        bal_state.balancingThreshold  = balancingThreshold_mV;
+        bal_state.active              = true;
+        bal_balancing.enableBalancing = 1;
     }
     DATA_WRITE_DATA(&bal_balancing);
 
@@ -358,4 +379,7 @@ extern BAL_STATE_s *TEST_BAL_GetBalancingState(void) {
 extern BAL_STATEMACH_e BAL_GetState(void) {
     return bal_state.state;
 }
+extern bool TEST_BAL_ActivateBalancing(void) {
+    return BAL_ActivateBalancing();
+}
 #endif
@@ -43,7 +43,7 @@
  * @file    bal_strategy_voltage.h
  * @author  foxBMS Team
  * @date    2020-05-29 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup APPLICATION
  * @prefix  BALS
@@ -58,6 +58,7 @@
 /*========== Includes =======================================================*/
 #include "bal.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
@@ -68,6 +69,7 @@
 
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
+extern bool TEST_BAL_ActivateBalancing(void);
 #endif
 
 #endif /* FOXBMS__BAL_STRATEGY_VOLTAGE_H_ */
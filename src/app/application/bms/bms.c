@@ -43,7 +43,7 @@
  * @file    bms.c
  * @author  foxBMS Team
  * @date    2020-02-24 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup ENGINE
  * @prefix  BMS
@@ -121,9 +121,11 @@ static BMS_STATE_s bms_state = {
 
 /** local copies of database tables */
 /**@{*/
-static DATA_BLOCK_MIN_MAX_s bms_tableMinMax         = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
-static DATA_BLOCK_OPEN_WIRE_s bms_tableOpenWire     = {.header.uniqueId = DATA_BLOCK_ID_OPEN_WIRE_BASE};
-static DATA_BLOCK_PACK_VALUES_s bms_tablePackValues = {.header.uniqueId = DATA_BLOCK_ID_PACK_VALUES};
+static DATA_BLOCK_MIN_MAX_s bms_tableMinMax                    = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+static DATA_BLOCK_OPEN_WIRE_s bms_tableOpenWire                = {.header.uniqueId = DATA_BLOCK_ID_OPEN_WIRE_BASE};
+static DATA_BLOCK_PACK_VALUES_s bms_tablePackValues            = {.header.uniqueId = DATA_BLOCK_ID_PACK_VALUES};
+static DATA_BLOCK_CELL_VOLTAGE_s bms_tableCellVoltages         = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+static DATA_BLOCK_CELL_TEMPERATURE_s bms_tableCellTemperatures = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
 /**@}*/
 
 /*========== Extern Constant and Variable Definitions =======================*/
@@ -355,6 +357,11 @@ static BMS_STATE_REQUEST_e BMS_TransferStateRequest(void) {
 
 static void BMS_GetMeasurementValues(void) {
     DATA_READ_DATA(&bms_tablePackValues, &bms_tableOpenWire, &bms_tableMinMax);
+    if (SOA_CHECK_EACH_CELL == true) {
+        /* The checks of each cell report diagnosis events and update their
+         * hysteresis, therefore they work on consistent local copies. */
+        DATA_READ_DATA(&bms_tableCellVoltages, &bms_tableCellTemperatures);
+    }
 }
 
 static uint8_t BMS_CheckCanRequests(void) {
@@ -837,10 +844,17 @@ void BMS_Trigger(void) {
     if (bms_state.state != BMS_STATEMACH_UNINITIALIZED) {
         BMS_GetMeasurementValues();
         BMS_UpdateBatsysState(&bms_tablePackValues);
-        SOA_CheckVoltages(&bms_tableMinMax);
-        SOA_CheckTemperatures(&bms_tableMinMax, &bms_tablePackValues);
+        if (SOA_CHECK_EACH_CELL == true) {
+            SOA_CheckCellVoltages(&bms_tableCellVoltages);
+            SOA_CheckCellTemperatures(&bms_tableCellTemperatures, &bms_tablePackValues);
+        } else {
+            SOA_CheckVoltages(&bms_tableMinMax);
+            SOA_CheckTemperatures(&bms_tableMinMax, &bms_tablePackValues);
+        }
         SOA_CheckCurrent(&bms_tablePackValues);
         SOA_CheckSlaveTemperatures();
+        /* measure temperatures and open wires at higher rates while the operating limits are violated */
+        MEAS_RequestMeasurementBoost(SOA_IsOperatingLimitViolated());
         BMS_CheckOpenSenseWire();
         CONT_CheckFeedback();
     }
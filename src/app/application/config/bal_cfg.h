@@ -89,6 +89,12 @@
 /** BAL upper temperature limit in deci &deg;C */
 #define BAL_UPPER_TEMPERATURE_LIMIT_ddegC (700)
 
+/**
+ * voltage change in mV of a cell block after which its depth-of-discharge is
+ * recomputed by the history based balancing strategy
+ */
+#define BAL_DOD_RECOMPUTATION_QUANTUM_mV (2)
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
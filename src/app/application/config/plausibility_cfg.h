@@ -43,7 +43,7 @@
  * @file    plausibility_cfg.h
  * @author  foxBMS Team
  * @date    2020-02-24 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup APPLICATION_CONFIGURATION
  * @prefix  PL
@@ -87,7 +87,7 @@
 
 /**
  * @brief   Maximum deviation between a single cell voltage measurement and the
- *          average cell voltage
+ *          median cell voltage of the string
  * @ptype   int
  * \par Range:
  * [0, 10000]
@@ -96,7 +96,7 @@
 
 /**
  * @brief   Maximum deviation between a single cell temperature measurement and
- *          the average cell temperature in deci kelvin
+ *          the median cell temperature of the string in deci kelvin
  * @ptype   int
  * \par Range:
  * [0, 100]
@@ -43,7 +43,7 @@
  * @file    soa_cfg.h
  * @author  foxBMS Team
  * @date    2020-10-14 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup APPLICATION_CONFIGURATION
  * @prefix  SOA
@@ -63,6 +63,26 @@
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
+/**
+ * @brief   Defines whether the safe operating area is checked for each cell
+ * @details If set to true, the cell voltages and cell temperatures are checked
+ *          cell by cell (see #SOA_CheckCellVoltages and
+ *          #SOA_CheckCellTemperatures), otherwise only the minimum and maximum
+ *          values of each string are checked (see #SOA_CheckVoltages and
+ *          #SOA_CheckTemperatures).
+ */
+#define SOA_CHECK_EACH_CELL (false)
+
+/**
+ * @brief   Hysteresis of the per-cell voltage limits
+ * @details A cell that violates a limit keeps violating it until its voltage
+ *          has recovered by more than the hysteresis. A hysteresis of zero
+ *          behaves like the check of the minimum and maximum values.
+ */
+#define SOA_CELL_VOLTAGE_HYSTERESIS_mV (0)
+
+/** Hysteresis of the per-cell temperature limits, see #SOA_CELL_VOLTAGE_HYSTERESIS_mV */
+#define SOA_CELL_TEMPERATURE_HYSTERESIS_ddegC (0)
 
 /*========== Extern Constant and Variable Declarations ======================*/
 
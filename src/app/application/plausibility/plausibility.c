@@ -43,7 +43,7 @@
  * @file    plausibility.c
  * @author  foxBMS Team
  * @date    2020-02-24 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup APPLICATION
  * @prefix  PL
@@ -57,20 +57,103 @@
 
 #include "battery_system_cfg.h"
 
+#include "database_helper.h"
 #include "diag.h"
 #include "foxmath.h"
 
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
+/** maximum number of values of a string that are checked for their spread */
+#define PL_MAXIMUM_NR_OF_VALUES                                                                             \
+    ((BS_NR_OF_CELL_BLOCKS_PER_STRING > BS_NR_OF_TEMP_SENSORS_PER_STRING) ? BS_NR_OF_CELL_BLOCKS_PER_STRING \
+                                                                          : BS_NR_OF_TEMP_SENSORS_PER_STRING)
 
 /*========== Static Constant and Variable Definitions =======================*/
+/** valid values of the string that is checked, reordered by the median selection */
+static int16_t pl_values[PL_MAXIMUM_NR_OF_VALUES] = {0};
 
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   returns the median of an array
+ * @details Quickselect with a median-of-three pivot, i.e., the expected
+ *          runtime is linear in the number of values. The array is
+ *          reordered. For an even number of values, the mean of the two
+ *          middle values is returned.
+ * @param[in,out]   pValues     values, reordered on return
+ * @param[in]       nrOfValues  number of values (at least 1)
+ * @return  median of the values
+ */
+static int32_t PL_GetMedian(int16_t *pValues, uint16_t nrOfValues);
 
 /*========== Static Function Implementations ================================*/
+static int32_t PL_GetMedian(int16_t *pValues, uint16_t nrOfValues) {
+    FAS_ASSERT(pValues != NULL_PTR);
+    FAS_ASSERT(nrOfValues > 0u);
+    const uint16_t k = nrOfValues / 2u;
+    uint16_t left    = 0u;
+    uint16_t right   = nrOfValues - 1u;
+
+    /* partition until the k-th smallest value is at index k */
+    while (left < right) {
+        /* median-of-three pivot */
+        const uint16_t middle = left + ((right - left) / 2u);
+        const int16_t a       = pValues[left];
+        const int16_t b       = pValues[middle];
+        const int16_t c       = pValues[right];
+        int16_t pivot         = b;
+        if ((a < b) == (b < c)) {
+            pivot = b;
+        } else if ((b < a) == (a < c)) {
+            pivot = a;
+        } else {
+            pivot = c;
+        }
+
+        /* Hoare partition: [left, j] <= pivot <= [i, right] */
+        int32_t i = (int32_t)left;
+        int32_t j = (int32_t)right;
+        while (i <= j) {
+            while (pValues[i] < pivot) {
+                i++;
+            }
+            while (pValues[j] > pivot) {
+                j--;
+            }
+            if (i <= j) {
+                const int16_t swap = pValues[i];
+                pValues[i]         = pValues[j];
+                pValues[j]         = swap;
+                i++;
+                j--;
+            }
+        }
+        if ((int32_t)k <= j) {
+            right = (uint16_t)j;
+        } else if ((int32_t)k >= i) {
+            left = (uint16_t)i;
+        } else {
+            /* k is between the partitions, i.e., equal to the pivot */
+            left  = k;
+            right = k;
+        }
+    }
+
+    int32_t median = (int32_t)pValues[k];
+    if ((nrOfValues % 2u) == 0u) {
+        /* the lower middle value is the largest value below index k */
+        int16_t lowerMiddle = pValues[0u];
+        for (uint16_t i = 1u; i < k; i++) {
+            if (pValues[i] > lowerMiddle) {
+                lowerMiddle = pValues[i];
+            }
+        }
+        median = (median + (int32_t)lowerMiddle) / 2;
+    }
+    return median;
+}
 
 /*========== Extern Function Implementations ================================*/
 extern STD_RETURN_TYPE_e PL_CheckStringVoltage(int32_t voltageAfe_mV, int32_t voltageCurrentSensor_mV) {
@@ -122,68 +205,101 @@ extern STD_RETURN_TYPE_e PL_CheckCelltemperature(
     return retval;
 }
 
-extern STD_RETURN_TYPE_e PL_CheckVoltageSpread(
-    DATA_BLOCK_CELL_VOLTAGE_s *pCellVoltages,
-    DATA_BLOCK_MIN_MAX_s *pMinMaxAverageValues) {
+extern STD_RETURN_TYPE_e PL_CheckVoltageSpread(DATA_BLOCK_CELL_VOLTAGE_s *pCellVoltages) {
     /* Pointer validity check */
     FAS_ASSERT(pCellVoltages != NULL_PTR);
-    FAS_ASSERT(pMinMaxAverageValues != NULL_PTR);
 
     STD_RETURN_TYPE_e retval = STD_OK;
 
-    /* Iterate over all cells */
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        /* first pass: collect the valid cell voltages of the string */
+        uint16_t nrOfValues = 0u;
+        for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+            const DATA_POSITION_s *const kpkPosition =
+                &data_kCellBlockPosition[(s * BS_NR_OF_CELL_BLOCKS_PER_STRING) + c];
+            const uint8_t m  = kpkPosition->moduleNumber;
+            const uint8_t cb = kpkPosition->number;
+            if ((pCellVoltages->invalidCellVoltage[s][m] & (1uLL << cb)) == 0uLL) {
+                pl_values[nrOfValues] = pCellVoltages->cellVoltage_mV[s][m][cb];
+                nrOfValues++;
+            }
+        }
+
         STD_RETURN_TYPE_e plausibilityIssueDetected = STD_OK;
-        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
-            for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                /* Only do check for valid voltages */
-                if ((pCellVoltages->invalidCellVoltage[s][m] & (0x01uLL << cb)) == 0uLL) {
-                    if (abs(pCellVoltages->cellVoltage_mV[s][m][cb] - pMinMaxAverageValues->averageCellVoltage_mV[s]) >
-                        PL_CELL_VOLTAGE_SPREAD_TOLERANCE_mV) {
-                        /* Voltage difference too large */
-                        plausibilityIssueDetected = STD_NOT_OK;
-                        retval                    = STD_NOT_OK;
-                        /* Set this cell voltage invalid */
-                        pCellVoltages->invalidCellVoltage[s][m] |= (0x01u << cb);
-                    }
+        if (nrOfValues > 0u) {
+            const int32_t median_mV = PL_GetMedian(pl_values, nrOfValues);
+            /* second pass: invalidate the cell voltages that deviate too much from the median */
+            for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+                const DATA_POSITION_s *const kpkPosition =
+                    &data_kCellBlockPosition[(s * BS_NR_OF_CELL_BLOCKS_PER_STRING) + c];
+                const uint8_t m  = kpkPosition->moduleNumber;
+                const uint8_t cb = kpkPosition->number;
+                if ((abs((int32_t)pCellVoltages->cellVoltage_mV[s][m][cb] - median_mV) >
+                     PL_CELL_VOLTAGE_SPREAD_TOLERANCE_mV) &&
+                    ((pCellVoltages->invalidCellVoltage[s][m] & (1uLL << cb)) == 0uLL)) {
+                    /* Voltage difference too large */
+                    plausibilityIssueDetected = STD_NOT_OK;
+                    retval                    = STD_NOT_OK;
+                    /* Set this cell voltage invalid */
+                    pCellVoltages->invalidCellVoltage[s][m] |= (1uLL << cb);
                 }
             }
         }
+        const uint16_t nrInvalidCellVoltages = MATH_CountSetBitsInBitmap(
+            pCellVoltages->invalidCellVoltage[s], BS_NR_OF_MODULES_PER_STRING, DATA_CELL_VOLTAGE_BITMAP_MASK);
+        pCellVoltages->nrValidCellVoltages[s] = (uint16_t)(BS_NR_OF_CELL_BLOCKS_PER_STRING - nrInvalidCellVoltages);
         DIAG_CheckEvent(plausibilityIssueDetected, DIAG_ID_PLAUSIBILITY_CELL_VOLTAGE_SPREAD, DIAG_STRING, s);
     }
     return retval;
 }
 
-extern STD_RETURN_TYPE_e PL_CheckTemperatureSpread(
-    DATA_BLOCK_CELL_TEMPERATURE_s *pCellTemperatures,
-    DATA_BLOCK_MIN_MAX_s *pMinMaxAverageValues) {
+extern STD_RETURN_TYPE_e PL_CheckTemperatureSpread(DATA_BLOCK_CELL_TEMPERATURE_s *pCellTemperatures) {
     /* Pointer validity check */
     FAS_ASSERT(pCellTemperatures != NULL_PTR);
-    FAS_ASSERT(pMinMaxAverageValues != NULL_PTR);
 
     STD_RETURN_TYPE_e retval = STD_OK;
 
-    /* Iterate over all cells */
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        /* first pass: collect the valid cell temperatures of the string */
+        uint16_t nrOfValues = 0u;
+        for (uint16_t i = 0u; i < BS_NR_OF_TEMP_SENSORS_PER_STRING; i++) {
+            const DATA_POSITION_s *const kpkPosition =
+                &data_kTemperatureSensorPosition[(s * BS_NR_OF_TEMP_SENSORS_PER_STRING) + i];
+            const uint8_t m  = kpkPosition->moduleNumber;
+            const uint8_t ts = kpkPosition->number;
+            if ((pCellTemperatures->invalidCellTemperature[s][m] & (1u << ts)) == 0u) {
+                pl_values[nrOfValues] = pCellTemperatures->cellTemperature_ddegC[s][m][ts];
+                nrOfValues++;
+            }
+        }
+
         STD_RETURN_TYPE_e plausibilityIssueDetected = STD_OK;
-        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
-            for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
-                /* Only do check for valid temperatures */
-                if ((pCellTemperatures->invalidCellTemperature[s][m] & (0x01u << ts)) == 0) {
-                    if (abs(pCellTemperatures->cellTemperature_ddegC[s][m][ts] -
-                            (int16_t)pMinMaxAverageValues->averageTemperature_ddegC[s]) >
-                        PL_CELL_TEMPERATURE_SPREAD_TOLERANCE_dK) {
-                        /* temperature difference too large */
-                        plausibilityIssueDetected = STD_NOT_OK;
-                        retval                    = STD_NOT_OK;
-                        /* Set this cell temperature invalid */
-                        pCellTemperatures->invalidCellTemperature[s][m] |= (0x01u << ts);
-                    } else {
-                        pCellTemperatures->nrValidTemperatures[s]++;
-                    }
+        if (nrOfValues > 0u) {
+            const int32_t median_ddegC = PL_GetMedian(pl_values, nrOfValues);
+            /* second pass: invalidate the cell temperatures that deviate too much from the median */
+            for (uint16_t i = 0u; i < BS_NR_OF_TEMP_SENSORS_PER_STRING; i++) {
+                const DATA_POSITION_s *const kpkPosition =
+                    &data_kTemperatureSensorPosition[(s * BS_NR_OF_TEMP_SENSORS_PER_STRING) + i];
+                const uint8_t m  = kpkPosition->moduleNumber;
+                const uint8_t ts = kpkPosition->number;
+                if ((abs((int32_t)pCellTemperatures->cellTemperature_ddegC[s][m][ts] - median_ddegC) >
+                     PL_CELL_TEMPERATURE_SPREAD_TOLERANCE_dK) &&
+                    ((pCellTemperatures->invalidCellTemperature[s][m] & (1u << ts)) == 0u)) {
+                    /* temperature difference too large */
+                    plausibilityIssueDetected = STD_NOT_OK;
+                    retval                    = STD_NOT_OK;
+                    /* Set this cell temperature invalid */
+                    pCellTemperatures->invalidCellTemperature[s][m] |= (uint16_t)(1u << ts);
                 }
             }
         }
+        uint16_t nrInvalidTemperatures = 0u;
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            nrInvalidTemperatures += MATH_CountSetBitsUint64_t(
+                pCellTemperatures->invalidCellTemperature[s][m] & DATA_CELL_TEMPERATURE_BITMAP_MASK);
+        }
+        pCellTemperatures->nrValidTemperatures[s] =
+            (uint16_t)(BS_NR_OF_TEMP_SENSORS_PER_STRING - nrInvalidTemperatures);
         DIAG_CheckEvent(plausibilityIssueDetected, DIAG_ID_PLAUSIBILITY_CELL_TEMPERATURE_SPREAD, DIAG_STRING, s);
     }
     return retval;
@@ -191,4 +307,7 @@ extern STD_RETURN_TYPE_e PL_CheckTemperatureSpread(
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
+extern int32_t TEST_PL_GetMedian(int16_t *pValues, uint16_t nrOfValues) {
+    return PL_GetMedian(pValues, nrOfValues);
+}
 #endif
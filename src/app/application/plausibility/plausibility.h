@@ -43,7 +43,7 @@
  * @file    plausibility.h
  * @author  foxBMS Team
  * @date    2020-02-24 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup APPLICATION
  * @prefix  PL
@@ -79,6 +79,7 @@ extern STD_RETURN_TYPE_e PL_CheckStringVoltage(int32_t voltageAfe_mV, int32_t vo
 
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
+extern int32_t TEST_PL_GetMedian(int16_t *pValues, uint16_t nrOfValues);
 #endif
 
 /**
@@ -111,26 +112,28 @@ extern STD_RETURN_TYPE_e PL_CheckCelltemperature(
 
 /**
  * @brief  Cell voltage spread plausibility check
+ * @details Sets the cell voltages that deviate too much from the median of
+ *          the valid cell voltages of their string invalid and recounts the
+ *          number of valid cell voltages. Unlike the average, the median is
+ *          not pulled by a few faulty measurements, so that these do not
+ *          invalidate the correct ones.
  *
  * @param[in,out]  pCellVoltages     pointer to cell voltage database entry
- * @param[in]  pMinMaxAverageValues  pointer to minimum/maximum/average database entry
  *
  * @return #STD_OK if no issue detected, otherwise #STD_NOT_OK
  */
-extern STD_RETURN_TYPE_e PL_CheckVoltageSpread(
-    DATA_BLOCK_CELL_VOLTAGE_s *pCellVoltages,
-    DATA_BLOCK_MIN_MAX_s *pMinMaxAverageValues);
+extern STD_RETURN_TYPE_e PL_CheckVoltageSpread(DATA_BLOCK_CELL_VOLTAGE_s *pCellVoltages);
 
 /**
  * @brief  Cell temperature spread plausibility check
+ * @details Sets the cell temperatures that deviate too much from the median
+ *          of the valid cell temperatures of their string invalid and
+ *          recounts the number of valid cell temperatures.
  *
  * @param[in,out]  pCellTemperatures pointer to cell temperature database entry
- * @param[in]  pMinMaxAverageValues  pointer to minimum/maximum/average database entry
  *
  * @return #STD_OK if no issue detected, otherwise #STD_NOT_OK
  */
-extern STD_RETURN_TYPE_e PL_CheckTemperatureSpread(
-    DATA_BLOCK_CELL_TEMPERATURE_s *pCellTemperatures,
-    DATA_BLOCK_MIN_MAX_s *pMinMaxAverageValues);
+extern STD_RETURN_TYPE_e PL_CheckTemperatureSpread(DATA_BLOCK_CELL_TEMPERATURE_s *pCellTemperatures);
 
 #endif /* FOXBMS__PLAUSIBILITY_H_ */
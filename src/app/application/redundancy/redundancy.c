@@ -43,7 +43,7 @@
  * @file    redundancy.c
  * @author  foxBMS Team
  * @date    2020-07-31 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup APPLICATION
  * @prefix  MRC
@@ -387,14 +387,11 @@ static bool MRC_ValidateCellVoltageMeasurement(
     }
 
     if (updatedValidatedVoltageDatbaseEntry == true) {
-        /* Calculate min/max/average cell voltages */
-        MRC_CalculateCellVoltageMinMaxAverage(&mrc_tableCellVoltages, &mrc_tableMinimumMaximumValues);
+        /* Individual cell voltages validated -> check voltage spread against the median of each string */
+        (void)PL_CheckVoltageSpread(&mrc_tableCellVoltages);
 
-        /* Individual cell voltages validated and min/max/average calculated -> check voltage spread */
-        if (STD_NOT_OK == PL_CheckVoltageSpread(&mrc_tableCellVoltages, &mrc_tableMinimumMaximumValues)) {
-            /* Recalculate min/max/average cell voltages as at least one cell voltage has been detected as invalid */
-            MRC_CalculateCellVoltageMinMaxAverage(&mrc_tableCellVoltages, &mrc_tableMinimumMaximumValues);
-        }
+        /* Calculate min/max/average of the remaining valid cell voltages */
+        MRC_CalculateCellVoltageMinMaxAverage(&mrc_tableCellVoltages, &mrc_tableMinimumMaximumValues);
     }
 
     return updatedValidatedVoltageDatbaseEntry;
@@ -513,14 +510,11 @@ static bool MRC_ValidateCellTemperatureMeasurement(
     }
 
     if (updatedValidatedTemperatureDatbaseEntry == true) {
-        /* Calculate min/max/average cell temperatures */
-        MRC_CalculateCellTemperatureMinMaxAverage(&mrc_tableCellTemperatures, &mrc_tableMinimumMaximumValues);
+        /* Individual cell temperatures validated -> check temperature spread against the median of each string */
+        (void)PL_CheckTemperatureSpread(&mrc_tableCellTemperatures);
 
-        /* Individual cell temperatures validated and min/max/average calculated -> check temperature spread */
-        if (STD_NOT_OK == PL_CheckTemperatureSpread(&mrc_tableCellTemperatures, &mrc_tableMinimumMaximumValues)) {
-            /* Recalculate min/max/average temperatures as at least one temperature has been detected as invalid */
-            MRC_CalculateCellTemperatureMinMaxAverage(&mrc_tableCellTemperatures, &mrc_tableMinimumMaximumValues);
-        }
+        /* Calculate min/max/average of the remaining valid cell temperatures */
+        MRC_CalculateCellTemperatureMinMaxAverage(&mrc_tableCellTemperatures, &mrc_tableMinimumMaximumValues);
     }
 
     return updatedValidatedTemperatureDatbaseEntry;
@@ -899,49 +893,50 @@ static STD_RETURN_TYPE_e MRC_ValidateCellVoltage(
     FAS_ASSERT(pCellVoltageRedundancy0 != NULL_PTR);
     FAS_ASSERT(pValidatedVoltages != NULL_PTR);
 
-    uint16_t numberValidMeasurements              = 0u;
     STD_RETURN_TYPE_e noPlausibilityIssueDetected = STD_OK; /* Flag if implausible value detected */
     STD_RETURN_TYPE_e retval                      = STD_OK;
 
     /* Iterate over all cell measurements */
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
-        int32_t sum = 0;
+        int32_t sum                                              = 0;
+        uint64_t invalidMeasurement[BS_NR_OF_MODULES_PER_STRING] = {0u};
+        /* A cell voltage is invalid if base AND redundant measurement value are invalid. Cell voltages that are valid
+         * in both measurements are additionally set invalid below if the plausibility check fails. */
+        MATH_AndBitmaps(
+            pCellVoltageBase->invalidCellVoltage[s],
+            pCellVoltageRedundancy0->invalidCellVoltage[s],
+            pValidatedVoltages->invalidCellVoltage[s],
+            BS_NR_OF_MODULES_PER_STRING);
+        /* Cell voltages that are invalid in at least one measurement skip the plausibility check */
+        MATH_OrBitmaps(
+            pCellVoltageBase->invalidCellVoltage[s],
+            pCellVoltageRedundancy0->invalidCellVoltage[s],
+            invalidMeasurement,
+            BS_NR_OF_MODULES_PER_STRING);
         for (uint8_t m = 0; m < BS_NR_OF_MODULES_PER_STRING; m++) {
             for (uint8_t cb = 0; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-                if (((pCellVoltageBase->invalidCellVoltage[s][m] & (1u << cb)) == 0u) &&
-                    ((pCellVoltageRedundancy0->invalidCellVoltage[s][m] & (1u << cb)) == 0u)) {
+                const uint64_t cellBlock = (uint64_t)1u << cb;
+                if ((invalidMeasurement[m] & cellBlock) == 0u) {
                     /* Check if cell voltage of base AND redundant measurement is valid -> do plausibility check */
                     if (STD_OK == PL_CheckCellVoltage(
                                       pCellVoltageBase->cellVoltage_mV[s][m][cb],
                                       pCellVoltageRedundancy0->cellVoltage_mV[s][m][cb],
                                       &pValidatedVoltages->cellVoltage_mV[s][m][cb])) {
-                        /* Clear valid flag */
-                        pValidatedVoltages->invalidCellVoltage[s][m] = pValidatedVoltages->invalidCellVoltage[s][m] &
-                                                                       (~(1u << cb));
-                        numberValidMeasurements++;
                         sum += pValidatedVoltages->cellVoltage_mV[s][m][cb];
                     } else {
                         /* Set invalid flag */
                         noPlausibilityIssueDetected = STD_NOT_OK;
-                        pValidatedVoltages->invalidCellVoltage[s][m] |= (1u << cb);
+                        pValidatedVoltages->invalidCellVoltage[s][m] |= cellBlock;
                         /* Set return value to #STD_NOT_OK as not all cell voltages have a valid measurement value */
                         retval = STD_NOT_OK;
                     }
-                } else if ((pCellVoltageBase->invalidCellVoltage[s][m] & (1u << cb)) == 0u) {
+                } else if ((pCellVoltageBase->invalidCellVoltage[s][m] & cellBlock) == 0u) {
                     /* Only base measurement value is valid -> use this voltage without further plausibility checks */
                     pValidatedVoltages->cellVoltage_mV[s][m][cb] = pCellVoltageBase->cellVoltage_mV[s][m][cb];
-                    /* Reset valid flag */
-                    pValidatedVoltages->invalidCellVoltage[s][m] = pValidatedVoltages->invalidCellVoltage[s][m] &
-                                                                   (~(1u << cb));
-                    numberValidMeasurements++;
                     sum += pValidatedVoltages->cellVoltage_mV[s][m][cb];
-                } else if ((pCellVoltageRedundancy0->invalidCellVoltage[s][m] & (1u << cb)) == 0u) {
+                } else if ((pCellVoltageRedundancy0->invalidCellVoltage[s][m] & cellBlock) == 0u) {
                     /* Only redundant measurement value is valid -> use this voltage without further plausibility checks */
                     pValidatedVoltages->cellVoltage_mV[s][m][cb] = pCellVoltageRedundancy0->cellVoltage_mV[s][m][cb];
-                    /* Reset valid flag */
-                    pValidatedVoltages->invalidCellVoltage[s][m] = pValidatedVoltages->invalidCellVoltage[s][m] &
-                                                                   (~(1u << cb));
-                    numberValidMeasurements++;
                     sum += pValidatedVoltages->cellVoltage_mV[s][m][cb];
                 } else {
                     /* Both, base and redundant measurement value are invalid */
@@ -949,16 +944,16 @@ static STD_RETURN_TYPE_e MRC_ValidateCellVoltage(
                     pValidatedVoltages->cellVoltage_mV[s][m][cb] = (pCellVoltageBase->cellVoltage_mV[s][m][cb] +
                                                                     pCellVoltageRedundancy0->cellVoltage_mV[s][m][cb]) /
                                                                    2;
-                    /* Set invalid flag */
-                    pValidatedVoltages->invalidCellVoltage[s][m] |= (1u << cb);
                     /* Set return value to #STD_NOT_OK as not all cell voltages have a valid measurement value */
                     retval = STD_NOT_OK;
                 }
             }
         }
-        pValidatedVoltages->nrValidCellVoltages[s] = numberValidMeasurements;
-        pValidatedVoltages->stringVoltage_mV[s]    = sum;
-        numberValidMeasurements                    = 0u; /* Reset counter for next string */
+        const uint16_t numberInvalidMeasurements = MATH_CountSetBitsInBitmap(
+            pValidatedVoltages->invalidCellVoltage[s], BS_NR_OF_MODULES_PER_STRING, DATA_CELL_VOLTAGE_BITMAP_MASK);
+        pValidatedVoltages->nrValidCellVoltages[s] =
+            (uint16_t)(BS_NR_OF_CELL_BLOCKS_PER_STRING - numberInvalidMeasurements);
+        pValidatedVoltages->stringVoltage_mV[s] = sum;
 
         (void)DIAG_CheckEvent(noPlausibilityIssueDetected, DIAG_ID_PLAUSIBILITY_CELL_VOLTAGE, DIAG_STRING, s);
         noPlausibilityIssueDetected = STD_OK; /* Reset flag for next string */
@@ -992,48 +987,41 @@ static STD_RETURN_TYPE_e MRC_ValidateCellTemperature(
     FAS_ASSERT(pCelltemperatureRedundancy0 != NULL_PTR);
     FAS_ASSERT(pValidatedTemperatures != NULL_PTR);
 
-    uint16_t numberValidMeasurements              = 0u;
     STD_RETURN_TYPE_e noPlausibilityIssueDetected = STD_OK; /* Flag if implausible value detected */
     STD_RETURN_TYPE_e retval                      = STD_OK;
 
     /* Iterate over all cell measurements */
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        uint16_t numberInvalidMeasurements = 0u;
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            const uint16_t invalidBase       = pCelltemperatureBase->invalidCellTemperature[s][m];
+            const uint16_t invalidRedundancy = pCelltemperatureRedundancy0->invalidCellTemperature[s][m];
+            /* A cell temperature is invalid if base AND redundant measurement value are invalid. Cell temperatures
+             * that are valid in both measurements are additionally set invalid below if the plausibility check
+             * fails. */
+            pValidatedTemperatures->invalidCellTemperature[s][m] = invalidBase & invalidRedundancy;
             for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
-                if (((pCelltemperatureBase->invalidCellTemperature[s][m] & (1u << ts)) == 0u) &&
-                    ((pCelltemperatureRedundancy0->invalidCellTemperature[s][m] & (1u << ts)) == 0u)) {
+                const uint16_t sensor = (uint16_t)(1u << ts);
+                if (((invalidBase | invalidRedundancy) & sensor) == 0u) {
                     /* Check if cell voltage of base AND redundant measurement is valid -> do plausibility check */
-                    if (STD_OK == PL_CheckCelltemperature(
+                    if (STD_OK != PL_CheckCelltemperature(
                                       pCelltemperatureBase->cellTemperature_ddegC[s][m][ts],
                                       pCelltemperatureRedundancy0->cellTemperature_ddegC[s][m][ts],
                                       &pValidatedTemperatures->cellTemperature_ddegC[s][m][ts])) {
-                        /* Clear valid flag */
-                        pValidatedTemperatures->invalidCellTemperature[s][m] =
-                            pValidatedTemperatures->invalidCellTemperature[s][m] & (~(1u << ts));
-                        numberValidMeasurements++;
-                    } else {
                         /* Set invalid flag */
                         noPlausibilityIssueDetected = STD_NOT_OK;
-                        pValidatedTemperatures->invalidCellTemperature[s][m] |= (1u << ts);
+                        pValidatedTemperatures->invalidCellTemperature[s][m] |= sensor;
                         /* Set return value to #STD_NOT_OK as not all cell temperatures have a valid measurement value */
                         retval = STD_NOT_OK;
                     }
-                } else if ((pCelltemperatureBase->invalidCellTemperature[s][m] & (1u << ts)) == 0u) {
+                } else if ((invalidBase & sensor) == 0u) {
                     /* Only base measurement value is valid -> use this temperature without further plausibility checks */
                     pValidatedTemperatures->cellTemperature_ddegC[s][m][ts] =
                         pCelltemperatureBase->cellTemperature_ddegC[s][m][ts];
-                    /* Reset valid flag */
-                    pValidatedTemperatures->invalidCellTemperature[s][m] =
-                        pValidatedTemperatures->invalidCellTemperature[s][m] & (~(1u << ts));
-                    numberValidMeasurements++;
-                } else if ((pCelltemperatureRedundancy0->invalidCellTemperature[s][m] & (1u << ts)) == 0u) {
+                } else if ((invalidRedundancy & sensor) == 0u) {
                     /* Only redundant measurement value is valid -> use this temperature without further plausibility checks */
                     pValidatedTemperatures->cellTemperature_ddegC[s][m][ts] =
                         pCelltemperatureRedundancy0->cellTemperature_ddegC[s][m][ts];
-                    /* Reset valid flag */
-                    pValidatedTemperatures->invalidCellTemperature[s][m] =
-                        pValidatedTemperatures->invalidCellTemperature[s][m] & (~(1u << ts));
-                    numberValidMeasurements++;
                 } else {
                     /* Both, base and redundant measurement value are invalid */
                     /* Save average cell voltage value of base and redundant */
@@ -1041,15 +1029,15 @@ static STD_RETURN_TYPE_e MRC_ValidateCellTemperature(
                         (pCelltemperatureBase->cellTemperature_ddegC[s][m][ts] +
                          pCelltemperatureRedundancy0->cellTemperature_ddegC[s][m][ts]) /
                         2u;
-                    /* Set invalid flag */
-                    pValidatedTemperatures->invalidCellTemperature[s][m] |= (1u << ts);
                     /* Set return value to #STD_NOT_OK as not all cell temperatures have a valid measurement value */
                     retval = STD_NOT_OK;
                 }
             }
+            numberInvalidMeasurements += MATH_CountSetBitsUint64_t(
+                pValidatedTemperatures->invalidCellTemperature[s][m] & DATA_CELL_TEMPERATURE_BITMAP_MASK);
         }
-        pValidatedTemperatures->nrValidTemperatures[s] = numberValidMeasurements;
-        numberValidMeasurements                        = 0u; /* Reset counter for next string */
+        pValidatedTemperatures->nrValidTemperatures[s] =
+            (uint16_t)(BS_NR_OF_TEMP_SENSORS_PER_STRING - numberInvalidMeasurements);
 
         (void)DIAG_CheckEvent(noPlausibilityIssueDetected, DIAG_ID_PLAUSIBILITY_CELL_TEMP, DIAG_STRING, s);
         noPlausibilityIssueDetected = STD_OK; /* Reset flag for next string */
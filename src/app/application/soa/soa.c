@@ -43,7 +43,7 @@
  * @file    soa.c
  * @author  foxBMS Team
  * @date    2020-10-14 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup APPLICATION
  * @prefix  SOA
@@ -65,84 +65,346 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 /*========== Macros and Definitions =========================================*/
+/** direction in which the limits of a threshold set are violated */
+typedef enum {
+    SOA_UPPER_LIMITS, /*!< a limit is violated if the value is greater than or equal to the limit */
+    SOA_LOWER_LIMITS, /*!< a limit is violated if the value is less than or equal to the limit */
+} SOA_LIMIT_DIRECTION_e;
+
+/** limit of a value and the diagnosis entry that reports its violation */
+typedef struct {
+    int32_t value;    /*!< limit */
+    DIAG_ID_e diagId; /*!< diagnosis entry that reports the violation of the limit */
+} SOA_LIMIT_s;
+
+/** limits of a value in the order of #SOA_LIMIT_e */
+typedef struct {
+    SOA_LIMIT_DIRECTION_e direction;    /*!< direction in which the limits are violated */
+    SOA_LIMIT_s limit[SOA_LIMIT_E_MAX]; /*!< limits in the order of #SOA_LIMIT_e */
+} SOA_THRESHOLD_SET_s;
+
+/** number of events that are reported per string by #SOA_CheckVoltages and #SOA_CheckTemperatures */
+#define SOA_NR_OF_EVENTS_PER_STRING (2u * (uint8_t)SOA_LIMIT_E_MAX)
+
+/** maximum number of values per module that fit into the bitmasks of #SOA_CELL_VIOLATIONS_s */
+#define SOA_MAXIMUM_NR_OF_VALUES_PER_MODULE (64u)
+
+FAS_STATIC_ASSERT(
+    (BS_NR_OF_CELL_BLOCKS_PER_MODULE <= SOA_MAXIMUM_NR_OF_VALUES_PER_MODULE),
+    "The per-cell check assumes that the cell blocks of a module fit into an uint64_t bitmask");
+FAS_STATIC_ASSERT(
+    (BS_NR_OF_TEMP_SENSORS_PER_MODULE <= SOA_MAXIMUM_NR_OF_VALUES_PER_MODULE),
+    "The per-cell check assumes that the temperature sensors of a module fit into an uint64_t bitmask");
+
+/** number of events that are reported per string by #SOA_CheckCurrent */
+#define SOA_NR_OF_CURRENT_EVENTS_PER_STRING (5u)
 
 /*========== Static Constant and Variable Definitions =======================*/
+/** true if a cell voltage violated a maximum operating limit in the last check */
+static bool soa_voltageOperatingLimitViolated = false;
+
+/** true if a cell temperature violated a maximum operating limit in the last check */
+static bool soa_temperatureOperatingLimitViolated = false;
+
+/** per-cell violations of the cell voltages of the last call of #SOA_CheckCellVoltages */
+static SOA_CELL_VIOLATIONS_s soa_cellVoltageViolations[BS_NR_OF_STRINGS] = {0};
+
+/** per-cell violations of the cell temperatures of the last call of #SOA_CheckCellTemperatures */
+static SOA_CELL_VIOLATIONS_s soa_cellTemperatureViolations[BS_NR_OF_STRINGS] = {0};
+
+/** true if #soa_cellTemperatureViolations of a string have been classified against the discharge limits */
+static bool soa_isCellTemperatureDischarging[BS_NR_OF_STRINGS] = {GEN_REPEAT_U(false, GEN_STRIP(BS_NR_OF_STRINGS))};
+
+/**@{*/
+/** limits of the cell voltages and cell temperatures */
+/* clang-format off */
+static const SOA_THRESHOLD_SET_s soa_kOvervoltage = {
+    .direction = SOA_UPPER_LIMITS,
+    .limit     = {{BC_VOLTAGE_MAX_MOL_mV, DIAG_ID_CELL_VOLTAGE_OVERVOLTAGE_MOL},
+                  {BC_VOLTAGE_MAX_RSL_mV, DIAG_ID_CELL_VOLTAGE_OVERVOLTAGE_RSL},
+                  {BC_VOLTAGE_MAX_MSL_mV, DIAG_ID_CELL_VOLTAGE_OVERVOLTAGE_MSL}},
+};
+static const SOA_THRESHOLD_SET_s soa_kUndervoltage = {
+    .direction = SOA_LOWER_LIMITS,
+    .limit     = {{BC_VOLTAGE_MIN_MOL_mV, DIAG_ID_CELL_VOLTAGE_UNDERVOLTAGE_MOL},
+                  {BC_VOLTAGE_MIN_RSL_mV, DIAG_ID_CELL_VOLTAGE_UNDERVOLTAGE_RSL},
+                  {BC_VOLTAGE_MIN_MSL_mV, DIAG_ID_CELL_VOLTAGE_UNDERVOLTAGE_MSL}},
+};
+static const SOA_THRESHOLD_SET_s soa_kOvertemperatureCharge = {
+    .direction = SOA_UPPER_LIMITS,
+    .limit     = {{BC_TEMPERATURE_MAX_CHARGE_MOL_ddegC, DIAG_ID_TEMP_OVERTEMPERATURE_CHARGE_MOL},
+                  {BC_TEMPERATURE_MAX_CHARGE_RSL_ddegC, DIAG_ID_TEMP_OVERTEMPERATURE_CHARGE_RSL},
+                  {BC_TEMPERATURE_MAX_CHARGE_MSL_ddegC, DIAG_ID_TEMP_OVERTEMPERATURE_CHARGE_MSL}},
+};
+static const SOA_THRESHOLD_SET_s soa_kOvertemperatureDischarge = {
+    .direction = SOA_UPPER_LIMITS,
+    .limit     = {{BC_TEMPERATURE_MAX_DISCHARGE_MOL_ddegC, DIAG_ID_TEMP_OVERTEMPERATURE_DISCHARGE_MOL},
+                  {BC_TEMPERATURE_MAX_DISCHARGE_RSL_ddegC, DIAG_ID_TEMP_OVERTEMPERATURE_DISCHARGE_RSL},
+                  {BC_TEMPERATURE_MAX_DISCHARGE_MSL_ddegC, DIAG_ID_TEMP_OVERTEMPERATURE_DISCHARGE_MSL}},
+};
+static const SOA_THRESHOLD_SET_s soa_kUndertemperatureCharge = {
+    .direction = SOA_LOWER_LIMITS,
+    .limit     = {{BC_TEMPERATURE_MIN_CHARGE_MOL_ddegC, DIAG_ID_TEMP_UNDERTEMPERATURE_CHARGE_MOL},
+                  {BC_TEMPERATURE_MIN_CHARGE_RSL_ddegC, DIAG_ID_TEMP_UNDERTEMPERATURE_CHARGE_RSL},
+                  {BC_TEMPERATURE_MIN_CHARGE_MSL_ddegC, DIAG_ID_TEMP_UNDERTEMPERATURE_CHARGE_MSL}},
+};
+static const SOA_THRESHOLD_SET_s soa_kUndertemperatureDischarge = {
+    .direction = SOA_LOWER_LIMITS,
+    .limit     = {{BC_TEMPERATURE_MIN_DISCHARGE_MOL_ddegC, DIAG_ID_TEMP_UNDERTEMPERATURE_DISCHARGE_MOL},
+                  {BC_TEMPERATURE_MIN_DISCHARGE_RSL_ddegC, DIAG_ID_TEMP_UNDERTEMPERATURE_DISCHARGE_RSL},
+                  {BC_TEMPERATURE_MIN_DISCHARGE_MSL_ddegC, DIAG_ID_TEMP_UNDERTEMPERATURE_DISCHARGE_MSL}},
+};
+/* clang-format on */
+/**@}*/
 
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   classifies a value against the limits of a threshold set
+ * @details Appends one event per limit in the order of #SOA_LIMIT_e to the
+ *          passed events: #DIAG_EVENT_NOT_OK if the limit is violated,
+ *          otherwise #DIAG_EVENT_OK.
+ * @param   kpkThresholdSet threshold set the value is classified against
+ * @param   value           value that is classified
+ * @param   pEvents         events the classification is appended to
+ * @param   capacity        number of events that fit into pEvents
+ * @param   pNrOfEvents     number of events in pEvents, is incremented
+ */
+static void SOA_ClassifyValue(
+    const SOA_THRESHOLD_SET_s *const kpkThresholdSet,
+    int32_t value,
+    DIAG_BATCH_EVENT_s *pEvents,
+    uint8_t capacity,
+    uint8_t *pNrOfEvents);
+
+/**
+ * @brief   appends an event of a diagnosis entry to the passed events
+ * @param   pEvents     events the event is appended to
+ * @param   capacity    number of events that fit into pEvents
+ * @param   pNrOfEvents number of events in pEvents, is incremented
+ * @param   diagId      #DIAG_ID_e of the event
+ * @param   isViolated  true if the limit is violated (#DIAG_EVENT_NOT_OK),
+ *                      otherwise #DIAG_EVENT_OK
+ */
+static void SOA_AddEvent(
+    DIAG_BATCH_EVENT_s *pEvents,
+    uint8_t capacity,
+    uint8_t *pNrOfEvents,
+    DIAG_ID_e diagId,
+    bool isViolated);
+
+/**
+ * @brief   classifies the values of a module against the limits of a
+ *          threshold set
+ * @details Lower limits are turned into upper limits by negating the values
+ *          and the limits, so that all limits are checked by the same loop.
+ *          The loop has neither branches nor an early exit and runs over
+ *          contiguous values, which allows the compiler to unroll and
+ *          vectorize it.
+ * @param   kpkThresholdSet threshold set the values are classified against
+ * @param   kpkValues       values of the module
+ * @param   nrOfValues      number of values of the module
+ * @param   invalidValues   bitmask of the invalid values of the module
+ * @param   hysteresis      hysteresis by which a value has to recover until
+ *                          a violated limit is released
+ * @param   pViolations     bitmasks of the violations of the module in the
+ *                          order of #SOA_LIMIT_e, the bitmasks of the last
+ *                          check are used for the hysteresis
+ */
+static void SOA_ClassifyModule(
+    const SOA_THRESHOLD_SET_s *const kpkThresholdSet,
+    const int16_t *const kpkValues,
+    uint8_t nrOfValues,
+    uint64_t invalidValues,
+    int32_t hysteresis,
+    uint64_t *pViolations);
+
+/**
+ * @brief   counts the per-cell violations of a string and appends the
+ *          events of the upper and lower limits to the passed events
+ * @details A limit is violated if at least one cell of the string violates
+ *          it.
+ * @param   kpkUpperLimits  threshold set of the upper limits
+ * @param   kpkLowerLimits  threshold set of the lower limits
+ * @param   pViolations     per-cell violations of the string, the number of
+ *                          violations is updated
+ * @param   pEvents         events the classification is appended to
+ * @param   capacity        number of events that fit into pEvents
+ * @param   pNrOfEvents     number of events in pEvents, is incremented
+ */
+static void SOA_AddCellViolationEvents(
+    const SOA_THRESHOLD_SET_s *const kpkUpperLimits,
+    const SOA_THRESHOLD_SET_s *const kpkLowerLimits,
+    SOA_CELL_VIOLATIONS_s *pViolations,
+    DIAG_BATCH_EVENT_s *pEvents,
+    uint8_t capacity,
+    uint8_t *pNrOfEvents);
+
+/**
+ * @brief   checks if a valid cell voltage of a string is at or below the
+ *          deep-discharge voltage
+ * @param   kpkCellVoltages database entry with the cell voltages
+ * @param   stringNumber    string that is checked
+ * @return  true if a cell is deep-discharged, otherwise false
+ */
+static bool SOA_IsCellDeepDischarged(const DATA_BLOCK_CELL_VOLTAGE_s *const kpkCellVoltages, uint8_t stringNumber);
 
 /*========== Static Function Implementations ================================*/
+static void SOA_ClassifyValue(
+    const SOA_THRESHOLD_SET_s *const kpkThresholdSet,
+    int32_t value,
+    DIAG_BATCH_EVENT_s *pEvents,
+    uint8_t capacity,
+    uint8_t *pNrOfEvents) {
+    FAS_ASSERT(kpkThresholdSet != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: value: parameter accepts whole range */
+    FAS_ASSERT(pEvents != NULL_PTR);
+    FAS_ASSERT(pNrOfEvents != NULL_PTR);
+    for (uint8_t limit = 0u; limit < (uint8_t)SOA_LIMIT_E_MAX; limit++) {
+        bool isViolated = false;
+        if (kpkThresholdSet->direction == SOA_UPPER_LIMITS) {
+            isViolated = (value >= kpkThresholdSet->limit[limit].value);
+        } else {
+            isViolated = (value <= kpkThresholdSet->limit[limit].value);
+        }
+        SOA_AddEvent(pEvents, capacity, pNrOfEvents, kpkThresholdSet->limit[limit].diagId, isViolated);
+    }
+}
+
+static void SOA_AddEvent(
+    DIAG_BATCH_EVENT_s *pEvents,
+    uint8_t capacity,
+    uint8_t *pNrOfEvents,
+    DIAG_ID_e diagId,
+    bool isViolated) {
+    FAS_ASSERT(pEvents != NULL_PTR);
+    FAS_ASSERT(pNrOfEvents != NULL_PTR);
+    FAS_ASSERT(*pNrOfEvents < capacity);
+    FAS_ASSERT(diagId < DIAG_ID_MAX);
+    /* AXIVION Routine Generic-MissingParameterAssert: isViolated: parameter accepts whole range */
+    DIAG_BATCH_EVENT_s *pEvent = &pEvents[*pNrOfEvents];
+    pEvent->diagId             = diagId;
+    pEvent->event              = DIAG_EVENT_OK;
+    pEvent->result             = DIAG_HANDLER_RETURN_UNKNOWN;
+    if (isViolated == true) {
+        pEvent->event = DIAG_EVENT_NOT_OK;
+    }
+    (*pNrOfEvents)++;
+}
+
+static void SOA_ClassifyModule(
+    const SOA_THRESHOLD_SET_s *const kpkThresholdSet,
+    const int16_t *const kpkValues,
+    uint8_t nrOfValues,
+    uint64_t invalidValues,
+    int32_t hysteresis,
+    uint64_t *pViolations) {
+    FAS_ASSERT(kpkThresholdSet != NULL_PTR);
+    FAS_ASSERT(kpkValues != NULL_PTR);
+    FAS_ASSERT(nrOfValues <= SOA_MAXIMUM_NR_OF_VALUES_PER_MODULE);
+    /* AXIVION Routine Generic-MissingParameterAssert: invalidValues: parameter accepts whole range */
+    FAS_ASSERT(hysteresis >= 0);
+    FAS_ASSERT(pViolations != NULL_PTR);
+    int32_t sign = 1;
+    if (kpkThresholdSet->direction == SOA_LOWER_LIMITS) {
+        sign = -1;
+    }
+    for (uint8_t limit = 0u; limit < (uint8_t)SOA_LIMIT_E_MAX; limit++) {
+        const int32_t onset     = sign * kpkThresholdSet->limit[limit].value;
+        const int32_t release   = onset - hysteresis;
+        uint64_t reachedOnset   = 0u;
+        uint64_t reachedRelease = 0u;
+        for (uint8_t i = 0u; i < nrOfValues; i++) {
+            const int32_t value = sign * (int32_t)kpkValues[i];
+            reachedOnset |= (uint64_t)((value >= onset) ? 1u : 0u) << i;
+            reachedRelease |= (uint64_t)((value >= release) ? 1u : 0u) << i;
+        }
+        /* a cell violates the limit if it reaches the limit or if it violated
+         * the limit and has not recovered by more than the hysteresis */
+        pViolations[limit] = (reachedOnset | (pViolations[limit] & reachedRelease)) & ~invalidValues;
+    }
+}
+
+static void SOA_AddCellViolationEvents(
+    const SOA_THRESHOLD_SET_s *const kpkUpperLimits,
+    const SOA_THRESHOLD_SET_s *const kpkLowerLimits,
+    SOA_CELL_VIOLATIONS_s *pViolations,
+    DIAG_BATCH_EVENT_s *pEvents,
+    uint8_t capacity,
+    uint8_t *pNrOfEvents) {
+    FAS_ASSERT(kpkUpperLimits != NULL_PTR);
+    FAS_ASSERT(kpkLowerLimits != NULL_PTR);
+    FAS_ASSERT(pViolations != NULL_PTR);
+    FAS_ASSERT(pEvents != NULL_PTR);
+    FAS_ASSERT(pNrOfEvents != NULL_PTR);
+    for (uint8_t limit = 0u; limit < (uint8_t)SOA_LIMIT_E_MAX; limit++) {
+        uint16_t nrOfUpperLimitViolations = 0u;
+        uint16_t nrOfLowerLimitViolations = 0u;
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            nrOfUpperLimitViolations += MATH_CountSetBitsUint64_t(pViolations->upperLimits[m][limit]);
+            nrOfLowerLimitViolations += MATH_CountSetBitsUint64_t(pViolations->lowerLimits[m][limit]);
+        }
+        pViolations->nrOfUpperLimitViolations[limit] = nrOfUpperLimitViolations;
+        pViolations->nrOfLowerLimitViolations[limit] = nrOfLowerLimitViolations;
+    }
+    for (uint8_t limit = 0u; limit < (uint8_t)SOA_LIMIT_E_MAX; limit++) {
+        const bool isViolated = (pViolations->nrOfUpperLimitViolations[limit] > 0u);
+        SOA_AddEvent(pEvents, capacity, pNrOfEvents, kpkUpperLimits->limit[limit].diagId, isViolated);
+    }
+    for (uint8_t limit = 0u; limit < (uint8_t)SOA_LIMIT_E_MAX; limit++) {
+        const bool isViolated = (pViolations->nrOfLowerLimitViolations[limit] > 0u);
+        SOA_AddEvent(pEvents, capacity, pNrOfEvents, kpkLowerLimits->limit[limit].diagId, isViolated);
+    }
+}
+
+static bool SOA_IsCellDeepDischarged(const DATA_BLOCK_CELL_VOLTAGE_s *const kpkCellVoltages, uint8_t stringNumber) {
+    FAS_ASSERT(kpkCellVoltages != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    uint64_t deepDischargedCells = 0u;
+    for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+        uint64_t reachedDeepDischarge = 0u;
+        for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+            const int16_t voltage_mV = kpkCellVoltages->cellVoltage_mV[stringNumber][m][cb];
+            reachedDeepDischarge |= (uint64_t)((voltage_mV <= BC_VOLTAGE_DEEP_DISCHARGE_mV) ? 1u : 0u) << cb;
+        }
+        deepDischargedCells |= reachedDeepDischarge & ~kpkCellVoltages->invalidCellVoltage[stringNumber][m];
+    }
+    return (deepDischargedCells != 0u);
+}
 
 /*========== Extern Function Implementations ================================*/
 
 extern void SOA_CheckVoltages(DATA_BLOCK_MIN_MAX_s *pMinimumMaximumCellVoltages) {
     FAS_ASSERT(pMinimumMaximumCellVoltages != NULL_PTR);
-    DIAG_RETURNTYPE_e retvalUndervoltMSL = DIAG_HANDLER_RETURN_ERR_OCCURRED;
+    bool operatingLimitViolated = false;
 
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
         int16_t voltageMax_mV = pMinimumMaximumCellVoltages->maximumCellVoltage_mV[s];
         int16_t voltageMin_mV = pMinimumMaximumCellVoltages->minimumCellVoltage_mV[s];
 
-        if (voltageMax_mV >= BC_VOLTAGE_MAX_MOL_mV) {
-            /* Over voltage maximum operating limit violated */
-            DIAG_Handler(DIAG_ID_CELL_VOLTAGE_OVERVOLTAGE_MOL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-            if (voltageMax_mV >= BC_VOLTAGE_MAX_RSL_mV) {
-                /* Over voltage recommended safety limit violated */
-                DIAG_Handler(DIAG_ID_CELL_VOLTAGE_OVERVOLTAGE_RSL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                if (voltageMax_mV >= BC_VOLTAGE_MAX_MSL_mV) {
-                    /* Over voltage maximum safety limit violated */
-                    DIAG_Handler(DIAG_ID_CELL_VOLTAGE_OVERVOLTAGE_MSL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                }
-            }
-        }
-        if (voltageMax_mV < BC_VOLTAGE_MAX_MSL_mV) {
-            /* over voltage maximum safety limit NOT violated */
-            DIAG_Handler(DIAG_ID_CELL_VOLTAGE_OVERVOLTAGE_MSL, DIAG_EVENT_OK, DIAG_STRING, s);
-            if (voltageMax_mV < BC_VOLTAGE_MAX_RSL_mV) {
-                /* over voltage recommended safety limit NOT violated */
-                DIAG_Handler(DIAG_ID_CELL_VOLTAGE_OVERVOLTAGE_RSL, DIAG_EVENT_OK, DIAG_STRING, s);
-                if (voltageMax_mV < BC_VOLTAGE_MAX_MOL_mV) {
-                    /* over voltage maximum operating limit NOT violated */
-                    DIAG_Handler(DIAG_ID_CELL_VOLTAGE_OVERVOLTAGE_MOL, DIAG_EVENT_OK, DIAG_STRING, s);
-                }
-            }
-        }
+        /* over voltage events are stored in the first half, under voltage events in the second half */
+        DIAG_BATCH_EVENT_s events[SOA_NR_OF_EVENTS_PER_STRING] = {0};
+        DIAG_BATCH_EVENT_s *pUndervoltageEvents                = &events[SOA_LIMIT_E_MAX];
+        uint8_t nrOfEvents                                     = 0u;
+        SOA_ClassifyValue(&soa_kOvervoltage, voltageMax_mV, events, SOA_NR_OF_EVENTS_PER_STRING, &nrOfEvents);
+        SOA_ClassifyValue(&soa_kUndervoltage, voltageMin_mV, events, SOA_NR_OF_EVENTS_PER_STRING, &nrOfEvents);
+        (void)DIAG_HandleEvents(events, nrOfEvents, DIAG_STRING, s);
 
-        if (voltageMin_mV <= BC_VOLTAGE_MIN_MOL_mV) {
-            /* Under voltage maximum operating limit violated */
-            DIAG_Handler(DIAG_ID_CELL_VOLTAGE_UNDERVOLTAGE_MOL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-            if (voltageMin_mV <= BC_VOLTAGE_MIN_RSL_mV) {
-                /* Under voltage recommended safety limit violated */
-                DIAG_Handler(DIAG_ID_CELL_VOLTAGE_UNDERVOLTAGE_RSL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                if (voltageMin_mV <= BC_VOLTAGE_MIN_MSL_mV) {
-                    /* Under voltage maximum safety limit violated */
-                    retvalUndervoltMSL =
-                        DIAG_Handler(DIAG_ID_CELL_VOLTAGE_UNDERVOLTAGE_MSL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-
-                    /* If under voltage flag is set and deep-discharge voltage is violated */
-                    if ((retvalUndervoltMSL == DIAG_HANDLER_RETURN_ERR_OCCURRED) &&
-                        (voltageMin_mV <= BC_VOLTAGE_DEEP_DISCHARGE_mV)) {
-                        DIAG_Handler(DIAG_ID_DEEP_DISCHARGE_DETECTED, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                    }
-                }
-            }
+        if ((events[SOA_LIMIT_MOL].event == DIAG_EVENT_NOT_OK) ||
+            (pUndervoltageEvents[SOA_LIMIT_MOL].event == DIAG_EVENT_NOT_OK)) {
+            operatingLimitViolated = true;
         }
-        if (voltageMin_mV > BC_VOLTAGE_MIN_MSL_mV) {
-            /* under voltage maximum safety limit NOT violated */
-            DIAG_Handler(DIAG_ID_CELL_VOLTAGE_UNDERVOLTAGE_MSL, DIAG_EVENT_OK, DIAG_STRING, s);
-            if (voltageMin_mV > BC_VOLTAGE_MIN_RSL_mV) {
-                /* under voltage recommended safety limit NOT violated */
-                DIAG_Handler(DIAG_ID_CELL_VOLTAGE_UNDERVOLTAGE_RSL, DIAG_EVENT_OK, DIAG_STRING, s);
-                if (voltageMin_mV > BC_VOLTAGE_MIN_MOL_mV) {
-                    /* under voltage maximum operating limit NOT violated */
-                    DIAG_Handler(DIAG_ID_CELL_VOLTAGE_UNDERVOLTAGE_MOL, DIAG_EVENT_OK, DIAG_STRING, s);
-                }
-            }
+        /* If under voltage flag is set and deep-discharge voltage is violated */
+        if ((pUndervoltageEvents[SOA_LIMIT_MSL].result == DIAG_HANDLER_RETURN_ERR_OCCURRED) &&
+            (voltageMin_mV <= BC_VOLTAGE_DEEP_DISCHARGE_mV)) {
+            DIAG_Handler(DIAG_ID_DEEP_DISCHARGE_DETECTED, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
         }
     }
+    soa_voltageOperatingLimitViolated = operatingLimitViolated;
 }
 
 extern void SOA_CheckTemperatures(
@@ -150,122 +412,152 @@ extern void SOA_CheckTemperatures(
     DATA_BLOCK_PACK_VALUES_s *pCurrent) {
     FAS_ASSERT(pMinimumMaximumCellTemperatures != NULL_PTR);
     FAS_ASSERT(pCurrent != NULL_PTR);
+    bool operatingLimitViolated = false;
     /* Iterate over each string and check temperatures */
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
         int32_t i_current            = pCurrent->stringCurrent_mA[s];
         int16_t temperatureMin_ddegC = pMinimumMaximumCellTemperatures->minimumTemperature_ddegC[s];
         int16_t temperatureMax_ddegC = pMinimumMaximumCellTemperatures->maximumTemperature_ddegC[s];
 
-        /* Over temperature check */
+        /* the limits depend on the direction of the current */
+        const SOA_THRESHOLD_SET_s *pkOvertemperature  = &soa_kOvertemperatureCharge;
+        const SOA_THRESHOLD_SET_s *pkUndertemperature = &soa_kUndertemperatureCharge;
         if (BMS_GetCurrentFlowDirection(i_current) == BMS_DISCHARGING) {
-            /* Discharge */
-            if (temperatureMax_ddegC >= BC_TEMPERATURE_MAX_DISCHARGE_MOL_ddegC) {
-                /* Over temperature maximum operating limit violated*/
-                DIAG_Handler(DIAG_ID_TEMP_OVERTEMPERATURE_DISCHARGE_MOL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                if (temperatureMax_ddegC >= BC_TEMPERATURE_MAX_DISCHARGE_RSL_ddegC) {
-                    /* Over temperature recommended safety limit violated*/
-                    DIAG_Handler(DIAG_ID_TEMP_OVERTEMPERATURE_DISCHARGE_RSL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                    if (temperatureMax_ddegC >= BC_TEMPERATURE_MAX_DISCHARGE_MSL_ddegC) {
-                        /* Over temperature maximum safety limit violated */
-                        DIAG_Handler(DIAG_ID_TEMP_OVERTEMPERATURE_DISCHARGE_MSL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                    }
-                }
-            }
-            if (temperatureMax_ddegC < BC_TEMPERATURE_MAX_DISCHARGE_MSL_ddegC) {
-                /* over temperature maximum safety limit NOT violated */
-                DIAG_Handler(DIAG_ID_TEMP_OVERTEMPERATURE_DISCHARGE_MSL, DIAG_EVENT_OK, DIAG_STRING, s);
-                if (temperatureMax_ddegC < BC_TEMPERATURE_MAX_DISCHARGE_RSL_ddegC) {
-                    /* over temperature recommended safety limit NOT violated */
-                    DIAG_Handler(DIAG_ID_TEMP_OVERTEMPERATURE_DISCHARGE_RSL, DIAG_EVENT_OK, DIAG_STRING, s);
-                    if (temperatureMax_ddegC < BC_TEMPERATURE_MAX_DISCHARGE_MOL_ddegC) {
-                        /* over temperature maximum operating limit NOT violated */
-                        DIAG_Handler(DIAG_ID_TEMP_OVERTEMPERATURE_DISCHARGE_MOL, DIAG_EVENT_OK, DIAG_STRING, s);
-                    }
-                }
-            }
-        } else {
-            /* Charge */
-            if (temperatureMax_ddegC >= BC_TEMPERATURE_MAX_CHARGE_MOL_ddegC) {
-                /* Over temperature maximum operating limit violated */
-                DIAG_Handler(DIAG_ID_TEMP_OVERTEMPERATURE_CHARGE_MOL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                if (temperatureMax_ddegC >= BC_TEMPERATURE_MAX_CHARGE_RSL_ddegC) {
-                    /* Over temperature recommended safety limit violated */
-                    DIAG_Handler(DIAG_ID_TEMP_OVERTEMPERATURE_CHARGE_RSL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                    /* Over temperature maximum safety limit violated */
-                    if (temperatureMax_ddegC >= BC_TEMPERATURE_MAX_CHARGE_MSL_ddegC) {
-                        DIAG_Handler(DIAG_ID_TEMP_OVERTEMPERATURE_CHARGE_MSL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                    }
-                }
-            }
-            if (temperatureMax_ddegC < BC_TEMPERATURE_MAX_CHARGE_MSL_ddegC) {
-                /* over temperature maximum safety limit NOT violated */
-                DIAG_Handler(DIAG_ID_TEMP_OVERTEMPERATURE_CHARGE_MSL, DIAG_EVENT_OK, DIAG_STRING, s);
-                if (temperatureMax_ddegC < BC_TEMPERATURE_MAX_CHARGE_RSL_ddegC) {
-                    /* over temperature recommended safety limit NOT violated */
-                    DIAG_Handler(DIAG_ID_TEMP_OVERTEMPERATURE_CHARGE_RSL, DIAG_EVENT_OK, DIAG_STRING, s);
-                    if (temperatureMax_ddegC < BC_TEMPERATURE_MAX_CHARGE_MOL_ddegC) {
-                        /* over temperature maximum operating limit NOT violated*/
-                        DIAG_Handler(DIAG_ID_TEMP_OVERTEMPERATURE_CHARGE_MOL, DIAG_EVENT_OK, DIAG_STRING, s);
-                    }
-                }
-            }
+            pkOvertemperature  = &soa_kOvertemperatureDischarge;
+            pkUndertemperature = &soa_kUndertemperatureDischarge;
         }
 
-        /* Under temperature check */
-        if (BMS_GetCurrentFlowDirection(i_current) == BMS_DISCHARGING) {
-            /* Discharge */
-            if (temperatureMin_ddegC <= BC_TEMPERATURE_MIN_DISCHARGE_MOL_ddegC) {
-                /* Under temperature maximum operating limit violated */
-                DIAG_Handler(DIAG_ID_TEMP_UNDERTEMPERATURE_DISCHARGE_MOL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                if (temperatureMin_ddegC <= BC_TEMPERATURE_MIN_DISCHARGE_RSL_ddegC) {
-                    /* Under temperature recommended safety limit violated*/
-                    DIAG_Handler(DIAG_ID_TEMP_UNDERTEMPERATURE_DISCHARGE_RSL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                    if (temperatureMin_ddegC <= BC_TEMPERATURE_MIN_DISCHARGE_MSL_ddegC) {
-                        /* Under temperature maximum safety limit violated */
-                        DIAG_Handler(DIAG_ID_TEMP_UNDERTEMPERATURE_DISCHARGE_MSL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                    }
-                }
-            }
-            if (temperatureMin_ddegC > BC_TEMPERATURE_MIN_DISCHARGE_MSL_ddegC) {
-                /* under temperature maximum safety limit NOT violated */
-                DIAG_Handler(DIAG_ID_TEMP_UNDERTEMPERATURE_DISCHARGE_MSL, DIAG_EVENT_OK, DIAG_STRING, s);
-                if (temperatureMin_ddegC > BC_TEMPERATURE_MIN_DISCHARGE_RSL_ddegC) {
-                    /* under temperature recommended safety limit NOT violated */
-                    DIAG_Handler(DIAG_ID_TEMP_UNDERTEMPERATURE_DISCHARGE_RSL, DIAG_EVENT_OK, DIAG_STRING, s);
-                    if (temperatureMin_ddegC > BC_TEMPERATURE_MIN_DISCHARGE_MOL_ddegC) {
-                        /* under temperature maximum operating limit NOT violated*/
-                        DIAG_Handler(DIAG_ID_TEMP_UNDERTEMPERATURE_DISCHARGE_MOL, DIAG_EVENT_OK, DIAG_STRING, s);
-                    }
-                }
-            }
-        } else {
-            /* Charge */
-            if (temperatureMin_ddegC <= BC_TEMPERATURE_MIN_CHARGE_MOL_ddegC) {
-                /* Under temperature maximum operating limit violated */
-                DIAG_Handler(DIAG_ID_TEMP_UNDERTEMPERATURE_CHARGE_MOL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                if (temperatureMin_ddegC <= BC_TEMPERATURE_MIN_CHARGE_RSL_ddegC) {
-                    /* Under temperature recommended safety limit violated */
-                    DIAG_Handler(DIAG_ID_TEMP_UNDERTEMPERATURE_CHARGE_RSL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                    if (temperatureMin_ddegC <= BC_TEMPERATURE_MIN_CHARGE_MSL_ddegC) {
-                        /* Under temperature maximum safety limit violated */
-                        DIAG_Handler(DIAG_ID_TEMP_UNDERTEMPERATURE_CHARGE_MSL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                    }
-                }
-            }
-            if (temperatureMin_ddegC > BC_TEMPERATURE_MIN_CHARGE_MSL_ddegC) {
-                /* under temperature maximum safety limit NOT violated */
-                DIAG_Handler(DIAG_ID_TEMP_UNDERTEMPERATURE_CHARGE_MSL, DIAG_EVENT_OK, DIAG_STRING, s);
-                if (temperatureMin_ddegC > BC_TEMPERATURE_MIN_CHARGE_RSL_ddegC) {
-                    /* under temperature recommended safety limit NOT violated */
-                    DIAG_Handler(DIAG_ID_TEMP_UNDERTEMPERATURE_CHARGE_RSL, DIAG_EVENT_OK, DIAG_STRING, s);
-                    if (temperatureMin_ddegC > BC_TEMPERATURE_MIN_CHARGE_MOL_ddegC) {
-                        /* under temperature maximum operating limit NOT violated*/
-                        DIAG_Handler(DIAG_ID_TEMP_UNDERTEMPERATURE_CHARGE_MOL, DIAG_EVENT_OK, DIAG_STRING, s);
-                    }
-                }
-            }
+        /* over temperature events are stored in the first half, under temperature events in the second half */
+        DIAG_BATCH_EVENT_s events[SOA_NR_OF_EVENTS_PER_STRING] = {0};
+        DIAG_BATCH_EVENT_s *pUndertemperatureEvents            = &events[SOA_LIMIT_E_MAX];
+        uint8_t nrOfEvents                                     = 0u;
+        SOA_ClassifyValue(pkOvertemperature, temperatureMax_ddegC, events, SOA_NR_OF_EVENTS_PER_STRING, &nrOfEvents);
+        SOA_ClassifyValue(pkUndertemperature, temperatureMin_ddegC, events, SOA_NR_OF_EVENTS_PER_STRING, &nrOfEvents);
+        (void)DIAG_HandleEvents(events, nrOfEvents, DIAG_STRING, s);
+
+        if ((events[SOA_LIMIT_MOL].event == DIAG_EVENT_NOT_OK) ||
+            (pUndertemperatureEvents[SOA_LIMIT_MOL].event == DIAG_EVENT_NOT_OK)) {
+            operatingLimitViolated = true;
         }
     }
+    soa_temperatureOperatingLimitViolated = operatingLimitViolated;
+}
+
+extern void SOA_CheckCellVoltages(const DATA_BLOCK_CELL_VOLTAGE_s *pkCellVoltages) {
+    FAS_ASSERT(pkCellVoltages != NULL_PTR);
+    bool operatingLimitViolated = false;
+
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        SOA_CELL_VIOLATIONS_s *pViolations = &soa_cellVoltageViolations[s];
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            const int16_t *const kpkVoltages_mV = pkCellVoltages->cellVoltage_mV[s][m];
+            const uint64_t invalidVoltages      = pkCellVoltages->invalidCellVoltage[s][m];
+            SOA_ClassifyModule(
+                &soa_kOvervoltage,
+                kpkVoltages_mV,
+                BS_NR_OF_CELL_BLOCKS_PER_MODULE,
+                invalidVoltages,
+                SOA_CELL_VOLTAGE_HYSTERESIS_mV,
+                pViolations->upperLimits[m]);
+            SOA_ClassifyModule(
+                &soa_kUndervoltage,
+                kpkVoltages_mV,
+                BS_NR_OF_CELL_BLOCKS_PER_MODULE,
+                invalidVoltages,
+                SOA_CELL_VOLTAGE_HYSTERESIS_mV,
+                pViolations->lowerLimits[m]);
+        }
+
+        /* over voltage events are stored in the first half, under voltage events in the second half */
+        DIAG_BATCH_EVENT_s events[SOA_NR_OF_EVENTS_PER_STRING] = {0};
+        DIAG_BATCH_EVENT_s *pUndervoltageEvents                = &events[SOA_LIMIT_E_MAX];
+        uint8_t nrOfEvents                                     = 0u;
+        SOA_AddCellViolationEvents(
+            &soa_kOvervoltage, &soa_kUndervoltage, pViolations, events, SOA_NR_OF_EVENTS_PER_STRING, &nrOfEvents);
+        (void)DIAG_HandleEvents(events, nrOfEvents, DIAG_STRING, s);
+
+        if ((events[SOA_LIMIT_MOL].event == DIAG_EVENT_NOT_OK) ||
+            (pUndervoltageEvents[SOA_LIMIT_MOL].event == DIAG_EVENT_NOT_OK)) {
+            operatingLimitViolated = true;
+        }
+        /* If under voltage flag is set and deep-discharge voltage is violated */
+        if ((pUndervoltageEvents[SOA_LIMIT_MSL].result == DIAG_HANDLER_RETURN_ERR_OCCURRED) &&
+            (SOA_IsCellDeepDischarged(pkCellVoltages, s) == true)) {
+            DIAG_Handler(DIAG_ID_DEEP_DISCHARGE_DETECTED, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
+        }
+    }
+    soa_voltageOperatingLimitViolated = operatingLimitViolated;
+}
+
+extern void SOA_CheckCellTemperatures(
+    const DATA_BLOCK_CELL_TEMPERATURE_s *pkCellTemperatures,
+    const DATA_BLOCK_PACK_VALUES_s *pkCurrent) {
+    FAS_ASSERT(pkCellTemperatures != NULL_PTR);
+    FAS_ASSERT(pkCurrent != NULL_PTR);
+    bool operatingLimitViolated = false;
+
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        /* the limits depend on the direction of the current */
+        const bool isDischarging = (BMS_GetCurrentFlowDirection(pkCurrent->stringCurrent_mA[s]) == BMS_DISCHARGING);
+
+        const SOA_THRESHOLD_SET_s *pkOvertemperature  = &soa_kOvertemperatureCharge;
+        const SOA_THRESHOLD_SET_s *pkUndertemperature = &soa_kUndertemperatureCharge;
+        if (isDischarging == true) {
+            pkOvertemperature  = &soa_kOvertemperatureDischarge;
+            pkUndertemperature = &soa_kUndertemperatureDischarge;
+        }
+
+        SOA_CELL_VIOLATIONS_s *pViolations = &soa_cellTemperatureViolations[s];
+        if (isDischarging != soa_isCellTemperatureDischarging[s]) {
+            /* the hysteresis must not hold violations of the threshold sets of the other direction */
+            (void)memset(pViolations, 0, sizeof(SOA_CELL_VIOLATIONS_s));
+            soa_isCellTemperatureDischarging[s] = isDischarging;
+        }
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            const int16_t *const kpkTemperatures_ddegC = pkCellTemperatures->cellTemperature_ddegC[s][m];
+            const uint64_t invalidTemperatures         = pkCellTemperatures->invalidCellTemperature[s][m];
+            SOA_ClassifyModule(
+                pkOvertemperature,
+                kpkTemperatures_ddegC,
+                BS_NR_OF_TEMP_SENSORS_PER_MODULE,
+                invalidTemperatures,
+                SOA_CELL_TEMPERATURE_HYSTERESIS_ddegC,
+                pViolations->upperLimits[m]);
+            SOA_ClassifyModule(
+                pkUndertemperature,
+                kpkTemperatures_ddegC,
+                BS_NR_OF_TEMP_SENSORS_PER_MODULE,
+                invalidTemperatures,
+                SOA_CELL_TEMPERATURE_HYSTERESIS_ddegC,
+                pViolations->lowerLimits[m]);
+        }
+
+        /* over temperature events are stored in the first half, under temperature events in the second half */
+        DIAG_BATCH_EVENT_s events[SOA_NR_OF_EVENTS_PER_STRING] = {0};
+        DIAG_BATCH_EVENT_s *pUndertemperatureEvents            = &events[SOA_LIMIT_E_MAX];
+        uint8_t nrOfEvents                                     = 0u;
+        SOA_AddCellViolationEvents(
+            pkOvertemperature, pkUndertemperature, pViolations, events, SOA_NR_OF_EVENTS_PER_STRING, &nrOfEvents);
+        (void)DIAG_HandleEvents(events, nrOfEvents, DIAG_STRING, s);
+
+        if ((events[SOA_LIMIT_MOL].event == DIAG_EVENT_NOT_OK) ||
+            (pUndertemperatureEvents[SOA_LIMIT_MOL].event == DIAG_EVENT_NOT_OK)) {
+            operatingLimitViolated = true;
+        }
+    }
+    soa_temperatureOperatingLimitViolated = operatingLimitViolated;
+}
+
+extern void SOA_GetCellVoltageViolations(uint8_t stringNumber, SOA_CELL_VIOLATIONS_s *pViolations) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    FAS_ASSERT(pViolations != NULL_PTR);
+    *pViolations = soa_cellVoltageViolations[stringNumber];
+}
+
+extern void SOA_GetCellTemperatureViolations(uint8_t stringNumber, SOA_CELL_VIOLATIONS_s *pViolations) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    FAS_ASSERT(pViolations != NULL_PTR);
+    *pViolations = soa_cellTemperatureViolations[stringNumber];
 }
 
 extern void SOA_CheckCurrent(DATA_BLOCK_PACK_VALUES_s *pTablePackValues) {
@@ -281,46 +573,28 @@ extern void SOA_CheckCurrent(DATA_BLOCK_PACK_VALUES_s *pTablePackValues) {
             /* Check various current limits depending on current direction */
             bool stringOvercurrent = SOA_IsStringCurrentLimitViolated(absStringCurrent_mA, currentDirection);
             bool cellOvercurrent   = SOA_IsCellCurrentLimitViolated(absStringCurrent_mA, currentDirection);
+
+            DIAG_BATCH_EVENT_s events[SOA_NR_OF_CURRENT_EVENTS_PER_STRING] = {0};
+            const uint8_t capacity                                         = SOA_NR_OF_CURRENT_EVENTS_PER_STRING;
+            uint8_t nrOfEvents                                             = 0u;
             if (currentDirection == BMS_CHARGING) {
-                /* Check string current limit */
-                if (stringOvercurrent == true) {
-                    DIAG_Handler(DIAG_ID_STRING_OVERCURRENT_CHARGE_MSL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                } else {
-                    DIAG_Handler(DIAG_ID_STRING_OVERCURRENT_CHARGE_MSL, DIAG_EVENT_OK, DIAG_STRING, s);
-                }
-                /* Check battery cell limit */
-                if (cellOvercurrent == true) {
-                    DIAG_Handler(DIAG_ID_OVERCURRENT_CHARGE_CELL_MSL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                } else {
-                    DIAG_Handler(DIAG_ID_OVERCURRENT_CHARGE_CELL_MSL, DIAG_EVENT_OK, DIAG_STRING, s);
-                }
+                SOA_AddEvent(events, capacity, &nrOfEvents, DIAG_ID_STRING_OVERCURRENT_CHARGE_MSL, stringOvercurrent);
+                SOA_AddEvent(events, capacity, &nrOfEvents, DIAG_ID_OVERCURRENT_CHARGE_CELL_MSL, cellOvercurrent);
             } else if (currentDirection == BMS_DISCHARGING) {
-                /* Check string current limit */
-                if (stringOvercurrent == true) {
-                    DIAG_Handler(DIAG_ID_STRING_OVERCURRENT_DISCHARGE_MSL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                } else {
-                    DIAG_Handler(DIAG_ID_STRING_OVERCURRENT_DISCHARGE_MSL, DIAG_EVENT_OK, DIAG_STRING, s);
-                }
-                /* Check battery cell limit */
-                if (cellOvercurrent == true) {
-                    DIAG_Handler(DIAG_ID_OVERCURRENT_DISCHARGE_CELL_MSL, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-                } else {
-                    DIAG_Handler(DIAG_ID_OVERCURRENT_DISCHARGE_CELL_MSL, DIAG_EVENT_OK, DIAG_STRING, s);
-                }
+                SOA_AddEvent(
+                    events, capacity, &nrOfEvents, DIAG_ID_STRING_OVERCURRENT_DISCHARGE_MSL, stringOvercurrent);
+                SOA_AddEvent(events, capacity, &nrOfEvents, DIAG_ID_OVERCURRENT_DISCHARGE_CELL_MSL, cellOvercurrent);
             } else {
                 /* No current floating -> everything okay */
-                DIAG_Handler(DIAG_ID_STRING_OVERCURRENT_CHARGE_MSL, DIAG_EVENT_OK, DIAG_STRING, s);
-                DIAG_Handler(DIAG_ID_OVERCURRENT_CHARGE_CELL_MSL, DIAG_EVENT_OK, DIAG_STRING, s);
-                DIAG_Handler(DIAG_ID_STRING_OVERCURRENT_DISCHARGE_MSL, DIAG_EVENT_OK, DIAG_STRING, s);
-                DIAG_Handler(DIAG_ID_OVERCURRENT_DISCHARGE_CELL_MSL, DIAG_EVENT_OK, DIAG_STRING, s);
+                SOA_AddEvent(events, capacity, &nrOfEvents, DIAG_ID_STRING_OVERCURRENT_CHARGE_MSL, false);
+                SOA_AddEvent(events, capacity, &nrOfEvents, DIAG_ID_OVERCURRENT_CHARGE_CELL_MSL, false);
+                SOA_AddEvent(events, capacity, &nrOfEvents, DIAG_ID_STRING_OVERCURRENT_DISCHARGE_MSL, false);
+                SOA_AddEvent(events, capacity, &nrOfEvents, DIAG_ID_OVERCURRENT_DISCHARGE_CELL_MSL, false);
             }
-
             /* Check if current is floating while contactors are open */
-            if (SOA_IsCurrentOnOpenString(currentDirection, s) == false) {
-                DIAG_Handler(DIAG_ID_CURRENT_ON_OPEN_STRING, DIAG_EVENT_OK, DIAG_STRING, s);
-            } else {
-                DIAG_Handler(DIAG_ID_CURRENT_ON_OPEN_STRING, DIAG_EVENT_NOT_OK, DIAG_STRING, s);
-            }
+            const bool currentOnOpenString = SOA_IsCurrentOnOpenString(currentDirection, s);
+            SOA_AddEvent(events, capacity, &nrOfEvents, DIAG_ID_CURRENT_ON_OPEN_STRING, currentOnOpenString);
+            (void)DIAG_HandleEvents(events, nrOfEvents, DIAG_STRING, s);
         }
     }
 
@@ -350,6 +624,10 @@ extern void SOA_CheckCurrent(DATA_BLOCK_PACK_VALUES_s *pTablePackValues) {
     }
 }
 
+extern bool SOA_IsOperatingLimitViolated(void) {
+    return (soa_voltageOperatingLimitViolated || soa_temperatureOperatingLimitViolated);
+}
+
 extern void SOA_CheckSlaveTemperatures(void) { /* TODO: to be implemented */
 }
 
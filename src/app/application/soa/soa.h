@@ -43,7 +43,7 @@
  * @file    soa.h
  * @author  foxBMS Team
  * @date    2020-10-14 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup APPLICATION
  * @prefix  SOA
@@ -59,11 +59,34 @@
 /*========== Includes =======================================================*/
 #include "soa_cfg.h"
 
+#include "battery_system_cfg.h"
+
 #include "database.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
+/** limits of a threshold set, ordered by their severity */
+typedef enum {
+    SOA_LIMIT_MOL,   /*!< maximum operating limit */
+    SOA_LIMIT_RSL,   /*!< recommended safety limit */
+    SOA_LIMIT_MSL,   /*!< maximum safety limit */
+    SOA_LIMIT_E_MAX, /*!< number of limits of a threshold set */
+} SOA_LIMIT_e;
+
+/**
+ * @brief   per-cell violations of the safe operating area limits in a string
+ * @details Bit n of a bitmask is set if cell block n (cell voltages) or
+ *          temperature sensor n (cell temperatures) of the module violates
+ *          the limit. Invalid measurement values never violate a limit.
+ */
+typedef struct {
+    uint64_t upperLimits[BS_NR_OF_MODULES_PER_STRING][SOA_LIMIT_E_MAX]; /*!< cells above the upper limits */
+    uint64_t lowerLimits[BS_NR_OF_MODULES_PER_STRING][SOA_LIMIT_E_MAX]; /*!< cells below the lower limits */
+    uint16_t nrOfUpperLimitViolations[SOA_LIMIT_E_MAX]; /*!< number of cells above the upper limits */
+    uint16_t nrOfLowerLimitViolations[SOA_LIMIT_E_MAX]; /*!< number of cells below the lower limits */
+} SOA_CELL_VIOLATIONS_s;
 
 /*========== Extern Constant and Variable Declarations ======================*/
 
@@ -89,6 +112,48 @@ extern void SOA_CheckTemperatures(
     DATA_BLOCK_MIN_MAX_s *pMinimumMaximumCellTemperatures,
     DATA_BLOCK_PACK_VALUES_s *pCurrent);
 
+/**
+ * @brief   checks the abidance by the safe operating area for each cell
+ * @param[in]   pkCellVoltages  pointer to database entry with the validated
+ *                              cell voltages
+ * @details Classifies each valid cell voltage against the over and under
+ *          voltage limits and reports the same diagnosis entries as
+ *          #SOA_CheckVoltages. A limit is violated in a string if at least
+ *          one valid cell violates it, i.e., the reported events are equal
+ *          to the events that #SOA_CheckVoltages reports for the minimum and
+ *          maximum cell voltage as long as #SOA_CELL_VOLTAGE_HYSTERESIS_mV
+ *          is zero.
+ */
+extern void SOA_CheckCellVoltages(const DATA_BLOCK_CELL_VOLTAGE_s *pkCellVoltages);
+
+/**
+ * @brief   checks the abidance by the safe operating area for each cell
+ * @param[in]   pkCellTemperatures  pointer to database entry with the
+ *                                  validated cell temperatures
+ * @param[in]   pkCurrent           pointer to pack value database entry
+ * @details Per-cell counterpart of #SOA_CheckTemperatures, see
+ *          #SOA_CheckCellVoltages.
+ */
+extern void SOA_CheckCellTemperatures(
+    const DATA_BLOCK_CELL_TEMPERATURE_s *pkCellTemperatures,
+    const DATA_BLOCK_PACK_VALUES_s *pkCurrent);
+
+/**
+ * @brief   copies the per-cell voltage violations of a string of the last
+ *          call of #SOA_CheckCellVoltages
+ * @param[in]   stringNumber    string whose violations are copied
+ * @param[out]  pViolations     violations of the string
+ */
+extern void SOA_GetCellVoltageViolations(uint8_t stringNumber, SOA_CELL_VIOLATIONS_s *pViolations);
+
+/**
+ * @brief   copies the per-cell temperature violations of a string of the
+ *          last call of #SOA_CheckCellTemperatures
+ * @param[in]   stringNumber    string whose violations are copied
+ * @param[out]  pViolations     violations of the string
+ */
+extern void SOA_GetCellTemperatureViolations(uint8_t stringNumber, SOA_CELL_VIOLATIONS_s *pViolations);
+
 /**
  * @brief   checks the abidance by the safe operating area
  * @param[in]   pTablePackValues   pointer to pack values database entry
@@ -97,6 +162,16 @@ extern void SOA_CheckTemperatures(
  */
 extern void SOA_CheckCurrent(DATA_BLOCK_PACK_VALUES_s *pTablePackValues);
 
+/**
+ * @brief   checks if the last voltage or temperature check violated a
+ *          maximum operating limit (MOL)
+ * @details The MOL is the first of the safe operating area limits, the
+ *          result is used to measure the cells at higher rates while the
+ *          limits are approached.
+ * @return  true if a maximum operating limit was violated, false otherwise
+ */
+extern bool SOA_IsOperatingLimitViolated(void);
+
 /**
  * @brief   FOR FUTURE COMPATIBILITY; DUMMY FUNCTION; DO NOT USE
  * @details FOR FUTURE COMPATIBILITY; DUMMY FUNCTION; DO NOT USE
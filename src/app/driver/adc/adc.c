@@ -43,7 +43,7 @@
  * @file    adc.c
  * @author  foxBMS Team
  * @date    2019-01-07 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  ADC
@@ -55,7 +55,10 @@
 /*========== Includes =======================================================*/
 #include "adc.h"
 
+#include "HL_sys_dma.h"
+
 #include "database.h"
+#include "dma_cfg.h"
 
 #include <math.h>
 #include <stdbool.h>
@@ -63,6 +66,19 @@
 
 /*========== Macros and Definitions =========================================*/
 
+/** voltage range of the ADC in mV as integer */
+#define ADC_VREF_RANGE_mV ((uint32_t)ADC_VREFHIGH_mV - (uint32_t)ADC_VREFLOW_mV)
+
+/** resolution of the integer conversion of oversampled conversions: 1/256 mV */
+#define ADC_OVERSAMPLED_VOLTAGE_RESOLUTION_mV (1.0f / 256.0f)
+
+/* the oversampled conversion (see ADC_ConvertOversampledVoltage) calculates
+ * (2 * sum + n) * range with sum <= 4095 * n in 32 bit */
+FAS_STATIC_ASSERT(ADC_OVERSAMPLING_FACTOR > 0u, "ADC_OVERSAMPLING_FACTOR must not be 0");
+FAS_STATIC_ASSERT(
+    (((2u * ADC_RESULT_VALUE_MASK) + 1u) * ADC_OVERSAMPLING_FACTOR) <= (UINT32_MAX / ADC_VREF_RANGE_mV),
+    "Oversampled ADC conversion overflows, reduce ADC_OVERSAMPLING_FACTOR");
+
 /*========== Static Constant and Variable Definitions =======================*/
 
 /**
@@ -76,6 +92,15 @@ static adcData_t adc_adc1RawVoltages[MCU_ADC1_MAX_NR_CHANNELS] = {0};
 
 static DATA_BLOCK_ADC_VOLTAGE_s adc_adc1Voltages = {.header.uniqueId = DATA_BLOCK_ID_ADC_VOLTAGE};
 
+/**
+ * @brief   ring buffer that the DMA fills continuously with the group 1
+ *          conversion results (conversion value and channel ID per word)
+ * @details Placed in the non-cached shared RAM, as it is written by the DMA.
+ */
+#pragma SET_DATA_SECTION(".sharedRAM")
+static uint32_t adc_dmaRing[ADC_DMA_RING_LENGTH];
+#pragma SET_DATA_SECTION()
+
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
@@ -87,6 +112,31 @@ static DATA_BLOCK_ADC_VOLTAGE_s adc_adc1Voltages = {.header.uniqueId = DATA_BLOC
  */
 static float_t ADC_ConvertVoltage(uint16_t adcCounts);
 
+/**
+ * @brief   converts the sum of several readings of one channel to the voltage
+ *          of their average in mV
+ * @details Implements the equation of #ADC_ConvertVoltage() for the average
+ *          in integer arithmetic with a resolution of 1/256 mV, so that only
+ *          one conversion to floating point is needed per channel.
+ * @param   sumOfCounts             sum of the digital values read by the ADC
+ * @param   numberOfConversions     number of summed readings
+ * @return  voltage in mV
+ */
+static float_t ADC_ConvertOversampledVoltage(uint32_t sumOfCounts, uint32_t numberOfConversions);
+
+/**
+ * @brief   averages the conversions in the DMA ring per channel
+ * @details Slots that have not been written by the DMA are skipped. Channels
+ *          without any conversion in the ring keep their previous voltage.
+ * @param   kpRing          DMA ring with #ADC_DMA_RING_LENGTH results
+ * @param   pVoltages_mV    voltage of every channel in mV
+ *                          (#MCU_ADC1_MAX_NR_CHANNELS entries)
+ */
+static void ADC_DecimateDmaRing(const volatile uint32_t *kpRing, float_t *pVoltages_mV);
+
+/** polled single conversion of all channels (one step per call) */
+static void ADC_ControlSingleConversion(void);
+
 /*========== Static Function Implementations ================================*/
 
 static float_t ADC_ConvertVoltage(uint16_t adcCounts) {
@@ -99,9 +149,45 @@ static float_t ADC_ConvertVoltage(uint16_t adcCounts) {
     return result_mV;
 }
 
-/*========== Extern Function Implementations ================================*/
+static float_t ADC_ConvertOversampledVoltage(uint32_t sumOfCounts, uint32_t numberOfConversions) {
+    FAS_ASSERT(numberOfConversions > 0u);
+    FAS_ASSERT(numberOfConversions <= ADC_OVERSAMPLING_FACTOR);
+    FAS_ASSERT(sumOfCounts <= (ADC_RESULT_VALUE_MASK * numberOfConversions));
 
-extern void ADC_Control(void) {
+    /* ((average + 0.5) * range) / 4096 in 1/256 mV: ((2 * sum + n) * range * 256) / (2 * n * 4096) */
+    const uint32_t numerator          = ((2u * sumOfCounts) + numberOfConversions) * ADC_VREF_RANGE_mV;
+    const uint32_t voltage_256th_mV   = numerator / (32u * numberOfConversions);
+    const float_t voltageAboveVrefLow = (float_t)voltage_256th_mV * ADC_OVERSAMPLED_VOLTAGE_RESOLUTION_mV;
+    return voltageAboveVrefLow + ADC_VREFLOW_mV;
+}
+
+static void ADC_DecimateDmaRing(const volatile uint32_t *kpRing, float_t *pVoltages_mV) {
+    FAS_ASSERT(kpRing != NULL_PTR);
+    FAS_ASSERT(pVoltages_mV != NULL_PTR);
+
+    uint32_t sumOfCounts[MCU_ADC1_MAX_NR_CHANNELS]         = {0u};
+    uint32_t numberOfConversions[MCU_ADC1_MAX_NR_CHANNELS] = {0u};
+
+    for (uint16_t slot = 0u; slot < ADC_DMA_RING_LENGTH; slot++) {
+        /* read every slot once, as the DMA keeps writing the ring */
+        const uint32_t result = kpRing[slot];
+        if (result != ADC_DMA_RING_EMPTY_SLOT) {
+            const uint8_t channel = (uint8_t)((result >> ADC_RESULT_CHANNEL_ID_SHIFT) & ADC_RESULT_CHANNEL_ID_MASK);
+            if ((channel < MCU_ADC1_MAX_NR_CHANNELS) && (numberOfConversions[channel] < ADC_OVERSAMPLING_FACTOR)) {
+                sumOfCounts[channel] += (result & ADC_RESULT_VALUE_MASK);
+                numberOfConversions[channel]++;
+            }
+        }
+    }
+    for (uint8_t channel = 0u; channel < MCU_ADC1_MAX_NR_CHANNELS; channel++) {
+        if (numberOfConversions[channel] > 0u) {
+            pVoltages_mV[channel] =
+                ADC_ConvertOversampledVoltage(sumOfCounts[channel], numberOfConversions[channel]);
+        }
+    }
+}
+
+static void ADC_ControlSingleConversion(void) {
     bool conversionFinished = true;
 
     switch (adc_conversionState) {
@@ -137,6 +223,66 @@ extern void ADC_Control(void) {
     }
 }
 
+/*========== Extern Function Implementations ================================*/
+
+extern void ADC_Initialize(void) {
+    if (ADC_DMA_OVERSAMPLING == true) {
+        for (uint16_t slot = 0u; slot < ADC_DMA_RING_LENGTH; slot++) {
+            adc_dmaRing[slot] = ADC_DMA_RING_EMPTY_SLOT;
+        }
+
+        /* one frame per conversion result; autoinit restarts at the begin of the ring */
+        g_dmaCTRL adc_controlPacketDmaRing = {
+            .SADD      = (uint32_t)(&(adcREG1->GxBUF[adcGROUP1].BUF0)), /* source address             */
+            .DADD      = (uint32_t)(&adc_dmaRing[0u]),                  /* destination  address       */
+            .CHCTRL    = 0u,                                             /* channel chain control      */
+            .FRCNT     = ADC_DMA_RING_LENGTH,                            /* frame count                */
+            .ELCNT     = 1u,                                             /* element count              */
+            .ELDOFFSET = 0u,                                             /* element destination offset */
+            .ELSOFFSET = 0u,                                             /* element source offset      */
+            .FRDOFFSET = 0u,                                             /* frame destination offset   */
+            .FRSOFFSET = 0u,                                             /* frame source offset        */
+            .PORTASGN  = (uint32_t)PORTB_READ_PORTA_WRITE,               /* port assignment            */
+            .RDSIZE    = (uint32_t)ACCESS_32_BIT,                        /* read size                  */
+            .WRSIZE    = (uint32_t)ACCESS_32_BIT,                        /* write size                 */
+            .TTYPE     = (uint32_t)FRAME_TRANSFER,                       /* transfer type              */
+            .ADDMODERD = (uint32_t)ADDR_FIXED,                           /* address mode read          */
+            .ADDMODEWR = (uint32_t)ADDR_INC1,                            /* address mode write         */
+            .AUTOINIT  = (uint32_t)AUTOINIT_ON                           /* autoinit                   */
+        };
+        dmaReqAssign((dmaChannel_t)DMA_CHANNEL_ADC1, (dmaRequest_t)DMA_REQ_LINE_ADC1_GROUP1);
+        dmaSetCtrlPacket((dmaChannel_t)DMA_CHANNEL_ADC1, adc_controlPacketDmaRing);
+        dmaSetChEnable((dmaChannel_t)DMA_CHANNEL_ADC1, (dmaTriggerType_t)DMA_HW);
+
+        /* request a DMA transfer for every result */
+        adcREG1->G1DMACR = ADC_GROUP1_DMA_REQUEST_ENABLE_BIT;
+        /* restart the conversion sequence when it has finished */
+        adcREG1->GxMODECR[adcGROUP1] |= ADC_GROUP1_CONTINUOUS_CONVERSION_BIT;
+        adcStartConversion(adcREG1, adcGROUP1);
+    }
+}
+
+extern void ADC_Control(void) {
+    if (ADC_DMA_OVERSAMPLING == true) {
+        ADC_DecimateDmaRing(adc_dmaRing, adc_adc1Voltages.adc1ConvertedVoltages_mV);
+        DATA_WRITE_DATA(&adc_adc1Voltages);
+    } else {
+        ADC_ControlSingleConversion();
+    }
+}
+
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
+extern float_t TEST_ADC_ConvertVoltage(uint16_t adcCounts) {
+    return ADC_ConvertVoltage(adcCounts);
+}
+extern float_t TEST_ADC_ConvertOversampledVoltage(uint32_t sumOfCounts, uint32_t numberOfConversions) {
+    return ADC_ConvertOversampledVoltage(sumOfCounts, numberOfConversions);
+}
+extern void TEST_ADC_DecimateDmaRing(const volatile uint32_t *kpRing, float_t *pVoltages_mV) {
+    ADC_DecimateDmaRing(kpRing, pVoltages_mV);
+}
+extern uint32_t *TEST_ADC_GetDmaRing(void) {
+    return &adc_dmaRing[0u];
+}
 #endif
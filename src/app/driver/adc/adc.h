@@ -43,7 +43,7 @@
  * @file    adc.h
  * @author  foxBMS Team
  * @date    2019-01-07 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  ADC
@@ -61,6 +61,10 @@
 
 #include "HL_adc.h"
 
+#include "mcu.h"
+
+#include <math.h>
+#include <stdbool.h>
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
@@ -79,6 +83,45 @@
 /** End bit position in ADC Groupx Interrupt Flag Register */
 #define ADC_CONVERSION_ENDDBIT (8u)
 
+/**
+ * @brief   Continuously convert ADC1 group 1 into a DMA ring and average the
+ *          conversions per channel
+ * @details If set to false, the channels are converted once per three calls
+ *          of #ADC_Control() by a polled single conversion. If set to true,
+ *          the conversions are triggered continuously, the DMA writes every
+ *          result into a ring buffer and #ADC_Control() writes the average of
+ *          the last #ADC_OVERSAMPLING_FACTOR conversions of every channel to
+ *          the database in every call.
+ */
+#define ADC_DMA_OVERSAMPLING (false)
+
+#if !((ADC_DMA_OVERSAMPLING == true) || (ADC_DMA_OVERSAMPLING == false))
+#error "ADC_DMA_OVERSAMPLING can only have the value true or false"
+#endif
+
+/**
+ * number of conversions per channel that are stored in the DMA ring and
+ * averaged (the integer conversion of the sum does not overflow up to 64)
+ */
+#define ADC_OVERSAMPLING_FACTOR (8u)
+
+/** number of 32 bit results in the DMA ring: one slot per channel and conversion */
+#define ADC_DMA_RING_LENGTH (ADC_OVERSAMPLING_FACTOR * MCU_ADC1_MAX_NR_CHANNELS)
+
+/** Group 1 continuous conversion bit in the ADC Group1 Mode Control Register */
+#define ADC_GROUP1_CONTINUOUS_CONVERSION_BIT (0x2u)
+/** Group 1 DMA request on every conversion in the ADC Group1 DMA Control Register */
+#define ADC_GROUP1_DMA_REQUEST_ENABLE_BIT (0x1u)
+
+/** conversion result in a 32 bit word of the group 1 FIFO (12 bit conversion) */
+#define ADC_RESULT_VALUE_MASK (0xFFFu)
+/** position of the channel ID in a 32 bit word of the group 1 FIFO */
+#define ADC_RESULT_CHANNEL_ID_SHIFT (16u)
+/** channel ID in a 32 bit word of the group 1 FIFO (after the shift) */
+#define ADC_RESULT_CHANNEL_ID_MASK (0x1Fu)
+/** marks a slot in the DMA ring that has not yet been written by the DMA */
+#define ADC_DMA_RING_EMPTY_SLOT (0xFFFFFFFFu)
+
 /**
  * State for the ADC conversion
  */
@@ -92,6 +135,15 @@ typedef enum {
 
 /*========== Extern Function Prototypes =====================================*/
 
+/**
+ * @brief   initializes the continuous conversion into the DMA ring
+ * @details Configures the DMA channel #DMA_CHANNEL_ADC1 and starts the
+ *          continuous conversion of ADC1 group 1 if #ADC_DMA_OVERSAMPLING is
+ *          true, otherwise nothing is done.
+ *          Must be called after adcInit() and DMA_Initialize().
+ */
+extern void ADC_Initialize(void);
+
 /**
  * @brief   controls ADC measurement sequence.
  *
@@ -100,6 +152,10 @@ extern void ADC_Control(void);
 
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
+extern float_t TEST_ADC_ConvertVoltage(uint16_t adcCounts);
+extern float_t TEST_ADC_ConvertOversampledVoltage(uint32_t sumOfCounts, uint32_t numberOfConversions);
+extern void TEST_ADC_DecimateDmaRing(const volatile uint32_t *kpRing, float_t *pVoltages_mV);
+extern uint32_t *TEST_ADC_GetDmaRing(void);
 #endif
 
 #endif /* FOXBMS__ADC_H_ */
@@ -43,7 +43,7 @@
  * @file    adi_ades183x.c
  * @author  foxBMS Team
  * @date    2020-12-09 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  ADI
@@ -67,6 +67,7 @@
 #include "adi_ades183x_pec.h"
 #include "adi_ades183x_temperatures.h"
 #include "adi_ades183x_voltages.h"
+#include "afe_pipeline.h"
 #include "database.h"
 #include "ftask.h"
 #include "infinite-loop-helper.h"
@@ -111,6 +112,9 @@ static DATA_BLOCK_OPEN_WIRE_s adi_openWire = {.header.uniqueId = DATA_BLOCK_ID_O
 static ADI_ERROR_TABLE_s adi_errorTable    = {0}; /*!< init in ADI_ResetErrorTable-function */
 /**@}*/
 
+/** auxiliary conversion that has been started ahead, see #ADI_PIPELINED_STRING_MEASUREMENT */
+static AFE_PIPELINE_s adi_auxiliaryPipeline = {0};
+
 /*========== Extern Constant and Variable Definitions =======================*/
 
 ADI_STATE_s adi_stateBase = {
@@ -180,6 +184,31 @@ static bool ADI_ProcessMeasurementNotStartedState(ADI_STATE_s *adiState, AFE_REQ
  */
 static void ADI_SetFirstMeasurementCycleFinished(ADI_STATE_s *adiState);
 
+/**
+ * @brief   starts the auxiliary voltage measurement of the current string.
+ * @details All auxiliary channels are measured and one channel is measured
+ *          by the redundant auxiliary ADC.
+ * @param   adiState state of the ADI driver
+ */
+static void ADI_StartAuxiliaryMeasurement(ADI_STATE_s *adiState);
+
+/**
+ * @brief   starts the auxiliary voltage measurement of the next string ahead
+ *          of its measurement.
+ * @details Only in the pipelined measurement mode
+ *          (#ADI_PIPELINED_STRING_MEASUREMENT). The commands are sent to the
+ *          next string between two transfers of the current string.
+ * @param   adiState state of the ADI driver
+ */
+static void ADI_StartNextStringAuxiliaryMeasurement(ADI_STATE_s *adiState);
+
+/**
+ * @brief   blocks the task until a time span since a time stamp has elapsed.
+ * @param   start_ms    time stamp at which the time span started
+ * @param   duration_ms time span to wait for
+ */
+static void ADI_WaitUntilElapsed(uint32_t start_ms, uint32_t duration_ms);
+
 /*========== Static Function Implementations ================================*/
 
 static void ADI_AccessToDatabase(ADI_STATE_s *adiState) {
@@ -250,23 +279,18 @@ static bool ADI_ProcessMeasurementNotStartedState(ADI_STATE_s *adiState, AFE_REQ
 static void ADI_RunCurrentStringMeasurement(ADI_STATE_s *adiState) {
     FAS_ASSERT(adiState != NULL_PTR);
 
-    /* Start auxiliary voltage measurement, all channels */
-    ADI_CopyCommandBits(adi_cmdAdax, adi_command);
-    ADI_WriteCommandConfigurationBits(adi_command, ADI_ADAX_OW_POS, ADI_ADAX_OW_LEN, 0u);
-    ADI_WriteCommandConfigurationBits(adi_command, ADI_ADAX_PUP_POS, ADI_ADAX_PUP_LEN, 0u);
-    ADI_WriteCommandConfigurationBits(adi_command, ADI_ADAX_CH4_POS, ADI_ADAX_CH4_LEN, 0u);
-    ADI_WriteCommandConfigurationBits(adi_command, ADI_ADAX_CH03_POS, ADI_ADAX_CH03_LEN, 0u);
-    ADI_TransmitCommand(adi_command, adiState);
-    /* Start redundant auxiliary voltage measurement, one channel */
-    ADI_CopyCommandBits(adi_cmdAdax2, adi_command);
-    ADI_WriteCommandConfigurationBits(
-        adi_command,
-        ADI_ADAX2_CH03_POS,
-        ADI_ADAX2_CH03_LEN,
-        adiState->redundantAuxiliaryChannel[adiState->currentString]);
-    ADI_TransmitCommand(adi_command, adiState);
-
-    ADI_Wait(ADI_WAIT_TIME_1_FOR_ADAX_FULL_CYCLE);
+    uint32_t auxiliaryStart_ms = 0u;
+    if (ADI_PIPELINED_STRING_MEASUREMENT == true) {
+        if (AFE_PipelineTakeConversion(&adi_auxiliaryPipeline, adiState->currentString, &auxiliaryStart_ms) ==
+            false) {
+            ADI_StartAuxiliaryMeasurement(adiState);
+            auxiliaryStart_ms = OS_GetTickCount();
+        }
+        ADI_WaitUntilElapsed(auxiliaryStart_ms, ADI_WAIT_TIME_1_FOR_ADAX_FULL_CYCLE);
+    } else {
+        ADI_StartAuxiliaryMeasurement(adiState);
+        ADI_Wait(ADI_WAIT_TIME_1_FOR_ADAX_FULL_CYCLE);
+    }
 
     /* Snapshot to freeze cell voltage measurement result registers */
     ADI_CopyCommandBits(adi_cmdSnap, adi_command);
@@ -279,7 +303,14 @@ static void ADI_RunCurrentStringMeasurement(ADI_STATE_s *adiState) {
     ADI_TransmitCommand(adi_command, adiState);
 
     /* Wait until auxiliary measurement cycle is finished */
-    ADI_Wait(ADI_WAIT_TIME_2_FOR_ADAX_FULL_CYCLE);
+    if (ADI_PIPELINED_STRING_MEASUREMENT == true) {
+        /* the next string converts while this string is waited for and post-processed */
+        ADI_StartNextStringAuxiliaryMeasurement(adiState);
+        ADI_WaitUntilElapsed(
+            auxiliaryStart_ms, (ADI_WAIT_TIME_1_FOR_ADAX_FULL_CYCLE + ADI_WAIT_TIME_2_FOR_ADAX_FULL_CYCLE));
+    } else {
+        ADI_Wait(ADI_WAIT_TIME_2_FOR_ADAX_FULL_CYCLE);
+    }
 
     /* Retrieve GPIO voltages (all channels) */
     ADI_GetGpioVoltages(adiState, ADI_AUXILIARY_REGISTER, ADI_AUXILIARY_VOLTAGE);
@@ -315,6 +346,48 @@ static void ADI_SetFirstMeasurementCycleFinished(ADI_STATE_s *adiState) {
     OS_ExitTaskCritical();
 }
 
+static void ADI_StartAuxiliaryMeasurement(ADI_STATE_s *adiState) {
+    FAS_ASSERT(adiState != NULL_PTR);
+
+    /* Start auxiliary voltage measurement, all channels */
+    ADI_CopyCommandBits(adi_cmdAdax, adi_command);
+    ADI_WriteCommandConfigurationBits(adi_command, ADI_ADAX_OW_POS, ADI_ADAX_OW_LEN, 0u);
+    ADI_WriteCommandConfigurationBits(adi_command, ADI_ADAX_PUP_POS, ADI_ADAX_PUP_LEN, 0u);
+    ADI_WriteCommandConfigurationBits(adi_command, ADI_ADAX_CH4_POS, ADI_ADAX_CH4_LEN, 0u);
+    ADI_WriteCommandConfigurationBits(adi_command, ADI_ADAX_CH03_POS, ADI_ADAX_CH03_LEN, 0u);
+    ADI_TransmitCommand(adi_command, adiState);
+    /* Start redundant auxiliary voltage measurement, one channel */
+    ADI_CopyCommandBits(adi_cmdAdax2, adi_command);
+    ADI_WriteCommandConfigurationBits(
+        adi_command,
+        ADI_ADAX2_CH03_POS,
+        ADI_ADAX2_CH03_LEN,
+        adiState->redundantAuxiliaryChannel[adiState->currentString]);
+    ADI_TransmitCommand(adi_command, adiState);
+}
+
+static void ADI_StartNextStringAuxiliaryMeasurement(ADI_STATE_s *adiState) {
+    FAS_ASSERT(adiState != NULL_PTR);
+
+    const uint8_t currentString = adiState->currentString;
+    if ((ADI_PIPELINED_STRING_MEASUREMENT == true) && ((currentString + 1u) < adiState->spiNumberInterfaces)) {
+        /* commands are transmitted to the string that is addressed in the driver state */
+        adiState->currentString = currentString + 1u;
+        ADI_StartAuxiliaryMeasurement(adiState);
+        adiState->currentString = currentString;
+        AFE_PipelineStartConversion(&adi_auxiliaryPipeline, currentString + 1u, OS_GetTickCount());
+    }
+}
+
+static void ADI_WaitUntilElapsed(uint32_t start_ms, uint32_t duration_ms) {
+    /* AXIVION Routine Generic-MissingParameterAssert: start_ms: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: duration_ms: parameter accepts whole range */
+    const uint32_t remainingTime_ms = AFE_PipelineGetRemainingTime(start_ms, duration_ms, OS_GetTickCount());
+    if (remainingTime_ms > 0u) {
+        ADI_Wait(remainingTime_ms);
+    }
+}
+
 /*========== Extern Function Implementations ================================*/
 
 /* START extern functions to adapt if running in other environment (e.g., bare metal) */
@@ -377,6 +450,7 @@ extern void ADI_MeasurementCycle(ADI_STATE_s *adiState) {
                 ++adiState->currentString;
             }
             adiState->currentString = 0u;
+            AFE_PipelineReset(&adi_auxiliaryPipeline);
             if (ADI_IsFirstMeasurementCycleFinished(adiState) == false) {
                 ADI_SetFirstMeasurementCycleFinished(adiState);
             }
@@ -415,4 +489,13 @@ extern void TEST_ADI_RunCurrentStringMeasurement(ADI_STATE_s *adiState) {
 extern void TEST_ADI_SetFirstMeasurementCycleFinished(ADI_STATE_s *adiState) {
     ADI_SetFirstMeasurementCycleFinished(adiState);
 }
+extern void TEST_ADI_StartAuxiliaryMeasurement(ADI_STATE_s *adiState) {
+    ADI_StartAuxiliaryMeasurement(adiState);
+}
+extern void TEST_ADI_StartNextStringAuxiliaryMeasurement(ADI_STATE_s *adiState) {
+    ADI_StartNextStringAuxiliaryMeasurement(adiState);
+}
+extern void TEST_ADI_WaitUntilElapsed(uint32_t start_ms, uint32_t duration_ms) {
+    ADI_WaitUntilElapsed(start_ms, duration_ms);
+}
 #endif
@@ -43,7 +43,7 @@
  * @file    adi_ades183x.h
  * @author  foxBMS Team
  * @date    2015-09-01 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  ADI
@@ -114,6 +114,9 @@ extern STD_RETURN_TYPE_e TEST_ADI_GetRequest(AFE_REQUEST_e *request);
 extern bool TEST_ADI_ProcessMeasurementNotStartedState(ADI_STATE_s *adiState, AFE_REQUEST_e *request);
 extern void TEST_ADI_RunCurrentStringMeasurement(ADI_STATE_s *adiState);
 extern void TEST_ADI_SetFirstMeasurementCycleFinished(ADI_STATE_s *adiState);
+extern void TEST_ADI_StartAuxiliaryMeasurement(ADI_STATE_s *adiState);
+extern void TEST_ADI_StartNextStringAuxiliaryMeasurement(ADI_STATE_s *adiState);
+extern void TEST_ADI_WaitUntilElapsed(uint32_t start_ms, uint32_t duration_ms);
 #endif
 
 #endif /* FOXBMS__ADI_ADES183X_H_ */
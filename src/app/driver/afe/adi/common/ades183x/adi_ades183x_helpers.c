@@ -43,7 +43,7 @@
  * @file    adi_ades183x_helpers.c
  * @author  foxBMS Team
  * @date    2022-12-06 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  ADI
@@ -67,13 +67,34 @@
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
+/** number of command codes, the command code has ADI_COMMAND_CODE_LENGTH bits */
+#define ADI_NUMBER_OF_COMMAND_CODES (1u << ADI_COMMAND_CODE_LENGTH)
 
 /*========== Static Constant and Variable Definitions =======================*/
+/**
+ * @brief   PEC of the two command bytes of every command code
+ * @details The PECs are calculated once in #ADI_InitializeMeasurement,
+ *          before the first command is transmitted, so that the command
+ *          frames (command bytes and command PEC) only need to be copied into
+ *          the transmit buffer, also for commands with configuration bits.
+ */
+static uint16_t adi_commandPec[ADI_NUMBER_OF_COMMAND_CODES] = {0u};
+
+/** true if #adi_commandPec has been initialized */
+static bool adi_commandPecIsInitialized = false;
 
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
 
+/**
+ * @brief   Writes the command bytes and their PEC to the start of the
+ *          transmit buffer.
+ * @param   command     command with the two command bytes
+ * @param   pTxBuffer   transmit buffer
+ */
+static void ADI_SetCommandFrame(const uint16_t *command, uint16_t *pTxBuffer);
+
 /**
  * @brief   Increment command counter of AFE driver.
  * @param   adiState state of the driver
@@ -106,6 +127,27 @@ static void ADI_StoredConfigurationFillRegisterData(
     ADI_STATE_s *adiState);
 
 /*========== Static Function Implementations ================================*/
+static void ADI_SetCommandFrame(const uint16_t *command, uint16_t *pTxBuffer) {
+    FAS_ASSERT(command != NULL_PTR);
+    FAS_ASSERT(pTxBuffer != NULL_PTR);
+    /* the PECs are calculated on startup and not on the measurement path */
+    FAS_ASSERT(adi_commandPecIsInitialized == true);
+
+    const uint16_t commandCode = (uint16_t)((command[ADI_COMMAND_BYTE0_POSITION] << ADI_BYTE_SHIFT) |
+                                            command[ADI_COMMAND_BYTE1_POSITION]);
+    FAS_ASSERT(commandCode < ADI_NUMBER_OF_COMMAND_CODES);
+    /**
+     *  SM_SPI_PEC: SPI Packet Error Code
+     *  PEC for command, calculated on startup.
+     */
+    const uint16_t pec = adi_commandPec[commandCode];
+
+    pTxBuffer[ADI_COMMAND_FIRST_BYTE_POSITION]      = command[ADI_COMMAND_BYTE0_POSITION];
+    pTxBuffer[ADI_COMMAND_SECOND_BYTE_POSITION]     = command[ADI_COMMAND_BYTE1_POSITION];
+    pTxBuffer[ADI_COMMAND_PEC_FIRST_BYTE_POSITION]  = (uint8_t)((pec >> ADI_BYTE_SHIFT) & ADI_ONE_BYTE_MASK);
+    pTxBuffer[ADI_COMMAND_PEC_SECOND_BYTE_POSITION] = (uint8_t)(pec & ADI_ONE_BYTE_MASK);
+}
+
 static void ADI_StoredConfigurationFillRegisterData(
     uint8_t module,
     ADI_CFG_REGISTER_SET_e registerSet,
@@ -298,29 +340,17 @@ extern void ADI_ReadRegister(uint16_t *registerToRead, uint8_t *data, ADI_STATE_
     uint16_t spiFrameLength = registerLengthInBytes + ADI_PEC_SIZE_IN_BYTES;
     uint16_t dataLength     = registerLengthInBytes;
 
-    for (uint16_t i = 0; i < ADI_N_BYTES_FOR_DATA_TRANSMISSION; i++) {
-        adiState->data.txBuffer[i] = 0x0;
-    }
-
-    /**
-     *  SM_SPI_PEC: SPI Packet Error Code
-     *  Calculate PEC for command.
-     */
-    /* Compute PEC of the two command bytes */
-    PEC_Check[ADI_COMMAND_FIRST_BYTE_POSITION]  = (uint8_t)registerToRead[ADI_COMMAND_FIRST_BYTE_POSITION];
-    PEC_Check[ADI_COMMAND_SECOND_BYTE_POSITION] = (uint8_t)registerToRead[ADI_COMMAND_SECOND_BYTE_POSITION];
-    PEC_result                                  = ADI_Pec15(ADI_COMMAND_SIZE_IN_BYTES, PEC_Check);
-
-    adiState->data.txBuffer[ADI_COMMAND_FIRST_BYTE_POSITION]  = registerToRead[ADI_COMMAND_FIRST_BYTE_POSITION];
-    adiState->data.txBuffer[ADI_COMMAND_SECOND_BYTE_POSITION] = registerToRead[ADI_COMMAND_SECOND_BYTE_POSITION];
-    adiState->data.txBuffer[ADI_COMMAND_PEC_FIRST_BYTE_POSITION] =
-        (uint8_t)((PEC_result >> ADI_BYTE_SHIFT) & ADI_ONE_BYTE_MASK);
-    adiState->data.txBuffer[ADI_COMMAND_PEC_SECOND_BYTE_POSITION] = (uint8_t)(PEC_result & ADI_ONE_BYTE_MASK);
-
     /* 4u: two bytes command + two bytes command PEC */
     /* Register length + 2u: The two additional bytes correspond to the PEC */
     uint16_t frameLength = ADI_COMMAND_AND_PEC_SIZE_IN_BYTES +
                            ((registerLengthInBytes + ADI_PEC_SIZE_IN_BYTES) * ADI_N_ADI);
+
+    ADI_SetCommandFrame(registerToRead, adiState->data.txBuffer);
+    /* Only the transmitted part of the buffer is padded, the rest is not sent */
+    for (uint16_t i = ADI_COMMAND_AND_PEC_SIZE_IN_BYTES; i < frameLength; i++) {
+        adiState->data.txBuffer[i] = 0x0;
+    }
+
     ADI_SpiTransmitReceiveData(adiState, adiState->data.txBuffer, adiState->data.rxBuffer, (uint32_t)frameLength);
 
     for (uint16_t i = 0; i < ADI_N_ADI; i++) {
@@ -481,22 +511,7 @@ extern void ADI_TransmitCommand(uint16_t *command, ADI_STATE_s *adiState) {
     FAS_ASSERT(command != NULL_PTR);
     FAS_ASSERT(adiState != NULL_PTR);
 
-    uint8_t PEC_Check[ADI_MAX_REGISTER_SIZE_IN_BYTES] = {0};
-    uint16_t PEC_result                               = 0u;
-
-    /**
-     *  SM_SPI_PEC: SPI Packet Error Code
-     *  Calculate PEC for command.
-     */
-    PEC_Check[ADI_COMMAND_FIRST_BYTE_POSITION]  = (uint8_t)command[ADI_COMMAND_BYTE0_POSITION];
-    PEC_Check[ADI_COMMAND_SECOND_BYTE_POSITION] = (uint8_t)command[ADI_COMMAND_BYTE1_POSITION];
-    PEC_result                                  = ADI_Pec15(ADI_COMMAND_SIZE_IN_BYTES, PEC_Check);
-
-    adiState->data.txBuffer[ADI_COMMAND_FIRST_BYTE_POSITION]  = command[ADI_COMMAND_BYTE0_POSITION];
-    adiState->data.txBuffer[ADI_COMMAND_SECOND_BYTE_POSITION] = command[ADI_COMMAND_BYTE1_POSITION];
-    adiState->data.txBuffer[ADI_COMMAND_PEC_FIRST_BYTE_POSITION] =
-        (uint8_t)((PEC_result >> ADI_BYTE_SHIFT) & ADI_ONE_BYTE_MASK);
-    adiState->data.txBuffer[ADI_COMMAND_PEC_SECOND_BYTE_POSITION] = (uint8_t)(PEC_result & ADI_ONE_BYTE_MASK);
+    ADI_SetCommandFrame(command, adiState->data.txBuffer);
 
     ADI_SpiTransmitReceiveData(adiState, adiState->data.txBuffer, NULL_PTR, ADI_COMMAND_AND_PEC_SIZE_IN_BYTES);
 
@@ -544,6 +559,17 @@ extern void ADI_StoredConfigurationWriteToAfeGlobal(ADI_STATE_s *adiState) {
     }
 }
 
+extern void ADI_InitializeCommandCache(void) {
+    for (uint16_t commandCode = 0u; commandCode < ADI_NUMBER_OF_COMMAND_CODES; commandCode++) {
+        uint8_t PEC_Check[ADI_COMMAND_SIZE_IN_BYTES] = {
+            (uint8_t)((commandCode >> ADI_BYTE_SHIFT) & ADI_ONE_BYTE_MASK),
+            (uint8_t)(commandCode & ADI_ONE_BYTE_MASK),
+        };
+        adi_commandPec[commandCode] = ADI_Pec15(ADI_COMMAND_SIZE_IN_BYTES, PEC_Check);
+    }
+    adi_commandPecIsInitialized = true;
+}
+
 extern void ADI_ClearCommandCounter(ADI_STATE_s *adiState) {
     FAS_ASSERT(adiState != NULL_PTR);
 
@@ -600,25 +626,9 @@ extern void ADI_WriteRegister(
     uint16_t spiFrameLength                                 = registerLengthInBytes + 2u;
     uint16_t dataLength                                     = registerLengthInBytes;
 
-    /**
-     *  SM_SPI_PEC: SPI Packet Error Code
-     *  Calculate PEC for command.
-     */
-    /* Compute PEC of the two command bytes */
-    PEC_Check[ADI_COMMAND_FIRST_BYTE_POSITION]  = (uint8_t)registerToWrite[ADI_COMMAND_FIRST_BYTE_POSITION];
-    PEC_Check[ADI_COMMAND_SECOND_BYTE_POSITION] = (uint8_t)registerToWrite[ADI_COMMAND_SECOND_BYTE_POSITION];
-    PEC_result                                  = ADI_Pec15(ADI_COMMAND_SIZE_IN_BYTES, PEC_Check);
-
-    adiState->data.txBuffer[ADI_COMMAND_FIRST_BYTE_POSITION]  = registerToWrite[ADI_COMMAND_FIRST_BYTE_POSITION];
-    adiState->data.txBuffer[ADI_COMMAND_SECOND_BYTE_POSITION] = registerToWrite[ADI_COMMAND_SECOND_BYTE_POSITION];
+    ADI_SetCommandFrame(registerToWrite, adiState->data.txBuffer);
     if (pecFaultInjection == ADI_COMMAND_PEC_FAULT_INJECTION) {
-        adiState->data.txBuffer[ADI_COMMAND_PEC_FIRST_BYTE_POSITION] = (PEC_result >> ADI_BYTE_SHIFT) &
-                                                                       ADI_ONE_BYTE_MASK;
-        adiState->data.txBuffer[ADI_COMMAND_PEC_SECOND_BYTE_POSITION] = (PEC_result & ADI_ONE_BYTE_MASK) + 1u;
-    } else {
-        adiState->data.txBuffer[ADI_COMMAND_PEC_FIRST_BYTE_POSITION] = (PEC_result >> ADI_BYTE_SHIFT) &
-                                                                       ADI_ONE_BYTE_MASK;
-        adiState->data.txBuffer[ADI_COMMAND_PEC_SECOND_BYTE_POSITION] = PEC_result & ADI_ONE_BYTE_MASK;
+        adiState->data.txBuffer[ADI_COMMAND_PEC_SECOND_BYTE_POSITION] += 1u;
     }
 
     for (uint16_t i = 0u; i < ADI_N_ADI; i++) {
@@ -687,5 +697,11 @@ extern void TEST_ADI_StoredConfigurationFillRegisterData(
 extern void TEST_ADI_IncrementCommandCounter(ADI_STATE_s *adiState) {
     ADI_IncrementCommandCounter(adiState);
 }
+extern void TEST_ADI_SetCommandFrame(const uint16_t *command, uint16_t *pTxBuffer) {
+    ADI_SetCommandFrame(command, pTxBuffer);
+}
+extern void TEST_ADI_ResetCommandCache(void) {
+    adi_commandPecIsInitialized = false;
+}
 
 #endif
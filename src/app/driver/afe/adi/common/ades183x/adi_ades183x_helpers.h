@@ -43,7 +43,7 @@
  * @file    adi_ades183x_helpers.h
  * @author  foxBMS Team
  * @date    2022-12-06 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  ADI
@@ -69,6 +69,15 @@
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   initializes the command frame cache.
+ * @details Calculates the PEC of every command code once, so that the
+ *          transmission of a command only copies the command bytes and the
+ *          cached PEC into the transmit buffer. Has to be called before the
+ *          first command is transmitted (see #ADI_InitializeMeasurement).
+ */
+extern void ADI_InitializeCommandCache(void);
+
 /**
  * @brief   send command to the ades183x daisy-chain (e.g., start voltage
  *          measurement).
@@ -274,6 +283,8 @@ extern void TEST_ADI_StoredConfigurationFillRegisterData(
     uint8_t mask,
     ADI_STATE_s *adiState);
 extern void TEST_ADI_IncrementCommandCounter(ADI_STATE_s *adiState);
+extern void TEST_ADI_SetCommandFrame(const uint16_t *command, uint16_t *pTxBuffer);
+extern void TEST_ADI_ResetCommandCache(void);
 #endif
 
 #endif /* FOXBMS__ADI_ADES183X_HELPERS_H_ */
@@ -43,7 +43,7 @@
  * @file    adi_ades183x_initialization.c
  * @author  foxBMS Team
  * @date    2019-08-27 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVER
  * @prefix  ADI
@@ -516,6 +516,7 @@ extern void ADI_InitializeMeasurement(ADI_STATE_s *adiState) {
     adiState->currentString       = 0u;
 
     ADI_ResetErrorTable(adiState);
+    ADI_InitializeCommandCache();
 
     while (adiState->currentString < adiState->spiNumberInterfaces) {
         adiState->redundantAuxiliaryChannel[adiState->currentString] = ADI_START_AUX_CHANNEL;
@@ -43,7 +43,7 @@
  * @file    adi_ades183x_voltages.c
  * @author  foxBMS Team
  * @date    2019-08-27 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup SOME_GROUP
  * @prefix  ADI
@@ -62,6 +62,7 @@
 #include "adi_ades183x_commands_voltages.h"
 #include "adi_ades183x_diagnostic.h"
 #include "adi_ades183x_helpers.h"
+#include "afe_plausibility.h"
 #include "fassert.h"
 
 #include <math.h>
@@ -71,6 +72,11 @@
 /*========== Macros and Definitions =========================================*/
 
 /*========== Static Constant and Variable Definitions =======================*/
+/** plausible cell voltage values: input range of the C-ADC of the ADES183x */
+static const AFE_PLAUSIBILITY_VALUES_s adi_plausibleCellVoltages = {
+    .maximumPlausibleVoltage_mV = 5500,
+    .minimumPlausibleVoltage_mV = -2500,
+};
 
 /*========== Extern Constant and Variable Definitions =======================*/
 
@@ -233,11 +239,6 @@ static void ADI_SaveRxToCellVoltageBuffer(
     uint16_t bufferLSB                       = 0u;
     uint16_t bufferMSB                       = 0u;
     DATA_BLOCK_CELL_VOLTAGE_s *pVoltageTable = NULL_PTR;
-    static uint16_t numberValidMeasurements  = 0;
-
-    if ((storeLocation == ADI_CELL_VOLTAGE) && (registerSet == ADI_RESULT_REGISTER_SET_A)) {
-        numberValidMeasurements = 0u;
-    }
 
     switch (storeLocation) {
         case ADI_CELL_VOLTAGE:
@@ -330,11 +331,10 @@ static void ADI_SaveRxToCellVoltageBuffer(
                         if (storeLocation == ADI_CELL_VOLTAGE) {
                             if (ADI_EvaluateDiagnosticCellVoltages(adiState, m) == false) {
                                 adiState->data.cellVoltage->invalidCellVoltage[adiState->currentString][m] |=
-                                    (0x01u << storedVoltageIndex);
+                                    ((uint64_t)0x01u << storedVoltageIndex);
                             } else {
                                 adiState->data.cellVoltage->invalidCellVoltage[adiState->currentString][m] &=
-                                    (~0x01u << storedVoltageIndex);
-                                numberValidMeasurements++;
+                                    ~((uint64_t)0x01u << storedVoltageIndex);
                             }
                         }
                     }
@@ -343,7 +343,21 @@ static void ADI_SaveRxToCellVoltageBuffer(
         }
     }
     if ((storeLocation == ADI_CELL_VOLTAGE) && (registerSet == ADI_RESULT_REGISTER_SET_F)) {
-        adiState->data.cellVoltage->nrValidCellVoltages[adiState->currentString] = numberValidMeasurements;
+        /* All cell voltages of the string are stored: range check and calculation of the string values */
+        AFE_CELL_VOLTAGE_ACCUMULATOR_s accumulator = {.stringVoltage_mV = 0, .numberOfValidCellVoltages = 0u};
+        for (uint16_t m = 0u; m < ADI_N_ADI; m++) {
+            adiState->data.cellVoltage->invalidCellVoltage[adiState->currentString][m] =
+                AFE_PlausibilityCheckModuleCellVoltages(
+                    adiState->data.cellVoltage->cellVoltage_mV[adiState->currentString][m],
+                    BS_NR_OF_CELL_BLOCKS_PER_MODULE,
+                    NULL_PTR,
+                    adiState->data.cellVoltage->invalidCellVoltage[adiState->currentString][m],
+                    adi_plausibleCellVoltages,
+                    &accumulator);
+        }
+        adiState->data.cellVoltage->stringVoltage_mV[adiState->currentString] = accumulator.stringVoltage_mV;
+        adiState->data.cellVoltage->nrValidCellVoltages[adiState->currentString] =
+            accumulator.numberOfValidCellVoltages;
     }
 }
 
@@ -43,7 +43,7 @@
  * @file    adi_ades183x_cfg.h
  * @author  foxBMS Team
  * @date    2020-12-09 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS_CONFIGURATION
  * @prefix  ADI
@@ -71,6 +71,18 @@
 #error "ADI_DISCARD_PEC can only have the value true of false"
 #endif
 
+/**
+ * Pipelined measurement of multiple strings (true) or strictly sequential
+ * measurement (false). In the pipelined mode, the auxiliary measurement of
+ * the next string is started as soon as the cell voltages of the current
+ * string have been read, so that it runs while the current string is
+ * post-processed (GPIO voltages, temperatures, balancing, diagnostic).
+ */
+#define ADI_PIPELINED_STRING_MEASUREMENT (false)
+#if !((ADI_PIPELINED_STRING_MEASUREMENT == false) || (ADI_PIPELINED_STRING_MEASUREMENT == true))
+#error "ADI_PIPELINED_STRING_MEASUREMENT can only have the value true or false"
+#endif
+
 /** Index of the SPI used by the ADI driver */
 #define ADI_SPI_INDEX (SPI_SPI1_INDEX)
 
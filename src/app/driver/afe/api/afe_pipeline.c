@@ -0,0 +1,117 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    afe_pipeline.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup MODULES
+ * @prefix  AFE
+ *
+ * @brief   Bookkeeping for the pipelined measurement of multiple strings
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "afe_pipeline.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+
+/*========== Static Function Implementations ================================*/
+
+/*========== Extern Function Implementations ================================*/
+extern void AFE_PipelineReset(AFE_PIPELINE_s *pPipeline) {
+    FAS_ASSERT(pPipeline != NULL_PTR);
+    pPipeline->conversionStarted  = false;
+    pPipeline->stringNumber       = 0u;
+    pPipeline->conversionStart_ms = 0u;
+}
+
+extern void AFE_PipelineStartConversion(AFE_PIPELINE_s *pPipeline, uint8_t stringNumber, uint32_t timestamp_ms) {
+    FAS_ASSERT(pPipeline != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: stringNumber: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: timestamp_ms: parameter accepts whole range */
+    pPipeline->conversionStarted  = true;
+    pPipeline->stringNumber       = stringNumber;
+    pPipeline->conversionStart_ms = timestamp_ms;
+}
+
+extern bool AFE_PipelineTakeConversion(AFE_PIPELINE_s *pPipeline, uint8_t stringNumber, uint32_t *pConversionStart_ms) {
+    FAS_ASSERT(pPipeline != NULL_PTR);
+    FAS_ASSERT(pConversionStart_ms != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: stringNumber: parameter accepts whole range */
+
+    bool conversionStarted = false;
+    if ((pPipeline->conversionStarted == true) && (pPipeline->stringNumber == stringNumber)) {
+        *pConversionStart_ms = pPipeline->conversionStart_ms;
+        conversionStarted    = true;
+    }
+    AFE_PipelineReset(pPipeline);
+    return conversionStarted;
+}
+
+extern uint32_t AFE_PipelineGetRemainingTime(uint32_t start_ms, uint32_t duration_ms, uint32_t timestamp_ms) {
+    /* AXIVION Routine Generic-MissingParameterAssert: start_ms: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: duration_ms: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: timestamp_ms: parameter accepts whole range */
+    /* unsigned arithmetic handles the overflow of the time stamps */
+    const uint32_t elapsed_ms = timestamp_ms - start_ms;
+    uint32_t remainingTime_ms = 0u;
+    if (elapsed_ms < duration_ms) {
+        remainingTime_ms = duration_ms - elapsed_ms;
+    }
+    return remainingTime_ms;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+#endif
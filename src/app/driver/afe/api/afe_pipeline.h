@@ -0,0 +1,130 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    afe_pipeline.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup MODULES
+ * @prefix  AFE
+ *
+ * @brief   Bookkeeping for the pipelined measurement of multiple strings
+ * @details The AFE drivers measure the strings one after the other. In the
+ *          pipelined measurement mode, a driver starts the conversion of
+ *          the next string while it is still busy with the readout and the
+ *          post-processing of the current string. When the driver then
+ *          continues with the next string, it only has to wait for the
+ *          remaining conversion time.
+ *          The drivers share one SPI interface and issue all transfers from
+ *          the same task, therefore a conversion is started only between two
+ *          transfers of the current string.
+ */
+
+#ifndef FOXBMS__AFE_PIPELINE_H_
+#define FOXBMS__AFE_PIPELINE_H_
+
+/*========== Includes =======================================================*/
+
+#include "fassert.h"
+#include "fstd_types.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** conversion that has been started ahead of the measurement of its string */
+typedef struct {
+    bool conversionStarted;      /*!< true if a conversion has been started ahead */
+    uint8_t stringNumber;        /*!< string in which the conversion has been started */
+    uint32_t conversionStart_ms; /*!< time stamp at which the conversion has been started */
+} AFE_PIPELINE_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   Discards a conversion that has been started ahead
+ * @details Has to be called when a measurement cycle is (re-)started, so that
+ *          a conversion of a previous cycle is not used.
+ * @param   pPipeline   pipeline of the driver
+ */
+extern void AFE_PipelineReset(AFE_PIPELINE_s *pPipeline);
+
+/**
+ * @brief   Stores that the conversion of a string has been started ahead
+ * @param   pPipeline       pipeline of the driver
+ * @param   stringNumber    string in which the conversion has been started
+ * @param   timestamp_ms    time stamp of the start of the conversion
+ */
+extern void AFE_PipelineStartConversion(AFE_PIPELINE_s *pPipeline, uint8_t stringNumber, uint32_t timestamp_ms);
+
+/**
+ * @brief   Takes the conversion of a string from the pipeline
+ * @details The pipeline is empty afterwards. A conversion of another string
+ *          is discarded.
+ * @param   pPipeline           pipeline of the driver
+ * @param   stringNumber        string that is measured next
+ * @param   pConversionStart_ms time stamp of the start of the conversion,
+ *                              only set if the conversion has been started
+ *                              ahead
+ * @return  true if the conversion of the string has been started ahead,
+ *          false if the driver has to start the conversion itself
+ */
+extern bool AFE_PipelineTakeConversion(AFE_PIPELINE_s *pPipeline, uint8_t stringNumber, uint32_t *pConversionStart_ms);
+
+/**
+ * @brief   Calculates the time that is left until a duration has elapsed
+ * @details The calculation handles an overflow of the time stamps.
+ * @param   start_ms        time stamp of the start of the duration
+ * @param   duration_ms     duration
+ * @param   timestamp_ms    current time stamp
+ * @return  remaining time in ms, 0 if the duration has already elapsed
+ */
+extern uint32_t AFE_PipelineGetRemainingTime(uint32_t start_ms, uint32_t duration_ms, uint32_t timestamp_ms);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+#endif
+
+#endif /* FOXBMS__AFE_PIPELINE_H_ */
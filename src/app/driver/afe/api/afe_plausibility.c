@@ -43,7 +43,7 @@
  * @file    afe_plausibility.c
  * @author  foxBMS Team
  * @date    2019-01-24 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup MODULES
  * @prefix  AFE
@@ -57,6 +57,7 @@
 
 #include "tsi.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
@@ -86,6 +87,64 @@ extern STD_RETURN_TYPE_e AFE_PlausibilityCheckVoltageMeasurementRange(
     return retval;
 }
 
+extern uint64_t AFE_PlausibilityCheckModuleCellVoltages(
+    const int16_t *const pCellVoltages_mV,
+    uint8_t numberOfCellBlocks,
+    const uint8_t *const pOpenWire,
+    uint64_t invalidCellVoltages,
+    const AFE_PLAUSIBILITY_VALUES_s plausibleValues,
+    AFE_CELL_VOLTAGE_ACCUMULATOR_s *pAccumulator) {
+    FAS_ASSERT(pCellVoltages_mV != NULL_PTR);
+    FAS_ASSERT(numberOfCellBlocks <= AFE_PLAUSIBILITY_MAXIMUM_CELL_BLOCKS_PER_MODULE);
+    /* AXIVION Routine Generic-MissingParameterAssert: pOpenWire: NULL_PTR if no open-wire state is available */
+    /* AXIVION Routine Generic-MissingParameterAssert: invalidCellVoltages: parameter accepts whole range */
+    FAS_ASSERT(plausibleValues.maximumPlausibleVoltage_mV > plausibleValues.minimumPlausibleVoltage_mV);
+    FAS_ASSERT(pAccumulator != NULL_PTR);
+
+    /* Evaluate all cell blocks of the module at once:
+     *
+     * 1. a cell block is invalid if it has already been invalidated (e.g., PEC error) or if its lower or its upper
+     *    input is an open wire
+     * 2. perform the minimum/maximum measurement range check with integer comparisons
+     * 3. accumulate the valid cell voltages without branching on the validity of the cell block
+     */
+    const int32_t maximum_mV = plausibleValues.maximumPlausibleVoltage_mV;
+    const int32_t minimum_mV = plausibleValues.minimumPlausibleVoltage_mV;
+    uint64_t invalid         = invalidCellVoltages;
+    uint64_t cellBlockBit    = 1u;
+    uint32_t lowerInputOpen  = 0u;
+    if (pOpenWire != NULL_PTR) {
+        lowerInputOpen = (uint32_t)(pOpenWire[0u] != 0u);
+    }
+    int32_t sum_mV       = 0;
+    uint16_t numberValid = 0u;
+    for (uint8_t cb = 0u; cb < numberOfCellBlocks; cb++) {
+        uint32_t upperInputOpen = 0u;
+        if (pOpenWire != NULL_PTR) {
+            upperInputOpen = (uint32_t)(pOpenWire[cb + 1u] != 0u);
+        }
+        const int32_t cellVoltage_mV      = pCellVoltages_mV[cb];
+        const uint32_t aboveMaximum       = (uint32_t)(cellVoltage_mV > maximum_mV);
+        const uint32_t belowMinimum       = (uint32_t)(cellVoltage_mV < minimum_mV);
+        const uint32_t alreadyInvalid     = (uint32_t)((invalidCellVoltages & cellBlockBit) != 0u);
+        const uint32_t cellBlockIsInvalid = alreadyInvalid | lowerInputOpen | upperInputOpen | aboveMaximum |
+                                            belowMinimum;
+
+        /* validMask is all ones for a valid and zero for an invalid cell block */
+        const int32_t validMask = (int32_t)cellBlockIsInvalid - 1;
+        invalid |= cellBlockBit & (uint64_t)(-(int64_t)cellBlockIsInvalid);
+        sum_mV += cellVoltage_mV & validMask;
+        numberValid += (uint16_t)(cellBlockIsInvalid ^ 1u);
+
+        lowerInputOpen = upperInputOpen;
+        cellBlockBit <<= 1u;
+    }
+    pAccumulator->stringVoltage_mV += sum_mV;
+    pAccumulator->numberOfValidCellVoltages += numberValid;
+
+    return invalid;
+}
+
 extern STD_RETURN_TYPE_e AFE_PlausibilityCheckTempMinMax(const int16_t cellTemperature_ddegC) {
     STD_RETURN_TYPE_e retval = STD_OK;
 
@@ -43,7 +43,7 @@
  * @file    afe_plausibility.h
  * @author  foxBMS Team
  * @date    2019-01-24 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup MODULES
  * @prefix  AFE
@@ -60,6 +60,7 @@
 #include "fassert.h"
 #include "fstd_types.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
@@ -82,6 +83,19 @@ typedef struct {
     const int16_t minimumPlausibleVoltage_mV;
 } AFE_PLAUSIBILITY_VALUES_s;
 
+/** maximum number of cell blocks per module that fit into the bitmask of invalid cell voltages */
+#define AFE_PLAUSIBILITY_MAXIMUM_CELL_BLOCKS_PER_MODULE (64u)
+
+/**
+ * @brief   sum and number of the valid cell voltages of a string
+ * @details The values are accumulated module by module by
+ *          #AFE_PlausibilityCheckModuleCellVoltages().
+ */
+typedef struct {
+    int32_t stringVoltage_mV;           /*!< sum of the valid cell voltages, unit: mV */
+    uint16_t numberOfValidCellVoltages; /*!< number of valid cell voltages */
+} AFE_CELL_VOLTAGE_ACCUMULATOR_s;
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
@@ -98,6 +112,39 @@ extern STD_RETURN_TYPE_e AFE_PlausibilityCheckVoltageMeasurementRange(
     const int16_t cellVoltage_mV,
     const AFE_PLAUSIBILITY_VALUES_s plausibleValues);
 
+/**
+ * @brief   Cell voltage plausibility check of all cell blocks of a module
+ * @details A cell voltage is invalid if it has already been marked as
+ *          invalid (e.g., because of a PEC error), if one of the two inputs
+ *          of the cell block is an open wire or if it is out of the plausible
+ *          measurement range. The valid cell voltages are added to the
+ *          accumulator.
+ *          The module is evaluated with bitmasks and integer comparisons
+ *          instead of one branch per cell block.
+ *
+ * @param  pCellVoltages_mV     cell voltages of the module in mV
+ * @param  numberOfCellBlocks   number of cell blocks of the module, at most
+ *                              #AFE_PLAUSIBILITY_MAXIMUM_CELL_BLOCKS_PER_MODULE
+ * @param  pOpenWire            open-wire state of the numberOfCellBlocks + 1
+ *                              inputs of the module (0: ok, else: open wire)
+ *                              or #NULL_PTR if no open-wire state is available
+ * @param  invalidCellVoltages  bitmask of the cell voltages that are already
+ *                              invalid (bit set: invalid)
+ * @param  plausibleValues      struct of type #AFE_PLAUSIBILITY_VALUES_s with
+ *                              the plausible limits of cell voltages
+ * @param  pAccumulator         sum and number of the valid cell voltages of
+ *                              the string
+ *
+ * @return bitmask of the invalid cell voltages of the module
+ */
+extern uint64_t AFE_PlausibilityCheckModuleCellVoltages(
+    const int16_t *const pCellVoltages_mV,
+    uint8_t numberOfCellBlocks,
+    const uint8_t *const pOpenWire,
+    uint64_t invalidCellVoltages,
+    const AFE_PLAUSIBILITY_VALUES_s plausibleValues,
+    AFE_CELL_VOLTAGE_ACCUMULATOR_s *pAccumulator);
+
 /**
  * @brief  Cell temperature plausibility check
  *
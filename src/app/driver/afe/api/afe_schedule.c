@@ -0,0 +1,156 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    afe_schedule.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup MODULES
+ * @prefix  AFE
+ *
+ * @brief   Multi-rate measurement schedule of the AFE drivers
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "afe_schedule.h"
+
+#include "afe_schedule_cfg.h"
+
+#include "os.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** true if the boost rates have been requested */
+static bool afe_scheduleBoostRequested = false;
+
+/*========== Extern Constant and Variable Definitions =======================*/
+const AFE_SCHEDULE_CONFIG_s afe_scheduleConfig = {
+    .temperatureDivider      = AFE_SCHEDULE_TEMPERATURE_DIVIDER,
+    .temperatureDividerBoost = AFE_SCHEDULE_TEMPERATURE_DIVIDER_BOOST,
+    .openWirePeriod_ms       = AFE_SCHEDULE_OPEN_WIRE_PERIOD_ms,
+    .openWirePeriodBoost_ms  = AFE_SCHEDULE_OPEN_WIRE_PERIOD_BOOST_ms,
+};
+
+/*========== Static Function Prototypes =====================================*/
+
+/*========== Static Function Implementations ================================*/
+
+/*========== Extern Function Implementations ================================*/
+extern void AFE_ScheduleInitialize(
+    AFE_SCHEDULE_s *pSchedule,
+    const AFE_SCHEDULE_CONFIG_s *pConfig,
+    uint32_t timestamp_ms) {
+    FAS_ASSERT(pSchedule != NULL_PTR);
+    FAS_ASSERT(pConfig != NULL_PTR);
+    FAS_ASSERT(pConfig->temperatureDivider > 0u);
+    FAS_ASSERT(pConfig->temperatureDividerBoost > 0u);
+    /* AXIVION Routine Generic-MissingParameterAssert: timestamp_ms: parameter accepts whole range */
+
+    pSchedule->pConfig = pConfig;
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        pSchedule->voltageMeasurementsSinceTemperature[s] = 0u;
+        pSchedule->lastOpenWireCheck_ms[s]                = timestamp_ms;
+    }
+}
+
+extern bool AFE_ScheduleIsTemperatureMeasurementDue(AFE_SCHEDULE_s *pSchedule, uint8_t stringNumber) {
+    FAS_ASSERT(pSchedule != NULL_PTR);
+    FAS_ASSERT(pSchedule->pConfig != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+
+    uint8_t divider = pSchedule->pConfig->temperatureDivider;
+    if (AFE_ScheduleIsBoosted() == true) {
+        divider = pSchedule->pConfig->temperatureDividerBoost;
+    }
+
+    /* a smaller divider (e.g., on boost) takes effect with the next measurement */
+    const bool isDue = (pSchedule->voltageMeasurementsSinceTemperature[stringNumber] == 0u);
+    pSchedule->voltageMeasurementsSinceTemperature[stringNumber]++;
+    if (pSchedule->voltageMeasurementsSinceTemperature[stringNumber] >= divider) {
+        pSchedule->voltageMeasurementsSinceTemperature[stringNumber] = 0u;
+    }
+    return isDue;
+}
+
+extern bool AFE_ScheduleIsOpenWireCheckDue(AFE_SCHEDULE_s *pSchedule, uint8_t stringNumber, uint32_t timestamp_ms) {
+    FAS_ASSERT(pSchedule != NULL_PTR);
+    FAS_ASSERT(pSchedule->pConfig != NULL_PTR);
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    /* AXIVION Routine Generic-MissingParameterAssert: timestamp_ms: parameter accepts whole range */
+
+    uint32_t period_ms = pSchedule->pConfig->openWirePeriod_ms;
+    if (AFE_ScheduleIsBoosted() == true) {
+        period_ms = pSchedule->pConfig->openWirePeriodBoost_ms;
+    }
+
+    bool isDue = false;
+    /* unsigned arithmetic handles the overflow of the time stamps */
+    if ((period_ms > 0u) && ((timestamp_ms - pSchedule->lastOpenWireCheck_ms[stringNumber]) >= period_ms)) {
+        pSchedule->lastOpenWireCheck_ms[stringNumber] = timestamp_ms;
+        isDue                                        = true;
+    }
+    return isDue;
+}
+
+extern void AFE_ScheduleRequestBoost(bool boost) {
+    /* AXIVION Routine Generic-MissingParameterAssert: boost: parameter accepts whole range */
+    OS_EnterTaskCritical();
+    afe_scheduleBoostRequested = boost;
+    OS_ExitTaskCritical();
+}
+
+extern bool AFE_ScheduleIsBoosted(void) {
+    OS_EnterTaskCritical();
+    const bool isBoosted = afe_scheduleBoostRequested;
+    OS_ExitTaskCritical();
+    return isBoosted;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+#endif
@@ -0,0 +1,150 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    afe_schedule.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup MODULES
+ * @prefix  AFE
+ *
+ * @brief   Multi-rate measurement schedule of the AFE drivers
+ * @details The AFE drivers measure the cell voltages of a string in every
+ *          measurement cycle. The drivers ask the schedule after each cell
+ *          voltage measurement of a string whether the temperatures have to
+ *          be measured and at the end of the measurement cycle of a string
+ *          whether the open-wire check has to be run. The rates are set in
+ *          afe_schedule_cfg.h.
+ *          When the safe operating area limits are approached, the
+ *          application requests a boost of the schedule
+ *          (#AFE_ScheduleRequestBoost()) and the boost rates are used.
+ */
+
+#ifndef FOXBMS__AFE_SCHEDULE_H_
+#define FOXBMS__AFE_SCHEDULE_H_
+
+/*========== Includes =======================================================*/
+#include "battery_system_cfg.h"
+
+#include "fassert.h"
+#include "fstd_types.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** rates of the multi-rate measurement schedule */
+typedef struct {
+    uint8_t temperatureDivider;      /*!< temperatures are measured with every Nth cell voltage measurement */
+    uint8_t temperatureDividerBoost; /*!< divider of the temperature measurement while boosted */
+    uint32_t openWirePeriod_ms;      /*!< period of the open-wire check, 0 disables the check */
+    uint32_t openWirePeriodBoost_ms; /*!< period of the open-wire check while boosted, 0 disables the check */
+} AFE_SCHEDULE_CONFIG_s;
+
+/** state of the multi-rate measurement schedule of a driver */
+typedef struct {
+    const AFE_SCHEDULE_CONFIG_s *pConfig;                          /*!< rates of the schedule */
+    uint8_t voltageMeasurementsSinceTemperature[BS_NR_OF_STRINGS]; /*!< counter for the temperature divider */
+    uint32_t lastOpenWireCheck_ms[BS_NR_OF_STRINGS];               /*!< time stamp of the last open-wire check */
+} AFE_SCHEDULE_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+/** rates of the schedule as configured in afe_schedule_cfg.h */
+extern const AFE_SCHEDULE_CONFIG_s afe_scheduleConfig;
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   Initializes the schedule of a driver
+ * @details The temperatures are measured with the first cell voltage
+ *          measurement of each string, the first open-wire check is run one
+ *          period after the initialization.
+ * @param   pSchedule       schedule of the driver
+ * @param   pConfig         rates of the schedule
+ * @param   timestamp_ms    current time stamp
+ */
+extern void AFE_ScheduleInitialize(
+    AFE_SCHEDULE_s *pSchedule,
+    const AFE_SCHEDULE_CONFIG_s *pConfig,
+    uint32_t timestamp_ms);
+
+/**
+ * @brief   Decides whether the temperatures of a string are measured
+ * @details Has to be called once after every cell voltage measurement of the
+ *          string.
+ * @param   pSchedule       schedule of the driver
+ * @param   stringNumber    string that has been measured
+ * @return  true if the temperatures have to be measured, false otherwise
+ */
+extern bool AFE_ScheduleIsTemperatureMeasurementDue(AFE_SCHEDULE_s *pSchedule, uint8_t stringNumber);
+
+/**
+ * @brief   Decides whether the open-wire check of a string is run
+ * @details The period restarts when true is returned, i.e., the driver has
+ *          to run the check.
+ * @param   pSchedule       schedule of the driver
+ * @param   stringNumber    string that has been measured
+ * @param   timestamp_ms    current time stamp
+ * @return  true if the open-wire check has to be run, false otherwise
+ */
+extern bool AFE_ScheduleIsOpenWireCheckDue(AFE_SCHEDULE_s *pSchedule, uint8_t stringNumber, uint32_t timestamp_ms);
+
+/**
+ * @brief   Requests the boost rates of the schedule
+ * @details Called by the application, e.g., when the safe operating area
+ *          limits are approached.
+ * @param   boost   true to use the boost rates, false to use the normal rates
+ */
+extern void AFE_ScheduleRequestBoost(bool boost);
+
+/**
+ * @brief   Returns whether the boost rates of the schedule are used
+ * @return  true if the boost rates are used, false otherwise
+ */
+extern bool AFE_ScheduleIsBoosted(void);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+#endif
+
+#endif /* FOXBMS__AFE_SCHEDULE_H_ */
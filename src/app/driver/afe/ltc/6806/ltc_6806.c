@@ -43,7 +43,7 @@
  * @file    ltc_6806.c
  * @author  foxBMS Team
  * @date    2019-09-01 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  LTC
@@ -64,6 +64,7 @@
 #include "afe_plausibility.h"
 #include "database.h"
 #include "diag.h"
+#include "foxmath.h"
 #include "io.h"
 #include "ltc_pec.h"
 #include "os.h"
@@ -403,53 +404,30 @@ extern void LTC_SaveVoltages(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
     /* Pointer validity check */
     FAS_ASSERT(ltc_state != NULL_PTR);
 
-    /* Iterate over all cell to:
+    /* Evaluate all cell blocks of a module at once:
      *
      * 1. Check open-wires and set respective cell measurements to invalid
      * 2. Perform minimum/maximum measurement value plausibility check
      * 3. Calculate string values
      */
-    STD_RETURN_TYPE_e cellVoltageMeasurementValid = STD_OK;
-    int32_t stringVoltage_mV                      = 0;
-    uint16_t numberValidMeasurements              = 0;
+    AFE_CELL_VOLTAGE_ACCUMULATOR_s accumulator = {.stringVoltage_mV = 0, .numberOfValidCellVoltages = 0u};
     for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
-        for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-            /* ------- 1. Check open-wires -----------------
-                 * Is cell N input not open wire &&
-                 * Is cell N+1 input not open wire &&
-                 * Is cell voltage valid because of previous PEC error
-                 * If so, everything okay, else set cell voltage measurement to invalid.
-                 */
-            if ((ltc_state->ltcData.openWire
-                     ->openWire[stringNumber][(m * (BS_NR_OF_CELL_BLOCKS_PER_MODULE + 1u)) + cb] == 0u) &&
-                (ltc_state->ltcData.openWire
-                     ->openWire[stringNumber][(m * (BS_NR_OF_CELL_BLOCKS_PER_MODULE + 1u)) + cb + 1u] == 0u) &&
-                ((ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m] & (0x01u << cb)) == 0u)) {
-                /* Cell voltage is valid -> perform minimum/maximum plausibility check */
-
-                /* ------- 2. Perform minimum/maximum measurement range check ---------- */
-                if (STD_OK == AFE_PlausibilityCheckVoltageMeasurementRange(
-                                  ltc_state->ltcData.cellVoltage->cellVoltage_mV[stringNumber][m][cb],
-                                  ltc_plausibleCellVoltages6806)) {
-                    /* Cell voltage is valid ->  calculate string voltage */
-                    /* -------- 3. Calculate string values ------------- */
-                    stringVoltage_mV += ltc_state->ltcData.cellVoltage->cellVoltage_mV[stringNumber][m][cb];
-                    numberValidMeasurements++;
-                } else {
-                    /* Invalidate cell voltage measurement */
-                    ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m] |= (0x01uLL << cb);
-                    cellVoltageMeasurementValid = STD_NOT_OK;
-                }
-            } else {
-                /* Set cell voltage measurement value invalid, if not already invalid because of PEC Error */
-                ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m] |= (0x01uLL << cb);
-                cellVoltageMeasurementValid = STD_NOT_OK;
-            }
-        }
+        ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m] = AFE_PlausibilityCheckModuleCellVoltages(
+            ltc_state->ltcData.cellVoltage->cellVoltage_mV[stringNumber][m],
+            BS_NR_OF_CELL_BLOCKS_PER_MODULE,
+            &ltc_state->ltcData.openWire->openWire[stringNumber][m * (BS_NR_OF_CELL_BLOCKS_PER_MODULE + 1u)],
+            ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m],
+            ltc_plausibleCellVoltages6806,
+            &accumulator);
+    }
+    /* the measurement is not valid as soon as one cell voltage is invalid */
+    STD_RETURN_TYPE_e cellVoltageMeasurementValid = STD_OK;
+    if (accumulator.numberOfValidCellVoltages < BS_NR_OF_CELL_BLOCKS_PER_STRING) {
+        cellVoltageMeasurementValid = STD_NOT_OK;
     }
     DIAG_CheckEvent(cellVoltageMeasurementValid, DIAG_ID_AFE_CELL_VOLTAGE_MEAS_ERROR, DIAG_STRING, stringNumber);
-    ltc_state->ltcData.cellVoltage->stringVoltage_mV[stringNumber]    = stringVoltage_mV;
-    ltc_state->ltcData.cellVoltage->nrValidCellVoltages[stringNumber] = numberValidMeasurements;
+    ltc_state->ltcData.cellVoltage->stringVoltage_mV[stringNumber]    = accumulator.stringVoltage_mV;
+    ltc_state->ltcData.cellVoltage->nrValidCellVoltages[stringNumber] = accumulator.numberOfValidCellVoltages;
 
     /* Increment state variable each time new values are written into database */
     ltc_state->ltcData.cellVoltage->state++;
@@ -459,7 +437,7 @@ extern void LTC_SaveVoltages(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
 
 extern void LTC_SaveTemperatures(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
     STD_RETURN_TYPE_e cellTemperatureMeasurementValid = STD_OK;
-    uint16_t numberValidMeasurements                  = 0;
+    uint16_t numberInvalidMeasurements                = 0u;
     for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
         for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
             /* ------- 1. Check valid flag  -----------------
@@ -470,10 +448,8 @@ extern void LTC_SaveTemperatures(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
                 /* Cell temperature is valid -> perform minimum/maximum plausibility check */
 
                 /* ------- 2. Perform minimum/maximum measurement range check ---------- */
-                if (STD_OK == AFE_PlausibilityCheckTempMinMax(
+                if (STD_OK != AFE_PlausibilityCheckTempMinMax(
                                   ltc_state->ltcData.cellTemperature->cellTemperature_ddegC[stringNumber][m][ts])) {
-                    numberValidMeasurements++;
-                } else {
                     /* Invalidate cell temperature measurement */
                     ltc_state->ltcData.cellTemperature->invalidCellTemperature[stringNumber][m] |= (0x01u << ts);
                     cellTemperatureMeasurementValid = STD_NOT_OK;
@@ -483,11 +459,15 @@ extern void LTC_SaveTemperatures(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
                 cellTemperatureMeasurementValid = STD_NOT_OK;
             }
         }
+        numberInvalidMeasurements += MATH_CountSetBitsUint64_t(
+            ltc_state->ltcData.cellTemperature->invalidCellTemperature[stringNumber][m] &
+            DATA_CELL_TEMPERATURE_BITMAP_MASK);
     }
     DIAG_CheckEvent(
         cellTemperatureMeasurementValid, DIAG_ID_AFE_CELL_TEMPERATURE_MEAS_ERROR, DIAG_STRING, stringNumber);
 
-    ltc_state->ltcData.cellTemperature->nrValidTemperatures[stringNumber] = numberValidMeasurements;
+    ltc_state->ltcData.cellTemperature->nrValidTemperatures[stringNumber] =
+        (uint16_t)(BS_NR_OF_TEMP_SENSORS_PER_STRING - numberInvalidMeasurements);
     ltc_state->ltcData.cellTemperature->state++;
     DATA_WRITE_DATA(ltc_state->ltcData.cellTemperature);
 }
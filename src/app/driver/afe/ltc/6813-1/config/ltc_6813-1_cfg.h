@@ -43,7 +43,7 @@
  * @file    ltc_6813-1_cfg.h
  * @author  foxBMS Team
  * @date    2015-02-18 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS_CONFIGURATION
  * @prefix  LTC
@@ -111,6 +111,18 @@
 /* set to true or false */
 #define LTC_DISCARD_MUX_CHECK (false)
 
+/**
+ * Pipelined measurement of multiple strings (true) or strictly sequential
+ * measurement (false). In the pipelined mode, the cell voltage conversion of
+ * the next string is started as soon as the cell voltage registers of the
+ * current string have been read, so that it runs while the current string is
+ * post-processed (voltages, multiplexer measurement, balancing).
+ */
+#define LTC_PIPELINED_STRING_MEASUREMENT (false)
+#if !((LTC_PIPELINED_STRING_MEASUREMENT == false) || (LTC_PIPELINED_STRING_MEASUREMENT == true))
+#error "LTC_PIPELINED_STRING_MEASUREMENT can only have the value true or false"
+#endif
+
 /** Number of multiplexer used per LTC-IC */
 #define LTC_N_MUX_PER_LTC (3u)
 
@@ -43,7 +43,7 @@
  * @file    ltc_6813-1.c
  * @author  foxBMS Team
  * @date    2019-09-01 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  LTC
@@ -58,12 +58,17 @@
 #include "ltc.h"
 /* clang-format on */
 
+#include "ltc_6813-1_frames.h"
+
 #include "HL_spi.h"
 #include "HL_system.h"
 
+#include "afe_pipeline.h"
 #include "afe_plausibility.h"
+#include "afe_schedule.h"
 #include "database.h"
 #include "diag.h"
+#include "foxmath.h"
 #include "io.h"
 #include "ltc_pec.h"
 #include "os.h"
@@ -99,6 +104,21 @@
 /** maximum number of supported cells */
 #define LTC_MAX_SUPPORTED_CELLS (12u)
 
+/**
+ * ADAX commands of one channel selection by ADC mode, the DCP bit is ignored
+ * and an undefined mode selects the normal mode
+ */
+#define LTC_ADAX_COMMANDS(fast, normal, filtered) \
+    {                                             \
+        [LTC_ADCMODE_UNDEFINED]     = (normal),   \
+        [LTC_ADCMODE_FAST_DCP0]     = (fast),     \
+        [LTC_ADCMODE_NORMAL_DCP0]   = (normal),   \
+        [LTC_ADCMODE_FILTERED_DCP0] = (filtered), \
+        [LTC_ADCMODE_FAST_DCP1]     = (fast),     \
+        [LTC_ADCMODE_NORMAL_DCP1]   = (normal),   \
+        [LTC_ADCMODE_FILTERED_DCP1] = (filtered), \
+    }
+
 /*========== Static Constant and Variable Definitions =======================*/
 /**
  * PEC buffer for RX and TX
@@ -135,6 +155,12 @@ static const AFE_PLAUSIBILITY_VALUES_s ltc_plausibleCellVoltages681x = {
     .minimumPlausibleVoltage_mV = 0,
 };
 
+/** cell voltage conversion that has been started ahead, see #LTC_PIPELINED_STRING_MEASUREMENT */
+static AFE_PIPELINE_s ltc_conversionPipeline = {0};
+
+/** multi-rate schedule of the temperature measurement and the open-wire check */
+static AFE_SCHEDULE_s ltc_schedule = {0};
+
 /*========== Extern Constant and Variable Definitions =======================*/
 
 LTC_STATE_s ltc_stateBase = {
@@ -285,6 +311,35 @@ static uint16_t ltc_BC_cmdADOW_PDOWN_filtered_DCP0[4] = {
     0xBF,
     0xCE}; /*!< Broadcast, Pull-down current, All cells, filtered mode, discharge not permitted (DCP=0) */
 
+/** ADCV commands by channel selection and ADC mode, NULL_PTR if the combination is not supported */
+static uint16_t *const ltc_cmdADCV[LTC_ADCMEAS_E_MAX][LTC_ADCMODE_E_MAX] = {
+    [LTC_ADCMEAS_ALLCHANNEL_CELLS] =
+        {
+            [LTC_ADCMODE_FAST_DCP0]     = ltc_cmdADCV_fast_DCP0,
+            [LTC_ADCMODE_NORMAL_DCP0]   = ltc_cmdADCV_normal_DCP0,
+            [LTC_ADCMODE_FILTERED_DCP0] = ltc_cmdADCV_filtered_DCP0,
+            [LTC_ADCMODE_FAST_DCP1]     = ltc_cmdADCV_fast_DCP1,
+            [LTC_ADCMODE_NORMAL_DCP1]   = ltc_cmdADCV_normal_DCP1,
+            [LTC_ADCMODE_FILTERED_DCP1] = ltc_cmdADCV_filtered_DCP1,
+        },
+    [LTC_ADCMEAS_SINGLECHANNEL_TWOCELLS] =
+        {
+            [LTC_ADCMODE_FAST_DCP0] = ltc_cmdADCV_fast_DCP0_twocells,
+        },
+};
+
+/** ADAX commands by channel selection and ADC mode, NULL_PTR if the combination is not supported */
+static uint16_t *const ltc_cmdADAX[LTC_ADCMEAS_E_MAX][LTC_ADCMODE_E_MAX] = {
+    [LTC_ADCMEAS_ALLCHANNEL_GPIOS] =
+        LTC_ADAX_COMMANDS(ltc_cmdADAX_fast_ALLGPIOS, ltc_cmdADAX_normal_ALLGPIOS, ltc_cmdADAX_filtered_ALLGPIOS),
+    [LTC_ADCMEAS_SINGLECHANNEL_GPIO1] =
+        LTC_ADAX_COMMANDS(ltc_cmdADAX_fast_GPIO1, ltc_cmdADAX_normal_GPIO1, ltc_cmdADAX_filtered_GPIO1),
+    [LTC_ADCMEAS_SINGLECHANNEL_GPIO2] =
+        LTC_ADAX_COMMANDS(ltc_cmdADAX_fast_GPIO2, ltc_cmdADAX_normal_GPIO2, ltc_cmdADAX_filtered_GPIO2),
+    [LTC_ADCMEAS_SINGLECHANNEL_GPIO3] =
+        LTC_ADAX_COMMANDS(ltc_cmdADAX_fast_GPIO3, ltc_cmdADAX_normal_GPIO3, ltc_cmdADAX_filtered_GPIO3),
+};
+
 /*========== Static Function Prototypes =====================================*/
 static void LTC_SetFirstMeasurementCycleFinished(LTC_STATE_s *ltc_state);
 static void LTC_InitializeDatabase(LTC_STATE_s *ltc_state);
@@ -323,6 +378,8 @@ static STD_RETURN_TYPE_e LTC_StartVoltageMeasurement(
     SPI_INTERFACE_CONFIG_s *pSpiInterface,
     LTC_ADCMODE_e adcMode,
     LTC_ADCMEAS_CHAN_e adcMeasCh);
+static void LTC_StartNextStringConversion(LTC_STATE_s *ltc_state);
+static bool LTC_TakeConversionStartedAhead(LTC_STATE_s *ltc_state, uint16_t *pRemainingTime_ms);
 static STD_RETURN_TYPE_e LTC_StartGpioMeasurement(
     SPI_INTERFACE_CONFIG_s *pSpiInterface,
     LTC_ADCMODE_e adcMode,
@@ -332,7 +389,6 @@ static STD_RETURN_TYPE_e LTC_StartOpenWireMeasurement(
     LTC_ADCMODE_e adcMode,
     uint8_t PUP);
 
-static uint16_t LTC_GetMeasurementTimeCycle(LTC_ADCMODE_e adcMode, LTC_ADCMEAS_CHAN_e adcMeasCh);
 static void LTC_SaveRxToVoltageBuffer(
     LTC_STATE_s *ltc_state,
     uint16_t *pRxBuff,
@@ -360,7 +416,6 @@ static STD_RETURN_TYPE_e LTC_WriteRegister(
     uint16_t *pTxBuff,
     uint16_t *pRxBuff,
     uint32_t frameLength);
-static void LTC_SetMuxChCommand(uint16_t *pTxBuff, uint8_t mux, uint8_t channel);
 static STD_RETURN_TYPE_e LTC_SendEepromReadCommand(
     LTC_STATE_s *ltc_state,
     SPI_INTERFACE_CONFIG_s *pSpiInterface,
@@ -582,53 +637,30 @@ extern void LTC_SaveVoltages(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
     FAS_ASSERT(ltc_state != NULL_PTR);
     FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
 
-    /* Iterate over all cell to:
+    /* Evaluate all cell blocks of a module at once:
      *
      * 1. Check open-wires and set respective cell measurements to invalid
      * 2. Perform minimum/maximum measurement value plausibility check
      * 3. Calculate string values
      */
-    STD_RETURN_TYPE_e cellVoltageMeasurementValid = STD_OK;
-    int32_t stringVoltage_mV                      = 0;
-    uint16_t numberValidMeasurements              = 0;
+    AFE_CELL_VOLTAGE_ACCUMULATOR_s accumulator = {.stringVoltage_mV = 0, .numberOfValidCellVoltages = 0u};
     for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
-        for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
-            /* ------- 1. Check open-wires -----------------
-                 * Is cell N input not open wire &&
-                 * Is cell N+1 input not open wire &&
-                 * Is cell voltage valid because of previous PEC error
-                 * If so, everything okay, else set cell voltage measurement to invalid.
-                 */
-            if ((ltc_state->ltcData.openWire
-                     ->openWire[stringNumber][(m * (BS_NR_OF_CELL_BLOCKS_PER_MODULE + 1u)) + cb] == 0u) &&
-                (ltc_state->ltcData.openWire
-                     ->openWire[stringNumber][(m * (BS_NR_OF_CELL_BLOCKS_PER_MODULE + 1u)) + cb + 1u] == 0u) &&
-                ((ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m] & (0x01u << cb)) == 0u)) {
-                /* Cell voltage is valid -> perform minimum/maximum plausibility check */
-
-                /* ------- 2. Perform minimum/maximum measurement range check ---------- */
-                if (STD_OK == AFE_PlausibilityCheckVoltageMeasurementRange(
-                                  ltc_state->ltcData.cellVoltage->cellVoltage_mV[stringNumber][m][cb],
-                                  ltc_plausibleCellVoltages681x)) {
-                    /* Cell voltage is valid ->  calculate string voltage */
-                    /* -------- 3. Calculate string values ------------- */
-                    stringVoltage_mV += ltc_state->ltcData.cellVoltage->cellVoltage_mV[stringNumber][m][cb];
-                    numberValidMeasurements++;
-                } else {
-                    /* Invalidate cell voltage measurement */
-                    ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m] |= (0x01u << cb);
-                    cellVoltageMeasurementValid = STD_NOT_OK;
-                }
-            } else {
-                /* Set cell voltage measurement value invalid, if not already invalid because of PEC Error */
-                ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m] |= (0x01u << cb);
-                cellVoltageMeasurementValid = STD_NOT_OK;
-            }
-        }
+        ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m] = AFE_PlausibilityCheckModuleCellVoltages(
+            ltc_state->ltcData.cellVoltage->cellVoltage_mV[stringNumber][m],
+            BS_NR_OF_CELL_BLOCKS_PER_MODULE,
+            &ltc_state->ltcData.openWire->openWire[stringNumber][m * (BS_NR_OF_CELL_BLOCKS_PER_MODULE + 1u)],
+            ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m],
+            ltc_plausibleCellVoltages681x,
+            &accumulator);
+    }
+    /* the measurement is not valid as soon as one cell voltage is invalid */
+    STD_RETURN_TYPE_e cellVoltageMeasurementValid = STD_OK;
+    if (accumulator.numberOfValidCellVoltages < BS_NR_OF_CELL_BLOCKS_PER_STRING) {
+        cellVoltageMeasurementValid = STD_NOT_OK;
     }
     DIAG_CheckEvent(cellVoltageMeasurementValid, ltc_state->voltMeasDiagErrorEntry, DIAG_STRING, stringNumber);
-    ltc_state->ltcData.cellVoltage->stringVoltage_mV[stringNumber]    = stringVoltage_mV;
-    ltc_state->ltcData.cellVoltage->nrValidCellVoltages[stringNumber] = numberValidMeasurements;
+    ltc_state->ltcData.cellVoltage->stringVoltage_mV[stringNumber]    = accumulator.stringVoltage_mV;
+    ltc_state->ltcData.cellVoltage->nrValidCellVoltages[stringNumber] = accumulator.numberOfValidCellVoltages;
 
     /* Increment state variable each time new values are written into database */
     ltc_state->ltcData.cellVoltage->state++;
@@ -640,7 +672,7 @@ extern void LTC_SaveVoltages(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
 extern void LTC_SaveTemperatures(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
     FAS_ASSERT(ltc_state != NULL_PTR);
     STD_RETURN_TYPE_e cellTemperatureMeasurementValid = STD_OK;
-    uint16_t numberValidMeasurements                  = 0;
+    uint16_t numberInvalidMeasurements                = 0u;
 
     for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
         for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
@@ -652,10 +684,8 @@ extern void LTC_SaveTemperatures(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
                 /* Cell temperature is valid -> perform minimum/maximum plausibility check */
 
                 /* ------- 2. Perform minimum/maximum measurement range check ---------- */
-                if (STD_OK == AFE_PlausibilityCheckTempMinMax(
+                if (STD_OK != AFE_PlausibilityCheckTempMinMax(
                                   ltc_state->ltcData.cellTemperature->cellTemperature_ddegC[stringNumber][m][ts])) {
-                    numberValidMeasurements++;
-                } else {
                     /* Invalidate cell temperature measurement */
                     ltc_state->ltcData.cellTemperature->invalidCellTemperature[stringNumber][m] |= (0x01u << ts);
                     cellTemperatureMeasurementValid = STD_NOT_OK;
@@ -665,10 +695,14 @@ extern void LTC_SaveTemperatures(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
                 cellTemperatureMeasurementValid = STD_NOT_OK;
             }
         }
+        numberInvalidMeasurements += MATH_CountSetBitsUint64_t(
+            ltc_state->ltcData.cellTemperature->invalidCellTemperature[stringNumber][m] &
+            DATA_CELL_TEMPERATURE_BITMAP_MASK);
     }
     DIAG_CheckEvent(cellTemperatureMeasurementValid, ltc_state->tempMeasDiagErrorEntry, DIAG_STRING, stringNumber);
 
-    ltc_state->ltcData.cellTemperature->nrValidTemperatures[stringNumber] = numberValidMeasurements;
+    ltc_state->ltcData.cellTemperature->nrValidTemperatures[stringNumber] =
+        (uint16_t)(BS_NR_OF_TEMP_SENSORS_PER_STRING - numberInvalidMeasurements);
 
     ltc_state->ltcData.cellTemperature->state++;
     DATA_WRITE_DATA(ltc_state->ltcData.cellTemperature);
@@ -815,12 +849,13 @@ LTC_RETURN_TYPE_e LTC_SetStateRequest(LTC_STATE_s *ltc_state, LTC_REQUEST_s stat
 
 void LTC_Trigger(LTC_STATE_s *ltc_state) {
     FAS_ASSERT(ltc_state != NULL_PTR);
-    STD_RETURN_TYPE_e retVal           = STD_OK;
-    LTC_REQUEST_s statereq             = {.request = LTC_STATE_NO_REQUEST, .string = 0x0u};
-    uint8_t tmpbusID                   = 0;
-    LTC_ADCMODE_e tmpadcMode           = LTC_ADCMODE_UNDEFINED;
-    LTC_ADCMEAS_CHAN_e tmpadcMeasCh    = LTC_ADCMEAS_UNDEFINED;
-    STD_RETURN_TYPE_e continueFunction = STD_OK;
+    STD_RETURN_TYPE_e retVal            = STD_OK;
+    LTC_REQUEST_s statereq              = {.request = LTC_STATE_NO_REQUEST, .string = 0x0u};
+    uint8_t tmpbusID                    = 0;
+    LTC_ADCMODE_e tmpadcMode            = LTC_ADCMODE_UNDEFINED;
+    LTC_ADCMEAS_CHAN_e tmpadcMeasCh     = LTC_ADCMEAS_UNDEFINED;
+    STD_RETURN_TYPE_e continueFunction  = STD_OK;
+    uint16_t remainingConversionTime_ms = LTC_STATEMACH_SHORTTIME;
 
     FAS_ASSERT(ltc_state != NULL_PTR);
 
@@ -876,6 +911,7 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
                 if (ltc_state->substate == LTC_INIT_STRING) {
                     LTC_SaveLastStates(ltc_state);
                     ltc_state->currentString = 0u;
+                    AFE_ScheduleInitialize(&ltc_schedule, &afe_scheduleConfig, OS_GetTickCount());
 
                     ltc_state->spiSeqPtr           = ltc_state->ltcData.pSpiInterface;
                     ltc_state->spiNumberInterfaces = BS_NR_OF_STRINGS;
@@ -977,6 +1013,7 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
                 ltc_state->spiNumberInterfaces = BS_NR_OF_STRINGS;
                 ltc_state->spiSeqEndPtr        = ltc_state->ltcData.pSpiInterface + BS_NR_OF_STRINGS;
                 ltc_state->currentString       = 0u;
+                AFE_PipelineReset(&ltc_conversionPipeline);
 
                 ltc_state->check_spi_flag = STD_NOT_OK;
                 retVal = LTC_StartVoltageMeasurement(ltc_state->spiSeqPtr, ltc_state->adcMode, ltc_state->adcMeasCh);
@@ -987,8 +1024,7 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
                     ltc_state->spiDiagErrorEntry,
                     LTC_STATEMACH_READVOLTAGE,
                     LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE,
-                    (ltc_state->commandTransferTime +
-                     LTC_GetMeasurementTimeCycle(ltc_state->adcMode, ltc_state->adcMeasCh)),
+                    (ltc_state->commandTransferTime + LTC_GetMeasurementTime(ltc_state->adcMode, ltc_state->adcMeasCh)),
                     LTC_STATEMACH_READVOLTAGE,
                     LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE,
                     LTC_STATEMACH_SHORTTIME);
@@ -1003,19 +1039,29 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
                 ltc_state->adcMeasCh = LTC_ADCMEAS_ALLCHANNEL_CELLS;
 
                 ltc_state->check_spi_flag = STD_NOT_OK;
-                retVal = LTC_StartVoltageMeasurement(ltc_state->spiSeqPtr, ltc_state->adcMode, ltc_state->adcMeasCh);
+                if (LTC_TakeConversionStartedAhead(ltc_state, &remainingConversionTime_ms) == true) {
+                    /* conversion has been started while the previous string was post-processed */
+                    LTC_StateTransition(
+                        ltc_state,
+                        LTC_STATEMACH_READVOLTAGE,
+                        LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE,
+                        remainingConversionTime_ms);
+                } else {
+                    retVal =
+                        LTC_StartVoltageMeasurement(ltc_state->spiSeqPtr, ltc_state->adcMode, ltc_state->adcMeasCh);
 
-                LTC_CondBasedStateTransition(
-                    ltc_state,
-                    retVal,
-                    ltc_state->spiDiagErrorEntry,
-                    LTC_STATEMACH_READVOLTAGE,
-                    LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE,
-                    (ltc_state->commandTransferTime +
-                     LTC_GetMeasurementTimeCycle(ltc_state->adcMode, ltc_state->adcMeasCh)),
-                    LTC_STATEMACH_READVOLTAGE,
-                    LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE,
-                    LTC_STATEMACH_SHORTTIME);
+                    LTC_CondBasedStateTransition(
+                        ltc_state,
+                        retVal,
+                        ltc_state->spiDiagErrorEntry,
+                        LTC_STATEMACH_READVOLTAGE,
+                        LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE,
+                        (ltc_state->commandTransferTime +
+                         LTC_GetMeasurementTime(ltc_state->adcMode, ltc_state->adcMeasCh)),
+                        LTC_STATEMACH_READVOLTAGE,
+                        LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE,
+                        LTC_STATEMACH_SHORTTIME);
+                }
 
                 break;
 
@@ -1197,12 +1243,20 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
                     /* Switch to different state if read voltage state is reused
                  * e.g. open-wire check...                                */
                     if (ltc_state->reusageMeasurementMode == LTC_NOT_REUSED) {
+                        /* registers of this string are read: the next string can already convert */
+                        LTC_StartNextStringConversion(ltc_state);
                         LTC_SaveVoltages(ltc_state, ltc_state->currentString);
-                        LTC_StateTransition(
-                            ltc_state,
-                            LTC_STATEMACH_MUXMEASUREMENT,
-                            LTC_STATEMACH_MUXCONFIGURATION_INIT,
-                            LTC_STATEMACH_SHORTTIME);
+                        if (AFE_ScheduleIsTemperatureMeasurementDue(&ltc_schedule, ltc_state->currentString) == true) {
+                            LTC_StateTransition(
+                                ltc_state,
+                                LTC_STATEMACH_MUXMEASUREMENT,
+                                LTC_STATEMACH_MUXCONFIGURATION_INIT,
+                                LTC_STATEMACH_SHORTTIME);
+                        } else {
+                            /* temperatures are measured at a lower rate, see afe_schedule_cfg.h */
+                            LTC_StateTransition(
+                                ltc_state, LTC_STATEMACH_MEASCYCLE_FINISHED, LTC_ENTRY, LTC_STATEMACH_SHORTTIME);
+                        }
                     } else if (ltc_state->reusageMeasurementMode == LTC_REUSE_READVOLT_FOR_ADOW_PUP) {
                         LTC_StateTransition(
                             ltc_state,
@@ -1399,7 +1453,7 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
                         LTC_STATEMACH_MUXMEASUREMENT,
                         LTC_STATEMACH_READMUXMEASUREMENT,
                         (ltc_state->commandTransferTime +
-                         LTC_GetMeasurementTimeCycle(
+                         LTC_GetMeasurementTime(
                              ltc_state->adcMode, LTC_ADCMEAS_SINGLECHANNEL_GPIO2)), /*  wait, ADAX-Command */
                         LTC_STATEMACH_MUXMEASUREMENT,
                         LTC_STATEMACH_READMUXMEASUREMENT,
@@ -1513,6 +1567,18 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
                         /* Send ADOW command with PUP two times */
                         ltc_state->resendCommandCounter = LTC_NMBR_REQ_ADOW_COMMANDS;
                         ltc_state->balance_control_done = STD_NOT_OK;
+                    } else if (
+                        AFE_ScheduleIsOpenWireCheckDue(&ltc_schedule, ltc_state->currentString, OS_GetTickCount()) ==
+                        true) {
+                        /* scheduled open-wire check of the string that has just been measured */
+                        ltc_state->requestedString = ltc_state->currentString;
+                        LTC_StateTransition(
+                            ltc_state,
+                            LTC_STATEMACH_OPENWIRE_CHECK,
+                            LTC_REQUEST_PULLUP_CURRENT_OPENWIRE_CHECK,
+                            LTC_STATEMACH_SHORTTIME);
+                        ltc_state->resendCommandCounter = LTC_NMBR_REQ_ADOW_COMMANDS;
+                        ltc_state->balance_control_done = STD_NOT_OK;
                     } else {
                         LTC_StateTransition(
                             ltc_state,
@@ -1637,8 +1703,7 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
                     ltc_state->spiDiagErrorEntry,
                     LTC_STATEMACH_READALLGPIO,
                     LTC_READ_AUXILIARY_REGISTER_A_RDAUXA,
-                    (ltc_state->commandTransferTime +
-                     LTC_GetMeasurementTimeCycle(ltc_state->adcMode, ltc_state->adcMeasCh)),
+                    (ltc_state->commandTransferTime + LTC_GetMeasurementTime(ltc_state->adcMode, ltc_state->adcMeasCh)),
                     LTC_STATEMACH_ALLGPIOMEASUREMENT,
                     LTC_ENTRY,
                     LTC_STATEMACH_SHORTTIME); /* TODO: @koffel here same state is kept if error occurs */
@@ -1788,7 +1853,7 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
                         LTC_STATEMACH_BALANCEFEEDBACK,
                         LTC_READ_FEEDBACK_BALANCECONTROL,
                         (ltc_state->commandDataTransferTime +
-                         LTC_GetMeasurementTimeCycle(ltc_state->adcMode, ltc_state->adcMeasCh)),
+                         LTC_GetMeasurementTime(ltc_state->adcMode, ltc_state->adcMeasCh)),
                         LTC_STATEMACH_BALANCEFEEDBACK,
                         LTC_READ_FEEDBACK_BALANCECONTROL,
                         LTC_STATEMACH_SHORTTIME);
@@ -2791,7 +2856,7 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
                             LTC_STATEMACH_OPENWIRE_CHECK,
                             LTC_REQUEST_PULLUP_CURRENT_OPENWIRE_CHECK,
                             (ltc_state->commandDataTransferTime +
-                             LTC_GetMeasurementTimeCycle(ltc_state->adcMode, LTC_ADCMEAS_ALLCHANNEL_CELLS)));
+                             LTC_GetMeasurementTime(ltc_state->adcMode, LTC_ADCMEAS_ALLCHANNEL_CELLS)));
                         ltc_state->resendCommandCounter--;
 
                         /* Check how many retries are left */
@@ -2802,7 +2867,7 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
                                 LTC_STATEMACH_READVOLTAGE,
                                 LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE,
                                 (ltc_state->commandDataTransferTime +
-                                 LTC_GetMeasurementTimeCycle(ltc_state->adcMode, LTC_ADCMEAS_ALLCHANNEL_CELLS)));
+                                 LTC_GetMeasurementTime(ltc_state->adcMode, LTC_ADCMEAS_ALLCHANNEL_CELLS)));
                             /* Reuse read voltage register */
                             ltc_state->reusageMeasurementMode = LTC_REUSE_READVOLT_FOR_ADOW_PUP;
                         }
@@ -2846,7 +2911,7 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
                             LTC_STATEMACH_OPENWIRE_CHECK,
                             LTC_REQUEST_PULLDOWN_CURRENT_OPENWIRE_CHECK,
                             (ltc_state->commandDataTransferTime +
-                             LTC_GetMeasurementTimeCycle(ltc_state->adcMode, LTC_ADCMEAS_ALLCHANNEL_CELLS)));
+                             LTC_GetMeasurementTime(ltc_state->adcMode, LTC_ADCMEAS_ALLCHANNEL_CELLS)));
                         ltc_state->resendCommandCounter--;
 
                         /* Check how many retries are left */
@@ -2857,7 +2922,7 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
                                 LTC_STATEMACH_READVOLTAGE,
                                 LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE,
                                 (ltc_state->commandDataTransferTime +
-                                 LTC_GetMeasurementTimeCycle(ltc_state->adcMode, LTC_ADCMEAS_ALLCHANNEL_CELLS)));
+                                 LTC_GetMeasurementTime(ltc_state->adcMode, LTC_ADCMEAS_ALLCHANNEL_CELLS)));
                             /* Reuse read voltage register */
                             ltc_state->reusageMeasurementMode = LTC_REUSE_READVOLT_FOR_ADOW_PDOWN;
                         }
@@ -3596,66 +3661,6 @@ static void LTC_ResetErrorTable(LTC_STATE_s *ltc_state) {
     }
 }
 
-/**
- * @brief   brief missing
- * @details Gets the measurement time needed by the LTC analog front-end,
- *          depending on the measurement mode and the number of channels.
- *          For all cell voltages or all 5 GPIOS, the measurement time is the
- *          same.
- *          For 2 cell voltages or 1 GPIO, the measurement time is the same.
- *          As a consequence, this function is used for cell voltage and for
- *          GPIO measurement.
- * @param   adcMode     LTC ADCmeasurement mode (fast, normal or filtered)
- * @param   adcMeasCh   number of channels measured for GPIOS (one at a time
- *                      for multiplexers or all five GPIOs) or number of cell
- *                      voltage measured (2 cells or all cells)
- * @return  measurement time in ms
- */
-static uint16_t LTC_GetMeasurementTimeCycle(LTC_ADCMODE_e adcMode, LTC_ADCMEAS_CHAN_e adcMeasCh) {
-    uint16_t retVal = LTC_ADCMEAS_UNDEFINED; /* default */
-
-    if (adcMeasCh == LTC_ADCMEAS_ALLCHANNEL_CELLS) {
-        if ((adcMode == LTC_ADCMODE_FAST_DCP0) || (adcMode == LTC_ADCMODE_FAST_DCP1)) {
-            retVal = LTC_STATEMACH_MEAS_ALL_CELLS_FAST_TCYCLE;
-        } else if ((adcMode == LTC_ADCMODE_NORMAL_DCP0) || (adcMode == LTC_ADCMODE_NORMAL_DCP1)) {
-            retVal = LTC_STATEMACH_MEAS_ALL_CELLS_NORMAL_TCYCLE;
-        } else if ((adcMode == LTC_ADCMODE_FILTERED_DCP0) || (adcMode == LTC_ADCMODE_FILTERED_DCP1)) {
-            retVal = LTC_STATEMACH_MEAS_ALL_CELLS_FILTERED_TCYCLE;
-        }
-    } else if (adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_TWOCELLS) {
-        if ((adcMode == LTC_ADCMODE_FAST_DCP0) || (adcMode == LTC_ADCMODE_FAST_DCP1)) {
-            retVal = LTC_STATEMACH_MEAS_TWO_CELLS_FAST_TCYCLE;
-        } else if ((adcMode == LTC_ADCMODE_NORMAL_DCP0) || (adcMode == LTC_ADCMODE_NORMAL_DCP1)) {
-            retVal = LTC_STATEMACH_MEAS_TWO_CELLS_NORMAL_TCYCLE;
-        } else if ((adcMode == LTC_ADCMODE_FILTERED_DCP0) || (adcMode == LTC_ADCMODE_FILTERED_DCP1)) {
-            retVal = LTC_STATEMACH_MEAS_TWO_CELLS_FILTERED_TCYCLE;
-        }
-    } else if (adcMeasCh == LTC_ADCMEAS_ALLCHANNEL_GPIOS) {
-        if ((adcMode == LTC_ADCMODE_FAST_DCP0) || (adcMode == LTC_ADCMODE_FAST_DCP1)) {
-            retVal = LTC_STATEMACH_MEAS_ALL_GPIOS_FAST_TCYCLE;
-        } else if ((adcMode == LTC_ADCMODE_NORMAL_DCP0) || (adcMode == LTC_ADCMODE_NORMAL_DCP1)) {
-            retVal = LTC_STATEMACH_MEAS_ALL_GPIOS_NORMAL_TCYCLE;
-        } else if ((adcMode == LTC_ADCMODE_FILTERED_DCP0) || (adcMode == LTC_ADCMODE_FILTERED_DCP1)) {
-            retVal = LTC_STATEMACH_MEAS_ALL_GPIOS_FILTERED_TCYCLE;
-        }
-    } else if (
-        (adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_GPIO1) || (adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_GPIO2) ||
-        (adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_GPIO3) || (adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_GPIO4) ||
-        (adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_GPIO5)) {
-        if ((adcMode == LTC_ADCMODE_FAST_DCP0) || (adcMode == LTC_ADCMODE_FAST_DCP1)) {
-            retVal = LTC_STATEMACH_MEAS_SINGLE_GPIO_FAST_TCYCLE;
-        } else if ((adcMode == LTC_ADCMODE_NORMAL_DCP0) || (adcMode == LTC_ADCMODE_NORMAL_DCP1)) {
-            retVal = LTC_STATEMACH_MEAS_SINGLE_GPIO_NORMAL_TCYCLE;
-        } else if ((adcMode == LTC_ADCMODE_FILTERED_DCP0) || (adcMode == LTC_ADCMODE_FILTERED_DCP1)) {
-            retVal = LTC_STATEMACH_MEAS_SINGLE_GPIO_FILTERED_TCYCLE;
-        }
-    } else {
-        retVal = LTC_ADCMEAS_UNDEFINED;
-    }
-
-    return retVal;
-}
-
 /**
  * @brief   tells the LTC daisy-chain to start measuring the voltage on all cells.
  *
@@ -3673,34 +3678,64 @@ static STD_RETURN_TYPE_e LTC_StartVoltageMeasurement(
     LTC_ADCMODE_e adcMode,
     LTC_ADCMEAS_CHAN_e adcMeasCh) {
     FAS_ASSERT(pSpiInterface != NULL_PTR);
-    STD_RETURN_TYPE_e retVal = STD_OK;
+    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+    uint16_t *pCommand       = NULL_PTR;
 
-    if (adcMeasCh == LTC_ADCMEAS_ALLCHANNEL_CELLS) {
-        if (adcMode == LTC_ADCMODE_FAST_DCP0) {
-            retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, ltc_cmdADCV_fast_DCP0);
-        } else if (adcMode == LTC_ADCMODE_NORMAL_DCP0) {
-            retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, ltc_cmdADCV_normal_DCP0);
-        } else if (adcMode == LTC_ADCMODE_FILTERED_DCP0) {
-            retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, ltc_cmdADCV_filtered_DCP0);
-        } else if (adcMode == LTC_ADCMODE_FAST_DCP1) {
-            retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, ltc_cmdADCV_fast_DCP1);
-        } else if (adcMode == LTC_ADCMODE_NORMAL_DCP1) {
-            retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, ltc_cmdADCV_normal_DCP1);
-        } else if (adcMode == LTC_ADCMODE_FILTERED_DCP1) {
-            retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, ltc_cmdADCV_filtered_DCP1);
-        } else {
-            retVal = STD_NOT_OK;
+    if ((adcMode < LTC_ADCMODE_E_MAX) && (adcMeasCh < LTC_ADCMEAS_E_MAX)) {
+        pCommand = ltc_cmdADCV[adcMeasCh][adcMode];
+    }
+    if (pCommand != NULL_PTR) {
+        retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, pCommand);
+    }
+    return retVal;
+}
+
+/**
+ * @brief   starts the cell voltage conversion of the next string ahead of its measurement
+ * @details Only in the pipelined measurement mode (#LTC_PIPELINED_STRING_MEASUREMENT). The command is transmitted
+ *          blocking, so the shared SPI interface is free again for the next transfer of the current string.
+ * @param   ltc_state   state of the ltc state machine
+ */
+static void LTC_StartNextStringConversion(LTC_STATE_s *ltc_state) {
+    FAS_ASSERT(ltc_state != NULL_PTR);
+    if ((LTC_PIPELINED_STRING_MEASUREMENT == true) && ((ltc_state->spiSeqPtr + 1u) < ltc_state->spiSeqEndPtr)) {
+        STD_RETURN_TYPE_e retVal = LTC_StartVoltageMeasurement(
+            ltc_state->spiSeqPtr + 1u, LTC_VOLTAGE_MEASUREMENT_MODE, LTC_ADCMEAS_ALLCHANNEL_CELLS);
+        if (retVal == STD_OK) {
+            AFE_PipelineStartConversion(&ltc_conversionPipeline, ltc_state->currentString + 1u, OS_GetTickCount());
         }
-    } else if (adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_TWOCELLS) {
-        if (adcMode == LTC_ADCMODE_FAST_DCP0) {
-            retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, ltc_cmdADCV_fast_DCP0_twocells);
-        } else {
-            retVal = STD_NOT_OK;
+    }
+}
+
+/**
+ * @brief   checks if the cell voltage conversion of the current string has been started ahead
+ * @details Only in the pipelined measurement mode (#LTC_PIPELINED_STRING_MEASUREMENT) and if the cell voltage
+ *          measurement is not reused, e.g., by the open-wire check.
+ * @param   ltc_state           state of the ltc state machine
+ * @param   pRemainingTime_ms   remaining conversion time, at least #LTC_STATEMACH_SHORTTIME; only set if the
+ *                              conversion has been started ahead
+ * @return  true if the conversion has been started ahead, false if it has to be started
+ */
+static bool LTC_TakeConversionStartedAhead(LTC_STATE_s *ltc_state, uint16_t *pRemainingTime_ms) {
+    FAS_ASSERT(ltc_state != NULL_PTR);
+    FAS_ASSERT(pRemainingTime_ms != NULL_PTR);
+    bool conversionStarted      = false;
+    uint32_t conversionStart_ms = 0u;
+    if ((LTC_PIPELINED_STRING_MEASUREMENT == true) && (ltc_state->reusageMeasurementMode == LTC_NOT_REUSED)) {
+        conversionStarted =
+            AFE_PipelineTakeConversion(&ltc_conversionPipeline, ltc_state->currentString, &conversionStart_ms);
+    }
+    if (conversionStarted == true) {
+        const uint32_t conversionTime_ms =
+            ltc_state->commandTransferTime + LTC_GetMeasurementTime(ltc_state->adcMode, ltc_state->adcMeasCh);
+        uint32_t remainingTime_ms =
+            AFE_PipelineGetRemainingTime(conversionStart_ms, conversionTime_ms, OS_GetTickCount());
+        if (remainingTime_ms < (uint32_t)LTC_STATEMACH_SHORTTIME) {
+            remainingTime_ms = (uint32_t)LTC_STATEMACH_SHORTTIME;
         }
-    } else {
-        retVal = STD_NOT_OK;
+        *pRemainingTime_ms = (uint16_t)remainingTime_ms;
     }
-    return retVal;
+    return conversionStarted;
 }
 
 /**
@@ -3722,52 +3757,14 @@ static STD_RETURN_TYPE_e LTC_StartGpioMeasurement(
     LTC_ADCMODE_e adcMode,
     LTC_ADCMEAS_CHAN_e adcMeasCh) {
     FAS_ASSERT(pSpiInterface != NULL_PTR);
-    STD_RETURN_TYPE_e retVal;
-
-    if (adcMeasCh == LTC_ADCMEAS_ALLCHANNEL_GPIOS) {
-        if ((adcMode == LTC_ADCMODE_FAST_DCP0) || (adcMode == LTC_ADCMODE_FAST_DCP1)) {
-            retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, ltc_cmdADAX_fast_ALLGPIOS);
-        } else if ((adcMode == LTC_ADCMODE_FILTERED_DCP0) || (adcMode == LTC_ADCMODE_FILTERED_DCP1)) {
-            retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, ltc_cmdADAX_filtered_ALLGPIOS);
-        } else {
-            /*if (adcMode == LTC_ADCMODE_NORMAL_DCP0 || adcMode == LTC_ADCMODE_NORMAL_DCP1)*/
-            retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, ltc_cmdADAX_normal_ALLGPIOS);
-        }
-    } else if (adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_GPIO1) {
-        /* Single Channel */
-        if ((adcMode == LTC_ADCMODE_FAST_DCP0) || (adcMode == LTC_ADCMODE_FAST_DCP1)) {
-            retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, ltc_cmdADAX_fast_GPIO1);
-        } else if ((adcMode == LTC_ADCMODE_FILTERED_DCP0) || (adcMode == LTC_ADCMODE_FILTERED_DCP1)) {
-            retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, ltc_cmdADAX_filtered_GPIO1);
-        } else {
-            /*if (adcMode == LTC_ADCMODE_NORMAL_DCP0 || adcMode == LTC_ADCMODE_NORMAL_DCP1)*/
-
-            retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, ltc_cmdADAX_normal_GPIO1);
-        }
-    } else if (adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_GPIO2) {
-        /* Single Channel */
-        if ((adcMode == LTC_ADCMODE_FAST_DCP0) || (adcMode == LTC_ADCMODE_FAST_DCP1)) {
-            retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, ltc_cmdADAX_fast_GPIO2);
-        } else if ((adcMode == LTC_ADCMODE_FILTERED_DCP0) || (adcMode == LTC_ADCMODE_FILTERED_DCP1)) {
-            retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, ltc_cmdADAX_filtered_GPIO2);
-        } else {
-            /*if (adcMode == LTC_ADCMODE_NORMAL_DCP0 || adcMode == LTC_ADCMODE_NORMAL_DCP1)*/
-
-            retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, ltc_cmdADAX_normal_GPIO2);
-        }
-    } else if (adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_GPIO3) {
-        /* Single Channel */
-        if ((adcMode == LTC_ADCMODE_FAST_DCP0) || (adcMode == LTC_ADCMODE_FAST_DCP1)) {
-            retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, ltc_cmdADAX_fast_GPIO3);
-        } else if ((adcMode == LTC_ADCMODE_FILTERED_DCP0) || (adcMode == LTC_ADCMODE_FILTERED_DCP1)) {
-            retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, ltc_cmdADAX_filtered_GPIO3);
-        } else {
-            /*if (adcMode == LTC_ADCMODE_NORMAL_DCP0 || adcMode == LTC_ADCMODE_NORMAL_DCP1)*/
+    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+    uint16_t *pCommand       = NULL_PTR;
 
-            retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, ltc_cmdADAX_normal_GPIO3);
-        }
-    } else {
-        retVal = STD_NOT_OK;
+    if ((adcMode < LTC_ADCMODE_E_MAX) && (adcMeasCh < LTC_ADCMEAS_E_MAX)) {
+        pCommand = ltc_cmdADAX[adcMeasCh][adcMode];
+    }
+    if (pCommand != NULL_PTR) {
+        retVal = LTC_TRANSMIT_COMMAND(pSpiInterface, pCommand);
     }
 
     return retVal;
@@ -4006,50 +4003,6 @@ static STD_RETURN_TYPE_e LTC_WriteRegister(
     return retVal;
 }
 
-/**
- * @brief   configures the data that will be sent to the LTC daisy-chain to configure multiplexer channels.
- *
- * This function does not sent the data to the multiplexer daisy-chain. This is done
- * by the function LTC_SetMuxChannel(), which calls LTC_SetMuxChCommand()..
- *
- * @param   pTxBuff              transmit buffer
- * @param   mux                  multiplexer ID to be configured (0,1,2 or 3)
- * @param   channel              multiplexer channel to be configured (0 to 7)
- *
- */
-static void LTC_SetMuxChCommand(uint16_t *pTxBuff, uint8_t mux, uint8_t channel) {
-    FAS_ASSERT(pTxBuff != NULL_PTR);
-    for (uint16_t i = 0; i < LTC_N_LTC; i++) {
-#if SLAVE_BOARD_VERSION == 2u
-
-        /* using ADG728 */
-        uint8_t address = 0x98u | ((mux % 4u) << 1u);
-        uint8_t data    = 1u << (channel % 8u);
-        if (channel == 0xFFu) { /* no channel selected, output of multiplexer is high impedance */
-            data = 0x00;
-        }
-
-#else
-
-        /* using LTC1380 */
-        uint8_t address = 0x90u | ((mux % 4u) << 1u);
-        uint8_t data    = 0x08u | (channel % 8u);
-        if (channel == 0xFFu) { /* no channel selected, output of multiplexer is high impedance */
-            data = 0x00;
-        }
-
-#endif
-
-        pTxBuff[4u + (i * 8u)] = LTC_ICOM_START | ((address >> 4u) & 0x0Fu); /* 0x6 : LTC6804: ICOM START from Master */
-        pTxBuff[5u + (i * 8u)] = LTC_FCOM_MASTER_NACK | ((address << 4u) & 0xF0u);
-        pTxBuff[6u + (i * 8u)] = LTC_ICOM_BLANK | ((data >> 4u) & 0x0Fu);
-        pTxBuff[7u + (i * 8u)] = LTC_FCOM_MASTER_NACK_STOP | ((data << 4u) & 0xF0u);
-        pTxBuff[8u + (i * 8u)] = LTC_ICOM_NO_TRANSMIT; /* 0x1 : ICOM-STOP */
-        pTxBuff[9u + (i * 8u)] = 0x00;                 /* 0x0 : dummy (Dn) */
-                                                       /* 9: MASTER NACK + STOP (FCOM) */
-    }
-}
-
 /**
  * @brief   sends data to the LTC daisy-chain to read EEPROM on slaves.
  *
@@ -4231,7 +4184,8 @@ static void LTC_SetEepromWriteCommand(LTC_STATE_s *ltc_state, uint16_t *pTxBuff,
 /**
  * @brief   sends data to the LTC daisy-chain to configure multiplexer channels.
  *
- * This function calls the function LTC_SetMuxChCommand() to set the data.
+ * The payloads and PECs are copied from the prebuilt frames (see
+ * #LTC_SetMuxChannelFrames()), the PECs are not calculated at runtime.
  *
  * @param   pSpiInterface   pointer to SPI configuration
  * @param   pTxBuff         transmit buffer
@@ -4256,8 +4210,12 @@ static STD_RETURN_TYPE_e LTC_SetMuxChannel(
     STD_RETURN_TYPE_e statusSPI = STD_NOT_OK;
 
     /* send WRCOMM to send I2C message to choose channel */
-    LTC_SetMuxChCommand(pTxBuff, mux, channel);
-    statusSPI = LTC_WriteRegister(ltc_cmdWRCOMM, pSpiInterface, pTxBuff, pRxBuff, frameLength);
+    pTxBuff[0] = ltc_cmdWRCOMM[0];
+    pTxBuff[1] = ltc_cmdWRCOMM[1];
+    pTxBuff[2] = ltc_cmdWRCOMM[2];
+    pTxBuff[3] = ltc_cmdWRCOMM[3];
+    LTC_SetMuxChannelFrames(pTxBuff, mux, channel);
+    statusSPI = LTC_TRANSMIT_RECEIVE_DATA(pSpiInterface, pTxBuff, pRxBuff, frameLength);
 
     return statusSPI;
 }
@@ -4782,6 +4740,20 @@ extern void TEST_LTC_SetFirstMeasurementCycleFinished(LTC_STATE_s *ltc_state) {
     LTC_SetFirstMeasurementCycleFinished(ltc_state);
 }
 
+extern STD_RETURN_TYPE_e TEST_LTC_StartVoltageMeasurement(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    LTC_ADCMODE_e adcMode,
+    LTC_ADCMEAS_CHAN_e adcMeasCh) {
+    return LTC_StartVoltageMeasurement(pSpiInterface, adcMode, adcMeasCh);
+}
+
+extern STD_RETURN_TYPE_e TEST_LTC_StartGpioMeasurement(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    LTC_ADCMODE_e adcMode,
+    LTC_ADCMEAS_CHAN_e adcMeasCh) {
+    return LTC_StartGpioMeasurement(pSpiInterface, adcMode, adcMeasCh);
+}
+
 /** this define is used for creating the declaration of a function for variable extraction */
 #define TEST_LTC_DEFINE_GET(VARIABLE)                      \
     extern void TEST_LTC_Get_##VARIABLE(uint8_t data[4]) { \
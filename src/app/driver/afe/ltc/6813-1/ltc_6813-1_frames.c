@@ -0,0 +1,282 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltc_6813-1_frames.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup DRIVERS
+ * @prefix  LTC
+ *
+ * @brief   Prebuilt command frames and timing tables of the LTC 681x driver
+ * @details The PECs of the frames are calculated with LTC_CalculatePec15
+ *          (polynomial 0xC599, seed 0x10); the unit test checks every frame
+ *          against the PEC calculation and the driver implementation that
+ *          assembled the frames at runtime.
+ */
+
+/*========== Includes =======================================================*/
+/* clang-format off */
+#include "ltc_6813-1_cfg.h"
+#include "ltc_6813-1_frames.h"
+/* clang-format on */
+
+#include "fassert.h"
+#include "fstd_types.h"
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** length of the command and its PEC at the start of the transmit buffer */
+#define LTC_COMMAND_LENGTH_WITH_PEC (4u)
+
+/** number of channels per multiplexer that have a prebuilt frame */
+#define LTC_NUMBER_OF_MUX_FRAME_CHANNELS (8u)
+
+/** index of the frame that disables the multiplexer */
+#define LTC_MUX_FRAME_DISABLED (LTC_NUMBER_OF_MUX_FRAME_CHANNELS)
+
+/** number of prebuilt frames per multiplexer (all channels and disabled) */
+#define LTC_NUMBER_OF_MUX_FRAMES (LTC_NUMBER_OF_MUX_FRAME_CHANNELS + 1u)
+
+/**
+ * conversion times of one channel selection in the order of #LTC_ADCMODE_e,
+ * the DCP bit does not change the conversion time
+ */
+#define LTC_MEASUREMENT_TIMES(fast, normal, filtered) \
+    {0u, (fast), (normal), (filtered), (fast), (normal), (filtered)}
+
+FAS_STATIC_ASSERT(LTC_ADCMODE_FAST_DCP0 == 1, "LTC_MEASUREMENT_TIMES relies on the order of LTC_ADCMODE_e");
+FAS_STATIC_ASSERT(LTC_ADCMODE_FILTERED_DCP1 == 6, "LTC_MEASUREMENT_TIMES relies on the order of LTC_ADCMODE_e");
+FAS_STATIC_ASSERT(LTC_ADCMODE_E_MAX == 7, "LTC_MEASUREMENT_TIMES relies on the order of LTC_ADCMODE_e");
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/** conversion times in ms, unsupported combinations are 0 */
+static const uint16_t ltc_measurementTime_ms[LTC_ADCMEAS_E_MAX][LTC_ADCMODE_E_MAX] = {
+    [LTC_ADCMEAS_ALLCHANNEL_CELLS] = LTC_MEASUREMENT_TIMES(
+        LTC_STATEMACH_MEAS_ALL_CELLS_FAST_TCYCLE,
+        LTC_STATEMACH_MEAS_ALL_CELLS_NORMAL_TCYCLE,
+        LTC_STATEMACH_MEAS_ALL_CELLS_FILTERED_TCYCLE),
+    [LTC_ADCMEAS_SINGLECHANNEL_TWOCELLS] = LTC_MEASUREMENT_TIMES(
+        LTC_STATEMACH_MEAS_TWO_CELLS_FAST_TCYCLE,
+        LTC_STATEMACH_MEAS_TWO_CELLS_NORMAL_TCYCLE,
+        LTC_STATEMACH_MEAS_TWO_CELLS_FILTERED_TCYCLE),
+    [LTC_ADCMEAS_ALLCHANNEL_GPIOS] = LTC_MEASUREMENT_TIMES(
+        LTC_STATEMACH_MEAS_ALL_GPIOS_FAST_TCYCLE,
+        LTC_STATEMACH_MEAS_ALL_GPIOS_NORMAL_TCYCLE,
+        LTC_STATEMACH_MEAS_ALL_GPIOS_FILTERED_TCYCLE),
+    [LTC_ADCMEAS_SINGLECHANNEL_GPIO1] = LTC_MEASUREMENT_TIMES(
+        LTC_STATEMACH_MEAS_SINGLE_GPIO_FAST_TCYCLE,
+        LTC_STATEMACH_MEAS_SINGLE_GPIO_NORMAL_TCYCLE,
+        LTC_STATEMACH_MEAS_SINGLE_GPIO_FILTERED_TCYCLE),
+    [LTC_ADCMEAS_SINGLECHANNEL_GPIO2] = LTC_MEASUREMENT_TIMES(
+        LTC_STATEMACH_MEAS_SINGLE_GPIO_FAST_TCYCLE,
+        LTC_STATEMACH_MEAS_SINGLE_GPIO_NORMAL_TCYCLE,
+        LTC_STATEMACH_MEAS_SINGLE_GPIO_FILTERED_TCYCLE),
+    [LTC_ADCMEAS_SINGLECHANNEL_GPIO3] = LTC_MEASUREMENT_TIMES(
+        LTC_STATEMACH_MEAS_SINGLE_GPIO_FAST_TCYCLE,
+        LTC_STATEMACH_MEAS_SINGLE_GPIO_NORMAL_TCYCLE,
+        LTC_STATEMACH_MEAS_SINGLE_GPIO_FILTERED_TCYCLE),
+    [LTC_ADCMEAS_SINGLECHANNEL_GPIO4] = LTC_MEASUREMENT_TIMES(
+        LTC_STATEMACH_MEAS_SINGLE_GPIO_FAST_TCYCLE,
+        LTC_STATEMACH_MEAS_SINGLE_GPIO_NORMAL_TCYCLE,
+        LTC_STATEMACH_MEAS_SINGLE_GPIO_FILTERED_TCYCLE),
+    [LTC_ADCMEAS_SINGLECHANNEL_GPIO5] = LTC_MEASUREMENT_TIMES(
+        LTC_STATEMACH_MEAS_SINGLE_GPIO_FAST_TCYCLE,
+        LTC_STATEMACH_MEAS_SINGLE_GPIO_NORMAL_TCYCLE,
+        LTC_STATEMACH_MEAS_SINGLE_GPIO_FILTERED_TCYCLE),
+};
+
+/**
+ * WRCOMM payloads (ICOM/FCOM and data) with their PECs that select a
+ * multiplexer channel. All LTCs in the daisy-chain get the same payload.
+ */
+static const uint8_t ltc_muxFrames[LTC_NUMBER_OF_MUX_ADDRESSES][LTC_NUMBER_OF_MUX_FRAMES][LTC_FRAME_LENGTH_WITH_PEC] = {
+#if SLAVE_BOARD_VERSION == 2u
+    /* ADG728: address 0x98 | (mux << 1), data (1 << channel) */
+    {
+            {0x69u, 0x88u, 0x00u, 0x19u, 0x70u, 0x00u, 0xA3u, 0x5Eu}, /* mux 0, channel 0 */
+            {0x69u, 0x88u, 0x00u, 0x29u, 0x70u, 0x00u, 0x62u, 0xA6u}, /* mux 0, channel 1 */
+            {0x69u, 0x88u, 0x00u, 0x49u, 0x70u, 0x00u, 0x6Au, 0x64u}, /* mux 0, channel 2 */
+            {0x69u, 0x88u, 0x00u, 0x89u, 0x70u, 0x00u, 0x7Bu, 0xE0u}, /* mux 0, channel 3 */
+            {0x69u, 0x88u, 0x01u, 0x09u, 0x70u, 0x00u, 0x58u, 0xE8u}, /* mux 0, channel 4 */
+            {0x69u, 0x88u, 0x02u, 0x09u, 0x70u, 0x00u, 0x1Eu, 0xF8u}, /* mux 0, channel 5 */
+            {0x69u, 0x88u, 0x04u, 0x09u, 0x70u, 0x00u, 0x92u, 0xD8u}, /* mux 0, channel 6 */
+            {0x69u, 0x88u, 0x08u, 0x09u, 0x70u, 0x00u, 0x01u, 0xAAu}, /* mux 0, channel 7 */
+            {0x69u, 0x88u, 0x00u, 0x09u, 0x70u, 0x00u, 0x65u, 0x18u}, /* mux 0, disabled  */
+    },
+    {
+            {0x69u, 0xA8u, 0x00u, 0x19u, 0x70u, 0x00u, 0x61u, 0x4Cu}, /* mux 1, channel 0 */
+            {0x69u, 0xA8u, 0x00u, 0x29u, 0x70u, 0x00u, 0xA0u, 0xB4u}, /* mux 1, channel 1 */
+            {0x69u, 0xA8u, 0x00u, 0x49u, 0x70u, 0x00u, 0xA8u, 0x76u}, /* mux 1, channel 2 */
+            {0x69u, 0xA8u, 0x00u, 0x89u, 0x70u, 0x00u, 0xB9u, 0xF2u}, /* mux 1, channel 3 */
+            {0x69u, 0xA8u, 0x01u, 0x09u, 0x70u, 0x00u, 0x9Au, 0xFAu}, /* mux 1, channel 4 */
+            {0x69u, 0xA8u, 0x02u, 0x09u, 0x70u, 0x00u, 0xDCu, 0xEAu}, /* mux 1, channel 5 */
+            {0x69u, 0xA8u, 0x04u, 0x09u, 0x70u, 0x00u, 0x50u, 0xCAu}, /* mux 1, channel 6 */
+            {0x69u, 0xA8u, 0x08u, 0x09u, 0x70u, 0x00u, 0xC3u, 0xB8u}, /* mux 1, channel 7 */
+            {0x69u, 0xA8u, 0x00u, 0x09u, 0x70u, 0x00u, 0xA7u, 0x0Au}, /* mux 1, disabled  */
+    },
+    {
+            {0x69u, 0xC8u, 0x00u, 0x19u, 0x70u, 0x00u, 0xACu, 0x48u}, /* mux 2, channel 0 */
+            {0x69u, 0xC8u, 0x00u, 0x29u, 0x70u, 0x00u, 0x6Du, 0xB0u}, /* mux 2, channel 1 */
+            {0x69u, 0xC8u, 0x00u, 0x49u, 0x70u, 0x00u, 0x65u, 0x72u}, /* mux 2, channel 2 */
+            {0x69u, 0xC8u, 0x00u, 0x89u, 0x70u, 0x00u, 0x74u, 0xF6u}, /* mux 2, channel 3 */
+            {0x69u, 0xC8u, 0x01u, 0x09u, 0x70u, 0x00u, 0x57u, 0xFEu}, /* mux 2, channel 4 */
+            {0x69u, 0xC8u, 0x02u, 0x09u, 0x70u, 0x00u, 0x11u, 0xEEu}, /* mux 2, channel 5 */
+            {0x69u, 0xC8u, 0x04u, 0x09u, 0x70u, 0x00u, 0x9Du, 0xCEu}, /* mux 2, channel 6 */
+            {0x69u, 0xC8u, 0x08u, 0x09u, 0x70u, 0x00u, 0x0Eu, 0xBCu}, /* mux 2, channel 7 */
+            {0x69u, 0xC8u, 0x00u, 0x09u, 0x70u, 0x00u, 0x6Au, 0x0Eu}, /* mux 2, disabled  */
+    },
+    {
+            {0x69u, 0xE8u, 0x00u, 0x19u, 0x70u, 0x00u, 0x6Eu, 0x5Au}, /* mux 3, channel 0 */
+            {0x69u, 0xE8u, 0x00u, 0x29u, 0x70u, 0x00u, 0xAFu, 0xA2u}, /* mux 3, channel 1 */
+            {0x69u, 0xE8u, 0x00u, 0x49u, 0x70u, 0x00u, 0xA7u, 0x60u}, /* mux 3, channel 2 */
+            {0x69u, 0xE8u, 0x00u, 0x89u, 0x70u, 0x00u, 0xB6u, 0xE4u}, /* mux 3, channel 3 */
+            {0x69u, 0xE8u, 0x01u, 0x09u, 0x70u, 0x00u, 0x95u, 0xECu}, /* mux 3, channel 4 */
+            {0x69u, 0xE8u, 0x02u, 0x09u, 0x70u, 0x00u, 0xD3u, 0xFCu}, /* mux 3, channel 5 */
+            {0x69u, 0xE8u, 0x04u, 0x09u, 0x70u, 0x00u, 0x5Fu, 0xDCu}, /* mux 3, channel 6 */
+            {0x69u, 0xE8u, 0x08u, 0x09u, 0x70u, 0x00u, 0xCCu, 0xAEu}, /* mux 3, channel 7 */
+            {0x69u, 0xE8u, 0x00u, 0x09u, 0x70u, 0x00u, 0xA8u, 0x1Cu}, /* mux 3, disabled  */
+    },
+#else
+    /* LTC1380: address 0x90 | (mux << 1), data 0x08 | channel */
+    {
+            {0x69u, 0x08u, 0x00u, 0x89u, 0x70u, 0x00u, 0x65u, 0xCCu}, /* mux 0, channel 0 */
+            {0x69u, 0x08u, 0x00u, 0x99u, 0x70u, 0x00u, 0xA3u, 0x8Au}, /* mux 0, channel 1 */
+            {0x69u, 0x08u, 0x00u, 0xA9u, 0x70u, 0x00u, 0x62u, 0x72u}, /* mux 0, channel 2 */
+            {0x69u, 0x08u, 0x00u, 0xB9u, 0x70u, 0x00u, 0xA4u, 0x34u}, /* mux 0, channel 3 */
+            {0x69u, 0x08u, 0x00u, 0xC9u, 0x70u, 0x00u, 0x6Au, 0xB0u}, /* mux 0, channel 4 */
+            {0x69u, 0x08u, 0x00u, 0xD9u, 0x70u, 0x00u, 0xACu, 0xF6u}, /* mux 0, channel 5 */
+            {0x69u, 0x08u, 0x00u, 0xE9u, 0x70u, 0x00u, 0x6Du, 0x0Eu}, /* mux 0, channel 6 */
+            {0x69u, 0x08u, 0x00u, 0xF9u, 0x70u, 0x00u, 0xABu, 0x48u}, /* mux 0, channel 7 */
+            {0x69u, 0x08u, 0x00u, 0x09u, 0x70u, 0x00u, 0x7Bu, 0x34u}, /* mux 0, disabled  */
+    },
+    {
+            {0x69u, 0x28u, 0x00u, 0x89u, 0x70u, 0x00u, 0xA7u, 0xDEu}, /* mux 1, channel 0 */
+            {0x69u, 0x28u, 0x00u, 0x99u, 0x70u, 0x00u, 0x61u, 0x98u}, /* mux 1, channel 1 */
+            {0x69u, 0x28u, 0x00u, 0xA9u, 0x70u, 0x00u, 0xA0u, 0x60u}, /* mux 1, channel 2 */
+            {0x69u, 0x28u, 0x00u, 0xB9u, 0x70u, 0x00u, 0x66u, 0x26u}, /* mux 1, channel 3 */
+            {0x69u, 0x28u, 0x00u, 0xC9u, 0x70u, 0x00u, 0xA8u, 0xA2u}, /* mux 1, channel 4 */
+            {0x69u, 0x28u, 0x00u, 0xD9u, 0x70u, 0x00u, 0x6Eu, 0xE4u}, /* mux 1, channel 5 */
+            {0x69u, 0x28u, 0x00u, 0xE9u, 0x70u, 0x00u, 0xAFu, 0x1Cu}, /* mux 1, channel 6 */
+            {0x69u, 0x28u, 0x00u, 0xF9u, 0x70u, 0x00u, 0x69u, 0x5Au}, /* mux 1, channel 7 */
+            {0x69u, 0x28u, 0x00u, 0x09u, 0x70u, 0x00u, 0xB9u, 0x26u}, /* mux 1, disabled  */
+    },
+    {
+            {0x69u, 0x48u, 0x00u, 0x89u, 0x70u, 0x00u, 0x6Au, 0xDAu}, /* mux 2, channel 0 */
+            {0x69u, 0x48u, 0x00u, 0x99u, 0x70u, 0x00u, 0xACu, 0x9Cu}, /* mux 2, channel 1 */
+            {0x69u, 0x48u, 0x00u, 0xA9u, 0x70u, 0x00u, 0x6Du, 0x64u}, /* mux 2, channel 2 */
+            {0x69u, 0x48u, 0x00u, 0xB9u, 0x70u, 0x00u, 0xABu, 0x22u}, /* mux 2, channel 3 */
+            {0x69u, 0x48u, 0x00u, 0xC9u, 0x70u, 0x00u, 0x65u, 0xA6u}, /* mux 2, channel 4 */
+            {0x69u, 0x48u, 0x00u, 0xD9u, 0x70u, 0x00u, 0xA3u, 0xE0u}, /* mux 2, channel 5 */
+            {0x69u, 0x48u, 0x00u, 0xE9u, 0x70u, 0x00u, 0x62u, 0x18u}, /* mux 2, channel 6 */
+            {0x69u, 0x48u, 0x00u, 0xF9u, 0x70u, 0x00u, 0xA4u, 0x5Eu}, /* mux 2, channel 7 */
+            {0x69u, 0x48u, 0x00u, 0x09u, 0x70u, 0x00u, 0x74u, 0x22u}, /* mux 2, disabled  */
+    },
+    {
+            {0x69u, 0x68u, 0x00u, 0x89u, 0x70u, 0x00u, 0xA8u, 0xC8u}, /* mux 3, channel 0 */
+            {0x69u, 0x68u, 0x00u, 0x99u, 0x70u, 0x00u, 0x6Eu, 0x8Eu}, /* mux 3, channel 1 */
+            {0x69u, 0x68u, 0x00u, 0xA9u, 0x70u, 0x00u, 0xAFu, 0x76u}, /* mux 3, channel 2 */
+            {0x69u, 0x68u, 0x00u, 0xB9u, 0x70u, 0x00u, 0x69u, 0x30u}, /* mux 3, channel 3 */
+            {0x69u, 0x68u, 0x00u, 0xC9u, 0x70u, 0x00u, 0xA7u, 0xB4u}, /* mux 3, channel 4 */
+            {0x69u, 0x68u, 0x00u, 0xD9u, 0x70u, 0x00u, 0x61u, 0xF2u}, /* mux 3, channel 5 */
+            {0x69u, 0x68u, 0x00u, 0xE9u, 0x70u, 0x00u, 0xA0u, 0x0Au}, /* mux 3, channel 6 */
+            {0x69u, 0x68u, 0x00u, 0xF9u, 0x70u, 0x00u, 0x66u, 0x4Cu}, /* mux 3, channel 7 */
+            {0x69u, 0x68u, 0x00u, 0x09u, 0x70u, 0x00u, 0xB6u, 0x30u}, /* mux 3, disabled  */
+    },
+#endif
+};
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+
+/**
+ * @brief   gets the prebuilt frame to select a multiplexer channel
+ * @details Like the runtime assembly of the frames before, only the two least
+ *          significant bits of the multiplexer ID and the three least
+ *          significant bits of the channel are used.
+ * @param   mux         multiplexer ID
+ * @param   channel     multiplexer channel or #LTC_MUX_CHANNEL_DISABLED
+ * @return  pointer to the frame (data and PEC)
+ */
+static const uint8_t *LTC_GetMuxFrame(uint8_t mux, uint8_t channel);
+
+/*========== Static Function Implementations ================================*/
+static const uint8_t *LTC_GetMuxFrame(uint8_t mux, uint8_t channel) {
+    uint8_t frame = LTC_MUX_FRAME_DISABLED;
+    if (channel != LTC_MUX_CHANNEL_DISABLED) {
+        frame = channel % LTC_NUMBER_OF_MUX_FRAME_CHANNELS;
+    }
+    return ltc_muxFrames[mux % LTC_NUMBER_OF_MUX_ADDRESSES][frame];
+}
+
+/*========== Extern Function Implementations ================================*/
+extern uint16_t LTC_GetMeasurementTime(LTC_ADCMODE_e adcMode, LTC_ADCMEAS_CHAN_e adcMeasCh) {
+    uint16_t measurementTime_ms = 0u;
+    if ((adcMode < LTC_ADCMODE_E_MAX) && (adcMeasCh < LTC_ADCMEAS_E_MAX)) {
+        measurementTime_ms = ltc_measurementTime_ms[adcMeasCh][adcMode];
+    }
+    return measurementTime_ms;
+}
+
+extern void LTC_SetMuxChannelFrames(uint16_t *pTxBuff, uint8_t mux, uint8_t channel) {
+    FAS_ASSERT(pTxBuff != NULL_PTR);
+    const uint8_t *pFrame = LTC_GetMuxFrame(mux, channel);
+
+    for (uint16_t i = 0u; i < LTC_N_LTC; i++) {
+        uint16_t *pLtcFrame = &pTxBuff[LTC_COMMAND_LENGTH_WITH_PEC + (i * LTC_FRAME_LENGTH_WITH_PEC)];
+        for (uint8_t byte = 0u; byte < LTC_FRAME_LENGTH_WITH_PEC; byte++) {
+            pLtcFrame[byte] = pFrame[byte];
+        }
+    }
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern const uint8_t *TEST_LTC_GetMuxFrame(uint8_t mux, uint8_t channel) {
+    return LTC_GetMuxFrame(mux, channel);
+}
+#endif
@@ -0,0 +1,111 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltc_6813-1_frames.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup DRIVERS
+ * @prefix  LTC
+ *
+ * @brief   Prebuilt command frames and timing tables of the LTC 681x driver
+ * @details The LTC 6804-1, 6811-1, 6812-1 and 6813-1 are all driven by the
+ *          implementation in ltc_6813-1.c. The parts of a transfer that only
+ *          depend on the configuration of the driver (payloads of the
+ *          multiplexer commands and their PECs, conversion times) are
+ *          tabulated here, so that the driver copies them into the transmit
+ *          buffer instead of assembling them and calculating the PECs in
+ *          every measurement cycle.
+ */
+
+#ifndef FOXBMS__LTC_6813_1_FRAMES_H_
+#define FOXBMS__LTC_6813_1_FRAMES_H_
+
+/*========== Includes =======================================================*/
+
+#include "ltc_defs.h"
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/** length of the frame of one LTC in the daisy-chain (data and PEC) */
+#define LTC_FRAME_LENGTH_WITH_PEC (LTC_DATA_SIZE_IN_BYTES + 2u)
+
+/** number of multiplexers that can be addressed per LTC */
+#define LTC_NUMBER_OF_MUX_ADDRESSES (4u)
+
+/** multiplexer channel that disables the multiplexer (output is high impedance) */
+#define LTC_MUX_CHANNEL_DISABLED (0xFFu)
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/**
+ * @brief   gets the conversion time of a measurement
+ * @details The conversion times are tabulated at compile time from the
+ *          configuration of the driver.
+ * @param   adcMode     LTC ADC measurement mode (fast, normal or filtered)
+ * @param   adcMeasCh   measured channels
+ * @return  conversion time in ms, 0 if the combination is not supported
+ */
+extern uint16_t LTC_GetMeasurementTime(LTC_ADCMODE_e adcMode, LTC_ADCMEAS_CHAN_e adcMeasCh);
+
+/**
+ * @brief   writes the prebuilt WRCOMM payloads to select a multiplexer channel
+ * @details The payload and the PEC of every LTC in the daisy-chain are copied
+ *          to the transmit buffer, the command itself is not written.
+ * @param   pTxBuff     transmit buffer
+ * @param   mux         multiplexer ID to be configured (0, 1, 2 or 3)
+ * @param   channel     multiplexer channel to be configured (0 to 7) or
+ *                      #LTC_MUX_CHANNEL_DISABLED
+ */
+extern void LTC_SetMuxChannelFrames(uint16_t *pTxBuff, uint8_t mux, uint8_t channel);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern const uint8_t *TEST_LTC_GetMuxFrame(uint8_t mux, uint8_t channel);
+#endif
+
+#endif /* FOXBMS__LTC_6813_1_FRAMES_H_ */
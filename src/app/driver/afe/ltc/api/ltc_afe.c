@@ -43,7 +43,7 @@
  * @file    ltc_afe.c
  * @author  foxBMS Team
  * @date    2020-05-08 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVER
  * @prefix  AFE
@@ -57,6 +57,7 @@
 #include "afe.h"
 /* clang-format on */
 #include "ltc.h"
+#include "ltc_afe_dma.h"
 
 #include <stdint.h>
 
@@ -74,6 +75,10 @@
 
 extern STD_RETURN_TYPE_e AFE_TriggerIc(void) {
     LTC_Trigger(&ltc_stateBase);
+#if (FOXBMS_AFE_DRIVER_TYPE_NO_FSM == 1)
+    /* The driver runs in the AFE task: advance on DMA notifications instead of polling every millisecond */
+    AFE_WaitForNextStep(&ltc_stateBase);
+#endif
     return STD_OK;
 }
 
@@ -43,7 +43,7 @@
  * @file    ltc.h
  * @author  foxBMS Team
  * @date    2015-09-01 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  LTC
@@ -182,6 +182,14 @@ extern void LTC_InitializeMonitoringPin(void);
 #ifdef UNITY_UNIT_TEST
 extern uint8_t TEST_LTC_CheckReEntrance();
 extern void TEST_LTC_SetFirstMeasurementCycleFinished(LTC_STATE_s *ltc_state);
+extern STD_RETURN_TYPE_e TEST_LTC_StartVoltageMeasurement(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    LTC_ADCMODE_e adcMode,
+    LTC_ADCMEAS_CHAN_e adcMeasCh);
+extern STD_RETURN_TYPE_e TEST_LTC_StartGpioMeasurement(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    LTC_ADCMODE_e adcMode,
+    LTC_ADCMEAS_CHAN_e adcMeasCh);
 
 /** this define is used for creating the declaration of a function for variable extraction
  *  deviate from style guide in order to make the variable name better recognizable
@@ -43,7 +43,7 @@
  * @file    ltc_afe_dma.c
  * @author  foxBMS Team
  * @date    2020-05-27 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  AFE
@@ -55,8 +55,10 @@
 /*========== Includes =======================================================*/
 #include "ltc_afe_dma.h"
 
+#include "ftask.h"
 #include "io.h"
 #include "ltc.h"
+#include "os.h"
 #include "spi.h"
 
 #include <stdbool.h>
@@ -84,10 +86,40 @@ extern void AFE_SetTransmitOngoing(LTC_STATE_s *pLtcState) {
     pLtcState->transmit_ongoing = true;
 }
 
+extern void AFE_WaitForNextStep(LTC_STATE_s *pLtcState) {
+    FAS_ASSERT(pLtcState != NULL_PTR);
+
+    uint32_t waitTime_ms = pLtcState->timer;
+    if (waitTime_ms < LTC_MINIMUM_WAIT_TIME_ms) {
+        waitTime_ms = LTC_MINIMUM_WAIT_TIME_ms;
+    }
+
+    const uint32_t start_ms = OS_GetTickCount();
+    uint32_t elapsed_ms     = 0u;
+    bool transferFinished   = false;
+    while ((elapsed_ms < waitTime_ms) && (transferFinished == false)) {
+        uint32_t notifiedValue = 0u;
+        /* Suspend task and wait for notification, returns after the remaining time if no transfer finishes */
+        (void)OS_WaitForNotification(&notifiedValue, waitTime_ms - elapsed_ms);
+        /* Notifications of transfers the state machine does not wait for, e.g., of conversion
+         * commands, must not shorten the wait time */
+        if ((notifiedValue == LTC_DMA_SPI_FINISHED_NOTIFICATION_VALUE) && (pLtcState->check_spi_flag == STD_OK) &&
+            (AFE_IsTransmitOngoing(pLtcState) == false)) {
+            transferFinished = true;
+        }
+        elapsed_ms = OS_GetTickCount() - start_ms;
+    }
+    pLtcState->timer = 0u;
+}
+
 /* Function called on DMA complete interrupts (TX and RX). */
 void AFE_DmaCallback(uint8_t spiIndex) {
     if (spiIndex == 0u) {
         ltc_stateBase.transmit_ongoing = false;
+#if (FOXBMS_AFE_DRIVER_TYPE_NO_FSM == 1)
+        /* Wake up the AFE task that waits in AFE_WaitForNextStep */
+        (void)OS_NotifyFromIsr(ftsk_taskHandleAfe, LTC_DMA_SPI_FINISHED_NOTIFICATION_VALUE);
+#endif
     } else {
         FAS_ASSERT(FAS_TRAP);
     }
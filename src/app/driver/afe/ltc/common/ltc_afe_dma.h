@@ -43,7 +43,7 @@
  * @file    ltc_afe_dma.h
  * @author  foxBMS Team
  * @date    2020-05-27 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  AFE
@@ -66,6 +66,14 @@
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
+/** value notified to the AFE task when a DMA transfer of the LTC has finished */
+#define LTC_DMA_SPI_FINISHED_NOTIFICATION_VALUE (0x50u)
+
+/**
+ * Minimum time in ms that #AFE_WaitForNextStep() waits if no transfer
+ * finishes, so that the AFE task does not starve tasks with lower priority
+ */
+#define LTC_MINIMUM_WAIT_TIME_ms (1u)
 
 /*========== Extern Constant and Variable Declarations ======================*/
 
@@ -94,6 +102,23 @@ extern bool AFE_IsTransmitOngoing(LTC_STATE_s *pLtcState);
  */
 extern void AFE_SetTransmitOngoing(LTC_STATE_s *pLtcState);
 
+/**
+ * @brief   suspends the AFE task until the next step of the LTC state machine
+ *          is due
+ * @details Used if the LTC driver runs in its own task
+ *          (FOXBMS_AFE_DRIVER_TYPE_NO_FSM) instead of being polled every
+ *          millisecond. The function returns
+ *          - as soon as the DMA callback notifies the end of a transfer that
+ *            the state machine waits for (check_spi_flag is #STD_OK) or
+ *          - when the time requested by the state machine has elapsed, i.e.,
+ *            wait times for conversions are timed waits and not counted
+ *            calls.
+ *          The timer of the state machine is reset, so that the next call of
+ *          LTC_Trigger() processes the next state.
+ * @param[in,out] pLtcState   state of the LTC state machine
+ */
+extern void AFE_WaitForNextStep(LTC_STATE_s *pLtcState);
+
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
 #endif
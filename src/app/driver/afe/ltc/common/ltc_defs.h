@@ -43,7 +43,7 @@
  * @file    ltc_defs.h
  * @author  foxBMS Team
  * @date    2015-09-01 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  LTC
@@ -102,6 +102,7 @@ typedef enum {
     LTC_ADCMODE_FAST_DCP1,     /*!< ADC measurement mode: Fast with DCP1       */
     LTC_ADCMODE_NORMAL_DCP1,   /*!< ADC measurement mode: Normal with DCP1     */
     LTC_ADCMODE_FILTERED_DCP1, /*!< ADC measurement mode: Filtered with DCP1   */
+    LTC_ADCMODE_E_MAX,         /*!< number of ADC measurement modes            */
 } LTC_ADCMODE_e;
 
 /** Number of measured channels */
@@ -116,6 +117,7 @@ typedef enum {
     LTC_ADCMEAS_SINGLECHANNEL_GPIO4,    /*!< only a single ADC channel (GPIO4) is measured  */
     LTC_ADCMEAS_SINGLECHANNEL_GPIO5,    /*!< only a single ADC channel (GPIO5) is measured  */
     LTC_ADCMEAS_ALLCHANNEL_SC,          /*!< all ADC channels + sum of cells are measured   */
+    LTC_ADCMEAS_E_MAX,                  /*!< number of channel selections                   */
 } LTC_ADCMEAS_CHAN_e;
 
 /** States of the LTC state machine */
@@ -43,7 +43,7 @@
  * @file    mxm_1785x.c
  * @author  foxBMS Team
  * @date    2019-01-15 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  MXM
@@ -1086,7 +1086,8 @@ extern STD_RETURN_TYPE_e MXM_ParseVoltagesIntoDB(const MXM_MONITORING_INSTANCE_s
     FAS_ASSERT(kpkInstance->pCellTemperatures_table != NULL_PTR);
     FAS_ASSERT((BS_NR_OF_MODULES_PER_STRING * BS_NR_OF_STRINGS) <= MXM_MAXIMUM_NR_OF_MODULES);
 
-    uint16_t numberValidVoltageMeasurements[BS_NR_OF_STRINGS] = {0};
+    /* the string voltage is taken from the block voltages, only the number of valid cell voltages is used */
+    AFE_CELL_VOLTAGE_ACCUMULATOR_s accumulator[BS_NR_OF_STRINGS] = {0};
     /* voltages */
     for (uint8_t i_mod = 0; i_mod < (BS_NR_OF_MODULES_PER_STRING * BS_NR_OF_STRINGS); i_mod++) {
         const bool moduleIsConnected = MXM_CheckIfADeviceIsConnected(kpkInstance, i_mod);
@@ -1114,16 +1115,22 @@ extern STD_RETURN_TYPE_e MXM_ParseVoltagesIntoDB(const MXM_MONITORING_INSTANCE_s
                 kpkInstance->pCellVoltages_table->cellVoltage_mV[stringNumber][i_mod][cb] =
                     (int16_t)cellVoltageLocal_mV;
             }
-            const STD_RETURN_TYPE_e valueIsPlausible = AFE_PlausibilityCheckVoltageMeasurementRange(
-                kpkInstance->pCellVoltages_table->cellVoltage_mV[stringNumber][i_mod][cb], mxm_plausibleCellVoltages);
-            if ((valueIsPlausible == STD_OK) && moduleIsConnected) {
-                numberValidVoltageMeasurements[stringNumber]++;
-            } else {
-                /* Invalidate cell voltage measurement */
-                kpkInstance->pCellVoltages_table->invalidCellVoltage[stringNumber][moduleNumber] |=
-                    ((uint64_t)1u << cb);
-            }
         }
+        /* all cell voltages of a module that is not connected are invalid */
+        uint64_t notConnectedCellVoltages = 0u;
+        if (moduleIsConnected == false) {
+            notConnectedCellVoltages = UINT64_MAX >> (AFE_PLAUSIBILITY_MAXIMUM_CELL_BLOCKS_PER_MODULE -
+                                                      BS_NR_OF_CELL_BLOCKS_PER_MODULE);
+        }
+        /* Invalidate implausible cell voltage measurements */
+        kpkInstance->pCellVoltages_table->invalidCellVoltage[stringNumber][moduleNumber] |=
+            AFE_PlausibilityCheckModuleCellVoltages(
+                kpkInstance->pCellVoltages_table->cellVoltage_mV[stringNumber][i_mod],
+                BS_NR_OF_CELL_BLOCKS_PER_MODULE,
+                NULL_PTR,
+                notConnectedCellVoltages,
+                mxm_plausibleCellVoltages,
+                &accumulator[stringNumber]);
     }
 
     /* temperatures */
@@ -1157,7 +1164,7 @@ extern STD_RETURN_TYPE_e MXM_ParseVoltagesIntoDB(const MXM_MONITORING_INSTANCE_s
     }
 
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
-        kpkInstance->pCellVoltages_table->nrValidCellVoltages[s]     = numberValidVoltageMeasurements[s];
+        kpkInstance->pCellVoltages_table->nrValidCellVoltages[s]     = accumulator[s].numberOfValidCellVoltages;
         kpkInstance->pCellTemperatures_table->nrValidTemperatures[s] = numberValidTemperatureMeasurements[s];
     }
 
@@ -43,7 +43,7 @@
  * @file    mxm_battery_management.c
  * @author  foxBMS Team
  * @date    2019-01-14 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  MXM
@@ -88,8 +88,23 @@
  */
 #define MXM_5X_BIT_MASK_WRITE_DEVICE_ADDRESS ((uint16_t)0xF8u)
 
+/** number of register addresses that can be addressed by a READALL command */
+#define MXM_5X_NUMBER_OF_REGISTER_ADDRESSES (256u)
+
 /*========== Static Constant and Variable Definitions =======================*/
 
+/**
+ * @brief   PEC bytes of the READALL command frames
+ * @details The READALL frame only depends on the register address. The PEC
+ *          bytes are therefore calculated once for every register address
+ *          (see #MXM_5XInitializeReadallPecTable()) instead of on every call
+ *          of #MXM_5XConstructCommandBufferReadall().
+ */
+static uint8_t mxm_5xReadallPec[MXM_5X_NUMBER_OF_REGISTER_ADDRESSES] = {0u};
+
+/** indicates whether #mxm_5xReadallPec has been calculated */
+static bool mxm_5xReadallPecIsInitialized = false;
+
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
@@ -190,6 +205,13 @@ static STD_RETURN_TYPE_e MXM_5XConstructCommandBufferWriteDevice(MXM_5X_INSTANCE
  */
 static STD_RETURN_TYPE_e MXM_5XConstructCommandBufferReadall(MXM_5X_INSTANCE_s *pInstance);
 
+/**
+ * @brief   calculates the PEC bytes of the READALL command for all register addresses
+ * @details Fills #mxm_5xReadallPec so that #MXM_5XConstructCommandBufferReadall()
+ *          does not need to calculate the CRC of the command on every call.
+ */
+static void MXM_5XInitializeReadallPecTable(void);
+
 /**
  * @brief   handles the error of the underlying state-machine (by resetting it and counting the error)
  * @param[in,out]   pInstance   pointer to the state-struct
@@ -397,6 +419,10 @@ static STD_RETURN_TYPE_e MXM_5XConstructCommandBufferReadall(MXM_5X_INSTANCE_s *
     const MXM_5X_COMMAND_PAYLOAD_s *const pPayload = &pInstance->commandPayload;
     FAS_ASSERT(pPayload != NULL_PTR);
 
+    if (mxm_5xReadallPecIsInitialized == false) {
+        MXM_5XInitializeReadallPecTable();
+    }
+
     if (MXM_5XIsUserAccessibleRegister((uint8_t)pPayload->regAddress, pPayload->model) == STD_OK) {
         /* clear command buffer */
         MXM_5XClearCommandBuffer(pInstance);
@@ -405,8 +431,8 @@ static STD_RETURN_TYPE_e MXM_5XConstructCommandBufferReadall(MXM_5X_INSTANCE_s *
         pInstance->commandBuffer[0] = BATTERY_MANAGEMENT_READALL;
         pInstance->commandBuffer[1] = (uint8_t)pPayload->regAddress;
         pInstance->commandBuffer[2] = DATA_CHECK_BYTE_SEED;
-        /* PEC byte */
-        pInstance->commandBuffer[3] = MXM_CRC8(pInstance->commandBuffer, 3);
+        /* PEC byte (precalculated, as the frame only depends on the register address) */
+        pInstance->commandBuffer[3] = mxm_5xReadallPec[(uint8_t)pPayload->regAddress];
         /* TODO alive-counter? */
         pInstance->commandBufferCurrentLength = 4;
         retval                                = STD_OK;
@@ -421,6 +447,16 @@ static STD_RETURN_TYPE_e MXM_5XConstructCommandBufferReadall(MXM_5X_INSTANCE_s *
     return retval;
 }
 
+static void MXM_5XInitializeReadallPecTable(void) {
+    uint16_t commandFrame[BATTERY_MANAGEMENT_TX_LENGTH_READALL - 1u] = {
+        BATTERY_MANAGEMENT_READALL, 0u, DATA_CHECK_BYTE_SEED};
+    for (uint16_t regAddress = 0u; regAddress < MXM_5X_NUMBER_OF_REGISTER_ADDRESSES; regAddress++) {
+        commandFrame[1u]             = regAddress;
+        mxm_5xReadallPec[regAddress] = MXM_CRC8(commandFrame, (int32_t)(BATTERY_MANAGEMENT_TX_LENGTH_READALL - 1u));
+    }
+    mxm_5xReadallPecIsInitialized = true;
+}
+
 static void MXM_5XHandle41BErrorState(MXM_5X_INSTANCE_s *pInstance) {
     FAS_ASSERT(pInstance != NULL_PTR);
     pInstance->status41b = MXM_41B_STATE_UNSENT;
@@ -949,6 +985,9 @@ extern void MXM_5X_InitializeStateStruct(MXM_5X_INSTANCE_s *pInstance) {
     for (uint32_t i = 0u; i < MXM_5X_RX_BUFFER_LEN; i++) {
         pInstance->rxBuffer[i] = 0u;
     }
+
+    /* command frames that do not change at runtime are prepared on startup */
+    MXM_5XInitializeReadallPecTable();
 }
 
 extern STD_RETURN_TYPE_e MXM_5XGetRXBuffer(
@@ -1119,4 +1158,10 @@ extern STD_RETURN_TYPE_e GEN_MUST_CHECK_RETURN MXM_5XUserAccessibleAddressSpaceC
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
+extern STD_RETURN_TYPE_e TEST_MXM_5XConstructCommandBufferReadall(MXM_5X_INSTANCE_s *pInstance) {
+    return MXM_5XConstructCommandBufferReadall(pInstance);
+}
+extern void TEST_MXM_5XInitializeReadallPecTable(void) {
+    MXM_5XInitializeReadallPecTable();
+}
 #endif
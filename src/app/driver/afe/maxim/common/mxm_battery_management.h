@@ -43,7 +43,7 @@
  * @file    mxm_battery_management.h
  * @author  foxBMS Team
  * @date    2019-01-14 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  MXM
@@ -392,6 +392,8 @@ extern void MXM_5X_InitializeStateStruct(MXM_5X_INSTANCE_s *pInstance);
 
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
+extern STD_RETURN_TYPE_e TEST_MXM_5XConstructCommandBufferReadall(MXM_5X_INSTANCE_s *pInstance);
+extern void TEST_MXM_5XInitializeReadallPecTable(void);
 #endif
 
 #endif /* FOXBMS__MXM_BATTERY_MANAGEMENT_H_ */
@@ -43,7 +43,7 @@
  * @file    mxm_crc8.c
  * @author  foxBMS Team
  * @date    2019-02-05 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  MXM
@@ -102,7 +102,7 @@ static uint8_t MXM_CRC8WithInitValue(uint16_t *pData, int32_t lenData, uint8_t c
      *          This polynomial can also be
      *          called 0x14D according to the notation (0xA6 << 1).
      */
-    const uint8_t mxm_crc8Table[256] = {
+    static const uint8_t mxm_crc8Table[256] = {
         0x00u, 0x3Eu, 0x7Cu, 0x42u, 0xF8u, 0xC6u, 0x84u, 0xBAu, 0x95u, 0xABu, 0xE9u, 0xD7u, 0x6Du, 0x53u, 0x11u, 0x2Fu,
         0x4Fu, 0x71u, 0x33u, 0x0Du, 0xB7u, 0x89u, 0xCBu, 0xF5u, 0xDAu, 0xE4u, 0xA6u, 0x98u, 0x22u, 0x1Cu, 0x5Eu, 0x60u,
         0x9Eu, 0xA0u, 0xE2u, 0xDCu, 0x66u, 0x58u, 0x1Au, 0x24u, 0x0Bu, 0x35u, 0x77u, 0x49u, 0xF3u, 0xCDu, 0x8Fu, 0xB1u,
@@ -43,7 +43,7 @@
  * @file    nxp_mc33775a.c
  * @author  foxBMS Team
  * @date    2020-05-08 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  N775
@@ -65,6 +65,7 @@
 
 #include "afe.h"
 #include "afe_dma.h"
+#include "afe_plausibility.h"
 #include "database.h"
 #include "fassert.h"
 #include "fstd_types.h"
@@ -95,6 +96,12 @@ static DATA_BLOCK_OPEN_WIRE_s n775_openWire         = {.header.uniqueId = DATA_B
 static N775_SUPPLY_CURRENT_s n775_supplyCurrent = {0};
 static N775_ERROR_TABLE_s n775_errorTable       = {0};
 
+/** plausible cell voltage values of the MC33775A */
+static const AFE_PLAUSIBILITY_VALUES_s n775_plausibleCellVoltages = {
+    .maximumPlausibleVoltage_mV = 5000,
+    .minimumPlausibleVoltage_mV = 0,
+};
+
 /*========== Extern Constant and Variable Definitions =======================*/
 
 N775_STATE_s n775_stateBase = {
@@ -314,6 +321,7 @@ static void N775_CaptureMeasurement(N775_STATE_s *pState) {
     uint16_t error                                  = 0u;
     bool gpio03Error                                = false;
     bool gpio47Error                                = false;
+    AFE_CELL_VOLTAGE_ACCUMULATOR_s accumulator      = {.stringVoltage_mV = 0, .numberOfValidCellVoltages = 0u};
 
     /* Send capture command. This ends the last cycle and starts a new one */
     N775_CommunicationWrite(
@@ -346,6 +354,9 @@ static void N775_CaptureMeasurement(N775_STATE_s *pState) {
         }
 
         N775_ErrorHandling(pState, retValPrimary, m);
+        /* cell voltages that could not be read are invalid */
+        uint64_t invalidCellVoltages =
+            UINT64_MAX >> (AFE_PLAUSIBILITY_MAXIMUM_CELL_BLOCKS_PER_MODULE - BS_NR_OF_CELL_BLOCKS_PER_MODULE);
         if (retValPrimary == N775_COMMUNICATION_OK) {
             for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
                 /* Store cell voltages */
@@ -353,6 +364,7 @@ static void N775_CaptureMeasurement(N775_STATE_s *pState) {
                     primaryValues[cb + 1u] = (int16_t)primaryRawValues[cb + 1u];
                     pState->n775Data.cellVoltage->cellVoltage_mV[pState->currentString][m][cb] =
                         (((float_t)primaryValues[cb + 1u]) * 154.0e-6f * 1000.0f);
+                    invalidCellVoltages &= ~((uint64_t)1u << cb);
                 } else {
                     error++;
                 }
@@ -379,6 +391,15 @@ static void N775_CaptureMeasurement(N775_STATE_s *pState) {
             }
         }
 
+        pState->n775Data.cellVoltage->invalidCellVoltage[pState->currentString][m] =
+            AFE_PlausibilityCheckModuleCellVoltages(
+                pState->n775Data.cellVoltage->cellVoltage_mV[pState->currentString][m],
+                BS_NR_OF_CELL_BLOCKS_PER_MODULE,
+                NULL_PTR,
+                invalidCellVoltages,
+                n775_plausibleCellVoltages,
+                &accumulator);
+
         N775_ErrorHandling(pState, retValSecondary, m);
         if (retValSecondary == N775_COMMUNICATION_OK) {
             for (uint8_t g = 4u; g < 8u; g++) {
@@ -434,6 +455,9 @@ static void N775_CaptureMeasurement(N775_STATE_s *pState) {
         }
     }
 
+    pState->n775Data.cellVoltage->stringVoltage_mV[pState->currentString]    = accumulator.stringVoltage_mV;
+    pState->n775Data.cellVoltage->nrValidCellVoltages[pState->currentString] = accumulator.numberOfValidCellVoltages;
+
     DATA_WRITE_DATA(pState->n775Data.cellVoltage, pState->n775Data.cellTemperature, pState->n775Data.allGpioVoltage);
 }
 
@@ -43,7 +43,7 @@
  * @file    can.c
  * @author  foxBMS Team
  * @date    2019-12-04 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  CAN
@@ -689,32 +689,35 @@ static STD_RETURN_TYPE_e CAN_PeriodicTransmit(void) {
     for (uint16_t i = 0u; i < can_txMessagesLength; i++) {
         if (CAN_IsMessagePeriodElapsed(counterTicks, i) == true) {
             if (can_txMessages[i].callbackFunction != NULL_PTR) {
-                can_txMessages[i].callbackFunction(
+                const uint32_t callbackResult = can_txMessages[i].callbackFunction(
                     can_txMessages[i].message, data, can_txMessages[i].pMuxId, &can_kShim);
-                if (CAN_DataSend(
-                        can_txMessages[i].canNode,
-                        can_txMessages[i].message.id,
-                        can_txMessages[i].message.idType,
-                        data) != STD_OK) {
-                    /* message was not sent */
-                    /* store the message */
-                    CAN_BUFFER_ELEMENT_s unsentMessage = {
-                        .canNode = can_txMessages[i].canNode,
-                        .id      = can_txMessages[i].message.id,
-                        .idType  = can_txMessages[i].message.idType,
-                        .data    = {0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u}};
-
-                    for (uint8_t j = 0; j < can_txMessages[i].message.dlc; j++) {
-                        unsentMessage.data[j] = data[j];
-                    }
-
-                    /* add message to queue */
-                    if (OS_SendToBackOfQueue(ftsk_canTxUnsentMessagesQueue, (void *)&unsentMessage, 0u) == OS_SUCCESS) {
-                        /* Queue is not full */
-                        (void)DIAG_Handler(DIAG_ID_CAN_TX_QUEUE_FULL, DIAG_EVENT_OK, DIAG_SYSTEM, 0u);
-                    } else {
-                        /* Queue is full */
-                        (void)DIAG_Handler(DIAG_ID_CAN_TX_QUEUE_FULL, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u);
+                if (callbackResult != CAN_TX_SKIP_MESSAGE) {
+                    if (CAN_DataSend(
+                            can_txMessages[i].canNode,
+                            can_txMessages[i].message.id,
+                            can_txMessages[i].message.idType,
+                            data) != STD_OK) {
+                        /* message was not sent */
+                        /* store the message */
+                        CAN_BUFFER_ELEMENT_s unsentMessage = {
+                            .canNode = can_txMessages[i].canNode,
+                            .id      = can_txMessages[i].message.id,
+                            .idType  = can_txMessages[i].message.idType,
+                            .data    = {0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u}};
+
+                        for (uint8_t j = 0; j < can_txMessages[i].message.dlc; j++) {
+                            unsentMessage.data[j] = data[j];
+                        }
+
+                        /* add message to queue */
+                        if (OS_SendToBackOfQueue(ftsk_canTxUnsentMessagesQueue, (void *)&unsentMessage, 0u) ==
+                            OS_SUCCESS) {
+                            /* Queue is not full */
+                            (void)DIAG_Handler(DIAG_ID_CAN_TX_QUEUE_FULL, DIAG_EVENT_OK, DIAG_SYSTEM, 0u);
+                        } else {
+                            /* Queue is full */
+                            (void)DIAG_Handler(DIAG_ID_CAN_TX_QUEUE_FULL, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u);
+                        }
                     }
                 }
                 retVal = STD_OK;
@@ -43,7 +43,7 @@
  * @file    can_cbs_rx_debug.c
  * @author  foxBMS Team
  * @date    2021-04-20 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVER
  * @prefix  CANRX
@@ -55,6 +55,7 @@
 /*========== Includes =======================================================*/
 #include "can_cbs_rx.h"
 #include "can_cbs_tx_debug-response.h"
+#include "can_cbs_tx_snapshot.h"
 #include "can_cbs_tx_debug-unsupported-multiplexer-values.h"
 #include "can_cfg_rx-message-definitions.h"
 #include "can_helper.h"
@@ -85,6 +86,8 @@
 #define CANRX_DEBUG_MESSAGE_MUX_VALUE_SOFTWARE_RESET      (0x02u)
 #define CANRX_DEBUG_MESSAGE_MUX_VALUE_FRAM_INITIALIZATION (0x03u)
 #define CANRX_DEBUG_MESSAGE_MUX_VALUE_TIME_INFO           (0x04u)
+#define CANRX_DEBUG_MESSAGE_MUX_VALUE_SNAPSHOT_REQUEST    (0x05u)
+#define CANRX_DEBUG_MESSAGE_MUX_VALUE_SNAPSHOT_FLOW       (0x06u)
 /** @} */
 
 /** @{
@@ -149,6 +152,27 @@
 #define CANRX_MUX_SOFTWARE_SIGNAL_TRIGGER_REQUEST_RTC_TIME_LENGTH    (CANRX_BIT)
 /** @} */
 
+/** @{
+ * configuration of the snapshot request signals for multiplexer
+ * 'SnapshotRequest' in the 'Debug' message (bit n of the block mask selects
+ * data block ID n)
+ */
+#define CANRX_MUX_SNAPSHOT_REQUEST_SIGNAL_BLOCK_MASK_START_BIT (15u)
+#define CANRX_MUX_SNAPSHOT_REQUEST_SIGNAL_BLOCK_MASK_LENGTH    (56u)
+/** @} */
+
+/** @{
+ * configuration of the snapshot flow control signals for multiplexer
+ * 'SnapshotFlowControl' in the 'Debug' message
+ */
+#define CANRX_MUX_SNAPSHOT_FLOW_SIGNAL_FLOW_STATUS_START_BIT     (15u)
+#define CANRX_MUX_SNAPSHOT_FLOW_SIGNAL_FLOW_STATUS_LENGTH        (8u)
+#define CANRX_MUX_SNAPSHOT_FLOW_SIGNAL_BLOCK_SIZE_START_BIT      (23u)
+#define CANRX_MUX_SNAPSHOT_FLOW_SIGNAL_BLOCK_SIZE_LENGTH         (8u)
+#define CANRX_MUX_SNAPSHOT_FLOW_SIGNAL_SEPARATION_TIME_START_BIT (31u)
+#define CANRX_MUX_SNAPSHOT_FLOW_SIGNAL_SEPARATION_TIME_LENGTH    (8u)
+/** @} */
+
 /*========== Static Constant and Variable Definitions =======================*/
 
 /*========== Extern Constant and Variable Definitions =======================*/
@@ -191,6 +215,21 @@ static void CANRX_ProcessFramInitializationMux(uint64_t messageData, CAN_ENDIANN
  */
 static void CANRX_ProcessTimeInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness);
 
+/**
+ * @brief   Parses CAN message to handle database snapshot requests
+ * @param   messageData message data of the CAN message
+ * @param   endianness  endianness of the message
+ */
+static void CANRX_ProcessSnapshotRequestMux(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+
+/**
+ * @brief   Parses CAN message to handle flow control requests of the
+ *          database snapshot transfer
+ * @param   messageData message data of the CAN message
+ * @param   endianness  endianness of the message
+ */
+static void CANRX_ProcessSnapshotFlowControlMux(uint64_t messageData, CAN_ENDIANNESS_e endianness);
+
 /**
  * @brief   Parses the CAN message to retrieve the hundredth of seconds
  *          information
@@ -743,6 +782,59 @@ static void CANRX_TriggerTimeInfoMessage(void) {
     }
 }
 
+static void CANRX_ProcessSnapshotRequestMux(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    /* AXIVION Routine Generic-MissingParameterAssert: messageData: parameter accept whole range */
+    FAS_ASSERT(endianness == CAN_BIG_ENDIAN);
+
+    uint64_t blockMask = 0u;
+    CAN_RxGetSignalDataFromMessageData(
+        messageData,
+        CANRX_MUX_SNAPSHOT_REQUEST_SIGNAL_BLOCK_MASK_START_BIT,
+        CANRX_MUX_SNAPSHOT_REQUEST_SIGNAL_BLOCK_MASK_LENGTH,
+        &blockMask,
+        endianness);
+    /* the snapshot is taken and transmitted by the periodic transfer */
+    CANTX_RequestSnapshot(blockMask);
+}
+
+static void CANRX_ProcessSnapshotFlowControlMux(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    /* AXIVION Routine Generic-MissingParameterAssert: messageData: parameter accept whole range */
+    FAS_ASSERT(endianness == CAN_BIG_ENDIAN);
+
+    uint64_t flowStatus     = 0u;
+    uint64_t blockSize      = 0u;
+    uint64_t separationTime = 0u;
+    CAN_RxGetSignalDataFromMessageData(
+        messageData,
+        CANRX_MUX_SNAPSHOT_FLOW_SIGNAL_FLOW_STATUS_START_BIT,
+        CANRX_MUX_SNAPSHOT_FLOW_SIGNAL_FLOW_STATUS_LENGTH,
+        &flowStatus,
+        endianness);
+    CAN_RxGetSignalDataFromMessageData(
+        messageData,
+        CANRX_MUX_SNAPSHOT_FLOW_SIGNAL_BLOCK_SIZE_START_BIT,
+        CANRX_MUX_SNAPSHOT_FLOW_SIGNAL_BLOCK_SIZE_LENGTH,
+        &blockSize,
+        endianness);
+    CAN_RxGetSignalDataFromMessageData(
+        messageData,
+        CANRX_MUX_SNAPSHOT_FLOW_SIGNAL_SEPARATION_TIME_START_BIT,
+        CANRX_MUX_SNAPSHOT_FLOW_SIGNAL_SEPARATION_TIME_LENGTH,
+        &separationTime,
+        endianness);
+
+    /* unknown flow states abort the transfer */
+    CANTX_SNAPSHOT_FLOW_STATUS_e status = CANTX_SNAPSHOT_FLOW_STATUS_ABORT;
+    if (flowStatus == (uint64_t)CANTX_SNAPSHOT_FLOW_STATUS_CONTINUE_TO_SEND) {
+        status = CANTX_SNAPSHOT_FLOW_STATUS_CONTINUE_TO_SEND;
+    } else if (flowStatus == (uint64_t)CANTX_SNAPSHOT_FLOW_STATUS_WAIT) {
+        status = CANTX_SNAPSHOT_FLOW_STATUS_WAIT;
+    } else {
+        /* abort */
+    }
+    CANTX_SetSnapshotFlowControl(status, (uint8_t)blockSize, (uint8_t)separationTime);
+}
+
 /*========== Extern Function Implementations ================================*/
 extern uint32_t CANRX_Debug(
     CAN_MESSAGE_PROPERTIES_s message,
@@ -781,6 +873,12 @@ extern uint32_t CANRX_Debug(
         case CANRX_DEBUG_MESSAGE_MUX_VALUE_TIME_INFO:
             CANRX_ProcessTimeInfoMux(messageData, message.endianness);
             break;
+        case CANRX_DEBUG_MESSAGE_MUX_VALUE_SNAPSHOT_REQUEST:
+            CANRX_ProcessSnapshotRequestMux(messageData, message.endianness);
+            break;
+        case CANRX_DEBUG_MESSAGE_MUX_VALUE_SNAPSHOT_FLOW:
+            CANRX_ProcessSnapshotFlowControlMux(messageData, message.endianness);
+            break;
         default:
             CANTX_UnsupportedMultiplexerValue(message.id, (uint32_t)muxValue);
             break;
@@ -879,5 +977,11 @@ extern void TEST_CANRX_ProcessFramInitializationMux(uint64_t messageData, CAN_EN
 extern void TEST_CANRX_ProcessTimeInfoMux(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
     CANRX_ProcessTimeInfoMux(messageData, endianness);
 }
+extern void TEST_CANRX_ProcessSnapshotRequestMux(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    CANRX_ProcessSnapshotRequestMux(messageData, endianness);
+}
+extern void TEST_CANRX_ProcessSnapshotFlowControlMux(uint64_t messageData, CAN_ENDIANNESS_e endianness) {
+    CANRX_ProcessSnapshotFlowControlMux(messageData, endianness);
+}
 
 #endif
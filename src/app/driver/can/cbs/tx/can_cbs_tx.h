@@ -43,7 +43,7 @@
  * @file    can_cbs_tx.h
  * @author  foxBMS Team
  * @date    2021-04-20 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVER
  * @prefix  CANTX
@@ -93,6 +93,8 @@ extern uint32_t CANTX_BmsStateDetails(
     const CAN_SHIM_s *const kpkCanShim);
 /**
  * @brief can tx callback function for cell voltages
+ * @details If #CANTX_CELL_STREAMING is true, only changed or overdue groups
+ *          are sent and #CAN_TX_SKIP_MESSAGE is returned otherwise.
  * @param[in] message     contains the message ID, DLC and endianness
  * @param[in] pCanData    payload of can frame
  * @param[in] pMuxId      multiplexer for multiplexed CAN messages
@@ -105,6 +107,8 @@ extern uint32_t CANTX_CellVoltages(
     const CAN_SHIM_s *const kpkCanShim);
 /**
  * @brief can tx callback function for cell temperatures
+ * @details If #CANTX_CELL_STREAMING is true, only changed or overdue groups
+ *          are sent and #CAN_TX_SKIP_MESSAGE is returned otherwise.
  * @param[in] message     contains the message ID, DLC and endianness
  * @param[in] pCanData    payload of can frame
  * @param[in] pMuxId      multiplexer for multiplexed CAN messages
@@ -227,6 +231,8 @@ extern uint32_t CANTX_StringValuesP1(
 
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
+extern uint16_t TEST_CANTX_StreamCellVoltages(const CAN_SHIM_s *const kpkCanShim);
+extern uint16_t TEST_CANTX_StreamCellTemperatures(const CAN_SHIM_s *const kpkCanShim);
 #endif
 
 #endif /* FOXBMS__CAN_CBS_TX_H_ */
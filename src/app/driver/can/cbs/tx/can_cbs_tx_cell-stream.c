@@ -0,0 +1,259 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    can_cbs_tx_cell-stream.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup DRIVER
+ * @prefix  CANTX
+ *
+ * @brief   Delta based streaming of multiplexed cell data
+ * @details Instead of cycling through all multiplexer values at a fixed
+ *          rate, the streaming mode sends the groups that changed first.
+ *          Groups older than refreshBound_frames - numberOfGroups are
+ *          overdue. A frame is only used for a changed group, if the overdue
+ *          groups can still be sent oldest first within the refresh bound
+ *          afterwards. Otherwise the oldest group is sent, so that every
+ *          group is sent at the latest after refreshBound_frames frames.
+ */
+
+/*========== Includes =======================================================*/
+#include "general.h"
+
+#include "can_cbs_tx_cell-stream.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   Checks if a group has to be transmitted due to a changed value
+ * @param[in] kpStream        stream state
+ * @param[in] group           group to be checked
+ * @param[in] kpValues        current values
+ * @param[in] kpInvalidFlags  current invalid flags
+ * @param[in] deadband        change that has to be exceeded
+ * @return  true if a value changed by more than deadband or an invalid flag
+ *          changed, false otherwise
+ */
+static bool CANTX_HasGroupChanged(
+    const CANTX_CELL_STREAM_s *kpStream,
+    uint16_t group,
+    const int16_t *kpValues,
+    const uint8_t *kpInvalidFlags,
+    int16_t deadband);
+
+/**
+ * @brief   Stores the current values of a group as transmitted
+ * @param[in,out] pStream         stream state
+ * @param[in]     group           transmitted group
+ * @param[in]     kpValues        current values
+ * @param[in]     kpInvalidFlags  current invalid flags
+ */
+static void CANTX_MarkGroupAsTransmitted(
+    CANTX_CELL_STREAM_s *pStream,
+    uint16_t group,
+    const int16_t *kpValues,
+    const uint8_t *kpInvalidFlags);
+
+/*========== Static Function Implementations ================================*/
+static bool CANTX_HasGroupChanged(
+    const CANTX_CELL_STREAM_s *kpStream,
+    uint16_t group,
+    const int16_t *kpValues,
+    const uint8_t *kpInvalidFlags,
+    int16_t deadband) {
+    /* AXIVION Routine Generic-MissingParameterAssert: kpStream: parameter checked in calling function */
+    /* AXIVION Routine Generic-MissingParameterAssert: group: parameter checked in calling function */
+    /* AXIVION Routine Generic-MissingParameterAssert: kpValues: parameter checked in calling function */
+    /* AXIVION Routine Generic-MissingParameterAssert: kpInvalidFlags: parameter checked in calling function */
+    /* AXIVION Routine Generic-MissingParameterAssert: deadband: parameter checked in calling function */
+    bool hasChanged            = false;
+    const uint16_t kFirstValue = group * (uint16_t)kpStream->valuesPerGroup;
+    uint16_t endValue          = kFirstValue + (uint16_t)kpStream->valuesPerGroup;
+    if (endValue > kpStream->numberOfValues) {
+        /* last group is only partially used */
+        endValue = kpStream->numberOfValues;
+    }
+    for (uint16_t v = kFirstValue; (v < endValue) && (hasChanged == false); v++) {
+        int32_t difference = (int32_t)kpValues[v] - (int32_t)kpStream->pTransmittedValues[v];
+        if (difference < 0) {
+            difference = -difference;
+        }
+        if ((difference > (int32_t)deadband) || (kpInvalidFlags[v] != kpStream->pTransmittedInvalidFlags[v])) {
+            hasChanged = true;
+        }
+    }
+    return hasChanged;
+}
+
+static void CANTX_MarkGroupAsTransmitted(
+    CANTX_CELL_STREAM_s *pStream,
+    uint16_t group,
+    const int16_t *kpValues,
+    const uint8_t *kpInvalidFlags) {
+    /* AXIVION Routine Generic-MissingParameterAssert: pStream: parameter checked in calling function */
+    /* AXIVION Routine Generic-MissingParameterAssert: group: parameter checked in calling function */
+    /* AXIVION Routine Generic-MissingParameterAssert: kpValues: parameter checked in calling function */
+    /* AXIVION Routine Generic-MissingParameterAssert: kpInvalidFlags: parameter checked in calling function */
+    const uint16_t kFirstValue = group * (uint16_t)pStream->valuesPerGroup;
+    uint16_t endValue          = kFirstValue + (uint16_t)pStream->valuesPerGroup;
+    if (endValue > pStream->numberOfValues) {
+        /* last group is only partially used */
+        endValue = pStream->numberOfValues;
+    }
+    for (uint16_t v = kFirstValue; v < endValue; v++) {
+        pStream->pTransmittedValues[v]       = kpValues[v];
+        pStream->pTransmittedInvalidFlags[v] = kpInvalidFlags[v];
+    }
+    pStream->pFramesSinceTransmission[group] = 0u;
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void CANTX_CellStreamInitialize(CANTX_CELL_STREAM_s *pStream) {
+    FAS_ASSERT(pStream != NULL_PTR);
+    FAS_ASSERT(pStream->pTransmittedValues != NULL_PTR);
+    FAS_ASSERT(pStream->pTransmittedInvalidFlags != NULL_PTR);
+    FAS_ASSERT(pStream->pFramesSinceTransmission != NULL_PTR);
+    FAS_ASSERT(pStream->valuesPerGroup > 0u);
+    FAS_ASSERT(pStream->numberOfGroups > 0u);
+    FAS_ASSERT(pStream->numberOfGroups < CANTX_CELL_STREAM_NO_GROUP);
+    FAS_ASSERT(
+        ((uint32_t)pStream->numberOfGroups * (uint32_t)pStream->valuesPerGroup) >=
+        (uint32_t)pStream->numberOfValues);
+    /* the refresh bound can only be met if every group fits into one round */
+    FAS_ASSERT(pStream->refreshBound_frames >= pStream->numberOfGroups);
+    FAS_ASSERT(pStream->deadband >= 0);
+
+    for (uint16_t v = 0u; v < pStream->numberOfValues; v++) {
+        pStream->pTransmittedValues[v]       = 0;
+        pStream->pTransmittedInvalidFlags[v] = 0u;
+    }
+    for (uint16_t g = 0u; g < pStream->numberOfGroups; g++) {
+        /* mark every group as overdue: the first round transmits all groups in order */
+        pStream->pFramesSinceTransmission[g] = pStream->refreshBound_frames;
+    }
+    pStream->nextGroup     = 0u;
+    pStream->isInitialized = true;
+}
+
+extern uint16_t CANTX_CellStreamSelectGroup(
+    CANTX_CELL_STREAM_s *pStream,
+    const int16_t *kpValues,
+    const uint8_t *kpInvalidFlags,
+    const uint16_t *kpPriorityValueIndices,
+    uint8_t numberOfPriorityValues) {
+    FAS_ASSERT(pStream != NULL_PTR);
+    FAS_ASSERT(pStream->isInitialized == true);
+    FAS_ASSERT(kpValues != NULL_PTR);
+    FAS_ASSERT(kpInvalidFlags != NULL_PTR);
+    FAS_ASSERT((kpPriorityValueIndices != NULL_PTR) || (numberOfPriorityValues == 0u));
+
+    uint16_t selectedGroup = CANTX_CELL_STREAM_NO_GROUP;
+
+    /* 1. age all groups, find the group that waits the longest and count the overdue groups */
+    const uint16_t kOverdueThreshold_frames = pStream->refreshBound_frames - pStream->numberOfGroups + 1u;
+    uint16_t oldestGroup                    = 0u;
+    uint16_t numberOfOverdueGroups          = 0u;
+    for (uint16_t g = 0u; g < pStream->numberOfGroups; g++) {
+        if (pStream->pFramesSinceTransmission[g] < UINT16_MAX) {
+            pStream->pFramesSinceTransmission[g]++;
+        }
+        if (pStream->pFramesSinceTransmission[g] > pStream->pFramesSinceTransmission[oldestGroup]) {
+            oldestGroup = g;
+        }
+        if (pStream->pFramesSinceTransmission[g] >= kOverdueThreshold_frames) {
+            numberOfOverdueGroups++;
+        }
+    }
+    /* This frame may only be used for a changed group if all overdue groups can still be sent in time
+     * afterwards: every overdue group is at most as old as the oldest one, so they all fit into the
+     * remaining frames if oldest age + number of overdue groups does not exceed the refresh bound. */
+    const uint32_t kRequiredFrames =
+        (uint32_t)pStream->pFramesSinceTransmission[oldestGroup] + (uint32_t)numberOfOverdueGroups;
+    if (kRequiredFrames > (uint32_t)pStream->refreshBound_frames) {
+        selectedGroup = oldestGroup;
+    }
+
+    /* 2. groups of priority values are sent on any change */
+    for (uint8_t p = 0u; (p < numberOfPriorityValues) && (selectedGroup == CANTX_CELL_STREAM_NO_GROUP); p++) {
+        if (kpPriorityValueIndices[p] < pStream->numberOfValues) {
+            const uint16_t kGroup = kpPriorityValueIndices[p] / (uint16_t)pStream->valuesPerGroup;
+            if (CANTX_HasGroupChanged(pStream, kGroup, kpValues, kpInvalidFlags, 0) == true) {
+                selectedGroup = kGroup;
+            }
+        }
+    }
+
+    /* 3. round-robin search for groups that changed more than the deadband */
+    for (uint16_t i = 0u; (i < pStream->numberOfGroups) && (selectedGroup == CANTX_CELL_STREAM_NO_GROUP); i++) {
+        uint16_t group = pStream->nextGroup + i;
+        if (group >= pStream->numberOfGroups) {
+            group -= pStream->numberOfGroups;
+        }
+        if (CANTX_HasGroupChanged(pStream, group, kpValues, kpInvalidFlags, pStream->deadband) == true) {
+            selectedGroup = group;
+            /* continue the next search behind this group to not starve other groups */
+            pStream->nextGroup = group + 1u;
+            if (pStream->nextGroup >= pStream->numberOfGroups) {
+                pStream->nextGroup = 0u;
+            }
+        }
+    }
+
+    if (selectedGroup != CANTX_CELL_STREAM_NO_GROUP) {
+        CANTX_MarkGroupAsTransmitted(pStream, selectedGroup, kpValues, kpInvalidFlags);
+    }
+    return selectedGroup;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+#endif
@@ -0,0 +1,124 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    can_cbs_tx_cell-stream.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup DRIVER
+ * @prefix  CANTX
+ *
+ * @brief   Header for the delta based streaming of multiplexed cell data
+ * @details Selects which group of a multiplexed cell message is transmitted
+ *          next. Groups with a changed minimum or maximum cell are sent
+ *          first, then groups with a value that moved beyond a deadband or
+ *          with a changed invalid flag. Every group is retransmitted at the
+ *          latest after a configurable number of frames.
+ */
+
+#ifndef FOXBMS__CAN_CBS_TX_CELL_STREAM_H_
+#define FOXBMS__CAN_CBS_TX_CELL_STREAM_H_
+
+/*========== Includes =======================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** return value of #CANTX_CellStreamSelectGroup if no group needs to be sent */
+#define CANTX_CELL_STREAM_NO_GROUP (UINT16_MAX)
+
+/** state of one streamed, multiplexed cell message */
+typedef struct {
+    uint16_t numberOfValues;            /*!< number of streamed values (cells or sensors) */
+    uint8_t valuesPerGroup;             /*!< number of values transmitted in one frame */
+    uint16_t numberOfGroups;            /*!< number of groups, i.e., multiplexer values */
+    int16_t deadband;                   /*!< change that has to be exceeded to send a group */
+    uint16_t refreshBound_frames;       /*!< maximum number of frames between two transmissions of a group */
+    int16_t *pTransmittedValues;        /*!< last transmitted value, numberOfValues entries */
+    uint8_t *pTransmittedInvalidFlags;  /*!< last transmitted invalid flag, numberOfValues entries */
+    uint16_t *pFramesSinceTransmission; /*!< frames since last transmission, numberOfGroups entries */
+    uint16_t nextGroup;                 /*!< start of the round-robin search for changed groups */
+    bool isInitialized;                 /*!< true after #CANTX_CellStreamInitialize has been called */
+} CANTX_CELL_STREAM_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   Resets the stream state
+ * @details All groups are marked as overdue, so that the first
+ *          numberOfGroups frames transmit every group once in order.
+ * @param[in,out] pStream   stream to be initialized
+ */
+extern void CANTX_CellStreamInitialize(CANTX_CELL_STREAM_s *pStream);
+
+/**
+ * @brief   Selects the group that is transmitted in the current frame
+ * @details Has to be called once per message period. Selection order:
+ *          1. the oldest group, if it would otherwise miss the refresh bound
+ *          2. the group of a priority value (e.g., minimum/maximum cell) if
+ *             any value or invalid flag of this group changed
+ *          3. the next group (round-robin) with a value change larger than
+ *             the deadband or a changed invalid flag
+ *          The selected group is stored as transmitted.
+ * @param[in,out] pStream                   stream state
+ * @param[in]     kpValues                  current values, numberOfValues entries
+ * @param[in]     kpInvalidFlags            current invalid flags (0u: valid), numberOfValues entries
+ * @param[in]     kpPriorityValueIndices    indices of values that are transmitted with priority
+ * @param[in]     numberOfPriorityValues    number of entries in kpPriorityValueIndices
+ * @return  selected group or #CANTX_CELL_STREAM_NO_GROUP if nothing needs
+ *          to be transmitted
+ */
+extern uint16_t CANTX_CellStreamSelectGroup(
+    CANTX_CELL_STREAM_s *pStream,
+    const int16_t *kpValues,
+    const uint8_t *kpInvalidFlags,
+    const uint16_t *kpPriorityValueIndices,
+    uint8_t numberOfPriorityValues);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+#endif
+
+#endif /* FOXBMS__CAN_CBS_TX_CELL_STREAM_H_ */
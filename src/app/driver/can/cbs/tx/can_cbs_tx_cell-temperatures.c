@@ -43,7 +43,7 @@
  * @file    can_cbs_tx_cell-temperatures.c
  * @author  foxBMS Team
  * @date    2021-04-20 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVER
  * @prefix  CANTX
@@ -54,6 +54,7 @@
 
 /*========== Includes =======================================================*/
 #include "can_cbs_tx.h"
+#include "can_cbs_tx_cell-stream.h"
 #include "can_cfg_tx-message-definitions.h"
 #include "can_helper.h"
 #include "foxmath.h"
@@ -62,6 +63,26 @@
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
+/** the number of temperatures per message-frame */
+#define CANTX_NUMBER_OF_MUX_TEMPERATURES_PER_MESSAGE (6u)
+
+/** number of multiplexer values (groups) of this message */
+#define CANTX_NUMBER_OF_CELL_TEMPERATURE_GROUPS                                    \
+    ((BS_NR_OF_TEMP_SENSORS + CANTX_NUMBER_OF_MUX_TEMPERATURES_PER_MESSAGE - 1u) / \
+     CANTX_NUMBER_OF_MUX_TEMPERATURES_PER_MESSAGE)
+
+/** maximum number of frames between two transmissions of the same group in streaming mode */
+#define CANTX_CELL_TEMPERATURES_STREAM_REFRESH_BOUND_frames \
+    (CANTX_CELL_STREAM_REFRESH_BOUND_ms / CANTX_CELL_TEMPERATURES_PERIOD_ms)
+
+FAS_STATIC_ASSERT(
+    (CANTX_CELL_TEMPERATURES_STREAM_REFRESH_BOUND_frames >= CANTX_NUMBER_OF_CELL_TEMPERATURE_GROUPS),
+    "Refresh bound of the cell temperature stream is shorter than one round-robin cycle");
+
+/* the multiplexer signal has 8 bits */
+FAS_STATIC_ASSERT(
+    (CANTX_NUMBER_OF_CELL_TEMPERATURE_GROUPS <= 256u),
+    "Number of cell temperature groups exceeds the range of the multiplexer signal");
 
 /*========== Static Constant and Variable Definitions =======================*/
 
@@ -84,6 +105,27 @@ static const CAN_SIGNAL_TYPE_s cantx_cell3Temperature_degC       = {47u, 8u, 1.0
 static const CAN_SIGNAL_TYPE_s cantx_cell4Temperature_degC       = {55u, 8u, 1.0f, 0.0f, -128.0f, 127.0f};
 static const CAN_SIGNAL_TYPE_s cantx_cell5Temperature_degC       = {63u, 8u, 1.0f, 0.0f, -128.0f, 127.0f};
 
+/** state of the cell temperature stream (only used if #CANTX_CELL_STREAMING is true) @{*/
+static int16_t cantx_transmittedCellTemperatures_ddegC[BS_NR_OF_TEMP_SENSORS]                         = {0};
+static uint8_t cantx_transmittedCellTemperatureInvalidFlags[BS_NR_OF_TEMP_SENSORS]                    = {0u};
+static uint16_t cantx_framesSinceCellTemperatureTransmission[CANTX_NUMBER_OF_CELL_TEMPERATURE_GROUPS] = {0u};
+static uint8_t cantx_cellTemperatureInvalidFlags[BS_NR_OF_TEMP_SENSORS]                               = {0u};
+static uint16_t cantx_cellTemperaturePriorityIndices[2u * BS_NR_OF_STRINGS]                           = {0u};
+
+static CANTX_CELL_STREAM_s cantx_cellTemperatureStream = {
+    .numberOfValues           = BS_NR_OF_TEMP_SENSORS,
+    .valuesPerGroup           = CANTX_NUMBER_OF_MUX_TEMPERATURES_PER_MESSAGE,
+    .numberOfGroups           = CANTX_NUMBER_OF_CELL_TEMPERATURE_GROUPS,
+    .deadband                 = CANTX_CELL_TEMPERATURES_STREAM_DEADBAND_ddegC,
+    .refreshBound_frames      = CANTX_CELL_TEMPERATURES_STREAM_REFRESH_BOUND_frames,
+    .pTransmittedValues       = cantx_transmittedCellTemperatures_ddegC,
+    .pTransmittedInvalidFlags = cantx_transmittedCellTemperatureInvalidFlags,
+    .pFramesSinceTransmission = cantx_framesSinceCellTemperatureTransmission,
+    .nextGroup                = 0u,
+    .isInitialized            = false,
+};
+/**@}*/
+
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
@@ -95,7 +137,7 @@ static const CAN_SIGNAL_TYPE_s cantx_cell5Temperature_degC       = {63u, 8u, 1.0
  * invalid flag data and temperature data
  * in the CAN frame.
  *
- * @param[in] muxId                              multiplexer value
+ * @param[in] sensorIndex                        index of the temperature sensor
  * @param[in] pMessage                           pointer to CAN frame data
  * @param[in] cellTemperatureSignal              signal characteristics for temperature data
  * @param[in] cellTemperatureInvalidFlagSignal   signal characteristics for invalid flag data
@@ -103,24 +145,47 @@ static const CAN_SIGNAL_TYPE_s cantx_cell5Temperature_degC       = {63u, 8u, 1.0
  * @param[in] kpkCanShim                         shim to the database entries
  */
 static void CANTX_TemperatureSetData(
-    uint8_t muxId,
+    uint16_t sensorIndex,
     uint64_t *pMessage,
     CAN_SIGNAL_TYPE_s cellTemperatureSignal,
     CAN_SIGNAL_TYPE_s cellTemperatureInvalidFlagSignal,
     CAN_ENDIANNESS_e endianness,
     const CAN_SHIM_s *const kpkCanShim);
 
+/**
+ * @brief   Sets multiplexer and all temperatures of one group in the CAN frame
+ * @param[in] group       multiplexer value of the frame
+ * @param[in] pMessage    pointer to CAN frame data
+ * @param[in] endianness  big or little endianness of data
+ * @param[in] kpkCanShim  shim to the database entries
+ */
+static void CANTX_SetCellTemperatureGroup(
+    uint16_t group,
+    uint64_t *pMessage,
+    CAN_ENDIANNESS_e endianness,
+    const CAN_SHIM_s *const kpkCanShim);
+
+/**
+ * @brief   Selects the group to be sent in streaming mode
+ * @details Reads the cell temperatures and the minimum/maximum values from
+ *          the database. The groups of the minimum and maximum temperature
+ *          of each string are prioritized.
+ * @param[in] kpkCanShim  shim to the database entries
+ * @return  selected group or #CANTX_CELL_STREAM_NO_GROUP
+ */
+static uint16_t CANTX_StreamCellTemperatures(const CAN_SHIM_s *const kpkCanShim);
+
 /*========== Static Function Implementations ================================*/
 
 static void CANTX_TemperatureSetData(
-    uint8_t muxId,
+    uint16_t sensorIndex,
     uint64_t *pMessage,
     CAN_SIGNAL_TYPE_s cellTemperatureSignal,
     CAN_SIGNAL_TYPE_s cellTemperatureInvalidFlagSignal,
     CAN_ENDIANNESS_e endianness,
     const CAN_SHIM_s *const kpkCanShim) {
     /* sensor index must not be greater than the number of sensors */
-    if (muxId < BS_NR_OF_TEMP_SENSORS) {
+    if (sensorIndex < BS_NR_OF_TEMP_SENSORS) {
         /* start_index end_index module
          * 00          17        module1
          * 18          35        module2
@@ -132,9 +197,10 @@ static void CANTX_TemperatureSetData(
          */
 
         /* Get string, module and cell number */
-        const uint8_t stringNumber = DATA_GetStringNumberFromTemperatureIndex(muxId);
-        const uint8_t moduleNumber = DATA_GetModuleNumberFromTemperatureIndex(muxId);
-        const uint8_t sensorNumber = DATA_GetSensorNumberFromTemperatureIndex(muxId);
+        const DATA_POSITION_s *const kpkPosition = &data_kTemperatureSensorPosition[sensorIndex];
+        const uint8_t stringNumber               = kpkPosition->stringNumber;
+        const uint8_t moduleNumber               = kpkPosition->moduleNumber;
+        const uint8_t sensorNumber               = kpkPosition->number;
 
         uint32_t signalData_valid;
         /* Valid bits data */
@@ -168,102 +234,147 @@ static void CANTX_TemperatureSetData(
     }
 }
 
-/*========== Extern Function Implementations ================================*/
-extern uint32_t CANTX_CellTemperatures(
-    CAN_MESSAGE_PROPERTIES_s message,
-    uint8_t *pCanData,
-    uint8_t *pMuxId,
+static void CANTX_SetCellTemperatureGroup(
+    uint16_t group,
+    uint64_t *pMessage,
+    CAN_ENDIANNESS_e endianness,
     const CAN_SHIM_s *const kpkCanShim) {
-    FAS_ASSERT(message.id == CANTX_CELL_TEMPERATURES_ID);
-    FAS_ASSERT(message.idType == CANTX_CELL_TEMPERATURES_ID_TYPE);
-    FAS_ASSERT(message.dlc == CAN_FOXBMS_MESSAGES_DEFAULT_DLC);
-    FAS_ASSERT(pCanData != NULL_PTR);
-    FAS_ASSERT(pMuxId != NULL_PTR);
-    FAS_ASSERT(kpkCanShim != NULL_PTR);
-    uint64_t messageData = 0u;
-
-    /* Reset mux if maximum was reached */
-    if (*pMuxId >= BS_NR_OF_TEMP_SENSORS) {
-        *pMuxId = 0u;
-    }
-
-    /* first signal to transmit cell voltages: get database values */
-    if (*pMuxId == 0u) {
-        DATA_READ_DATA(kpkCanShim->pTableCellTemperature);
-    }
+    /* AXIVION Routine Generic-MissingParameterAssert: group: parameter checked in calling function */
+    /* AXIVION Routine Generic-MissingParameterAssert: pMessage: passed parameter created from calling function */
+    /* AXIVION Routine Generic-MissingParameterAssert: endianness: parameter checked in calling function */
+    /* AXIVION Routine Generic-MissingParameterAssert: kpkCanShim: parameter checked in calling function */
+    const uint16_t firstSensorIndex = group * CANTX_NUMBER_OF_MUX_TEMPERATURES_PER_MESSAGE;
 
     /* Set mux signal in CAN frame */
-    uint32_t signalData = *pMuxId / 6u; /* 6 temperatures per module */
     CAN_TxSetMessageDataWithSignalData(
-        &messageData,
+        pMessage,
         cantx_cellTemperatureMultiplexer.bitStart,
         cantx_cellTemperatureMultiplexer.bitLength,
-        signalData,
-        message.endianness);
+        (uint32_t)group,
+        endianness);
 
     /* Set other signals in CAN frame */
     /* Each temperature frame contains 6 temperatures, with a correspond invalid flag*/
     CANTX_TemperatureSetData(
-        *pMuxId,
-        &messageData,
+        firstSensorIndex,
+        pMessage,
         cantx_cell0Temperature_degC,
         cantx_cell0TemperatureInvalidFlag,
-        message.endianness,
+        endianness,
         kpkCanShim);
-    /* Increment multiplexer for next cell */
-    (*pMuxId)++;
     CANTX_TemperatureSetData(
-        *pMuxId,
-        &messageData,
+        firstSensorIndex + 1u,
+        pMessage,
         cantx_cell1Temperature_degC,
         cantx_cell1TemperatureInvalidFlag,
-        message.endianness,
+        endianness,
         kpkCanShim);
-    /* Increment multiplexer for next cell */
-    (*pMuxId)++;
     CANTX_TemperatureSetData(
-        *pMuxId,
-        &messageData,
+        firstSensorIndex + 2u,
+        pMessage,
         cantx_cell2Temperature_degC,
         cantx_cell2TemperatureInvalidFlag,
-        message.endianness,
+        endianness,
         kpkCanShim);
-    /* Increment multiplexer for next cell */
-    (*pMuxId)++;
     CANTX_TemperatureSetData(
-        *pMuxId,
-        &messageData,
+        firstSensorIndex + 3u,
+        pMessage,
         cantx_cell3Temperature_degC,
         cantx_cell3TemperatureInvalidFlag,
-        message.endianness,
+        endianness,
         kpkCanShim);
-    /* Increment multiplexer for next cell */
-    (*pMuxId)++;
     CANTX_TemperatureSetData(
-        *pMuxId,
-        &messageData,
+        firstSensorIndex + 4u,
+        pMessage,
         cantx_cell4Temperature_degC,
         cantx_cell4TemperatureInvalidFlag,
-        message.endianness,
+        endianness,
         kpkCanShim);
-    /* Increment multiplexer for next cell */
-    (*pMuxId)++;
     CANTX_TemperatureSetData(
-        *pMuxId,
-        &messageData,
+        firstSensorIndex + 5u,
+        pMessage,
         cantx_cell5Temperature_degC,
         cantx_cell5TemperatureInvalidFlag,
-        message.endianness,
+        endianness,
         kpkCanShim);
-    /* Increment multiplexer for next cell */
-    (*pMuxId)++;
+}
+
+static uint16_t CANTX_StreamCellTemperatures(const CAN_SHIM_s *const kpkCanShim) {
+    FAS_ASSERT(kpkCanShim != NULL_PTR);
+    if (cantx_cellTemperatureStream.isInitialized == false) {
+        CANTX_CellStreamInitialize(&cantx_cellTemperatureStream);
+    }
+    DATA_READ_DATA(kpkCanShim->pTableCellTemperature, kpkCanShim->pTableMinMax);
+
+    DATA_ExpandInvalidCellTemperatures(kpkCanShim->pTableCellTemperature, cantx_cellTemperatureInvalidFlags);
+    const DATA_BLOCK_MIN_MAX_s *const kpkMinMax = kpkCanShim->pTableMinMax;
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        const uint16_t stringOffset  = s * BS_NR_OF_TEMP_SENSORS_PER_STRING;
+        const uint16_t minimumSensor = (kpkMinMax->nrModuleMinimumTemperature[s] * BS_NR_OF_TEMP_SENSORS_PER_MODULE) +
+                                       kpkMinMax->nrSensorMinimumTemperature[s];
+        const uint16_t maximumSensor = (kpkMinMax->nrModuleMaximumTemperature[s] * BS_NR_OF_TEMP_SENSORS_PER_MODULE) +
+                                       kpkMinMax->nrSensorMaximumTemperature[s];
+        cantx_cellTemperaturePriorityIndices[2u * s]        = stringOffset + minimumSensor;
+        cantx_cellTemperaturePriorityIndices[(2u * s) + 1u] = stringOffset + maximumSensor;
+    }
+
+    /* the database stores the temperatures of all strings consecutively in sensor index order */
+    return CANTX_CellStreamSelectGroup(
+        &cantx_cellTemperatureStream,
+        &kpkCanShim->pTableCellTemperature->cellTemperature_ddegC[0u][0u][0u],
+        cantx_cellTemperatureInvalidFlags,
+        cantx_cellTemperaturePriorityIndices,
+        2u * BS_NR_OF_STRINGS);
+}
+
+/*========== Extern Function Implementations ================================*/
+extern uint32_t CANTX_CellTemperatures(
+    CAN_MESSAGE_PROPERTIES_s message,
+    uint8_t *pCanData,
+    uint8_t *pMuxId,
+    const CAN_SHIM_s *const kpkCanShim) {
+    FAS_ASSERT(message.id == CANTX_CELL_TEMPERATURES_ID);
+    FAS_ASSERT(message.idType == CANTX_CELL_TEMPERATURES_ID_TYPE);
+    FAS_ASSERT(message.dlc == CAN_FOXBMS_MESSAGES_DEFAULT_DLC);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pMuxId != NULL_PTR);
+    FAS_ASSERT(kpkCanShim != NULL_PTR);
+    uint64_t messageData = 0u;
+    uint32_t retVal      = CAN_TX_TRANSMIT_MESSAGE;
+
+    if (CANTX_CELL_STREAMING == true) {
+        const uint16_t group = CANTX_StreamCellTemperatures(kpkCanShim);
+        if (group == CANTX_CELL_STREAM_NO_GROUP) {
+            retVal = CAN_TX_SKIP_MESSAGE;
+        } else {
+            CANTX_SetCellTemperatureGroup(group, &messageData, message.endianness, kpkCanShim);
+        }
+    } else {
+        /* Reset mux if maximum was reached */
+        if (*pMuxId >= BS_NR_OF_TEMP_SENSORS) {
+            *pMuxId = 0u;
+        }
+
+        /* first signal to transmit cell temperatures: get database values */
+        if (*pMuxId == 0u) {
+            DATA_READ_DATA(kpkCanShim->pTableCellTemperature);
+        }
+
+        CANTX_SetCellTemperatureGroup(
+            *pMuxId / CANTX_NUMBER_OF_MUX_TEMPERATURES_PER_MESSAGE, &messageData, message.endianness, kpkCanShim);
+        /* Increment multiplexer for next group of sensors */
+        *pMuxId += CANTX_NUMBER_OF_MUX_TEMPERATURES_PER_MESSAGE;
+    }
 
     /* All signal data copied in CAN frame, now copy data in the buffer that will be use to send the frame */
     CAN_TxSetCanDataWithMessageData(messageData, pCanData, message.endianness);
 
-    return 0;
+    return retVal;
 }
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
+extern uint16_t TEST_CANTX_StreamCellTemperatures(const CAN_SHIM_s *const kpkCanShim) {
+    return CANTX_StreamCellTemperatures(kpkCanShim);
+}
 #endif
@@ -43,7 +43,7 @@
  * @file    can_cbs_tx_cell-voltages.c
  * @author  foxBMS Team
  * @date    2021-04-20 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVER
  * @prefix  CANTX
@@ -54,6 +54,7 @@
 
 /*========== Includes =======================================================*/
 #include "can_cbs_tx.h"
+#include "can_cbs_tx_cell-stream.h"
 #include "can_cfg_tx-message-definitions.h"
 #include "can_helper.h"
 
@@ -66,6 +67,27 @@
 /** the number of voltages per message-frame */
 #define CANTX_NUMBER_OF_MUX_VOLTAGES_PER_MESSAGE (4u)
 
+/** number of cell voltages transmitted by this message */
+#define CANTX_NUMBER_OF_CELL_VOLTAGES (BS_NR_OF_STRINGS * BS_NR_OF_CELL_BLOCKS_PER_STRING)
+
+/** number of multiplexer values (groups) of this message */
+#define CANTX_NUMBER_OF_CELL_VOLTAGE_GROUPS                                            \
+    ((CANTX_NUMBER_OF_CELL_VOLTAGES + CANTX_NUMBER_OF_MUX_VOLTAGES_PER_MESSAGE - 1u) / \
+     CANTX_NUMBER_OF_MUX_VOLTAGES_PER_MESSAGE)
+
+/** maximum number of frames between two transmissions of the same group in streaming mode */
+#define CANTX_CELL_VOLTAGES_STREAM_REFRESH_BOUND_frames \
+    (CANTX_CELL_STREAM_REFRESH_BOUND_ms / CANTX_CELL_VOLTAGES_PERIOD_ms)
+
+FAS_STATIC_ASSERT(
+    (CANTX_CELL_VOLTAGES_STREAM_REFRESH_BOUND_frames >= CANTX_NUMBER_OF_CELL_VOLTAGE_GROUPS),
+    "Refresh bound of the cell voltage stream is shorter than one round-robin cycle");
+
+/* the multiplexer signal has 8 bits */
+FAS_STATIC_ASSERT(
+    (CANTX_NUMBER_OF_CELL_VOLTAGE_GROUPS <= 256u),
+    "Number of cell voltage groups exceeds the range of the multiplexer signal");
+
 /**
  * CAN signals used in this message
  * Parameters:
@@ -81,6 +103,27 @@ static const CAN_SIGNAL_TYPE_s cantx_cellVoltage1_mV         = {30u, 13u, 1.0f,
 static const CAN_SIGNAL_TYPE_s cantx_cellVoltage2_mV         = {33u, 13u, 1.0f, 0.0f, 0.0f, 8192.0f};
 static const CAN_SIGNAL_TYPE_s cantx_cellVoltage3_mV         = {52u, 13u, 1.0f, 0.0f, 0.0f, 8192.0f};
 
+/** state of the cell voltage stream (only used if #CANTX_CELL_STREAMING is true) @{*/
+static int16_t cantx_transmittedCellVoltages_mV[CANTX_NUMBER_OF_CELL_VOLTAGES]                = {0};
+static uint8_t cantx_transmittedCellVoltageInvalidFlags[CANTX_NUMBER_OF_CELL_VOLTAGES]        = {0u};
+static uint16_t cantx_framesSinceCellVoltageTransmission[CANTX_NUMBER_OF_CELL_VOLTAGE_GROUPS] = {0u};
+static uint8_t cantx_cellVoltageInvalidFlags[CANTX_NUMBER_OF_CELL_VOLTAGES]                   = {0u};
+static uint16_t cantx_cellVoltagePriorityIndices[2u * BS_NR_OF_STRINGS]                       = {0u};
+
+static CANTX_CELL_STREAM_s cantx_cellVoltageStream = {
+    .numberOfValues           = CANTX_NUMBER_OF_CELL_VOLTAGES,
+    .valuesPerGroup           = CANTX_NUMBER_OF_MUX_VOLTAGES_PER_MESSAGE,
+    .numberOfGroups           = CANTX_NUMBER_OF_CELL_VOLTAGE_GROUPS,
+    .deadband                 = CANTX_CELL_VOLTAGES_STREAM_DEADBAND_mV,
+    .refreshBound_frames      = CANTX_CELL_VOLTAGES_STREAM_REFRESH_BOUND_frames,
+    .pTransmittedValues       = cantx_transmittedCellVoltages_mV,
+    .pTransmittedInvalidFlags = cantx_transmittedCellVoltageInvalidFlags,
+    .pFramesSinceTransmission = cantx_framesSinceCellVoltageTransmission,
+    .nextGroup                = 0u,
+    .isInitialized            = false,
+};
+/**@}*/
+
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
@@ -91,7 +134,7 @@ static const CAN_SIGNAL_TYPE_s cantx_cellVoltage3_mV         = {52u, 13u, 1.0f,
  * invalid flag data and voltage data
  * in the CAN frame.
  *
- * @param[in] muxId                          multiplexer value
+ * @param[in] cellIndex                      index of the cell in the string
  * @param[in] pMessage                       pointer to CAN frame data
  * @param[in] cellVoltageSignal              signal characteristics for voltage data
  * @param[in] cellVoltageInvalidFlagSignal   signal characteristics for invalid flag data
@@ -99,23 +142,46 @@ static const CAN_SIGNAL_TYPE_s cantx_cellVoltage3_mV         = {52u, 13u, 1.0f,
  * @param[in] kpkCanShim                     shim to the database entries
  */
 static void CANTX_VoltageSetData(
-    uint8_t muxId,
+    uint16_t cellIndex,
     uint64_t *pMessage,
     CAN_SIGNAL_TYPE_s cellVoltageSignal,
     CAN_SIGNAL_TYPE_s cellVoltageInvalidFlagSignal,
     CAN_ENDIANNESS_e endianness,
     const CAN_SHIM_s *const kpkCanShim);
 
+/**
+ * @brief   Sets multiplexer and all voltages of one group in the CAN frame
+ * @param[in] group       multiplexer value of the frame
+ * @param[in] pMessage    pointer to CAN frame data
+ * @param[in] endianness  big or little endianness of data
+ * @param[in] kpkCanShim  shim to the database entries
+ */
+static void CANTX_SetCellVoltageGroup(
+    uint16_t group,
+    uint64_t *pMessage,
+    CAN_ENDIANNESS_e endianness,
+    const CAN_SHIM_s *const kpkCanShim);
+
+/**
+ * @brief   Selects the group to be sent in streaming mode
+ * @details Reads the cell voltages and the minimum/maximum values from the
+ *          database. The groups of the minimum and maximum cell of each
+ *          string are prioritized.
+ * @param[in] kpkCanShim  shim to the database entries
+ * @return  selected group or #CANTX_CELL_STREAM_NO_GROUP
+ */
+static uint16_t CANTX_StreamCellVoltages(const CAN_SHIM_s *const kpkCanShim);
+
 /*========== Static Function Implementations ================================*/
 
 static void CANTX_VoltageSetData(
-    uint8_t muxId,
+    uint16_t cellIndex,
     uint64_t *pMessage,
     CAN_SIGNAL_TYPE_s cellVoltageSignal,
     CAN_SIGNAL_TYPE_s cellVoltageInvalidFlagSignal,
     CAN_ENDIANNESS_e endianness,
     const CAN_SHIM_s *const kpkCanShim) {
-    /* AXIVION Routine Generic-MissingParameterAssert: muxId: parameter checked in calling function */
+    /* AXIVION Routine Generic-MissingParameterAssert: cellIndex: parameter checked in calling function */
     /* AXIVION Routine Generic-MissingParameterAssert: pMessage: passed parameter created from calling function */
     /* AXIVION Routine Generic-MissingParameterAssert: cellVoltageSignal: Assertion done in CAN_TxPrepareSignalData */
     /* AXIVION Routine Generic-MissingParameterAssert: cellVoltageInvalidFlagSignal: Assertion done by caller */
@@ -123,16 +189,17 @@ static void CANTX_VoltageSetData(
     /* AXIVION Routine Generic-MissingParameterAssert: kpkCanShim: parameter checked in calling function */
 
     /* cell index must not be greater than the number of cells */
-    if (muxId < (BS_NR_OF_CELL_BLOCKS_PER_STRING * BS_NR_OF_STRINGS)) {
+    if (cellIndex < CANTX_NUMBER_OF_CELL_VOLTAGES) {
         /* Get string, module and cell number */
-        const uint8_t stringNumber    = DATA_GetStringNumberFromVoltageIndex(muxId);
-        const uint8_t moduleNumber    = DATA_GetModuleNumberFromVoltageIndex(muxId);
-        const uint8_t cellBlockNumber = DATA_GetCellNumberFromVoltageIndex(muxId);
+        const DATA_POSITION_s *const kpkPosition = &data_kCellBlockPosition[cellIndex];
+        const uint8_t stringNumber               = kpkPosition->stringNumber;
+        const uint8_t moduleNumber               = kpkPosition->moduleNumber;
+        const uint8_t cellBlockNumber            = kpkPosition->number;
 
         uint32_t signalData_valid = 0u;
         /* Valid bits data */
         if ((kpkCanShim->pTableCellVoltage->invalidCellVoltage[stringNumber][moduleNumber] &
-             (0x01u << cellBlockNumber)) == 0u) {
+             ((uint64_t)1u << cellBlockNumber)) == 0u) {
             signalData_valid = 0u;
         } else {
             signalData_valid = 1u;
@@ -156,6 +223,64 @@ static void CANTX_VoltageSetData(
     }
 }
 
+static void CANTX_SetCellVoltageGroup(
+    uint16_t group,
+    uint64_t *pMessage,
+    CAN_ENDIANNESS_e endianness,
+    const CAN_SHIM_s *const kpkCanShim) {
+    /* AXIVION Routine Generic-MissingParameterAssert: group: parameter checked in calling function */
+    /* AXIVION Routine Generic-MissingParameterAssert: pMessage: passed parameter created from calling function */
+    /* AXIVION Routine Generic-MissingParameterAssert: endianness: parameter checked in calling function */
+    /* AXIVION Routine Generic-MissingParameterAssert: kpkCanShim: parameter checked in calling function */
+    const uint16_t firstCellIndex = group * CANTX_NUMBER_OF_MUX_VOLTAGES_PER_MESSAGE;
+
+    /* Set mux signal in CAN frame */
+    CAN_TxSetMessageDataWithSignalData(
+        pMessage,
+        cantx_cellVoltageMultiplexer.bitStart,
+        cantx_cellVoltageMultiplexer.bitLength,
+        (uint32_t)group,
+        endianness);
+
+    /* Set other signals in CAN frame */
+    CANTX_VoltageSetData(
+        firstCellIndex, pMessage, cantx_cellVoltage0_mV, cantx_cellVoltage0InvalidFlag, endianness, kpkCanShim);
+    CANTX_VoltageSetData(
+        firstCellIndex + 1u, pMessage, cantx_cellVoltage1_mV, cantx_cellVoltage1InvalidFlag, endianness, kpkCanShim);
+    CANTX_VoltageSetData(
+        firstCellIndex + 2u, pMessage, cantx_cellVoltage2_mV, cantx_cellVoltage2InvalidFlag, endianness, kpkCanShim);
+    CANTX_VoltageSetData(
+        firstCellIndex + 3u, pMessage, cantx_cellVoltage3_mV, cantx_cellVoltage3InvalidFlag, endianness, kpkCanShim);
+}
+
+static uint16_t CANTX_StreamCellVoltages(const CAN_SHIM_s *const kpkCanShim) {
+    FAS_ASSERT(kpkCanShim != NULL_PTR);
+    if (cantx_cellVoltageStream.isInitialized == false) {
+        CANTX_CellStreamInitialize(&cantx_cellVoltageStream);
+    }
+    DATA_READ_DATA(kpkCanShim->pTableCellVoltage, kpkCanShim->pTableMinMax);
+
+    DATA_ExpandInvalidCellVoltages(kpkCanShim->pTableCellVoltage, cantx_cellVoltageInvalidFlags);
+    const DATA_BLOCK_MIN_MAX_s *const kpkMinMax = kpkCanShim->pTableMinMax;
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        const uint16_t stringOffset = s * BS_NR_OF_CELL_BLOCKS_PER_STRING;
+        const uint16_t minimumCell  = (kpkMinMax->nrModuleMinimumCellVoltage[s] * BS_NR_OF_CELL_BLOCKS_PER_MODULE) +
+                                      kpkMinMax->nrCellMinimumCellVoltage[s];
+        const uint16_t maximumCell  = (kpkMinMax->nrModuleMaximumCellVoltage[s] * BS_NR_OF_CELL_BLOCKS_PER_MODULE) +
+                                      kpkMinMax->nrCellMaximumCellVoltage[s];
+        cantx_cellVoltagePriorityIndices[2u * s]        = stringOffset + minimumCell;
+        cantx_cellVoltagePriorityIndices[(2u * s) + 1u] = stringOffset + maximumCell;
+    }
+
+    /* the database stores the voltages of all strings consecutively in cell index order */
+    return CANTX_CellStreamSelectGroup(
+        &cantx_cellVoltageStream,
+        &kpkCanShim->pTableCellVoltage->cellVoltage_mV[0u][0u][0u],
+        cantx_cellVoltageInvalidFlags,
+        cantx_cellVoltagePriorityIndices,
+        2u * BS_NR_OF_STRINGS);
+}
+
 /*========== Extern Function Implementations ================================*/
 extern uint32_t CANTX_CellVoltages(
     CAN_MESSAGE_PROPERTIES_s message,
@@ -170,49 +295,40 @@ extern uint32_t CANTX_CellVoltages(
     FAS_ASSERT(pMuxId != NULL_PTR);
     FAS_ASSERT(kpkCanShim != NULL_PTR);
     uint64_t messageData = 0u;
+    uint32_t retVal      = CAN_TX_TRANSMIT_MESSAGE;
 
-    /* Reset mux if maximum was reached */
-    if (*pMuxId >= (BS_NR_OF_STRINGS * BS_NR_OF_CELL_BLOCKS_PER_STRING)) {
-        *pMuxId = 0u;
-    }
-    /* First signal to transmit cell voltages: get database values */
-    if (*pMuxId == 0u) {
-        DATA_READ_DATA(kpkCanShim->pTableCellVoltage);
-    }
-
-    /* Set mux signal in CAN frame */
-    uint32_t signalData = *pMuxId / CANTX_NUMBER_OF_MUX_VOLTAGES_PER_MESSAGE;
-    CAN_TxSetMessageDataWithSignalData(
-        &messageData,
-        cantx_cellVoltageMultiplexer.bitStart,
-        cantx_cellVoltageMultiplexer.bitLength,
-        (uint32_t)signalData,
-        message.endianness);
+    if (CANTX_CELL_STREAMING == true) {
+        const uint16_t group = CANTX_StreamCellVoltages(kpkCanShim);
+        if (group == CANTX_CELL_STREAM_NO_GROUP) {
+            retVal = CAN_TX_SKIP_MESSAGE;
+        } else {
+            CANTX_SetCellVoltageGroup(group, &messageData, message.endianness, kpkCanShim);
+        }
+    } else {
+        /* Reset mux if maximum was reached */
+        if (*pMuxId >= CANTX_NUMBER_OF_CELL_VOLTAGES) {
+            *pMuxId = 0u;
+        }
+        /* First signal to transmit cell voltages: get database values */
+        if (*pMuxId == 0u) {
+            DATA_READ_DATA(kpkCanShim->pTableCellVoltage);
+        }
 
-    /* Set other signals in CAN frame */
-    CANTX_VoltageSetData(
-        *pMuxId, &messageData, cantx_cellVoltage0_mV, cantx_cellVoltage0InvalidFlag, message.endianness, kpkCanShim);
-    /* Increment multiplexer for next cell */
-    (*pMuxId)++;
-    CANTX_VoltageSetData(
-        *pMuxId, &messageData, cantx_cellVoltage1_mV, cantx_cellVoltage1InvalidFlag, message.endianness, kpkCanShim);
-    /* Increment multiplexer for next cell */
-    (*pMuxId)++;
-    CANTX_VoltageSetData(
-        *pMuxId, &messageData, cantx_cellVoltage2_mV, cantx_cellVoltage2InvalidFlag, message.endianness, kpkCanShim);
-    /* Increment multiplexer for next cell */
-    (*pMuxId)++;
-    CANTX_VoltageSetData(
-        *pMuxId, &messageData, cantx_cellVoltage3_mV, cantx_cellVoltage3InvalidFlag, message.endianness, kpkCanShim);
-    /* Increment multiplexer for next cell */
-    (*pMuxId)++;
+        CANTX_SetCellVoltageGroup(
+            *pMuxId / CANTX_NUMBER_OF_MUX_VOLTAGES_PER_MESSAGE, &messageData, message.endianness, kpkCanShim);
+        /* Increment multiplexer for next group of cells */
+        *pMuxId += CANTX_NUMBER_OF_MUX_VOLTAGES_PER_MESSAGE;
+    }
 
     /* All signal data copied in CAN frame, now copy data in the buffer that will be use to send the frame */
     CAN_TxSetCanDataWithMessageData(messageData, pCanData, message.endianness);
 
-    return 0;
+    return retVal;
 }
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
+extern uint16_t TEST_CANTX_StreamCellVoltages(const CAN_SHIM_s *const kpkCanShim) {
+    return CANTX_StreamCellVoltages(kpkCanShim);
+}
 #endif
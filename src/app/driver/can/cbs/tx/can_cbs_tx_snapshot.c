@@ -0,0 +1,647 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    can_cbs_tx_snapshot.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup DRIVER
+ * @prefix  CANTX
+ *
+ * @brief   Transfer of database snapshots over the debug interface
+ * @details The data blocks are borrowed from the database (see
+ *          #DATA_BorrowDataBlock) and serialized without an intermediate
+ *          copy. A data block that has been written while it was serialized
+ *          is serialized again, at most #DATA_MAXIMUM_BORROW_ATTEMPTS times.
+ *          Runs of zero bytes (unused entries, padding, cleared flags) are
+ *          encoded in one byte. At most
+ *          #CANTX_SNAPSHOT_MAXIMUM_BLOCKS_PER_CALL data blocks are serialized
+ *          per call of the transfer, so that a snapshot of all data blocks
+ *          does not delay the other tasks of the 10ms task.
+ *
+ *          The transfer follows ISO 15765-2: after the first frame the
+ *          transfer waits for a flow control request of the host, which
+ *          defines the number of consecutive frames until the next flow
+ *          control request (block size) and the minimum time between two
+ *          consecutive frames (separation time). Other than in ISO 15765-2,
+ *          the flow control request is sent as multiplexer value of the
+ *          debug message.
+ */
+
+/*========== Includes =======================================================*/
+#include "general.h"
+
+#include "can_cbs_tx_snapshot.h"
+
+#include "can.h"
+#include "can_cfg_tx-message-definitions.h"
+#include "database.h"
+#include "fassert.h"
+#include "fstd_types.h"
+#include "os.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** shortest run of zero bytes that is encoded as zero run */
+#define CANTX_SNAPSHOT_MINIMUM_ZERO_RUN (2u)
+
+/* the block mask of a snapshot request is a 56 bit signal of the debug message (bit n: data block ID n) */
+FAS_STATIC_ASSERT(
+    ((int16_t)DATA_BLOCK_ID_MAX <= 56),
+    "Number of data blocks exceeds the width of the block mask of the snapshot request");
+
+/** states of the snapshot transfer */
+typedef enum {
+    CANTX_SNAPSHOT_STATE_IDLE,                    /*!< no transfer in progress */
+    CANTX_SNAPSHOT_STATE_SERIALIZE,               /*!< data blocks are serialized */
+    CANTX_SNAPSHOT_STATE_SEND_FIRST_FRAME,        /*!< first frame has not been sent yet */
+    CANTX_SNAPSHOT_STATE_WAIT_FOR_FLOW_CONTROL,   /*!< waiting for a flow control request of the host */
+    CANTX_SNAPSHOT_STATE_SEND_CONSECUTIVE_FRAMES, /*!< sending consecutive frames */
+} CANTX_SNAPSHOT_STATE_e;
+
+/** requests of the host; set by the debug message and consumed by the transfer */
+typedef struct {
+    bool isSnapshotRequested;                /*!< true if a snapshot has been requested */
+    uint64_t blockMask;                      /*!< data blocks of the requested snapshot */
+    bool isFlowControlReceived;              /*!< true if a flow control request has been received */
+    CANTX_SNAPSHOT_FLOW_STATUS_e flowStatus; /*!< flow status of the flow control request */
+    uint8_t blockSize;                       /*!< block size of the flow control request */
+    uint8_t separationTime_ms;               /*!< separation time of the flow control request */
+} CANTX_SNAPSHOT_REQUEST_s;
+
+/** state of the serialization of a snapshot, which is spread over several calls of the transfer */
+typedef struct {
+    uint64_t blockMask;     /*!< data blocks to be serialized, 0 selects all data blocks */
+    uint8_t nextBlockId;    /*!< ID of the next data block to be serialized */
+    uint8_t numberOfBlocks; /*!< number of serialized block records */
+    bool isTruncated;       /*!< true if a data block has not fit into the buffer */
+    uint32_t timestamp_ms;  /*!< time when the serialization has been started */
+    uint32_t length;        /*!< length of the serialized snapshot so far */
+} CANTX_SNAPSHOT_SERIALIZATION_s;
+
+/** state of the snapshot transfer */
+typedef struct {
+    CANTX_SNAPSHOT_STATE_e state;   /*!< state of the transfer */
+    uint32_t length;                /*!< length of the serialized snapshot */
+    uint32_t position;              /*!< position of the next byte to be sent */
+    uint8_t sequenceNumber;         /*!< sequence number of the next consecutive frame */
+    uint8_t blockSize;              /*!< consecutive frames per flow control request, 0: unlimited */
+    uint8_t framesInBlock;          /*!< consecutive frames sent since the last flow control request */
+    uint8_t separationTime_ms;      /*!< minimum time between two consecutive frames */
+    uint32_t lastFrameTimestamp_ms; /*!< time when the last frame has been sent */
+    uint32_t waitTimestamp_ms;      /*!< time when the transfer started to wait for a flow control request */
+} CANTX_SNAPSHOT_TRANSFER_s;
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** requests of the host */
+static CANTX_SNAPSHOT_REQUEST_s cantx_snapshotRequest = {
+    .isSnapshotRequested   = false,
+    .blockMask             = 0u,
+    .isFlowControlReceived = false,
+    .flowStatus            = CANTX_SNAPSHOT_FLOW_STATUS_ABORT,
+    .blockSize             = 0u,
+    .separationTime_ms     = 0u,
+};
+
+/** state of the snapshot transfer */
+static CANTX_SNAPSHOT_TRANSFER_s cantx_snapshotTransfer = {
+    .state                 = CANTX_SNAPSHOT_STATE_IDLE,
+    .length                = 0u,
+    .position              = 0u,
+    .sequenceNumber        = 0u,
+    .blockSize             = 0u,
+    .framesInBlock         = 0u,
+    .separationTime_ms     = 0u,
+    .lastFrameTimestamp_ms = 0u,
+    .waitTimestamp_ms      = 0u,
+};
+
+/** serialization of the requested snapshot */
+static CANTX_SNAPSHOT_SERIALIZATION_s cantx_snapshotSerialization = {
+    .blockMask      = 0u,
+    .nextBlockId    = 0u,
+    .numberOfBlocks = 0u,
+    .isTruncated    = false,
+    .timestamp_ms   = 0u,
+    .length         = 0u,
+};
+
+/** serialized snapshot */
+static uint8_t cantx_snapshotBuffer[CANTX_SNAPSHOT_BUFFER_SIZE] = {0u};
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   Encodes runs of zero bytes (see CANTX_SNAPSHOT_RUN_*)
+ * @param[in]   kpSource        data to be encoded
+ * @param[in]   sourceLength    length of the data to be encoded, larger than 0
+ * @param[out]  pDestination    encoded data
+ * @param[in]   destinationSize size of pDestination
+ * @return  length of the encoded data, 0 if the encoded data does not fit
+ *          into pDestination
+ */
+static uint32_t CANTX_EncodeZeroRuns(
+    const uint8_t *kpSource,
+    uint32_t sourceLength,
+    uint8_t *pDestination,
+    uint32_t destinationSize);
+
+/**
+ * @brief   Serializes a data block into a block record
+ * @param[in]   blockId     data block to be serialized
+ * @param[out]  pRecord     block record
+ * @param[in]   recordSize  space left in the buffer for the block record
+ * @return  length of the block record, 0 if the block record does not fit
+ *          into the buffer
+ */
+static uint32_t CANTX_SerializeDataBlock(uint8_t blockId, uint8_t *pRecord, uint32_t recordSize);
+
+/**
+ * @brief   Starts the serialization of a snapshot
+ * @param[out]  pSerialization  state of the serialization
+ * @param[in]   blockMask       data blocks to be serialized (bit n: data
+ *                              block ID n), 0 selects all data blocks
+ * @param[in]   timestamp_ms    time of the snapshot
+ */
+static void CANTX_StartSerialization(
+    CANTX_SNAPSHOT_SERIALIZATION_s *pSerialization,
+    uint64_t blockMask,
+    uint32_t timestamp_ms);
+
+/**
+ * @brief   Serializes the next selected data blocks of a snapshot
+ * @details The snapshot header is written after the last data block.
+ * @param[in,out]   pSerialization  state of the serialization
+ * @param[out]      pBuffer         serialized snapshot, the same in every
+ *                                  call of a serialization
+ * @param[in]       bufferSize      size of pBuffer, at least
+ *                                  #CANTX_SNAPSHOT_HEADER_SIZE
+ * @param[in]       maximumBlocks   maximum number of data blocks serialized
+ *                                  in this call, larger than 0
+ * @return  true if the snapshot is complete, false if data blocks are left
+ */
+static bool CANTX_SerializeDataBlocks(
+    CANTX_SNAPSHOT_SERIALIZATION_s *pSerialization,
+    uint8_t *pBuffer,
+    uint32_t bufferSize,
+    uint8_t maximumBlocks);
+
+/**
+ * @brief   Writes a 16 bit value big endian into a buffer
+ * @param[out]  pBuffer buffer
+ * @param[in]   value   value to be written
+ */
+static void CANTX_WriteUint16(uint8_t *pBuffer, uint16_t value);
+
+/**
+ * @brief   Writes a 32 bit value big endian into a buffer
+ * @param[out]  pBuffer buffer
+ * @param[in]   value   value to be written
+ */
+static void CANTX_WriteUint32(uint8_t *pBuffer, uint32_t value);
+
+/**
+ * @brief   Sends the first frame of the transfer
+ * @param[in]   timestamp_ms    current time
+ */
+static void CANTX_SendFirstFrame(uint32_t timestamp_ms);
+
+/**
+ * @brief   Sends the consecutive frames that are due in this call
+ * @param[in]   timestamp_ms    current time
+ */
+static void CANTX_SendConsecutiveFrames(uint32_t timestamp_ms);
+
+/**
+ * @brief   Processes a flow control request of the host or aborts the
+ *          transfer after #CANTX_SNAPSHOT_FLOW_CONTROL_TIMEOUT_ms
+ * @param[in]   kpRequest       requests of the host
+ * @param[in]   timestamp_ms    current time
+ */
+static void CANTX_ProcessFlowControl(const CANTX_SNAPSHOT_REQUEST_s *kpRequest, uint32_t timestamp_ms);
+
+/*========== Static Function Implementations ================================*/
+static uint32_t CANTX_EncodeZeroRuns(
+    const uint8_t *kpSource,
+    uint32_t sourceLength,
+    uint8_t *pDestination,
+    uint32_t destinationSize) {
+    FAS_ASSERT(kpSource != NULL_PTR);
+    FAS_ASSERT(sourceLength > 0u);
+    FAS_ASSERT(pDestination != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: destinationSize: parameter accepts whole range */
+
+    uint32_t in     = 0u;
+    uint32_t out    = 0u;
+    bool fitsBuffer = true;
+    while ((in < sourceLength) && (fitsBuffer == true)) {
+        uint32_t zeros = 0u;
+        while (((in + zeros) < sourceLength) && (zeros < CANTX_SNAPSHOT_RUN_MAXIMUM_LENGTH) &&
+               (kpSource[in + zeros] == 0u)) {
+            zeros++;
+        }
+        if (zeros >= CANTX_SNAPSHOT_MINIMUM_ZERO_RUN) {
+            if (out < destinationSize) {
+                pDestination[out] = (uint8_t)(CANTX_SNAPSHOT_RUN_ZERO_FLAG | (zeros - 1u));
+                out++;
+                in += zeros;
+            } else {
+                fitsBuffer = false;
+            }
+        } else {
+            /* literal run up to the next zero run; a single zero byte is cheaper as literal */
+            uint32_t literals = 0u;
+            bool isZeroRun    = false;
+            while (((in + literals) < sourceLength) && (literals < CANTX_SNAPSHOT_RUN_MAXIMUM_LENGTH) &&
+                   (isZeroRun == false)) {
+                const uint32_t kNext = in + literals;
+                if ((kpSource[kNext] == 0u) && ((kNext + 1u) < sourceLength) && (kpSource[kNext + 1u] == 0u)) {
+                    isZeroRun = true;
+                } else {
+                    literals++;
+                }
+            }
+            if ((out + 1u + literals) <= destinationSize) {
+                pDestination[out] = (uint8_t)(literals - 1u);
+                out++;
+                for (uint32_t i = 0u; i < literals; i++) {
+                    pDestination[out + i] = kpSource[in + i];
+                }
+                out += literals;
+                in  += literals;
+            } else {
+                fitsBuffer = false;
+            }
+        }
+    }
+    if (fitsBuffer == false) {
+        out = 0u;
+    }
+    return out;
+}
+
+static uint32_t CANTX_SerializeDataBlock(uint8_t blockId, uint8_t *pRecord, uint32_t recordSize) {
+    FAS_ASSERT(blockId < (uint8_t)DATA_BLOCK_ID_MAX);
+    FAS_ASSERT(pRecord != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: recordSize: parameter accepts whole range */
+
+    uint32_t encodedLength = 0u;
+    uint32_t dataLength    = 0u;
+    bool isConsistent      = false;
+    bool fitsBuffer        = true;
+    for (uint8_t attempt = 0u; (attempt < DATA_MAXIMUM_BORROW_ATTEMPTS) && (isConsistent == false) &&
+                               (fitsBuffer == true);
+         attempt++) {
+        DATA_READ_VIEW_s view = {0};
+        DATA_BorrowDataBlock((DATA_BLOCK_ID_e)blockId, &view);
+        dataLength    = view.dataLength;
+        encodedLength = 0u;
+        if ((recordSize > CANTX_SNAPSHOT_BLOCK_HEADER_SIZE) && (dataLength <= UINT16_MAX)) {
+            encodedLength = CANTX_EncodeZeroRuns(
+                (const uint8_t *)view.pkDataBlock,
+                dataLength,
+                &pRecord[CANTX_SNAPSHOT_BLOCK_HEADER_SIZE],
+                recordSize - CANTX_SNAPSHOT_BLOCK_HEADER_SIZE);
+        }
+        if (DATA_ReturnDataBlock(&view) == STD_OK) {
+            isConsistent = true;
+        }
+        if ((encodedLength == 0u) || (encodedLength > UINT16_MAX)) {
+            fitsBuffer = false;
+        }
+    }
+
+    uint32_t recordLength = 0u;
+    if (fitsBuffer == true) {
+        pRecord[0] = blockId;
+        pRecord[1] = 0u;
+        if (isConsistent == false) {
+            pRecord[1] = CANTX_SNAPSHOT_BLOCK_FLAG_INCONSISTENT;
+        }
+        CANTX_WriteUint16(&pRecord[2], (uint16_t)dataLength);
+        CANTX_WriteUint16(&pRecord[4], (uint16_t)encodedLength);
+        recordLength = CANTX_SNAPSHOT_BLOCK_HEADER_SIZE + encodedLength;
+    }
+    return recordLength;
+}
+
+static void CANTX_StartSerialization(
+    CANTX_SNAPSHOT_SERIALIZATION_s *pSerialization,
+    uint64_t blockMask,
+    uint32_t timestamp_ms) {
+    FAS_ASSERT(pSerialization != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: blockMask: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: timestamp_ms: parameter accepts whole range */
+    pSerialization->blockMask      = blockMask;
+    pSerialization->nextBlockId    = 0u;
+    pSerialization->numberOfBlocks = 0u;
+    pSerialization->isTruncated    = false;
+    pSerialization->timestamp_ms   = timestamp_ms;
+    pSerialization->length         = CANTX_SNAPSHOT_HEADER_SIZE;
+}
+
+static bool CANTX_SerializeDataBlocks(
+    CANTX_SNAPSHOT_SERIALIZATION_s *pSerialization,
+    uint8_t *pBuffer,
+    uint32_t bufferSize,
+    uint8_t maximumBlocks) {
+    FAS_ASSERT(pSerialization != NULL_PTR);
+    FAS_ASSERT(pBuffer != NULL_PTR);
+    FAS_ASSERT(bufferSize >= CANTX_SNAPSHOT_HEADER_SIZE);
+    FAS_ASSERT(maximumBlocks > 0u);
+
+    uint8_t blocksInCall = 0u;
+    while ((pSerialization->nextBlockId < (uint8_t)DATA_BLOCK_ID_MAX) && (pSerialization->isTruncated == false) &&
+           (blocksInCall < maximumBlocks)) {
+        const uint8_t kBlockId = pSerialization->nextBlockId;
+        const bool isSelected  = (pSerialization->blockMask == 0u) ||
+                                 ((pSerialization->blockMask & DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(kBlockId)) != 0u);
+        if (isSelected == true) {
+            const uint32_t kRecordLength = CANTX_SerializeDataBlock(
+                kBlockId, &pBuffer[pSerialization->length], bufferSize - pSerialization->length);
+            if (kRecordLength > 0u) {
+                pSerialization->length += kRecordLength;
+                pSerialization->numberOfBlocks++;
+            } else {
+                /* the data block does not fit into the snapshot: leave it and all remaining data blocks out */
+                pSerialization->isTruncated = true;
+            }
+            blocksInCall++;
+        }
+        pSerialization->nextBlockId++;
+    }
+
+    const bool isComplete =
+        (pSerialization->nextBlockId >= (uint8_t)DATA_BLOCK_ID_MAX) || (pSerialization->isTruncated == true);
+    if (isComplete == true) {
+        /* the data blocks are copied as they are, therefore the host needs the byte order of the target */
+        const uint16_t kByteOrderProbe = 1u;
+        uint8_t flags                  = 0u;
+        if (*(const uint8_t *)&kByteOrderProbe == 1u) {
+            flags = CANTX_SNAPSHOT_FLAG_LITTLE_ENDIAN;
+        }
+        if (pSerialization->isTruncated == true) {
+            flags |= CANTX_SNAPSHOT_FLAG_TRUNCATED;
+        }
+        pBuffer[0] = CANTX_SNAPSHOT_MAGIC_0;
+        pBuffer[1] = CANTX_SNAPSHOT_MAGIC_1;
+        pBuffer[2] = CANTX_SNAPSHOT_FORMAT_VERSION;
+        pBuffer[3] = flags;
+        pBuffer[4] = (uint8_t)sizeof(DATA_BLOCK_ID_e);
+        pBuffer[5] = pSerialization->numberOfBlocks;
+        CANTX_WriteUint32(&pBuffer[6], pSerialization->timestamp_ms);
+    }
+    return isComplete;
+}
+
+static void CANTX_WriteUint16(uint8_t *pBuffer, uint16_t value) {
+    /* AXIVION Routine Generic-MissingParameterAssert: pBuffer: parameter checked in calling function */
+    /* AXIVION Routine Generic-MissingParameterAssert: value: parameter accepts whole range */
+    pBuffer[0] = (uint8_t)(value >> 8u);
+    pBuffer[1] = (uint8_t)value;
+}
+
+static void CANTX_WriteUint32(uint8_t *pBuffer, uint32_t value) {
+    /* AXIVION Routine Generic-MissingParameterAssert: pBuffer: parameter checked in calling function */
+    /* AXIVION Routine Generic-MissingParameterAssert: value: parameter accepts whole range */
+    CANTX_WriteUint16(&pBuffer[0], (uint16_t)(value >> 16u));
+    CANTX_WriteUint16(&pBuffer[2], (uint16_t)value);
+}
+
+static void CANTX_SendFirstFrame(uint32_t timestamp_ms) {
+    /* AXIVION Routine Generic-MissingParameterAssert: timestamp_ms: parameter accepts whole range */
+    uint8_t data[] = {GEN_REPEAT_U(0u, GEN_STRIP(CAN_MAX_DLC))};
+    uint8_t offset = 0u;
+    if (cantx_snapshotTransfer.length <= CANTX_SNAPSHOT_FIRST_FRAME_MAXIMUM_SHORT_LENGTH) {
+        data[0] = (uint8_t)(CANTX_SNAPSHOT_FIRST_FRAME | (uint8_t)(cantx_snapshotTransfer.length >> 8u));
+        data[1] = (uint8_t)cantx_snapshotTransfer.length;
+        offset  = 2u;
+    } else {
+        /* escape sequence: the length does not fit into 12 bit and follows as 32 bit value */
+        data[0] = CANTX_SNAPSHOT_FIRST_FRAME;
+        data[1] = 0u;
+        CANTX_WriteUint32(&data[2], cantx_snapshotTransfer.length);
+        offset = 6u;
+    }
+    /* the snapshot header is longer than the data of the first frame */
+    for (uint8_t i = offset; i < CAN_MAX_DLC; i++) {
+        data[i] = cantx_snapshotBuffer[i - offset];
+    }
+    if (CAN_DataSend(CAN_NODE_DEBUG_MESSAGE, CANTX_SNAPSHOT_ID, CANTX_SNAPSHOT_IDENTIFIER, &data[0]) == STD_OK) {
+        cantx_snapshotTransfer.position              = (uint32_t)CAN_MAX_DLC - offset;
+        cantx_snapshotTransfer.sequenceNumber        = 1u;
+        cantx_snapshotTransfer.lastFrameTimestamp_ms = timestamp_ms;
+        cantx_snapshotTransfer.waitTimestamp_ms      = timestamp_ms;
+        cantx_snapshotTransfer.state                 = CANTX_SNAPSHOT_STATE_WAIT_FOR_FLOW_CONTROL;
+    }
+}
+
+static void CANTX_SendConsecutiveFrames(uint32_t timestamp_ms) {
+    /* AXIVION Routine Generic-MissingParameterAssert: timestamp_ms: parameter accepts whole range */
+    uint8_t framesInCall = 0u;
+    bool isSendPossible  = true;
+    while ((cantx_snapshotTransfer.state == CANTX_SNAPSHOT_STATE_SEND_CONSECUTIVE_FRAMES) &&
+           (framesInCall < CANTX_SNAPSHOT_MAXIMUM_FRAMES_PER_CALL) && (isSendPossible == true)) {
+        if ((cantx_snapshotTransfer.separationTime_ms > 0u) &&
+            ((timestamp_ms - cantx_snapshotTransfer.lastFrameTimestamp_ms) <
+             (uint32_t)cantx_snapshotTransfer.separationTime_ms)) {
+            isSendPossible = false;
+        } else {
+            uint8_t data[] = {GEN_REPEAT_U(0u, GEN_STRIP(CAN_MAX_DLC))};
+            data[0]        = (uint8_t)(CANTX_SNAPSHOT_CONSECUTIVE_FRAME | cantx_snapshotTransfer.sequenceNumber);
+            for (uint8_t i = 0u; i < CANTX_SNAPSHOT_CONSECUTIVE_FRAME_DATA_LENGTH; i++) {
+                const uint32_t kPosition = cantx_snapshotTransfer.position + i;
+                if (kPosition < cantx_snapshotTransfer.length) {
+                    data[i + 1u] = cantx_snapshotBuffer[kPosition];
+                }
+            }
+            if (CAN_DataSend(CAN_NODE_DEBUG_MESSAGE, CANTX_SNAPSHOT_ID, CANTX_SNAPSHOT_IDENTIFIER, &data[0]) ==
+                STD_OK) {
+                framesInCall++;
+                cantx_snapshotTransfer.framesInBlock++;
+                cantx_snapshotTransfer.position             += CANTX_SNAPSHOT_CONSECUTIVE_FRAME_DATA_LENGTH;
+                cantx_snapshotTransfer.lastFrameTimestamp_ms = timestamp_ms;
+                /* the sequence number wraps around from 15 to 0 */
+                cantx_snapshotTransfer.sequenceNumber = (uint8_t)((cantx_snapshotTransfer.sequenceNumber + 1u) &
+                                                                  CANTX_SNAPSHOT_CONSECUTIVE_FRAME_SEQUENCE_MASK);
+                if (cantx_snapshotTransfer.position >= cantx_snapshotTransfer.length) {
+                    cantx_snapshotTransfer.state = CANTX_SNAPSHOT_STATE_IDLE;
+                } else if (
+                    (cantx_snapshotTransfer.blockSize > 0u) &&
+                    (cantx_snapshotTransfer.framesInBlock >= cantx_snapshotTransfer.blockSize)) {
+                    cantx_snapshotTransfer.waitTimestamp_ms = timestamp_ms;
+                    cantx_snapshotTransfer.state            = CANTX_SNAPSHOT_STATE_WAIT_FOR_FLOW_CONTROL;
+                } else {
+                    /* continue with the next consecutive frame */
+                }
+            } else {
+                /* no free message box: try again in the next call */
+                isSendPossible = false;
+            }
+        }
+    }
+}
+
+static void CANTX_ProcessFlowControl(const CANTX_SNAPSHOT_REQUEST_s *kpRequest, uint32_t timestamp_ms) {
+    /* AXIVION Routine Generic-MissingParameterAssert: kpRequest: parameter checked in calling function */
+    /* AXIVION Routine Generic-MissingParameterAssert: timestamp_ms: parameter accepts whole range */
+    if (kpRequest->isFlowControlReceived == true) {
+        switch (kpRequest->flowStatus) {
+            case CANTX_SNAPSHOT_FLOW_STATUS_CONTINUE_TO_SEND:
+                cantx_snapshotTransfer.blockSize         = kpRequest->blockSize;
+                cantx_snapshotTransfer.separationTime_ms = kpRequest->separationTime_ms;
+                cantx_snapshotTransfer.framesInBlock     = 0u;
+                cantx_snapshotTransfer.state             = CANTX_SNAPSHOT_STATE_SEND_CONSECUTIVE_FRAMES;
+                break;
+            case CANTX_SNAPSHOT_FLOW_STATUS_WAIT:
+                cantx_snapshotTransfer.waitTimestamp_ms = timestamp_ms;
+                break;
+            default:
+                cantx_snapshotTransfer.state = CANTX_SNAPSHOT_STATE_IDLE;
+                break;
+        }
+    } else if ((timestamp_ms - cantx_snapshotTransfer.waitTimestamp_ms) >= CANTX_SNAPSHOT_FLOW_CONTROL_TIMEOUT_ms) {
+        /* the host does not respond anymore */
+        cantx_snapshotTransfer.state = CANTX_SNAPSHOT_STATE_IDLE;
+    } else {
+        /* keep waiting */
+    }
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void CANTX_RequestSnapshot(uint64_t blockMask) {
+    /* AXIVION Routine Generic-MissingParameterAssert: blockMask: parameter accepts whole range */
+    OS_EnterTaskCritical();
+    cantx_snapshotRequest.blockMask             = blockMask;
+    cantx_snapshotRequest.isSnapshotRequested   = true;
+    cantx_snapshotRequest.isFlowControlReceived = false;
+    OS_ExitTaskCritical();
+}
+
+extern void CANTX_SetSnapshotFlowControl(
+    CANTX_SNAPSHOT_FLOW_STATUS_e flowStatus,
+    uint8_t blockSize,
+    uint8_t separationTime_ms) {
+    /* AXIVION Routine Generic-MissingParameterAssert: flowStatus: unknown values abort the transfer */
+    /* AXIVION Routine Generic-MissingParameterAssert: blockSize: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: separationTime_ms: parameter accepts whole range */
+    OS_EnterTaskCritical();
+    cantx_snapshotRequest.flowStatus            = flowStatus;
+    cantx_snapshotRequest.blockSize             = blockSize;
+    cantx_snapshotRequest.separationTime_ms     = separationTime_ms;
+    cantx_snapshotRequest.isFlowControlReceived = true;
+    OS_ExitTaskCritical();
+}
+
+extern void CANTX_SnapshotTransmit(void) {
+    /* take over the requests of the host, which are set by the debug message in another task */
+    OS_EnterTaskCritical();
+    const CANTX_SNAPSHOT_REQUEST_s kRequest     = cantx_snapshotRequest;
+    cantx_snapshotRequest.isSnapshotRequested   = false;
+    cantx_snapshotRequest.isFlowControlReceived = false;
+    OS_ExitTaskCritical();
+
+    const uint32_t kTimestamp_ms = OS_GetTickCount();
+    if (kRequest.isSnapshotRequested == true) {
+        CANTX_StartSerialization(&cantx_snapshotSerialization, kRequest.blockMask, kTimestamp_ms);
+        cantx_snapshotTransfer.state = CANTX_SNAPSHOT_STATE_SERIALIZE;
+    }
+
+    switch (cantx_snapshotTransfer.state) {
+        case CANTX_SNAPSHOT_STATE_SERIALIZE:
+            if (CANTX_SerializeDataBlocks(
+                    &cantx_snapshotSerialization,
+                    &cantx_snapshotBuffer[0],
+                    CANTX_SNAPSHOT_BUFFER_SIZE,
+                    CANTX_SNAPSHOT_MAXIMUM_BLOCKS_PER_CALL) == true) {
+                cantx_snapshotTransfer.length   = cantx_snapshotSerialization.length;
+                cantx_snapshotTransfer.position = 0u;
+                cantx_snapshotTransfer.state    = CANTX_SNAPSHOT_STATE_SEND_FIRST_FRAME;
+                /* the first frame is sent in the same call as the last data blocks are serialized */
+                CANTX_SendFirstFrame(kTimestamp_ms);
+            }
+            break;
+        case CANTX_SNAPSHOT_STATE_SEND_FIRST_FRAME:
+            CANTX_SendFirstFrame(kTimestamp_ms);
+            break;
+        case CANTX_SNAPSHOT_STATE_WAIT_FOR_FLOW_CONTROL:
+            CANTX_ProcessFlowControl(&kRequest, kTimestamp_ms);
+            /* the first consecutive frames are sent in the same call as the flow control request is processed */
+            CANTX_SendConsecutiveFrames(kTimestamp_ms);
+            break;
+        case CANTX_SNAPSHOT_STATE_SEND_CONSECUTIVE_FRAMES:
+            CANTX_SendConsecutiveFrames(kTimestamp_ms);
+            break;
+        default:
+            /* no transfer in progress */
+            break;
+    }
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern uint32_t TEST_CANTX_SerializeSnapshot(uint64_t blockMask, uint8_t *pBuffer, uint32_t bufferSize) {
+    CANTX_SNAPSHOT_SERIALIZATION_s serialization = {0};
+    CANTX_StartSerialization(&serialization, blockMask, OS_GetTickCount());
+    bool isComplete = false;
+    while (isComplete == false) {
+        isComplete = CANTX_SerializeDataBlocks(&serialization, pBuffer, bufferSize, (uint8_t)DATA_BLOCK_ID_MAX);
+    }
+    return serialization.length;
+}
+extern uint32_t TEST_CANTX_EncodeZeroRuns(
+    const uint8_t *kpSource,
+    uint32_t sourceLength,
+    uint8_t *pDestination,
+    uint32_t destinationSize) {
+    return CANTX_EncodeZeroRuns(kpSource, sourceLength, pDestination, destinationSize);
+}
+extern void TEST_CANTX_ResetSnapshotTransfer(void) {
+    cantx_snapshotRequest.isSnapshotRequested   = false;
+    cantx_snapshotRequest.isFlowControlReceived = false;
+    cantx_snapshotTransfer.state                = CANTX_SNAPSHOT_STATE_IDLE;
+}
+#endif
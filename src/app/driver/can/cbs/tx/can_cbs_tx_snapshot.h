@@ -0,0 +1,176 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    can_cbs_tx_snapshot.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup DRIVER
+ * @prefix  CANTX
+ *
+ * @brief   Transfer of database snapshots over the debug interface
+ * @details A snapshot is a serialized copy of a selection of data blocks. It
+ *          is requested and flow controlled by the host through the debug
+ *          message and sent in segments in the style of ISO 15765-2
+ *          (first frame and consecutive frames).
+ */
+
+#ifndef FOXBMS__CAN_CBS_TX_SNAPSHOT_H_
+#define FOXBMS__CAN_CBS_TX_SNAPSHOT_H_
+
+/*========== Includes =======================================================*/
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** @{
+ * snapshot format: a snapshot header is followed by one record per data
+ * block. Header and record fields are big endian, the data blocks are
+ * copied in the memory layout of the target.
+ *
+ * snapshot header:
+ * - 2 bytes magic ('F', 'S')
+ * - 1 byte format version
+ * - 1 byte flags (see CANTX_SNAPSHOT_FLAG_*)
+ * - 1 byte size of an enum (sizeof(DATA_BLOCK_ID_e))
+ * - 1 byte number of block records
+ * - 4 bytes timestamp in ms
+ *
+ * block record:
+ * - 1 byte data block ID
+ * - 1 byte flags (see CANTX_SNAPSHOT_BLOCK_FLAG_*)
+ * - 2 bytes length of the data block
+ * - 2 bytes length of the encoded data block
+ * - encoded data block (see CANTX_SNAPSHOT_RUN_*)
+ */
+#define CANTX_SNAPSHOT_MAGIC_0           (0x46u)
+#define CANTX_SNAPSHOT_MAGIC_1           (0x53u)
+#define CANTX_SNAPSHOT_FORMAT_VERSION    (1u)
+#define CANTX_SNAPSHOT_HEADER_SIZE       (10u)
+#define CANTX_SNAPSHOT_BLOCK_HEADER_SIZE (6u)
+/** @} */
+
+/** @{
+ * flags of the snapshot header */
+#define CANTX_SNAPSHOT_FLAG_LITTLE_ENDIAN (0x01u)
+#define CANTX_SNAPSHOT_FLAG_TRUNCATED     (0x02u)
+/** @} */
+
+/** flag of a block record: the data block has been written during every read attempt */
+#define CANTX_SNAPSHOT_BLOCK_FLAG_INCONSISTENT (0x01u)
+
+/** @{
+ * encoding of the data blocks: every run starts with a control byte
+ * - 0x00 to 0x7F: (control byte + 1) literal bytes follow
+ * - 0x80 to 0xFF: (control byte - 0x80 + 1) zero bytes
+ */
+#define CANTX_SNAPSHOT_RUN_ZERO_FLAG      (0x80u)
+#define CANTX_SNAPSHOT_RUN_MAXIMUM_LENGTH (128u)
+/** @} */
+
+/** @{
+ * protocol control information of the frames (ISO 15765-2) */
+#define CANTX_SNAPSHOT_FIRST_FRAME                      (0x10u)
+#define CANTX_SNAPSHOT_CONSECUTIVE_FRAME                (0x20u)
+#define CANTX_SNAPSHOT_FIRST_FRAME_MAXIMUM_SHORT_LENGTH (0xFFFu)
+#define CANTX_SNAPSHOT_CONSECUTIVE_FRAME_DATA_LENGTH    (7u)
+#define CANTX_SNAPSHOT_CONSECUTIVE_FRAME_SEQUENCE_MASK  (0x0Fu)
+/** @} */
+
+/** flow status of a flow control request of the host */
+typedef enum {
+    CANTX_SNAPSHOT_FLOW_STATUS_CONTINUE_TO_SEND, /*!< send the next block of consecutive frames */
+    CANTX_SNAPSHOT_FLOW_STATUS_WAIT,             /*!< restart the flow control timeout */
+    CANTX_SNAPSHOT_FLOW_STATUS_ABORT,            /*!< abort the transfer */
+} CANTX_SNAPSHOT_FLOW_STATUS_e;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   Requests a snapshot
+ * @details The snapshot is taken in the next calls of
+ *          #CANTX_SnapshotTransmit, which send its first frame after the last
+ *          data block. A transfer that is in progress is aborted.
+ * @param[in]   blockMask   data blocks to be part of the snapshot (bit n:
+ *                          data block ID n), 0 selects all data blocks
+ */
+extern void CANTX_RequestSnapshot(uint64_t blockMask);
+
+/**
+ * @brief   Passes a flow control request of the host to the transfer
+ * @details Is ignored if the transfer does not wait for a flow control
+ *          request.
+ * @param[in]   flowStatus          flow status
+ * @param[in]   blockSize           number of consecutive frames until the next
+ *                                  flow control request, 0: no further
+ *                                  flow control request
+ * @param[in]   separationTime_ms   minimum time between two consecutive frames
+ */
+extern void CANTX_SetSnapshotFlowControl(
+    CANTX_SNAPSHOT_FLOW_STATUS_e flowStatus,
+    uint8_t blockSize,
+    uint8_t separationTime_ms);
+
+/**
+ * @brief   Takes requested snapshots and sends the frames of the transfer
+ * @details Has to be called periodically (10ms). At most
+ *          #CANTX_SNAPSHOT_MAXIMUM_BLOCKS_PER_CALL data blocks are serialized
+ *          and at most #CANTX_SNAPSHOT_MAXIMUM_FRAMES_PER_CALL frames are sent
+ *          per call; a separation time larger than 0ms limits the transfer to
+ *          one frame per call.
+ */
+extern void CANTX_SnapshotTransmit(void);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern uint32_t TEST_CANTX_SerializeSnapshot(uint64_t blockMask, uint8_t *pBuffer, uint32_t bufferSize);
+extern uint32_t TEST_CANTX_EncodeZeroRuns(
+    const uint8_t *kpSource,
+    uint32_t sourceLength,
+    uint8_t *pDestination,
+    uint32_t destinationSize);
+extern void TEST_CANTX_ResetSnapshotTransfer(void);
+#endif
+
+#endif /* FOXBMS__CAN_CBS_TX_SNAPSHOT_H_ */
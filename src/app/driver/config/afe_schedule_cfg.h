@@ -0,0 +1,114 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    afe_schedule_cfg.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup DRIVERS_CONFIGURATION
+ * @prefix  AFE
+ *
+ * @brief   Configuration of the multi-rate measurement schedule of the AFE
+ * @details The cell voltages are measured in every measurement cycle of a
+ *          string. The temperatures (i.e., the multiplexer channels) and
+ *          the open-wire check are scheduled at lower rates. While the
+ *          schedule is boosted (see #AFE_ScheduleRequestBoost()), the boost
+ *          values are used.
+ */
+
+#ifndef FOXBMS__AFE_SCHEDULE_CFG_H_
+#define FOXBMS__AFE_SCHEDULE_CFG_H_
+
+/*========== Includes =======================================================*/
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/**
+ * @brief   the temperatures are measured with every Nth cell voltage
+ *          measurement of a string
+ * @details 1 measures the temperatures with every cell voltage measurement.
+ * @ptype   uint
+ * \par Range:
+ * [1, 255]
+ */
+#define AFE_SCHEDULE_TEMPERATURE_DIVIDER (1u)
+
+/**
+ * @brief   divider of the temperature measurement while the schedule is
+ *          boosted
+ * @ptype   uint
+ * \par Range:
+ * [1, 255]
+ */
+#define AFE_SCHEDULE_TEMPERATURE_DIVIDER_BOOST (1u)
+
+/**
+ * @brief   period of the open-wire check of a string in ms
+ * @details 0 disables the scheduled open-wire check, the check is then only
+ *          run on request (see #AFE_RequestOpenWireCheck()).
+ * @ptype   uint
+ */
+#define AFE_SCHEDULE_OPEN_WIRE_PERIOD_ms (0u)
+
+/**
+ * @brief   period of the open-wire check of a string in ms while the
+ *          schedule is boosted
+ * @details 0 disables the scheduled open-wire check while boosted.
+ * @ptype   uint
+ */
+#define AFE_SCHEDULE_OPEN_WIRE_PERIOD_BOOST_ms (0u)
+
+#if (AFE_SCHEDULE_TEMPERATURE_DIVIDER == 0u) || (AFE_SCHEDULE_TEMPERATURE_DIVIDER_BOOST == 0u)
+#error "The temperature dividers of the AFE schedule must be at least 1."
+#endif
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+#endif
+
+#endif /* FOXBMS__AFE_SCHEDULE_CFG_H_ */
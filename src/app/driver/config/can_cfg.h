@@ -43,7 +43,7 @@
  * @file    can_cfg.h
  * @author  foxBMS Team
  * @date    2019-12-04 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  CAN
@@ -214,6 +214,12 @@ typedef struct {
     uint32_t period; /*!< expected CAN message cycle time */
 } CAN_RX_MESSAGE_TIMING_s;
 
+/** return values of tx callback functions: transmit the prepared data or
+ *  skip this period (e.g., nothing changed since the last transmission) @{*/
+#define CAN_TX_TRANSMIT_MESSAGE (0u)
+#define CAN_TX_SKIP_MESSAGE     (1u)
+/**@}*/
+
 /** type definition for tx callback functions used in CAN messages */
 typedef uint32_t (*CAN_TxCallbackFunction_f)(
     CAN_MESSAGE_PROPERTIES_s message,
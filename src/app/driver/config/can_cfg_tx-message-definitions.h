@@ -43,7 +43,7 @@
  * @file    can_cfg_tx-message-definitions.h
  * @author  foxBMS Team
  * @date    2022-07-01 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  CANTX
@@ -58,6 +58,7 @@
 /*========== Includes =======================================================*/
 #include "can_cfg.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
@@ -76,6 +77,10 @@
 #define CANTX_FATAL_ERRORS_ID         (0x0FFu) /* check_ids:not-periodic */
 #define CANTX_FATAL_ERRORS_IDENTIFIER (CAN_STANDARD_IDENTIFIER_11_BIT)
 
+/** CAN message ID for the transfer of database snapshots */
+#define CANTX_SNAPSHOT_ID         (0x228u) /* check_ids:not-periodic */
+#define CANTX_SNAPSHOT_IDENTIFIER (CAN_STANDARD_IDENTIFIER_11_BIT)
+
 /** CAN message properties for BMS state message. Required properties are:
  * - Message ID
  * - Identifier type (standard or extended)
@@ -124,6 +129,37 @@
 #define CANTX_CELL_TEMPERATURES_ENDIANNESS (CAN_BIG_ENDIAN)
 /**@}*/
 
+/** Streaming of the cell voltage and cell temperature messages
+ * - false: all multiplexer values are sent round-robin, one per period
+ * - true:  groups with a changed minimum/maximum cell or with a change larger
+ *          than the deadband are sent first, unchanged groups are skipped.
+ *          Every group is sent at least once per refresh bound.
+ *
+ * The refresh bound has to be at least as long as one round-robin cycle of
+ * the respective message. @{*/
+#define CANTX_CELL_STREAMING                          (false)
+#define CANTX_CELL_VOLTAGES_STREAM_DEADBAND_mV        (5)
+#define CANTX_CELL_TEMPERATURES_STREAM_DEADBAND_ddegC (10)
+#define CANTX_CELL_STREAM_REFRESH_BOUND_ms            (10000u)
+/**@}*/
+
+/** Transfer of database snapshots over the debug interface
+ * - size of the buffer for the serialized snapshot; data blocks that do not
+ *   fit into the buffer are left out and the snapshot is marked as truncated
+ * - maximum number of data blocks serialized per call of the transfer (10ms)
+ * - maximum number of consecutive frames per call of the transfer (10ms)
+ * - time after which the transfer is aborted, if the host does not send a
+ *   flow control request @{*/
+#define CANTX_SNAPSHOT_BUFFER_SIZE             (4096u)
+#define CANTX_SNAPSHOT_MAXIMUM_BLOCKS_PER_CALL (8u)
+#define CANTX_SNAPSHOT_MAXIMUM_FRAMES_PER_CALL (4u)
+#define CANTX_SNAPSHOT_FLOW_CONTROL_TIMEOUT_ms (1000u)
+/**@}*/
+
+#if !((CANTX_CELL_STREAMING == true) || (CANTX_CELL_STREAMING == false))
+#error "CANTX_CELL_STREAMING can only have the value true or false"
+#endif
+
 /** CAN message properties for BMS limit values. Required properties are:
  * - Message ID
  * - Identifier type (standard or extended)
@@ -43,7 +43,7 @@
  * @file    dma_cfg.h
  * @author  foxBMS Team
  * @date    2020-03-05 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS_CONFIGURATION
  * @prefix  DMA
@@ -86,6 +86,7 @@
 #define DMA_CHANNEL_I2C1_RX (DMA_CH11)
 #define DMA_CHANNEL_I2C2_TX (DMA_CH12)
 #define DMA_CHANNEL_I2C2_RX (DMA_CH13)
+#define DMA_CHANNEL_ADC1    (DMA_CH14)
 /**@}*/
 
 /** defines for the DMA request lines */
@@ -104,6 +105,8 @@
 #define DMA_REQ_LINE_I2C1_RX (DMA_REQ10)
 #define DMA_REQ_LINE_I2C2_TX (DMA_REQ33)
 #define DMA_REQ_LINE_I2C2_RX (DMA_REQ32)
+/* MibADC1 group 1, used in continuous conversion mode (see ADC_DMA_OVERSAMPLING) */
+#define DMA_REQ_LINE_ADC1_GROUP1 (DMA_REQ7)
 /**@}*/
 
 /** define for the shift of an address for big endian 8bit */
@@ -43,7 +43,7 @@
  * @file    fram_cfg.c
  * @author  foxBMS Team
  * @date    2020-03-05 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS_CONFIGURATION
  * @prefix  FRAM
@@ -77,6 +77,8 @@ FRAM_SBC_INIT_s fram_sbcInit = {
 FRAM_DEEP_DISCHARGE_FLAG_s fram_deepDischargeFlags = {0};
 FRAM_SYS_MON_RECORD_s fram_sys_mon_record          = {0};
 FRAM_INSULATION_FLAG_s fram_insulationFlags        = {.groundErrorDetected = false};
+FRAM_SOH_s fram_soh                                = {0};
+FRAM_LOAD_SPECTRUM_s fram_loadSpectrum             = {0};
 /**@}*/
 
 /**
@@ -91,6 +93,8 @@ FRAM_BASE_HEADER_s fram_base_header[] = {
     {(void *)(&fram_soe), sizeof(fram_soe), 0},
     {(void *)(&fram_sys_mon_record), sizeof(fram_sys_mon_record), 0},
     {(void *)(&fram_insulationFlags), sizeof(fram_insulationFlags), 0},
+    {(void *)(&fram_soh), sizeof(fram_soh), 0},
+    {(void *)(&fram_loadSpectrum), sizeof(fram_loadSpectrum), 0},
 };
 
 /*========== Static Function Prototypes =====================================*/
@@ -43,7 +43,7 @@
  * @file    fram_cfg.h
  * @author  foxBMS Team
  * @date    2020-03-05 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  FRAM
@@ -109,6 +109,8 @@ typedef enum {
     FRAM_BLOCK_ID_SOE,
     FRAM_BLOCK_ID_SYS_MON_RECORD,
     FRAM_BLOCK_ID_INSULATION_FLAG,
+    FRAM_BLOCK_ID_SOH,
+    FRAM_BLOCK_ID_LOAD_SPECTRUM,
     FRAM_BLOCK_MAX, /**< DO NOT CHANGE, MUST BE THE LAST ENTRY */
 } FRAM_BLOCK_ID_e;
 
@@ -154,6 +156,51 @@ typedef struct {
     float_t averageSoe_perc[BS_NR_OF_STRINGS]; /*!< average SOE */
 } FRAM_SOE_s;
 
+/**
+ * state of health (SOH) tracking. The capacity and the internal resistance of
+ * every cell block are estimated online, the variances of the estimates are
+ * required to continue the estimation after a restart.
+ */
+typedef struct {
+    float_t capacity_perc[BS_NR_OF_STRINGS][BS_NR_OF_CELL_BLOCKS_PER_STRING];      /*!< capacity, relative to nominal */
+    float_t capacityVariance[BS_NR_OF_STRINGS][BS_NR_OF_CELL_BLOCKS_PER_STRING];   /*!< variance of the capacity */
+    float_t resistance_mOhm[BS_NR_OF_STRINGS][BS_NR_OF_CELL_BLOCKS_PER_STRING];    /*!< internal resistance */
+    float_t resistanceVariance[BS_NR_OF_STRINGS][BS_NR_OF_CELL_BLOCKS_PER_STRING]; /*!< variance of the resistance */
+} FRAM_SOH_s;
+
+/**
+ * number of bins of the lifetime load spectrum; the bin limits are configured
+ * in load_spectrum_cfg.h, changing the number of bins changes the memory
+ * layout of the FRAM @{
+ */
+#define FRAM_LOAD_SPECTRUM_NR_OF_TEMPERATURE_BINS (10u)
+#define FRAM_LOAD_SPECTRUM_NR_OF_SOC_BINS         (10u)
+#define FRAM_LOAD_SPECTRUM_NR_OF_C_RATE_BINS      (12u)
+#define FRAM_LOAD_SPECTRUM_NR_OF_CYCLE_BINS       (10u)
+#define FRAM_LOAD_SPECTRUM_NR_OF_RESIDUES         (16u)
+/**@}*/
+
+/**
+ * lifetime load spectrum: time spent per cell temperature, SOC and C-rate
+ * bin, and the cycles per depth of discharge bin counted with rainflow
+ * counting. The reversals that have not been closed to a cycle yet (residue)
+ * are stored as well, so that the counting continues after a restart.
+ */
+typedef struct {
+    /** time spent per maximum cell temperature bin */
+    uint32_t temperatureResidency_s[BS_NR_OF_STRINGS][FRAM_LOAD_SPECTRUM_NR_OF_TEMPERATURE_BINS];
+    /** time spent per average SOC bin */
+    uint32_t socResidency_s[BS_NR_OF_STRINGS][FRAM_LOAD_SPECTRUM_NR_OF_SOC_BINS];
+    /** time spent per C-rate bin */
+    uint32_t cRateResidency_s[BS_NR_OF_STRINGS][FRAM_LOAD_SPECTRUM_NR_OF_C_RATE_BINS];
+    /** number of half cycles per depth of discharge bin */
+    uint32_t halfCycles[BS_NR_OF_STRINGS][FRAM_LOAD_SPECTRUM_NR_OF_CYCLE_BINS];
+    /** SOC reversals that have not been closed to a cycle yet, unit: 0.1% */
+    uint16_t residue_dperc[BS_NR_OF_STRINGS][FRAM_LOAD_SPECTRUM_NR_OF_RESIDUES];
+    /** number of valid entries in residue_dperc */
+    uint8_t nrOfResidues[BS_NR_OF_STRINGS];
+} FRAM_LOAD_SPECTRUM_s;
+
 /** flag to indicate if a deep-discharge in a string has been detected */
 typedef struct {
     bool deepDischargeFlag[BS_NR_OF_STRINGS]; /*!< false (0): no error, true (1): deep-discharge detected */
@@ -207,6 +254,8 @@ extern FRAM_SBC_INIT_s fram_sbcInit;
 extern FRAM_DEEP_DISCHARGE_FLAG_s fram_deepDischargeFlags;
 extern FRAM_SYS_MON_RECORD_s fram_sys_mon_record;
 extern FRAM_INSULATION_FLAG_s fram_insulationFlags;
+extern FRAM_SOH_s fram_soh;
+extern FRAM_LOAD_SPECTRUM_s fram_loadSpectrum;
 /**@}*/
 
 /*========== Extern Function Prototypes =====================================*/
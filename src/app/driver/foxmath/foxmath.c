@@ -43,7 +43,7 @@
  * @file    foxmath.c
  * @author  foxBMS Team
  * @date    2018-01-18 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  MATH
@@ -56,6 +56,7 @@
 #include "foxmath.h"
 
 #include "fassert.h"
+#include "fstd_types.h"
 #include "utils.h"
 
 #include <math.h>
@@ -63,13 +64,98 @@
 
 /*========== Macros and Definitions =========================================*/
 
+/** scaling factor of #MATH_Q16_16 as float */
+#define MATH_Q16_16_SCALING_FACTOR_FLOAT (65536.0f)
+
+/** scaling factor of #MATH_Q31 */
+#define MATH_Q31_SCALING_FACTOR (2147483648LL)
+
+/** scaling factor of #MATH_Q31 as float */
+#define MATH_Q31_SCALING_FACTOR_FLOAT (2147483648.0f)
+
+/** range limit of float values that can be converted into int32_t (2^31) */
+#define MATH_INT32_RANGE_LIMIT_FLOAT (2147483648.0f)
+
+/** largest absolute value of the denominator of #MATH_DivideInt64ToQ16_16() (2^47) */
+#define MATH_MAXIMUM_Q16_16_DENOMINATOR (140737488355328LL)
+
 /*========== Static Constant and Variable Definitions =======================*/
 
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
 
+/**
+ * @brief   Saturates a 64 bit integer to the range of int32_t
+ * @param[in] value   value to saturate
+ * @return  saturated value
+ */
+static int32_t MATH_SaturateToInt32(const int64_t value);
+
+/**
+ * @brief   Divides two integers and rounds the quotient to the nearest
+ *          integer (ties away from zero)
+ * @details In contrast to shifts of negative values, the integer division is
+ *          well defined by the C standard. The result is therefore identical
+ *          on all platforms.
+ * @param[in] numerator     numerator
+ * @param[in] denominator   denominator, must not be 0
+ * @return  rounded quotient
+ */
+static int64_t MATH_DivideRounded(const int64_t numerator, const int64_t denominator);
+
+/**
+ * @brief   Converts a float value into a fixed-point value with the passed
+ *          scaling factor
+ * @param[in] value           float value
+ * @param[in] scalingFactor   scaling factor of the fixed-point format
+ * @return  rounded and saturated fixed-point value, 0 for NaN
+ */
+static int32_t MATH_FloatToFixedPoint(const float_t value, const float_t scalingFactor);
+
 /*========== Static Function Implementations ================================*/
+static int32_t MATH_SaturateToInt32(const int64_t value) {
+    int32_t saturatedValue = 0;
+    if (value > (int64_t)INT32_MAX) {
+        saturatedValue = INT32_MAX;
+    } else if (value < (int64_t)INT32_MIN) {
+        saturatedValue = INT32_MIN;
+    } else {
+        saturatedValue = (int32_t)value;
+    }
+    return saturatedValue;
+}
+
+static int64_t MATH_DivideRounded(const int64_t numerator, const int64_t denominator) {
+    FAS_ASSERT(denominator != 0);
+    int64_t quotient                  = numerator / denominator;
+    const int64_t remainder           = MATH_AbsInt64_t(numerator % denominator);
+    const int64_t absoluteDenominator = MATH_AbsInt64_t(denominator);
+    /* round if the remainder is at least half of the denominator */
+    if (remainder >= (absoluteDenominator - remainder)) {
+        if ((numerator < 0) == (denominator < 0)) {
+            quotient++;
+        } else {
+            quotient--;
+        }
+    }
+    return quotient;
+}
+
+static int32_t MATH_FloatToFixedPoint(const float_t value, const float_t scalingFactor) {
+    int32_t fixedPointValue = 0;
+    if (isnan(value) == 0) {
+        const float_t scaledValue = roundf(value * scalingFactor);
+        if (scaledValue >= MATH_INT32_RANGE_LIMIT_FLOAT) {
+            fixedPointValue = INT32_MAX;
+        } else if (scaledValue < -MATH_INT32_RANGE_LIMIT_FLOAT) {
+            fixedPointValue = INT32_MIN;
+        } else {
+            fixedPointValue = (int32_t)scaledValue;
+        }
+    }
+    return fixedPointValue;
+}
 
 /*========== Extern Function Implementations ================================*/
 
@@ -79,6 +165,9 @@
 extern void MATH_StartupSelfTest(void) {
     FAS_ASSERT(MATH_AbsInt64_t(INT64_MIN) == INT64_MAX);
     FAS_ASSERT(MATH_AbsInt32_t(INT32_MIN) == INT32_MAX);
+    FAS_ASSERT(MATH_MultiplyQ31(INT32_MIN, INT32_MIN) == INT32_MAX);
+    FAS_ASSERT(MATH_AddQ16_16(INT32_MAX, MATH_Q16_16_ONE) == INT32_MAX);
+    FAS_ASSERT(MATH_MultiplyQ16_16(-MATH_Q16_16_ONE / 2, 1) == -1);
 }
 
 extern float_t MATH_LinearInterpolation(
@@ -165,8 +254,207 @@ extern int64_t MATH_AbsInt64_t(const int64_t value) {
     return absoluteValue;
 }
 
+extern MATH_Q16_16 MATH_FloatToQ16_16(const float_t value) {
+    return MATH_FloatToFixedPoint(value, MATH_Q16_16_SCALING_FACTOR_FLOAT);
+}
+
+extern float_t MATH_Q16_16ToFloat(const MATH_Q16_16 value) {
+    return (float_t)value * (1.0f / MATH_Q16_16_SCALING_FACTOR_FLOAT);
+}
+
+extern MATH_Q16_16 MATH_Int32ToQ16_16(const int32_t value) {
+    return MATH_SaturateToInt32((int64_t)value * MATH_Q16_16_ONE);
+}
+
+extern int32_t MATH_Q16_16ToInt32(const MATH_Q16_16 value) {
+    return (int32_t)MATH_DivideRounded(value, MATH_Q16_16_ONE);
+}
+
+extern MATH_Q16_16 MATH_AddQ16_16(const MATH_Q16_16 summand1, const MATH_Q16_16 summand2) {
+    return MATH_SaturateToInt32((int64_t)summand1 + (int64_t)summand2);
+}
+
+extern MATH_Q16_16 MATH_SubtractQ16_16(const MATH_Q16_16 minuend, const MATH_Q16_16 subtrahend) {
+    return MATH_SaturateToInt32((int64_t)minuend - (int64_t)subtrahend);
+}
+
+extern MATH_Q16_16 MATH_MultiplyQ16_16(const MATH_Q16_16 factor1, const MATH_Q16_16 factor2) {
+    return MATH_SaturateToInt32(MATH_DivideRounded((int64_t)factor1 * (int64_t)factor2, MATH_Q16_16_ONE));
+}
+
+extern MATH_Q16_16 MATH_DivideQ16_16(const MATH_Q16_16 dividend, const MATH_Q16_16 divisor) {
+    /* the scaling of dividend and divisor cancels out */
+    return MATH_DivideInt64ToQ16_16(dividend, divisor);
+}
+
+extern MATH_Q16_16 MATH_DivideInt64ToQ16_16(const int64_t numerator, const int64_t denominator) {
+    FAS_ASSERT(numerator != INT64_MIN);
+    FAS_ASSERT(MATH_AbsInt64_t(denominator) < MATH_MAXIMUM_Q16_16_DENOMINATOR);
+    MATH_Q16_16 quotient = 0;
+    if (denominator == 0) {
+        if (numerator > 0) {
+            quotient = INT32_MAX;
+        } else if (numerator < 0) {
+            quotient = INT32_MIN;
+        } else {
+            /* 0 / 0: return 0 */
+        }
+    } else {
+        /* split into integer part and fraction to avoid an overflow of the scaled numerator */
+        const int64_t integerPart = numerator / denominator;
+        if (integerPart > (int64_t)INT16_MAX) {
+            quotient = INT32_MAX;
+        } else if (integerPart < (int64_t)INT16_MIN) {
+            quotient = INT32_MIN;
+        } else {
+            const int64_t fraction = MATH_DivideRounded((numerator % denominator) * MATH_Q16_16_ONE, denominator);
+            quotient               = MATH_SaturateToInt32((integerPart * MATH_Q16_16_ONE) + fraction);
+        }
+    }
+    return quotient;
+}
+
+extern MATH_Q16_16 MATH_AccumulateQ16_16(int64_t *pRemainder, const int64_t increment, const int64_t incrementPerLsb) {
+    FAS_ASSERT(pRemainder != NULL_PTR);
+    FAS_ASSERT(incrementPerLsb > 0);
+    /* AXIVION Routine Generic-MissingParameterAssert: increment: parameter accepts whole range */
+
+    int64_t sum = 0;
+    if ((increment > 0) && (*pRemainder > (INT64_MAX - increment))) {
+        sum = INT64_MAX;
+    } else if ((increment < 0) && (*pRemainder < (INT64_MIN - increment))) {
+        sum = INT64_MIN;
+    } else {
+        sum = *pRemainder + increment;
+    }
+    /* the division truncates towards zero; the rest is kept for the next call */
+    const MATH_Q16_16 change = MATH_SaturateToInt32(sum / incrementPerLsb);
+    *pRemainder              = sum - ((int64_t)change * incrementPerLsb);
+    return change;
+}
+
+extern MATH_Q16_16 MATH_LinearInterpolationQ16_16(
+    const MATH_Q16_16 x1,
+    const MATH_Q16_16 y1,
+    const MATH_Q16_16 x2,
+    const MATH_Q16_16 y2,
+    const MATH_Q16_16 x_interpolate) {
+    MATH_Q16_16 y_interpolate = y1;
+
+    /* If the x values are identical, no interpolation is possible: return y1 value */
+    if (x1 != x2) {
+        const int64_t deltaY   = (int64_t)y2 - (int64_t)y1;
+        const int64_t deltaX   = (int64_t)x2 - (int64_t)x1;
+        const int64_t distance = (int64_t)x_interpolate - (int64_t)x1;
+
+        if ((distance != 0) && (MATH_AbsInt64_t(deltaY) > (INT64_MAX / MATH_AbsInt64_t(distance)))) {
+            /* far extrapolation: the result is out of range in any case */
+            if (((deltaY < 0) != (distance < 0)) != (deltaX < 0)) {
+                y_interpolate = INT32_MIN;
+            } else {
+                y_interpolate = INT32_MAX;
+            }
+        } else {
+            /* Interpolate starting from x1/y1 */
+            y_interpolate = MATH_SaturateToInt32((int64_t)y1 + MATH_DivideRounded(deltaY * distance, deltaX));
+        }
+    }
+    return y_interpolate;
+}
+
+extern MATH_Q31 MATH_FloatToQ31(const float_t value) {
+    return MATH_FloatToFixedPoint(value, MATH_Q31_SCALING_FACTOR_FLOAT);
+}
+
+extern float_t MATH_Q31ToFloat(const MATH_Q31 value) {
+    return (float_t)value * (1.0f / MATH_Q31_SCALING_FACTOR_FLOAT);
+}
+
+extern MATH_Q31 MATH_AddQ31(const MATH_Q31 summand1, const MATH_Q31 summand2) {
+    return MATH_SaturateToInt32((int64_t)summand1 + (int64_t)summand2);
+}
+
+extern MATH_Q31 MATH_MultiplyQ31(const MATH_Q31 factor1, const MATH_Q31 factor2) {
+    return MATH_SaturateToInt32(MATH_DivideRounded((int64_t)factor1 * (int64_t)factor2, MATH_Q31_SCALING_FACTOR));
+}
+
+extern MATH_Q16_16 MATH_MultiplyQ16_16ByQ31(const MATH_Q16_16 value, const MATH_Q31 factor) {
+    return MATH_SaturateToInt32(MATH_DivideRounded((int64_t)value * (int64_t)factor, MATH_Q31_SCALING_FACTOR));
+}
+
+extern uint8_t MATH_CountSetBitsUint64_t(const uint64_t value) {
+    /* count the bits in parallel: pairs, nibbles, then sum up all bytes */
+    uint64_t count = value - ((value >> 1u) & 0x5555555555555555uLL);
+    count          = (count & 0x3333333333333333uLL) + ((count >> 2u) & 0x3333333333333333uLL);
+    count          = (count + (count >> 4u)) & 0x0F0F0F0F0F0F0F0FuLL;
+    return (uint8_t)((count * 0x0101010101010101uLL) >> 56u);
+}
+
 /* AXIVION Enable Style Generic-MissingParameterAssert: */
 
+extern uint16_t MATH_CountSetBitsInBitmap(const uint64_t *const kpkBitmap, uint16_t nrOfWords, uint64_t wordMask) {
+    FAS_ASSERT(kpkBitmap != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: nrOfWords: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: wordMask: parameter accepts whole range */
+    uint16_t nrOfSetBits = 0u;
+    for (uint16_t word = 0u; word < nrOfWords; word++) {
+        nrOfSetBits += MATH_CountSetBitsUint64_t(kpkBitmap[word] & wordMask);
+    }
+    return nrOfSetBits;
+}
+
+extern void MATH_AndBitmaps(
+    const uint64_t *const kpkBitmap1,
+    const uint64_t *const kpkBitmap2,
+    uint64_t *pResult,
+    uint16_t nrOfWords) {
+    FAS_ASSERT(kpkBitmap1 != NULL_PTR);
+    FAS_ASSERT(kpkBitmap2 != NULL_PTR);
+    FAS_ASSERT(pResult != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: nrOfWords: parameter accepts whole range */
+    for (uint16_t word = 0u; word < nrOfWords; word++) {
+        pResult[word] = kpkBitmap1[word] & kpkBitmap2[word];
+    }
+}
+
+extern void MATH_OrBitmaps(
+    const uint64_t *const kpkBitmap1,
+    const uint64_t *const kpkBitmap2,
+    uint64_t *pResult,
+    uint16_t nrOfWords) {
+    FAS_ASSERT(kpkBitmap1 != NULL_PTR);
+    FAS_ASSERT(kpkBitmap2 != NULL_PTR);
+    FAS_ASSERT(pResult != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: nrOfWords: parameter accepts whole range */
+    for (uint16_t word = 0u; word < nrOfWords; word++) {
+        pResult[word] = kpkBitmap1[word] | kpkBitmap2[word];
+    }
+}
+
+extern bool MATH_FindFirstSetBitInBitmap(
+    const uint64_t *const kpkBitmap,
+    uint16_t nrOfWords,
+    uint64_t wordMask,
+    uint16_t *pWord,
+    uint8_t *pBit) {
+    FAS_ASSERT(kpkBitmap != NULL_PTR);
+    FAS_ASSERT(pWord != NULL_PTR);
+    FAS_ASSERT(pBit != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: nrOfWords: parameter accepts whole range */
+    /* AXIVION Routine Generic-MissingParameterAssert: wordMask: parameter accepts whole range */
+    bool found = false;
+    for (uint16_t word = 0u; (word < nrOfWords) && (found == false); word++) {
+        const uint64_t setBits = kpkBitmap[word] & wordMask;
+        if (setBits != 0u) {
+            /* the bits below the lowest set bit are the only ones set in (setBits - 1) & ~setBits */
+            *pWord = word;
+            *pBit  = MATH_CountSetBitsUint64_t((setBits - 1u) & ~setBits);
+            found  = true;
+        }
+    }
+    return found;
+}
+
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
 #endif
@@ -43,7 +43,7 @@
  * @file    foxmath.h
  * @author  foxBMS Team
  * @date    2018-01-18 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  MATH
@@ -54,6 +54,8 @@
  *          Currently the following functions are supported:
  *          - Slope
  *          - Linear interpolation
+ *          - Saturating fixed-point arithmetic in the formats Q16.16 and Q31
+ *          - Bitmaps of 64-bit words, e.g., the invalid flags of a string
  *
  */
 
@@ -63,6 +65,7 @@
 /*========== Includes =======================================================*/
 
 #include <math.h>
+#include <stdbool.h>
 #include <stdint.h>
 /* AXIVION Disable Style Generic-LocalInclude: foxmath is intended as a library and therefore includes all useful libraries */
 #include <float.h>
@@ -77,6 +80,21 @@
 #define UNIT_CONVERSION_FACTOR_100_FLOAT    (100.0f)
 #define UNIT_CONVERSION_FACTOR_1000_FLOAT   (1000.0f)
 
+/**
+ * Q16.16 fixed-point number: sign, 15 integer bits and 16 fractional bits,
+ * i.e., range [-32768.0, 32768.0) with a resolution of 2^-16
+ */
+typedef int32_t MATH_Q16_16;
+
+/**
+ * Q31 fixed-point number: sign and 31 fractional bits, i.e., range [-1.0, 1.0)
+ * with a resolution of 2^-31
+ */
+typedef int32_t MATH_Q31;
+
+/** value 1.0 as #MATH_Q16_16 */
+#define MATH_Q16_16_ONE (65536)
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
@@ -164,6 +182,228 @@ extern int32_t MATH_AbsInt32_t(const int32_t value);
  */
 extern int64_t MATH_AbsInt64_t(const int64_t value);
 
+/**
+ * @brief   Converts a float value into a Q16.16 fixed-point value
+ * @details The value is rounded to the nearest representable value (ties
+ *          away from zero) and saturated to the range of #MATH_Q16_16.
+ *          NaN is converted to 0.
+ * @param[in] value   float value
+ * @return  Q16.16 fixed-point value
+ */
+extern MATH_Q16_16 MATH_FloatToQ16_16(const float_t value);
+
+/**
+ * @brief   Converts a Q16.16 fixed-point value into a float value
+ * @param[in] value   Q16.16 fixed-point value
+ * @return  float value
+ */
+extern float_t MATH_Q16_16ToFloat(const MATH_Q16_16 value);
+
+/**
+ * @brief   Converts an integer into a Q16.16 fixed-point value
+ * @param[in] value   integer value
+ * @return  Q16.16 fixed-point value, saturated to the range of #MATH_Q16_16
+ */
+extern MATH_Q16_16 MATH_Int32ToQ16_16(const int32_t value);
+
+/**
+ * @brief   Converts a Q16.16 fixed-point value into an integer
+ * @param[in] value   Q16.16 fixed-point value
+ * @return  value rounded to the nearest integer (ties away from zero)
+ */
+extern int32_t MATH_Q16_16ToInt32(const MATH_Q16_16 value);
+
+/**
+ * @brief   Saturating addition of two Q16.16 fixed-point values
+ * @param[in] summand1   summand 1
+ * @param[in] summand2   summand 2
+ * @return  sum, saturated to the range of #MATH_Q16_16
+ */
+extern MATH_Q16_16 MATH_AddQ16_16(const MATH_Q16_16 summand1, const MATH_Q16_16 summand2);
+
+/**
+ * @brief   Saturating subtraction of two Q16.16 fixed-point values
+ * @param[in] minuend      minuend
+ * @param[in] subtrahend   subtrahend
+ * @return  difference, saturated to the range of #MATH_Q16_16
+ */
+extern MATH_Q16_16 MATH_SubtractQ16_16(const MATH_Q16_16 minuend, const MATH_Q16_16 subtrahend);
+
+/**
+ * @brief   Saturating multiplication of two Q16.16 fixed-point values
+ * @param[in] factor1   factor 1
+ * @param[in] factor2   factor 2
+ * @return  rounded product, saturated to the range of #MATH_Q16_16
+ */
+extern MATH_Q16_16 MATH_MultiplyQ16_16(const MATH_Q16_16 factor1, const MATH_Q16_16 factor2);
+
+/**
+ * @brief   Saturating division of two Q16.16 fixed-point values
+ * @param[in] dividend   dividend
+ * @param[in] divisor    divisor
+ * @return  rounded quotient, saturated to the range of #MATH_Q16_16; a
+ *          division by zero saturates according to the sign of the dividend
+ */
+extern MATH_Q16_16 MATH_DivideQ16_16(const MATH_Q16_16 dividend, const MATH_Q16_16 divisor);
+
+/**
+ * @brief   Divides two integers and returns the quotient as Q16.16
+ *          fixed-point value
+ * @details This allows to calculate ratios of quantities that exceed the
+ *          range of #MATH_Q16_16, e.g., charges in uAs.
+ * @param[in] numerator     numerator, must not be INT64_MIN
+ * @param[in] denominator   denominator, the absolute value must be smaller
+ *                          than 2^47
+ * @return  rounded quotient, saturated to the range of #MATH_Q16_16; a
+ *          division by zero saturates according to the sign of the numerator
+ */
+extern MATH_Q16_16 MATH_DivideInt64ToQ16_16(const int64_t numerator, const int64_t denominator);
+
+/**
+ * @brief   Integrates an increment and returns the change of a Q16.16
+ *          fixed-point value
+ * @details The increment is added to the remainder of the previous calls.
+ *          The number of whole LSBs is returned and the rest is kept in the
+ *          remainder. Integrating many small increments is therefore free
+ *          of accumulating rounding errors.
+ * @param[in,out] pRemainder        integrated increments that have not been
+ *                                  returned yet
+ * @param[in]     increment         increment to integrate
+ * @param[in]     incrementPerLsb   increment that corresponds to one LSB of
+ *                                  the Q16.16 value, must be positive
+ * @return  change of the Q16.16 value (truncated towards zero), saturated to
+ *          the range of #MATH_Q16_16
+ */
+extern MATH_Q16_16 MATH_AccumulateQ16_16(int64_t *pRemainder, const int64_t increment, const int64_t incrementPerLsb);
+
+/**
+ * @brief   Linear inter-/extrapolates a third point according to two given
+ *          points in Q16.16 fixed-point arithmetic
+ * @details The result is rounded to the nearest representable value and
+ *          saturated to the range of #MATH_Q16_16. As with
+ *          #MATH_LinearInterpolation(), y1 is returned if x1 equals x2.
+ * @param   x1:               x-value of point 1
+ * @param   y1:               y-value of point 1
+ * @param   x2:               x-value of point 2
+ * @param   y2:               y-value of point 2
+ * @param   x_interpolate:    x value of interpolation point
+ * @return  interpolated value (Q16.16)
+ */
+extern MATH_Q16_16 MATH_LinearInterpolationQ16_16(
+    const MATH_Q16_16 x1,
+    const MATH_Q16_16 y1,
+    const MATH_Q16_16 x2,
+    const MATH_Q16_16 y2,
+    const MATH_Q16_16 x_interpolate);
+
+/**
+ * @brief   Converts a float value into a Q31 fixed-point value
+ * @details The value is rounded to the nearest representable value (ties
+ *          away from zero) and saturated to the range of #MATH_Q31.
+ *          NaN is converted to 0.
+ * @param[in] value   float value
+ * @return  Q31 fixed-point value
+ */
+extern MATH_Q31 MATH_FloatToQ31(const float_t value);
+
+/**
+ * @brief   Converts a Q31 fixed-point value into a float value
+ * @param[in] value   Q31 fixed-point value
+ * @return  float value
+ */
+extern float_t MATH_Q31ToFloat(const MATH_Q31 value);
+
+/**
+ * @brief   Saturating addition of two Q31 fixed-point values
+ * @param[in] summand1   summand 1
+ * @param[in] summand2   summand 2
+ * @return  sum, saturated to the range of #MATH_Q31
+ */
+extern MATH_Q31 MATH_AddQ31(const MATH_Q31 summand1, const MATH_Q31 summand2);
+
+/**
+ * @brief   Saturating multiplication of two Q31 fixed-point values
+ * @param[in] factor1   factor 1
+ * @param[in] factor2   factor 2
+ * @return  rounded product, saturated to the range of #MATH_Q31 (only
+ *          relevant for -1.0 * -1.0)
+ */
+extern MATH_Q31 MATH_MultiplyQ31(const MATH_Q31 factor1, const MATH_Q31 factor2);
+
+/**
+ * @brief   Scales a Q16.16 fixed-point value with a Q31 factor
+ * @param[in] value    Q16.16 fixed-point value
+ * @param[in] factor   Q31 factor
+ * @return  rounded product as Q16.16, saturated to the range of #MATH_Q16_16
+ */
+extern MATH_Q16_16 MATH_MultiplyQ16_16ByQ31(const MATH_Q16_16 value, const MATH_Q31 factor);
+
+/**
+ * @brief   Counts the set bits of a uint64_t value (population count)
+ * @param[in] value   value whose bits are counted
+ * @return  number of set bits (0 to 64)
+ */
+extern uint8_t MATH_CountSetBitsUint64_t(const uint64_t value);
+
+/**
+ * @brief   Counts the set bits of a bitmap
+ * @details Only the bits selected by wordMask are counted in each word, e.g.,
+ *          the bits of the cell blocks that exist in a module.
+ * @param[in] kpkBitmap   bitmap, one word per module
+ * @param[in] nrOfWords   number of words in the bitmap
+ * @param[in] wordMask    bits of each word that are counted
+ * @return  number of set bits
+ */
+extern uint16_t MATH_CountSetBitsInBitmap(const uint64_t *const kpkBitmap, uint16_t nrOfWords, uint64_t wordMask);
+
+/**
+ * @brief   Merges two bitmaps with a bitwise AND
+ * @details pResult may be the same bitmap as one of the operands.
+ * @param[in]  kpkBitmap1  first operand
+ * @param[in]  kpkBitmap2  second operand
+ * @param[out] pResult     bitwise AND of both operands
+ * @param[in]  nrOfWords   number of words in each bitmap
+ */
+extern void MATH_AndBitmaps(
+    const uint64_t *const kpkBitmap1,
+    const uint64_t *const kpkBitmap2,
+    uint64_t *pResult,
+    uint16_t nrOfWords);
+
+/**
+ * @brief   Merges two bitmaps with a bitwise OR
+ * @details pResult may be the same bitmap as one of the operands.
+ * @param[in]  kpkBitmap1  first operand
+ * @param[in]  kpkBitmap2  second operand
+ * @param[out] pResult     bitwise OR of both operands
+ * @param[in]  nrOfWords   number of words in each bitmap
+ */
+extern void MATH_OrBitmaps(
+    const uint64_t *const kpkBitmap1,
+    const uint64_t *const kpkBitmap2,
+    uint64_t *pResult,
+    uint16_t nrOfWords);
+
+/**
+ * @brief   Searches the first set bit of a bitmap
+ * @details Words are searched in ascending order and the bits of a word from
+ *          the least significant bit on. Only the bits selected by wordMask are
+ *          considered.
+ * @param[in]  kpkBitmap   bitmap, one word per module
+ * @param[in]  nrOfWords   number of words in the bitmap
+ * @param[in]  wordMask    bits of each word that are searched
+ * @param[out] pWord       word of the first set bit, unchanged if no bit is set
+ * @param[out] pBit        position of the first set bit in its word,
+ *                         unchanged if no bit is set
+ * @return  true if a set bit was found, otherwise false
+ */
+extern bool MATH_FindFirstSetBitInBitmap(
+    const uint64_t *const kpkBitmap,
+    uint16_t nrOfWords,
+    uint64_t wordMask,
+    uint16_t *pWord,
+    uint8_t *pBit);
+
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
 #endif
@@ -43,7 +43,7 @@
  * @file    htsensor.c
  * @author  foxBMS Team
  * @date    2021-08-05 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  HTSEN
@@ -56,7 +56,8 @@
 #include "htsensor.h"
 
 #include "database.h"
-#include "i2c.h"
+#include "i2c_queue.h"
+#include "os.h"
 
 #include <math.h>
 #include <stdbool.h>
@@ -69,8 +70,15 @@
 /** Sensor I2C address */
 #define HTSEN_I2C_ADDRESS (0x44u)
 
-/** Number of read tries before restart, to avoid infinite waiting for results */
-#define HTSEN_READ_TRIES (5u)
+/**
+ * Time after the start of a measurement in which the results are read,
+ * afterwards a new measurement is started to avoid infinite waiting for results.
+ * The measurement duration with high repeatability is at most 15 ms
+ * (data sheet February 2019 - Version 6, table 4, page 7), the window
+ * covers about three times this duration, independent of how often the
+ * I2C task polls the sensor.
+ */
+#define HTSEN_READ_WINDOW_ms (50u)
 
 /** Conversion coefficients to get measurement from raw temperature value @{ */
 #define HTSEN_TEMP_SCALING     (175.0f)
@@ -156,8 +164,10 @@ static uint8_t htsen_i2cWriteBuffer[2u]                              = {HTSEN_SI
 
 /** variable to store the measurement results */
 static DATA_BLOCK_HTSEN_s htsen_data = {.header.uniqueId = DATA_BLOCK_ID_HTSEN};
-/** number of tries to read the sensor data before requested a new measurement */
-static uint8_t htsen_readTries = 0u;
+/** timestamp of the start of the measurement, the results are read until #HTSEN_READ_WINDOW_ms has passed */
+static uint32_t htsen_measurementStart_ms = 0u;
+/** state of the sensor readout */
+static HTSEN_STATE_e htsen_state = HTSEN_START_MEAS;
 
 /*========== Extern Constant and Variable Definitions =======================*/
 
@@ -185,6 +195,21 @@ static int16_t HTSEN_ConvertRawTemperature(uint16_t data);
  */
 static uint8_t HTSEN_ConvertRawHumidity(uint16_t data);
 
+/**
+ * @brief   handles the completion of the I2C transactions of the sensor.
+ * @details Advances the state machine and processes the read results.
+ * @param   tag     state in which the transaction has been enqueued
+ * @param   result  result of the transaction
+ */
+static void HTSEN_TransactionCallback(uint32_t tag, I2C_TRANSACTION_RESULT_e result);
+
+/**
+ * @brief   enqueues the I2C transaction of a state of the sensor readout.
+ * @param   state   #HTSEN_START_MEAS or #HTSEN_READ_RESULTS
+ * @return  #STD_OK if the transaction has been enqueued, #STD_NOT_OK otherwise
+ */
+static STD_RETURN_TYPE_e HTSEN_EnqueueTransaction(HTSEN_STATE_e state);
+
 /*========== Static Function Implementations ================================*/
 
 static uint8_t HTSEN_CalculateCrc8(const uint8_t *data, uint32_t length) {
@@ -218,57 +243,91 @@ static uint8_t HTSEN_ConvertRawHumidity(uint16_t data) {
     return (uint8_t)humidity_perc;
 }
 
+static void HTSEN_TransactionCallback(uint32_t tag, I2C_TRANSACTION_RESULT_e result) {
+    FAS_ASSERT((tag == (uint32_t)HTSEN_START_MEAS) || (tag == (uint32_t)HTSEN_READ_RESULTS));
+    /* AXIVION Routine Generic-MissingParameterAssert: result: parameter accepts whole range */
+
+    if (tag == (uint32_t)HTSEN_START_MEAS) {
+        if (result == I2C_TRANSACTION_SUCCESSFUL) {
+            htsen_measurementStart_ms = OS_GetTickCount();
+            htsen_state               = HTSEN_READ_RESULTS;
+        } else {
+            htsen_state = HTSEN_START_MEAS;
+        }
+    } else {
+        if (result == I2C_TRANSACTION_SUCCESSFUL) {
+            /* If sensor acknowledges on I2C bus, results are available */
+            /* Check if CRC valid */
+            /* Only take temperature value if CRC valid */
+            if (htsen_i2cReadBuffer[HTSEN_TEMPERATURE_BYTE_CRC] ==
+                HTSEN_CalculateCrc8(&htsen_i2cReadBuffer[HTSEN_TEMPERATURE_MSB], HTSEN_MEASUREMENT_LENGTH_IN_BYTES)) {
+                htsen_data.temperature_ddegC = HTSEN_ConvertRawTemperature(
+                    (((uint16_t)htsen_i2cReadBuffer[HTSEN_TEMPERATURE_MSB]) << HTSEN_BYTE_SHIFT) |
+                    (uint16_t)htsen_i2cReadBuffer[HTSEN_TEMPERATURE_LSB]);
+            }
+            /* Only take humidity value if CRC valid */
+            if (htsen_i2cReadBuffer[HTSEN_HUMIDITY_BYTE_CRC] ==
+                HTSEN_CalculateCrc8(&htsen_i2cReadBuffer[HTSEN_HUMIDITY_MSB], HTSEN_MEASUREMENT_LENGTH_IN_BYTES)) {
+                htsen_data.humidity_perc = HTSEN_ConvertRawHumidity(
+                    (((uint16_t)htsen_i2cReadBuffer[HTSEN_HUMIDITY_MSB]) << HTSEN_BYTE_SHIFT) |
+                    (uint16_t)htsen_i2cReadBuffer[HTSEN_HUMIDITY_LSB]);
+            }
+            DATA_WRITE_DATA(&htsen_data);
+            htsen_state = HTSEN_START_MEAS;
+        } else {
+            /* If sensor does not acknowledge on I2C bus, results are not available yet */
+            if ((OS_GetTickCount() - htsen_measurementStart_ms) < HTSEN_READ_WINDOW_ms) {
+                htsen_state = HTSEN_READ_RESULTS;
+            } else {
+                htsen_state = HTSEN_START_MEAS;
+            }
+        }
+    }
+}
+
+static STD_RETURN_TYPE_e HTSEN_EnqueueTransaction(HTSEN_STATE_e state) {
+    FAS_ASSERT((state == HTSEN_START_MEAS) || (state == HTSEN_READ_RESULTS));
+    I2C_TRANSACTION_s transaction = {
+        .type          = I2C_TRANSACTION_WRITE,
+        .pI2cInterface = HTSEN_I2C_INTERFACE,
+        .slaveAddress  = HTSEN_I2C_ADDRESS,
+        .nrBytesWrite  = 2u,
+        .pWriteData    = htsen_i2cWriteBuffer,
+        .nrBytesRead   = 0u,
+        .pReadData     = NULL_PTR,
+        .timeout_ms    = I2C_TRANSACTION_NO_TIMEOUT,
+        .callback      = &HTSEN_TransactionCallback,
+        .tag           = (uint32_t)state,
+    };
+    if (state == HTSEN_READ_RESULTS) {
+        transaction.type         = I2C_TRANSACTION_READ;
+        transaction.nrBytesWrite = 0u;
+        transaction.pWriteData   = NULL_PTR;
+        transaction.nrBytesRead  = HTSEN_TOTAL_DATA_LENGTH_IN_BYTES;
+        transaction.pReadData    = htsen_i2cReadBuffer;
+    }
+    return I2C_EnqueueTransaction(&transaction);
+}
+
 /*========== Extern Function Implementations ================================*/
 
 extern void HTSEN_Trigger(void) {
-    static HTSEN_STATE_e htsenState    = HTSEN_START_MEAS;
-    STD_RETURN_TYPE_e htsenReturnValue = STD_OK;
-    uint32_t current_time              = OS_GetTickCount();
-
-    switch (htsenState) {
+    switch (htsen_state) {
         case HTSEN_START_MEAS:
-            /* Trigger a measurement */
-            htsenReturnValue = I2C_WriteDma(HTSEN_I2C_INTERFACE, HTSEN_I2C_ADDRESS, 2u, htsen_i2cWriteBuffer);
-            OS_DelayTaskUntil(&current_time, 2u);
-            if (htsenReturnValue == STD_OK) {
-                htsenState = HTSEN_READ_RESULTS;
+            /* Trigger a measurement, the callback advances the state machine */
+            if (HTSEN_EnqueueTransaction(HTSEN_START_MEAS) == STD_OK) {
+                htsen_state = HTSEN_TRANSACTION_PENDING;
             }
-            htsen_readTries = HTSEN_READ_TRIES;
             break;
         case HTSEN_READ_RESULTS:
-            /* Try to read values */
-            htsenReturnValue = I2C_ReadDma(
-                HTSEN_I2C_INTERFACE, HTSEN_I2C_ADDRESS, HTSEN_TOTAL_DATA_LENGTH_IN_BYTES, htsen_i2cReadBuffer);
-            OS_DelayTaskUntil(&current_time, 2u);
-            if (htsenReturnValue == STD_OK) {
-                /* If sensor acknowledges on I2C bus, results are available */
-                /* Check if CRC valid */
-                /* Only take temperature value if CRC valid */
-                if (htsen_i2cReadBuffer[HTSEN_TEMPERATURE_BYTE_CRC] ==
-                    HTSEN_CalculateCrc8(
-                        &htsen_i2cReadBuffer[HTSEN_TEMPERATURE_MSB], HTSEN_MEASUREMENT_LENGTH_IN_BYTES)) {
-                    htsen_data.temperature_ddegC = HTSEN_ConvertRawTemperature(
-                        (((uint16_t)htsen_i2cReadBuffer[HTSEN_TEMPERATURE_MSB]) << HTSEN_BYTE_SHIFT) |
-                        (uint16_t)htsen_i2cReadBuffer[HTSEN_TEMPERATURE_LSB]);
-                }
-                /* Only take humidity value if CRC valid */
-                if (htsen_i2cReadBuffer[HTSEN_HUMIDITY_BYTE_CRC] ==
-                    HTSEN_CalculateCrc8(&htsen_i2cReadBuffer[HTSEN_HUMIDITY_MSB], HTSEN_MEASUREMENT_LENGTH_IN_BYTES)) {
-                    htsen_data.humidity_perc = HTSEN_ConvertRawHumidity(
-                        (((uint16_t)htsen_i2cReadBuffer[HTSEN_HUMIDITY_MSB]) << HTSEN_BYTE_SHIFT) |
-                        (uint16_t)htsen_i2cReadBuffer[HTSEN_HUMIDITY_LSB]);
-                }
-                DATA_WRITE_DATA(&htsen_data);
-                htsenState = HTSEN_START_MEAS;
-            } else {
-                /* If sensor does not acknowledge on I2C bus, results are not available ye */
-                if (htsen_readTries > 0u) {
-                    htsen_readTries--;
-                } else {
-                    htsenState = HTSEN_START_MEAS;
-                }
+            /* Try to read values, the callback advances the state machine */
+            if (HTSEN_EnqueueTransaction(HTSEN_READ_RESULTS) == STD_OK) {
+                htsen_state = HTSEN_TRANSACTION_PENDING;
             }
             break;
+        case HTSEN_TRANSACTION_PENDING:
+            /* Transaction still queued, nothing to do */
+            break;
         default:
             /* invalid state */
             FAS_ASSERT(FAS_TRAP);
@@ -43,7 +43,7 @@
  * @file    htsensor.h
  * @author  foxBMS Team
  * @date    2021-08-05 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  HTSEN
@@ -61,12 +61,16 @@
 
 /*========== Macros and Definitions =========================================*/
 
+/** I2C transactions that #HTSEN_Trigger() enqueues in one cycle of the I2C task */
+#define HTSEN_NR_OF_I2C_TRANSACTIONS_PER_CYCLE (1u)
+
 /**
  * States for the sensor readout
  */
 typedef enum {
     HTSEN_START_MEAS,
     HTSEN_READ_RESULTS,
+    HTSEN_TRANSACTION_PENDING,
 } HTSEN_STATE_e;
 
 /*========== Extern Constant and Variable Declarations ======================*/
@@ -76,7 +80,9 @@ typedef enum {
 /**
  * @brief   triggers a measurement of the I2C humidity/temperature sensor.
  * @details This function steps through the state-machine that handles
- *          the measurement with the I2C sensor.
+ *          the measurement with the I2C sensor. The I2C transactions are
+ *          enqueued and run by #I2C_ProcessTransactionQueue(), their
+ *          results advance the state-machine.
  */
 extern void HTSEN_Trigger(void);
 
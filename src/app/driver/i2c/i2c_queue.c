@@ -0,0 +1,268 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    i2c_queue.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup DRIVERS
+ * @prefix  I2C
+ *
+ * @brief   Transaction queue of the I2C driver
+ * @details The queue is a ring buffer of transaction descriptors. It is
+ *          filled by the drivers of the I2C devices and emptied by the I2C
+ *          task, which runs the transactions with the DMA functions of the
+ *          I2C driver.
+ */
+
+/*========== Includes =======================================================*/
+#include "i2c_queue.h"
+
+#include "fassert.h"
+#include "fstd_types.h"
+#include "i2c.h"
+#include "os.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** I2C addresses are 7 bit long */
+#define I2C_MAXIMUM_SLAVE_ADDRESS (127u)
+
+/** entry of the transaction queue */
+typedef struct {
+    I2C_TRANSACTION_s transaction; /*!< descriptor of the transaction */
+    uint32_t enqueueTimestamp_ms;  /*!< time stamp when the transaction has been enqueued */
+} I2C_QUEUE_ENTRY_s;
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** ring buffer of the queued transactions */
+static I2C_QUEUE_ENTRY_s i2c_transactionQueue[I2C_TRANSACTION_QUEUE_LENGTH] = {0};
+/** index of the oldest queued transaction */
+static uint32_t i2c_queueHead = 0u;
+/** number of queued transactions */
+static uint32_t i2c_queueCount = 0u;
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   Removes the oldest transaction from the queue.
+ * @param   pEntry  entry of the removed transaction
+ * @return  true if a transaction has been removed, false if the queue is empty
+ */
+static bool I2C_DequeueTransaction(I2C_QUEUE_ENTRY_s *pEntry);
+
+/**
+ * @brief   Checks if a transaction has waited longer than its timeout.
+ * @param   pEntry          queue entry of the transaction
+ * @param   timestamp_ms    current time stamp
+ * @return  true if the transaction has expired, false otherwise
+ */
+static bool I2C_IsTransactionExpired(const I2C_QUEUE_ENTRY_s *pEntry, uint32_t timestamp_ms);
+
+/**
+ * @brief   Runs a transaction on the bus.
+ * @details The DMA receive functions need at least two bytes, one byte is
+ *          read with the polling functions.
+ * @param   pTransaction    descriptor of the transaction
+ * @return  #I2C_TRANSACTION_SUCCESSFUL or #I2C_TRANSACTION_FAILED
+ */
+static I2C_TRANSACTION_RESULT_e I2C_RunTransaction(const I2C_TRANSACTION_s *pTransaction);
+
+/*========== Static Function Implementations ================================*/
+static bool I2C_DequeueTransaction(I2C_QUEUE_ENTRY_s *pEntry) {
+    FAS_ASSERT(pEntry != NULL_PTR);
+    bool dequeued = false;
+
+    OS_EnterTaskCritical();
+    if (i2c_queueCount > 0u) {
+        *pEntry       = i2c_transactionQueue[i2c_queueHead];
+        i2c_queueHead = (i2c_queueHead + 1u) % I2C_TRANSACTION_QUEUE_LENGTH;
+        i2c_queueCount--;
+        dequeued = true;
+    }
+    OS_ExitTaskCritical();
+
+    return dequeued;
+}
+
+static bool I2C_IsTransactionExpired(const I2C_QUEUE_ENTRY_s *pEntry, uint32_t timestamp_ms) {
+    FAS_ASSERT(pEntry != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: timestamp_ms: parameter accepts whole range */
+    bool expired = false;
+
+    if (pEntry->transaction.timeout_ms != I2C_TRANSACTION_NO_TIMEOUT) {
+        /* unsigned subtraction handles the overflow of the time stamp */
+        expired = ((timestamp_ms - pEntry->enqueueTimestamp_ms) > pEntry->transaction.timeout_ms);
+    }
+
+    return expired;
+}
+
+static I2C_TRANSACTION_RESULT_e I2C_RunTransaction(const I2C_TRANSACTION_s *pTransaction) {
+    FAS_ASSERT(pTransaction != NULL_PTR);
+    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+
+    switch (pTransaction->type) {
+        case I2C_TRANSACTION_READ:
+            if (pTransaction->nrBytesRead == 1u) {
+                retVal = I2C_Read(
+                    pTransaction->pI2cInterface,
+                    pTransaction->slaveAddress,
+                    pTransaction->nrBytesRead,
+                    pTransaction->pReadData);
+            } else {
+                retVal = I2C_ReadDma(
+                    pTransaction->pI2cInterface,
+                    pTransaction->slaveAddress,
+                    pTransaction->nrBytesRead,
+                    pTransaction->pReadData);
+            }
+            break;
+        case I2C_TRANSACTION_WRITE:
+            retVal = I2C_WriteDma(
+                pTransaction->pI2cInterface,
+                pTransaction->slaveAddress,
+                pTransaction->nrBytesWrite,
+                pTransaction->pWriteData);
+            break;
+        case I2C_TRANSACTION_WRITE_READ:
+            if (pTransaction->nrBytesRead == 1u) {
+                retVal = I2C_WriteRead(
+                    pTransaction->pI2cInterface,
+                    pTransaction->slaveAddress,
+                    pTransaction->nrBytesWrite,
+                    pTransaction->pWriteData,
+                    pTransaction->nrBytesRead,
+                    pTransaction->pReadData);
+            } else {
+                retVal = I2C_WriteReadDma(
+                    pTransaction->pI2cInterface,
+                    pTransaction->slaveAddress,
+                    pTransaction->nrBytesWrite,
+                    pTransaction->pWriteData,
+                    pTransaction->nrBytesRead,
+                    pTransaction->pReadData);
+            }
+            break;
+        default:
+            /* invalid transaction type */
+            FAS_ASSERT(FAS_TRAP);
+            break;
+    }
+
+    I2C_TRANSACTION_RESULT_e result = I2C_TRANSACTION_FAILED;
+    if (retVal == STD_OK) {
+        result = I2C_TRANSACTION_SUCCESSFUL;
+    }
+    return result;
+}
+
+/*========== Extern Function Implementations ================================*/
+extern STD_RETURN_TYPE_e I2C_EnqueueTransaction(const I2C_TRANSACTION_s *pTransaction) {
+    FAS_ASSERT(pTransaction != NULL_PTR);
+    FAS_ASSERT(pTransaction->pI2cInterface != NULL_PTR);
+    FAS_ASSERT(pTransaction->slaveAddress <= I2C_MAXIMUM_SLAVE_ADDRESS);
+    FAS_ASSERT(
+        (pTransaction->type == I2C_TRANSACTION_READ) || (pTransaction->type == I2C_TRANSACTION_WRITE) ||
+        (pTransaction->type == I2C_TRANSACTION_WRITE_READ));
+    if (pTransaction->type != I2C_TRANSACTION_READ) {
+        FAS_ASSERT(pTransaction->pWriteData != NULL_PTR);
+        FAS_ASSERT(pTransaction->nrBytesWrite > 0u);
+    }
+    if (pTransaction->type != I2C_TRANSACTION_WRITE) {
+        FAS_ASSERT(pTransaction->pReadData != NULL_PTR);
+        FAS_ASSERT(pTransaction->nrBytesRead > 0u);
+    }
+    STD_RETURN_TYPE_e retVal    = STD_NOT_OK;
+    const uint32_t timestamp_ms = OS_GetTickCount();
+
+    OS_EnterTaskCritical();
+    if (i2c_queueCount < I2C_TRANSACTION_QUEUE_LENGTH) {
+        const uint32_t tail = (i2c_queueHead + i2c_queueCount) % I2C_TRANSACTION_QUEUE_LENGTH;
+
+        i2c_transactionQueue[tail].transaction         = *pTransaction;
+        i2c_transactionQueue[tail].enqueueTimestamp_ms = timestamp_ms;
+        i2c_queueCount++;
+        retVal = STD_OK;
+    }
+    OS_ExitTaskCritical();
+
+    return retVal;
+}
+
+extern uint32_t I2C_ProcessTransactionQueue(void) {
+    uint32_t nrOfCompletedTransactions = 0u;
+    I2C_QUEUE_ENTRY_s entry            = {0};
+
+    while ((nrOfCompletedTransactions < I2C_TRANSACTION_QUEUE_LENGTH) && (I2C_DequeueTransaction(&entry) == true)) {
+        I2C_TRANSACTION_RESULT_e result = I2C_TRANSACTION_TIMED_OUT;
+        if (I2C_IsTransactionExpired(&entry, OS_GetTickCount()) == false) {
+            result = I2C_RunTransaction(&entry.transaction);
+        }
+        if (entry.transaction.callback != NULL_PTR) {
+            entry.transaction.callback(entry.transaction.tag, result);
+        }
+        nrOfCompletedTransactions++;
+    }
+
+    return nrOfCompletedTransactions;
+}
+
+extern uint32_t I2C_GetNumberOfQueuedTransactions(void) {
+    uint32_t nrOfQueuedTransactions = 0u;
+    OS_EnterTaskCritical();
+    nrOfQueuedTransactions = i2c_queueCount;
+    OS_ExitTaskCritical();
+    return nrOfQueuedTransactions;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern void TEST_I2C_ResetTransactionQueue(void) {
+    i2c_queueHead  = 0u;
+    i2c_queueCount = 0u;
+}
+#endif
@@ -0,0 +1,161 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    i2c_queue.h
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup DRIVERS
+ * @prefix  I2C
+ *
+ * @brief   Header for the transaction queue of the I2C driver
+ * @details Drivers of I2C devices enqueue transaction descriptors with
+ *          #I2C_EnqueueTransaction() and are informed about the result
+ *          through the callback of the descriptor. The I2C task runs the
+ *          queued transactions in the order they have been enqueued with
+ *          #I2C_ProcessTransactionQueue() and sleeps while the DMA transfers
+ *          are running.
+ */
+
+#ifndef FOXBMS__I2C_QUEUE_H_
+#define FOXBMS__I2C_QUEUE_H_
+
+/*========== Includes =======================================================*/
+
+#include "HL_i2c.h"
+
+#include "fstd_types.h"
+
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/**
+ * Maximum number of transactions waiting in the queue. Has to be large enough
+ * for all transactions that the drivers enqueue in one cycle of the I2C task.
+ */
+#define I2C_TRANSACTION_QUEUE_LENGTH (16u)
+
+/** Value of the timeout of a transaction that never expires in the queue */
+#define I2C_TRANSACTION_NO_TIMEOUT (0u)
+
+/** types of I2C transactions */
+typedef enum {
+    I2C_TRANSACTION_READ,       /*!< read, see #I2C_ReadDma() */
+    I2C_TRANSACTION_WRITE,      /*!< write, see #I2C_WriteDma() */
+    I2C_TRANSACTION_WRITE_READ, /*!< write then read after a repeated start, see #I2C_WriteReadDma() */
+} I2C_TRANSACTION_TYPE_e;
+
+/** results of I2C transactions passed to the callbacks */
+typedef enum {
+    I2C_TRANSACTION_SUCCESSFUL, /*!< transaction finished successfully */
+    I2C_TRANSACTION_FAILED,     /*!< bus busy, NACK or transfer not finished in time */
+    I2C_TRANSACTION_TIMED_OUT,  /*!< transaction has waited longer than its timeout and has not been started */
+} I2C_TRANSACTION_RESULT_e;
+
+/**
+ * @brief   Callback called when a transaction is completed
+ * @details The callback is called in the context of the I2C task. The read
+ *          data of the transaction is valid only if the result is
+ *          #I2C_TRANSACTION_SUCCESSFUL.
+ * @param   tag     tag of the transaction descriptor
+ * @param   result  result of the transaction
+ */
+typedef void (*I2C_TRANSACTION_CALLBACK_f)(uint32_t tag, I2C_TRANSACTION_RESULT_e result);
+
+/**
+ * Descriptor of an I2C transaction. The data buffers have to stay valid until
+ * the callback is called and have to be placed in a non-cacheable area as
+ * they are accessed by DMA.
+ */
+typedef struct {
+    I2C_TRANSACTION_TYPE_e type;         /*!< type of the transaction */
+    i2cBASE_t *pI2cInterface;            /*!< I2C interface to use */
+    uint32_t slaveAddress;               /*!< address of the slave to communicate with */
+    uint32_t nrBytesWrite;               /*!< number of bytes to write, unused for reads */
+    uint8_t *pWriteData;                 /*!< data to write, unused for reads */
+    uint32_t nrBytesRead;                /*!< number of bytes to read, unused for writes */
+    uint8_t *pReadData;                  /*!< buffer for the read data, unused for writes */
+    uint32_t timeout_ms;                 /*!< maximum time in the queue, #I2C_TRANSACTION_NO_TIMEOUT to wait forever */
+    I2C_TRANSACTION_CALLBACK_f callback; /*!< called when the transaction is completed, may be NULL_PTR */
+    uint32_t tag;                        /*!< passed to the callback to identify the transaction */
+} I2C_TRANSACTION_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   Appends a transaction to the queue.
+ * @details The descriptor is copied, the data buffers are not. Can be called
+ *          from any task.
+ * @param   pTransaction    descriptor of the transaction
+ * @return  #STD_OK if the transaction has been enqueued, #STD_NOT_OK if the
+ *          queue is full
+ */
+extern STD_RETURN_TYPE_e I2C_EnqueueTransaction(const I2C_TRANSACTION_s *pTransaction);
+
+/**
+ * @brief   Runs the queued transactions in the order they have been enqueued.
+ * @details Has to be called by the I2C task, as the DMA functions wait for
+ *          the notifications of this task. Transactions that waited longer
+ *          than their timeout are completed with #I2C_TRANSACTION_TIMED_OUT
+ *          without accessing the bus. At most
+ *          #I2C_TRANSACTION_QUEUE_LENGTH transactions are run per call so
+ *          that callbacks enqueueing follow-up transactions cannot block the
+ *          task.
+ * @return  number of completed transactions
+ */
+extern uint32_t I2C_ProcessTransactionQueue(void);
+
+/**
+ * @brief   Returns the number of transactions waiting in the queue.
+ * @return  number of queued transactions
+ */
+extern uint32_t I2C_GetNumberOfQueuedTransactions(void);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern void TEST_I2C_ResetTransactionQueue(void);
+#endif
+
+#endif /* FOXBMS__I2C_QUEUE_H_ */
@@ -43,7 +43,7 @@
  * @file    meas.c
  * @author  foxBMS Team
  * @date    2020-02-24 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  MEAS
@@ -58,6 +58,7 @@
 #include "battery_system_cfg.h"
 
 #include "afe.h"
+#include "afe_schedule.h"
 #include "fassert.h"
 #include "fstd_types.h"
 
@@ -127,6 +128,11 @@ extern STD_RETURN_TYPE_e MEAS_RequestOpenWireCheck(uint8_t string) {
     return AFE_RequestOpenWireCheck(string);
 }
 
+extern void MEAS_RequestMeasurementBoost(bool boost) {
+    /* AXIVION Routine Generic-MissingParameterAssert: boost: parameter accepts whole range */
+    AFE_ScheduleRequestBoost(boost);
+}
+
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
 #endif
@@ -43,7 +43,7 @@
  * @file    meas.h
  * @author  foxBMS Team
  * @date    2020-02-24 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  MEAS
@@ -142,6 +142,13 @@ extern STD_RETURN_TYPE_e MEAS_RequestEepromWrite(uint8_t string);
  */
 extern STD_RETURN_TYPE_e MEAS_RequestOpenWireCheck(uint8_t string);
 
+/**
+ * @brief   Requests the boost rates of the multi-rate measurement schedule
+ *          of the AFE (see afe_schedule_cfg.h)
+ * @param   boost   true to use the boost rates, false to use the normal rates
+ */
+extern void MEAS_RequestMeasurementBoost(bool boost);
+
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
 #endif
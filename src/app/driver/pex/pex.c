@@ -43,7 +43,7 @@
  * @file    pex.c
  * @author  foxBMS Team
  * @date    2021-08-02 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  PEX
@@ -56,9 +56,11 @@
 #include "pex.h"
 
 #include "diag.h"
-#include "i2c.h"
+#include "fassert.h"
+#include "i2c_queue.h"
 #include "os.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
@@ -94,13 +96,37 @@
 #define PEX_PIN_DIRECTION_INPUT  (1u)
 /**@}*/
 
+/** Number of bytes written to set a register pair (address and two registers) */
+#define PEX_NR_OF_BYTES_WRITE_REGISTER_PAIR (3u)
+/** Number of bytes read from a register pair */
+#define PEX_NR_OF_BYTES_READ_REGISTER_PAIR (2u)
+
+/** I2C transactions with each port expander in one cycle, enqueued in this order */
+typedef enum {
+    PEX_TRANSACTION_WRITE_CONFIG_DIRECTION, /*!< sets direction of the pins */
+    PEX_TRANSACTION_WRITE_CONFIG_POLARITY,  /*!< sets polarity inversion of the pins */
+    PEX_TRANSACTION_READ_INPUTS,            /*!< reads input state of the pins */
+    PEX_TRANSACTION_WRITE_OUTPUTS,          /*!< sets output state of the pins */
+    PEX_NR_OF_TRANSACTIONS,                 /*!< number of transactions per port expander */
+} PEX_TRANSACTION_e;
+
+FAS_STATIC_ASSERT(
+    (((uint32_t)PEX_NR_OF_TRANSACTIONS * PEX_NR_OF_PORT_EXPANDERS) == PEX_NR_OF_I2C_TRANSACTIONS_PER_CYCLE),
+    "PEX_NR_OF_I2C_TRANSACTIONS_PER_CYCLE does not match the transactions enqueued per cycle");
+
 /*========== Static Constant and Variable Definitions =======================*/
-/** I2C write buffer for PEX */
+/** I2C buffers for PEX, one per transaction as all transactions of a cycle are queued at once */
 #pragma SET_DATA_SECTION(".sharedRAM")
-static uint8_t pex_i2cDataWrite[3u] = {0};
-static uint8_t pex_i2cDataRead[2u]  = {0};
+static uint8_t pex_i2cDataWrite[PEX_NR_OF_TRANSACTIONS][PEX_NR_OF_PORT_EXPANDERS][PEX_NR_OF_BYTES_WRITE_REGISTER_PAIR] =
+    {0};
+static uint8_t pex_i2cDataRead[PEX_NR_OF_PORT_EXPANDERS][PEX_NR_OF_BYTES_READ_REGISTER_PAIR] = {0};
 #pragma SET_DATA_SECTION()
 
+/** number of I2C transactions of the current cycle that have not been completed */
+static uint32_t pex_nrOfPendingTransactions = 0u;
+/** true if an I2C transaction of the current cycle has failed */
+static bool pex_transactionFailed = false;
+
 /**
  * These variables are used to configure the port expanders (input, output,
  * configuration) from external modules.
@@ -135,28 +161,29 @@ static uint8_t pex_configDirectionPort1Local[PEX_NR_OF_PORT_EXPANDERS] = {0};
 /*========== Static Function Prototypes =====================================*/
 
 /**
- * @brief   reads input state of port expander pins over I2C.
- * @return  #STD_OK if I2C transmission ok, #STD_NOT_OK otherwise
- */
-static STD_RETURN_TYPE_e PEX_ReadInputs(void);
-
-/**
- * @brief   sets output state of port expander pins over I2C.
- * @return  #STD_OK if I2C transmission ok, #STD_NOT_OK otherwise
+ * @brief   enqueues an I2C transaction with a port expander.
+ * @details The data to write is taken from the local variables.
+ * @param   transaction     transaction to enqueue
+ * @param   portExpander    port expander to communicate with
+ * @return  #STD_OK if the transaction has been enqueued, #STD_NOT_OK otherwise
  */
-static STD_RETURN_TYPE_e PEX_WriteOutputs(void);
+static STD_RETURN_TYPE_e PEX_EnqueueTransaction(PEX_TRANSACTION_e transaction, uint8_t portExpander);
 
 /**
- * @brief   sets polarity inversion state of port expander pins over I2C.
- * @return  #STD_OK if I2C transmission ok, #STD_NOT_OK otherwise
+ * @brief   handles the completion of an I2C transaction with a port expander.
+ * @details Stores the read input state. When the last transaction of the
+ *          cycle is completed, the cycle is finished.
+ * @param   tag     transaction and port expander, see #PEX_EnqueueTransaction()
+ * @param   result  result of the transaction
  */
-static STD_RETURN_TYPE_e PEX_WriteConfigPolarity(void);
+static void PEX_TransactionCallback(uint32_t tag, I2C_TRANSACTION_RESULT_e result);
 
 /**
- * @brief   sets direction of port expander pins over I2C.
- * @return  #STD_OK if I2C transmission ok, #STD_NOT_OK otherwise
+ * @brief   finishes a cycle once all transactions are completed.
+ * @details Notifies diag about the result of the transactions and copies the
+ *          input state to the externally available variables.
  */
-static STD_RETURN_TYPE_e PEX_WriteConfigDirection(void);
+static void PEX_FinishCycle(void);
 
 /**
  * @brief   copies values from the externally available variables to the
@@ -172,87 +199,111 @@ static void PEX_GetFromLocalVariable(void);
 
 /*========== Static Function Implementations ================================*/
 
-static STD_RETURN_TYPE_e PEX_ReadInputs(void) {
-    STD_RETURN_TYPE_e retVal = STD_OK;
-
-    for (uint8_t i = 0u; i < PEX_NR_OF_PORT_EXPANDERS; i++) {
-        /*
-         * Input Port 0 as address, next read register will be Input Port 1
-         * data sheet: Rev. 9 - 8 November 2017
-         * "After the first byte is read, additional bytes may be read but
-         * the data will now reflect the information in the other register in the pair.
-         * For example, if you read Input port 1, then the next byte read would be Input port 0."
-         */
-        pex_i2cDataWrite[0u] = PEX_INPUT_PORT0_REGISTER_ADDRESS;
-        pex_i2cDataRead[0u]  = 0u;
-        pex_i2cDataRead[1u]  = 0u;
-        STD_RETURN_TYPE_e i2cReadReturn =
-            I2C_WriteReadDma(PEX_I2C_INTERFACE, pex_addressList[i], 1u, pex_i2cDataWrite, 2u, pex_i2cDataRead);
-        if (i2cReadReturn == STD_NOT_OK) {
-            retVal = STD_NOT_OK;
-        } else {
-            pex_inputPort0Local[i] = pex_i2cDataRead[0u];
-            pex_inputPort1Local[i] = pex_i2cDataRead[1u];
-        }
+static STD_RETURN_TYPE_e PEX_EnqueueTransaction(PEX_TRANSACTION_e transaction, uint8_t portExpander) {
+    FAS_ASSERT(transaction < PEX_NR_OF_TRANSACTIONS);
+    FAS_ASSERT(portExpander < PEX_NR_OF_PORT_EXPANDERS);
+    uint8_t *pWriteData = pex_i2cDataWrite[transaction][portExpander];
+
+    I2C_TRANSACTION_s i2cTransaction = {
+        .type          = I2C_TRANSACTION_WRITE,
+        .pI2cInterface = PEX_I2C_INTERFACE,
+        .slaveAddress  = pex_addressList[portExpander],
+        .nrBytesWrite  = PEX_NR_OF_BYTES_WRITE_REGISTER_PAIR,
+        .pWriteData    = pWriteData,
+        .nrBytesRead   = 0u,
+        .pReadData     = NULL_PTR,
+        .timeout_ms    = I2C_TRANSACTION_NO_TIMEOUT,
+        .callback      = &PEX_TransactionCallback,
+        .tag           = ((uint32_t)transaction * PEX_NR_OF_PORT_EXPANDERS) + portExpander,
+    };
+
+    switch (transaction) {
+        case PEX_TRANSACTION_WRITE_CONFIG_DIRECTION:
+            /**
+             * Direction Port 0 as address, next read register will be Direction Port 1
+             * data sheet: Rev. 9 - 8 November 2017
+             * Figure 10: one register pair can be written in one transaction
+             */
+            pWriteData[0u] = PEX_DIRECTION_PORT0_REGISTER_ADDRESS;
+            pWriteData[1u] = pex_configDirectionPort0Local[portExpander];
+            pWriteData[2u] = pex_configDirectionPort1Local[portExpander];
+            break;
+        case PEX_TRANSACTION_WRITE_CONFIG_POLARITY:
+            /**
+             * Inversion Polarity Port 0 as address, next read register will be Inversion Polarity Port 1
+             * data sheet: Rev. 9 - 8 November 2017
+             * Figure 10: one register pair can be written in one transaction
+             */
+            pWriteData[0u] = PEX_POL_INV_PORT0_REGISTER_ADDRESS;
+            pWriteData[1u] = pex_configPolarityPort0Local[portExpander];
+            pWriteData[2u] = pex_configPolarityPort1Local[portExpander];
+            break;
+        case PEX_TRANSACTION_READ_INPUTS:
+            /*
+             * Input Port 0 as address, next read register will be Input Port 1
+             * data sheet: Rev. 9 - 8 November 2017
+             * "After the first byte is read, additional bytes may be read but
+             * the data will now reflect the information in the other register in the pair.
+             * For example, if you read Input port 1, then the next byte read would be Input port 0."
+             */
+            pWriteData[0u]                    = PEX_INPUT_PORT0_REGISTER_ADDRESS;
+            pex_i2cDataRead[portExpander][0u] = 0u;
+            pex_i2cDataRead[portExpander][1u] = 0u;
+            i2cTransaction.type               = I2C_TRANSACTION_WRITE_READ;
+            i2cTransaction.nrBytesWrite       = 1u;
+            i2cTransaction.nrBytesRead        = PEX_NR_OF_BYTES_READ_REGISTER_PAIR;
+            i2cTransaction.pReadData          = pex_i2cDataRead[portExpander];
+            break;
+        case PEX_TRANSACTION_WRITE_OUTPUTS:
+            /**
+             * Outport Port 0 as address, next read register will be Output Port 1
+             * data sheet: Rev. 9 - 8 November 2017
+             * Figure 10: one register pair can be written in one transaction
+             */
+            pWriteData[0u] = PEX_OUTPUT_PORT0_REGISTER_ADDRESS;
+            pWriteData[1u] = pex_outputPort0Local[portExpander];
+            pWriteData[2u] = pex_outputPort1Local[portExpander];
+            break;
+        default:
+            /* invalid transaction */
+            FAS_ASSERT(FAS_TRAP);
+            break;
     }
-    return retVal;
+
+    return I2C_EnqueueTransaction(&i2cTransaction);
 }
 
-static STD_RETURN_TYPE_e PEX_WriteOutputs(void) {
-    STD_RETURN_TYPE_e retVal = STD_OK;
-    for (uint8_t i = 0u; i < PEX_NR_OF_PORT_EXPANDERS; i++) {
-        /**
-         * Outport Port 0 as address, next read register will be Output Port 1
-         * data sheet: Rev. 9 - 8 November 2017
-         * Figure 10: one register pair can be written in one transaction
-         */
-        pex_i2cDataWrite[0u]             = PEX_OUTPUT_PORT0_REGISTER_ADDRESS;
-        pex_i2cDataWrite[1u]             = pex_outputPort0Local[i];
-        pex_i2cDataWrite[2u]             = pex_outputPort1Local[i];
-        STD_RETURN_TYPE_e i2cWriteReturn = I2C_WriteDma(PEX_I2C_INTERFACE, pex_addressList[i], 3u, pex_i2cDataWrite);
-        if (i2cWriteReturn == STD_NOT_OK) {
-            retVal = STD_NOT_OK;
-        }
+static void PEX_TransactionCallback(uint32_t tag, I2C_TRANSACTION_RESULT_e result) {
+    FAS_ASSERT(tag < ((uint32_t)PEX_NR_OF_TRANSACTIONS * PEX_NR_OF_PORT_EXPANDERS));
+    /* AXIVION Routine Generic-MissingParameterAssert: result: parameter accepts whole range */
+    FAS_ASSERT(pex_nrOfPendingTransactions > 0u);
+    const uint8_t portExpander = (uint8_t)(tag % PEX_NR_OF_PORT_EXPANDERS);
+    const uint32_t transaction = tag / PEX_NR_OF_PORT_EXPANDERS;
+
+    if (result != I2C_TRANSACTION_SUCCESSFUL) {
+        pex_transactionFailed = true;
+    } else if (transaction == (uint32_t)PEX_TRANSACTION_READ_INPUTS) {
+        pex_inputPort0Local[portExpander] = pex_i2cDataRead[portExpander][0u];
+        pex_inputPort1Local[portExpander] = pex_i2cDataRead[portExpander][1u];
+    } else {
+        /* nothing to do for successful write transactions */
     }
-    return retVal;
-}
 
-static STD_RETURN_TYPE_e PEX_WriteConfigPolarity(void) {
-    STD_RETURN_TYPE_e retVal = STD_OK;
-    for (uint8_t i = 0u; i < PEX_NR_OF_PORT_EXPANDERS; i++) {
-        /**
-         * Inversion Polarity Port 0 as address, next read register will be Inversion Polarity Port 1
-         * data sheet: Rev. 9 - 8 November 2017
-         * Figure 10: one register pair can be written in one transaction
-         */
-        pex_i2cDataWrite[0u]             = PEX_POL_INV_PORT0_REGISTER_ADDRESS;
-        pex_i2cDataWrite[1u]             = pex_configPolarityPort0Local[i];
-        pex_i2cDataWrite[2u]             = pex_configPolarityPort1Local[i];
-        STD_RETURN_TYPE_e i2cWriteReturn = I2C_WriteDma(PEX_I2C_INTERFACE, pex_addressList[i], 3u, pex_i2cDataWrite);
-        if (i2cWriteReturn == STD_NOT_OK) {
-            retVal = STD_NOT_OK;
-        }
+    pex_nrOfPendingTransactions--;
+    if (pex_nrOfPendingTransactions == 0u) {
+        PEX_FinishCycle();
     }
-    return retVal;
 }
 
-static STD_RETURN_TYPE_e PEX_WriteConfigDirection(void) {
-    STD_RETURN_TYPE_e retVal = STD_OK;
-    for (uint8_t i = 0u; i < PEX_NR_OF_PORT_EXPANDERS; i++) {
-        /**
-         * Direction Port 0 as address, next read register will be Direction Port 1
-         * data sheet: Rev. 9 - 8 November 2017
-         * Figure 10: one register pair can be written in one transaction
-         */
-        pex_i2cDataWrite[0u]             = PEX_DIRECTION_PORT0_REGISTER_ADDRESS;
-        pex_i2cDataWrite[1u]             = pex_configDirectionPort0Local[i];
-        pex_i2cDataWrite[2u]             = pex_configDirectionPort1Local[i];
-        STD_RETURN_TYPE_e i2cWriteReturn = I2C_WriteDma(PEX_I2C_INTERFACE, pex_addressList[i], 3u, pex_i2cDataWrite);
-        if (i2cWriteReturn == STD_NOT_OK) {
-            retVal = STD_NOT_OK;
-        }
+static void PEX_FinishCycle(void) {
+    /* notify diag if one of the transactions failed, but continue normally */
+    if (pex_transactionFailed == true) {
+        DIAG_Handler(DIAG_ID_I2C_PEX_ERROR, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u);
+    } else {
+        DIAG_Handler(DIAG_ID_I2C_PEX_ERROR, DIAG_EVENT_OK, DIAG_SYSTEM, 0u);
     }
-    return retVal;
+
+    PEX_GetFromLocalVariable();
 }
 
 static void PEX_CopyToLocalVariable(void) {
@@ -310,27 +361,26 @@ extern void PEX_Initialize(void) {
 }
 
 extern void PEX_Trigger(void) {
-    PEX_CopyToLocalVariable();
-    uint32_t current_time = OS_GetTickCount();
-
-    STD_RETURN_TYPE_e writeConfigDirectionReturn = PEX_WriteConfigDirection();
-    OS_DelayTaskUntil(&current_time, 2u);
-    STD_RETURN_TYPE_e writeConfigPolarityReturn = PEX_WriteConfigPolarity();
-    OS_DelayTaskUntil(&current_time, 2u);
-    STD_RETURN_TYPE_e readInputsReturn = PEX_ReadInputs();
-    OS_DelayTaskUntil(&current_time, 2u);
-    STD_RETURN_TYPE_e writeOutputsReturn = PEX_WriteOutputs();
-    OS_DelayTaskUntil(&current_time, 2u);
-
-    /* notify diag if one of these functions failed, but continue normally */
-    if ((writeConfigDirectionReturn == STD_NOT_OK) || (writeConfigPolarityReturn == STD_NOT_OK) ||
-        (readInputsReturn == STD_NOT_OK) || (writeOutputsReturn == STD_NOT_OK)) {
-        DIAG_Handler(DIAG_ID_I2C_PEX_ERROR, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u);
-    } else {
-        DIAG_Handler(DIAG_ID_I2C_PEX_ERROR, DIAG_EVENT_OK, DIAG_SYSTEM, 0u);
-    }
+    /* Start a new cycle only if all transactions of the previous one are completed */
+    if (pex_nrOfPendingTransactions == 0u) {
+        PEX_CopyToLocalVariable();
+        pex_transactionFailed = false;
+
+        for (uint8_t transaction = 0u; transaction < (uint8_t)PEX_NR_OF_TRANSACTIONS; transaction++) {
+            for (uint8_t i = 0u; i < PEX_NR_OF_PORT_EXPANDERS; i++) {
+                if (PEX_EnqueueTransaction((PEX_TRANSACTION_e)transaction, i) == STD_OK) {
+                    pex_nrOfPendingTransactions++;
+                } else {
+                    pex_transactionFailed = true;
+                }
+            }
+        }
 
-    PEX_GetFromLocalVariable();
+        /* No callback will finish the cycle if no transaction could be enqueued */
+        if (pex_nrOfPendingTransactions == 0u) {
+            PEX_FinishCycle();
+        }
+    }
 }
 
 extern void PEX_SetPin(uint8_t portExpander, uint8_t pin) {
@@ -43,7 +43,7 @@
  * @file    pex.h
  * @author  foxBMS Team
  * @date    2021-08-02 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  PEX
@@ -68,6 +68,9 @@
 #define PEX_PIN_HIGH (1u)
 /**@}*/
 
+/** I2C transactions that #PEX_Trigger() enqueues in one cycle of the I2C task */
+#define PEX_NR_OF_I2C_TRANSACTIONS_PER_CYCLE (4u * PEX_NR_OF_PORT_EXPANDERS)
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
@@ -134,6 +137,9 @@ extern void PEX_SetPinPolarityRetained(uint8_t portExpander, uint8_t pin);
  *          it in the local variable. It then applies this state to the devices
  *          via the I2C bus. It reads the pin input state via the I2C bus and
  *          writes it to the externally available port expander state.
+ *          The I2C transactions are enqueued and run by
+ *          #I2C_ProcessTransactionQueue(), the input state is updated when
+ *          the last transaction of the cycle is completed.
  */
 extern void PEX_Trigger(void);
 
@@ -43,7 +43,7 @@
  * @file    rtc.c
  * @author  foxBMS Team
  * @date    2021-02-22 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup DRIVERS
  * @prefix  RTC
@@ -58,11 +58,14 @@
 
 #include "database.h"
 #include "diag.h"
+#include "fassert.h"
 #include "foxmath.h"
 #include "fstd_types.h"
 #include "ftask.h"
 #include "i2c.h"
+#include "i2c_queue.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 /* AXIVION Disable Style MisraC2012-21.10: Time implementation is suitable fpr the application */
 #include <time.h>
@@ -75,6 +78,17 @@ typedef struct {
     uint16_t milliseconds;
 } RTC_SYSTEM_TIMER_EPOCH_s;
 
+/** queued I2C transactions of the battery low check, used as tags */
+typedef enum {
+    RTC_TRANSACTION_SET_CONTROL_3_ADDRESS, /*!< sets the address of the control_3 register */
+    RTC_TRANSACTION_READ_CONTROL_3,        /*!< reads the control_3 register */
+    RTC_NR_OF_TRANSACTIONS,                /*!< number of transactions of the battery low check */
+} RTC_TRANSACTION_e;
+
+FAS_STATIC_ASSERT(
+    ((uint32_t)RTC_NR_OF_TRANSACTIONS == RTC_NR_OF_I2C_TRANSACTIONS_PER_CYCLE),
+    "RTC_NR_OF_I2C_TRANSACTIONS_PER_CYCLE does not match the transactions enqueued per cycle");
+
 /*========== Static Constant and Variable Definitions =======================*/
 
 /* AXIVION Disable Style MisraC2012-1.2: i2c buffer must be put in shared RAM section if used with DMA and cache */
@@ -83,12 +97,18 @@ typedef struct {
 static uint8_t rtc_i2cWriteBuffer[RTC_MAX_I2C_TRANSACTION_SIZE_IN_BYTES] = {0};
 /** I2C buffer for read transactions with RTC */
 static uint8_t rtc_i2cReadBuffer[RTC_MAX_I2C_TRANSACTION_SIZE_IN_BYTES] = {0};
+/** I2C buffers of the queued battery low check, separate as they are used after #RTC_Trigger() returns */
+static uint8_t rtc_i2cBatteryLowCheckWriteBuffer[1u] = {RTC_REG_CONTROL_3_ADDR};
+static uint8_t rtc_i2cBatteryLowCheckReadBuffer[1u]  = {0};
 #pragma SET_DATA_SECTION()
 /* AXIVION Enable Style MisraC2012-1.2: only i2c buffer needs to be in the shared RAM section */
 
 /** Variable containing the RTC system time */
 static RTC_SYSTEM_TIMER_EPOCH_s rtc_SystemTime = {0};
 
+/** true if a transaction of the queued battery low check has failed */
+static bool rtc_batteryLowCheckFailed = false;
+
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
@@ -104,6 +124,7 @@ static void RTC_WriteTime(RTC_TIME_DATA_s rtcTime);
 static void RTC_SetOverCanMessage(void);
 static void RTC_AdjustTime(void);
 static void RTC_CheckBatteryLowVoltageAlert(void);
+static void RTC_BatteryLowCheckCallback(uint32_t tag, I2C_TRANSACTION_RESULT_e result);
 
 static void RTC_SetSystemTimeEpochFormat(time_t timeEpochFormat, uint16_t milliseconds);
 static RTC_SYSTEM_TIMER_EPOCH_s RTC_GetSystemTimeEpochFormat(void);
@@ -238,36 +259,74 @@ static void RTC_AdjustTime(void) {
 
 /**
  * @brief   Read bit for battery voltage low flag.
+ * @details The register address is set and the register is read with two
+ *          queued transactions, the flag is evaluated in
+ *          #RTC_BatteryLowCheckCallback().
  */
 static void RTC_CheckBatteryLowVoltageAlert(void) {
-    STD_RETURN_TYPE_e retValI2c = STD_OK;
-    STD_RETURN_TYPE_e retVal    = STD_OK;
-    uint8_t blfBit              = 0u; /* Battery Low Flag (BLF) */
-
+    STD_RETURN_TYPE_e retValI2c   = STD_OK;
+    I2C_TRANSACTION_s transaction = {
+        .type          = I2C_TRANSACTION_WRITE,
+        .pI2cInterface = RTC_I2C_INTERFACE,
+        .slaveAddress  = RTC_I2C_ADDRESS,
+        .nrBytesWrite  = 1u,
+        .pWriteData    = rtc_i2cBatteryLowCheckWriteBuffer,
+        .nrBytesRead   = 0u,
+        .pReadData     = NULL_PTR,
+        .timeout_ms    = I2C_TRANSACTION_NO_TIMEOUT,
+        .callback      = &RTC_BatteryLowCheckCallback,
+        .tag           = (uint32_t)RTC_TRANSACTION_SET_CONTROL_3_ADDRESS,
+    };
+
+    rtc_batteryLowCheckFailed = false;
     /* Set address to read from */
-    rtc_i2cWriteBuffer[0u] = RTC_REG_CONTROL_3_ADDR;
-    retValI2c              = I2C_Write(RTC_I2C_INTERFACE, RTC_I2C_ADDRESS, 1u, rtc_i2cWriteBuffer);
-    if (retValI2c == STD_NOT_OK) {
-        retVal = STD_NOT_OK;
+    retValI2c = I2C_EnqueueTransaction(&transaction);
+    if (retValI2c == STD_OK) {
+        /* Address set, read register data */
+        transaction.type         = I2C_TRANSACTION_READ;
+        transaction.nrBytesWrite = 0u;
+        transaction.pWriteData   = NULL_PTR;
+        transaction.nrBytesRead  = 1u;
+        transaction.pReadData    = rtc_i2cBatteryLowCheckReadBuffer;
+        transaction.tag          = (uint32_t)RTC_TRANSACTION_READ_CONTROL_3;
+        retValI2c                = I2C_EnqueueTransaction(&transaction);
     }
-    /* Address set, read register data */
-    retValI2c = I2C_Read(RTC_I2C_INTERFACE, RTC_I2C_ADDRESS, 1u, rtc_i2cReadBuffer);
+
     if (retValI2c == STD_NOT_OK) {
-        retVal = STD_NOT_OK;
+        /* The read transaction has not been enqueued: its callback will not report the result */
+        DIAG_Handler(DIAG_ID_I2C_RTC_ERROR, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u);
     }
+}
 
-    /* OSF bit is stored at position 7 in seconds register */
-    blfBit = (rtc_i2cReadBuffer[0u] & RTC_CTRL3_BATTERY_LOW_FLAG_BIT_MASK) >> RTC_CTRL3_BATTERY_LOW_FLAG_BIT_POSITION;
+/**
+ * @brief   Handles the completion of the transactions of the battery low check.
+ * @details The battery low flag is evaluated after the register has been read.
+ * @param   tag     transaction, see #RTC_TRANSACTION_e
+ * @param   result  result of the transaction
+ */
+static void RTC_BatteryLowCheckCallback(uint32_t tag, I2C_TRANSACTION_RESULT_e result) {
+    FAS_ASSERT(
+        (tag == (uint32_t)RTC_TRANSACTION_SET_CONTROL_3_ADDRESS) || (tag == (uint32_t)RTC_TRANSACTION_READ_CONTROL_3));
+    /* AXIVION Routine Generic-MissingParameterAssert: result: parameter accepts whole range */
+    if (result != I2C_TRANSACTION_SUCCESSFUL) {
+        rtc_batteryLowCheckFailed = true;
+    }
 
-    if (retVal == STD_NOT_OK) {
-        DIAG_Handler(DIAG_ID_I2C_RTC_ERROR, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u);
-    } else {
-        DIAG_Handler(DIAG_ID_I2C_RTC_ERROR, DIAG_EVENT_OK, DIAG_SYSTEM, 0u);
-        /* If I2C communication successful, check BLF bit */
-        if (blfBit != 0u) {
-            DIAG_Handler(DIAG_ID_RTC_BATTERY_LOW_ERROR, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u);
+    if (tag == (uint32_t)RTC_TRANSACTION_READ_CONTROL_3) {
+        /* BLF bit is stored in control_3 register */
+        const uint8_t blfBit = (rtc_i2cBatteryLowCheckReadBuffer[0u] & RTC_CTRL3_BATTERY_LOW_FLAG_BIT_MASK) >>
+                               RTC_CTRL3_BATTERY_LOW_FLAG_BIT_POSITION; /* Battery Low Flag (BLF) */
+
+        if (rtc_batteryLowCheckFailed == true) {
+            DIAG_Handler(DIAG_ID_I2C_RTC_ERROR, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u);
         } else {
-            DIAG_Handler(DIAG_ID_RTC_BATTERY_LOW_ERROR, DIAG_EVENT_OK, DIAG_SYSTEM, 0u);
+            DIAG_Handler(DIAG_ID_I2C_RTC_ERROR, DIAG_EVENT_OK, DIAG_SYSTEM, 0u);
+            /* If I2C communication successful, check BLF bit */
+            if (blfBit != 0u) {
+                DIAG_Handler(DIAG_ID_RTC_BATTERY_LOW_ERROR, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u);
+            } else {
+                DIAG_Handler(DIAG_ID_RTC_BATTERY_LOW_ERROR, DIAG_EVENT_OK, DIAG_SYSTEM, 0u);
+            }
         }
     }
 }
@@ -69,6 +69,9 @@
 /* I2C address of the RTC IC */
 #define RTC_I2C_ADDRESS (0x53u)
 
+/** I2C transactions that #RTC_Trigger() enqueues in one cycle of the I2C task */
+#define RTC_NR_OF_I2C_TRANSACTIONS_PER_CYCLE (2u)
+
 /** Time data of the RTC */
 typedef struct {
     uint8_t hundredthOfSeconds; /* [0-99] */
@@ -43,7 +43,7 @@
  * @file    database_cfg.c
  * @author  foxBMS Team
  * @date    2015-08-18 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup ENGINE_CONFIGURATION
  * @prefix  DATA
@@ -224,6 +224,21 @@ DATA_BASE_s data_database[] = {
     {(void *)(&data_blockAerosolSensor), sizeof(DATA_BLOCK_AEROSOL_SENSOR_s)},
 };
 
+const uint64_t data_subscriptions[DATA_SUBSCRIBER_E_MAX] = {
+    /* the AFE measurement validation needs both, base and redundancy measurement, but the redundancy is
+     * optional: therefore, every write access to one of these blocks triggers a validation */
+    [DATA_SUBSCRIBER_AFE_MEASUREMENT_VALIDATION] =
+        (DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CELL_VOLTAGE_BASE) |
+         DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CELL_VOLTAGE_REDUNDANCY0) |
+         DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CELL_TEMPERATURE_BASE) |
+         DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CELL_TEMPERATURE_REDUNDANCY0)),
+    /* the string voltage validation compares the current sensor measurement with the sum of the validated
+     * cell voltages: therefore, validated cell voltages trigger a validation, too */
+    [DATA_SUBSCRIBER_PACK_MEASUREMENT_VALIDATION] =
+        (DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CURRENT_SENSOR) |
+         DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CELL_VOLTAGE)),
+};
+
 /*========== Static Function Prototypes =====================================*/
 
 /*========== Static Function Implementations ================================*/
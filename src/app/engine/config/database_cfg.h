@@ -43,7 +43,7 @@
  * @file    database_cfg.h
  * @author  foxBMS Team
  * @date    2015-08-18 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup ENGINE_CONFIGURATION
  * @prefix  DATA
@@ -120,6 +120,25 @@ FAS_STATIC_ASSERT(
     "Maximum number of database entries exceeds UINT8_MAX; adapted length "
     "checking in DATA_Initialize and DATA_IterateOverDatabaseEntries");
 
+FAS_STATIC_ASSERT(
+    (int16_t)DATA_BLOCK_ID_MAX <= 64,
+    "Maximum number of database entries exceeds the width of the subscription bitmask (uint64_t)");
+
+/** bit of a data block in the subscription bitmask of a subscriber */
+#define DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(blockId) ((uint64_t)1u << (uint8_t)(blockId))
+
+/**
+ * @brief   subscribers that are notified when a subscribed data block is
+ *          written to the database
+ * @details The data blocks that a subscriber is notified about are configured
+ *          in #data_subscriptions.
+ */
+typedef enum {
+    DATA_SUBSCRIBER_AFE_MEASUREMENT_VALIDATION,  /*!< redundancy validation of the AFE measurements */
+    DATA_SUBSCRIBER_PACK_MEASUREMENT_VALIDATION, /*!< redundancy validation of the pack measurements */
+    DATA_SUBSCRIBER_E_MAX,                       /*!< number of subscribers */
+} DATA_SUBSCRIBER_e;
+
 /** data block header */
 typedef struct {
     DATA_BLOCK_ID_e uniqueId;   /*!< uniqueId of database entry */
@@ -127,6 +146,24 @@ typedef struct {
     uint32_t previousTimestamp; /*!< timestamp of previous database update */
 } DATA_BLOCK_HEADER_s;
 
+/**
+ * @brief   bits of a module word in the invalid flags of the cell voltages
+ * @details The invalid flags of a string are a contiguous bitmap with one word
+ *          per module and one bit per cell block. They can be counted, merged
+ *          and searched with the bitmap functions of foxmath.
+ */
+#define DATA_CELL_VOLTAGE_BITMAP_MASK (UINT64_MAX >> (64u - BS_NR_OF_CELL_BLOCKS_PER_MODULE))
+
+/** bits of a module word in the invalid flags of the cell temperatures */
+#define DATA_CELL_TEMPERATURE_BITMAP_MASK (UINT64_MAX >> (64u - BS_NR_OF_TEMP_SENSORS_PER_MODULE))
+
+FAS_STATIC_ASSERT(
+    (BS_NR_OF_CELL_BLOCKS_PER_MODULE > 0u) && (BS_NR_OF_CELL_BLOCKS_PER_MODULE <= 64u),
+    "The invalid flags of the cell blocks of a module have to fit into one uint64_t word");
+FAS_STATIC_ASSERT(
+    (BS_NR_OF_TEMP_SENSORS_PER_MODULE > 0u) && (BS_NR_OF_TEMP_SENSORS_PER_MODULE <= 16u),
+    "The invalid flags of the temperature sensors of a module have to fit into one uint16_t word");
+
 /** data block struct of cell voltage */
 typedef struct {
     /* This struct needs to be at the beginning of every database entry. During
@@ -386,6 +423,7 @@ typedef struct {
     bool pexI2cCommunicationError;          /*!< the I2C port expander does not work as expected */
     bool i2cRtcError;                       /*!< problem in I2C communication with RTC */
     bool framReadCrcError;                  /*!< false if read CRC matches with CRC of read data, true otherwise */
+    bool loadSpectrumResetError;            /*!< true: the stored load spectrum was corrupt and has been cleared */
     bool rtcClockIntegrityError;            /*!< RTC time integrity not guaranteed, because oscillator has stopped */
     bool rtcBatteryLowError;                /*!< RTC battery voltage is low */
     bool taskEngineTimingViolationError;    /*!< timing violation in engine task */
@@ -644,6 +682,12 @@ typedef struct {
 /** array for the database */
 extern DATA_BASE_s data_database[DATA_BLOCK_ID_MAX];
 
+/**
+ * @brief   data blocks that each subscriber is notified about when they are
+ *          written (bitmask built with #DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK)
+ */
+extern const uint64_t data_subscriptions[DATA_SUBSCRIBER_E_MAX];
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
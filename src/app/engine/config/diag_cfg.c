@@ -43,7 +43,7 @@
  * @file    diag_cfg.c
  * @author  foxBMS Team
  * @date    2019-11-28 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup ENGINE_CONFIGURATION
  * @prefix  DIAG
@@ -88,15 +88,30 @@
 
 #include "database.h"
 #include "diag_cbs.h"
+#include "os.h"
 
+#include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 /*========== Macros and Definitions =========================================*/
 /** value of #DIAG_ID_MAX (as a define for the pre-processor) */
-#define DIAG_ID_MAX_FOR_INIT (85u)
+#define DIAG_ID_MAX_FOR_INIT (86u)
 
 FAS_STATIC_ASSERT(DIAG_ID_MAX_FOR_INIT == (uint16_t)DIAG_ID_MAX, "Both values need to be identical.");
 
+FAS_STATIC_ASSERT(DIAG_UPDATE_FLAGS_PERIOD_ms > 0u, "The flags need to be updated periodically.");
+FAS_STATIC_ASSERT(
+    (DIAG_FLAG_HEARTBEAT_PERIOD_ms % DIAG_UPDATE_FLAGS_PERIOD_ms) == 0u,
+    "The heartbeat period has to be a multiple of the update period.");
+
+/** local copy of a flag block and its state as it has been written to the database the last time */
+typedef struct {
+    void *pTable;       /*!< local copy that is modified by the diagnosis callbacks */
+    void *pPublished;   /*!< state of the flag block at the last write to the database */
+    uint32_t blockSize; /*!< size of the flag block in bytes */
+} DIAG_FLAG_BLOCK_s;
+
 /*========== Static Constant and Variable Definitions =======================*/
 /** local copy of the #DATA_BLOCK_ERROR_STATE_s table */
 static DATA_BLOCK_ERROR_STATE_s diag_tableErrorFlags = {.header.uniqueId = DATA_BLOCK_ID_ERROR_STATE};
@@ -117,7 +132,52 @@ const DIAG_DATABASE_SHIM_s diag_kDatabaseShim = {
     .pTableMsl   = &diag_tableMslFlags,
 };
 
+/**@{*/
+/** state of the flag blocks at the last write to the database */
+static DATA_BLOCK_ERROR_STATE_s diag_publishedErrorFlags = {.header.uniqueId = DATA_BLOCK_ID_ERROR_STATE};
+static DATA_BLOCK_MOL_FLAG_s diag_publishedMolFlags      = {.header.uniqueId = DATA_BLOCK_ID_MOL_FLAG};
+static DATA_BLOCK_RSL_FLAG_s diag_publishedRslFlags      = {.header.uniqueId = DATA_BLOCK_ID_RSL_FLAG};
+static DATA_BLOCK_MSL_FLAG_s diag_publishedMslFlags      = {.header.uniqueId = DATA_BLOCK_ID_MSL_FLAG};
+/**@}*/
+
+/** flag blocks in the order of #DIAG_FLAG_BLOCK_e */
+static const DIAG_FLAG_BLOCK_s diag_kFlagBlocks[DIAG_FLAG_BLOCK_E_MAX] = {
+    {&diag_tableErrorFlags, &diag_publishedErrorFlags, sizeof(DATA_BLOCK_ERROR_STATE_s)},
+    {&diag_tableMolFlags, &diag_publishedMolFlags, sizeof(DATA_BLOCK_MOL_FLAG_s)},
+    {&diag_tableRslFlags, &diag_publishedRslFlags, sizeof(DATA_BLOCK_RSL_FLAG_s)},
+    {&diag_tableMslFlags, &diag_publishedMslFlags, sizeof(DATA_BLOCK_MSL_FLAG_s)},
+};
+
+/** incremented by #DIAG_NotifyFlagModification after the execution of a diagnosis callback */
+static volatile uint32_t diag_flagModificationCounter = 0u;
+/** value of #diag_flagModificationCounter at the last call of #DIAG_UpdateFlags */
+static uint32_t diag_lastFlagModificationCounter = 0u;
+/** true if all flag blocks have to be written with the next call of #DIAG_UpdateFlags */
+static bool diag_publishAllFlagBlocks = true;
+/** time since all flag blocks have been written to the database */
+static uint32_t diag_timeSinceHeartbeat_ms = 0u;
+/** statistics of the publication of the flag blocks */
+static DIAG_FLAG_PUBLICATION_STATISTICS_s diag_flagPublicationStatistics = {0};
+
 /*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   checks if the content of a flag block differs from the state at
+ *          its last write to the database
+ * @details The header is not compared, as the database updates the
+ *          timestamps in the header of the local copy.
+ * @param   flagBlock flag block that is checked
+ * @return  true if the flag block changed, otherwise false
+ */
+static bool DIAG_HasFlagBlockChanged(DIAG_FLAG_BLOCK_e flagBlock);
+
+/**
+ * @brief   writes the passed flag blocks with one database access
+ * @param   pTables             local copies of the flag blocks
+ * @param   nrOfTables          number of passed flag blocks
+ * @return  #STD_OK if the write request has been sent to the database,
+ *          otherwise #STD_NOT_OK
+ */
+static STD_RETURN_TYPE_e DIAG_WriteFlagBlocks(void *pTables[], uint8_t nrOfTables);
 
 /*========== Extern Constant and Variable Definitions =======================*/
 /** variable tracking the state of the diag channels */
@@ -230,6 +290,7 @@ DIAG_ID_CFG_s diag_diagnosisIdConfiguration[] = {
     {DIAG_ID_RTC_BATTERY_LOW_ERROR, DIAG_ERROR_SENSITIVITY_HIGH, DIAG_INFO, DIAG_NO_DELAY, DIAG_RECORDING_ENABLED, DIAG_EVALUATION_ENABLED, DIAG_Rtc},
 
     {DIAG_ID_FRAM_READ_CRC_ERROR, DIAG_ERROR_SENSITIVITY_HIGH, DIAG_INFO, DIAG_NO_DELAY, DIAG_RECORDING_ENABLED, DIAG_EVALUATION_ENABLED, DIAG_FramError},
+    {DIAG_ID_LOAD_SPECTRUM_RESET, DIAG_ERROR_SENSITIVITY_HIGH, DIAG_INFO, DIAG_NO_DELAY, DIAG_RECORDING_ENABLED, DIAG_EVALUATION_ENABLED, DIAG_FramError},
 
     {DIAG_ID_ALERT_MODE, DIAG_ERROR_SENSITIVITY_HIGH, DIAG_FATAL_ERROR, DIAG_NO_DELAY, DIAG_RECORDING_ENABLED, DIAG_EVALUATION_ENABLED, DIAG_AlertFlag},
 
@@ -245,12 +306,107 @@ DIAG_DEV_s diag_device = {
 };
 
 /*========== Static Function Implementations ================================*/
+static bool DIAG_HasFlagBlockChanged(DIAG_FLAG_BLOCK_e flagBlock) {
+    FAS_ASSERT(flagBlock < DIAG_FLAG_BLOCK_E_MAX);
+    const DIAG_FLAG_BLOCK_s *const kpkFlagBlock = &diag_kFlagBlocks[flagBlock];
+    const uint32_t headerSize                   = (uint32_t)sizeof(DATA_BLOCK_HEADER_s);
+    /* AXIVION Next Codeline Style MisraC2012-11.5: the flag blocks are accessed generically as bytes */
+    const uint8_t *pkTable = (const uint8_t *)kpkFlagBlock->pTable;
+    /* AXIVION Next Codeline Style MisraC2012-11.5: the flag blocks are accessed generically as bytes */
+    const uint8_t *pkPublished = (const uint8_t *)kpkFlagBlock->pPublished;
+    return memcmp(&pkTable[headerSize], &pkPublished[headerSize], kpkFlagBlock->blockSize - headerSize) != 0;
+}
+
+static STD_RETURN_TYPE_e DIAG_WriteFlagBlocks(void *pTables[], uint8_t nrOfTables) {
+    FAS_ASSERT(pTables != NULL_PTR);
+    FAS_ASSERT(nrOfTables <= (uint8_t)DIAG_FLAG_BLOCK_E_MAX);
+    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+    switch (nrOfTables) {
+        case 1u:
+            retVal = DATA_WRITE_DATA(pTables[0u]);
+            break;
+        case 2u:
+            retVal = DATA_WRITE_DATA(pTables[0u], pTables[1u]);
+            break;
+        case 3u:
+            retVal = DATA_WRITE_DATA(pTables[0u], pTables[1u], pTables[2u]);
+            break;
+        case 4u:
+            retVal = DATA_WRITE_DATA(pTables[0u], pTables[1u], pTables[2u], pTables[3u]);
+            break;
+        default:
+            /* nothing to write */
+            retVal = STD_OK;
+            break;
+    }
+    return retVal;
+}
 
 /*========== Extern Function Implementations ================================*/
+void DIAG_NotifyFlagModification(void) {
+    /* the increment is a read-modify-write of the counter, that is called from several tasks */
+    OS_EnterTaskCritical();
+    diag_flagModificationCounter++;
+    OS_ExitTaskCritical();
+}
+
 void DIAG_UpdateFlags(void) {
-    DATA_WRITE_DATA(&diag_tableErrorFlags, &diag_tableMolFlags, &diag_tableRslFlags, &diag_tableMslFlags);
+    diag_timeSinceHeartbeat_ms += DIAG_UPDATE_FLAGS_PERIOD_ms;
+    const bool isHeartbeat =
+        (diag_publishAllFlagBlocks == true) || (diag_timeSinceHeartbeat_ms >= DIAG_FLAG_HEARTBEAT_PERIOD_ms);
+
+    /* the counter is read before the flag blocks are compared: a modification
+     * during the comparison is detected with the next call */
+    const uint32_t modificationCounter = diag_flagModificationCounter;
+    const bool wasModified             = (modificationCounter != diag_lastFlagModificationCounter);
+    diag_lastFlagModificationCounter   = modificationCounter;
+
+    void *pTablesToWrite[DIAG_FLAG_BLOCK_E_MAX] = {NULL_PTR};
+    uint8_t nrOfTablesToWrite                   = 0u;
+    for (uint8_t flagBlock = 0u; flagBlock < (uint8_t)DIAG_FLAG_BLOCK_E_MAX; flagBlock++) {
+        bool hasChanged = false;
+        if (wasModified == true) {
+            hasChanged = DIAG_HasFlagBlockChanged((DIAG_FLAG_BLOCK_e)flagBlock);
+        }
+        if (hasChanged == true) {
+            diag_flagPublicationStatistics.generation[flagBlock]++;
+        }
+        if ((hasChanged == true) || (isHeartbeat == true)) {
+            (void)memcpy(
+                diag_kFlagBlocks[flagBlock].pPublished,
+                diag_kFlagBlocks[flagBlock].pTable,
+                diag_kFlagBlocks[flagBlock].blockSize);
+            pTablesToWrite[nrOfTablesToWrite] = diag_kFlagBlocks[flagBlock].pTable;
+            nrOfTablesToWrite++;
+        } else {
+            diag_flagPublicationStatistics.skippedBlocks++;
+        }
+    }
+
+    if (nrOfTablesToWrite > 0u) {
+        diag_flagPublicationStatistics.publishedBlocks += nrOfTablesToWrite;
+        diag_flagPublicationStatistics.databaseWrites++;
+        if (isHeartbeat == true) {
+            diag_flagPublicationStatistics.heartbeats++;
+            diag_timeSinceHeartbeat_ms = 0u;
+        }
+        /* if the write request could not be sent, all flag blocks are written with the next call */
+        diag_publishAllFlagBlocks = (DIAG_WriteFlagBlocks(pTablesToWrite, nrOfTablesToWrite) != STD_OK);
+    }
+}
+
+void DIAG_GetFlagPublicationStatistics(DIAG_FLAG_PUBLICATION_STATISTICS_s *pStatistics) {
+    FAS_ASSERT(pStatistics != NULL_PTR);
+    *pStatistics = diag_flagPublicationStatistics;
 }
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
+extern void TEST_DIAG_ResetFlagPublication(void) {
+    diag_flagModificationCounter     = 0u;
+    diag_lastFlagModificationCounter = 0u;
+    diag_publishAllFlagBlocks        = true;
+    diag_timeSinceHeartbeat_ms       = 0u;
+    (void)memset(&diag_flagPublicationStatistics, 0, sizeof(DIAG_FLAG_PUBLICATION_STATISTICS_s));
+}
 #endif
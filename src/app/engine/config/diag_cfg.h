@@ -43,7 +43,7 @@
  * @file    diag_cfg.h
  * @author  foxBMS Team
  * @date    2019-11-28 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup ENGINE_CONFIGURATION
  * @prefix  DIAG
@@ -161,6 +161,15 @@
 /** Maximum number of the same errors that are logged */
 #define DIAG_MAX_ENTRIES_OF_ERROR (5)
 
+/** period in ms in which #DIAG_UpdateFlags is called */
+#define DIAG_UPDATE_FLAGS_PERIOD_ms (1u)
+/**
+ * period in ms after which the flag blocks are written to the database even
+ * if they did not change, so that the timestamps of the database entries stay
+ * fresh
+ */
+#define DIAG_FLAG_HEARTBEAT_PERIOD_ms (100u)
+
 /** composite type for storing and passing on the local database table handles */
 typedef struct {
     DATA_BLOCK_ERROR_STATE_s *pTableError; /*!< database table with error states */
@@ -172,6 +181,24 @@ typedef struct {
 /** variable for storing and passing on the local database table handles */
 extern const DIAG_DATABASE_SHIM_s diag_kDatabaseShim;
 
+/** flag blocks that are published by #DIAG_UpdateFlags */
+typedef enum {
+    DIAG_FLAG_BLOCK_ERROR_STATE, /*!< #DATA_BLOCK_ERROR_STATE_s */
+    DIAG_FLAG_BLOCK_MOL,         /*!< #DATA_BLOCK_MOL_FLAG_s */
+    DIAG_FLAG_BLOCK_RSL,         /*!< #DATA_BLOCK_RSL_FLAG_s */
+    DIAG_FLAG_BLOCK_MSL,         /*!< #DATA_BLOCK_MSL_FLAG_s */
+    DIAG_FLAG_BLOCK_E_MAX,       /*!< number of flag blocks */
+} DIAG_FLAG_BLOCK_e;
+
+/** statistics of the publication of the flag blocks */
+typedef struct {
+    uint32_t generation[DIAG_FLAG_BLOCK_E_MAX]; /*!< number of detected changes per flag block */
+    uint32_t publishedBlocks;                   /*!< number of flag blocks written to the database */
+    uint32_t skippedBlocks;                     /*!< number of unchanged flag blocks not written to the database */
+    uint32_t databaseWrites;                    /*!< number of write requests sent to the database queue */
+    uint32_t heartbeats;                        /*!< number of publications due to the heartbeat */
+} DIAG_FLAG_PUBLICATION_STATISTICS_s;
+
 /** list of diag IDs */
 typedef enum {
     DIAG_ID_FLASHCHECKSUM,     /*!< the checksum of the flashed software could not be validated */
@@ -257,6 +284,7 @@ typedef enum {
     DIAG_ID_RTC_CLOCK_INTEGRITY_ERROR,         /*!< clock integrity not garanteed error in RTC IC */
     DIAG_ID_RTC_BATTERY_LOW_ERROR,             /*!< RTC IC battery low flag set */
     DIAG_ID_FRAM_READ_CRC_ERROR,               /*!< CRC does not match when reading from the FRAM */
+    DIAG_ID_LOAD_SPECTRUM_RESET,               /*!< the stored load spectrum was corrupt and has been cleared */
     DIAG_ID_ALERT_MODE,    /*!< Critical error while opening the contactors. Fuse has not triggered */
     DIAG_ID_AEROSOL_ALERT, /*!< high aerosol concentration detected */
     DIAG_ID_MAX,           /*!< MAX indicator - do not change */
@@ -363,14 +391,36 @@ extern DIAG_DEV_s diag_device;
 extern DIAG_ID_CFG_s diag_diagnosisIdConfiguration[DIAG_ID_MAX];
 
 /*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   notifies that the local copies of the flag blocks may have been
+ *          modified
+ * @details Has to be called after a diagnosis callback has been executed, as
+ *          the callbacks write the flags into the tables of
+ *          #diag_kDatabaseShim.
+ */
+extern void DIAG_NotifyFlagModification(void);
+
 /**
  * @brief   update function for diagnosis flags
- * @details TODO
+ * @details Has to be called every #DIAG_UPDATE_FLAGS_PERIOD_ms.
+ *          The flag blocks are only compared to their last published state
+ *          if a modification has been notified by
+ *          #DIAG_NotifyFlagModification since the last call. Only the flag
+ *          blocks that changed are written to the database, all flag blocks
+ *          are written on the first call and then every
+ *          #DIAG_FLAG_HEARTBEAT_PERIOD_ms.
  */
 extern void DIAG_UpdateFlags(void);
 
+/**
+ * @brief   copies the statistics of the publication of the flag blocks
+ * @param   pStatistics pointer where the statistics are copied to
+ */
+extern void DIAG_GetFlagPublicationStatistics(DIAG_FLAG_PUBLICATION_STATISTICS_s *pStatistics);
+
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
+extern void TEST_DIAG_ResetFlagPublication(void);
 #endif
 
 #endif /* FOXBMS__DIAG_CFG_H_ */
@@ -43,7 +43,7 @@
  * @file    database.c
  * @author  foxBMS Team
  * @date    2015-08-18 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup ENGINE
  * @prefix  DATA
@@ -109,6 +109,21 @@ static const DATA_BASE_HEADER_s data_baseHeader = {
  */
 static uint8_t data_uniqueIdToDatabaseEntry[DATA_BLOCK_ID_MAX] = {0};
 
+/**
+ * @brief   pending write notifications of each subscriber
+ * @details Set by the database task when a subscribed data block is written
+ *          and cleared by #DATA_ConsumeWriteNotifications().
+ */
+static uint64_t data_pendingWriteNotifications[DATA_SUBSCRIBER_E_MAX] = {0u};
+
+/**
+ * @brief   number of write accesses to each data block
+ * @details Incremented by the database task after a data block has been
+ *          written and compared by #DATA_ReturnDataBlock() with the version of
+ *          a lent data block. Wrap-around is intended.
+ */
+static volatile uint32_t data_writeVersion[DATA_BLOCK_ID_MAX] = {0u};
+
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
@@ -127,6 +142,16 @@ static void DATA_CopyData(
     void *pDatabaseStruct,
     void *pPassedDataStruct);
 
+/**
+ * @brief   Marks a written data block as pending for all subscribers of this
+ *          data block
+ * @details Called by the database task, which has the highest priority of all
+ *          tasks and can therefore not be interrupted by a subscriber while
+ *          updating the notifications.
+ * @param[in]   blockId     ID of the data block that has been written
+ */
+static void DATA_PublishWriteAccess(DATA_BLOCK_ID_e blockId);
+
 /*========== Static Function Implementations ================================*/
 static STD_RETURN_TYPE_e DATA_AccessDatabaseEntries(
     DATA_BLOCK_ACCESS_TYPE_e accessType,
@@ -196,6 +221,14 @@ static void DATA_CopyData(
     }
 }
 
+static void DATA_PublishWriteAccess(DATA_BLOCK_ID_e blockId) {
+    FAS_ASSERT(blockId < DATA_BLOCK_ID_MAX);
+    const uint64_t blockMask = DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(blockId);
+    for (uint8_t subscriber = 0u; subscriber < (uint8_t)DATA_SUBSCRIBER_E_MAX; subscriber++) {
+        data_pendingWriteNotifications[subscriber] |= (data_subscriptions[subscriber] & blockMask);
+    }
+}
+
 static void DATA_IterateOverDatabaseEntries(const DATA_QUEUE_MESSAGE_s *kpReceiveMessage) {
     FAS_ASSERT(kpReceiveMessage != NULL_PTR);
     for (uint8_t queueEntry = 0u; queueEntry < DATA_MAX_ENTRIES_PER_ACCESS; queueEntry++) {
@@ -221,6 +254,10 @@ static void DATA_IterateOverDatabaseEntries(const DATA_QUEUE_MESSAGE_s *kpReceiv
             uint32_t dataLength = data_baseHeader.pDatabase[entryIndex].dataLength;
 
             DATA_CopyData(accessType, dataLength, pDatabaseStruct, pPassedDataStruct);
+            if (accessType == DATA_WRITE_ACCESS) {
+                data_writeVersion[uniqueId]++;
+                DATA_PublishWriteAccess(kpHeader->uniqueId);
+            }
         }
     }
 }
@@ -380,6 +417,39 @@ extern void DATA_ExecuteDataBist(void) {
     FAS_ASSERT(dummyReadTable.member2 == dummyWriteTable.member2);
 }
 
+extern uint64_t DATA_ConsumeWriteNotifications(DATA_SUBSCRIBER_e subscriber) {
+    FAS_ASSERT(subscriber < DATA_SUBSCRIBER_E_MAX);
+    /* the database task must not publish between reading and clearing the notifications */
+    OS_EnterTaskCritical();
+    const uint64_t writtenBlocks               = data_pendingWriteNotifications[subscriber];
+    data_pendingWriteNotifications[subscriber] = 0u;
+    OS_ExitTaskCritical();
+    return writtenBlocks;
+}
+
+extern void DATA_BorrowDataBlock(DATA_BLOCK_ID_e blockId, DATA_READ_VIEW_s *pView) {
+    FAS_ASSERT(blockId < DATA_BLOCK_ID_MAX);
+    FAS_ASSERT(pView != NULL_PTR);
+    /* read the version before the consumer accesses the database entry */
+    pView->version     = data_writeVersion[blockId];
+    pView->blockId     = blockId;
+    pView->pkDataBlock = data_baseHeader.pDatabase[data_uniqueIdToDatabaseEntry[blockId]].pDatabaseEntry;
+    pView->dataLength  = data_baseHeader.pDatabase[data_uniqueIdToDatabaseEntry[blockId]].dataLength;
+}
+
+extern STD_RETURN_TYPE_e DATA_ReturnDataBlock(const DATA_READ_VIEW_s *const kpkView) {
+    FAS_ASSERT(kpkView != NULL_PTR);
+    FAS_ASSERT(kpkView->blockId < DATA_BLOCK_ID_MAX);
+    STD_RETURN_TYPE_e retval = STD_NOT_OK;
+    if (data_writeVersion[kpkView->blockId] == kpkView->version) {
+        retval = STD_OK;
+    }
+    return retval;
+}
+
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
+extern void TEST_DATA_PublishWriteAccess(DATA_BLOCK_ID_e blockId) {
+    DATA_PublishWriteAccess(blockId);
+}
 #endif
@@ -43,7 +43,7 @@
  * @file    database.h
  * @author  foxBMS Team
  * @date    2015-08-18 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup ENGINE
  * @prefix  DATA
@@ -122,6 +122,25 @@ typedef struct {
     void *pDatabaseEntry[DATA_MAX_ENTRIES_PER_ACCESS]; /*!< reference by general pointer */
 } DATA_QUEUE_MESSAGE_s;
 
+/**
+ * Maximum number of times a consumer evaluates a borrowed data block before
+ * it accepts the result of an evaluation, during which the data block has
+ * been written (see #DATA_ReturnDataBlock())
+ */
+#define DATA_MAXIMUM_BORROW_ATTEMPTS (3u)
+
+/**
+ * @brief   read-only view of a database entry that is lent to a consumer
+ * @details The view is created by #DATA_BorrowDataBlock() and is only valid
+ *          until it is handed back by #DATA_ReturnDataBlock().
+ */
+typedef struct {
+    const void *pkDataBlock; /*!< database entry, must be casted to the type of the data block */
+    DATA_BLOCK_ID_e blockId; /*!< ID of the lent data block */
+    uint32_t dataLength;     /*!< size of the database entry in bytes */
+    uint32_t version;        /*!< number of write accesses to the data block when it has been lent */
+} DATA_READ_VIEW_s;
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
@@ -273,8 +292,57 @@ extern STD_RETURN_TYPE_e DATA_Read4DataBlocks(
  */
 extern void DATA_ExecuteDataBist(void);
 
+/**
+ * @brief   Returns and clears the pending write notifications of a subscriber
+ * @details Every write access to a data block that is configured for the
+ *          subscriber in #data_subscriptions marks the data block as written
+ *          for this subscriber. This function returns the marked data blocks
+ *          since its previous call and clears them, so that a subscriber can
+ *          process fresh data exactly once instead of polling periodically.
+ * @param[in]   subscriber  subscriber whose notifications are requested
+ * @return  bitmask of the subscribed data blocks that have been written since
+ *          the previous call (see #DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK), 0 if
+ *          none has been written
+ */
+extern uint64_t DATA_ConsumeWriteNotifications(DATA_SUBSCRIBER_e subscriber);
+
+/**
+ * @brief   Lends a database entry for read-only access without copying it
+ * @details Instead of copying a data block into a local table of the consumer
+ *          (see #DATA_READ_DATA()), the consumer accesses the database entry
+ *          itself through pView->pkDataBlock. The database task may write the
+ *          data block while it is lent, as it has a higher priority than all
+ *          consumers. Every write access to a data block increments its
+ *          version, so that #DATA_ReturnDataBlock() can report whether the
+ *          consumer has seen one consistent state of the data block. A
+ *          consumer that needs a consistent state evaluates the data block
+ *          again (at most #DATA_MAXIMUM_BORROW_ATTEMPTS times), therefore the
+ *          evaluation must not have side effects until the view has been
+ *          returned successfully.
+ * @warning Do not borrow data blocks in an interrupt service routine or a task
+ *          with a higher priority than the database task, as the version of
+ *          the data block does not detect writes that are not processed by
+ *          the database task.
+ * @param[in]   blockId ID of the data block to be lent
+ * @param[out]  pView   view of the lent database entry
+ */
+extern void DATA_BorrowDataBlock(DATA_BLOCK_ID_e blockId, DATA_READ_VIEW_s *pView);
+
+/**
+ * @brief   Hands back a database entry that has been lent by
+ *          #DATA_BorrowDataBlock()
+ * @details The view must not be used after it has been returned. As this is
+ *          an external function, the compiler can not move the accesses to
+ *          the lent database entry behind the version check.
+ * @param[in]   kpkView view that has been created by #DATA_BorrowDataBlock()
+ * @return  #STD_OK if the data block has not been written while it was lent,
+ *          otherwise #STD_NOT_OK
+ */
+extern STD_RETURN_TYPE_e DATA_ReturnDataBlock(const DATA_READ_VIEW_s *const kpkView);
+
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
+extern void TEST_DATA_PublishWriteAccess(DATA_BLOCK_ID_e blockId);
 #endif
 
 #endif /* FOXBMS__DATABASE_H_ */
@@ -43,7 +43,7 @@
  * @file    database_helper.c
  * @author  foxBMS Team
  * @date    2021-05-05 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup ENGINE
  * @prefix  DATA
@@ -54,6 +54,8 @@
  */
 
 /*========== Includes =======================================================*/
+#include "general.h"
+
 #include "database_helper.h"
 
 #include "battery_system_cfg.h"
@@ -64,9 +66,192 @@
 
 /*========== Macros and Definitions =========================================*/
 
+FAS_STATIC_ASSERT(
+    (DATA_NR_OF_CELL_BLOCKS <= (uint32_t)UINT16_MAX),
+    "This code assumes that the linear index of a cell block fits into uint16_t");
+
+/**
+ * Internal macros that generate the initializers of the topology lookup
+ * tables. The element macro f(s, m, n) is expanded for every cell block
+ * (temperature sensor) n of every module m of every string s, i.e., in the
+ * same order as the database stores the values. Do not use outside.
+ * @{
+ */
+/* AXIVION Disable Style Generic-NoUnsafeMacro MisraC2012Directive-4.9: Due to the nature of these macros
+   it is impossible to wrap the generated initializer lists in parentheses. */
+#define DATA_POSITION(s, m, n) {(uint8_t)(s), (uint8_t)(m), (uint8_t)(n)}
+/* the temperature sensors of a module are distributed evenly over its cell blocks */
+#define DATA_TEMPERATURE_SENSOR_OF_CELL_BLOCK(s, m, n)                                              \
+    ((uint16_t)(((((s) * BS_NR_OF_MODULES_PER_STRING) + (m)) * BS_NR_OF_TEMP_SENSORS_PER_MODULE) + \
+                (((n) * BS_NR_OF_TEMP_SENSORS_PER_MODULE) / BS_NR_OF_CELL_BLOCKS_PER_MODULE)))
+
+#define DATA_NUMBERS_U1u(f, s, m)  f(s, m, 0u)
+#define DATA_NUMBERS_U2u(f, s, m)  DATA_NUMBERS_U1u(f, s, m), f(s, m, 1u)
+#define DATA_NUMBERS_U3u(f, s, m)  DATA_NUMBERS_U2u(f, s, m), f(s, m, 2u)
+#define DATA_NUMBERS_U4u(f, s, m)  DATA_NUMBERS_U3u(f, s, m), f(s, m, 3u)
+#define DATA_NUMBERS_U5u(f, s, m)  DATA_NUMBERS_U4u(f, s, m), f(s, m, 4u)
+#define DATA_NUMBERS_U6u(f, s, m)  DATA_NUMBERS_U5u(f, s, m), f(s, m, 5u)
+#define DATA_NUMBERS_U7u(f, s, m)  DATA_NUMBERS_U6u(f, s, m), f(s, m, 6u)
+#define DATA_NUMBERS_U8u(f, s, m)  DATA_NUMBERS_U7u(f, s, m), f(s, m, 7u)
+#define DATA_NUMBERS_U9u(f, s, m)  DATA_NUMBERS_U8u(f, s, m), f(s, m, 8u)
+#define DATA_NUMBERS_U10u(f, s, m) DATA_NUMBERS_U9u(f, s, m), f(s, m, 9u)
+#define DATA_NUMBERS_U11u(f, s, m) DATA_NUMBERS_U10u(f, s, m), f(s, m, 10u)
+#define DATA_NUMBERS_U12u(f, s, m) DATA_NUMBERS_U11u(f, s, m), f(s, m, 11u)
+#define DATA_NUMBERS_U13u(f, s, m) DATA_NUMBERS_U12u(f, s, m), f(s, m, 12u)
+#define DATA_NUMBERS_U14u(f, s, m) DATA_NUMBERS_U13u(f, s, m), f(s, m, 13u)
+#define DATA_NUMBERS_U15u(f, s, m) DATA_NUMBERS_U14u(f, s, m), f(s, m, 14u)
+#define DATA_NUMBERS_U16u(f, s, m) DATA_NUMBERS_U15u(f, s, m), f(s, m, 15u)
+#define DATA_NUMBERS_U17u(f, s, m) DATA_NUMBERS_U16u(f, s, m), f(s, m, 16u)
+#define DATA_NUMBERS_U18u(f, s, m) DATA_NUMBERS_U17u(f, s, m), f(s, m, 17u)
+#define DATA_NUMBERS_U19u(f, s, m) DATA_NUMBERS_U18u(f, s, m), f(s, m, 18u)
+#define DATA_NUMBERS_U20u(f, s, m) DATA_NUMBERS_U19u(f, s, m), f(s, m, 19u)
+#define DATA_NUMBERS_U21u(f, s, m) DATA_NUMBERS_U20u(f, s, m), f(s, m, 20u)
+#define DATA_NUMBERS_U22u(f, s, m) DATA_NUMBERS_U21u(f, s, m), f(s, m, 21u)
+#define DATA_NUMBERS_U23u(f, s, m) DATA_NUMBERS_U22u(f, s, m), f(s, m, 22u)
+#define DATA_NUMBERS_U24u(f, s, m) DATA_NUMBERS_U23u(f, s, m), f(s, m, 23u)
+#define DATA_NUMBERS_U25u(f, s, m) DATA_NUMBERS_U24u(f, s, m), f(s, m, 24u)
+#define DATA_NUMBERS_U26u(f, s, m) DATA_NUMBERS_U25u(f, s, m), f(s, m, 25u)
+#define DATA_NUMBERS_U27u(f, s, m) DATA_NUMBERS_U26u(f, s, m), f(s, m, 26u)
+#define DATA_NUMBERS_U28u(f, s, m) DATA_NUMBERS_U27u(f, s, m), f(s, m, 27u)
+#define DATA_NUMBERS_U29u(f, s, m) DATA_NUMBERS_U28u(f, s, m), f(s, m, 28u)
+#define DATA_NUMBERS_U30u(f, s, m) DATA_NUMBERS_U29u(f, s, m), f(s, m, 29u)
+#define DATA_NUMBERS_U31u(f, s, m) DATA_NUMBERS_U30u(f, s, m), f(s, m, 30u)
+#define DATA_NUMBERS_U32u(f, s, m) DATA_NUMBERS_U31u(f, s, m), f(s, m, 31u)
+#define DATA_NUMBERS_U33u(f, s, m) DATA_NUMBERS_U32u(f, s, m), f(s, m, 32u)
+#define DATA_NUMBERS_U34u(f, s, m) DATA_NUMBERS_U33u(f, s, m), f(s, m, 33u)
+#define DATA_NUMBERS_U35u(f, s, m) DATA_NUMBERS_U34u(f, s, m), f(s, m, 34u)
+#define DATA_NUMBERS_U36u(f, s, m) DATA_NUMBERS_U35u(f, s, m), f(s, m, 35u)
+#define DATA_NUMBERS_U37u(f, s, m) DATA_NUMBERS_U36u(f, s, m), f(s, m, 36u)
+#define DATA_NUMBERS_U38u(f, s, m) DATA_NUMBERS_U37u(f, s, m), f(s, m, 37u)
+#define DATA_NUMBERS_U39u(f, s, m) DATA_NUMBERS_U38u(f, s, m), f(s, m, 38u)
+#define DATA_NUMBERS_U40u(f, s, m) DATA_NUMBERS_U39u(f, s, m), f(s, m, 39u)
+#define DATA_NUMBERS_U41u(f, s, m) DATA_NUMBERS_U40u(f, s, m), f(s, m, 40u)
+#define DATA_NUMBERS_U42u(f, s, m) DATA_NUMBERS_U41u(f, s, m), f(s, m, 41u)
+#define DATA_NUMBERS_U43u(f, s, m) DATA_NUMBERS_U42u(f, s, m), f(s, m, 42u)
+#define DATA_NUMBERS_U44u(f, s, m) DATA_NUMBERS_U43u(f, s, m), f(s, m, 43u)
+#define DATA_NUMBERS_U45u(f, s, m) DATA_NUMBERS_U44u(f, s, m), f(s, m, 44u)
+#define DATA_NUMBERS_U46u(f, s, m) DATA_NUMBERS_U45u(f, s, m), f(s, m, 45u)
+#define DATA_NUMBERS_U47u(f, s, m) DATA_NUMBERS_U46u(f, s, m), f(s, m, 46u)
+#define DATA_NUMBERS_U48u(f, s, m) DATA_NUMBERS_U47u(f, s, m), f(s, m, 47u)
+#define DATA_NUMBERS_U49u(f, s, m) DATA_NUMBERS_U48u(f, s, m), f(s, m, 48u)
+#define DATA_NUMBERS_U50u(f, s, m) DATA_NUMBERS_U49u(f, s, m), f(s, m, 49u)
+#define DATA_NUMBERS_U51u(f, s, m) DATA_NUMBERS_U50u(f, s, m), f(s, m, 50u)
+#define DATA_NUMBERS_U52u(f, s, m) DATA_NUMBERS_U51u(f, s, m), f(s, m, 51u)
+#define DATA_NUMBERS_U53u(f, s, m) DATA_NUMBERS_U52u(f, s, m), f(s, m, 52u)
+#define DATA_NUMBERS_U54u(f, s, m) DATA_NUMBERS_U53u(f, s, m), f(s, m, 53u)
+#define DATA_NUMBERS_U55u(f, s, m) DATA_NUMBERS_U54u(f, s, m), f(s, m, 54u)
+#define DATA_NUMBERS_U56u(f, s, m) DATA_NUMBERS_U55u(f, s, m), f(s, m, 55u)
+#define DATA_NUMBERS_U57u(f, s, m) DATA_NUMBERS_U56u(f, s, m), f(s, m, 56u)
+#define DATA_NUMBERS_U58u(f, s, m) DATA_NUMBERS_U57u(f, s, m), f(s, m, 57u)
+#define DATA_NUMBERS_U59u(f, s, m) DATA_NUMBERS_U58u(f, s, m), f(s, m, 58u)
+#define DATA_NUMBERS_U60u(f, s, m) DATA_NUMBERS_U59u(f, s, m), f(s, m, 59u)
+#define DATA_NUMBERS_U61u(f, s, m) DATA_NUMBERS_U60u(f, s, m), f(s, m, 60u)
+#define DATA_NUMBERS_U62u(f, s, m) DATA_NUMBERS_U61u(f, s, m), f(s, m, 61u)
+#define DATA_NUMBERS_U63u(f, s, m) DATA_NUMBERS_U62u(f, s, m), f(s, m, 62u)
+#define DATA_NUMBERS_U64u(f, s, m) DATA_NUMBERS_U63u(f, s, m), f(s, m, 63u)
+
+#define DATA_MODULES_U1u(f, s, n)  DATA_NUMBERS(f, s, 0u, n)
+#define DATA_MODULES_U2u(f, s, n)  DATA_MODULES_U1u(f, s, n), DATA_NUMBERS(f, s, 1u, n)
+#define DATA_MODULES_U3u(f, s, n)  DATA_MODULES_U2u(f, s, n), DATA_NUMBERS(f, s, 2u, n)
+#define DATA_MODULES_U4u(f, s, n)  DATA_MODULES_U3u(f, s, n), DATA_NUMBERS(f, s, 3u, n)
+#define DATA_MODULES_U5u(f, s, n)  DATA_MODULES_U4u(f, s, n), DATA_NUMBERS(f, s, 4u, n)
+#define DATA_MODULES_U6u(f, s, n)  DATA_MODULES_U5u(f, s, n), DATA_NUMBERS(f, s, 5u, n)
+#define DATA_MODULES_U7u(f, s, n)  DATA_MODULES_U6u(f, s, n), DATA_NUMBERS(f, s, 6u, n)
+#define DATA_MODULES_U8u(f, s, n)  DATA_MODULES_U7u(f, s, n), DATA_NUMBERS(f, s, 7u, n)
+#define DATA_MODULES_U9u(f, s, n)  DATA_MODULES_U8u(f, s, n), DATA_NUMBERS(f, s, 8u, n)
+#define DATA_MODULES_U10u(f, s, n) DATA_MODULES_U9u(f, s, n), DATA_NUMBERS(f, s, 9u, n)
+#define DATA_MODULES_U11u(f, s, n) DATA_MODULES_U10u(f, s, n), DATA_NUMBERS(f, s, 10u, n)
+#define DATA_MODULES_U12u(f, s, n) DATA_MODULES_U11u(f, s, n), DATA_NUMBERS(f, s, 11u, n)
+#define DATA_MODULES_U13u(f, s, n) DATA_MODULES_U12u(f, s, n), DATA_NUMBERS(f, s, 12u, n)
+#define DATA_MODULES_U14u(f, s, n) DATA_MODULES_U13u(f, s, n), DATA_NUMBERS(f, s, 13u, n)
+#define DATA_MODULES_U15u(f, s, n) DATA_MODULES_U14u(f, s, n), DATA_NUMBERS(f, s, 14u, n)
+#define DATA_MODULES_U16u(f, s, n) DATA_MODULES_U15u(f, s, n), DATA_NUMBERS(f, s, 15u, n)
+#define DATA_MODULES_U17u(f, s, n) DATA_MODULES_U16u(f, s, n), DATA_NUMBERS(f, s, 16u, n)
+#define DATA_MODULES_U18u(f, s, n) DATA_MODULES_U17u(f, s, n), DATA_NUMBERS(f, s, 17u, n)
+#define DATA_MODULES_U19u(f, s, n) DATA_MODULES_U18u(f, s, n), DATA_NUMBERS(f, s, 18u, n)
+#define DATA_MODULES_U20u(f, s, n) DATA_MODULES_U19u(f, s, n), DATA_NUMBERS(f, s, 19u, n)
+#define DATA_MODULES_U21u(f, s, n) DATA_MODULES_U20u(f, s, n), DATA_NUMBERS(f, s, 20u, n)
+#define DATA_MODULES_U22u(f, s, n) DATA_MODULES_U21u(f, s, n), DATA_NUMBERS(f, s, 21u, n)
+#define DATA_MODULES_U23u(f, s, n) DATA_MODULES_U22u(f, s, n), DATA_NUMBERS(f, s, 22u, n)
+#define DATA_MODULES_U24u(f, s, n) DATA_MODULES_U23u(f, s, n), DATA_NUMBERS(f, s, 23u, n)
+#define DATA_MODULES_U25u(f, s, n) DATA_MODULES_U24u(f, s, n), DATA_NUMBERS(f, s, 24u, n)
+#define DATA_MODULES_U26u(f, s, n) DATA_MODULES_U25u(f, s, n), DATA_NUMBERS(f, s, 25u, n)
+#define DATA_MODULES_U27u(f, s, n) DATA_MODULES_U26u(f, s, n), DATA_NUMBERS(f, s, 26u, n)
+#define DATA_MODULES_U28u(f, s, n) DATA_MODULES_U27u(f, s, n), DATA_NUMBERS(f, s, 27u, n)
+#define DATA_MODULES_U29u(f, s, n) DATA_MODULES_U28u(f, s, n), DATA_NUMBERS(f, s, 28u, n)
+#define DATA_MODULES_U30u(f, s, n) DATA_MODULES_U29u(f, s, n), DATA_NUMBERS(f, s, 29u, n)
+#define DATA_MODULES_U31u(f, s, n) DATA_MODULES_U30u(f, s, n), DATA_NUMBERS(f, s, 30u, n)
+#define DATA_MODULES_U32u(f, s, n) DATA_MODULES_U31u(f, s, n), DATA_NUMBERS(f, s, 31u, n)
+
+#define DATA_STRINGS_U1u(f, m, n)  DATA_MODULES(f, 0u, m, n)
+#define DATA_STRINGS_U2u(f, m, n)  DATA_STRINGS_U1u(f, m, n), DATA_MODULES(f, 1u, m, n)
+#define DATA_STRINGS_U3u(f, m, n)  DATA_STRINGS_U2u(f, m, n), DATA_MODULES(f, 2u, m, n)
+#define DATA_STRINGS_U4u(f, m, n)  DATA_STRINGS_U3u(f, m, n), DATA_MODULES(f, 3u, m, n)
+#define DATA_STRINGS_U5u(f, m, n)  DATA_STRINGS_U4u(f, m, n), DATA_MODULES(f, 4u, m, n)
+#define DATA_STRINGS_U6u(f, m, n)  DATA_STRINGS_U5u(f, m, n), DATA_MODULES(f, 5u, m, n)
+#define DATA_STRINGS_U7u(f, m, n)  DATA_STRINGS_U6u(f, m, n), DATA_MODULES(f, 6u, m, n)
+#define DATA_STRINGS_U8u(f, m, n)  DATA_STRINGS_U7u(f, m, n), DATA_MODULES(f, 7u, m, n)
+#define DATA_STRINGS_U9u(f, m, n)  DATA_STRINGS_U8u(f, m, n), DATA_MODULES(f, 8u, m, n)
+#define DATA_STRINGS_U10u(f, m, n) DATA_STRINGS_U9u(f, m, n), DATA_MODULES(f, 9u, m, n)
+#define DATA_STRINGS_U11u(f, m, n) DATA_STRINGS_U10u(f, m, n), DATA_MODULES(f, 10u, m, n)
+#define DATA_STRINGS_U12u(f, m, n) DATA_STRINGS_U11u(f, m, n), DATA_MODULES(f, 11u, m, n)
+#define DATA_STRINGS_U13u(f, m, n) DATA_STRINGS_U12u(f, m, n), DATA_MODULES(f, 12u, m, n)
+#define DATA_STRINGS_U14u(f, m, n) DATA_STRINGS_U13u(f, m, n), DATA_MODULES(f, 13u, m, n)
+#define DATA_STRINGS_U15u(f, m, n) DATA_STRINGS_U14u(f, m, n), DATA_MODULES(f, 14u, m, n)
+#define DATA_STRINGS_U16u(f, m, n) DATA_STRINGS_U15u(f, m, n), DATA_MODULES(f, 15u, m, n)
+
+/* AXIVION Disable Style MisraC2012-20.10: Usage allowed as long as remarks in documentation are honored. */
+#define DATA_NUMBERSx(f, s, m, n) DATA_NUMBERS_U##n(f, s, m)
+#define DATA_MODULESx(f, s, m, n) DATA_MODULES_U##m(f, s, n)
+#define DATA_STRINGSx(f, s, m, n) DATA_STRINGS_U##s(f, m, n)
+/* AXIVION Enable Style MisraC2012-20.10: */
+#define DATA_NUMBERS(f, s, m, n)  DATA_NUMBERSx(f, s, m, n)
+#define DATA_MODULES(f, s, m, n)  DATA_MODULESx(f, s, m, n)
+#define DATA_TOPOLOGY(f, s, m, n) DATA_STRINGSx(f, s, m, n)
+/* AXIVION Enable Style Generic-NoUnsafeMacro MisraC2012Directive-4.9: */
+/**@}*/
+
+/** Maximum number of strings in the topology lookup tables. Adapt if you change implementation. */
+#define DATA_TOPOLOGY_MAXIMUM_STRINGS (16u)
+/** Maximum number of modules per string in the topology lookup tables. Adapt if you change implementation. */
+#define DATA_TOPOLOGY_MAXIMUM_MODULES (32u)
+/** Maximum number of cell blocks or temperature sensors per module in the topology lookup tables. Adapt if you
+ *  change implementation. */
+#define DATA_TOPOLOGY_MAXIMUM_NUMBERS (64u)
+
+FAS_STATIC_ASSERT(
+    (BS_NR_OF_STRINGS <= DATA_TOPOLOGY_MAXIMUM_STRINGS),
+    "The topology lookup tables support only DATA_TOPOLOGY_MAXIMUM_STRINGS strings");
+FAS_STATIC_ASSERT(
+    (BS_NR_OF_MODULES_PER_STRING <= DATA_TOPOLOGY_MAXIMUM_MODULES),
+    "The topology lookup tables support only DATA_TOPOLOGY_MAXIMUM_MODULES modules per string");
+FAS_STATIC_ASSERT(
+    (BS_NR_OF_CELL_BLOCKS_PER_MODULE <= DATA_TOPOLOGY_MAXIMUM_NUMBERS),
+    "The topology lookup tables support only DATA_TOPOLOGY_MAXIMUM_NUMBERS cell blocks per module");
+FAS_STATIC_ASSERT(
+    (BS_NR_OF_TEMP_SENSORS_PER_MODULE <= DATA_TOPOLOGY_MAXIMUM_NUMBERS),
+    "The topology lookup tables support only DATA_TOPOLOGY_MAXIMUM_NUMBERS temperature sensors per module");
+
 /*========== Static Constant and Variable Definitions =======================*/
 
 /*========== Extern Constant and Variable Definitions =======================*/
+const DATA_POSITION_s data_kCellBlockPosition[DATA_NR_OF_CELL_BLOCKS] = {DATA_TOPOLOGY(
+    DATA_POSITION,
+    GEN_STRIP(BS_NR_OF_STRINGS),
+    GEN_STRIP(BS_NR_OF_MODULES_PER_STRING),
+    GEN_STRIP(BS_NR_OF_CELL_BLOCKS_PER_MODULE))};
+
+const DATA_POSITION_s data_kTemperatureSensorPosition[BS_NR_OF_TEMP_SENSORS] = {DATA_TOPOLOGY(
+    DATA_POSITION,
+    GEN_STRIP(BS_NR_OF_STRINGS),
+    GEN_STRIP(BS_NR_OF_MODULES_PER_STRING),
+    GEN_STRIP(BS_NR_OF_TEMP_SENSORS_PER_MODULE))};
+
+const uint16_t data_kTemperatureSensorOfCellBlock[DATA_NR_OF_CELL_BLOCKS] = {DATA_TOPOLOGY(
+    DATA_TEMPERATURE_SENSOR_OF_CELL_BLOCK,
+    GEN_STRIP(BS_NR_OF_STRINGS),
+    GEN_STRIP(BS_NR_OF_MODULES_PER_STRING),
+    GEN_STRIP(BS_NR_OF_CELL_BLOCKS_PER_MODULE))};
 
 /*========== Static Function Prototypes =====================================*/
 
@@ -153,6 +338,52 @@ extern uint8_t DATA_GetSensorNumberFromTemperatureIndex(uint16_t sensorIndex) {
     return (uint8_t)(sensorIndex % BS_NR_OF_TEMP_SENSORS_PER_MODULE);
 }
 
+extern void DATA_ExpandInvalidCellVoltages(const DATA_BLOCK_CELL_VOLTAGE_s *pkCellVoltages, uint8_t *pInvalidFlags) {
+    FAS_ASSERT(pkCellVoltages != NULL_PTR);
+    FAS_ASSERT(pInvalidFlags != NULL_PTR);
+    uint8_t *pModuleFlags = pInvalidFlags;
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            const uint64_t invalidCellBlocks = pkCellVoltages->invalidCellVoltage[s][m];
+            for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+                pModuleFlags[cb] = (uint8_t)((invalidCellBlocks >> cb) & 1u);
+            }
+            pModuleFlags = &pModuleFlags[BS_NR_OF_CELL_BLOCKS_PER_MODULE];
+        }
+    }
+}
+
+extern void DATA_ExpandInvalidCellTemperatures(
+    const DATA_BLOCK_CELL_TEMPERATURE_s *pkCellTemperatures,
+    uint8_t *pInvalidFlags) {
+    FAS_ASSERT(pkCellTemperatures != NULL_PTR);
+    FAS_ASSERT(pInvalidFlags != NULL_PTR);
+    uint8_t *pModuleFlags = pInvalidFlags;
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            const uint16_t invalidSensors = pkCellTemperatures->invalidCellTemperature[s][m];
+            for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
+                pModuleFlags[ts] = (uint8_t)((invalidSensors >> ts) & 1u);
+            }
+            pModuleFlags = &pModuleFlags[BS_NR_OF_TEMP_SENSORS_PER_MODULE];
+        }
+    }
+}
+
+extern void DATA_GetCellView(
+    const DATA_BLOCK_CELL_VOLTAGE_s *pkCellVoltages,
+    const DATA_BLOCK_BALANCING_CONTROL_s *pkBalancingControl,
+    DATA_CELL_VIEW_s *pView) {
+    FAS_ASSERT(pkCellVoltages != NULL_PTR);
+    FAS_ASSERT(pkBalancingControl != NULL_PTR);
+    FAS_ASSERT(pView != NULL_PTR);
+    /* the database stores the values of all strings consecutively in linear index order */
+    pView->pkCellVoltage_mV    = &pkCellVoltages->cellVoltage_mV[0u][0u][0u];
+    pView->pkBalancingState    = &pkBalancingControl->balancingState[0u][0u];
+    pView->pkTemperatureSensor = data_kTemperatureSensorOfCellBlock;
+    DATA_ExpandInvalidCellVoltages(pkCellVoltages, pView->invalidCellVoltage);
+}
+
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
 #endif
@@ -43,7 +43,7 @@
  * @file    database_helper.h
  * @author  foxBMS Team
  * @date    2021-05-05 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup ENGINE
  * @prefix  DATA
@@ -58,13 +58,63 @@
 #define FOXBMS__DATABASE_HELPER_H_
 
 /*========== Includes =======================================================*/
+#include "battery_system_cfg.h"
 #include "database_cfg.h"
 
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
+/** number of cell blocks in the battery system */
+#define DATA_NR_OF_CELL_BLOCKS (BS_NR_OF_STRINGS * BS_NR_OF_CELL_BLOCKS_PER_STRING)
+
+/** position of a cell block or of a temperature sensor in the battery system */
+typedef struct {
+    uint8_t stringNumber; /*!< string of the cell block or temperature sensor */
+    uint8_t moduleNumber; /*!< module in the string */
+    uint8_t number;       /*!< cell block or temperature sensor in the module */
+} DATA_POSITION_s;
+
+/**
+ * @brief   flat struct-of-arrays view of the cell blocks
+ * @details All arrays have #DATA_NR_OF_CELL_BLOCKS entries in linear index
+ *          order, so that a loop over the complete pack is a single loop over
+ *          contiguous arrays. The voltages and balancing states point into
+ *          the database entries the view has been created from, i.e., the
+ *          view is only valid as long as these entries are.
+ */
+typedef struct {
+    const int16_t *pkCellVoltage_mV;                    /*!< cell voltages */
+    const uint8_t *pkBalancingState;                    /*!< 0: no balancing, 1: balancing active */
+    const uint16_t *pkTemperatureSensor;                /*!< linear index of the temperature sensor of the cell block */
+    uint8_t invalidCellVoltage[DATA_NR_OF_CELL_BLOCKS]; /*!< 0: valid, 1: invalid */
+} DATA_CELL_VIEW_s;
 
 /*========== Extern Constant and Variable Declarations ======================*/
+/**
+ * @brief   position of each cell block in the battery system
+ * @details Indexed by the linear index of the cell block, i.e., its index in
+ *          the flattened cell voltage array of the database. The table is
+ *          generated from the battery system configuration at compile time
+ *          and replaces the index conversion functions below in loops over
+ *          all cell blocks.
+ */
+extern const DATA_POSITION_s data_kCellBlockPosition[DATA_NR_OF_CELL_BLOCKS];
+
+/**
+ * @brief   position of each temperature sensor in the battery system
+ * @details Indexed by the linear index of the temperature sensor, i.e., its
+ *          index in the flattened cell temperature array of the database.
+ */
+extern const DATA_POSITION_s data_kTemperatureSensorPosition[BS_NR_OF_TEMP_SENSORS];
+
+/**
+ * @brief   linear index of the temperature sensor of each cell block
+ * @details Indexed by the linear index of the cell block. The temperature
+ *          sensors of a module are assumed to be distributed evenly over its
+ *          cell blocks; the first (last) sensor belongs to the first (last)
+ *          cell block of the module.
+ */
+extern const uint16_t data_kTemperatureSensorOfCellBlock[DATA_NR_OF_CELL_BLOCKS];
 
 /*========== Extern Function Prototypes =====================================*/
 /**
@@ -139,6 +189,37 @@ extern uint8_t DATA_GetModuleNumberFromTemperatureIndex(uint16_t sensorIndex);
  */
 extern uint8_t DATA_GetSensorNumberFromTemperatureIndex(uint16_t sensorIndex);
 
+/**
+ * @brief   Expands the invalid cell voltage bitmasks into one flag per cell
+ *          block
+ * @param[in]   pkCellVoltages  database entry with the cell voltages
+ * @param[out]  pInvalidFlags   #DATA_NR_OF_CELL_BLOCKS flags in linear index
+ *                              order (0: valid, 1: invalid)
+ */
+extern void DATA_ExpandInvalidCellVoltages(const DATA_BLOCK_CELL_VOLTAGE_s *pkCellVoltages, uint8_t *pInvalidFlags);
+
+/**
+ * @brief   Expands the invalid cell temperature bitmasks into one flag per
+ *          temperature sensor
+ * @param[in]   pkCellTemperatures  database entry with the cell temperatures
+ * @param[out]  pInvalidFlags       #BS_NR_OF_TEMP_SENSORS flags in linear
+ *                                  index order (0: valid, 1: invalid)
+ */
+extern void DATA_ExpandInvalidCellTemperatures(
+    const DATA_BLOCK_CELL_TEMPERATURE_s *pkCellTemperatures,
+    uint8_t *pInvalidFlags);
+
+/**
+ * @brief   Creates a flat view of the cell blocks
+ * @param[in]   pkCellVoltages      database entry with the cell voltages
+ * @param[in]   pkBalancingControl  database entry with the balancing states
+ * @param[out]  pView               view of the cell blocks
+ */
+extern void DATA_GetCellView(
+    const DATA_BLOCK_CELL_VOLTAGE_s *pkCellVoltages,
+    const DATA_BLOCK_BALANCING_CONTROL_s *pkBalancingControl,
+    DATA_CELL_VIEW_s *pView);
+
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
 #endif
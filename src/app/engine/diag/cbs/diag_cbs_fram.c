@@ -43,7 +43,7 @@
  * @file    diag_cbs_fram.c
  * @author  foxBMS Team
  * @date    2022-02-24 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup ENGINE
  * @prefix  DIAG
@@ -87,6 +87,14 @@ extern void DIAG_FramError(
             kpkDiagShim->pTableError->framReadCrcError = true;
         }
     }
+    if (diagId == DIAG_ID_LOAD_SPECTRUM_RESET) {
+        if (event == DIAG_EVENT_RESET) {
+            kpkDiagShim->pTableError->loadSpectrumResetError = false;
+        }
+        if (event == DIAG_EVENT_NOT_OK) {
+            kpkDiagShim->pTableError->loadSpectrumResetError = true;
+        }
+    }
 }
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
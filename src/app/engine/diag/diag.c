@@ -43,7 +43,7 @@
  * @file    diag.c
  * @author  foxBMS Team
  * @date    2019-11-28 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup ENGINE
  * @prefix  DIAG
@@ -94,6 +94,20 @@ static void DIAG_Reset(void);
  */
 static uint8_t DIAG_EntryWrite(uint8_t eventID, DIAG_EVENT_e event, uint32_t data);
 
+/**
+ * @brief   evaluates an event of a diagnosis entry
+ * @details Updates the occurrence counter and the error and warning flags of
+ *          the diagnosis entry, records the event and calls the callback of
+ *          the diagnosis entry. The diagnosis entry and the string have to be
+ *          validated by the caller.
+ * @param   diagId      #DIAG_ID_e of the event that has occurred
+ * @param   event       event that occurred (OK, NOK, RESET)
+ * @param   stringID    string of the occurrence counter (0 for #DIAG_SYSTEM)
+ * @param   data        individual information for #DIAG_ID_e e.g. string number,..
+ * @return  return value of #DIAG_RETURNTYPE_e
+ */
+static DIAG_RETURNTYPE_e DIAG_EvaluateEvent(DIAG_ID_e diagId, DIAG_EVENT_e event, uint8_t stringID, uint32_t data);
+
 /*========== Static Function Implementations ================================*/
 /**
  * @brief   DIAG_Reset resetsall needed structures
@@ -112,6 +126,117 @@ static void DIAG_Reset(void) {
     diag_locked      = 0;
 }
 
+static DIAG_RETURNTYPE_e DIAG_EvaluateEvent(DIAG_ID_e diagId, DIAG_EVENT_e event, uint8_t stringID, uint32_t data) {
+    DIAG_RETURNTYPE_e ret_val      = DIAG_HANDLER_RETURN_UNKNOWN;
+    uint32_t *u32ptr_errCodemsk    = NULL_PTR;
+    uint32_t *u32ptr_warnCodemsk   = NULL_PTR;
+    uint16_t *u16ptr_threshcounter = NULL_PTR;
+    uint16_t cfg_threshold         = 0;
+    uint16_t err_enable_idx        = 0;
+    uint32_t err_enable_bitmask    = 0;
+
+    DIAG_RECORDING_e recording_enabled;
+    DIAG_EVALUATE_e evaluate_enabled;
+
+    u16ptr_threshcounter = &diag.occurrenceCounter[stringID][diagId];
+    if ((event == DIAG_EVENT_OK) && ((*u16ptr_threshcounter) == 0u)) {
+        /* everything ok, nothing to be handled: skip the lookup of the configuration */
+        return DIAG_HANDLER_RETURN_OK;
+    }
+
+    err_enable_idx     = diagId / 32;        /* array index of diag.err_enableflag[..] */
+    err_enable_bitmask = 1 << (diagId % 32); /* bit number (mask) of diag.err_enableflag[idx] */
+
+    u32ptr_errCodemsk  = &diag.errflag[err_enable_idx];
+    u32ptr_warnCodemsk = &diag.warnflag[err_enable_idx];
+    cfg_threshold      = diag_devptr->pConfigurationOfDiagnosisEntries[diag.id2ch[diagId]].threshold;
+    recording_enabled  = diag_devptr->pConfigurationOfDiagnosisEntries[diag.id2ch[diagId]].enable_recording;
+    evaluate_enabled   = diag_devptr->pConfigurationOfDiagnosisEntries[diag.id2ch[diagId]].enable_evaluate;
+
+    if (event == DIAG_EVENT_OK) {
+        if ((diag.err_enableflag[err_enable_idx] & err_enable_bitmask) > 0u) {
+            /* if (((*u16ptr_threshcounter) == 0) && (*u32ptr_errCodemsk == 0)) */
+            if (((*u16ptr_threshcounter) == 0)) {
+                /* everything ok, nothing to be handled */
+            } else if ((*u16ptr_threshcounter) > 1) {
+                (*u16ptr_threshcounter)--; /* Error did not occur, decrement Error-Counter */
+            } else if ((*u16ptr_threshcounter) == 1) {
+                /* else if ((*u16ptr_threshcounter) <= 1) */
+                /* Error did not occur, now decrement to zero and clear Error- or Warning-Flag and make recording if enabled */
+                *u32ptr_errCodemsk &= ~err_enable_bitmask;  /* ERROR:   clear corresponding bit in errflag[idx] */
+                *u32ptr_warnCodemsk &= ~err_enable_bitmask; /* WARNING: clear corresponding bit in warnflag[idx] */
+                (*u16ptr_threshcounter) = 0;
+                /* Make entry in error-memory (error disappeared) */
+                if (recording_enabled == DIAG_RECORDING_ENABLED) {
+                    DIAG_EntryWrite(diagId, event, data);
+                }
+
+                if (evaluate_enabled == DIAG_EVALUATION_ENABLED) {
+                    /* Call callback function and reset error */
+                    diag_diagnosisIdConfiguration[diag.id2ch[diagId]].fpCallback(
+                        diagId, DIAG_EVENT_RESET, &diag_kDatabaseShim, data);
+                    DIAG_NotifyFlagModification();
+                }
+            }
+        }
+        ret_val = DIAG_HANDLER_RETURN_OK; /* Function does not return an error-message! */
+    } else if (event == DIAG_EVENT_NOT_OK) {
+        if ((diag.err_enableflag[err_enable_idx] & err_enable_bitmask) > 0u) {
+            if ((*u16ptr_threshcounter) < cfg_threshold) {
+                (*u16ptr_threshcounter)++;        /* error-threshold not exceeded yet, increment Error-Counter */
+                ret_val = DIAG_HANDLER_RETURN_OK; /* Function does not return an error-message! */
+            } else if ((*u16ptr_threshcounter) == cfg_threshold) {
+                /* Error occured AND error-threshold exceeded */
+                (*u16ptr_threshcounter)++;
+                *u32ptr_errCodemsk |= err_enable_bitmask;   /* ERROR:   set corresponding bit in errflag[idx] */
+                *u32ptr_warnCodemsk &= ~err_enable_bitmask; /* WARNING: clear corresponding bit in warnflag[idx] */
+
+                /* Make entry in error-memory (error occurred) */
+                if (recording_enabled == DIAG_RECORDING_ENABLED) {
+                    DIAG_EntryWrite(diagId, event, data);
+                }
+
+                if (evaluate_enabled == DIAG_EVALUATION_ENABLED) {
+                    /* Call callback function and set error */
+                    diag_diagnosisIdConfiguration[diag.id2ch[diagId]].fpCallback(
+                        diagId, DIAG_EVENT_NOT_OK, &diag_kDatabaseShim, data);
+                    DIAG_NotifyFlagModification();
+                }
+                /* Function returns an error-message! */
+                ret_val = DIAG_HANDLER_RETURN_ERR_OCCURRED;
+            } else if (((*u16ptr_threshcounter) > cfg_threshold)) {
+                /* error-threshold already exceeded, nothing to be handled */
+                ret_val = DIAG_HANDLER_RETURN_ERR_OCCURRED;
+            }
+        } else {
+            /* Error occurred BUT NOT enabled by mask */
+            *u32ptr_errCodemsk &= ~err_enable_bitmask;      /* ERROR:   clear corresponding bit in errflag[idx] */
+            *u32ptr_warnCodemsk |= err_enable_bitmask;      /* WARNING: set corresponding bit in warnflag[idx] */
+            ret_val = DIAG_HANDLER_RETURN_WARNING_OCCURRED; /* Function returns an error-message! */
+        }
+    } else if (event == DIAG_EVENT_RESET) {
+        if ((diag.err_enableflag[err_enable_idx] & err_enable_bitmask) > 0u) {
+            /* clear counter, Error-, Warning-Flag and make recording if enabled */
+            *u32ptr_errCodemsk &= ~err_enable_bitmask;  /* ERROR:   clear corresponding bit in errflag[idx] */
+            *u32ptr_warnCodemsk &= ~err_enable_bitmask; /* WARNING: clear corresponding bit in warnflag[idx] */
+            (*u16ptr_threshcounter) = 0;
+            if (recording_enabled == DIAG_RECORDING_ENABLED) {
+                /* Make entry in error-memory (error disappeared) if error was recorded before */
+                DIAG_EntryWrite(diagId, event, data);
+            }
+            if (evaluate_enabled == DIAG_EVALUATION_ENABLED) {
+                /* Call callback function and reset error */
+                diag_diagnosisIdConfiguration[diag.id2ch[diagId]].fpCallback(
+                    diagId, DIAG_EVENT_RESET, &diag_kDatabaseShim, data);
+                DIAG_NotifyFlagModification();
+            }
+        }
+        ret_val = DIAG_HANDLER_RETURN_OK; /* Function does not return an error-message! */
+    }
+
+    return ret_val;
+}
+
 /*========== Extern Function Implementations ================================*/
 STD_RETURN_TYPE_e DIAG_Initialize(DIAG_DEV_s *diag_dev_pointer) {
     FAS_ASSERT(diag_dev_pointer != NULL_PTR);
@@ -244,17 +369,6 @@ static uint8_t DIAG_EntryWrite(uint8_t eventID, DIAG_EVENT_e event, uint32_t dat
 }
 
 DIAG_RETURNTYPE_e DIAG_Handler(DIAG_ID_e diagId, DIAG_EVENT_e event, DIAG_IMPACT_LEVEL_e impact, uint32_t data) {
-    DIAG_RETURNTYPE_e ret_val      = DIAG_HANDLER_RETURN_UNKNOWN;
-    uint32_t *u32ptr_errCodemsk    = NULL_PTR;
-    uint32_t *u32ptr_warnCodemsk   = NULL_PTR;
-    uint16_t *u16ptr_threshcounter = NULL_PTR;
-    uint16_t cfg_threshold         = 0;
-    uint16_t err_enable_idx        = 0;
-    uint32_t err_enable_bitmask    = 0;
-
-    DIAG_RECORDING_e recording_enabled;
-    DIAG_EVALUATE_e evaluate_enabled;
-
     if (diag.state == DIAG_STATE_UNINITIALIZED) {
         return DIAG_HANDLER_RETURN_NOT_READY;
     }
@@ -280,95 +394,40 @@ DIAG_RETURNTYPE_e DIAG_Handler(DIAG_ID_e diagId, DIAG_EVENT_e event, DIAG_IMPACT
         stringID = data;
     }
 
-    err_enable_idx     = diagId / 32;        /* array index of diag.err_enableflag[..] */
-    err_enable_bitmask = 1 << (diagId % 32); /* bit number (mask) of diag.err_enableflag[idx] */
-
-    u32ptr_errCodemsk    = &diag.errflag[err_enable_idx];
-    u32ptr_warnCodemsk   = &diag.warnflag[err_enable_idx];
-    u16ptr_threshcounter = &diag.occurrenceCounter[stringID][diagId];
-    cfg_threshold        = diag_devptr->pConfigurationOfDiagnosisEntries[diag.id2ch[diagId]].threshold;
-    recording_enabled    = diag_devptr->pConfigurationOfDiagnosisEntries[diag.id2ch[diagId]].enable_recording;
-    evaluate_enabled     = diag_devptr->pConfigurationOfDiagnosisEntries[diag.id2ch[diagId]].enable_evaluate;
-
-    if (event == DIAG_EVENT_OK) {
-        if ((diag.err_enableflag[err_enable_idx] & err_enable_bitmask) > 0u) {
-            /* if (((*u16ptr_threshcounter) == 0) && (*u32ptr_errCodemsk == 0)) */
-            if (((*u16ptr_threshcounter) == 0)) {
-                /* everything ok, nothing to be handled */
-            } else if ((*u16ptr_threshcounter) > 1) {
-                (*u16ptr_threshcounter)--; /* Error did not occur, decrement Error-Counter */
-            } else if ((*u16ptr_threshcounter) == 1) {
-                /* else if ((*u16ptr_threshcounter) <= 1) */
-                /* Error did not occur, now decrement to zero and clear Error- or Warning-Flag and make recording if enabled */
-                *u32ptr_errCodemsk &= ~err_enable_bitmask;  /* ERROR:   clear corresponding bit in errflag[idx] */
-                *u32ptr_warnCodemsk &= ~err_enable_bitmask; /* WARNING: clear corresponding bit in warnflag[idx] */
-                (*u16ptr_threshcounter) = 0;
-                /* Make entry in error-memory (error disappeared) */
-                if (recording_enabled == DIAG_RECORDING_ENABLED) {
-                    DIAG_EntryWrite(diagId, event, data);
-                }
-
-                if (evaluate_enabled == DIAG_EVALUATION_ENABLED) {
-                    /* Call callback function and reset error */
-                    diag_diagnosisIdConfiguration[diag.id2ch[diagId]].fpCallback(
-                        diagId, DIAG_EVENT_RESET, &diag_kDatabaseShim, data);
-                }
-            }
-        }
-        ret_val = DIAG_HANDLER_RETURN_OK; /* Function does not return an error-message! */
-    } else if (event == DIAG_EVENT_NOT_OK) {
-        if ((diag.err_enableflag[err_enable_idx] & err_enable_bitmask) > 0u) {
-            if ((*u16ptr_threshcounter) < cfg_threshold) {
-                (*u16ptr_threshcounter)++;        /* error-threshold not exceeded yet, increment Error-Counter */
-                ret_val = DIAG_HANDLER_RETURN_OK; /* Function does not return an error-message! */
-            } else if ((*u16ptr_threshcounter) == cfg_threshold) {
-                /* Error occured AND error-threshold exceeded */
-                (*u16ptr_threshcounter)++;
-                *u32ptr_errCodemsk |= err_enable_bitmask;   /* ERROR:   set corresponding bit in errflag[idx] */
-                *u32ptr_warnCodemsk &= ~err_enable_bitmask; /* WARNING: clear corresponding bit in warnflag[idx] */
+    return DIAG_EvaluateEvent(diagId, event, stringID, data);
+}
 
-                /* Make entry in error-memory (error occurred) */
-                if (recording_enabled == DIAG_RECORDING_ENABLED) {
-                    DIAG_EntryWrite(diagId, event, data);
-                }
+DIAG_RETURNTYPE_e DIAG_HandleEvents(
+    DIAG_BATCH_EVENT_s *pEvents,
+    uint8_t nrOfEvents,
+    DIAG_IMPACT_LEVEL_e impact,
+    uint32_t data) {
+    FAS_ASSERT(pEvents != NULL_PTR);
+    /* AXIVION Routine Generic-MissingParameterAssert: nrOfEvents: parameter accepts whole range */
+    DIAG_RETURNTYPE_e retVal = DIAG_HANDLER_RETURN_OK;
 
-                if (evaluate_enabled == DIAG_EVALUATION_ENABLED) {
-                    /* Call callback function and set error */
-                    diag_diagnosisIdConfiguration[diag.id2ch[diagId]].fpCallback(
-                        diagId, DIAG_EVENT_NOT_OK, &diag_kDatabaseShim, data);
-                }
-                /* Function returns an error-message! */
-                ret_val = DIAG_HANDLER_RETURN_ERR_OCCURRED;
-            } else if (((*u16ptr_threshcounter) > cfg_threshold)) {
-                /* error-threshold already exceeded, nothing to be handled */
-                ret_val = DIAG_HANDLER_RETURN_ERR_OCCURRED;
-            }
-        } else {
-            /* Error occurred BUT NOT enabled by mask */
-            *u32ptr_errCodemsk &= ~err_enable_bitmask;      /* ERROR:   clear corresponding bit in errflag[idx] */
-            *u32ptr_warnCodemsk |= err_enable_bitmask;      /* WARNING: set corresponding bit in warnflag[idx] */
-            ret_val = DIAG_HANDLER_RETURN_WARNING_OCCURRED; /* Function returns an error-message! */
+    if (diag.state == DIAG_STATE_UNINITIALIZED) {
+        retVal = DIAG_HANDLER_RETURN_NOT_READY;
+    } else if ((impact != DIAG_SYSTEM) && (impact != DIAG_STRING)) {
+        retVal = DIAG_HANDLER_INVALID_ERR_IMPACT;
+    } else if ((impact == DIAG_STRING) && (data >= BS_NR_OF_STRINGS)) {
+        retVal = DIAG_HANDLER_INVALID_DATA;
+    } else {
+        /* the source of the events is validated once for all events */
+        uint8_t stringID = 0u;
+        if (impact == DIAG_STRING) {
+            stringID = (uint8_t)data;
         }
-    } else if (event == DIAG_EVENT_RESET) {
-        if ((diag.err_enableflag[err_enable_idx] & err_enable_bitmask) > 0u) {
-            /* clear counter, Error-, Warning-Flag and make recording if enabled */
-            *u32ptr_errCodemsk &= ~err_enable_bitmask;  /* ERROR:   clear corresponding bit in errflag[idx] */
-            *u32ptr_warnCodemsk &= ~err_enable_bitmask; /* WARNING: clear corresponding bit in warnflag[idx] */
-            (*u16ptr_threshcounter) = 0;
-            if (recording_enabled == DIAG_RECORDING_ENABLED) {
-                /* Make entry in error-memory (error disappeared) if error was recorded before */
-                DIAG_EntryWrite(diagId, event, data);
-            }
-            if (evaluate_enabled == DIAG_EVALUATION_ENABLED) {
-                /* Call callback function and reset error */
-                diag_diagnosisIdConfiguration[diag.id2ch[diagId]].fpCallback(
-                    diagId, DIAG_EVENT_RESET, &diag_kDatabaseShim, data);
+        for (uint8_t i = 0u; i < nrOfEvents; i++) {
+            const DIAG_ID_e diagId = pEvents[i].diagId;
+            if (diagId >= DIAG_ID_MAX) {
+                pEvents[i].result = DIAG_HANDLER_RETURN_WRONG_ID;
+            } else {
+                pEvents[i].result = DIAG_EvaluateEvent(diagId, pEvents[i].event, stringID, data);
             }
         }
-        ret_val = DIAG_HANDLER_RETURN_OK; /* Function does not return an error-message! */
     }
-
-    return ret_val;
+    return retVal;
 }
 
 STD_RETURN_TYPE_e DIAG_CheckEvent(STD_RETURN_TYPE_e cond, DIAG_ID_e diagId, DIAG_IMPACT_LEVEL_e impact, uint32_t data) {
@@ -43,7 +43,7 @@
  * @file    diag.h
  * @author  foxBMS Team
  * @date    2019-11-28 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup ENGINE
  * @prefix  DIAG
@@ -77,6 +77,13 @@ typedef enum {
     DIAG_HANDLER_RETURN_NOT_READY,        /*!<  diagnosis handler not ready */
 } DIAG_RETURNTYPE_e;
 
+/** event of a diagnosis entry that is passed to #DIAG_HandleEvents */
+typedef struct {
+    DIAG_ID_e diagId;         /*!< #DIAG_ID_e of the event */
+    DIAG_EVENT_e event;       /*!< event that occurred (OK, NOK, RESET) */
+    DIAG_RETURNTYPE_e result; /*!< return value of the evaluation of the event, set by #DIAG_HandleEvents */
+} DIAG_BATCH_EVENT_s;
+
 /** possible states of the diagnosis module */
 typedef enum {
     DIAG_STATE_UNINITIALIZED, /*!< diagnosis module not initialized */
@@ -120,6 +127,28 @@ typedef struct {
  */
 extern DIAG_RETURNTYPE_e DIAG_Handler(DIAG_ID_e diagId, DIAG_EVENT_e event, DIAG_IMPACT_LEVEL_e impact, uint32_t data);
 
+/**
+ * @brief   handles several events of the same string (or of the system) with
+ *          one call
+ * @details Validates the state of the diagnosis module, the impact level and
+ *          the string once and then evaluates all events in the order of the
+ *          passed array as #DIAG_Handler does for a single event.
+ *          The return value of the evaluation of each event is stored in
+ *          #DIAG_BATCH_EVENT_s::result.
+ * @param   pEvents     events that occurred
+ * @param   nrOfEvents  number of passed events
+ * @param   impact      #DIAG_IMPACT_LEVEL_e of all passed events
+ * @param   data        individual information for the events e.g. string number,..
+ * @return  #DIAG_HANDLER_RETURN_OK if the events have been evaluated,
+ *          otherwise the return value of #DIAG_RETURNTYPE_e that describes why
+ *          no event has been evaluated
+ */
+extern DIAG_RETURNTYPE_e DIAG_HandleEvents(
+    DIAG_BATCH_EVENT_s *pEvents,
+    uint8_t nrOfEvents,
+    DIAG_IMPACT_LEVEL_e impact,
+    uint32_t data);
+
 /**
  * @brief   DIAG_CheckEvent provides a simple interface to check an event for
  *          #STD_OK
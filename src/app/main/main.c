@@ -43,7 +43,7 @@
  * @file    main.c
  * @author  foxBMS Team
  * @date    2019-08-27 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup GENERAL
  * @prefix  TODO
@@ -107,6 +107,7 @@ int main(void) {
     //_______________________________________________________________
     I2C_Initialize();
     DMA_Initialize();
+    ADC_Initialize();
     PWM_Initialize();
     DIAG_Initialize(&diag_device);
     MATH_StartupSelfTest();
@@ -43,7 +43,7 @@
  * @file    ftask_cfg.c
  * @author  foxBMS Team
  * @date    2019-08-26 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup TASK_CONFIGURATION
  * @prefix  FTSK
@@ -63,13 +63,17 @@
 #include "bal.h"
 #include "bms.h"
 #include "can.h"
+#include "can_cbs_tx_snapshot.h"
 #include "contactor.h"
 #include "database.h"
 #include "diag.h"
 #include "dma.h"
+#include "fassert.h"
 #include "fram.h"
+#include "fstd_types.h"
 #include "htsensor.h"
 #include "i2c.h"
+#include "i2c_queue.h"
 #include "imd.h"
 #include "interlock.h"
 #include "led.h"
@@ -85,16 +89,27 @@
 #include "sys.h"
 #include "sys_mon.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
 
-/** counter value for 50ms in 10ms task */
+/**
+ * counter value for 50ms in 10ms task: the measurement redundancy validation
+ * runs at the latest after this number of cycles, even if no new measurement
+ * values have been written, so that measurement timeouts are still detected
+ */
 #define TASK_10MS_COUNTER_FOR_50MS (5u)
 
 /** counter value for 1s in 100ms task */
 #define TASK_100MS_COUNTER_FOR_1S (10u)
 
+/* all transactions enqueued in one cycle of the I2C task have to fit into the queue */
+FAS_STATIC_ASSERT(
+    ((PEX_NR_OF_I2C_TRANSACTIONS_PER_CYCLE + HTSEN_NR_OF_I2C_TRANSACTIONS_PER_CYCLE +
+      RTC_NR_OF_I2C_TRANSACTIONS_PER_CYCLE) <= I2C_TRANSACTION_QUEUE_LENGTH),
+    "I2C transactions of one cycle of the I2C task exceed the length of the transaction queue");
+
 /*========== Static Constant and Variable Definitions =======================*/
 
 /*========== Extern Constant and Variable Definitions =======================*/
@@ -150,8 +165,56 @@ OS_TASK_DEFINITION_s ftsk_taskDefinitionAfe = {
     FTSK_TASK_AFE_PV_PARAMETERS};
 
 /*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   Runs the measurement redundancy validation once per new measurement
+ * @details The AFE and the pack measurement validation are triggered by the
+ *          database write notifications of their input data blocks instead of
+ *          running both every 50ms. At most one validation runs per cycle to
+ *          spread the load evenly; if both are pending, the validation that
+ *          waited longer runs first.
+ *          Each validation runs at the latest after
+ *          #TASK_10MS_COUNTER_FOR_50MS cycles.
+ * @param[in,out]   pState  state of the measurement validation
+ */
+static void FTSK_ValidateMeasurements(FTSK_MEASUREMENT_VALIDATION_STATE_s *pState);
 
 /*========== Static Function Implementations ================================*/
+static void FTSK_ValidateMeasurements(FTSK_MEASUREMENT_VALIDATION_STATE_s *pState) {
+    FAS_ASSERT(pState != NULL_PTR);
+
+    if (DATA_ConsumeWriteNotifications(DATA_SUBSCRIBER_AFE_MEASUREMENT_VALIDATION) != 0u) {
+        pState->afeValidationPending = true;
+    }
+    if (DATA_ConsumeWriteNotifications(DATA_SUBSCRIBER_PACK_MEASUREMENT_VALIDATION) != 0u) {
+        pState->packValidationPending = true;
+    }
+
+    if (pState->cyclesSinceAfeValidation < UINT8_MAX) {
+        pState->cyclesSinceAfeValidation++;
+    }
+    if (pState->cyclesSincePackValidation < UINT8_MAX) {
+        pState->cyclesSincePackValidation++;
+    }
+    if (pState->cyclesSinceAfeValidation >= TASK_10MS_COUNTER_FOR_50MS) {
+        pState->afeValidationPending = true;
+    }
+    if (pState->cyclesSincePackValidation >= TASK_10MS_COUNTER_FOR_50MS) {
+        pState->packValidationPending = true;
+    }
+
+    const bool afeWaitedLonger = (pState->cyclesSinceAfeValidation >= pState->cyclesSincePackValidation);
+    if ((pState->afeValidationPending == true) && ((pState->packValidationPending == false) || afeWaitedLonger)) {
+        (void)MRC_ValidateAfeMeasurement();
+        pState->afeValidationPending     = false;
+        pState->cyclesSinceAfeValidation = 0u;
+    } else if (pState->packValidationPending == true) {
+        (void)MRC_ValidatePackMeasurement();
+        pState->packValidationPending     = false;
+        pState->cyclesSincePackValidation = 0u;
+    } else {
+        /* no new measurement values: nothing to validate */
+    }
+}
 
 /*========== Extern Function Implementations ================================*/
 extern void FTSK_InitializeUserCodeEngine(void) {
@@ -235,7 +298,12 @@ extern void FTSK_RunUserCodeCyclic1ms(void) {
 }
 
 extern void FTSK_RunUserCodeCyclic10ms(void) {
-    static uint8_t ftsk_cyclic10msCounter = 0;
+    static FTSK_MEASUREMENT_VALIDATION_STATE_s ftsk_measurementValidationState = {
+        .afeValidationPending      = false,
+        .packValidationPending     = false,
+        .cyclesSinceAfeValidation  = 0u,
+        .cyclesSincePackValidation = 0u,
+    };
     /* user code */
     SYSM_UpdateFramData();
     SYS_Trigger(&sys_state);
@@ -243,21 +311,20 @@ extern void FTSK_RunUserCodeCyclic10ms(void) {
     ADC_Control();
     SPS_Ctrl();
     CAN_MainFunction();
+    CANTX_SnapshotTransmit();
     SOF_Calculation();
     ALGO_MonitorExecutionTime();
     SBC_Trigger(&sbc_stateMcuSupervisor);
 
-    if (ftsk_cyclic10msCounter == TASK_10MS_COUNTER_FOR_50MS) {
-        MRC_ValidateAfeMeasurement();
-        MRC_ValidatePackMeasurement();
-        ftsk_cyclic10msCounter = 0;
-    }
+    /* Validate new measurement values before the BMS_Trigger, so that the
+     * SOA checks evaluate the minimum and maximum values of the latest
+     * measurement in the same cycle */
+    FTSK_ValidateMeasurements(&ftsk_measurementValidationState);
     /* Call BMS_Trigger function at the end of the 10ms task to allow previously
      * called modules in this task to update respectively evaluate their new.
      * This minimizes the delay between data evaluation and the reaction from
      * the BMS module */
     BMS_Trigger();
-    ftsk_cyclic10msCounter++;
 }
 
 extern void FTSK_RunUserCodeCyclic100ms(void) {
@@ -294,6 +361,8 @@ void FTSK_RunUserCodeI2c(void) {
     PEX_Trigger();
     HTSEN_Trigger();
     RTC_Trigger();
+    /* run the transactions enqueued by the drivers, the task sleeps during the DMA transfers */
+    (void)I2C_ProcessTransactionQueue();
     uint32_t current_time = OS_GetTickCount();
     OS_DelayTaskUntil(&current_time, 2u);
 }
@@ -311,4 +380,7 @@ extern void FTSK_RunUserCodeIdle(void) {
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
+extern void TEST_FTSK_ValidateMeasurements(FTSK_MEASUREMENT_VALIDATION_STATE_s *pState) {
+    FTSK_ValidateMeasurements(pState);
+}
 #endif
@@ -43,7 +43,7 @@
  * @file    ftask_cfg.h
  * @author  foxBMS Team
  * @date    2019-08-26 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup TASK_CONFIGURATION
  * @prefix  FTSK
@@ -59,6 +59,7 @@
 
 #include "os.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
@@ -182,6 +183,14 @@
 /** @brief pvParameters of the continuously running task for AFEs  */
 #define FTSK_TASK_AFE_PV_PARAMETERS (NULL_PTR)
 
+/** state of the measurement redundancy validation in the cyclic 10ms task */
+typedef struct {
+    bool afeValidationPending;         /*!< new AFE measurement values are waiting for validation */
+    bool packValidationPending;        /*!< new pack measurement values are waiting for validation */
+    uint8_t cyclesSinceAfeValidation;  /*!< 10ms task cycles since the last AFE measurement validation */
+    uint8_t cyclesSincePackValidation; /*!< 10ms task cycles since the last pack measurement validation */
+} FTSK_MEASUREMENT_VALIDATION_STATE_s;
+
 /*========== Extern Constant and Variable Declarations ======================*/
 /**
  * @brief   Task configuration of the engine task
@@ -309,6 +318,7 @@ extern void FTSK_RunUserCodeIdle(void);
 
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
+extern void TEST_FTSK_ValidateMeasurements(FTSK_MEASUREMENT_VALIDATION_STATE_s *pState);
 #endif
 
 #endif /* FOXBMS__FTASK_CFG_H_ */
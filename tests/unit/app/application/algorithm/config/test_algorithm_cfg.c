@@ -43,7 +43,7 @@
  * @file    test_algorithm_cfg.c
  * @author  foxBMS Team
  * @date    2020-06-30 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -55,6 +55,7 @@
 /*========== Includes =======================================================*/
 #include "unity.h"
 #include "Mockdatabase.h"
+#include "Mockload_spectrum.h"
 #include "Mockmoving_average.h"
 #include "Mockos.h"
 
@@ -64,7 +65,9 @@
 
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_INCLUDE_PATH("../../src/app/application/algorithm/config")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/load_spectrum")
 TEST_INCLUDE_PATH("../../src/app/application/algorithm/moving_average")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
 
@@ -0,0 +1,428 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_load_spectrum.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the lifetime load spectrum
+ * @details The load spectrum is fed with a synthetic daily drive cycle:
+ *          driving with recuperation, parking, and charging.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockdatabase.h"
+#include "Mockdatabase_helper.h"
+#include "Mockdiag.h"
+#include "Mockfram.h"
+
+#include "battery_cell_cfg.h"
+#include "load_spectrum_cfg.h"
+
+#include "load_spectrum.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#include <time.h>
+#endif
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("load_spectrum.c")
+TEST_SOURCE_FILE("foxmath.c")
+
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/load_spectrum")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
+TEST_INCLUDE_PATH("../../src/app/driver/fram")
+TEST_INCLUDE_PATH("../../src/app/engine/diag")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** duration of a day in s */
+#define TEST_DAY_s (86400u)
+
+/** driving pattern: discharge with 1C, followed by recuperation with 0.5C @{*/
+#define TEST_DRIVE_DISCHARGE_s (50u)
+#define TEST_DRIVE_REGEN_s     (10u)
+/**@}*/
+
+/** SOC window of the daily cycle in % @{*/
+#define TEST_SOC_HIGH_perc (90.0f)
+#define TEST_SOC_LOW_perc  (30.0f)
+/**@}*/
+
+/** currents of the drive cycle in mA, positive in discharge direction @{*/
+#define TEST_CURRENT_1C_mA     ((int32_t)BC_CAPACITY_mAh)
+#define TEST_CURRENT_HALF_C_mA ((int32_t)BC_CAPACITY_mAh / 2)
+/**@}*/
+
+FRAM_LOAD_SPECTRUM_s fram_loadSpectrum = {0};
+
+/** content of the FRAM, i.e., the last checkpoint */
+static FRAM_LOAD_SPECTRUM_s test_framImage = {0};
+
+/** return value of the stubbed FRAM read access */
+static FRAM_RETURN_TYPE_e test_framReadResult = FRAM_ACCESS_OK;
+
+/** number of checkpoints written to the FRAM */
+static uint32_t test_nrOfCheckpoints = 0u;
+
+/** simulated SOC in % */
+static float_t test_soc_perc = TEST_SOC_HIGH_perc;
+
+/** time spent in the discharge bin of 1C to 1.5C in s */
+static uint32_t test_dischargeTime_s = 0u;
+
+static DATA_BLOCK_MIN_MAX_s test_tableMinMax               = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+static DATA_BLOCK_SOC_s test_tableSoc                      = {.header.uniqueId = DATA_BLOCK_ID_SOC};
+static DATA_BLOCK_CURRENT_SENSOR_s test_tableCurrentSensor = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_SENSOR};
+
+static STD_RETURN_TYPE_e TEST_DATA_Read3DataBlocks(
+    void *pDataToReceiver0,
+    void *pDataToReceiver1,
+    void *pDataToReceiver2,
+    int numCalls) {
+    (void)numCalls;
+    *(DATA_BLOCK_MIN_MAX_s *)pDataToReceiver0        = test_tableMinMax;
+    *(DATA_BLOCK_SOC_s *)pDataToReceiver1            = test_tableSoc;
+    *(DATA_BLOCK_CURRENT_SENSOR_s *)pDataToReceiver2 = test_tableCurrentSensor;
+    return STD_OK;
+}
+
+static bool TEST_DATA_DatabaseEntryUpdatedAtLeastOnce(DATA_BLOCK_HEADER_s dataBlockHeader, int numCalls) {
+    (void)numCalls;
+    return (dataBlockHeader.timestamp != 0u) || (dataBlockHeader.previousTimestamp != 0u);
+}
+
+static FRAM_RETURN_TYPE_e TEST_FRAM_ReadData(FRAM_BLOCK_ID_e blockId, int numCalls) {
+    (void)numCalls;
+    TEST_ASSERT_EQUAL(FRAM_BLOCK_ID_LOAD_SPECTRUM, blockId);
+    if (test_framReadResult == FRAM_ACCESS_OK) {
+        fram_loadSpectrum = test_framImage;
+    }
+    return test_framReadResult;
+}
+
+static FRAM_RETURN_TYPE_e TEST_FRAM_WriteData(FRAM_BLOCK_ID_e blockId, int numCalls) {
+    (void)numCalls;
+    TEST_ASSERT_EQUAL(FRAM_BLOCK_ID_LOAD_SPECTRUM, blockId);
+    test_framImage = fram_loadSpectrum;
+    test_nrOfCheckpoints++;
+    return FRAM_ACCESS_OK;
+}
+
+/** simulates one second of the string and updates the load spectrum */
+static void TEST_Step(int32_t current_mA, int16_t temperature_ddegC) {
+    test_soc_perc -= (100.0f * (float_t)current_mA) / ((float_t)BC_CAPACITY_mAh * 3600.0f);
+
+    test_tableSoc.header.timestamp                    = test_tableSoc.header.timestamp + 1000u;
+    test_tableSoc.averageSoc_perc[0]                  = test_soc_perc;
+    test_tableCurrentSensor.header.timestamp          = test_tableCurrentSensor.header.timestamp + 1000u;
+    test_tableCurrentSensor.current_mA[0]             = current_mA;
+    test_tableMinMax.maximumTemperature_ddegC[0]      = temperature_ddegC;
+    test_tableMinMax.validMeasuredCellTemperatures[0] = 1u;
+    if (current_mA == TEST_CURRENT_1C_mA) {
+        test_dischargeTime_s++;
+    }
+    LSP_UpdateLoadSpectrum();
+}
+
+/** one day: driving from 90% to 30% SOC, parking, charging with 0.5C to 90% SOC, parking */
+static void TEST_RunDays(uint32_t numberOfDays) {
+    for (uint32_t day = 0u; day < numberOfDays; day++) {
+        uint32_t time_s = 0u;
+        while (test_soc_perc > TEST_SOC_LOW_perc) {
+            for (uint32_t t = 0u; t < TEST_DRIVE_DISCHARGE_s; t++) {
+                TEST_Step(TEST_CURRENT_1C_mA, 350);
+            }
+            for (uint32_t t = 0u; t < TEST_DRIVE_REGEN_s; t++) {
+                TEST_Step(-TEST_CURRENT_HALF_C_mA, 350);
+            }
+            time_s += TEST_DRIVE_DISCHARGE_s + TEST_DRIVE_REGEN_s;
+        }
+        while (test_soc_perc < TEST_SOC_HIGH_perc) {
+            TEST_Step(-TEST_CURRENT_HALF_C_mA, 300);
+            time_s++;
+        }
+        for (; time_s < TEST_DAY_s; time_s++) {
+            TEST_Step(0, 250);
+        }
+    }
+}
+
+static uint32_t TEST_SumOfBins(const uint32_t *pBins, uint32_t nrOfBins) {
+    uint32_t sum = 0u;
+    for (uint32_t i = 0u; i < nrOfBins; i++) {
+        sum += pBins[i];
+    }
+    return sum;
+}
+
+/** sweeps the SOC linearly in steps of 0.1% from one reversal to the next */
+static void TEST_SweepSoc(const int16_t *pReversals_dperc, uint8_t nrOfReversals) {
+    TEST_LSP_CountCycles(0u, (uint16_t)pReversals_dperc[0u]);
+    for (uint8_t i = 1u; i < nrOfReversals; i++) {
+        const int16_t step = (pReversals_dperc[i] > pReversals_dperc[i - 1u]) ? 1 : -1;
+        for (int16_t soc = pReversals_dperc[i - 1u] + step; soc != (pReversals_dperc[i] + step); soc += step) {
+            TEST_LSP_CountCycles(0u, (uint16_t)soc);
+        }
+    }
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    DATA_Read3DataBlocks_Stub(TEST_DATA_Read3DataBlocks);
+    FRAM_ReadData_Stub(TEST_FRAM_ReadData);
+    FRAM_WriteData_Stub(TEST_FRAM_WriteData);
+    DATA_DatabaseEntryUpdatedAtLeastOnce_Stub(TEST_DATA_DatabaseEntryUpdatedAtLeastOnce);
+    test_framReadResult                      = FRAM_ACCESS_CRC_ERROR;
+    test_nrOfCheckpoints                     = 0u;
+    test_dischargeTime_s                     = 0u;
+    test_soc_perc                            = TEST_SOC_HIGH_perc;
+    test_tableSoc.header.timestamp           = 0u;
+    test_tableCurrentSensor.header.timestamp = 0u;
+    DIAG_Handler_ExpectAndReturn(DIAG_ID_LOAD_SPECTRUM_RESET, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u, STD_OK);
+    TEST_ASSERT_EQUAL(STD_OK, LSP_Initialize());
+    test_framReadResult = FRAM_ACCESS_OK;
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testInitialization(void) {
+    /* a load spectrum that has never been stored or is corrupt is cleared and reported */
+    fram_loadSpectrum.socResidency_s[0][3] = 42u;
+    test_framReadResult                    = FRAM_ACCESS_CRC_ERROR;
+    DIAG_Handler_ExpectAndReturn(DIAG_ID_LOAD_SPECTRUM_RESET, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u, STD_OK);
+    TEST_ASSERT_EQUAL(STD_OK, LSP_Initialize());
+    TEST_ASSERT_EQUAL(0u, fram_loadSpectrum.socResidency_s[0][3]);
+
+    /* an implausible residue is discarded, the histograms are kept */
+    test_framReadResult                 = FRAM_ACCESS_OK;
+    test_framImage                      = fram_loadSpectrum;
+    test_framImage.socResidency_s[0][3] = 42u;
+    test_framImage.nrOfResidues[0]      = 2u;
+    test_framImage.residue_dperc[0][1]  = 1001u;
+    TEST_ASSERT_EQUAL(STD_OK, LSP_Initialize());
+    TEST_ASSERT_EQUAL(42u, fram_loadSpectrum.socResidency_s[0][3]);
+    TEST_ASSERT_EQUAL(0u, fram_loadSpectrum.nrOfResidues[0]);
+
+    /* the stored load spectrum is not overwritten if the FRAM is not accessible */
+    test_framReadResult = FRAM_ACCESS_SPI_BUSY;
+    TEST_ASSERT_EQUAL(STD_NOT_OK, LSP_Initialize());
+    for (uint32_t t = 0u; t < (2u * LSP_CHECKPOINT_PERIOD_s); t++) {
+        TEST_Step(0, 250);
+    }
+    TEST_ASSERT_EQUAL(0u, test_nrOfCheckpoints);
+    TEST_ASSERT_EQUAL(42u, fram_loadSpectrum.socResidency_s[0][3]);
+}
+
+/** SOC and current are not counted before their database entries have been written for the first time */
+void testSamplesBeforeFirstUpdateAreSkipped(void) {
+    test_tableMinMax.maximumTemperature_ddegC[0]      = 250;
+    test_tableMinMax.validMeasuredCellTemperatures[0] = 1u;
+    test_tableSoc.averageSoc_perc[0]                  = 0.0f;
+    test_tableCurrentSensor.current_mA[0]             = 0;
+    LSP_UpdateLoadSpectrum();
+    TEST_ASSERT_EQUAL(
+        1u, TEST_SumOfBins(fram_loadSpectrum.temperatureResidency_s[0], FRAM_LOAD_SPECTRUM_NR_OF_TEMPERATURE_BINS));
+    TEST_ASSERT_EQUAL(0u, TEST_SumOfBins(fram_loadSpectrum.socResidency_s[0], FRAM_LOAD_SPECTRUM_NR_OF_SOC_BINS));
+    TEST_ASSERT_EQUAL(0u, fram_loadSpectrum.nrOfResidues[0]);
+    TEST_ASSERT_EQUAL(
+        0u, TEST_SumOfBins(fram_loadSpectrum.cRateResidency_s[0], FRAM_LOAD_SPECTRUM_NR_OF_C_RATE_BINS));
+
+    /* the current is measured before the state estimation has been initialized */
+    test_tableCurrentSensor.header.timestamp = 1000u;
+    LSP_UpdateLoadSpectrum();
+    TEST_ASSERT_EQUAL(0u, TEST_SumOfBins(fram_loadSpectrum.socResidency_s[0], FRAM_LOAD_SPECTRUM_NR_OF_SOC_BINS));
+    TEST_ASSERT_EQUAL(0u, fram_loadSpectrum.nrOfResidues[0]);
+    TEST_ASSERT_EQUAL(
+        1u, TEST_SumOfBins(fram_loadSpectrum.cRateResidency_s[0], FRAM_LOAD_SPECTRUM_NR_OF_C_RATE_BINS));
+
+    /* the first SOC after the initialization of the state estimation starts the rainflow counting */
+    test_tableSoc.header.timestamp   = 1000u;
+    test_tableSoc.averageSoc_perc[0] = 75.0f;
+    LSP_UpdateLoadSpectrum();
+    TEST_ASSERT_EQUAL(1u, fram_loadSpectrum.socResidency_s[0][7]);
+    TEST_ASSERT_EQUAL(1u, fram_loadSpectrum.nrOfResidues[0]);
+    TEST_ASSERT_EQUAL(750u, fram_loadSpectrum.residue_dperc[0][0]);
+}
+
+void testBinLimits(void) {
+    /* lower limit of a bin, values outside of the range in the outer bins */
+    test_soc_perc = 20.0f;
+    TEST_Step(TEST_CURRENT_1C_mA, -400);
+    TEST_ASSERT_EQUAL(1u, fram_loadSpectrum.temperatureResidency_s[0][0]);
+    TEST_ASSERT_EQUAL(1u, fram_loadSpectrum.cRateResidency_s[0][8]);
+
+    test_soc_perc = 100.5f;
+    TEST_Step(-4 * TEST_CURRENT_1C_mA, 1000);
+    TEST_ASSERT_EQUAL(1u, fram_loadSpectrum.temperatureResidency_s[0][FRAM_LOAD_SPECTRUM_NR_OF_TEMPERATURE_BINS - 1u]);
+    TEST_ASSERT_EQUAL(1u, fram_loadSpectrum.socResidency_s[0][FRAM_LOAD_SPECTRUM_NR_OF_SOC_BINS - 1u]);
+    TEST_ASSERT_EQUAL(1u, fram_loadSpectrum.cRateResidency_s[0][0]);
+
+    /* small charge currents are not sorted into the rest bin */
+    test_soc_perc = 50.0f;
+    TEST_Step(-1, 0);
+    TEST_ASSERT_EQUAL(1u, fram_loadSpectrum.temperatureResidency_s[0][2]);
+    TEST_ASSERT_EQUAL(1u, fram_loadSpectrum.socResidency_s[0][5]);
+    TEST_ASSERT_EQUAL(1u, fram_loadSpectrum.cRateResidency_s[0][5]);
+
+    /* invalid measurements are not counted */
+    test_tableCurrentSensor.invalidCurrentMeasurement[0] = 1u;
+    TEST_Step(0, 0);
+    test_tableCurrentSensor.invalidCurrentMeasurement[0] = 0u;
+    TEST_ASSERT_EQUAL(4u, TEST_SumOfBins(fram_loadSpectrum.socResidency_s[0], FRAM_LOAD_SPECTRUM_NR_OF_SOC_BINS));
+    TEST_ASSERT_EQUAL(
+        3u, TEST_SumOfBins(fram_loadSpectrum.cRateResidency_s[0], FRAM_LOAD_SPECTRUM_NR_OF_C_RATE_BINS));
+}
+
+/** example of ASTM E1049, figure 6, with 1 unit corresponding to 10% SOC */
+void testRainflowCounting(void) {
+    const int16_t reversals_dperc[] = {300, 600, 200, 1000, 400, 800, 100, 900, 300};
+    TEST_SweepSoc(reversals_dperc, (uint8_t)(sizeof(reversals_dperc) / sizeof(reversals_dperc[0])));
+
+    /* the residue is counted as half cycles at the end of the history */
+    uint32_t halfCycles[FRAM_LOAD_SPECTRUM_NR_OF_CYCLE_BINS] = {0};
+    for (uint8_t i = 0u; i < FRAM_LOAD_SPECTRUM_NR_OF_CYCLE_BINS; i++) {
+        halfCycles[i] = fram_loadSpectrum.halfCycles[0][i];
+    }
+    for (uint8_t i = 1u; i < fram_loadSpectrum.nrOfResidues[0]; i++) {
+        const int32_t range_dperc =
+            abs((int32_t)fram_loadSpectrum.residue_dperc[0][i] - (int32_t)fram_loadSpectrum.residue_dperc[0][i - 1u]);
+        halfCycles[range_dperc / LSP_CYCLE_BIN_WIDTH_dperc]++;
+    }
+
+    /* ranges of 3: 0.5 cycles, 4: 1.5 cycles, 6: 0.5 cycles, 8: 1.0 cycles, 9: 0.5 cycles */
+    const uint32_t expectedHalfCycles[FRAM_LOAD_SPECTRUM_NR_OF_CYCLE_BINS] = {0u, 0u, 0u, 1u, 3u, 0u, 1u, 0u, 2u, 1u};
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expectedHalfCycles, halfCycles, FRAM_LOAD_SPECTRUM_NR_OF_CYCLE_BINS);
+}
+
+void testResidueIsBounded(void) {
+    /* random walk with reversals of all sizes and noise within the hysteresis */
+    srand(4u);
+    int32_t soc_dperc = 500;
+    for (uint32_t i = 0u; i < 100000u; i++) {
+        soc_dperc += (rand() % 41) - 20;
+        soc_dperc  = (soc_dperc < 0) ? 0 : ((soc_dperc > 1000) ? 1000 : soc_dperc);
+        TEST_LSP_CountCycles(0u, (uint16_t)soc_dperc);
+        TEST_ASSERT_LESS_OR_EQUAL(FRAM_LOAD_SPECTRUM_NR_OF_RESIDUES, fram_loadSpectrum.nrOfResidues[0]);
+    }
+    /* the residue alternates between peaks and valleys */
+    for (uint8_t i = 2u; i < fram_loadSpectrum.nrOfResidues[0]; i++) {
+        const int32_t previous = (int32_t)fram_loadSpectrum.residue_dperc[0][i - 1u] -
+                                 (int32_t)fram_loadSpectrum.residue_dperc[0][i - 2u];
+        const int32_t current =
+            (int32_t)fram_loadSpectrum.residue_dperc[0][i] - (int32_t)fram_loadSpectrum.residue_dperc[0][i - 1u];
+        TEST_ASSERT_TRUE((previous * current) < 0);
+    }
+}
+
+void testSyntheticDriveCycle(void) {
+    const uint32_t numberOfDays = 10u;
+    TEST_RunDays(numberOfDays);
+
+    const uint32_t totalTime_s = numberOfDays * TEST_DAY_s;
+    TEST_ASSERT_EQUAL(
+        totalTime_s,
+        TEST_SumOfBins(fram_loadSpectrum.temperatureResidency_s[0], FRAM_LOAD_SPECTRUM_NR_OF_TEMPERATURE_BINS));
+    TEST_ASSERT_EQUAL(
+        totalTime_s, TEST_SumOfBins(fram_loadSpectrum.socResidency_s[0], FRAM_LOAD_SPECTRUM_NR_OF_SOC_BINS));
+    TEST_ASSERT_EQUAL(
+        totalTime_s, TEST_SumOfBins(fram_loadSpectrum.cRateResidency_s[0], FRAM_LOAD_SPECTRUM_NR_OF_C_RATE_BINS));
+    TEST_ASSERT_EQUAL(test_dischargeTime_s, fram_loadSpectrum.cRateResidency_s[0][8]);
+    TEST_ASSERT_EQUAL(totalTime_s / LSP_CHECKPOINT_PERIOD_s, test_nrOfCheckpoints);
+
+    /* one cycle of 60% depth per day, the last two half cycles are still open; the recuperation is filtered by the
+     * hysteresis */
+    TEST_ASSERT_EQUAL(3u, fram_loadSpectrum.nrOfResidues[0]);
+    TEST_ASSERT_EQUAL((2u * numberOfDays) - 2u, fram_loadSpectrum.halfCycles[0][6]);
+    TEST_ASSERT_EQUAL(
+        fram_loadSpectrum.halfCycles[0][6],
+        TEST_SumOfBins(fram_loadSpectrum.halfCycles[0], FRAM_LOAD_SPECTRUM_NR_OF_CYCLE_BINS));
+}
+
+void testRestartAfterCheckpoint(void) {
+    TEST_RunDays(6u);
+    const FRAM_LOAD_SPECTRUM_s uninterrupted = fram_loadSpectrum;
+
+    /* the same history with a restart after three days, i.e., directly after a checkpoint */
+    test_framReadResult = FRAM_ACCESS_CRC_ERROR;
+    DIAG_Handler_ExpectAndReturn(DIAG_ID_LOAD_SPECTRUM_RESET, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u, STD_OK);
+    TEST_ASSERT_EQUAL(STD_OK, LSP_Initialize());
+    test_framReadResult = FRAM_ACCESS_OK;
+    test_soc_perc       = TEST_SOC_HIGH_perc;
+    TEST_RunDays(3u);
+    (void)memset(&fram_loadSpectrum, 0xFF, sizeof(fram_loadSpectrum));
+    TEST_ASSERT_EQUAL(STD_OK, LSP_Initialize());
+    TEST_RunDays(3u);
+    TEST_ASSERT_EQUAL_MEMORY(&uninterrupted, &fram_loadSpectrum, sizeof(fram_loadSpectrum));
+}
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+/** host benchmark: reports the cost per sample of the algorithm */
+void testUpdateCostPerSample(void) {
+    const clock_t start = clock();
+    TEST_RunDays(1u);
+    const clock_t stop = clock();
+
+    /* includes the simulation of the synthetic string, i.e., it is an upper bound */
+    char message[100] = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "cost per sample: %.0f ns (host), %u B in FRAM",
+        (1.0e9 * (double)(stop - start)) / ((double)CLOCKS_PER_SEC * (double)TEST_DAY_s),
+        (unsigned int)sizeof(FRAM_LOAD_SPECTRUM_s));
+    TEST_MESSAGE(message);
+}
+#endif
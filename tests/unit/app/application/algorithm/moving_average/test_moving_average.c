@@ -43,7 +43,7 @@
  * @file    test_moving_average.c
  * @author  foxBMS Team
  * @date    2020-07-01 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -55,18 +55,51 @@
 /*========== Includes =======================================================*/
 #include "unity.h"
 #include "Mockdatabase.h"
+#include "Mockfassert.h"
 #include "Mockos.h"
 
 #include "moving_average.h"
+#include "test_assert_helper.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#endif
 
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_INCLUDE_PATH("../../src/app/application/algorithm/config")
 TEST_INCLUDE_PATH("../../src/app/application/algorithm/moving_average")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
+/** sample rate of the current sensor in the accuracy test */
+#define TEST_SAMPLES_PER_SECOND (5u)
+
+/** simulated duration of the accuracy test */
+#define TEST_DURATION_s (7200u)
+
+#define TEST_NUMBER_OF_SAMPLES (TEST_SAMPLES_PER_SECOND * TEST_DURATION_s)
+
+/** prefix sums of the samples as reference for the full-rate ring buffer */
+static double test_prefixSum[TEST_NUMBER_OF_SAMPLES + 1u] = {0.0};
+
+static ALGO_CASCADED_AVERAGE_s test_cascade = {0};
+
+/** slowly varying current with load steps and noise in mA */
+static float_t TEST_GetCurrent_mA(uint32_t sample) {
+    const double time_s = (double)sample / (double)TEST_SAMPLES_PER_SECOND;
+    double current_mA   = 50000.0 + (40000.0 * sin((2.0 * 3.14159265358979 * time_s) / 1800.0));
+    if (((sample / (TEST_SAMPLES_PER_SECOND * 90u)) % 2u) == 0u) {
+        current_mA += 20000.0;
+    }
+    current_mA += (double)((rand() % 2001) - 1000);
+    return (float_t)current_mA;
+}
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    ALGO_InitializeCascadedAverage(&test_cascade, TEST_SAMPLES_PER_SECOND);
 }
 
 void tearDown(void) {
@@ -75,3 +108,91 @@ void tearDown(void) {
 /*========== Test Cases =====================================================*/
 void testDummy(void) {
 }
+
+void testCascadedAverageInvalidInput(void) {
+    TEST_ASSERT_FAIL_ASSERT(ALGO_InitializeCascadedAverage(NULL_PTR, 1u));
+    TEST_ASSERT_FAIL_ASSERT(ALGO_InitializeCascadedAverage(&test_cascade, 0u));
+    TEST_ASSERT_FAIL_ASSERT(ALGO_AddToCascadedAverage(NULL_PTR, 0.0f));
+    TEST_ASSERT_FAIL_ASSERT(ALGO_GetCascadedAverage(NULL_PTR, 1u));
+    TEST_ASSERT_FAIL_ASSERT(ALGO_GetCascadedAverage(&test_cascade, 0u));
+}
+
+void testCascadedAverageWithoutSamples(void) {
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, ALGO_GetCascadedAverage(&test_cascade, 100u));
+}
+
+/** as long as the window is not filled, the average of all samples is returned */
+void testCascadedAverageWarmUp(void) {
+    for (uint32_t sample = 1u; sample <= 12u; sample++) {
+        ALGO_AddToCascadedAverage(&test_cascade, (float_t)sample);
+    }
+    TEST_ASSERT_EQUAL_FLOAT(6.5f, ALGO_GetCascadedAverage(&test_cascade, 3600u));
+    /* the 2 samples of the current bucket and the latest completed bucket */
+    TEST_ASSERT_EQUAL_FLOAT(9.0f, ALGO_GetCascadedAverage(&test_cascade, 7u));
+}
+
+/** the oldest bucket of the window is weighted with its share inside the window */
+void testCascadedAverageOldestBucketShare(void) {
+    for (uint32_t sample = 0u; sample < 10u; sample++) {
+        ALGO_AddToCascadedAverage(&test_cascade, (sample < 5u) ? 10.0f : 20.0f);
+    }
+    /* complete bucket with 20 and 2 of 5 samples of the bucket with 10 */
+    TEST_ASSERT_EQUAL_FLOAT(((5.0f * 20.0f) + (2.0f * 10.0f)) / 7.0f, ALGO_GetCascadedAverage(&test_cascade, 7u));
+}
+
+/**
+ * accuracy test: the cascaded moving average is compared with the exact
+ * average of a full-rate ring buffer for windows of up to one hour
+ */
+void testCascadedAverageAccuracyAndMemory(void) {
+    const uint32_t windows_s[] = {10u, 60u, 600u, 3600u};
+    double maximumError_mA[]   = {0.0, 0.0, 0.0, 0.0};
+    srand(11u);
+
+    for (uint32_t sample = 0u; sample < TEST_NUMBER_OF_SAMPLES; sample++) {
+        const float_t current_mA       = TEST_GetCurrent_mA(sample);
+        test_prefixSum[sample + 1u]    = test_prefixSum[sample] + (double)current_mA;
+        const uint32_t numberOfSamples = sample + 1u;
+        ALGO_AddToCascadedAverage(&test_cascade, current_mA);
+
+        for (uint8_t w = 0u; w < (sizeof(windows_s) / sizeof(windows_s[0])); w++) {
+            const uint32_t windowSamples = windows_s[w] * TEST_SAMPLES_PER_SECOND;
+            if (numberOfSamples >= windowSamples) {
+                const double expected_mA =
+                    (test_prefixSum[numberOfSamples] - test_prefixSum[numberOfSamples - windowSamples]) /
+                    (double)windowSamples;
+                const float_t average_mA = ALGO_GetCascadedAverage(&test_cascade, windowSamples);
+                const double error_mA    = fabs(expected_mA - (double)average_mA);
+                if (error_mA > maximumError_mA[w]) {
+                    maximumError_mA[w] = error_mA;
+                }
+            }
+        }
+    }
+
+    /* the error is caused by the share of the oldest bucket and stays far below the signal range of 100A */
+    TEST_ASSERT_TRUE(maximumError_mA[0] < 1000.0);
+    TEST_ASSERT_TRUE(maximumError_mA[1] < 1000.0);
+    TEST_ASSERT_TRUE(maximumError_mA[2] < 1000.0);
+    TEST_ASSERT_TRUE(maximumError_mA[3] < 1000.0);
+
+    /* memory of a full-rate ring buffer for a window of one hour */
+    const size_t ringBufferSize = 3600u * TEST_SAMPLES_PER_SECOND * sizeof(float_t);
+    const size_t cascadeSize    = sizeof(ALGO_CASCADED_AVERAGE_s);
+    TEST_ASSERT_TRUE((cascadeSize * 10u) < ringBufferSize);
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+    char message[200] = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "RAM: %u B (cascade) vs %u B (1h ring); max. error: %.0f/%.0f/%.0f/%.0f mA (10s/60s/10min/1h)",
+        (unsigned int)cascadeSize,
+        (unsigned int)ringBufferSize,
+        maximumError_mA[0],
+        maximumError_mA[1],
+        maximumError_mA[2],
+        maximumError_mA[3]);
+    TEST_MESSAGE(message);
+#endif
+}
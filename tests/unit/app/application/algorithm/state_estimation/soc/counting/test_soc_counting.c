@@ -84,6 +84,15 @@ TEST_INCLUDE_PATH("../../src/app/task/config")
 /*========== Definitions and Implementations for Unit Test ==================*/
 FRAM_SOC_s fram_soc = {0};
 
+static DATA_BLOCK_CURRENT_SENSOR_s test_tableCurrentSensor = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_SENSOR};
+static DATA_BLOCK_SOC_s test_tableSoc                      = {.header.uniqueId = DATA_BLOCK_ID_SOC};
+
+static STD_RETURN_TYPE_e TEST_DATA_Read1DataBlock(void *pDataToReceiver0, int numCalls) {
+    (void)numCalls;
+    *(DATA_BLOCK_CURRENT_SENSOR_s *)pDataToReceiver0 = test_tableCurrentSensor;
+    return STD_OK;
+}
+
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
 }
@@ -99,3 +108,29 @@ void testSE_GetStateOfChargeFromVoltage(void) {
 }
 
 /*========== Test Cases =====================================================*/
+
+void testIntegrationOfCurrent(void) {
+    DATA_Read1DataBlock_Stub(TEST_DATA_Read1DataBlock);
+    FRAM_ReadData_IgnoreAndReturn(FRAM_ACCESS_OK);
+    FRAM_WriteData_IgnoreAndReturn(FRAM_ACCESS_OK);
+    BMS_GetBatterySystemState_IgnoreAndReturn(BMS_DISCHARGING);
+
+    fram_soc.averageSoc_perc[0]                 = 80.0f;
+    fram_soc.minimumSoc_perc[0]                 = 70.0f;
+    fram_soc.maximumSoc_perc[0]                 = 90.0f;
+    test_tableCurrentSensor.timestampCurrent[0] = 1000u;
+    SE_InitializeStateOfCharge(&test_tableSoc, false, 0u);
+
+    /* discharge with 1 A for one hour */
+    test_tableCurrentSensor.current_mA[0] = 1000;
+    for (uint32_t t = 1u; t <= 3600u; t++) {
+        test_tableCurrentSensor.timestampCurrent[0] = 1000u + (1000u * t);
+        SE_CalculateStateOfCharge(&test_tableSoc);
+    }
+
+    const float_t deltaSoc_perc = (1000.0f / (float_t)BC_CAPACITY_mAh) * 100.0f;
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 80.0f - deltaSoc_perc, test_tableSoc.averageSoc_perc[0]);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 70.0f - deltaSoc_perc, test_tableSoc.minimumSoc_perc[0]);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 90.0f - deltaSoc_perc, test_tableSoc.maximumSoc_perc[0]);
+    TEST_ASSERT_EQUAL_FLOAT(test_tableSoc.averageSoc_perc[0], fram_soc.averageSoc_perc[0]);
+}
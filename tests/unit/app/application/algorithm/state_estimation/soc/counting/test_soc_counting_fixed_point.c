@@ -0,0 +1,219 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_soc_counting_fixed_point.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the SOC module with fixed-point arithmetic
+ * @details The test is compiled with SE_USE_FIXED_POINT_ARITHMETIC=true (see
+ *          the unit test project configuration). The results are compared
+ *          with the floating point calculation.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockbms.h"
+#include "Mockdatabase.h"
+#include "Mockfram.h"
+
+#include "battery_cell_cfg.h"
+#include "soc_counting_cfg.h"
+
+#include "foxmath.h"
+#include "state_estimation.h"
+
+#include <math.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("soc_counting.c")
+TEST_SOURCE_FILE("soe_none.c")
+TEST_SOURCE_FILE("soh_none.c")
+
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/soc/counting")
+TEST_INCLUDE_PATH("../../src/app/application/bms")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/contactor")
+TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
+TEST_INCLUDE_PATH("../../src/app/driver/fram")
+TEST_INCLUDE_PATH("../../src/app/driver/sps")
+TEST_INCLUDE_PATH("../../src/app/task/config")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** resolution of the SOC in percent */
+#define TEST_SOC_RESOLUTION_perc (1.0f / 65536.0f)
+
+FRAM_SOC_s fram_soc = {0};
+
+static DATA_BLOCK_CURRENT_SENSOR_s test_tableCurrentSensor = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_SENSOR};
+static DATA_BLOCK_SOC_s test_tableSoc                      = {.header.uniqueId = DATA_BLOCK_ID_SOC};
+
+static STD_RETURN_TYPE_e TEST_DATA_Read1DataBlock(void *pDataToReceiver0, int numCalls) {
+    (void)numCalls;
+    *(DATA_BLOCK_CURRENT_SENSOR_s *)pDataToReceiver0 = test_tableCurrentSensor;
+    return STD_OK;
+}
+
+/** initializes the SOC of string 0 with 50% */
+static void TEST_InitializeSoc(bool ccPresent) {
+    fram_soc.averageSoc_perc[0] = 50.0f;
+    fram_soc.minimumSoc_perc[0] = 50.0f;
+    fram_soc.maximumSoc_perc[0] = 50.0f;
+
+    test_tableCurrentSensor.timestampCurrent[0]         = 0u;
+    test_tableCurrentSensor.timestampCurrentCounting[0] = 0u;
+    test_tableCurrentSensor.currentCounter_As[0]        = 0;
+    SE_InitializeStateOfCharge(&test_tableSoc, ccPresent, 0u);
+}
+
+/** SOC lookup as implemented with floating point arithmetic */
+static float_t TEST_GetStateOfChargeFromVoltage(int16_t voltage_mV) {
+    float_t soc_perc = 100.0f;
+    if (voltage_mV < bc_stateOfChargeLookupTable[bc_stateOfChargeLookupTableLength - 1u].voltage_mV) {
+        soc_perc = 0.0f;
+    }
+    /* the implementation does not interpolate between the first two entries */
+    for (uint16_t i = 2u; i < bc_stateOfChargeLookupTableLength; i++) {
+        if ((voltage_mV < bc_stateOfChargeLookupTable[i - 1u].voltage_mV) &&
+            (voltage_mV >= bc_stateOfChargeLookupTable[i].voltage_mV)) {
+            soc_perc = MATH_LinearInterpolation(
+                (float_t)bc_stateOfChargeLookupTable[i].voltage_mV,
+                bc_stateOfChargeLookupTable[i].value,
+                (float_t)bc_stateOfChargeLookupTable[i - 1u].voltage_mV,
+                bc_stateOfChargeLookupTable[i - 1u].value,
+                (float_t)voltage_mV);
+        }
+    }
+    return soc_perc;
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    DATA_Read1DataBlock_Stub(TEST_DATA_Read1DataBlock);
+    FRAM_ReadData_IgnoreAndReturn(FRAM_ACCESS_OK);
+    FRAM_WriteData_IgnoreAndReturn(FRAM_ACCESS_OK);
+    BMS_GetBatterySystemState_IgnoreAndReturn(BMS_DISCHARGING);
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testIntegrationEquivalentToFloat(void) {
+    TEST_InitializeSoc(false);
+
+    /* alternating discharge and charge pulses in steps of 100 ms for one hour */
+    double expectedSoc_perc = 50.0;
+    for (uint32_t t = 1u; t <= 36000u; t++) {
+        int32_t current_mA = 3500;
+        if ((t % 600u) >= 400u) {
+            current_mA = -5250;
+        }
+        test_tableCurrentSensor.current_mA[0]       = current_mA;
+        test_tableCurrentSensor.timestampCurrent[0] = 100u * t;
+        SE_CalculateStateOfCharge(&test_tableSoc);
+
+        expectedSoc_perc -= ((double)current_mA * 0.1 * 100.0) / (double)SOC_STRING_CAPACITY_mAs;
+        /* the integration error does not accumulate */
+        TEST_ASSERT_FLOAT_WITHIN(TEST_SOC_RESOLUTION_perc, (float_t)expectedSoc_perc, test_tableSoc.averageSoc_perc[0]);
+    }
+    TEST_ASSERT_EQUAL_FLOAT(test_tableSoc.averageSoc_perc[0], test_tableSoc.minimumSoc_perc[0]);
+    TEST_ASSERT_EQUAL_FLOAT(test_tableSoc.averageSoc_perc[0], fram_soc.averageSoc_perc[0]);
+}
+
+void testIntegrationOfSmallCurrent(void) {
+    TEST_InitializeSoc(false);
+
+    /* 1 mA for one day: the change per time step is smaller than the resolution of the SOC */
+    test_tableCurrentSensor.current_mA[0] = 1;
+    for (uint32_t t = 1u; t <= 86400u; t++) {
+        test_tableCurrentSensor.timestampCurrent[0] = 1000u * t;
+        SE_CalculateStateOfCharge(&test_tableSoc);
+    }
+    const float_t expectedSoc_perc = 50.0f - ((86400.0f * 100.0f) / SOC_STRING_CAPACITY_mAs);
+    TEST_ASSERT_FLOAT_WITHIN(TEST_SOC_RESOLUTION_perc, expectedSoc_perc, test_tableSoc.averageSoc_perc[0]);
+}
+
+void testIntegrationSaturates(void) {
+    TEST_InitializeSoc(false);
+
+    /* a time step with a charge larger than the capacity must not overflow */
+    test_tableCurrentSensor.current_mA[0]       = INT32_MIN;
+    test_tableCurrentSensor.timestampCurrent[0] = UINT32_MAX;
+    SE_CalculateStateOfCharge(&test_tableSoc);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, test_tableSoc.averageSoc_perc[0]);
+
+    test_tableCurrentSensor.current_mA[0]       = INT32_MAX;
+    test_tableCurrentSensor.timestampCurrent[0] = UINT32_MAX - 1u;
+    SE_CalculateStateOfCharge(&test_tableSoc);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, test_tableSoc.averageSoc_perc[0]);
+}
+
+void testCurrentCounterEquivalentToFloat(void) {
+    TEST_InitializeSoc(true);
+
+    for (int32_t counter_As = -5000; counter_As <= 5000; counter_As += 7) {
+        test_tableCurrentSensor.currentCounter_As[0] = counter_As;
+        test_tableCurrentSensor.timestampCurrentCounting[0]++;
+        SE_CalculateStateOfCharge(&test_tableSoc);
+
+        const float_t expectedSoc_perc = 50.0f - (((float_t)counter_As / SOC_STRING_CAPACITY_As) * 100.0f);
+        TEST_ASSERT_FLOAT_WITHIN(TEST_SOC_RESOLUTION_perc, expectedSoc_perc, test_tableSoc.averageSoc_perc[0]);
+    }
+}
+
+void testLookupTableEquivalentToFloat(void) {
+    for (int16_t voltage_mV = 2500; voltage_mV <= 4300; voltage_mV++) {
+        /* the quantization of the lookup table values dominates the difference */
+        TEST_ASSERT_FLOAT_WITHIN(
+            2.0f * TEST_SOC_RESOLUTION_perc,
+            TEST_GetStateOfChargeFromVoltage(voltage_mV),
+            SE_GetStateOfChargeFromVoltage(voltage_mV));
+    }
+    TEST_ASSERT_EQUAL_FLOAT(64.0f, SE_GetStateOfChargeFromVoltage(3780));
+}
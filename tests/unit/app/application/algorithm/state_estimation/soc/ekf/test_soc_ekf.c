@@ -0,0 +1,378 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_soc_ekf.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the extended Kalman filter based SOC estimation
+ * @details The accuracy tests drive a synthetic 1RC cell model with a drive
+ *          cycle and compare the estimated SOC with the SOC of the model.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockdatabase.h"
+#include "Mockfram.h"
+
+#include "battery_cell_cfg.h"
+#include "soc_ekf_cfg.h"
+
+#include "foxmath.h"
+#include "soc_ekf.h"
+#include "state_estimation.h"
+
+#include <math.h>
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#include <time.h>
+#endif
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("soc_ekf.c")
+
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/soc/ekf")
+TEST_INCLUDE_PATH("../../src/app/application/bms")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/contactor")
+TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
+TEST_INCLUDE_PATH("../../src/app/driver/fram")
+TEST_INCLUDE_PATH("../../src/app/driver/sps")
+TEST_INCLUDE_PATH("../../src/app/task/config")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** number of simulated cells: minimum, average and maximum cell of the string */
+#define TEST_NR_OF_CELLS (3u)
+
+/** duration of the simulated drive cycle in s */
+#define TEST_DRIVE_CYCLE_DURATION_s (3600u)
+
+/** ohmic resistance of the synthetic cell, deliberately 10% above the filter model */
+#define TEST_CELL_OHMIC_RESISTANCE_ohm (1.1f * SOC_EKF_OHMIC_RESISTANCE_ohm)
+
+FRAM_SOC_s fram_soc = {0};
+
+/** synthetic 1RC cell */
+typedef struct {
+    float_t soc_perc;    /*!< true SOC */
+    float_t rcVoltage_V; /*!< voltage over the RC element */
+} TEST_CELL_s;
+
+static DATA_BLOCK_CURRENT_SENSOR_s test_tableCurrentSensor = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_SENSOR};
+static DATA_BLOCK_MIN_MAX_s test_tableMinMax               = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+static DATA_BLOCK_SOC_s test_tableSoc                      = {.header.uniqueId = DATA_BLOCK_ID_SOC};
+
+static STD_RETURN_TYPE_e TEST_DATA_Read1DataBlock(void *pDataToReceiver0, int numCalls) {
+    (void)numCalls;
+    *(DATA_BLOCK_CURRENT_SENSOR_s *)pDataToReceiver0 = test_tableCurrentSensor;
+    return STD_OK;
+}
+
+static STD_RETURN_TYPE_e TEST_DATA_Read2DataBlocks(void *pDataToReceiver0, void *pDataToReceiver1, int numCalls) {
+    (void)numCalls;
+    *(DATA_BLOCK_CURRENT_SENSOR_s *)pDataToReceiver0 = test_tableCurrentSensor;
+    *(DATA_BLOCK_MIN_MAX_s *)pDataToReceiver1        = test_tableMinMax;
+    return STD_OK;
+}
+
+/** current of the drive cycle in A (positive in discharge direction) */
+static float_t TEST_GetDriveCycleCurrent_A(uint32_t time_s) {
+    const float_t oneC_A = (float_t)BC_CAPACITY_mAh / 1000.0f;
+    const uint32_t phase = time_s % 180u;
+    float_t current_A    = 0.0f;
+    if (phase < 60u) {
+        current_A = oneC_A;
+    } else if (phase < 80u) {
+        current_A = 2.0f * oneC_A;
+    } else if (phase < 110u) {
+        current_A = -oneC_A;
+    } else if (phase < 140u) {
+        current_A = 0.0f;
+    } else {
+        current_A = 0.5f * oneC_A;
+    }
+    return current_A;
+}
+
+/** open-circuit voltage of the synthetic cell, linearly interpolated from the SOC lookup table */
+static float_t TEST_GetOpenCircuitVoltage_V(float_t soc_perc) {
+    uint16_t i = 0u;
+    while ((i < (bc_stateOfChargeLookupTableLength - 2u)) && (soc_perc < bc_stateOfChargeLookupTable[i + 1u].value)) {
+        i++;
+    }
+    return MATH_LinearInterpolation(
+               bc_stateOfChargeLookupTable[i + 1u].value,
+               (float_t)bc_stateOfChargeLookupTable[i + 1u].voltage_mV,
+               bc_stateOfChargeLookupTable[i].value,
+               (float_t)bc_stateOfChargeLookupTable[i].voltage_mV,
+               soc_perc) /
+           1000.0f;
+}
+
+/** deterministic measurement noise in the range of [-4, 4] mV */
+static int16_t TEST_GetMeasurementNoise_mV(void) {
+    static uint32_t seed = 12345u;
+    seed                 = (seed * 1103515245u) + 12345u;
+    return (int16_t)((int32_t)((seed >> 16u) % 9u) - 4);
+}
+
+/** simulates one second of the synthetic cell and returns the terminal voltage */
+static int16_t TEST_SimulateCell(TEST_CELL_s *pCell, float_t current_A) {
+    const float_t rcDecay = expf(-1.0f / SOC_EKF_RC_TIME_CONSTANT_s);
+
+    pCell->soc_perc    = pCell->soc_perc - (100.0f * current_A / SOC_EKF_CELL_BLOCK_CAPACITY_As);
+    pCell->rcVoltage_V = (rcDecay * pCell->rcVoltage_V) + (SOC_EKF_RC_RESISTANCE_ohm * (1.0f - rcDecay) * current_A);
+
+    const float_t voltage_V = TEST_GetOpenCircuitVoltage_V(pCell->soc_perc) - pCell->rcVoltage_V -
+                              (TEST_CELL_OHMIC_RESISTANCE_ohm * current_A);
+    return (int16_t)lroundf(voltage_V * 1000.0f) + TEST_GetMeasurementNoise_mV();
+}
+
+/**
+ * @brief   runs the drive cycle on the synthetic cells and the estimator
+ * @param[in,out]   pCells              synthetic cells (minimum, average, maximum)
+ * @param[in]       currentOffset_A     offset of the current measurement
+ * @param[in]       duration_s          duration of the simulation
+ */
+static void TEST_RunDriveCycle(TEST_CELL_s *pCells, float_t currentOffset_A, uint32_t duration_s) {
+    for (uint32_t t = 0u; t < duration_s; t++) {
+        const float_t current_A = TEST_GetDriveCycleCurrent_A(t);
+        int16_t voltage_mV[TEST_NR_OF_CELLS];
+        for (uint8_t c = 0u; c < TEST_NR_OF_CELLS; c++) {
+            voltage_mV[c] = TEST_SimulateCell(&pCells[c], current_A);
+        }
+        test_tableMinMax.minimumCellVoltage_mV[0]   = voltage_mV[0];
+        test_tableMinMax.averageCellVoltage_mV[0]   = voltage_mV[1];
+        test_tableMinMax.maximumCellVoltage_mV[0]   = voltage_mV[2];
+        test_tableCurrentSensor.current_mA[0]       = (int32_t)lroundf((current_A + currentOffset_A) * 1000.0f);
+        test_tableCurrentSensor.timestampCurrent[0] = test_tableCurrentSensor.timestampCurrent[0] + 1000u;
+        SE_CalculateStateOfCharge(&test_tableSoc);
+    }
+}
+
+static void TEST_InitializeEstimation(float_t initialSoc_perc) {
+    fram_soc.minimumSoc_perc[0] = initialSoc_perc;
+    fram_soc.averageSoc_perc[0] = initialSoc_perc;
+    fram_soc.maximumSoc_perc[0] = initialSoc_perc;
+    SE_InitializeStateOfCharge(&test_tableSoc, false, 0u);
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    DATA_Read1DataBlock_Stub(TEST_DATA_Read1DataBlock);
+    DATA_Read2DataBlocks_Stub(TEST_DATA_Read2DataBlocks);
+    FRAM_ReadData_IgnoreAndReturn(FRAM_ACCESS_OK);
+    FRAM_WriteData_IgnoreAndReturn(FRAM_ACCESS_OK);
+    test_tableCurrentSensor.timestampCurrent[0]          = 0u;
+    test_tableCurrentSensor.invalidCurrentMeasurement[0] = 0u;
+    test_tableMinMax.validMeasuredCellVoltages[0]        = BS_NR_OF_CELL_BLOCKS_PER_STRING;
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testSE_GetStateOfChargeFromVoltage(void) {
+    TEST_ASSERT_EQUAL_FLOAT(64.0f, SE_GetStateOfChargeFromVoltage(3780));
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, SE_GetStateOfChargeFromVoltage(4200));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, SE_GetStateOfChargeFromVoltage(2500));
+}
+
+void testOpenCircuitVoltage(void) {
+    float_t slope_VPerPerc = 0.0f;
+    /* on a lookup table entry */
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-5f, 3.780f, TEST_SOC_GetOpenCircuitVoltage_V(64.0f, &slope_VPerPerc));
+    /* between two entries: 3780 mV at 64 %, 3791 mV at 65 % */
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-5f, 3.7855f, TEST_SOC_GetOpenCircuitVoltage_V(64.5f, &slope_VPerPerc));
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-6f, 0.011f, slope_VPerPerc);
+    /* extrapolation of the first and last segment */
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-5f, 4.123f, TEST_SOC_GetOpenCircuitVoltage_V(100.0f, &slope_VPerPerc));
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-5f, 2.607f, TEST_SOC_GetOpenCircuitVoltage_V(0.0f, &slope_VPerPerc));
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-6f, 0.109f, slope_VPerPerc);
+}
+
+void testInitializationFromNonVolatileMemory(void) {
+    fram_soc.minimumSoc_perc[0] = 40.0f;
+    fram_soc.averageSoc_perc[0] = 50.0f;
+    fram_soc.maximumSoc_perc[0] = 120.0f;
+    SE_InitializeStateOfCharge(&test_tableSoc, true, 0u);
+    TEST_ASSERT_EQUAL_FLOAT(40.0f, test_tableSoc.minimumSoc_perc[0]);
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, test_tableSoc.averageSoc_perc[0]);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, test_tableSoc.maximumSoc_perc[0]);
+    TEST_ASSERT_EQUAL_FLOAT(SOC_EKF_INITIAL_COVARIANCE_SOC, TEST_SOC_GetFilterSocVariance(0u, 0u));
+}
+
+void testNoUpdateWithoutNewOrValidCurrentMeasurement(void) {
+    TEST_InitializeEstimation(50.0f);
+    const uint32_t updates = TEST_SOC_GetNumberOfFilterUpdates();
+
+    /* same timestamp: no update */
+    SE_CalculateStateOfCharge(&test_tableSoc);
+    TEST_ASSERT_EQUAL(updates, TEST_SOC_GetNumberOfFilterUpdates());
+
+    /* invalid current measurement: no update */
+    test_tableCurrentSensor.timestampCurrent[0]          = test_tableCurrentSensor.timestampCurrent[0] + 1000u;
+    test_tableCurrentSensor.invalidCurrentMeasurement[0] = 1u;
+    SE_CalculateStateOfCharge(&test_tableSoc);
+    TEST_ASSERT_EQUAL(updates, TEST_SOC_GetNumberOfFilterUpdates());
+
+    /* new and valid measurement: all filters of the string are updated once */
+    test_tableCurrentSensor.invalidCurrentMeasurement[0] = 0u;
+    SE_CalculateStateOfCharge(&test_tableSoc);
+    TEST_ASSERT_EQUAL(updates + 3u, TEST_SOC_GetNumberOfFilterUpdates());
+}
+
+/** without a valid cell voltage in the string the SOC is only coulomb counted */
+void testNoCorrectionWithInvalidCellVoltage(void) {
+    TEST_InitializeEstimation(50.0f);
+    /* a voltage far below the open-circuit voltage at 50 % would pull the SOC down */
+    test_tableMinMax.minimumCellVoltage_mV[0] = 2500;
+    test_tableMinMax.averageCellVoltage_mV[0] = 2500;
+    test_tableMinMax.maximumCellVoltage_mV[0] = 2500;
+    test_tableCurrentSensor.current_mA[0]     = 0;
+
+    test_tableMinMax.validMeasuredCellVoltages[0] = 0u;
+    const uint32_t updates                        = TEST_SOC_GetNumberOfFilterUpdates();
+    test_tableCurrentSensor.timestampCurrent[0]   = test_tableCurrentSensor.timestampCurrent[0] + 1000u;
+    SE_CalculateStateOfCharge(&test_tableSoc);
+    TEST_ASSERT_EQUAL(updates + 3u, TEST_SOC_GetNumberOfFilterUpdates());
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, test_tableSoc.minimumSoc_perc[0]);
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, test_tableSoc.averageSoc_perc[0]);
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, test_tableSoc.maximumSoc_perc[0]);
+    /* the uncertainty grows as the SOC is not corrected */
+    TEST_ASSERT_GREATER_THAN_FLOAT(SOC_EKF_INITIAL_COVARIANCE_SOC, TEST_SOC_GetFilterSocVariance(0u, 1u));
+
+    /* all cells valid again: the filter is corrected */
+    test_tableMinMax.validMeasuredCellVoltages[0] = BS_NR_OF_CELL_BLOCKS_PER_STRING;
+    test_tableCurrentSensor.timestampCurrent[0]   = test_tableCurrentSensor.timestampCurrent[0] + 1000u;
+    SE_CalculateStateOfCharge(&test_tableSoc);
+    TEST_ASSERT_LESS_THAN_FLOAT(50.0f, test_tableSoc.averageSoc_perc[0]);
+}
+
+/** min, max and average are calculated from the valid cells, one invalid cell does not stop the correction */
+void testCorrectionWithOneInvalidCellVoltage(void) {
+    TEST_InitializeEstimation(50.0f);
+    test_tableMinMax.minimumCellVoltage_mV[0] = 2500;
+    test_tableMinMax.averageCellVoltage_mV[0] = 2500;
+    test_tableMinMax.maximumCellVoltage_mV[0] = 2500;
+    test_tableCurrentSensor.current_mA[0]     = 0;
+
+    test_tableMinMax.validMeasuredCellVoltages[0] = BS_NR_OF_CELL_BLOCKS_PER_STRING - 1u;
+    test_tableCurrentSensor.timestampCurrent[0]   = test_tableCurrentSensor.timestampCurrent[0] + 1000u;
+    SE_CalculateStateOfCharge(&test_tableSoc);
+    TEST_ASSERT_LESS_THAN_FLOAT(50.0f, test_tableSoc.minimumSoc_perc[0]);
+    TEST_ASSERT_LESS_THAN_FLOAT(50.0f, test_tableSoc.averageSoc_perc[0]);
+    TEST_ASSERT_LESS_THAN_FLOAT(50.0f, test_tableSoc.maximumSoc_perc[0]);
+}
+
+/** the filter converges from a wrong initial SOC and stays on the true SOC during the drive cycle */
+void testAccuracyWithWrongInitialSoc(void) {
+    TEST_CELL_s cells[TEST_NR_OF_CELLS] = {{85.0f, 0.0f}, {90.0f, 0.0f}, {95.0f, 0.0f}};
+    TEST_InitializeEstimation(60.0f);
+
+    TEST_RunDriveCycle(cells, 0.0f, 600u);
+    TEST_ASSERT_FLOAT_WITHIN(3.0f, cells[0].soc_perc, test_tableSoc.minimumSoc_perc[0]);
+    TEST_ASSERT_FLOAT_WITHIN(3.0f, cells[1].soc_perc, test_tableSoc.averageSoc_perc[0]);
+    TEST_ASSERT_FLOAT_WITHIN(3.0f, cells[2].soc_perc, test_tableSoc.maximumSoc_perc[0]);
+
+    TEST_RunDriveCycle(cells, 0.0f, TEST_DRIVE_CYCLE_DURATION_s - 600u);
+    TEST_ASSERT_FLOAT_WITHIN(2.0f, cells[0].soc_perc, test_tableSoc.minimumSoc_perc[0]);
+    TEST_ASSERT_FLOAT_WITHIN(2.0f, cells[1].soc_perc, test_tableSoc.averageSoc_perc[0]);
+    TEST_ASSERT_FLOAT_WITHIN(2.0f, cells[2].soc_perc, test_tableSoc.maximumSoc_perc[0]);
+    /* the SOC uncertainty has decreased from its initial value */
+    TEST_ASSERT_LESS_THAN_FLOAT(SOC_EKF_INITIAL_COVARIANCE_SOC / 100.0f, TEST_SOC_GetFilterSocVariance(0u, 1u));
+}
+
+/** unlike pure coulomb counting, an offset of the current sensor does not lead to a drift of the SOC */
+void testAccuracyWithCurrentSensorOffset(void) {
+    const float_t offset_A              = 0.2f;
+    TEST_CELL_s cells[TEST_NR_OF_CELLS] = {{85.0f, 0.0f}, {90.0f, 0.0f}, {95.0f, 0.0f}};
+    TEST_InitializeEstimation(90.0f);
+
+    TEST_RunDriveCycle(cells, offset_A, TEST_DRIVE_CYCLE_DURATION_s);
+
+    /* drift of pure coulomb counting */
+    const float_t countingDrift_perc = 100.0f * offset_A * (float_t)TEST_DRIVE_CYCLE_DURATION_s /
+                                       SOC_EKF_CELL_BLOCK_CAPACITY_As;
+    TEST_ASSERT_GREATER_THAN_FLOAT(5.0f, countingDrift_perc);
+    TEST_ASSERT_FLOAT_WITHIN(2.0f, cells[1].soc_perc, test_tableSoc.averageSoc_perc[0]);
+}
+
+/** every step updates the filter of every cell block exactly once */
+void testOneFilterUpdatePerCellAndStep(void) {
+    TEST_CELL_s cells[TEST_NR_OF_CELLS] = {{85.0f, 0.0f}, {90.0f, 0.0f}, {95.0f, 0.0f}};
+    TEST_InitializeEstimation(90.0f);
+    const uint32_t updatesAtStart = TEST_SOC_GetNumberOfFilterUpdates();
+
+    TEST_RunDriveCycle(cells, 0.0f, TEST_DRIVE_CYCLE_DURATION_s);
+
+    const uint32_t updates = TEST_SOC_GetNumberOfFilterUpdates() - updatesAtStart;
+    TEST_ASSERT_EQUAL(TEST_NR_OF_CELLS * TEST_DRIVE_CYCLE_DURATION_s, updates);
+}
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+/** host benchmark: reports the update cost per cell block and filter */
+void testUpdateCostPerCell(void) {
+    TEST_CELL_s cells[TEST_NR_OF_CELLS] = {{85.0f, 0.0f}, {90.0f, 0.0f}, {95.0f, 0.0f}};
+    TEST_InitializeEstimation(90.0f);
+    const uint32_t updatesAtStart = TEST_SOC_GetNumberOfFilterUpdates();
+
+    const clock_t start = clock();
+    TEST_RunDriveCycle(cells, 0.0f, TEST_DRIVE_CYCLE_DURATION_s);
+    const clock_t stop = clock();
+
+    /* includes the simulation of the synthetic cells, i.e., it is an upper bound */
+    const uint32_t updates = TEST_SOC_GetNumberOfFilterUpdates() - updatesAtStart;
+    char message[100]      = {0};
+    const double costPerUpdate_ns =
+        (1.0e9 * (double)(stop - start)) / ((double)CLOCKS_PER_SEC * (double)updates);
+    (void)snprintf(message, sizeof(message), "update cost per cell and filter: %.0f ns (host)", costPerUpdate_ns);
+    TEST_MESSAGE(message);
+}
+#endif
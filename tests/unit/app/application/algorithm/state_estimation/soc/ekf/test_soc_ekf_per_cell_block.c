@@ -0,0 +1,190 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_soc_ekf_per_cell_block.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the extended Kalman filter based SOC estimation with one
+ *          filter per cell block
+ * @details The test is built with SOC_EKF_ESTIMATE_PER_CELL_BLOCK set to true
+ *          (see the unit test project configuration).
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockdatabase.h"
+#include "Mockfram.h"
+
+#include "battery_cell_cfg.h"
+#include "soc_ekf_cfg.h"
+
+#include "foxmath.h"
+#include "soc_ekf.h"
+#include "state_estimation.h"
+
+#include <math.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("soc_ekf.c")
+
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/soc/ekf")
+TEST_INCLUDE_PATH("../../src/app/application/bms")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/contactor")
+TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
+TEST_INCLUDE_PATH("../../src/app/driver/fram")
+TEST_INCLUDE_PATH("../../src/app/driver/sps")
+TEST_INCLUDE_PATH("../../src/app/task/config")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** number of simulated time steps */
+#define TEST_NR_OF_TIME_STEPS (600u)
+
+FRAM_SOC_s fram_soc = {0};
+
+static DATA_BLOCK_CURRENT_SENSOR_s test_tableCurrentSensor = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_SENSOR};
+static DATA_BLOCK_CELL_VOLTAGE_s test_tableCellVoltage     = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+static DATA_BLOCK_SOC_s test_tableSoc                      = {.header.uniqueId = DATA_BLOCK_ID_SOC};
+
+static STD_RETURN_TYPE_e TEST_DATA_Read1DataBlock(void *pDataToReceiver0, int numCalls) {
+    (void)numCalls;
+    *(DATA_BLOCK_CURRENT_SENSOR_s *)pDataToReceiver0 = test_tableCurrentSensor;
+    return STD_OK;
+}
+
+static STD_RETURN_TYPE_e TEST_DATA_Read2DataBlocks(void *pDataToReceiver0, void *pDataToReceiver1, int numCalls) {
+    (void)numCalls;
+    *(DATA_BLOCK_CURRENT_SENSOR_s *)pDataToReceiver0 = test_tableCurrentSensor;
+    *(DATA_BLOCK_CELL_VOLTAGE_s *)pDataToReceiver1   = test_tableCellVoltage;
+    return STD_OK;
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    DATA_Read1DataBlock_Stub(TEST_DATA_Read1DataBlock);
+    DATA_Read2DataBlocks_Stub(TEST_DATA_Read2DataBlocks);
+    FRAM_ReadData_IgnoreAndReturn(FRAM_ACCESS_OK);
+    FRAM_WriteData_IgnoreAndReturn(FRAM_ACCESS_OK);
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+/**
+ * all cell blocks start at the average SOC from the non-volatile memory; at
+ * rest, every filter converges to the SOC of its cell block and the string
+ * values are derived from the cell blocks
+ */
+void testPerCellBlockEstimationAtRest(void) {
+    fram_soc.averageSoc_perc[0] = 50.0f;
+    SE_InitializeStateOfCharge(&test_tableSoc, false, 0u);
+    for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+        TEST_ASSERT_EQUAL_FLOAT(50.0f, TEST_SOC_GetFilterSoc_perc(0u, c));
+    }
+
+    /* all cell blocks at 3636 mV (50 %), one at 3500 mV (~30 %) and one at 3840 mV (70 %) */
+    for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+        for (uint16_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+            test_tableCellVoltage.cellVoltage_mV[0][m][cb] = 3636;
+        }
+    }
+    test_tableCellVoltage.cellVoltage_mV[0][0][3] = 3501;
+    test_tableCellVoltage.cellVoltage_mV[0][1][5] = 3840;
+    test_tableCurrentSensor.current_mA[0]         = 0;
+
+    const uint32_t updatesAtStart = TEST_SOC_GetNumberOfFilterUpdates();
+    for (uint32_t t = 0u; t < TEST_NR_OF_TIME_STEPS; t++) {
+        test_tableCurrentSensor.timestampCurrent[0] = test_tableCurrentSensor.timestampCurrent[0] + 1000u;
+        SE_CalculateStateOfCharge(&test_tableSoc);
+    }
+
+    /* work counter: one filter update per cell block and time step */
+    TEST_ASSERT_EQUAL(
+        TEST_NR_OF_TIME_STEPS * BS_NR_OF_CELL_BLOCKS_PER_STRING,
+        TEST_SOC_GetNumberOfFilterUpdates() - updatesAtStart);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 30.0f, TEST_SOC_GetFilterSoc_perc(0u, 3u));
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 70.0f, TEST_SOC_GetFilterSoc_perc(0u, BS_NR_OF_CELL_BLOCKS_PER_MODULE + 5u));
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 50.0f, TEST_SOC_GetFilterSoc_perc(0u, 0u));
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 30.0f, test_tableSoc.minimumSoc_perc[0]);
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 70.0f, test_tableSoc.maximumSoc_perc[0]);
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 50.0f, test_tableSoc.averageSoc_perc[0]);
+    TEST_ASSERT_EQUAL_FLOAT(test_tableSoc.averageSoc_perc[0], fram_soc.averageSoc_perc[0]);
+}
+
+/** an invalid cell block suspends only the correction of its own filter */
+void testPerCellBlockNoCorrectionWithInvalidCellVoltage(void) {
+    fram_soc.averageSoc_perc[0] = 50.0f;
+    SE_InitializeStateOfCharge(&test_tableSoc, false, 0u);
+    /* all cell blocks at 3840 mV (70 %) pull their filters up from 50 % */
+    for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+        for (uint16_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+            test_tableCellVoltage.cellVoltage_mV[0][m][cb] = 3840;
+        }
+    }
+    /* open wire: the cell block reads 0 mV and is flagged invalid */
+    test_tableCellVoltage.cellVoltage_mV[0][0][3]  = 0;
+    test_tableCellVoltage.invalidCellVoltage[0][0] = 1u << 3u;
+    test_tableCurrentSensor.current_mA[0]          = 0;
+
+    test_tableCurrentSensor.timestampCurrent[0] = test_tableCurrentSensor.timestampCurrent[0] + 1000u;
+    SE_CalculateStateOfCharge(&test_tableSoc);
+    for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+        if (c == 3u) {
+            TEST_ASSERT_EQUAL_FLOAT(50.0f, TEST_SOC_GetFilterSoc_perc(0u, c));
+        } else {
+            TEST_ASSERT_GREATER_THAN_FLOAT(50.0f, TEST_SOC_GetFilterSoc_perc(0u, c));
+        }
+    }
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, test_tableSoc.minimumSoc_perc[0]);
+    TEST_ASSERT_GREATER_THAN_FLOAT(50.0f, test_tableSoc.maximumSoc_perc[0]);
+
+    test_tableCellVoltage.invalidCellVoltage[0][0] = 0u;
+}
@@ -59,6 +59,7 @@
 #include "Mockfram.h"
 
 #include "battery_cell_cfg.h"
+#include "soe_counting_cfg.h"
 
 #include "foxmath.h"
 #include "state_estimation.h"
@@ -69,6 +70,7 @@ TEST_SOURCE_FILE("soe_counting.c")
 TEST_SOURCE_FILE("soh_none.c")
 
 TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/soe/counting")
 TEST_INCLUDE_PATH("../../src/app/application/bms")
 TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/contactor")
@@ -80,6 +82,15 @@ TEST_INCLUDE_PATH("../../src/app/task/config")
 /*========== Definitions and Implementations for Unit Test ==================*/
 FRAM_SOE_s fram_soe = {0};
 
+static DATA_BLOCK_CURRENT_SENSOR_s test_tableCurrentSensor = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_SENSOR};
+static DATA_BLOCK_SOE_s test_tableSoe                      = {.header.uniqueId = DATA_BLOCK_ID_SOE};
+
+static STD_RETURN_TYPE_e TEST_DATA_Read1DataBlock(void *pDataToReceiver0, int numCalls) {
+    (void)numCalls;
+    *(DATA_BLOCK_CURRENT_SENSOR_s *)pDataToReceiver0 = test_tableCurrentSensor;
+    return STD_OK;
+}
+
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
 }
@@ -91,3 +102,31 @@ void testDummy(void) {
 }
 
 /*========== Test Cases =====================================================*/
+void testIntegrationOfPower(void) {
+    DATA_Read1DataBlock_Stub(TEST_DATA_Read1DataBlock);
+    FRAM_ReadData_IgnoreAndReturn(FRAM_ACCESS_OK);
+    FRAM_WriteData_IgnoreAndReturn(FRAM_ACCESS_OK);
+    BMS_GetBatterySystemState_IgnoreAndReturn(BMS_DISCHARGING);
+
+    fram_soe.averageSoe_perc[0]                 = 80.0f;
+    fram_soe.minimumSoe_perc[0]                 = 70.0f;
+    fram_soe.maximumSoe_perc[0]                 = 90.0f;
+    test_tableCurrentSensor.timestampCurrent[0] = 1000u;
+    SE_InitializeStateOfEnergy(&test_tableSoe, false, 0u);
+
+    /* discharge with 1 A at 50 V for one hour */
+    test_tableCurrentSensor.current_mA[0]        = 1000;
+    test_tableCurrentSensor.highVoltage_mV[0][0] = 50000;
+    for (uint32_t t = 1u; t <= 3600u; t++) {
+        test_tableCurrentSensor.timestampCurrent[0] = 1000u + (1000u * t);
+        SE_CalculateStateOfEnergy(&test_tableSoe);
+    }
+
+    const float_t deltaSoe_perc = (50.0f / SOE_STRING_ENERGY_Wh) * 100.0f;
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 80.0f - deltaSoe_perc, test_tableSoe.averageSoe_perc[0]);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 70.0f - deltaSoe_perc, test_tableSoe.minimumSoe_perc[0]);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 90.0f - deltaSoe_perc, test_tableSoe.maximumSoe_perc[0]);
+    TEST_ASSERT_UINT32_WITHIN(
+        1u, (uint32_t)(((80.0f - deltaSoe_perc) / 100.0f) * SOE_STRING_ENERGY_Wh), test_tableSoe.averageSoe_Wh[0]);
+    TEST_ASSERT_EQUAL_FLOAT(test_tableSoe.averageSoe_perc[0], fram_soe.averageSoe_perc[0]);
+}
@@ -0,0 +1,244 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_soe_counting_fixed_point.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the SOE module with fixed-point arithmetic
+ * @details The test is compiled with SE_USE_FIXED_POINT_ARITHMETIC=true (see
+ *          the unit test project configuration). The results are compared
+ *          with the floating point calculation.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockbms.h"
+#include "Mockdatabase.h"
+#include "Mockfram.h"
+
+#include "battery_cell_cfg.h"
+#include "soe_counting_cfg.h"
+
+#include "foxmath.h"
+#include "state_estimation.h"
+
+#include <math.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("soc_none.c")
+TEST_SOURCE_FILE("soe_counting.c")
+TEST_SOURCE_FILE("soh_none.c")
+
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/soe/counting")
+TEST_INCLUDE_PATH("../../src/app/application/bms")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/contactor")
+TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
+TEST_INCLUDE_PATH("../../src/app/driver/fram")
+TEST_INCLUDE_PATH("../../src/app/driver/sps")
+TEST_INCLUDE_PATH("../../src/app/task/config")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** resolution of the SOE in percent */
+#define TEST_SOE_RESOLUTION_perc (1.0f / 65536.0f)
+
+FRAM_SOE_s fram_soe = {0};
+
+static DATA_BLOCK_CURRENT_SENSOR_s test_tableCurrentSensor = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_SENSOR};
+static DATA_BLOCK_MIN_MAX_s test_tableMinimumMaximum       = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+static DATA_BLOCK_SOE_s test_tableSoe                      = {.header.uniqueId = DATA_BLOCK_ID_SOE};
+
+static STD_RETURN_TYPE_e TEST_DATA_Read1DataBlock(void *pDataToReceiver0, int numCalls) {
+    (void)numCalls;
+    if (((DATA_BLOCK_HEADER_s *)pDataToReceiver0)->uniqueId == DATA_BLOCK_ID_MIN_MAX) {
+        *(DATA_BLOCK_MIN_MAX_s *)pDataToReceiver0 = test_tableMinimumMaximum;
+    } else {
+        *(DATA_BLOCK_CURRENT_SENSOR_s *)pDataToReceiver0 = test_tableCurrentSensor;
+    }
+    return STD_OK;
+}
+
+/** initializes the SOE of string 0 with 50% */
+static void TEST_InitializeSoe(bool ecPresent) {
+    fram_soe.averageSoe_perc[0] = 50.0f;
+    fram_soe.minimumSoe_perc[0] = 50.0f;
+    fram_soe.maximumSoe_perc[0] = 50.0f;
+
+    test_tableCurrentSensor.timestampCurrent[0]        = 0u;
+    test_tableCurrentSensor.timestampEnergyCounting[0] = 0u;
+    test_tableCurrentSensor.energyCounter_Wh[0]        = 0;
+    test_tableCurrentSensor.highVoltage_mV[0][0]       = 50000;
+    SE_InitializeStateOfEnergy(&test_tableSoe, ecPresent, 0u);
+}
+
+/** SOE lookup as implemented with floating point arithmetic */
+static float_t TEST_GetStateOfEnergyFromVoltage(int16_t voltage_mV) {
+    float_t soe_perc = 100.0f;
+    if (voltage_mV < bc_stateOfEnergyLookupTable[bc_stateOfEnergyLookupTableLength - 1u].voltage_mV) {
+        soe_perc = 0.0f;
+    }
+    /* the implementation does not interpolate between the first two entries */
+    for (uint16_t i = 2u; i < bc_stateOfEnergyLookupTableLength; i++) {
+        if ((voltage_mV < bc_stateOfEnergyLookupTable[i - 1u].voltage_mV) &&
+            (voltage_mV >= bc_stateOfEnergyLookupTable[i].voltage_mV)) {
+            soe_perc = MATH_LinearInterpolation(
+                (float_t)bc_stateOfEnergyLookupTable[i].voltage_mV,
+                bc_stateOfEnergyLookupTable[i].value,
+                (float_t)bc_stateOfEnergyLookupTable[i - 1u].voltage_mV,
+                bc_stateOfEnergyLookupTable[i - 1u].value,
+                (float_t)voltage_mV);
+        }
+    }
+    return soe_perc;
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    DATA_Read1DataBlock_Stub(TEST_DATA_Read1DataBlock);
+    FRAM_ReadData_IgnoreAndReturn(FRAM_ACCESS_OK);
+    FRAM_WriteData_IgnoreAndReturn(FRAM_ACCESS_OK);
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testIntegrationEquivalentToFloat(void) {
+    BMS_GetBatterySystemState_IgnoreAndReturn(BMS_DISCHARGING);
+    TEST_InitializeSoe(false);
+
+    /* alternating discharge and charge pulses in steps of 100 ms for one hour */
+    double expectedSoe_perc = 50.0;
+    for (uint32_t t = 1u; t <= 36000u; t++) {
+        int32_t current_mA = 3500;
+        int32_t voltage_mV = 48000;
+        if ((t % 600u) >= 400u) {
+            current_mA = -5250;
+            voltage_mV = 52500;
+        }
+        test_tableCurrentSensor.current_mA[0]        = current_mA;
+        test_tableCurrentSensor.highVoltage_mV[0][0] = voltage_mV;
+        test_tableCurrentSensor.timestampCurrent[0]  = 100u * t;
+        SE_CalculateStateOfEnergy(&test_tableSoe);
+
+        /* mA * mV * ms = nJ */
+        expectedSoe_perc -= ((double)current_mA * (double)voltage_mV * 100.0 * 100.0) /
+                            ((double)SOE_STRING_ENERGY_Wh * 3600.0e9);
+        /* the integration error does not accumulate */
+        TEST_ASSERT_FLOAT_WITHIN(TEST_SOE_RESOLUTION_perc, (float_t)expectedSoe_perc, test_tableSoe.averageSoe_perc[0]);
+    }
+    TEST_ASSERT_EQUAL_FLOAT(test_tableSoe.averageSoe_perc[0], test_tableSoe.minimumSoe_perc[0]);
+    TEST_ASSERT_EQUAL_FLOAT(test_tableSoe.averageSoe_perc[0], fram_soe.averageSoe_perc[0]);
+}
+
+void testIntegrationOfSmallPower(void) {
+    BMS_GetBatterySystemState_IgnoreAndReturn(BMS_DISCHARGING);
+    TEST_InitializeSoe(false);
+
+    /* 1 mA at 1 V for one day: the change per time step is smaller than the resolution of the SOE */
+    test_tableCurrentSensor.current_mA[0]        = 1;
+    test_tableCurrentSensor.highVoltage_mV[0][0] = 1000;
+    for (uint32_t t = 1u; t <= 86400u; t++) {
+        test_tableCurrentSensor.timestampCurrent[0] = 1000u * t;
+        SE_CalculateStateOfEnergy(&test_tableSoe);
+    }
+    const float_t expectedSoe_perc = 50.0f - ((86400.0f * 100.0f) / (SOE_STRING_ENERGY_Wh * 3600.0f * 1000.0f));
+    TEST_ASSERT_FLOAT_WITHIN(TEST_SOE_RESOLUTION_perc, expectedSoe_perc, test_tableSoe.averageSoe_perc[0]);
+}
+
+void testIntegrationSaturates(void) {
+    BMS_GetBatterySystemState_IgnoreAndReturn(BMS_DISCHARGING);
+    TEST_InitializeSoe(false);
+
+    /* a time step with an energy larger than the string energy must not overflow */
+    test_tableCurrentSensor.current_mA[0]        = INT32_MIN;
+    test_tableCurrentSensor.highVoltage_mV[0][0] = INT32_MAX;
+    test_tableCurrentSensor.timestampCurrent[0]  = UINT32_MAX;
+    SE_CalculateStateOfEnergy(&test_tableSoe);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, test_tableSoe.averageSoe_perc[0]);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)SOE_STRING_ENERGY_Wh, test_tableSoe.averageSoe_Wh[0]);
+
+    test_tableCurrentSensor.current_mA[0]       = INT32_MAX;
+    test_tableCurrentSensor.timestampCurrent[0] = UINT32_MAX - 1u;
+    SE_CalculateStateOfEnergy(&test_tableSoe);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, test_tableSoe.averageSoe_perc[0]);
+    TEST_ASSERT_EQUAL_UINT32(0u, test_tableSoe.averageSoe_Wh[0]);
+}
+
+void testEnergyCounterEquivalentToFloat(void) {
+    BMS_GetBatterySystemState_IgnoreAndReturn(BMS_DISCHARGING);
+    TEST_InitializeSoe(true);
+
+    for (int32_t counter_Wh = -80; counter_Wh <= 80; counter_Wh++) {
+        test_tableCurrentSensor.energyCounter_Wh[0] = counter_Wh;
+        test_tableCurrentSensor.timestampEnergyCounting[0]++;
+        SE_CalculateStateOfEnergy(&test_tableSoe);
+
+        const float_t expectedSoe_perc = 50.0f - (((float_t)counter_Wh / SOE_STRING_ENERGY_Wh) * 100.0f);
+        TEST_ASSERT_FLOAT_WITHIN(TEST_SOE_RESOLUTION_perc, expectedSoe_perc, test_tableSoe.averageSoe_perc[0]);
+    }
+}
+
+void testLookupTableEquivalentToFloat(void) {
+    BMS_GetBatterySystemState_IgnoreAndReturn(BMS_AT_REST);
+    TEST_InitializeSoe(false);
+
+    for (int16_t voltage_mV = 2500; voltage_mV <= 4300; voltage_mV++) {
+        test_tableMinimumMaximum.minimumCellVoltage_mV[0] = voltage_mV;
+        test_tableMinimumMaximum.maximumCellVoltage_mV[0] = voltage_mV;
+        test_tableMinimumMaximum.averageCellVoltage_mV[0] = voltage_mV;
+        SE_CalculateStateOfEnergy(&test_tableSoe);
+
+        /* the quantization of the lookup table values dominates the difference */
+        TEST_ASSERT_FLOAT_WITHIN(
+            2.0f * TEST_SOE_RESOLUTION_perc,
+            TEST_GetStateOfEnergyFromVoltage(voltage_mV),
+            test_tableSoe.averageSoe_perc[0]);
+    }
+}
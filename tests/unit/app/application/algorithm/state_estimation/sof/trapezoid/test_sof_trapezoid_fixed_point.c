@@ -0,0 +1,192 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_sof_trapezoid_fixed_point.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the SOF module with fixed-point arithmetic
+ * @details The test is compiled with SE_USE_FIXED_POINT_ARITHMETIC=true (see
+ *          the unit test project configuration). The results are compared
+ *          with the floating point calculation.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockbms.h"
+#include "Mockdatabase.h"
+#include "Mockfram.h"
+
+#include "sof_trapezoid_cfg.h"
+
+#include "foxmath.h"
+#include "sof_trapezoid.h"
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("sof_trapezoid.c")
+TEST_SOURCE_FILE("sof_trapezoid_cfg.c")
+
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/sof/trapezoid")
+TEST_INCLUDE_PATH("../../src/app/application/bms")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/contactor")
+TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
+TEST_INCLUDE_PATH("../../src/app/driver/fram")
+TEST_INCLUDE_PATH("../../src/app/driver/sps")
+TEST_INCLUDE_PATH("../../src/app/task/config")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** tolerance of the current limits in mA (resolution of 1/65536 A and quantization of the limits) */
+#define TEST_SOF_TOLERANCE_mA (0.1f)
+
+FRAM_SOC_s fram_soc = {0};
+
+/** derating ramp as calculated with floating point arithmetic */
+static float_t TEST_GetCurrentLimit(int16_t x1, float_t y1_mA, int16_t x2, float_t y2_mA, int16_t x, bool limitBelow) {
+    float_t current_mA = MATH_LinearInterpolation((float_t)x1, y1_mA, (float_t)x2, y2_mA, (float_t)x);
+    if (limitBelow == true) {
+        if (x <= x1) {
+            current_mA = y1_mA;
+        } else if (x > x2) {
+            current_mA = y2_mA;
+        } else {
+            /* on the ramp */
+        }
+    } else {
+        if (x >= x1) {
+            current_mA = y1_mA;
+        } else if (x < x2) {
+            current_mA = y2_mA;
+        } else {
+            /* on the ramp */
+        }
+    }
+    return current_mA;
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testVoltageBasedCurrentLimitEquivalentToFloat(void) {
+    const SOF_CONFIG_s *pConfig = &sof_recommendedCurrent;
+    SOF_CURVE_s curves          = {0};
+
+    for (int16_t voltage_mV = 1000; voltage_mV <= 5000; voltage_mV++) {
+        SOF_CURRENT_LIMITS_s limits = {0};
+        TEST_SOF_CalculateVoltageBasedCurrentLimit(voltage_mV, voltage_mV, &limits, pConfig, &curves);
+
+        const float_t expectedDischarge_mA = TEST_GetCurrentLimit(
+            pConfig->limitLowerCellVoltage_mV,
+            0.0f,
+            pConfig->cutoffLowerCellVoltage_mV,
+            pConfig->maximumDischargeCurrent_mA,
+            voltage_mV,
+            true);
+        const float_t expectedCharge_mA = TEST_GetCurrentLimit(
+            pConfig->limitUpperCellVoltage_mV,
+            0.0f,
+            pConfig->cutoffUpperCellVoltage_mV,
+            pConfig->maximumChargeCurrent_mA,
+            voltage_mV,
+            false);
+        TEST_ASSERT_FLOAT_WITHIN(TEST_SOF_TOLERANCE_mA, expectedDischarge_mA, limits.continuousDischargeCurrent_mA);
+        TEST_ASSERT_FLOAT_WITHIN(TEST_SOF_TOLERANCE_mA, expectedDischarge_mA, limits.peakDischargeCurrent_mA);
+        TEST_ASSERT_FLOAT_WITHIN(TEST_SOF_TOLERANCE_mA, expectedCharge_mA, limits.continuousChargeCurrent_mA);
+        TEST_ASSERT_FLOAT_WITHIN(TEST_SOF_TOLERANCE_mA, expectedCharge_mA, limits.peakChargeCurrent_mA);
+    }
+}
+
+void testTemperatureBasedCurrentLimitEquivalentToFloat(void) {
+    const SOF_CONFIG_s *pConfig = &sof_recommendedCurrent;
+    SOF_CURVE_s curves          = {0};
+
+    for (int16_t temperature_ddegC = -500; temperature_ddegC <= 1000; temperature_ddegC++) {
+        SOF_CURRENT_LIMITS_s limits = {0};
+        TEST_SOF_CalculateTemperatureBasedCurrentLimit(temperature_ddegC, temperature_ddegC, &limits, pConfig, &curves);
+
+        const float_t expectedDischarge_mA = MATH_MinimumOfTwoFloats(
+            TEST_GetCurrentLimit(
+                pConfig->limitLowTemperatureDischarge_ddegC,
+                pConfig->limpHomeCurrent_mA,
+                pConfig->cutoffLowTemperatureDischarge_ddegC,
+                pConfig->maximumDischargeCurrent_mA,
+                temperature_ddegC,
+                true),
+            TEST_GetCurrentLimit(
+                pConfig->limitHighTemperatureDischarge_ddegC,
+                0.0f,
+                pConfig->cutoffHighTemperatureDischarge_ddegC,
+                pConfig->maximumDischargeCurrent_mA,
+                temperature_ddegC,
+                false));
+        const float_t expectedCharge_mA = MATH_MinimumOfTwoFloats(
+            TEST_GetCurrentLimit(
+                pConfig->limitLowTemperatureCharge_ddegC,
+                0.0f,
+                pConfig->cutoffLowTemperatureCharge_ddegC,
+                pConfig->maximumChargeCurrent_mA,
+                temperature_ddegC,
+                true),
+            TEST_GetCurrentLimit(
+                pConfig->limitHighTemperatureCharge_ddegC,
+                0.0f,
+                pConfig->cutoffHighTemperatureCharge_ddegC,
+                pConfig->maximumChargeCurrent_mA,
+                temperature_ddegC,
+                false));
+        TEST_ASSERT_FLOAT_WITHIN(TEST_SOF_TOLERANCE_mA, expectedDischarge_mA, limits.continuousDischargeCurrent_mA);
+        TEST_ASSERT_FLOAT_WITHIN(TEST_SOF_TOLERANCE_mA, expectedDischarge_mA, limits.peakDischargeCurrent_mA);
+        TEST_ASSERT_FLOAT_WITHIN(TEST_SOF_TOLERANCE_mA, expectedCharge_mA, limits.continuousChargeCurrent_mA);
+        TEST_ASSERT_FLOAT_WITHIN(TEST_SOF_TOLERANCE_mA, expectedCharge_mA, limits.peakChargeCurrent_mA);
+    }
+}
@@ -0,0 +1,393 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_soh_rls.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the SOH estimation based on recursive least squares
+ * @details The estimation is fed with synthetic data of a string of cells
+ *          with different capacity fade and resistance increase.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockbms.h"
+#include "Mockdatabase.h"
+#include "Mockfram.h"
+#include "Mockos.h"
+
+#include "battery_cell_cfg.h"
+#include "soh_rls_cfg.h"
+
+#include "foxmath.h"
+#include "soh_rls.h"
+#include "state_estimation.h"
+
+#include <math.h>
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#include <time.h>
+#endif
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("soh_rls.c")
+TEST_SOURCE_FILE("soc_counting.c")
+
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/soc/counting")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/state_estimation/soh/rls")
+TEST_INCLUDE_PATH("../../src/app/application/bms")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/contactor")
+TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
+TEST_INCLUDE_PATH("../../src/app/driver/fram")
+TEST_INCLUDE_PATH("../../src/app/driver/sps")
+TEST_INCLUDE_PATH("../../src/app/task/config")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** duration of a rest phase in s, longer than the rest time of the estimation */
+#define TEST_REST_DURATION_s ((SOH_RLS_REST_TIME_ms / 1000u) + 60u)
+
+/** duration of a charge or discharge phase in s */
+#define TEST_LOAD_DURATION_s (3600u)
+
+/** number of simulated cycles (rest, discharge, rest, charge) */
+#define TEST_NR_OF_CYCLES (3u)
+
+/** load current in A (0.5C) */
+#define TEST_LOAD_CURRENT_A ((float_t)BC_CAPACITY_mAh / 2000.0f)
+
+/** resistance of the RC element of the synthetic cells in ohm */
+#define TEST_RC_RESISTANCE_ohm (0.015f)
+
+/** time constant of the RC element of the synthetic cells in s */
+#define TEST_RC_TIME_CONSTANT_s (40.0f)
+
+FRAM_SOC_s fram_soc = {0};
+FRAM_SOH_s fram_soh = {0};
+
+/** synthetic aged cell */
+typedef struct {
+    float_t capacity_perc;   /*!< true capacity, relative to nominal */
+    float_t resistance_mOhm; /*!< true ohmic resistance */
+    float_t soc_perc;        /*!< true SOC */
+    float_t rcVoltage_V;     /*!< voltage over the RC element */
+} TEST_CELL_s;
+
+static TEST_CELL_s test_cells[BS_NR_OF_CELL_BLOCKS_PER_STRING] = {0};
+
+static DATA_BLOCK_CURRENT_SENSOR_s test_tableCurrentSensor = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_SENSOR};
+static DATA_BLOCK_CELL_VOLTAGE_s test_tableCellVoltage     = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+static DATA_BLOCK_SOH_s test_tableSoh                      = {.header.uniqueId = DATA_BLOCK_ID_SOH};
+static uint32_t test_framWrites                            = 0u;
+
+static STD_RETURN_TYPE_e TEST_DATA_Read1DataBlock(void *pDataToReceiver0, int numCalls) {
+    (void)numCalls;
+    *(DATA_BLOCK_CURRENT_SENSOR_s *)pDataToReceiver0 = test_tableCurrentSensor;
+    return STD_OK;
+}
+
+static STD_RETURN_TYPE_e TEST_DATA_Read2DataBlocks(void *pDataToReceiver0, void *pDataToReceiver1, int numCalls) {
+    (void)numCalls;
+    *(DATA_BLOCK_CURRENT_SENSOR_s *)pDataToReceiver0 = test_tableCurrentSensor;
+    *(DATA_BLOCK_CELL_VOLTAGE_s *)pDataToReceiver1   = test_tableCellVoltage;
+    return STD_OK;
+}
+
+static FRAM_RETURN_TYPE_e TEST_FRAM_WriteData(FRAM_BLOCK_ID_e blockId, int numCalls) {
+    (void)numCalls;
+    TEST_ASSERT_EQUAL(FRAM_BLOCK_ID_SOH, blockId);
+    test_framWrites++;
+    return FRAM_ACCESS_OK;
+}
+
+/** the simulated time is the time of the current measurement */
+static uint32_t TEST_OS_GetTickCount(int numCalls) {
+    (void)numCalls;
+    return test_tableCurrentSensor.timestampCurrent[0];
+}
+
+/** open-circuit voltage of the synthetic cells, linearly interpolated from the SOC lookup table */
+static float_t TEST_GetOpenCircuitVoltage_V(float_t soc_perc) {
+    uint16_t i = 0u;
+    while ((i < (bc_stateOfChargeLookupTableLength - 2u)) && (soc_perc < bc_stateOfChargeLookupTable[i + 1u].value)) {
+        i++;
+    }
+    return MATH_LinearInterpolation(
+               bc_stateOfChargeLookupTable[i + 1u].value,
+               (float_t)bc_stateOfChargeLookupTable[i + 1u].voltage_mV,
+               bc_stateOfChargeLookupTable[i].value,
+               (float_t)bc_stateOfChargeLookupTable[i].voltage_mV,
+               soc_perc) /
+           1000.0f;
+}
+
+/** cells with increasing capacity fade and resistance increase along the string */
+static void TEST_InitializeAgedCells(void) {
+    for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+        test_cells[c].capacity_perc   = 100.0f - (float_t)c;
+        test_cells[c].resistance_mOhm = SOH_RLS_BEGIN_OF_LIFE_RESISTANCE_mOhm + (float_t)c;
+        test_cells[c].soc_perc        = 95.0f;
+        test_cells[c].rcVoltage_V     = 0.0f;
+    }
+}
+
+/** true SOH of a synthetic cell */
+static float_t TEST_GetTrueSoh_perc(const TEST_CELL_s *pCell) {
+    const float_t resistanceSoh_perc = 100.0f * (SOH_RLS_END_OF_LIFE_RESISTANCE_mOhm - pCell->resistance_mOhm) /
+                                       (SOH_RLS_END_OF_LIFE_RESISTANCE_mOhm - SOH_RLS_BEGIN_OF_LIFE_RESISTANCE_mOhm);
+    return MATH_MinimumOfTwoFloats(pCell->capacity_perc, resistanceSoh_perc);
+}
+
+/** simulates one second of all cells and runs the estimation */
+static void TEST_Step(float_t current_A) {
+    const float_t rcDecay = expf(-1.0f / TEST_RC_TIME_CONSTANT_s);
+    for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+        TEST_CELL_s *pCell = &test_cells[c];
+
+        const float_t capacity_As = SOH_RLS_NOMINAL_CAPACITY_As * pCell->capacity_perc / 100.0f;
+
+        pCell->soc_perc    = pCell->soc_perc - ((100.0f * current_A) / capacity_As);
+        pCell->rcVoltage_V = (rcDecay * pCell->rcVoltage_V) + (TEST_RC_RESISTANCE_ohm * (1.0f - rcDecay) * current_A);
+
+        const float_t voltage_V = TEST_GetOpenCircuitVoltage_V(pCell->soc_perc) - pCell->rcVoltage_V -
+                                  (pCell->resistance_mOhm * current_A / 1000.0f);
+        const uint8_t m                                = (uint8_t)(c / BS_NR_OF_CELL_BLOCKS_PER_MODULE);
+        const uint8_t cb                               = (uint8_t)(c % BS_NR_OF_CELL_BLOCKS_PER_MODULE);
+        test_tableCellVoltage.cellVoltage_mV[0][m][cb] = (int16_t)lroundf(voltage_V * 1000.0f);
+    }
+    test_tableCellVoltage.header.timestamp      = test_tableCellVoltage.header.timestamp + 1000u;
+    test_tableCurrentSensor.current_mA[0]       = (int32_t)lroundf(current_A * 1000.0f);
+    test_tableCurrentSensor.timestampCurrent[0] = test_tableCurrentSensor.timestampCurrent[0] + 1000u;
+    SE_CalculateStateOfHealth(&test_tableSoh);
+}
+
+static void TEST_RunCycles(uint32_t numberOfCycles) {
+    for (uint32_t cycle = 0u; cycle < numberOfCycles; cycle++) {
+        for (uint32_t t = 0u; t < TEST_REST_DURATION_s; t++) {
+            TEST_Step(0.0f);
+        }
+        for (uint32_t t = 0u; t < TEST_LOAD_DURATION_s; t++) {
+            TEST_Step(TEST_LOAD_CURRENT_A);
+        }
+        for (uint32_t t = 0u; t < TEST_REST_DURATION_s; t++) {
+            TEST_Step(0.0f);
+        }
+        for (uint32_t t = 0u; t < TEST_LOAD_DURATION_s; t++) {
+            TEST_Step(-TEST_LOAD_CURRENT_A);
+        }
+    }
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    DATA_Read1DataBlock_Stub(TEST_DATA_Read1DataBlock);
+    DATA_Read2DataBlocks_Stub(TEST_DATA_Read2DataBlocks);
+    FRAM_ReadData_IgnoreAndReturn(FRAM_ACCESS_OK);
+    FRAM_WriteData_Stub(TEST_FRAM_WriteData);
+    OS_GetTickCount_Stub(TEST_OS_GetTickCount);
+    test_framWrites = 0u;
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testRecursiveLeastSquares(void) {
+    float_t estimate = 100.0f;
+    float_t variance = SOH_RLS_INITIAL_CAPACITY_VARIANCE;
+    for (uint8_t i = 0u; i < 20u; i++) {
+        /* observations of a capacity of 80 % with alternating regressors */
+        const float_t regressor = ((i % 2u) == 0u) ? 0.5f : -0.3f;
+        TEST_SOH_UpdateRecursiveLeastSquares(&estimate, &variance, regressor, 80.0f * regressor);
+    }
+    /* the initial estimate is forgotten, but not completely */
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 80.0f, estimate);
+    TEST_ASSERT_LESS_THAN_FLOAT(SOH_RLS_INITIAL_CAPACITY_VARIANCE, variance);
+
+    /* without excitation the variance grows, but is bounded */
+    for (uint16_t i = 0u; i < 1000u; i++) {
+        TEST_SOH_UpdateRecursiveLeastSquares(&estimate, &variance, 0.0f, 0.0f);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 80.0f, estimate);
+    TEST_ASSERT_EQUAL_FLOAT(SOH_RLS_INITIAL_CAPACITY_VARIANCE, variance);
+}
+
+void testInitializationOfEmptyNonVolatileMemory(void) {
+    SE_InitializeStateOfHealth(&test_tableSoh, 0u);
+    for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+        TEST_ASSERT_EQUAL_FLOAT(100.0f, fram_soh.capacity_perc[0][c]);
+        TEST_ASSERT_EQUAL_FLOAT(SOH_RLS_BEGIN_OF_LIFE_RESISTANCE_mOhm, fram_soh.resistance_mOhm[0][c]);
+    }
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, test_tableSoh.minimumSoh_perc[0]);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, test_tableSoh.maximumSoh_perc[0]);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, test_tableSoh.averageSoh_perc[0]);
+}
+
+/** capacity and resistance of every cell block are tracked with synthetic aged-cell data */
+void testTrackingOfAgedCells(void) {
+    TEST_InitializeAgedCells();
+    SE_InitializeStateOfHealth(&test_tableSoh, 0u);
+    TEST_RunCycles(TEST_NR_OF_CYCLES);
+
+    float_t minimumSoh_perc = 100.0f;
+    float_t maximumSoh_perc = 0.0f;
+    for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+        TEST_ASSERT_FLOAT_WITHIN(1.5f, test_cells[c].capacity_perc, fram_soh.capacity_perc[0][c]);
+        TEST_ASSERT_FLOAT_WITHIN(1.0f, test_cells[c].resistance_mOhm, fram_soh.resistance_mOhm[0][c]);
+        minimumSoh_perc = MATH_MinimumOfTwoFloats(minimumSoh_perc, TEST_GetTrueSoh_perc(&test_cells[c]));
+        if (TEST_GetTrueSoh_perc(&test_cells[c]) > maximumSoh_perc) {
+            maximumSoh_perc = TEST_GetTrueSoh_perc(&test_cells[c]);
+        }
+    }
+    TEST_ASSERT_FLOAT_WITHIN(4.0f, minimumSoh_perc, test_tableSoh.minimumSoh_perc[0]);
+    TEST_ASSERT_FLOAT_WITHIN(4.0f, maximumSoh_perc, test_tableSoh.maximumSoh_perc[0]);
+
+    /* the estimation continues with the stored values after a restart */
+    const float_t capacity_perc = fram_soh.capacity_perc[0][BS_NR_OF_CELL_BLOCKS_PER_STRING - 1u];
+    SE_InitializeStateOfHealth(&test_tableSoh, 0u);
+    TEST_ASSERT_EQUAL_FLOAT(capacity_perc, fram_soh.capacity_perc[0][BS_NR_OF_CELL_BLOCKS_PER_STRING - 1u]);
+    TEST_ASSERT_FLOAT_WITHIN(4.0f, minimumSoh_perc, test_tableSoh.minimumSoh_perc[0]);
+}
+
+/** a current step is only evaluated together with a new cell voltage measurement */
+void testNoResistanceUpdateWithStaleCellVoltage(void) {
+    TEST_InitializeAgedCells();
+    SE_InitializeStateOfHealth(&test_tableSoh, 0u);
+    TEST_Step(0.0f);
+    const uint32_t updates        = TEST_SOH_GetNumberOfResistanceUpdates();
+    const float_t resistance_mOhm = fram_soh.resistance_mOhm[0][0];
+
+    /* new current measurement with a step, but the cell voltages have not been measured again */
+    test_tableCurrentSensor.current_mA[0]       = (int32_t)lroundf(TEST_LOAD_CURRENT_A * 1000.0f);
+    test_tableCurrentSensor.timestampCurrent[0] = test_tableCurrentSensor.timestampCurrent[0] + 500u;
+    SE_CalculateStateOfHealth(&test_tableSoh);
+    TEST_ASSERT_EQUAL(updates, TEST_SOH_GetNumberOfResistanceUpdates());
+    TEST_ASSERT_EQUAL_FLOAT(resistance_mOhm, fram_soh.resistance_mOhm[0][0]);
+
+    /* the cell voltages follow within the maximum step time: the step is evaluated */
+    TEST_Step(TEST_LOAD_CURRENT_A);
+    TEST_ASSERT_EQUAL(updates + BS_NR_OF_CELL_BLOCKS_PER_STRING, TEST_SOH_GetNumberOfResistanceUpdates());
+}
+
+/** a cell block is only updated if it is valid in both samples of the current step */
+void testNoResistanceUpdateWithInvalidPreviousCellVoltage(void) {
+    TEST_InitializeAgedCells();
+    SE_InitializeStateOfHealth(&test_tableSoh, 0u);
+    test_tableCellVoltage.invalidCellVoltage[0][0] = 1u;
+    TEST_Step(0.0f);
+    test_tableCellVoltage.invalidCellVoltage[0][0] = 0u;
+    const uint32_t updates                         = TEST_SOH_GetNumberOfResistanceUpdates();
+    const float_t resistance_mOhm                  = fram_soh.resistance_mOhm[0][0];
+
+    TEST_Step(TEST_LOAD_CURRENT_A);
+    TEST_ASSERT_EQUAL(updates + BS_NR_OF_CELL_BLOCKS_PER_STRING - 1u, TEST_SOH_GetNumberOfResistanceUpdates());
+    TEST_ASSERT_EQUAL_FLOAT(resistance_mOhm, fram_soh.resistance_mOhm[0][0]);
+}
+
+/** one cycle updates the estimators of every cell block once per current step and reference rest point */
+void testNumberOfUpdatesPerCycle(void) {
+    TEST_InitializeAgedCells();
+    SE_InitializeStateOfHealth(&test_tableSoh, 0u);
+    const uint32_t capacityUpdates   = TEST_SOH_GetNumberOfCapacityUpdates();
+    const uint32_t resistanceUpdates = TEST_SOH_GetNumberOfResistanceUpdates();
+
+    TEST_RunCycles(1u);
+
+    /* the cycle ends with the charge phase: three current steps and two rest points, of which only the second one
+     * has a reference rest point */
+    TEST_ASSERT_EQUAL(
+        3u * BS_NR_OF_CELL_BLOCKS_PER_STRING, TEST_SOH_GetNumberOfResistanceUpdates() - resistanceUpdates);
+    TEST_ASSERT_EQUAL(1u * BS_NR_OF_CELL_BLOCKS_PER_STRING, TEST_SOH_GetNumberOfCapacityUpdates() - capacityUpdates);
+}
+
+/** the estimates are stored at most once per checkpoint period, even if every sample updates them */
+void testCheckpointIsRateLimited(void) {
+    TEST_InitializeAgedCells();
+    SE_InitializeStateOfHealth(&test_tableSoh, 0u);
+    const uint32_t resistanceUpdates = TEST_SOH_GetNumberOfResistanceUpdates();
+
+    /* a current step in every sample for two checkpoint periods */
+    const uint32_t duration_s = (2u * SOH_RLS_CHECKPOINT_PERIOD_ms) / 1000u;
+    for (uint32_t t = 0u; t < duration_s; t++) {
+        TEST_Step(((t % 2u) == 0u) ? TEST_LOAD_CURRENT_A : -TEST_LOAD_CURRENT_A);
+    }
+    TEST_ASSERT_TRUE((TEST_SOH_GetNumberOfResistanceUpdates() - resistanceUpdates) > duration_s);
+    TEST_ASSERT_EQUAL(2u, test_framWrites);
+
+    /* without new observations, nothing is written */
+    for (uint32_t t = 0u; t < duration_s; t++) {
+        test_tableCurrentSensor.timestampCurrent[0] += 1000u;
+        SE_CalculateStateOfHealth(&test_tableSoh);
+    }
+    TEST_ASSERT_EQUAL(2u, test_framWrites);
+}
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+/** host benchmark: reports the cost per sample and cell block */
+void testUpdateCostPerCell(void) {
+    TEST_InitializeAgedCells();
+    SE_InitializeStateOfHealth(&test_tableSoh, 0u);
+
+    const clock_t start = clock();
+    TEST_RunCycles(1u);
+    const clock_t stop = clock();
+
+    /* includes the simulation of the synthetic cells, i.e., it is an upper bound */
+    const double samples = 2.0 * (double)(TEST_REST_DURATION_s + TEST_LOAD_DURATION_s) *
+                           (double)BS_NR_OF_CELL_BLOCKS_PER_STRING;
+    char message[100]    = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "cost per sample and cell block: %.0f ns (host)",
+        (1.0e9 * (double)(stop - start)) / ((double)CLOCKS_PER_SEC * samples));
+    TEST_MESSAGE(message);
+}
+#endif
@@ -68,8 +68,30 @@ TEST_INCLUDE_PATH("../../src/app/application/algorithm/config")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
 ALGO_TASKS_s algo_algorithms[] = {
-    {ALGO_UNINITIALIZED, 100, 1000, 0, NULL_PTR, &TEST_AlgorithmComputeFunction},
-    {ALGO_UNINITIALIZED, 100, 1000, 0, &TEST_AlgorithmInitializationFunction, &TEST_AlgorithmComputeFunction},
+    {
+        .state                     = ALGO_UNINITIALIZED,
+        .cycleTime_ms              = 100u,
+        .phase_ms                  = 0u,
+        .maxCalculationDuration_ms = 1000u,
+        .stepBudget_ms             = 0u,
+        .startTime                 = 0u,
+        .fpInitialization          = NULL_PTR,
+        .fpAlgorithm               = &TEST_AlgorithmComputeFunction,
+        .fpStep                    = NULL_PTR,
+        .runtime                   = ALGO_RUNTIME_INITIALIZER,
+    },
+    {
+        .state                     = ALGO_UNINITIALIZED,
+        .cycleTime_ms              = 100u,
+        .phase_ms                  = 0u,
+        .maxCalculationDuration_ms = 1000u,
+        .stepBudget_ms             = 0u,
+        .startTime                 = 0u,
+        .fpInitialization          = &TEST_AlgorithmInitializationFunction,
+        .fpAlgorithm               = &TEST_AlgorithmComputeFunction,
+        .fpStep                    = NULL_PTR,
+        .runtime                   = ALGO_RUNTIME_INITIALIZER,
+    },
 };
 
 const uint16_t algo_length = sizeof(algo_algorithms) / sizeof(algo_algorithms[0]);
@@ -116,12 +138,15 @@ void testUnlockInitialization(void) {
     TEST_AlgorithmInitializationFunction_ExpectAndReturn(STD_OK);
 
     /* this is the retrieval of the start time for both algorithms and
-       after that both algorithms should be called */
+       after that both algorithms should be called; the end time is retrieved
+       for the runtime statistics */
     OS_GetTickCount_ExpectAndReturn(0u);
     TEST_AlgorithmComputeFunction_Expect();
+    OS_GetTickCount_ExpectAndReturn(0u);
     ALGO_MarkAsDone_Expect(0u);
     OS_GetTickCount_ExpectAndReturn(0u);
     TEST_AlgorithmComputeFunction_Expect();
+    OS_GetTickCount_ExpectAndReturn(0u);
     ALGO_MarkAsDone_Expect(1u);
 
     ALGO_MainFunction();
@@ -167,6 +192,7 @@ void testUnsuccessfulInitialization(void) {
        error state */
     OS_GetTickCount_ExpectAndReturn(0u);
     TEST_AlgorithmComputeFunction_Expect();
+    OS_GetTickCount_ExpectAndReturn(0u);
     ALGO_MarkAsDone_Expect(0u);
 
     ALGO_MainFunction();
@@ -242,9 +268,11 @@ void testCycleTimeZero(void) {
     TEST_AlgorithmInitializationFunction_ExpectAndReturn(STD_OK);
     OS_GetTickCount_ExpectAndReturn(0u);
     TEST_AlgorithmComputeFunction_Expect();
+    OS_GetTickCount_ExpectAndReturn(0u);
     ALGO_MarkAsDone_Expect(0u);
     OS_GetTickCount_ExpectAndReturn(0u);
     TEST_AlgorithmComputeFunction_Expect();
+    OS_GetTickCount_ExpectAndReturn(0u);
     ALGO_MarkAsDone_Expect(1u);
     ALGO_MainFunction();
 }
@@ -284,3 +312,67 @@ void testMonitorFunctionStopBecauseOutOfTime(void) {
     ALGO_MonitorExecutionTime();
     TEST_ASSERT_EQUAL(ALGO_BLOCKED, algo_algorithms[0].state);
 }
+
+void testInvalidPhaseConfiguration(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    ALGO_UnlockInitialization();
+    const uint32_t storeCycleTime   = algo_algorithms[0].cycleTime_ms;
+    algo_algorithms[0].cycleTime_ms = 2u * ALGO_TICK_ms;
+
+    /* phase has to be a multiple of the tick */
+    algo_algorithms[0].phase_ms = ALGO_TICK_ms + 1u;
+    TEST_ASSERT_FAIL_ASSERT(ALGO_MainFunction());
+
+    /* phase has to be smaller than the cycle time */
+    algo_algorithms[0].phase_ms = algo_algorithms[0].cycleTime_ms;
+    TEST_ASSERT_FAIL_ASSERT(ALGO_MainFunction());
+
+    /* restore configuration for other tests */
+    algo_algorithms[0].phase_ms     = 0u;
+    algo_algorithms[0].cycleTime_ms = storeCycleTime;
+}
+
+void testInvalidComputationFunctionConfiguration(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    ALGO_UnlockInitialization();
+
+    /* an algorithm without any computation function is invalid */
+    algo_algorithms[0].fpAlgorithm = NULL_PTR;
+    TEST_ASSERT_FAIL_ASSERT(ALGO_MainFunction());
+    algo_algorithms[0].fpAlgorithm = &TEST_AlgorithmComputeFunction;
+}
+
+void testRuntimeStatisticsOfCompletedCycle(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    ALGO_UnlockInitialization();
+    algo_algorithms[0].runtime = (ALGO_RUNTIME_s)ALGO_RUNTIME_INITIALIZER;
+
+    TEST_AlgorithmInitializationFunction_ExpectAndReturn(STD_OK);
+    /* first algorithm takes 7ms */
+    OS_GetTickCount_ExpectAndReturn(100u);
+    TEST_AlgorithmComputeFunction_Expect();
+    OS_GetTickCount_ExpectAndReturn(107u);
+    ALGO_MarkAsDone_Expect(0u);
+    OS_GetTickCount_ExpectAndReturn(107u);
+    TEST_AlgorithmComputeFunction_Expect();
+    OS_GetTickCount_ExpectAndReturn(107u);
+    ALGO_MarkAsDone_Expect(1u);
+    ALGO_MainFunction();
+
+    ALGO_RUNTIME_s runtime = ALGO_RUNTIME_INITIALIZER;
+    ALGO_GetRuntimeStatistics(0u, &runtime);
+    TEST_ASSERT_EQUAL(1u, runtime.activations);
+    TEST_ASSERT_EQUAL(1u, runtime.steps);
+    TEST_ASSERT_EQUAL(7u, runtime.lastDuration_ms);
+    TEST_ASSERT_EQUAL(7u, runtime.maxDuration_ms);
+    TEST_ASSERT_EQUAL(0u, runtime.suspensions);
+}
+
+void testGetRuntimeStatisticsInvalidInput(void) {
+    ALGO_RUNTIME_s runtime = ALGO_RUNTIME_INITIALIZER;
+    TEST_ASSERT_FAIL_ASSERT(ALGO_GetRuntimeStatistics(UINT32_MAX, &runtime));
+    TEST_ASSERT_FAIL_ASSERT(ALGO_GetRuntimeStatistics(0u, NULL_PTR));
+}
@@ -0,0 +1,284 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_algorithm_scheduling.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests of the scheduling of the algorithm module
+ * @details This file runs a configuration of ten algorithms with mixed cycle
+ *          times on a simulated clock. The same workload is scheduled once
+ *          with all algorithms activated in phase and run to completion and
+ *          once with phase offsets and a resumable, budgeted algorithm. The
+ *          worst-case duration of a tick of the algorithm task is compared.
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockalgorithm_cfg.h"
+#include "Mockos.h"
+
+#include "algorithm.h"
+#include "fstd_types.h"
+#include "test_assert_helper.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("algorithm.c")
+
+TEST_INCLUDE_PATH("../../src/app/application/algorithm")
+TEST_INCLUDE_PATH("../../src/app/application/algorithm/config")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** number of ticks that are simulated (10 seconds and the ticks needed to
+    finish the last cycle of the resumable algorithm) */
+#define TEST_SIMULATED_TICKS (102u)
+
+/** duration of one step of the heavy algorithm */
+#define TEST_HEAVY_STEP_DURATION_ms (5u)
+
+/** number of steps of the heavy algorithm */
+#define TEST_HEAVY_NUMBER_OF_STEPS (8u)
+
+/** simulated time */
+static uint32_t test_time_ms = 0u;
+
+/** number of executed steps in the current cycle of the heavy algorithm */
+static uint32_t test_heavyStep = 0u;
+
+static void TEST_Algorithm2ms(void) {
+    test_time_ms += 2u;
+}
+
+static void TEST_Algorithm3ms(void) {
+    test_time_ms += 3u;
+}
+
+static void TEST_Algorithm4ms(void) {
+    test_time_ms += 4u;
+}
+
+static void TEST_Algorithm6ms(void) {
+    test_time_ms += 6u;
+}
+
+static void TEST_Algorithm8ms(void) {
+    test_time_ms += 8u;
+}
+
+/* the heavy algorithm (e.g., the imbalance computation) in one piece */
+static void TEST_AlgorithmHeavy(void) {
+    test_time_ms += TEST_HEAVY_NUMBER_OF_STEPS * TEST_HEAVY_STEP_DURATION_ms;
+}
+
+/* the heavy algorithm split into resumable steps */
+static ALGO_STEP_RESULT_e TEST_AlgorithmHeavyStep(void) {
+    ALGO_STEP_RESULT_e result = ALGO_STEP_PENDING;
+
+    test_time_ms += TEST_HEAVY_STEP_DURATION_ms;
+    test_heavyStep++;
+    if (test_heavyStep == TEST_HEAVY_NUMBER_OF_STEPS) {
+        test_heavyStep = 0u;
+        result         = ALGO_STEP_FINISHED;
+    }
+    return result;
+}
+
+static uint32_t TEST_GetTickCount(int numberOfCalls) {
+    return test_time_ms;
+}
+
+static void TEST_MarkAsDone(uint32_t algorithmIndex, int numberOfCalls) {
+    if (algo_algorithms[algorithmIndex].state != ALGO_BLOCKED) {
+        algo_algorithms[algorithmIndex].state = ALGO_READY;
+    }
+}
+
+/** algorithm that runs to completion, activated with a phase offset */
+#define TEST_ALGORITHM(cycle, phase, function)                 \
+    {                                                          \
+        .state                     = ALGO_UNINITIALIZED,       \
+        .cycleTime_ms              = (cycle),                  \
+        .phase_ms                  = (phase),                  \
+        .maxCalculationDuration_ms = 1000u,                    \
+        .stepBudget_ms             = 0u,                       \
+        .startTime                 = 0u,                       \
+        .fpInitialization          = NULL_PTR,                 \
+        .fpAlgorithm               = (function),               \
+        .fpStep                    = NULL_PTR,                 \
+        .runtime                   = ALGO_RUNTIME_INITIALIZER, \
+    }
+
+/** all algorithms activated in phase and run to completion */
+static const ALGO_TASKS_s test_algorithmsInPhase[] = {
+    TEST_ALGORITHM(100u, 0u, &TEST_Algorithm2ms),
+    TEST_ALGORITHM(100u, 0u, &TEST_Algorithm3ms),
+    TEST_ALGORITHM(200u, 0u, &TEST_Algorithm4ms),
+    TEST_ALGORITHM(200u, 0u, &TEST_Algorithm4ms),
+    TEST_ALGORITHM(500u, 0u, &TEST_Algorithm6ms),
+    TEST_ALGORITHM(500u, 0u, &TEST_Algorithm6ms),
+    TEST_ALGORITHM(1000u, 0u, &TEST_Algorithm8ms),
+    TEST_ALGORITHM(1000u, 0u, &TEST_Algorithm8ms),
+    TEST_ALGORITHM(1000u, 0u, &TEST_Algorithm8ms),
+    TEST_ALGORITHM(1000u, 0u, &TEST_AlgorithmHeavy),
+};
+
+/** the same workload with phase offsets and the heavy algorithm split into steps */
+static const ALGO_TASKS_s test_algorithmsSpread[] = {
+    TEST_ALGORITHM(100u, 0u, &TEST_Algorithm2ms),
+    TEST_ALGORITHM(100u, 0u, &TEST_Algorithm3ms),
+    TEST_ALGORITHM(200u, 0u, &TEST_Algorithm4ms),
+    TEST_ALGORITHM(200u, 100u, &TEST_Algorithm4ms),
+    TEST_ALGORITHM(500u, 100u, &TEST_Algorithm6ms),
+    TEST_ALGORITHM(500u, 300u, &TEST_Algorithm6ms),
+    TEST_ALGORITHM(1000u, 200u, &TEST_Algorithm8ms),
+    TEST_ALGORITHM(1000u, 400u, &TEST_Algorithm8ms),
+    TEST_ALGORITHM(1000u, 600u, &TEST_Algorithm8ms),
+    {
+        .state                     = ALGO_UNINITIALIZED,
+        .cycleTime_ms              = 1000u,
+        .phase_ms                  = 800u,
+        .maxCalculationDuration_ms = 1000u,
+        .stepBudget_ms             = 10u,
+        .startTime                 = 0u,
+        .fpInitialization          = NULL_PTR,
+        .fpAlgorithm               = NULL_PTR,
+        .fpStep                    = &TEST_AlgorithmHeavyStep,
+        .runtime                   = ALGO_RUNTIME_INITIALIZER,
+    },
+};
+
+ALGO_TASKS_s algo_algorithms[10u] = {0};
+
+const uint16_t algo_length = sizeof(algo_algorithms) / sizeof(algo_algorithms[0]);
+
+/**
+ * @brief   runs the algorithm main function on the simulated clock
+ * @returns worst-case duration of a tick in ms
+ */
+static uint32_t TEST_RunSimulation(void) {
+    uint32_t worstCaseTick_ms = 0u;
+    ALGO_UnlockInitialization();
+    for (uint32_t tick = 0u; tick < TEST_SIMULATED_TICKS; tick++) {
+        test_time_ms             = tick * ALGO_TICK_ms;
+        const uint32_t tickStart = test_time_ms;
+        ALGO_MainFunction();
+        const uint32_t duration_ms = test_time_ms - tickStart;
+        if (duration_ms > worstCaseTick_ms) {
+            worstCaseTick_ms = duration_ms;
+        }
+        /* the next tick must not start before the current has finished */
+        TEST_ASSERT_LESS_THAN_UINT32(ALGO_TICK_ms, duration_ms);
+    }
+    return worstCaseTick_ms;
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    OS_GetTickCount_Stub(&TEST_GetTickCount);
+    ALGO_MarkAsDone_Stub(&TEST_MarkAsDone);
+    test_time_ms   = 0u;
+    test_heavyStep = 0u;
+    TEST_ALGO_ResetInitializationRequest();
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testWorstCaseTickInPhase(void) {
+    (void)memcpy(algo_algorithms, test_algorithmsInPhase, sizeof(algo_algorithms));
+
+    const uint32_t worstCaseTick_ms = TEST_RunSimulation();
+
+    /* all algorithms are activated in the same tick */
+    TEST_ASSERT_EQUAL_UINT32(89u, worstCaseTick_ms);
+    TEST_ASSERT_EQUAL_UINT32(11u, algo_algorithms[9].runtime.activations);
+    TEST_ASSERT_EQUAL_UINT32(40u, algo_algorithms[9].runtime.maxDuration_ms);
+}
+
+void testWorstCaseTickSpread(void) {
+    (void)memcpy(algo_algorithms, test_algorithmsSpread, sizeof(algo_algorithms));
+
+    const uint32_t worstCaseTick_ms = TEST_RunSimulation();
+
+    /* phase offsets and the step budget reduce the worst-case tick */
+    TEST_ASSERT_EQUAL_UINT32(25u, worstCaseTick_ms);
+
+    /* the same work is done as in the in-phase configuration */
+    TEST_ASSERT_EQUAL_UINT32(102u, algo_algorithms[0].runtime.activations);
+    TEST_ASSERT_EQUAL_UINT32(51u, algo_algorithms[3].runtime.activations);
+    TEST_ASSERT_EQUAL_UINT32(20u, algo_algorithms[5].runtime.activations);
+    TEST_ASSERT_EQUAL_UINT32(10u, algo_algorithms[8].runtime.activations);
+
+    /* the heavy algorithm runs in four ticks with two steps each and meets
+       its deadline */
+    ALGO_RUNTIME_s heavy = ALGO_RUNTIME_INITIALIZER;
+    ALGO_GetRuntimeStatistics(9u, &heavy);
+    TEST_ASSERT_EQUAL_UINT32(TEST_HEAVY_NUMBER_OF_STEPS * heavy.activations, heavy.steps);
+    TEST_ASSERT_EQUAL_UINT32(3u * heavy.activations, heavy.suspensions);
+    TEST_ASSERT_EQUAL_UINT32(0u, heavy.missedActivations);
+    TEST_ASSERT_EQUAL_UINT32((3u * ALGO_TICK_ms) + 10u, heavy.maxDuration_ms);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(algo_algorithms[9].maxCalculationDuration_ms, heavy.maxDuration_ms);
+}
+
+void testMissedActivationOfResumableAlgorithm(void) {
+    (void)memcpy(algo_algorithms, test_algorithmsSpread, sizeof(algo_algorithms));
+    /* activate the heavy algorithm faster than it can finish */
+    algo_algorithms[9].cycleTime_ms = 2u * ALGO_TICK_ms;
+    algo_algorithms[9].phase_ms     = 0u;
+
+    (void)TEST_RunSimulation();
+
+    TEST_ASSERT_GREATER_THAN_UINT32(0u, algo_algorithms[9].runtime.missedActivations);
+    TEST_ASSERT_EQUAL_UINT32(
+        TEST_SIMULATED_TICKS / 2u,
+        algo_algorithms[9].runtime.activations + algo_algorithms[9].runtime.missedActivations);
+}
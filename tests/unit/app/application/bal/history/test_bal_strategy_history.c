@@ -43,7 +43,7 @@
  * @file    test_bal_strategy_history.c
  * @author  foxBMS Team
  * @date    2020-06-05 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -66,10 +66,14 @@
 #include "Mockspi.h"
 #include "Mockstate_estimation.h"
 
+#include "battery_cell_cfg.h"
 #include "database_cfg.h"
+#include "database_helper.h"
 
 #include "bal.h"
 
+#include <stdlib.h>
+
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_SOURCE_FILE("bal_strategy_history.c")
 
@@ -85,9 +89,100 @@ TEST_INCLUDE_PATH("../../src/app/driver/sps")
 TEST_INCLUDE_PATH("../../src/app/task/config")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
+/** number of balancing cycles simulated in the work counter test */
+#define TEST_NUMBER_OF_CYCLES (1000u)
+
+/** database content that is seen by the balancing module */
+static DATA_BLOCK_CELL_VOLTAGE_s test_cellVoltage           = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE_BASE};
+static DATA_BLOCK_BALANCING_CONTROL_s test_balancingControl = {.header.uniqueId = DATA_BLOCK_ID_BALANCING_CONTROL};
+
+/** number of SOC look-ups */
+static uint32_t test_socLookUps = 0u;
+
+/** number of database writes */
+static uint32_t test_databaseWrites = 0u;
+
+/** number of lent cell voltage tables that are reported as written during the evaluation */
+static uint8_t test_concurrentWrites = 0u;
+
+/** cell voltage that a preempting writer writes into the first cell block */
+static int16_t test_concurrentVoltage_mV = 0;
+
+static STD_RETURN_TYPE_e TEST_DATA_Read1DataBlock(void *pDataToReceiver0, int numCalls) {
+    (void)numCalls;
+    *(DATA_BLOCK_BALANCING_CONTROL_s *)pDataToReceiver0 = test_balancingControl;
+    return STD_OK;
+}
+
+static void TEST_DATA_BorrowDataBlock(DATA_BLOCK_ID_e blockId, DATA_READ_VIEW_s *pView, int numCalls) {
+    (void)numCalls;
+    TEST_ASSERT_EQUAL(DATA_BLOCK_ID_CELL_VOLTAGE, blockId);
+    pView->blockId     = blockId;
+    pView->version     = 0u;
+    pView->pkDataBlock = &test_cellVoltage;
+}
+
+/** the first #test_concurrentWrites returned views have been written during the evaluation */
+static STD_RETURN_TYPE_e TEST_DATA_ReturnDataBlock(const DATA_READ_VIEW_s *const kpkView, int numCalls) {
+    (void)kpkView;
+    (void)numCalls;
+    STD_RETURN_TYPE_e retval = STD_OK;
+    if (test_concurrentWrites > 0u) {
+        test_concurrentWrites--;
+        test_cellVoltage.cellVoltage_mV[0][0][0] = test_concurrentVoltage_mV;
+        retval                                   = STD_NOT_OK;
+    }
+    return retval;
+}
+
+static STD_RETURN_TYPE_e TEST_DATA_Write1DataBlock(void *pDataFromSender0, int numCalls) {
+    (void)numCalls;
+    test_balancingControl = *(DATA_BLOCK_BALANCING_CONTROL_s *)pDataFromSender0;
+    test_databaseWrites++;
+    return STD_OK;
+}
+
+/** linear SOC-over-voltage characteristic: 3000 mV equals 0 %, 4000 mV equals 100 % */
+static float_t TEST_SE_GetStateOfChargeFromVoltage(int16_t voltage_mV, int numCalls) {
+    (void)numCalls;
+    test_socLookUps++;
+    return ((float_t)voltage_mV - 3000.0f) / 10.0f;
+}
+
+/** reference implementation of the depth-of-discharge of a cell */
+static uint32_t TEST_GetDepthOfDischarge_mAs(int16_t voltage_mV) {
+    const float_t soc_perc = ((float_t)voltage_mV - 3000.0f) / 10.0f;
+    return (uint32_t)(((100.0f - soc_perc) / 100.0f) * (float_t)(BC_CAPACITY_mAh * 3600u));
+}
+
+static void TEST_SetAllCellVoltages(int16_t voltage_mV) {
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            for (uint16_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+                test_cellVoltage.cellVoltage_mV[s][m][cb] = voltage_mV;
+            }
+        }
+    }
+}
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    DATA_Read1DataBlock_Stub(TEST_DATA_Read1DataBlock);
+    DATA_BorrowDataBlock_Stub(TEST_DATA_BorrowDataBlock);
+    DATA_ReturnDataBlock_Stub(TEST_DATA_ReturnDataBlock);
+    DATA_Write1DataBlock_Stub(TEST_DATA_Write1DataBlock);
+    SE_GetStateOfChargeFromVoltage_Stub(TEST_SE_GetStateOfChargeFromVoltage);
+    BAL_GetBalancingThreshold_mV_IgnoreAndReturn(BAL_DEFAULT_THRESHOLD_mV);
+    TEST_SetAllCellVoltages(3500);
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+            test_balancingControl.deltaCharge_mAs[s][c] = 0u;
+        }
+    }
+    test_socLookUps       = 0u;
+    test_databaseWrites   = 0u;
+    test_concurrentWrites = 0u;
+    TEST_BAL_ResetImbalanceCache();
 }
 
 void tearDown(void) {
@@ -118,3 +213,131 @@ void testBalancingFinished(void) {
     balancingState->initializationFinished = STD_OK;
     TEST_ASSERT_EQUAL(STD_OK, BAL_GetInitializationState());
 }
+
+/** the minimum cell is found and the imbalance of all cells above the threshold is computed */
+void testComputeImbalances(void) {
+    const int16_t threshold_mV               = BAL_DEFAULT_THRESHOLD_mV + BAL_HYSTERESIS_mV;
+    test_cellVoltage.cellVoltage_mV[0][1][3] = 3000;
+    test_cellVoltage.cellVoltage_mV[0][0][2] = 3000 + threshold_mV;
+    test_cellVoltage.cellVoltage_mV[0][1][7] = 3000 + threshold_mV - 1;
+
+    TEST_BAL_ComputeImbalances();
+
+    const uint16_t minimumCellBlock = BS_NR_OF_CELL_BLOCKS_PER_MODULE + 3u;
+    const uint32_t maxDod_mAs       = TEST_GetDepthOfDischarge_mAs(3000);
+    TEST_ASSERT_EQUAL(minimumCellBlock, TEST_BAL_GetMinimumCellBlock(0u));
+    TEST_ASSERT_EQUAL(BS_NR_OF_CELL_BLOCKS_PER_STRING, test_socLookUps);
+    TEST_ASSERT_EQUAL(1u, test_databaseWrites);
+    TEST_ASSERT_EQUAL(0u, test_balancingControl.deltaCharge_mAs[0][minimumCellBlock]);
+    TEST_ASSERT_EQUAL(
+        maxDod_mAs - TEST_GetDepthOfDischarge_mAs(3000 + threshold_mV), test_balancingControl.deltaCharge_mAs[0][2]);
+    TEST_ASSERT_EQUAL(
+        maxDod_mAs - TEST_GetDepthOfDischarge_mAs(3500), test_balancingControl.deltaCharge_mAs[0][0]);
+    /* cell below the threshold is not touched */
+    TEST_ASSERT_EQUAL(0u, test_balancingControl.deltaCharge_mAs[0][BS_NR_OF_CELL_BLOCKS_PER_MODULE + 7u]);
+}
+
+/** as in a linear scan with '<=', the last cell block with the minimum voltage is the minimum cell */
+void testComputeImbalancesMinimumTieBreak(void) {
+    test_cellVoltage.cellVoltage_mV[0][0][1] = 3000;
+    test_cellVoltage.cellVoltage_mV[0][1][5] = 3000;
+    TEST_BAL_ComputeImbalances();
+    TEST_ASSERT_EQUAL(BS_NR_OF_CELL_BLOCKS_PER_MODULE + 5u, TEST_BAL_GetMinimumCellBlock(0u));
+
+    /* raising the minimum cell moves the minimum to the other cell block */
+    test_cellVoltage.cellVoltage_mV[0][1][5] = 3001;
+    TEST_BAL_ComputeImbalances();
+    TEST_ASSERT_EQUAL(1u, TEST_BAL_GetMinimumCellBlock(0u));
+
+    /* a new minimum anywhere in the string is found */
+    test_cellVoltage.cellVoltage_mV[0][1][13] = 2999;
+    TEST_BAL_ComputeImbalances();
+    TEST_ASSERT_EQUAL(BS_NR_OF_CELL_BLOCKS_PER_MODULE + 13u, TEST_BAL_GetMinimumCellBlock(0u));
+}
+
+/** unchanged cell voltages neither require SOC look-ups nor a database write */
+void testComputeImbalancesWithoutChange(void) {
+    test_cellVoltage.cellVoltage_mV[0][0][0] = 3000;
+    TEST_BAL_ComputeImbalances();
+    TEST_ASSERT_EQUAL(BS_NR_OF_CELL_BLOCKS_PER_STRING, test_socLookUps);
+    TEST_ASSERT_EQUAL(1u, test_databaseWrites);
+
+    TEST_BAL_ComputeImbalances();
+    TEST_ASSERT_EQUAL(BS_NR_OF_CELL_BLOCKS_PER_STRING, test_socLookUps);
+    TEST_ASSERT_EQUAL(1u, test_databaseWrites);
+
+    /* invalidating the cache refills it, but the imbalances are unchanged */
+    TEST_BAL_ResetImbalanceCache();
+    TEST_BAL_ComputeImbalances();
+    TEST_ASSERT_EQUAL(2u * BS_NR_OF_CELL_BLOCKS_PER_STRING, test_socLookUps);
+    TEST_ASSERT_EQUAL(1u, test_databaseWrites);
+}
+
+/** a cell voltage that is written during the update of the cache is taken over by the repeated update */
+void testComputeImbalancesAfterConcurrentWrite(void) {
+    test_cellVoltage.cellVoltage_mV[0][1][3] = 3400;
+    test_concurrentVoltage_mV                = 3000;
+    test_concurrentWrites                    = 1u;
+
+    TEST_BAL_ComputeImbalances();
+
+    const uint32_t maxDod_mAs = TEST_GetDepthOfDischarge_mAs(3000);
+    TEST_ASSERT_EQUAL(0u, TEST_BAL_GetMinimumCellBlock(0u));
+    TEST_ASSERT_EQUAL(0u, test_balancingControl.deltaCharge_mAs[0][0]);
+    TEST_ASSERT_EQUAL(
+        maxDod_mAs - TEST_GetDepthOfDischarge_mAs(3400),
+        test_balancingControl.deltaCharge_mAs[0][BS_NR_OF_CELL_BLOCKS_PER_MODULE + 3u]);
+    TEST_ASSERT_EQUAL(1u, test_databaseWrites);
+}
+
+/**
+ * work counter test: with slowly varying cell voltages the number of SOC
+ * look-ups is far below one look-up per cell and cycle, while the minimum
+ * cell still matches a linear scan
+ */
+void testComputeImbalancesWorkCounter(void) {
+    const uint32_t dodComputationsAtStart = TEST_BAL_GetNumberOfDodComputations();
+    srand(42u);
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            for (uint16_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+                test_cellVoltage.cellVoltage_mV[s][m][cb] = (int16_t)(3300 + (rand() % 600));
+            }
+        }
+    }
+
+    for (uint32_t cycle = 0u; cycle < TEST_NUMBER_OF_CYCLES; cycle++) {
+        /* random walk: every cell block changes by at most 1 mV per cycle */
+        for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+            for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+                for (uint16_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+                    test_cellVoltage.cellVoltage_mV[s][m][cb] += (int16_t)((rand() % 3) - 1);
+                }
+            }
+        }
+        TEST_BAL_ComputeImbalances();
+
+        /* reference: linear scan as in the former implementation */
+        for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+            int16_t voltageMin_mV = INT16_MAX;
+            uint16_t minimum      = 0u;
+            for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+                const int16_t voltage_mV = test_cellVoltage.cellVoltage_mV[s][c / BS_NR_OF_CELL_BLOCKS_PER_MODULE]
+                                                                          [c % BS_NR_OF_CELL_BLOCKS_PER_MODULE];
+                if (voltage_mV <= voltageMin_mV) {
+                    voltageMin_mV = voltage_mV;
+                    minimum       = c;
+                }
+            }
+            TEST_ASSERT_EQUAL(minimum, TEST_BAL_GetMinimumCellBlock(s));
+            TEST_ASSERT_EQUAL(0u, test_balancingControl.deltaCharge_mAs[s][minimum]);
+        }
+    }
+
+    /* a full scan would require one look-up per cell block and cycle */
+    const uint32_t fullScanLookUps = TEST_NUMBER_OF_CYCLES * BS_NR_OF_STRINGS * BS_NR_OF_CELL_BLOCKS_PER_STRING;
+    TEST_ASSERT_EQUAL(test_socLookUps, TEST_BAL_GetNumberOfDodComputations() - dodComputationsAtStart);
+    TEST_ASSERT_LESS_THAN(fullScanLookUps / 4u, test_socLookUps);
+    TEST_ASSERT_LESS_OR_EQUAL(TEST_NUMBER_OF_CYCLES, test_databaseWrites);
+}
+
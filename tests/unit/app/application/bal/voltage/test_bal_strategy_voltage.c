@@ -43,7 +43,7 @@
  * @file    test_bal_strategy_voltage.c
  * @author  foxBMS Team
  * @date    2020-06-05 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -66,6 +66,7 @@
 #include "Mockspi.h"
 
 #include "database_cfg.h"
+#include "database_helper.h"
 
 #include "bal.h"
 #include "bal_strategy_voltage.h"
@@ -83,9 +84,55 @@ TEST_INCLUDE_PATH("../../src/app/driver/sps")
 TEST_INCLUDE_PATH("../../src/app/task/config")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
+/** database entries that are lent to the balancing module */
+static DATA_BLOCK_CELL_VOLTAGE_s test_cellVoltage = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+static DATA_BLOCK_MIN_MAX_s test_minMax           = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+
+/** number of lent data blocks that are reported as written during the evaluation */
+static uint8_t test_concurrentWrites = 0u;
+
+static void TEST_DATA_BorrowDataBlock(DATA_BLOCK_ID_e blockId, DATA_READ_VIEW_s *pView, int numCalls) {
+    (void)numCalls;
+    pView->blockId     = blockId;
+    pView->version     = 0u;
+    pView->pkDataBlock = &test_minMax;
+    if (blockId == DATA_BLOCK_ID_CELL_VOLTAGE) {
+        pView->pkDataBlock = &test_cellVoltage;
+    }
+}
+
+/** the first #test_concurrentWrites returned views have been written during the evaluation */
+static STD_RETURN_TYPE_e TEST_DATA_ReturnDataBlock(const DATA_READ_VIEW_s *const kpkView, int numCalls) {
+    (void)kpkView;
+    (void)numCalls;
+    STD_RETURN_TYPE_e retval = STD_OK;
+    if (test_concurrentWrites > 0u) {
+        test_concurrentWrites--;
+        /* the preempting writer has brought the cell voltages back to the minimum */
+        test_cellVoltage.cellVoltage_mV[0][0][0] = test_minMax.minimumCellVoltage_mV[0];
+        retval                                   = STD_NOT_OK;
+    }
+    return retval;
+}
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    DATA_BorrowDataBlock_Stub(TEST_DATA_BorrowDataBlock);
+    DATA_ReturnDataBlock_Stub(TEST_DATA_ReturnDataBlock);
+    DATA_Write1DataBlock_IgnoreAndReturn(STD_OK);
+    BAL_GetBalancingThreshold_mV_IgnoreAndReturn(BAL_DEFAULT_THRESHOLD_mV);
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        test_minMax.minimumCellVoltage_mV[s] = 3500;
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+                test_cellVoltage.cellVoltage_mV[s][m][cb] = 3500;
+            }
+        }
+    }
+    test_concurrentWrites = 0u;
+    BAL_STATE_s *pBalancingState        = TEST_BAL_GetBalancingState();
+    pBalancingState->balancingThreshold = BAL_DEFAULT_THRESHOLD_mV + BAL_HYSTERESIS_mV;
+    pBalancingState->active             = false;
 }
 
 void tearDown(void) {
@@ -116,3 +163,34 @@ void testBalancingFinished(void) {
     balancingState->initializationFinished = STD_OK;
     TEST_ASSERT_EQUAL(STD_OK, BAL_GetInitializationState());
 }
+
+
+/** cells above the threshold are balanced based on the lent database entries */
+void testActivateBalancingWithBorrowedDataBlocks(void) {
+    test_cellVoltage.cellVoltage_mV[0][1][2] = 3500 + BAL_DEFAULT_THRESHOLD_mV + BAL_HYSTERESIS_mV + 1;
+
+    TEST_ASSERT_FALSE(TEST_BAL_ActivateBalancing());
+
+    DATA_BLOCK_BALANCING_CONTROL_s *pBalancing = TEST_BAL_GetBalancingControl();
+    TEST_ASSERT_EQUAL(1u, pBalancing->balancingState[0][BS_NR_OF_CELL_BLOCKS_PER_MODULE + 2u]);
+    TEST_ASSERT_EQUAL(1u, pBalancing->nrBalancedCells[0]);
+    TEST_ASSERT_EQUAL(1u, pBalancing->enableBalancing);
+    TEST_ASSERT_TRUE(TEST_BAL_GetBalancingState()->active);
+    /* the hysteresis is removed once a cell is balanced */
+    TEST_ASSERT_EQUAL(BAL_DEFAULT_THRESHOLD_mV, TEST_BAL_GetBalancingState()->balancingThreshold);
+}
+
+/** an evaluation during which the data blocks have been written is repeated and has no side effects */
+void testActivateBalancingRepeatsEvaluationAfterConcurrentWrite(void) {
+    test_cellVoltage.cellVoltage_mV[0][0][0] = 3500 + BAL_DEFAULT_THRESHOLD_mV + BAL_HYSTERESIS_mV + 1;
+    test_concurrentWrites                    = 1u;
+
+    TEST_ASSERT_TRUE(TEST_BAL_ActivateBalancing());
+
+    DATA_BLOCK_BALANCING_CONTROL_s *pBalancing = TEST_BAL_GetBalancingControl();
+    TEST_ASSERT_EQUAL(0u, pBalancing->balancingState[0][0]);
+    TEST_ASSERT_EQUAL(0u, pBalancing->nrBalancedCells[0]);
+    TEST_ASSERT_FALSE(TEST_BAL_GetBalancingState()->active);
+    TEST_ASSERT_EQUAL(
+        BAL_DEFAULT_THRESHOLD_mV + BAL_HYSTERESIS_mV, TEST_BAL_GetBalancingState()->balancingThreshold);
+}
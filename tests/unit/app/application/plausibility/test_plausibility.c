@@ -43,7 +43,7 @@
  * @file    test_plausibility.c
  * @author  foxBMS Team
  * @date    2020-04-01 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -55,17 +55,107 @@
 /*========== Includes =======================================================*/
 #include "unity.h"
 #include "Mockdiag.h"
+#include "Mockos.h"
 
+#include "database_helper.h"
+#include "foxmath.h"
 #include "plausibility.h"
 #include "test_assert_helper.h"
 
+#include <stdlib.h>
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#include <time.h>
+#endif
+
 /*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("database_helper.c")
+TEST_SOURCE_FILE("foxmath.c")
+
 TEST_INCLUDE_PATH("../../src/app/application/plausibility")
 TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
+TEST_INCLUDE_PATH("../../src/app/engine/database")
 TEST_INCLUDE_PATH("../../src/app/engine/diag")
 TEST_INCLUDE_PATH("../../src/app/task/config")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
+/** cell voltage of the healthy cells in mV */
+#define TEST_CELL_VOLTAGE_mV (3700)
+
+/** cell temperature of the healthy sensors in deci &deg;C */
+#define TEST_CELL_TEMPERATURE_ddegC (250)
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+/** number of spread checks of the benchmark */
+#define TEST_BENCHMARK_ITERATIONS (20000u)
+#endif
+
+static DATA_BLOCK_CELL_VOLTAGE_s test_cellVoltages         = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+static DATA_BLOCK_CELL_TEMPERATURE_s test_cellTemperatures = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
+
+static int TEST_CompareInt16(const void *pA, const void *pB) {
+    return (int)*(const int16_t *)pA - (int)*(const int16_t *)pB;
+}
+
+/** healthy cells with a small random spread */
+static void TEST_InitializeCellVoltages(void) {
+    for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+        test_cellVoltages.invalidCellVoltage[0u][m] = 0uLL;
+        for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+            test_cellVoltages.cellVoltage_mV[0u][m][cb] = (int16_t)(TEST_CELL_VOLTAGE_mV + (rand() % 41) - 20);
+        }
+    }
+}
+
+static void TEST_InitializeCellTemperatures(void) {
+    for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+        test_cellTemperatures.invalidCellTemperature[0u][m] = 0u;
+        for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
+            test_cellTemperatures.cellTemperature_ddegC[0u][m][ts] =
+                (int16_t)(TEST_CELL_TEMPERATURE_ddegC + (rand() % 21) - 10);
+        }
+    }
+}
+
+/**
+ * previous implementation as reference: the deviation is checked against the
+ * average of the valid cell voltages, that has to be computed in a separate
+ * pass and again after an invalidation
+ */
+static STD_RETURN_TYPE_e TEST_CheckVoltageSpreadAgainstAverage(DATA_BLOCK_CELL_VOLTAGE_s *pCellVoltages) {
+    STD_RETURN_TYPE_e retval = STD_OK;
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        int32_t sum_mV        = 0;
+        uint16_t nrOfVoltages = 0u;
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+                if ((pCellVoltages->invalidCellVoltage[s][m] & (1uLL << cb)) == 0uLL) {
+                    sum_mV += pCellVoltages->cellVoltage_mV[s][m][cb];
+                    nrOfVoltages++;
+                }
+            }
+        }
+        const int32_t average_mV = (nrOfVoltages > 0u) ? (sum_mV / (int32_t)nrOfVoltages) : 0;
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+                if ((pCellVoltages->invalidCellVoltage[s][m] & (1uLL << cb)) == 0uLL) {
+                    if (abs(pCellVoltages->cellVoltage_mV[s][m][cb] - average_mV) >
+                        PL_CELL_VOLTAGE_SPREAD_TOLERANCE_mV) {
+                        retval = STD_NOT_OK;
+                        /* Set this cell voltage invalid */
+                        pCellVoltages->invalidCellVoltage[s][m] |= (1uLL << cb);
+                    }
+                }
+            }
+        }
+        pCellVoltages->nrValidCellVoltages[s] = (uint16_t)(
+            BS_NR_OF_CELL_BLOCKS_PER_STRING -
+            MATH_CountSetBitsInBitmap(
+                pCellVoltages->invalidCellVoltage[s], BS_NR_OF_MODULES_PER_STRING, DATA_CELL_VOLTAGE_BITMAP_MASK));
+    }
+    return retval;
+}
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
@@ -135,3 +225,114 @@ void testCheckPackVoltagecellVoltageandcurrentSensorDifferenceINT32Max(void) {
     int32_t highVoltage_mV = INT32_MAX;
     TEST_ASSERT_EQUAL(PL_CheckStringVoltage(packVoltage_mV, highVoltage_mV), STD_OK);
 }
+
+void testGetMedian(void) {
+    srand(7u);
+    int16_t values[41]    = {0};
+    int16_t reference[41] = {0};
+    for (uint16_t nrOfValues = 1u; nrOfValues <= 41u; nrOfValues++) {
+        for (uint8_t repetition = 0u; repetition < 20u; repetition++) {
+            for (uint16_t i = 0u; i < nrOfValues; i++) {
+                /* small value range to get duplicates */
+                values[i]    = (int16_t)((rand() % 16) - 8);
+                reference[i] = values[i];
+            }
+            qsort(reference, nrOfValues, sizeof(int16_t), &TEST_CompareInt16);
+            int32_t expected = reference[nrOfValues / 2u];
+            if ((nrOfValues % 2u) == 0u) {
+                expected = (expected + reference[(nrOfValues / 2u) - 1u]) / 2;
+            }
+            TEST_ASSERT_EQUAL_INT32(expected, TEST_PL_GetMedian(values, nrOfValues));
+        }
+    }
+    TEST_ASSERT_FAIL_ASSERT(TEST_PL_GetMedian(values, 0u));
+}
+
+void testVoltageSpreadWithoutOutliers(void) {
+    srand(1u);
+    TEST_InitializeCellVoltages();
+    DIAG_CheckEvent_ExpectAndReturn(STD_OK, DIAG_ID_PLAUSIBILITY_CELL_VOLTAGE_SPREAD, DIAG_STRING, 0u, STD_OK);
+    TEST_ASSERT_EQUAL(STD_OK, PL_CheckVoltageSpread(&test_cellVoltages));
+    TEST_ASSERT_EQUAL(BS_NR_OF_CELL_BLOCKS_PER_STRING, test_cellVoltages.nrValidCellVoltages[0u]);
+}
+
+/** faulty measurements pull the average so far that the correct cell voltages would be invalidated */
+void testVoltageSpreadWithOutliers(void) {
+    srand(2u);
+    TEST_InitializeCellVoltages();
+    /* three open sense lines, one measurement that has already been invalid */
+    test_cellVoltages.cellVoltage_mV[0u][0u][3u] = 0;
+    test_cellVoltages.cellVoltage_mV[0u][0u][4u] = 0;
+    test_cellVoltages.cellVoltage_mV[0u][1u][0u] = 0;
+    test_cellVoltages.cellVoltage_mV[0u][1u][7u] = INT16_MAX;
+    test_cellVoltages.invalidCellVoltage[0u][1u] = (1uLL << 7u);
+    DATA_BLOCK_CELL_VOLTAGE_s reference          = test_cellVoltages;
+
+    DIAG_CheckEvent_ExpectAndReturn(STD_NOT_OK, DIAG_ID_PLAUSIBILITY_CELL_VOLTAGE_SPREAD, DIAG_STRING, 0u, STD_OK);
+    TEST_ASSERT_EQUAL(STD_NOT_OK, PL_CheckVoltageSpread(&test_cellVoltages));
+    TEST_ASSERT_EQUAL_UINT64((1uLL << 3u) | (1uLL << 4u), test_cellVoltages.invalidCellVoltage[0u][0u]);
+    TEST_ASSERT_EQUAL_UINT64((1uLL << 0u) | (1uLL << 7u), test_cellVoltages.invalidCellVoltage[0u][1u]);
+    TEST_ASSERT_EQUAL(BS_NR_OF_CELL_BLOCKS_PER_STRING - 4u, test_cellVoltages.nrValidCellVoltages[0u]);
+
+    /* the check against the average invalidates all cell voltages */
+    (void)TEST_CheckVoltageSpreadAgainstAverage(&reference);
+    TEST_ASSERT_EQUAL(0u, reference.nrValidCellVoltages[0u]);
+}
+
+void testTemperatureSpreadWithOutliers(void) {
+    srand(3u);
+    TEST_InitializeCellTemperatures();
+    /* three sensors with a short circuit */
+    test_cellTemperatures.cellTemperature_ddegC[0u][0u][0u] = 1500;
+    test_cellTemperatures.cellTemperature_ddegC[0u][1u][2u] = 1500;
+    test_cellTemperatures.cellTemperature_ddegC[0u][1u][5u] = 1500;
+
+    DIAG_CheckEvent_ExpectAndReturn(
+        STD_NOT_OK, DIAG_ID_PLAUSIBILITY_CELL_TEMPERATURE_SPREAD, DIAG_STRING, 0u, STD_OK);
+    TEST_ASSERT_EQUAL(STD_NOT_OK, PL_CheckTemperatureSpread(&test_cellTemperatures));
+    TEST_ASSERT_EQUAL_UINT16(1u << 0u, test_cellTemperatures.invalidCellTemperature[0u][0u]);
+    TEST_ASSERT_EQUAL_UINT16((1u << 2u) | (1u << 5u), test_cellTemperatures.invalidCellTemperature[0u][1u]);
+    TEST_ASSERT_EQUAL(BS_NR_OF_TEMP_SENSORS_PER_STRING - 3u, test_cellTemperatures.nrValidTemperatures[0u]);
+
+    /* all sensors invalid: nothing to check */
+    for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+        test_cellTemperatures.invalidCellTemperature[0u][m] = (uint16_t)DATA_CELL_TEMPERATURE_BITMAP_MASK;
+    }
+    DIAG_CheckEvent_ExpectAndReturn(STD_OK, DIAG_ID_PLAUSIBILITY_CELL_TEMPERATURE_SPREAD, DIAG_STRING, 0u, STD_OK);
+    TEST_ASSERT_EQUAL(STD_OK, PL_CheckTemperatureSpread(&test_cellTemperatures));
+    TEST_ASSERT_EQUAL(0u, test_cellTemperatures.nrValidTemperatures[0u]);
+}
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+/** host benchmark: median based check vs. the check against the average */
+void testVoltageSpreadBenchmark(void) {
+    DIAG_CheckEvent_IgnoreAndReturn(STD_OK);
+    srand(4u);
+    TEST_InitializeCellVoltages();
+    const DATA_BLOCK_CELL_VOLTAGE_s healthy = test_cellVoltages;
+
+    clock_t start = clock();
+    for (uint32_t i = 0u; i < TEST_BENCHMARK_ITERATIONS; i++) {
+        test_cellVoltages = healthy;
+        (void)PL_CheckVoltageSpread(&test_cellVoltages);
+    }
+    const clock_t median = clock() - start;
+
+    /* the reference additionally needs the average before the check */
+    start = clock();
+    for (uint32_t i = 0u; i < TEST_BENCHMARK_ITERATIONS; i++) {
+        test_cellVoltages = healthy;
+        (void)TEST_CheckVoltageSpreadAgainstAverage(&test_cellVoltages);
+    }
+    const clock_t average = clock() - start;
+
+    char message[100] = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "spread check per string: median %.0f ns, average %.0f ns (host)",
+        (1.0e9 * (double)median) / ((double)CLOCKS_PER_SEC * (double)TEST_BENCHMARK_ITERATIONS),
+        (1.0e9 * (double)average) / ((double)CLOCKS_PER_SEC * (double)TEST_BENCHMARK_ITERATIONS));
+    TEST_MESSAGE(message);
+}
+#endif
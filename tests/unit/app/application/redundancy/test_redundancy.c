@@ -43,7 +43,7 @@
  * @file    test_redundancy.c
  * @author  foxBMS Team
  * @date    2020-07-31 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -230,6 +230,62 @@ void testMRC_UpdateCellTemperatureValidationNullPointer(void) {
     TEST_ASSERT_FAIL_ASSERT(TEST_MRC_UpdateCellTemperatureValidation(&dummy, NULL_PTR));
 }
 
+void testMRC_ValidateCellVoltageMergesInvalidFlags(void) {
+    DATA_BLOCK_CELL_VOLTAGE_s base       = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE_BASE};
+    DATA_BLOCK_CELL_VOLTAGE_s redundancy = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE_REDUNDANCY0};
+    DATA_BLOCK_CELL_VOLTAGE_s validated  = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+    for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+        for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+            base.cellVoltage_mV[0u][m][cb]       = 3700;
+            redundancy.cellVoltage_mV[0u][m][cb] = 3700;
+            validated.cellVoltage_mV[0u][m][cb]  = 3700;
+        }
+    }
+    /* cell block 1 of module 0 is invalid in both measurements, the others only in one measurement */
+    base.invalidCellVoltage[0u][0u]       = 0x2u;
+    base.invalidCellVoltage[0u][1u]       = 0x8u;
+    redundancy.invalidCellVoltage[0u][0u] = 0x6u;
+    /* stale flags of the previous validation are overwritten */
+    validated.invalidCellVoltage[0u][1u] = 0x1u;
+
+    PL_CheckCellVoltage_IgnoreAndReturn(STD_OK);
+    DIAG_CheckEvent_IgnoreAndReturn(STD_OK);
+    TEST_ASSERT_EQUAL(STD_NOT_OK, TEST_MRC_ValidateCellVoltage(&base, &redundancy, &validated));
+
+    TEST_ASSERT_EQUAL_HEX64(0x2u, validated.invalidCellVoltage[0u][0u]);
+    TEST_ASSERT_EQUAL_HEX64(0x0u, validated.invalidCellVoltage[0u][1u]);
+    TEST_ASSERT_EQUAL_UINT16(BS_NR_OF_CELL_BLOCKS_PER_STRING - 1u, validated.nrValidCellVoltages[0u]);
+    TEST_ASSERT_EQUAL_INT32(3700 * (BS_NR_OF_CELL_BLOCKS_PER_STRING - 1u), validated.stringVoltage_mV[0u]);
+}
+
+void testMRC_ValidateCellTemperatureMergesInvalidFlags(void) {
+    DATA_BLOCK_CELL_TEMPERATURE_s base       = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE_BASE};
+    DATA_BLOCK_CELL_TEMPERATURE_s redundancy = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE_REDUNDANCY0};
+    DATA_BLOCK_CELL_TEMPERATURE_s validated  = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
+    /* sensor 0 of module 1 is invalid in both measurements, sensor 3 of module 0 only in the base measurement */
+    base.invalidCellTemperature[0u][0u]       = 0x8u;
+    base.invalidCellTemperature[0u][1u]       = 0x1u;
+    redundancy.invalidCellTemperature[0u][1u] = 0x1u;
+    validated.invalidCellTemperature[0u][0u]  = 0x8u;
+
+    /* only sensors that are valid in both measurements are checked; the check of sensor 2 of module 0 fails */
+    for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+        for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
+            const uint16_t sensor = (uint16_t)(1u << ts);
+            if (((base.invalidCellTemperature[0u][m] | redundancy.invalidCellTemperature[0u][m]) & sensor) == 0u) {
+                const STD_RETURN_TYPE_e result = ((m == 0u) && (ts == 2u)) ? STD_NOT_OK : STD_OK;
+                PL_CheckCelltemperature_ExpectAndReturn(0, 0, &validated.cellTemperature_ddegC[0u][m][ts], result);
+            }
+        }
+    }
+    DIAG_CheckEvent_IgnoreAndReturn(STD_OK);
+    TEST_ASSERT_EQUAL(STD_NOT_OK, TEST_MRC_ValidateCellTemperature(&base, &redundancy, &validated));
+
+    TEST_ASSERT_EQUAL_HEX16(0x4u, validated.invalidCellTemperature[0u][0u]);
+    TEST_ASSERT_EQUAL_HEX16(0x1u, validated.invalidCellTemperature[0u][1u]);
+    TEST_ASSERT_EQUAL_UINT16(BS_NR_OF_TEMP_SENSORS_PER_STRING - 2u, validated.nrValidTemperatures[0u]);
+}
+
 /* test main function */
 void testMRC_AfeMeasurementValidationTickZeroNothingToDo(void) {
     /* inject database entries into function */
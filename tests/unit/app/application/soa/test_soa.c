@@ -43,7 +43,7 @@
  * @file    test_soa.c
  * @author  foxBMS Team
  * @date    2020-04-01 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -60,9 +60,18 @@
 #include "Mockdiag.h"
 #include "Mocksoa_cfg.h"
 
+#include "battery_cell_cfg.h"
+
 #include "foxmath.h"
 #include "soa.h"
 
+#include <string.h>
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#include <time.h>
+#endif
+
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_INCLUDE_PATH("../../src/app/application/bms")
 TEST_INCLUDE_PATH("../../src/app/application/soa")
@@ -74,9 +83,113 @@ TEST_INCLUDE_PATH("../../src/app/engine/diag")
 TEST_INCLUDE_PATH("../../src/app/task/config")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
+/** maximum number of events that are captured from #DIAG_HandleEvents */
+#define TEST_MAXIMUM_NR_OF_EVENTS (8u)
+/** number of random measurement sets of the equivalence test */
+#define TEST_EQUIVALENCE_NR_OF_ITERATIONS (2000u)
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+/** largest configuration that is supervised in the benchmark */
+/**@{*/
+#define TEST_BENCHMARK_NR_OF_STRINGS                 (16u)
+#define TEST_BENCHMARK_NR_OF_MODULES_PER_STRING      (24u)
+#define TEST_BENCHMARK_NR_OF_CELL_BLOCKS_PER_MODULE  (18u)
+#define TEST_BENCHMARK_NR_OF_TEMP_SENSORS_PER_MODULE (8u)
+/**@}*/
+/** number of simulated 10ms cycles in the benchmark */
+#define TEST_BENCHMARK_NR_OF_CYCLES (1000u)
+#endif
+
+static DIAG_BATCH_EVENT_s test_events[TEST_MAXIMUM_NR_OF_EVENTS]                         = {0};
+static DIAG_BATCH_EVENT_s test_stringEvents[BS_NR_OF_STRINGS][TEST_MAXIMUM_NR_OF_EVENTS] = {0};
+static uint8_t test_nrOfEvents                                                           = 0u;
+static uint8_t test_nrOfBatches                                                          = 0u;
+static DIAG_RETURNTYPE_e test_undervoltageMslResult                                      = DIAG_HANDLER_RETURN_OK;
+static uint32_t test_nrOfDeepDischarges                                                  = 0u;
+static uint32_t test_randomState                                                         = 1u;
+
+static DIAG_RETURNTYPE_e TEST_HandleEvents(
+    DIAG_BATCH_EVENT_s *pEvents,
+    uint8_t nrOfEvents,
+    DIAG_IMPACT_LEVEL_e impact,
+    uint32_t data,
+    int numCalls) {
+    (void)numCalls;
+    TEST_ASSERT_EQUAL(DIAG_STRING, impact);
+    TEST_ASSERT_TRUE(data < BS_NR_OF_STRINGS);
+    TEST_ASSERT_TRUE(nrOfEvents <= TEST_MAXIMUM_NR_OF_EVENTS);
+    for (uint8_t i = 0u; i < nrOfEvents; i++) {
+        if ((pEvents[i].diagId == DIAG_ID_CELL_VOLTAGE_UNDERVOLTAGE_MSL) && (pEvents[i].event == DIAG_EVENT_NOT_OK)) {
+            pEvents[i].result = test_undervoltageMslResult;
+        }
+        test_events[i]             = pEvents[i];
+        test_stringEvents[data][i] = pEvents[i];
+    }
+    test_nrOfEvents = nrOfEvents;
+    test_nrOfBatches++;
+    return DIAG_HANDLER_RETURN_OK;
+}
+
+static DIAG_RETURNTYPE_e TEST_Handler(
+    DIAG_ID_e diagId,
+    DIAG_EVENT_e event,
+    DIAG_IMPACT_LEVEL_e impact,
+    uint32_t data,
+    int numCalls) {
+    (void)numCalls;
+    TEST_ASSERT_EQUAL(DIAG_ID_DEEP_DISCHARGE_DETECTED, diagId);
+    TEST_ASSERT_EQUAL(DIAG_EVENT_NOT_OK, event);
+    TEST_ASSERT_EQUAL(DIAG_STRING, impact);
+    TEST_ASSERT_TRUE(data < BS_NR_OF_STRINGS);
+    test_nrOfDeepDischarges++;
+    return DIAG_HANDLER_RETURN_OK;
+}
+
+/** returns a pseudo-random value in [minimum, maximum] (linear congruential generator) */
+static int16_t TEST_GetRandomValue(int16_t minimum, int16_t maximum) {
+    test_randomState     = (test_randomState * 1103515245u) + 12345u;
+    const uint32_t range = (uint32_t)((int32_t)maximum - (int32_t)minimum) + 1u;
+    return (int16_t)((int32_t)minimum + (int32_t)((test_randomState >> 8u) % range));
+}
+
+/** updates the minimum and maximum of the valid values, as the redundancy module does */
+static void TEST_UpdateMinimumMaximum(int16_t value, int16_t *pMinimum, int16_t *pMaximum) {
+    if (value < *pMinimum) {
+        *pMinimum = value;
+    }
+    if (value > *pMaximum) {
+        *pMaximum = value;
+    }
+}
+
+/** sets all cell voltages and temperatures to a value within the operating limits */
+static void TEST_SetNominalValues(
+    DATA_BLOCK_CELL_VOLTAGE_s *pCellVoltages,
+    DATA_BLOCK_CELL_TEMPERATURE_s *pCellTemperatures) {
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+                pCellVoltages->cellVoltage_mV[s][m][cb] = BC_VOLTAGE_NOMINAL_mV;
+            }
+            for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
+                pCellTemperatures->cellTemperature_ddegC[s][m][ts] = 250;
+            }
+        }
+    }
+}
+
+static void TEST_AssertEvent(uint8_t index, DIAG_ID_e diagId, DIAG_EVENT_e event) {
+    TEST_ASSERT_TRUE(index < test_nrOfEvents);
+    TEST_ASSERT_EQUAL(diagId, test_events[index].diagId);
+    TEST_ASSERT_EQUAL(event, test_events[index].event);
+}
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    test_nrOfEvents            = 0u;
+    test_nrOfBatches           = 0u;
+    test_undervoltageMslResult = DIAG_HANDLER_RETURN_OK;
+    test_nrOfDeepDischarges    = 0u;
+    test_randomState           = 1u;
 }
 
 void tearDown(void) {
@@ -86,3 +199,409 @@ void testDummy(void) {
 }
 
 /*========== Test Cases =====================================================*/
+void testSOA_IsOperatingLimitViolated(void) {
+    DIAG_Handler_IgnoreAndReturn(DIAG_HANDLER_RETURN_OK);
+    DIAG_HandleEvents_IgnoreAndReturn(DIAG_HANDLER_RETURN_OK);
+    BMS_GetCurrentFlowDirection_IgnoreAndReturn(BMS_DISCHARGING);
+    DATA_BLOCK_MIN_MAX_s minimumMaximum = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+    DATA_BLOCK_PACK_VALUES_s packValues = {.header.uniqueId = DATA_BLOCK_ID_PACK_VALUES};
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        minimumMaximum.maximumCellVoltage_mV[s]    = BC_VOLTAGE_MAX_MOL_mV - 1;
+        minimumMaximum.minimumCellVoltage_mV[s]    = BC_VOLTAGE_MIN_MOL_mV + 1;
+        minimumMaximum.maximumTemperature_ddegC[s] = BC_TEMPERATURE_MAX_DISCHARGE_MOL_ddegC - 1;
+        minimumMaximum.minimumTemperature_ddegC[s] = BC_TEMPERATURE_MIN_DISCHARGE_MOL_ddegC + 1;
+    }
+
+    /* all values within the operating limits */
+    SOA_CheckVoltages(&minimumMaximum);
+    SOA_CheckTemperatures(&minimumMaximum, &packValues);
+    TEST_ASSERT_FALSE(SOA_IsOperatingLimitViolated());
+
+    /* maximum operating limit of the cell voltage violated in the last string */
+    minimumMaximum.maximumCellVoltage_mV[BS_NR_OF_STRINGS - 1u] = BC_VOLTAGE_MAX_MOL_mV;
+    SOA_CheckVoltages(&minimumMaximum);
+    TEST_ASSERT_TRUE(SOA_IsOperatingLimitViolated());
+    minimumMaximum.maximumCellVoltage_mV[BS_NR_OF_STRINGS - 1u] = BC_VOLTAGE_MAX_MOL_mV - 1;
+    SOA_CheckVoltages(&minimumMaximum);
+    TEST_ASSERT_FALSE(SOA_IsOperatingLimitViolated());
+
+    /* maximum operating limit of the cell temperature violated */
+    minimumMaximum.minimumTemperature_ddegC[0u] = BC_TEMPERATURE_MIN_DISCHARGE_MOL_ddegC;
+    SOA_CheckTemperatures(&minimumMaximum, &packValues);
+    TEST_ASSERT_TRUE(SOA_IsOperatingLimitViolated());
+    minimumMaximum.minimumTemperature_ddegC[0u] = BC_TEMPERATURE_MIN_DISCHARGE_MOL_ddegC + 1;
+    SOA_CheckTemperatures(&minimumMaximum, &packValues);
+    TEST_ASSERT_FALSE(SOA_IsOperatingLimitViolated());
+}
+
+void testSOA_CheckVoltagesReportsAllLimitsOfAStringInOneBatch(void) {
+    DIAG_HandleEvents_StubWithCallback(TEST_HandleEvents);
+    DATA_BLOCK_MIN_MAX_s minimumMaximum = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        minimumMaximum.maximumCellVoltage_mV[s] = BC_VOLTAGE_MAX_MOL_mV - 1;
+        minimumMaximum.minimumCellVoltage_mV[s] = BC_VOLTAGE_MIN_MOL_mV + 1;
+    }
+    /* recommended safety limit violated in the last string */
+    minimumMaximum.maximumCellVoltage_mV[BS_NR_OF_STRINGS - 1u] = BC_VOLTAGE_MAX_RSL_mV;
+
+    SOA_CheckVoltages(&minimumMaximum);
+
+    TEST_ASSERT_EQUAL_UINT8(BS_NR_OF_STRINGS, test_nrOfBatches);
+    TEST_ASSERT_EQUAL_UINT8(6u, test_nrOfEvents);
+    TEST_AssertEvent(0u, DIAG_ID_CELL_VOLTAGE_OVERVOLTAGE_MOL, DIAG_EVENT_NOT_OK);
+    TEST_AssertEvent(1u, DIAG_ID_CELL_VOLTAGE_OVERVOLTAGE_RSL, DIAG_EVENT_NOT_OK);
+    TEST_AssertEvent(2u, DIAG_ID_CELL_VOLTAGE_OVERVOLTAGE_MSL, DIAG_EVENT_OK);
+    TEST_AssertEvent(3u, DIAG_ID_CELL_VOLTAGE_UNDERVOLTAGE_MOL, DIAG_EVENT_OK);
+    TEST_AssertEvent(4u, DIAG_ID_CELL_VOLTAGE_UNDERVOLTAGE_RSL, DIAG_EVENT_OK);
+    TEST_AssertEvent(5u, DIAG_ID_CELL_VOLTAGE_UNDERVOLTAGE_MSL, DIAG_EVENT_OK);
+    TEST_ASSERT_TRUE(SOA_IsOperatingLimitViolated());
+}
+
+void testSOA_CheckVoltagesDetectsDeepDischarge(void) {
+    DIAG_HandleEvents_StubWithCallback(TEST_HandleEvents);
+    DATA_BLOCK_MIN_MAX_s minimumMaximum = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        minimumMaximum.maximumCellVoltage_mV[s] = BC_VOLTAGE_MAX_MOL_mV - 1;
+        minimumMaximum.minimumCellVoltage_mV[s] = BC_VOLTAGE_MIN_MOL_mV + 1;
+    }
+    minimumMaximum.minimumCellVoltage_mV[0u] = BC_VOLTAGE_DEEP_DISCHARGE_mV;
+
+    /* under voltage maximum safety limit violated, but the flag is not set yet */
+    test_undervoltageMslResult = DIAG_HANDLER_RETURN_OK;
+    SOA_CheckVoltages(&minimumMaximum);
+
+    /* under voltage flag set: deep-discharge is reported */
+    test_undervoltageMslResult = DIAG_HANDLER_RETURN_ERR_OCCURRED;
+    DIAG_Handler_ExpectAndReturn(
+        DIAG_ID_DEEP_DISCHARGE_DETECTED, DIAG_EVENT_NOT_OK, DIAG_STRING, 0u, DIAG_HANDLER_RETURN_OK);
+    SOA_CheckVoltages(&minimumMaximum);
+}
+
+void testSOA_CheckTemperaturesSelectsLimitsByCurrentDirection(void) {
+    DIAG_HandleEvents_StubWithCallback(TEST_HandleEvents);
+    DATA_BLOCK_MIN_MAX_s minimumMaximum = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+    DATA_BLOCK_PACK_VALUES_s packValues = {.header.uniqueId = DATA_BLOCK_ID_PACK_VALUES};
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        minimumMaximum.maximumTemperature_ddegC[s] = BC_TEMPERATURE_MAX_CHARGE_MSL_ddegC;
+        minimumMaximum.minimumTemperature_ddegC[s] = BC_TEMPERATURE_MIN_CHARGE_MOL_ddegC + 1;
+    }
+    BMS_GetCurrentFlowDirection_IgnoreAndReturn(BMS_CHARGING);
+
+    SOA_CheckTemperatures(&minimumMaximum, &packValues);
+
+    TEST_ASSERT_EQUAL_UINT8(6u, test_nrOfEvents);
+    TEST_AssertEvent(0u, DIAG_ID_TEMP_OVERTEMPERATURE_CHARGE_MOL, DIAG_EVENT_NOT_OK);
+    TEST_AssertEvent(1u, DIAG_ID_TEMP_OVERTEMPERATURE_CHARGE_RSL, DIAG_EVENT_NOT_OK);
+    TEST_AssertEvent(2u, DIAG_ID_TEMP_OVERTEMPERATURE_CHARGE_MSL, DIAG_EVENT_NOT_OK);
+    TEST_AssertEvent(3u, DIAG_ID_TEMP_UNDERTEMPERATURE_CHARGE_MOL, DIAG_EVENT_OK);
+    TEST_AssertEvent(4u, DIAG_ID_TEMP_UNDERTEMPERATURE_CHARGE_RSL, DIAG_EVENT_OK);
+    TEST_AssertEvent(5u, DIAG_ID_TEMP_UNDERTEMPERATURE_CHARGE_MSL, DIAG_EVENT_OK);
+}
+
+void testSOA_CheckCurrentReportsStringEventsInOneBatch(void) {
+    DIAG_HandleEvents_StubWithCallback(TEST_HandleEvents);
+    DIAG_Handler_IgnoreAndReturn(DIAG_HANDLER_RETURN_OK);
+    DATA_BLOCK_PACK_VALUES_s packValues = {.header.uniqueId = DATA_BLOCK_ID_PACK_VALUES};
+    BMS_GetCurrentFlowDirection_IgnoreAndReturn(BMS_RELAXATION);
+    SOA_IsStringCurrentLimitViolated_IgnoreAndReturn(false);
+    SOA_IsCellCurrentLimitViolated_IgnoreAndReturn(false);
+    SOA_IsCurrentOnOpenString_IgnoreAndReturn(true);
+    SOA_IsPackCurrentLimitViolated_IgnoreAndReturn(false);
+
+    SOA_CheckCurrent(&packValues);
+
+    TEST_ASSERT_EQUAL_UINT8(BS_NR_OF_STRINGS, test_nrOfBatches);
+    TEST_ASSERT_EQUAL_UINT8(5u, test_nrOfEvents);
+    TEST_AssertEvent(0u, DIAG_ID_STRING_OVERCURRENT_CHARGE_MSL, DIAG_EVENT_OK);
+    TEST_AssertEvent(1u, DIAG_ID_OVERCURRENT_CHARGE_CELL_MSL, DIAG_EVENT_OK);
+    TEST_AssertEvent(2u, DIAG_ID_STRING_OVERCURRENT_DISCHARGE_MSL, DIAG_EVENT_OK);
+    TEST_AssertEvent(3u, DIAG_ID_OVERCURRENT_DISCHARGE_CELL_MSL, DIAG_EVENT_OK);
+    TEST_AssertEvent(4u, DIAG_ID_CURRENT_ON_OPEN_STRING, DIAG_EVENT_NOT_OK);
+}
+
+void testSOA_CheckCellVoltagesLocatesViolations(void) {
+    DIAG_HandleEvents_StubWithCallback(TEST_HandleEvents);
+    DATA_BLOCK_CELL_VOLTAGE_s cellVoltages         = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+    DATA_BLOCK_CELL_TEMPERATURE_s cellTemperatures = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
+    TEST_SetNominalValues(&cellVoltages, &cellTemperatures);
+    /* recommended safety limit violated in the last module, operating limit violated in the first module */
+    cellVoltages.cellVoltage_mV[0u][BS_NR_OF_MODULES_PER_STRING - 1u][5u] = BC_VOLTAGE_MAX_RSL_mV;
+    cellVoltages.cellVoltage_mV[0u][0u][2u]                               = BC_VOLTAGE_MIN_MOL_mV;
+    /* invalid cell voltages never violate a limit */
+    cellVoltages.cellVoltage_mV[0u][0u][3u] = BC_VOLTAGE_MAX_MSL_mV;
+    cellVoltages.invalidCellVoltage[0u][0u] = (1uLL << 3u);
+
+    SOA_CheckCellVoltages(&cellVoltages);
+
+    SOA_CELL_VIOLATIONS_s violations = {0};
+    SOA_GetCellVoltageViolations(0u, &violations);
+    TEST_ASSERT_EQUAL_UINT64((1uLL << 5u), violations.upperLimits[BS_NR_OF_MODULES_PER_STRING - 1u][SOA_LIMIT_MOL]);
+    TEST_ASSERT_EQUAL_UINT64((1uLL << 5u), violations.upperLimits[BS_NR_OF_MODULES_PER_STRING - 1u][SOA_LIMIT_RSL]);
+    TEST_ASSERT_EQUAL_UINT64(0u, violations.upperLimits[BS_NR_OF_MODULES_PER_STRING - 1u][SOA_LIMIT_MSL]);
+    TEST_ASSERT_EQUAL_UINT64(0u, violations.upperLimits[0u][SOA_LIMIT_MSL]);
+    TEST_ASSERT_EQUAL_UINT64((1uLL << 2u), violations.lowerLimits[0u][SOA_LIMIT_MOL]);
+    TEST_ASSERT_EQUAL_UINT64(0u, violations.lowerLimits[0u][SOA_LIMIT_RSL]);
+    TEST_ASSERT_EQUAL_UINT16(1u, violations.nrOfUpperLimitViolations[SOA_LIMIT_MOL]);
+    TEST_ASSERT_EQUAL_UINT16(1u, violations.nrOfUpperLimitViolations[SOA_LIMIT_RSL]);
+    TEST_ASSERT_EQUAL_UINT16(0u, violations.nrOfUpperLimitViolations[SOA_LIMIT_MSL]);
+    TEST_ASSERT_EQUAL_UINT16(1u, violations.nrOfLowerLimitViolations[SOA_LIMIT_MOL]);
+
+    TEST_ASSERT_EQUAL_UINT8(BS_NR_OF_STRINGS, test_nrOfBatches);
+    TEST_ASSERT_EQUAL_UINT8(6u, test_nrOfEvents);
+    TEST_AssertEvent(0u, DIAG_ID_CELL_VOLTAGE_OVERVOLTAGE_MOL, DIAG_EVENT_NOT_OK);
+    TEST_AssertEvent(1u, DIAG_ID_CELL_VOLTAGE_OVERVOLTAGE_RSL, DIAG_EVENT_NOT_OK);
+    TEST_AssertEvent(2u, DIAG_ID_CELL_VOLTAGE_OVERVOLTAGE_MSL, DIAG_EVENT_OK);
+    TEST_AssertEvent(3u, DIAG_ID_CELL_VOLTAGE_UNDERVOLTAGE_MOL, DIAG_EVENT_NOT_OK);
+    TEST_AssertEvent(4u, DIAG_ID_CELL_VOLTAGE_UNDERVOLTAGE_RSL, DIAG_EVENT_OK);
+    TEST_AssertEvent(5u, DIAG_ID_CELL_VOLTAGE_UNDERVOLTAGE_MSL, DIAG_EVENT_OK);
+    TEST_ASSERT_TRUE(SOA_IsOperatingLimitViolated());
+}
+
+void testSOA_CheckCellTemperaturesLocatesViolations(void) {
+    DIAG_HandleEvents_StubWithCallback(TEST_HandleEvents);
+    BMS_GetCurrentFlowDirection_IgnoreAndReturn(BMS_CHARGING);
+    DATA_BLOCK_CELL_VOLTAGE_s cellVoltages         = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+    DATA_BLOCK_CELL_TEMPERATURE_s cellTemperatures = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
+    DATA_BLOCK_PACK_VALUES_s packValues            = {.header.uniqueId = DATA_BLOCK_ID_PACK_VALUES};
+    TEST_SetNominalValues(&cellVoltages, &cellTemperatures);
+    /* maximum safety limit violated by two sensors, the discharge limits are not violated while charging */
+    cellTemperatures.cellTemperature_ddegC[0u][0u][0u] = BC_TEMPERATURE_MAX_CHARGE_MSL_ddegC;
+    cellTemperatures.cellTemperature_ddegC[0u][1u][BS_NR_OF_TEMP_SENSORS_PER_MODULE - 1u] =
+        BC_TEMPERATURE_MAX_CHARGE_MSL_ddegC;
+
+    SOA_CheckCellTemperatures(&cellTemperatures, &packValues);
+
+    SOA_CELL_VIOLATIONS_s violations = {0};
+    SOA_GetCellTemperatureViolations(0u, &violations);
+    TEST_ASSERT_EQUAL_UINT64(1u, violations.upperLimits[0u][SOA_LIMIT_MSL]);
+    TEST_ASSERT_EQUAL_UINT64(
+        (1uLL << (BS_NR_OF_TEMP_SENSORS_PER_MODULE - 1u)), violations.upperLimits[1u][SOA_LIMIT_MSL]);
+    TEST_ASSERT_EQUAL_UINT16(2u, violations.nrOfUpperLimitViolations[SOA_LIMIT_MOL]);
+    TEST_ASSERT_EQUAL_UINT16(2u, violations.nrOfUpperLimitViolations[SOA_LIMIT_MSL]);
+    TEST_ASSERT_EQUAL_UINT16(0u, violations.nrOfLowerLimitViolations[SOA_LIMIT_MOL]);
+
+    TEST_ASSERT_EQUAL_UINT8(6u, test_nrOfEvents);
+    TEST_AssertEvent(0u, DIAG_ID_TEMP_OVERTEMPERATURE_CHARGE_MOL, DIAG_EVENT_NOT_OK);
+    TEST_AssertEvent(1u, DIAG_ID_TEMP_OVERTEMPERATURE_CHARGE_RSL, DIAG_EVENT_NOT_OK);
+    TEST_AssertEvent(2u, DIAG_ID_TEMP_OVERTEMPERATURE_CHARGE_MSL, DIAG_EVENT_NOT_OK);
+    TEST_AssertEvent(3u, DIAG_ID_TEMP_UNDERTEMPERATURE_CHARGE_MOL, DIAG_EVENT_OK);
+    TEST_AssertEvent(4u, DIAG_ID_TEMP_UNDERTEMPERATURE_CHARGE_RSL, DIAG_EVENT_OK);
+    TEST_AssertEvent(5u, DIAG_ID_TEMP_UNDERTEMPERATURE_CHARGE_MSL, DIAG_EVENT_OK);
+}
+
+void testSOA_CheckCellVoltagesReleasesViolationsWithHysteresis(void) {
+    DIAG_HandleEvents_IgnoreAndReturn(DIAG_HANDLER_RETURN_OK);
+    DATA_BLOCK_CELL_VOLTAGE_s cellVoltages         = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+    DATA_BLOCK_CELL_TEMPERATURE_s cellTemperatures = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
+    SOA_CELL_VIOLATIONS_s violations               = {0};
+    TEST_SetNominalValues(&cellVoltages, &cellTemperatures);
+
+    /* the limit is violated when it is reached */
+    cellVoltages.cellVoltage_mV[0u][0u][0u] = BC_VOLTAGE_MAX_MOL_mV;
+    SOA_CheckCellVoltages(&cellVoltages);
+    SOA_GetCellVoltageViolations(0u, &violations);
+    TEST_ASSERT_EQUAL_UINT64(1u, violations.upperLimits[0u][SOA_LIMIT_MOL]);
+
+    /* the violation is kept until the cell has recovered by more than the hysteresis */
+    cellVoltages.cellVoltage_mV[0u][0u][0u] = BC_VOLTAGE_MAX_MOL_mV - SOA_CELL_VOLTAGE_HYSTERESIS_mV;
+    SOA_CheckCellVoltages(&cellVoltages);
+    SOA_GetCellVoltageViolations(0u, &violations);
+    TEST_ASSERT_EQUAL_UINT64(1u, violations.upperLimits[0u][SOA_LIMIT_MOL]);
+
+    cellVoltages.cellVoltage_mV[0u][0u][0u] = BC_VOLTAGE_MAX_MOL_mV - SOA_CELL_VOLTAGE_HYSTERESIS_mV - 1;
+    SOA_CheckCellVoltages(&cellVoltages);
+    SOA_GetCellVoltageViolations(0u, &violations);
+    TEST_ASSERT_EQUAL_UINT64(0u, violations.upperLimits[0u][SOA_LIMIT_MOL]);
+
+    /* a released cell has to reach the limit again */
+    cellVoltages.cellVoltage_mV[0u][0u][0u] = BC_VOLTAGE_MAX_MOL_mV - 1;
+    SOA_CheckCellVoltages(&cellVoltages);
+    SOA_GetCellVoltageViolations(0u, &violations);
+    TEST_ASSERT_EQUAL_UINT64(0u, violations.upperLimits[0u][SOA_LIMIT_MOL]);
+}
+
+/** the violations of the charge limits are not held by the hysteresis once the current direction changes */
+void testSOA_CheckCellTemperaturesClearsViolationsOnDirectionChange(void) {
+    DIAG_HandleEvents_IgnoreAndReturn(DIAG_HANDLER_RETURN_OK);
+    DATA_BLOCK_CELL_VOLTAGE_s cellVoltages         = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+    DATA_BLOCK_CELL_TEMPERATURE_s cellTemperatures = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
+    DATA_BLOCK_PACK_VALUES_s packValues            = {.header.uniqueId = DATA_BLOCK_ID_PACK_VALUES};
+    SOA_CELL_VIOLATIONS_s violations               = {0};
+    TEST_SetNominalValues(&cellVoltages, &cellTemperatures);
+    TEST_ASSERT_TRUE(BC_TEMPERATURE_MAX_CHARGE_MOL_ddegC < BC_TEMPERATURE_MAX_DISCHARGE_MOL_ddegC);
+    cellTemperatures.cellTemperature_ddegC[0u][0u][0u] = BC_TEMPERATURE_MAX_CHARGE_MOL_ddegC;
+
+    BMS_GetCurrentFlowDirection_IgnoreAndReturn(BMS_CHARGING);
+    SOA_CheckCellTemperatures(&cellTemperatures, &packValues);
+    SOA_GetCellTemperatureViolations(0u, &violations);
+    TEST_ASSERT_EQUAL_UINT64(1u, violations.upperLimits[0u][SOA_LIMIT_MOL]);
+
+    /* the same temperature is within the discharge limits */
+    BMS_GetCurrentFlowDirection_IgnoreAndReturn(BMS_DISCHARGING);
+    SOA_CheckCellTemperatures(&cellTemperatures, &packValues);
+    SOA_GetCellTemperatureViolations(0u, &violations);
+    TEST_ASSERT_EQUAL_UINT64(0u, violations.upperLimits[0u][SOA_LIMIT_MOL]);
+    TEST_ASSERT_EQUAL_UINT16(0u, violations.nrOfUpperLimitViolations[SOA_LIMIT_MOL]);
+
+    BMS_GetCurrentFlowDirection_IgnoreAndReturn(BMS_CHARGING);
+    SOA_CheckCellTemperatures(&cellTemperatures, &packValues);
+    SOA_GetCellTemperatureViolations(0u, &violations);
+    TEST_ASSERT_EQUAL_UINT64(1u, violations.upperLimits[0u][SOA_LIMIT_MOL]);
+}
+
+/** the per-cell check reports the same events as the check of the minimum and maximum values */
+void testSOA_PerCellCheckIsEquivalentToMinimumMaximumCheck(void) {
+    DIAG_HandleEvents_StubWithCallback(TEST_HandleEvents);
+    DIAG_Handler_StubWithCallback(TEST_Handler);
+    BMS_GetCurrentFlowDirection_IgnoreAndReturn(BMS_DISCHARGING);
+    /* the equivalence only holds without hysteresis */
+    TEST_ASSERT_EQUAL(0, SOA_CELL_VOLTAGE_HYSTERESIS_mV);
+    TEST_ASSERT_EQUAL(0, SOA_CELL_TEMPERATURE_HYSTERESIS_ddegC);
+    static DATA_BLOCK_CELL_VOLTAGE_s cellVoltages         = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+    static DATA_BLOCK_CELL_TEMPERATURE_s cellTemperatures = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
+    DATA_BLOCK_MIN_MAX_s minimumMaximum                   = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+    DATA_BLOCK_PACK_VALUES_s packValues                   = {.header.uniqueId = DATA_BLOCK_ID_PACK_VALUES};
+
+    DIAG_BATCH_EVENT_s minimumMaximumEvents[BS_NR_OF_STRINGS][TEST_MAXIMUM_NR_OF_EVENTS] = {0};
+    /* the under voltage flag is set, i.e., deep discharges are reported by both checks */
+    test_undervoltageMslResult = DIAG_HANDLER_RETURN_ERR_OCCURRED;
+
+    for (uint32_t iteration = 0u; iteration < TEST_EQUIVALENCE_NR_OF_ITERATIONS; iteration++) {
+        /* values around all limits, every fourth value is invalid; the first value of each module is valid */
+        for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+            minimumMaximum.minimumCellVoltage_mV[s]    = INT16_MAX;
+            minimumMaximum.maximumCellVoltage_mV[s]    = INT16_MIN;
+            minimumMaximum.minimumTemperature_ddegC[s] = INT16_MAX;
+            minimumMaximum.maximumTemperature_ddegC[s] = INT16_MIN;
+            for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+                cellVoltages.invalidCellVoltage[s][m]         = 0u;
+                cellTemperatures.invalidCellTemperature[s][m] = 0u;
+                for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+                    const int16_t voltage_mV = TEST_GetRandomValue(
+                        (int16_t)(BC_VOLTAGE_MIN_MSL_mV - 20), (int16_t)(BC_VOLTAGE_MAX_MSL_mV + 20));
+                    cellVoltages.cellVoltage_mV[s][m][cb] = voltage_mV;
+                    if ((cb > 0u) && (TEST_GetRandomValue(0, 3) == 0)) {
+                        cellVoltages.invalidCellVoltage[s][m] |= (1uLL << cb);
+                    } else {
+                        TEST_UpdateMinimumMaximum(
+                            voltage_mV,
+                            &minimumMaximum.minimumCellVoltage_mV[s],
+                            &minimumMaximum.maximumCellVoltage_mV[s]);
+                    }
+                }
+                for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
+                    const int16_t temperature_ddegC = TEST_GetRandomValue(
+                        (int16_t)(BC_TEMPERATURE_MIN_DISCHARGE_MSL_ddegC - 20),
+                        (int16_t)(BC_TEMPERATURE_MAX_DISCHARGE_MSL_ddegC + 20));
+                    cellTemperatures.cellTemperature_ddegC[s][m][ts] = temperature_ddegC;
+                    if ((ts > 0u) && (TEST_GetRandomValue(0, 3) == 0)) {
+                        cellTemperatures.invalidCellTemperature[s][m] |= (uint16_t)(1u << ts);
+                    } else {
+                        TEST_UpdateMinimumMaximum(
+                            temperature_ddegC,
+                            &minimumMaximum.minimumTemperature_ddegC[s],
+                            &minimumMaximum.maximumTemperature_ddegC[s]);
+                    }
+                }
+            }
+        }
+
+        test_nrOfDeepDischarges = 0u;
+        SOA_CheckVoltages(&minimumMaximum);
+        const uint32_t minimumMaximumDeepDischarges = test_nrOfDeepDischarges;
+        const bool minimumMaximumOperatingLimit     = SOA_IsOperatingLimitViolated();
+        (void)memcpy(minimumMaximumEvents, test_stringEvents, sizeof(minimumMaximumEvents));
+        test_nrOfDeepDischarges = 0u;
+        SOA_CheckCellVoltages(&cellVoltages);
+        TEST_ASSERT_EQUAL_UINT32(minimumMaximumDeepDischarges, test_nrOfDeepDischarges);
+        TEST_ASSERT_EQUAL(minimumMaximumOperatingLimit, SOA_IsOperatingLimitViolated());
+        for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+            for (uint8_t i = 0u; i < (2u * (uint8_t)SOA_LIMIT_E_MAX); i++) {
+                TEST_ASSERT_EQUAL(minimumMaximumEvents[s][i].diagId, test_stringEvents[s][i].diagId);
+                TEST_ASSERT_EQUAL(minimumMaximumEvents[s][i].event, test_stringEvents[s][i].event);
+            }
+        }
+
+        SOA_CheckTemperatures(&minimumMaximum, &packValues);
+        (void)memcpy(minimumMaximumEvents, test_stringEvents, sizeof(minimumMaximumEvents));
+        SOA_CheckCellTemperatures(&cellTemperatures, &packValues);
+        for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+            for (uint8_t i = 0u; i < (2u * (uint8_t)SOA_LIMIT_E_MAX); i++) {
+                TEST_ASSERT_EQUAL(minimumMaximumEvents[s][i].diagId, test_stringEvents[s][i].diagId);
+                TEST_ASSERT_EQUAL(minimumMaximumEvents[s][i].event, test_stringEvents[s][i].event);
+            }
+        }
+    }
+}
+
+/** the per-cell check detects a violated limit wherever it is in the string */
+void testSOA_PerCellCheckDetectsMovingViolation(void) {
+    DIAG_HandleEvents_IgnoreAndReturn(DIAG_HANDLER_RETURN_OK);
+    BMS_GetCurrentFlowDirection_IgnoreAndReturn(BMS_DISCHARGING);
+    static DATA_BLOCK_CELL_VOLTAGE_s cellVoltages         = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+    static DATA_BLOCK_CELL_TEMPERATURE_s cellTemperatures = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
+    DATA_BLOCK_PACK_VALUES_s packValues                   = {.header.uniqueId = DATA_BLOCK_ID_PACK_VALUES};
+    TEST_SetNominalValues(&cellVoltages, &cellTemperatures);
+
+    /* the cell with the violated limit moves through the string, so that the violations change in every check */
+    uint32_t nrOfViolations = 0u;
+    for (uint16_t cycle = 0u; cycle < BS_NR_OF_CELL_BLOCKS_PER_STRING; cycle++) {
+        const uint8_t module                               = (uint8_t)(cycle / BS_NR_OF_CELL_BLOCKS_PER_MODULE);
+        const uint8_t cellBlock                            = (uint8_t)(cycle % BS_NR_OF_CELL_BLOCKS_PER_MODULE);
+        cellVoltages.cellVoltage_mV[0u][module][cellBlock] = BC_VOLTAGE_MAX_MSL_mV;
+        SOA_CheckCellVoltages(&cellVoltages);
+        SOA_CheckCellTemperatures(&cellTemperatures, &packValues);
+        nrOfViolations += (uint32_t)SOA_IsOperatingLimitViolated();
+        cellVoltages.cellVoltage_mV[0u][module][cellBlock] = BC_VOLTAGE_NOMINAL_mV;
+    }
+    TEST_ASSERT_EQUAL_UINT32(BS_NR_OF_CELL_BLOCKS_PER_STRING, nrOfViolations);
+}
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+/** measures the per-cell check of the largest configuration in a 10ms cycle */
+void testSOA_PerCellCheckBenchmark(void) {
+    DIAG_HandleEvents_IgnoreAndReturn(DIAG_HANDLER_RETURN_OK);
+    BMS_GetCurrentFlowDirection_IgnoreAndReturn(BMS_DISCHARGING);
+    static DATA_BLOCK_CELL_VOLTAGE_s cellVoltages         = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+    static DATA_BLOCK_CELL_TEMPERATURE_s cellTemperatures = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
+    DATA_BLOCK_PACK_VALUES_s packValues                   = {.header.uniqueId = DATA_BLOCK_ID_PACK_VALUES};
+    TEST_SetNominalValues(&cellVoltages, &cellTemperatures);
+    /* the unit test configuration is smaller than the largest configuration:
+     * the strings are checked as often as needed to check all cells of the largest configuration */
+    const uint32_t nrOfModules                = TEST_BENCHMARK_NR_OF_STRINGS * TEST_BENCHMARK_NR_OF_MODULES_PER_STRING;
+    const uint32_t nrOfCellBlocks             = nrOfModules * TEST_BENCHMARK_NR_OF_CELL_BLOCKS_PER_MODULE;
+    const uint32_t nrOfTemperatureSensors     = nrOfModules * TEST_BENCHMARK_NR_OF_TEMP_SENSORS_PER_MODULE;
+    const uint32_t cellBlocksPerCheck         = BS_NR_OF_STRINGS * BS_NR_OF_CELL_BLOCKS_PER_STRING;
+    const uint32_t temperatureSensorsPerCheck = BS_NR_OF_STRINGS * BS_NR_OF_TEMP_SENSORS_PER_STRING;
+    const uint32_t nrOfVoltageChecks          = (nrOfCellBlocks + cellBlocksPerCheck - 1u) / cellBlocksPerCheck;
+    const uint32_t nrOfTemperatureChecks =
+        (nrOfTemperatureSensors + temperatureSensorsPerCheck - 1u) / temperatureSensorsPerCheck;
+
+    /* the cell with the violated limit moves through the string, so that the violations change in every check */
+    clock_t start = clock();
+    for (uint32_t cycle = 0u; cycle < TEST_BENCHMARK_NR_OF_CYCLES; cycle++) {
+        const uint8_t module                               = (uint8_t)(cycle % BS_NR_OF_MODULES_PER_STRING);
+        const uint8_t cellBlock                            = (uint8_t)(cycle % BS_NR_OF_CELL_BLOCKS_PER_MODULE);
+        cellVoltages.cellVoltage_mV[0u][module][cellBlock] = BC_VOLTAGE_MAX_MSL_mV;
+        for (uint32_t check = 0u; check < nrOfVoltageChecks; check++) {
+            SOA_CheckCellVoltages(&cellVoltages);
+        }
+        for (uint32_t check = 0u; check < nrOfTemperatureChecks; check++) {
+            SOA_CheckCellTemperatures(&cellTemperatures, &packValues);
+        }
+        cellVoltages.cellVoltage_mV[0u][module][cellBlock] = BC_VOLTAGE_NOMINAL_mV;
+    }
+    const clock_t perCellTicks = clock() - start;
+
+    const double perCell_us = ((double)perCellTicks * 1.0e6) / ((double)CLOCKS_PER_SEC * TEST_BENCHMARK_NR_OF_CYCLES);
+    char message[200]       = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "%u cell voltages and %u cell temperatures: per-cell check %.1f us per 10ms cycle",
+        (unsigned int)nrOfCellBlocks,
+        (unsigned int)nrOfTemperatureSensors,
+        perCell_us);
+    TEST_MESSAGE(message);
+}
+#endif
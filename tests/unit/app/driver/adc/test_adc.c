@@ -43,7 +43,7 @@
  * @file    test_adc.c
  * @author  foxBMS Team
  * @date    2020-04-01 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -55,18 +55,68 @@
 /*========== Includes =======================================================*/
 #include "unity.h"
 #include "MockHL_adc.h"
+#include "MockHL_sys_dma.h"
 #include "Mockdatabase.h"
 #include "Mockfassert.h"
 
 #include "adc.h"
+#include "test_assert_helper.h"
+
+#include <math.h>
+#include <stdint.h>
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#include <time.h>
+#endif
 
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_INCLUDE_PATH("../../src/app/driver/adc")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/dma")
+TEST_INCLUDE_PATH("../../src/app/driver/spi")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
+/** resolution of the integer conversion of oversampled conversions in mV */
+#define TEST_OVERSAMPLED_VOLTAGE_RESOLUTION_mV (1.0f / 256.0f)
+
+/** number of decimated rings in the noise and cost comparisons */
+#define TEST_NUMBER_OF_RINGS (2000u)
+
+/** state of the pseudo random number generator for the simulated noise */
+static uint32_t test_noiseState = 1u;
+
+/** returns simulated noise between -amplitude and +amplitude counts */
+static int32_t TEST_GetNoise(int32_t amplitude) {
+    /* linear congruential generator (Numerical Recipes) */
+    test_noiseState = (1664525u * test_noiseState) + 1013904223u;
+    return ((int32_t)((test_noiseState >> 16u) % (uint32_t)((2 * amplitude) + 1))) - amplitude;
+}
+
+/** encodes a conversion result like the group 1 FIFO: value and channel ID */
+static uint32_t TEST_EncodeResult(uint8_t channel, uint16_t counts) {
+    return ((uint32_t)channel << ADC_RESULT_CHANNEL_ID_SHIFT) | ((uint32_t)counts & ADC_RESULT_VALUE_MASK);
+}
+
+/** fills a DMA ring with complete conversion sequences of noisy conversions around the given counts */
+static void TEST_FillRing(uint32_t *pRing, const uint16_t *kpCounts, int32_t noiseAmplitude) {
+    for (uint16_t slot = 0u; slot < ADC_DMA_RING_LENGTH; slot++) {
+        const uint8_t channel = (uint8_t)(slot % MCU_ADC1_MAX_NR_CHANNELS);
+        int32_t counts        = (int32_t)kpCounts[channel] + TEST_GetNoise(noiseAmplitude);
+        if (counts < 0) {
+            counts = 0;
+        } else if (counts > (int32_t)ADC_RESULT_VALUE_MASK) {
+            counts = (int32_t)ADC_RESULT_VALUE_MASK;
+        } else {
+            /* in range */
+        }
+        pRing[slot] = TEST_EncodeResult(channel, (uint16_t)counts);
+    }
+}
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    test_noiseState = 1u;
 }
 
 void tearDown(void) {
@@ -76,3 +126,203 @@ void tearDown(void) {
 
 void testDummy(void) {
 }
+
+void testADC_InitializeWithoutDmaOversampling(void) {
+    /* the polled single conversion does not use the DMA */
+    TEST_ASSERT_FALSE(ADC_DMA_OVERSAMPLING);
+    ADC_Initialize();
+}
+
+void testADC_ControlSingleConversion(void) {
+    adcStartConversion_Expect(adcREG1, adcGROUP1);
+    ADC_Control();
+    adcIsConversionComplete_ExpectAndReturn(adcREG1, adcGROUP1, 0u);
+    ADC_Control();
+    adcIsConversionComplete_ExpectAndReturn(adcREG1, adcGROUP1, ADC_CONVERSION_ENDDBIT);
+    ADC_Control();
+    adcGetData_ExpectAndReturn(adcREG1, adcGROUP1, NULL_PTR, MCU_ADC1_MAX_NR_CHANNELS);
+    adcGetData_IgnoreArg_data();
+    DATA_Write1DataBlock_ExpectAndReturn(NULL_PTR, STD_OK);
+    DATA_Write1DataBlock_IgnoreArg_pDataFromSender0();
+    ADC_Control();
+}
+
+void testADC_ConvertOversampledVoltageInvalidInput(void) {
+    TEST_ASSERT_FAIL_ASSERT(TEST_ADC_ConvertOversampledVoltage(0u, 0u));
+    TEST_ASSERT_FAIL_ASSERT(TEST_ADC_ConvertOversampledVoltage(0u, ADC_OVERSAMPLING_FACTOR + 1u));
+    TEST_ASSERT_FAIL_ASSERT(TEST_ADC_ConvertOversampledVoltage((ADC_RESULT_VALUE_MASK * 2u) + 1u, 2u));
+}
+
+void testADC_ConvertOversampledVoltageMatchesFloatConversion(void) {
+    /* a constant reading is converted like a single conversion */
+    for (uint16_t counts = 0u; counts <= ADC_RESULT_VALUE_MASK; counts++) {
+        for (uint32_t n = 1u; n <= ADC_OVERSAMPLING_FACTOR; n++) {
+            TEST_ASSERT_FLOAT_WITHIN(
+                TEST_OVERSAMPLED_VOLTAGE_RESOLUTION_mV,
+                TEST_ADC_ConvertVoltage(counts),
+                TEST_ADC_ConvertOversampledVoltage((uint32_t)counts * n, n));
+        }
+    }
+    /* different readings are converted to the voltage of their average */
+    const uint16_t readings[4u] = {1000u, 1001u, 1003u, 1004u};
+    float_t average_mV          = 0.0f;
+    for (uint8_t i = 0u; i < 4u; i++) {
+        average_mV += TEST_ADC_ConvertVoltage(readings[i]) / 4.0f;
+    }
+    TEST_ASSERT_FLOAT_WITHIN(
+        TEST_OVERSAMPLED_VOLTAGE_RESOLUTION_mV, average_mV, TEST_ADC_ConvertOversampledVoltage(4008u, 4u));
+}
+
+void testADC_DecimateDmaRingInvalidInput(void) {
+    uint32_t ring[ADC_DMA_RING_LENGTH]            = {0u};
+    float_t voltages_mV[MCU_ADC1_MAX_NR_CHANNELS] = {0.0f};
+    TEST_ASSERT_FAIL_ASSERT(TEST_ADC_DecimateDmaRing(NULL_PTR, voltages_mV));
+    TEST_ASSERT_FAIL_ASSERT(TEST_ADC_DecimateDmaRing(ring, NULL_PTR));
+}
+
+void testADC_DecimateDmaRingAveragesPerChannel(void) {
+    uint32_t ring[ADC_DMA_RING_LENGTH]            = {0u};
+    float_t voltages_mV[MCU_ADC1_MAX_NR_CHANNELS] = {0.0f};
+    for (uint16_t slot = 0u; slot < ADC_DMA_RING_LENGTH; slot++) {
+        const uint8_t channel = (uint8_t)(slot % MCU_ADC1_MAX_NR_CHANNELS);
+        /* alternate between two readings 2 counts apart: the average lies in between */
+        const uint16_t counts = (uint16_t)((channel * 100u) + (2u * ((slot / MCU_ADC1_MAX_NR_CHANNELS) % 2u)));
+        ring[slot]            = TEST_EncodeResult(channel, counts);
+    }
+    TEST_ADC_DecimateDmaRing(ring, voltages_mV);
+    for (uint8_t channel = 0u; channel < MCU_ADC1_MAX_NR_CHANNELS; channel++) {
+        TEST_ASSERT_FLOAT_WITHIN(
+            TEST_OVERSAMPLED_VOLTAGE_RESOLUTION_mV,
+            TEST_ADC_ConvertVoltage((uint16_t)((channel * 100u) + 1u)),
+            voltages_mV[channel]);
+    }
+}
+
+void testADC_DecimateDmaRingSkipsEmptySlots(void) {
+    uint32_t ring[ADC_DMA_RING_LENGTH]            = {0u};
+    float_t voltages_mV[MCU_ADC1_MAX_NR_CHANNELS] = {0.0f};
+    for (uint16_t slot = 0u; slot < ADC_DMA_RING_LENGTH; slot++) {
+        ring[slot] = ADC_DMA_RING_EMPTY_SLOT;
+    }
+    /* only channel 3 has been converted once, all others keep their previous voltage */
+    voltages_mV[0u] = 42.0f;
+    ring[5u]        = TEST_EncodeResult(3u, 2048u);
+    TEST_ADC_DecimateDmaRing(ring, voltages_mV);
+    TEST_ASSERT_EQUAL_FLOAT(42.0f, voltages_mV[0u]);
+    TEST_ASSERT_FLOAT_WITHIN(TEST_OVERSAMPLED_VOLTAGE_RESOLUTION_mV, TEST_ADC_ConvertVoltage(2048u), voltages_mV[3u]);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, voltages_mV[4u]);
+}
+
+void testADC_DecimateDmaRingReducesNoise(void) {
+    /* constant input voltages with +-8 counts of noise on every conversion */
+    uint16_t counts[MCU_ADC1_MAX_NR_CHANNELS] = {0u};
+    for (uint8_t channel = 0u; channel < MCU_ADC1_MAX_NR_CHANNELS; channel++) {
+        counts[channel] = (uint16_t)(500u + (channel * 100u));
+    }
+    static uint32_t ring[ADC_DMA_RING_LENGTH]     = {0u};
+    float_t voltages_mV[MCU_ADC1_MAX_NR_CHANNELS] = {0.0f};
+    float_t squaredErrorSingle_mV2                = 0.0f;
+    float_t squaredErrorOversampled_mV2           = 0.0f;
+    for (uint32_t i = 0u; i < TEST_NUMBER_OF_RINGS; i++) {
+        TEST_FillRing(ring, counts, 8);
+        TEST_ADC_DecimateDmaRing(ring, voltages_mV);
+        for (uint8_t channel = 0u; channel < MCU_ADC1_MAX_NR_CHANNELS; channel++) {
+            const float_t expected_mV = TEST_ADC_ConvertVoltage(counts[channel]);
+            /* the single conversion uses the latest conversion of the channel */
+            const float_t single_mV =
+                TEST_ADC_ConvertVoltage((uint16_t)(ring[ADC_DMA_RING_LENGTH - MCU_ADC1_MAX_NR_CHANNELS + channel] &
+                                                   ADC_RESULT_VALUE_MASK));
+            squaredErrorSingle_mV2      += (single_mV - expected_mV) * (single_mV - expected_mV);
+            squaredErrorOversampled_mV2 += (voltages_mV[channel] - expected_mV) * (voltages_mV[channel] - expected_mV);
+        }
+    }
+    const float_t numberOfValues = (float_t)(TEST_NUMBER_OF_RINGS * MCU_ADC1_MAX_NR_CHANNELS);
+    const float_t rmsSingle      = sqrtf(squaredErrorSingle_mV2 / numberOfValues);
+    const float_t rmsOversampled = sqrtf(squaredErrorOversampled_mV2 / numberOfValues);
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+    char message[120] = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "rms noise: single conversion %.2fmV, %u times oversampled %.2fmV",
+        (double)rmsSingle,
+        (unsigned int)ADC_OVERSAMPLING_FACTOR,
+        (double)rmsOversampled);
+    TEST_MESSAGE(message);
+#endif
+    /* averaging n uncorrelated conversions reduces the noise by sqrt(n) */
+    TEST_ASSERT_LESS_THAN_FLOAT(rmsSingle / sqrtf((float_t)ADC_OVERSAMPLING_FACTOR) * 1.2f, rmsOversampled);
+}
+
+void testADC_DecimateDmaRingMatchesAverageOfFloatConversions(void) {
+    /* The decimation of a ring in integer arithmetic equals the average of
+     * the float conversions of all readings (ADC_ConvertVoltage per reading). */
+    uint16_t counts[MCU_ADC1_MAX_NR_CHANNELS] = {0u};
+    for (uint8_t channel = 0u; channel < MCU_ADC1_MAX_NR_CHANNELS; channel++) {
+        counts[channel] = (uint16_t)(channel * 128u);
+    }
+    static uint32_t ring[ADC_DMA_RING_LENGTH]        = {0u};
+    float_t integerPath_mV[MCU_ADC1_MAX_NR_CHANNELS] = {0.0f};
+    float_t floatPath_mV[MCU_ADC1_MAX_NR_CHANNELS]   = {0.0f};
+    TEST_FillRing(ring, counts, 8);
+
+    for (uint16_t slot = 0u; slot < ADC_DMA_RING_LENGTH; slot++) {
+        const uint32_t result  = ring[slot];
+        const uint8_t channel  = (uint8_t)((result >> ADC_RESULT_CHANNEL_ID_SHIFT) & ADC_RESULT_CHANNEL_ID_MASK);
+        const uint16_t reading = (uint16_t)(result & ADC_RESULT_VALUE_MASK);
+        floatPath_mV[channel] += TEST_ADC_ConvertVoltage(reading) / (float_t)ADC_OVERSAMPLING_FACTOR;
+    }
+    TEST_ADC_DecimateDmaRing(ring, integerPath_mV);
+
+    for (uint8_t channel = 0u; channel < MCU_ADC1_MAX_NR_CHANNELS; channel++) {
+        TEST_ASSERT_FLOAT_WITHIN(0.01f, floatPath_mV[channel], integerPath_mV[channel]);
+    }
+}
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+void testADC_DecimateDmaRingCostComparison(void) {
+    /* Compares the decimation of a ring in integer arithmetic with averaging
+     * the float conversions of all readings (ADC_ConvertVoltage per reading).
+     * The timing on the host is only reported, the conversions per ring are
+     * what changes on the target. */
+    uint16_t counts[MCU_ADC1_MAX_NR_CHANNELS] = {0u};
+    for (uint8_t channel = 0u; channel < MCU_ADC1_MAX_NR_CHANNELS; channel++) {
+        counts[channel] = (uint16_t)(channel * 128u);
+    }
+    static uint32_t ring[ADC_DMA_RING_LENGTH]               = {0u};
+    float_t integerPath_mV[MCU_ADC1_MAX_NR_CHANNELS]        = {0.0f};
+    volatile float_t floatPath_mV[MCU_ADC1_MAX_NR_CHANNELS] = {0.0f};
+    TEST_FillRing(ring, counts, 8);
+
+    const clock_t floatStart = clock();
+    for (uint32_t i = 0u; i < TEST_NUMBER_OF_RINGS; i++) {
+        for (uint8_t channel = 0u; channel < MCU_ADC1_MAX_NR_CHANNELS; channel++) {
+            floatPath_mV[channel] = 0.0f;
+        }
+        for (uint16_t slot = 0u; slot < ADC_DMA_RING_LENGTH; slot++) {
+            const uint32_t result  = ring[slot];
+            const uint8_t channel  = (uint8_t)((result >> ADC_RESULT_CHANNEL_ID_SHIFT) & ADC_RESULT_CHANNEL_ID_MASK);
+            const uint16_t reading = (uint16_t)(result & ADC_RESULT_VALUE_MASK);
+            floatPath_mV[channel] += TEST_ADC_ConvertVoltage(reading) / (float_t)ADC_OVERSAMPLING_FACTOR;
+        }
+    }
+    const clock_t floatTicks = clock() - floatStart;
+
+    const clock_t integerStart = clock();
+    for (uint32_t i = 0u; i < TEST_NUMBER_OF_RINGS; i++) {
+        TEST_ADC_DecimateDmaRing(ring, integerPath_mV);
+    }
+    const clock_t integerTicks = clock() - integerStart;
+
+    char message[160] = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "per ring: %u float conversions (ADC_ConvertVoltage) vs. %u (integer path); host time %ld vs. %ld clock ticks",
+        (unsigned int)ADC_DMA_RING_LENGTH,
+        (unsigned int)MCU_ADC1_MAX_NR_CHANNELS,
+        (long)floatTicks,
+        (long)integerTicks);
+    TEST_MESSAGE(message);
+}
+#endif
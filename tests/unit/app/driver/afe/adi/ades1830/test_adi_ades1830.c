@@ -43,7 +43,7 @@
  * @file    test_adi_ades1830.c
  * @author  foxBMS Team
  * @date    2020-08-10 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -64,6 +64,7 @@
 #include "Mockadi_ades183x_pec.h"
 #include "Mockadi_ades183x_temperatures.h"
 #include "Mockadi_ades183x_voltages.h"
+#include "Mockafe_pipeline.h"
 #include "Mockafe_plausibility.h"
 #include "Mockdatabase.h"
 #include "Mockdiag.h"
@@ -321,3 +322,48 @@ void testADI_GetRequest(void) {
     TEST_ASSERT_EQUAL(STD_OK, TEST_ADI_GetRequest(&request));
     TEST_ASSERT_EQUAL(AFE_START_REQUEST, request);
 }
+
+void testADI_StartAuxiliaryMeasurement(void) {
+    /* Invalid pointer test */
+    TEST_ASSERT_FAIL_ASSERT(TEST_ADI_StartAuxiliaryMeasurement(NULL_PTR));
+
+    adi_stateBase.currentString                = 0u;
+    adi_stateBase.redundantAuxiliaryChannel[0] = 3u;
+    /* all auxiliary channels */
+    ADI_CopyCommandBits_Expect(adi_cmdAdax, adi_command);
+    ADI_WriteCommandConfigurationBits_Expect(adi_command, ADI_ADAX_OW_POS, ADI_ADAX_OW_LEN, 0u);
+    ADI_WriteCommandConfigurationBits_Expect(adi_command, ADI_ADAX_PUP_POS, ADI_ADAX_PUP_LEN, 0u);
+    ADI_WriteCommandConfigurationBits_Expect(adi_command, ADI_ADAX_CH4_POS, ADI_ADAX_CH4_LEN, 0u);
+    ADI_WriteCommandConfigurationBits_Expect(adi_command, ADI_ADAX_CH03_POS, ADI_ADAX_CH03_LEN, 0u);
+    ADI_TransmitCommand_Expect(adi_command, &adi_stateBase);
+    /* one redundant auxiliary channel */
+    ADI_CopyCommandBits_Expect(adi_cmdAdax2, adi_command);
+    ADI_WriteCommandConfigurationBits_Expect(adi_command, ADI_ADAX2_CH03_POS, ADI_ADAX2_CH03_LEN, 3u);
+    ADI_TransmitCommand_Expect(adi_command, &adi_stateBase);
+    TEST_ADI_StartAuxiliaryMeasurement(&adi_stateBase);
+    adi_stateBase.redundantAuxiliaryChannel[0] = 0u;
+}
+
+void testADI_StartNextStringAuxiliaryMeasurement(void) {
+    /* Invalid pointer test */
+    TEST_ASSERT_FAIL_ASSERT(TEST_ADI_StartNextStringAuxiliaryMeasurement(NULL_PTR));
+
+    /* last string or pipelined measurement deactivated: nothing is started ahead */
+    adi_stateBase.currentString       = 0u;
+    adi_stateBase.spiNumberInterfaces = BS_NR_OF_STRINGS;
+    TEST_ADI_StartNextStringAuxiliaryMeasurement(&adi_stateBase);
+    TEST_ASSERT_EQUAL(0u, adi_stateBase.currentString);
+}
+
+void testADI_WaitUntilElapsed(void) {
+    /* time span already elapsed: no wait */
+    OS_GetTickCount_ExpectAndReturn(30u);
+    AFE_PipelineGetRemainingTime_ExpectAndReturn(10u, 18u, 30u, 0u);
+    TEST_ADI_WaitUntilElapsed(10u, 18u);
+
+    /* only the remaining time is waited for */
+    OS_GetTickCount_ExpectAndReturn(20u);
+    AFE_PipelineGetRemainingTime_ExpectAndReturn(10u, 18u, 20u, 8u);
+    ADI_Wait_Expect(8u);
+    TEST_ADI_WaitUntilElapsed(10u, 18u);
+}
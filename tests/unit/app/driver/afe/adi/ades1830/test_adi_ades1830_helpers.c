@@ -43,7 +43,7 @@
  * @file    test_adi_ades1830_helpers.c
  * @author  foxBMS Team
  * @date    2022-12-07 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -71,6 +71,11 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#include <time.h>
+#endif
+
 /*========== Unit Testing Framework Directives ==============================*/
 /* contains the expected output matrix for ADI_ReadDataBits */
 TEST_SOURCE_FILE("adi_ades1830_helpers_test-data-rdb.c")
@@ -135,8 +140,36 @@ static ADI_STATE_s adi_stateBaseTest = {
     .data.errorTable = &adi_errorTableTest,
 };
 
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+/** number of repetitions of the host benchmark */
+#define TEST_NUMBER_OF_REPETITIONS (10000u)
+#endif
+
+/** command frame as it was built before the command frame cache */
+static void TEST_ReferenceSetCommandFrame(const uint16_t *command, uint16_t *pTxBuffer) {
+    uint8_t pecCheck[ADI_COMMAND_SIZE_IN_BYTES] = {
+        (uint8_t)command[ADI_COMMAND_BYTE0_POSITION],
+        (uint8_t)command[ADI_COMMAND_BYTE1_POSITION],
+    };
+    const uint16_t pec                              = ADI_Pec15(ADI_COMMAND_SIZE_IN_BYTES, pecCheck);
+    pTxBuffer[ADI_COMMAND_FIRST_BYTE_POSITION]      = command[ADI_COMMAND_BYTE0_POSITION];
+    pTxBuffer[ADI_COMMAND_SECOND_BYTE_POSITION]     = command[ADI_COMMAND_BYTE1_POSITION];
+    pTxBuffer[ADI_COMMAND_PEC_FIRST_BYTE_POSITION]  = (uint8_t)((pec >> ADI_BYTE_SHIFT) & ADI_ONE_BYTE_MASK);
+    pTxBuffer[ADI_COMMAND_PEC_SECOND_BYTE_POSITION] = (uint8_t)(pec & ADI_ONE_BYTE_MASK);
+}
+
+/** checks that the cached command frame is identical to the calculated one */
+static void TEST_AssertCommandFrame(const uint16_t *command) {
+    uint16_t expected[ADI_COMMAND_AND_PEC_SIZE_IN_BYTES] = {0u};
+    uint16_t actual[ADI_COMMAND_AND_PEC_SIZE_IN_BYTES]   = {0u};
+    TEST_ReferenceSetCommandFrame(command, expected);
+    TEST_ADI_SetCommandFrame(command, actual);
+    TEST_ASSERT_EQUAL_HEX16_ARRAY(expected, actual, ADI_COMMAND_AND_PEC_SIZE_IN_BYTES);
+}
+
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    ADI_InitializeCommandCache();
 }
 
 void tearDown(void) {
@@ -1138,3 +1171,104 @@ void testADI_WriteRegister(void) {
         }
     }
 }
+
+void testADI_InitializeCommandCache(void) {
+    const uint16_t *const commands[] = {
+        adi_cmdAdcv,   adi_cmdAdax,   adi_cmdRdcfga,  adi_cmdWrcfga, adi_cmdRdcva, adi_cmdRdsvf,
+        adi_cmdRdauxa, adi_cmdRdraxd, adi_cmdRdstatc, adi_cmdRstcc,  adi_cmdSrst,
+    };
+    ADI_InitializeCommandCache();
+    for (uint8_t i = 0u; i < (sizeof(commands) / sizeof(commands[0])); i++) {
+        TEST_AssertCommandFrame(commands[i]);
+    }
+
+    /* commands with configuration bits are cached as well */
+    ADI_CopyCommandBits(adi_cmdAdax, adi_command);
+    ADI_WriteCommandConfigurationBits(adi_command, ADI_ADAX_CH03_POS, ADI_ADAX_CH03_LEN, 5u);
+    TEST_AssertCommandFrame(adi_command);
+
+    uint16_t txBuffer[ADI_COMMAND_AND_PEC_SIZE_IN_BYTES]         = {0u};
+    const uint16_t invalidCommand[ADI_COMMAND_DEFINITION_LENGTH] = {0x08u, 0x00u, 0u, 0u};
+    TEST_ASSERT_FAIL_ASSERT(TEST_ADI_SetCommandFrame(NULL_PTR, txBuffer));
+    TEST_ASSERT_FAIL_ASSERT(TEST_ADI_SetCommandFrame(adi_cmdAdcv, NULL_PTR));
+    /* command code is longer than ADI_COMMAND_CODE_LENGTH bits */
+    TEST_ASSERT_FAIL_ASSERT(TEST_ADI_SetCommandFrame(invalidCommand, txBuffer));
+}
+
+void testADI_SetCommandFrameWithoutCommandCache(void) {
+    uint16_t txBuffer[ADI_COMMAND_AND_PEC_SIZE_IN_BYTES] = {0u};
+    TEST_ADI_ResetCommandCache();
+    TEST_ASSERT_FAIL_ASSERT(TEST_ADI_SetCommandFrame(adi_cmdAdcv, txBuffer));
+    ADI_InitializeCommandCache();
+    TEST_ADI_SetCommandFrame(adi_cmdAdcv, txBuffer);
+}
+
+void testADI_CommandFrameIsIdenticalForAllCommandCodes(void) {
+    uint16_t command[ADI_COMMAND_DEFINITION_LENGTH] = {0u};
+    ADI_InitializeCommandCache();
+    for (uint16_t code = 0u; code < (1u << ADI_COMMAND_CODE_LENGTH); code++) {
+        command[ADI_COMMAND_BYTE0_POSITION] = (code >> ADI_BYTE_SHIFT) & ADI_ONE_BYTE_MASK;
+        command[ADI_COMMAND_BYTE1_POSITION] = code & ADI_ONE_BYTE_MASK;
+        TEST_AssertCommandFrame(command);
+    }
+}
+
+void testADI_CommandFramesOfMeasurementCycle(void) {
+    /* Command frames that are prepared in one measurement cycle (read of
+     * the cell voltages, the redundant cell voltages and the GPIO voltages
+     * and the start of the GPIO conversions). */
+    const uint16_t *const commands[] = {
+        adi_cmdRdcva,  adi_cmdRdcvb,  adi_cmdRdcvc,  adi_cmdRdcvd,  adi_cmdRdcve,  adi_cmdRdcvf,  adi_cmdRdsva,
+        adi_cmdRdsvb,  adi_cmdRdsvc,  adi_cmdRdsvd,  adi_cmdRdsve,  adi_cmdRdsvf,  adi_cmdRdauxa, adi_cmdRdauxb,
+        adi_cmdRdauxc, adi_cmdRdauxd, adi_cmdRdraxa, adi_cmdRdraxb, adi_cmdRdraxc, adi_cmdRdraxd, adi_cmdAdax,
+        adi_cmdAdax2,  adi_cmdSnap,   adi_cmdUnsnap,
+    };
+    ADI_InitializeCommandCache();
+    for (uint8_t i = 0u; i < (uint8_t)(sizeof(commands) / sizeof(commands[0])); i++) {
+        TEST_AssertCommandFrame(commands[i]);
+    }
+}
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+void testADI_CommandFramePreparationPerMeasurementCycle(void) {
+    /* Command frames that are prepared in one measurement cycle (see
+     * testADI_CommandFramesOfMeasurementCycle). The timing on the host is
+     * only reported. */
+    const uint16_t *const commands[] = {
+        adi_cmdRdcva,  adi_cmdRdcvb,  adi_cmdRdcvc,  adi_cmdRdcvd,  adi_cmdRdcve,  adi_cmdRdcvf,  adi_cmdRdsva,
+        adi_cmdRdsvb,  adi_cmdRdsvc,  adi_cmdRdsvd,  adi_cmdRdsve,  adi_cmdRdsvf,  adi_cmdRdauxa, adi_cmdRdauxb,
+        adi_cmdRdauxc, adi_cmdRdauxd, adi_cmdRdraxa, adi_cmdRdraxb, adi_cmdRdraxc, adi_cmdRdraxd, adi_cmdAdax,
+        adi_cmdAdax2,  adi_cmdSnap,   adi_cmdUnsnap,
+    };
+    const uint8_t numberOfCommands                              = (uint8_t)(sizeof(commands) / sizeof(commands[0]));
+    static uint16_t txBuffer[ADI_COMMAND_AND_PEC_SIZE_IN_BYTES] = {0u};
+    ADI_InitializeCommandCache();
+
+    const clock_t referenceStart = clock();
+    for (uint32_t repetition = 0u; repetition < TEST_NUMBER_OF_REPETITIONS; repetition++) {
+        for (uint8_t i = 0u; i < numberOfCommands; i++) {
+            TEST_ReferenceSetCommandFrame(commands[i], txBuffer);
+        }
+    }
+    const clock_t referenceTicks = clock() - referenceStart;
+
+    const clock_t cachedStart = clock();
+    for (uint32_t repetition = 0u; repetition < TEST_NUMBER_OF_REPETITIONS; repetition++) {
+        for (uint8_t i = 0u; i < numberOfCommands; i++) {
+            TEST_ADI_SetCommandFrame(commands[i], txBuffer);
+        }
+    }
+    const clock_t cachedTicks = clock() - cachedStart;
+
+    char message[200] = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "per cycle: %u command PEC calculations (calculated frames) vs. 0 (cached frames); "
+        "host time %ld vs. %ld clock ticks",
+        (unsigned int)numberOfCommands,
+        (long)referenceTicks,
+        (long)cachedTicks);
+    TEST_MESSAGE(message);
+}
+#endif
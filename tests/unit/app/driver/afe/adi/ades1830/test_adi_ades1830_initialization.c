@@ -43,7 +43,7 @@
  * @file    test_adi_ades1830_initialization.c
  * @author  foxBMS Team
  * @date    2022-12-07 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -339,6 +339,7 @@ void testADI_InitializeMeasurement(void) {
     /* invalid pointer */
     TEST_ASSERT_FAIL_ASSERT(ADI_InitializeMeasurement(NULL_PTR));
 
+    ADI_InitializeCommandCache_Expect();
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
         /* real test */
         /* first block */
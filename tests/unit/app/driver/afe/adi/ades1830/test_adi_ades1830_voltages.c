@@ -43,7 +43,7 @@
  * @file    test_adi_ades1830_voltages.c
  * @author  foxBMS Team
  * @date    2022-12-07 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -57,6 +57,7 @@
 #include "Mockadi_ades183x_cfg.h"
 #include "Mockos.h"
 #include "Mockspi.h"
+#include "Mocktsi.h"
 
 #include "adi_ades183x_buffers.h" /* use the real buffer configuration */
 #include "adi_ades183x_commands.h"
@@ -74,6 +75,7 @@
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_SOURCE_FILE("adi_ades183x_buffers.c")
 TEST_SOURCE_FILE("adi_ades183x_voltages.c")
+TEST_SOURCE_FILE("afe_plausibility.c")
 
 TEST_INCLUDE_PATH("../../src/app/application/config")
 TEST_INCLUDE_PATH("../../src/app/driver/afe/adi/ades1830")
@@ -326,6 +328,14 @@ void testADI_ReadAndStoreVoltages(void) {
                     TEST_ASSERT_EQUAL(1884, pVoltageTable->cellVoltage_mV[s][m][cb]);
                 }
             }
+            if (storeLocation == ADI_CELL_VOLTAGE) {
+                /* all cell voltages are plausible: check the string values */
+                TEST_ASSERT_EQUAL(BS_NR_OF_CELL_BLOCKS_PER_STRING, pVoltageTable->nrValidCellVoltages[s]);
+                TEST_ASSERT_EQUAL(1884 * BS_NR_OF_CELL_BLOCKS_PER_STRING, pVoltageTable->stringVoltage_mV[s]);
+                for (uint16_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+                    TEST_ASSERT_EQUAL_UINT64(0u, pVoltageTable->invalidCellVoltage[s][m]);
+                }
+            }
         }
     }
 }
@@ -0,0 +1,249 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_afe_pipeline.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the afe_pipeline.c module
+ * @details Besides the module functions, a timing model of the measurement
+ *          of 1 to 16 strings is run on a simulated clock. Each string is
+ *          measured in three phases: conversion, readout of the result
+ *          registers over the shared SPI interface and post-processing. The
+ *          sequential measurement is compared to the pipelined measurement,
+ *          that starts the conversion of the next string after the readout
+ *          of the current string.
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+
+#include "afe_pipeline.h"
+#include "test_assert_helper.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#endif
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_INCLUDE_PATH("../../src/app/driver/afe/api")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** maximum number of strings in the timing model */
+#define TEST_MAXIMUM_NUMBER_OF_STRINGS (16u)
+
+/** durations of the measurement phases of one string in the timing model */
+typedef struct {
+    uint32_t conversion_ms;     /*!< conversion, the AFE measures without SPI communication */
+    uint32_t readout_ms;        /*!< readout of the result registers over the shared SPI interface */
+    uint32_t postProcessing_ms; /*!< processing of the values, auxiliary measurements and balancing */
+} TEST_PHASES_s;
+
+/** phases of one LTC daisy-chain: normal mode cell voltage conversion, 6 registers, multiplexer measurement */
+static const TEST_PHASES_s test_phasesLtc = {
+    .conversion_ms     = 4u,
+    .readout_ms        = 2u,
+    .postProcessing_ms = 12u,
+};
+
+/** phases with a conversion that is longer than the post-processing */
+static const TEST_PHASES_s test_phasesLongConversion = {
+    .conversion_ms     = 10u,
+    .readout_ms        = 1u,
+    .postProcessing_ms = 4u,
+};
+
+/** simulated time, starts shortly before the overflow of the tick counter */
+static uint32_t test_time_ms = 0u;
+
+static uint32_t TEST_RunSequentialCycle(const TEST_PHASES_s *pPhases, uint8_t numberOfStrings) {
+    const uint32_t start_ms = test_time_ms;
+    for (uint8_t s = 0u; s < numberOfStrings; s++) {
+        test_time_ms += pPhases->conversion_ms;
+        test_time_ms += pPhases->readout_ms;
+        test_time_ms += pPhases->postProcessing_ms;
+    }
+    return test_time_ms - start_ms;
+}
+
+static uint32_t TEST_RunPipelinedCycle(const TEST_PHASES_s *pPhases, uint8_t numberOfStrings) {
+    const uint32_t start_ms     = test_time_ms;
+    AFE_PIPELINE_s pipeline     = {0};
+    uint32_t conversionStart_ms = 0u;
+    AFE_PipelineReset(&pipeline);
+    for (uint8_t s = 0u; s < numberOfStrings; s++) {
+        if (AFE_PipelineTakeConversion(&pipeline, s, &conversionStart_ms) == false) {
+            conversionStart_ms = test_time_ms;
+        }
+        test_time_ms += AFE_PipelineGetRemainingTime(conversionStart_ms, pPhases->conversion_ms, test_time_ms);
+        test_time_ms += pPhases->readout_ms;
+        /* the SPI interface is free again: start the conversion of the next string */
+        if ((s + 1u) < numberOfStrings) {
+            AFE_PipelineStartConversion(&pipeline, s + 1u, test_time_ms);
+        }
+        test_time_ms += pPhases->postProcessing_ms;
+    }
+    return test_time_ms - start_ms;
+}
+
+/** expected cycle time: only the first conversion and the part of a conversion exceeding the post-processing */
+static uint32_t TEST_GetExpectedPipelinedCycleTime(const TEST_PHASES_s *pPhases, uint8_t numberOfStrings) {
+    uint32_t exposedConversion_ms = 0u;
+    if (pPhases->conversion_ms > pPhases->postProcessing_ms) {
+        exposedConversion_ms = pPhases->conversion_ms - pPhases->postProcessing_ms;
+    }
+    return pPhases->conversion_ms + (numberOfStrings * (pPhases->readout_ms + pPhases->postProcessing_ms)) +
+           ((numberOfStrings - 1u) * exposedConversion_ms);
+}
+
+static void TEST_CompareCycleTimes(const TEST_PHASES_s *pPhases) {
+    for (uint8_t n = 1u; n <= TEST_MAXIMUM_NUMBER_OF_STRINGS; n++) {
+        const uint32_t sequentialCycleTime_ms = TEST_RunSequentialCycle(pPhases, n);
+        const uint32_t pipelinedCycleTime_ms  = TEST_RunPipelinedCycle(pPhases, n);
+
+        TEST_ASSERT_EQUAL_UINT32(TEST_GetExpectedPipelinedCycleTime(pPhases, n), pipelinedCycleTime_ms);
+        if (n == 1u) {
+            TEST_ASSERT_EQUAL_UINT32(sequentialCycleTime_ms, pipelinedCycleTime_ms);
+        } else {
+            TEST_ASSERT_LESS_THAN_UINT32(sequentialCycleTime_ms, pipelinedCycleTime_ms);
+        }
+    }
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    test_time_ms = UINT32_MAX - 100u;
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testAFE_PipelineReset(void) {
+    TEST_ASSERT_FAIL_ASSERT(AFE_PipelineReset(NULL_PTR));
+
+    AFE_PIPELINE_s pipeline = {.conversionStarted = true, .stringNumber = 3u, .conversionStart_ms = 42u};
+    AFE_PipelineReset(&pipeline);
+    TEST_ASSERT_FALSE(pipeline.conversionStarted);
+    TEST_ASSERT_EQUAL_UINT8(0u, pipeline.stringNumber);
+    TEST_ASSERT_EQUAL_UINT32(0u, pipeline.conversionStart_ms);
+}
+
+void testAFE_PipelineStartConversion(void) {
+    TEST_ASSERT_FAIL_ASSERT(AFE_PipelineStartConversion(NULL_PTR, 0u, 0u));
+
+    AFE_PIPELINE_s pipeline = {0};
+    AFE_PipelineStartConversion(&pipeline, 2u, 1234u);
+    TEST_ASSERT_TRUE(pipeline.conversionStarted);
+    TEST_ASSERT_EQUAL_UINT8(2u, pipeline.stringNumber);
+    TEST_ASSERT_EQUAL_UINT32(1234u, pipeline.conversionStart_ms);
+}
+
+void testAFE_PipelineTakeConversion(void) {
+    AFE_PIPELINE_s pipeline     = {0};
+    uint32_t conversionStart_ms = 0u;
+    TEST_ASSERT_FAIL_ASSERT(AFE_PipelineTakeConversion(NULL_PTR, 0u, &conversionStart_ms));
+    TEST_ASSERT_FAIL_ASSERT(AFE_PipelineTakeConversion(&pipeline, 0u, NULL_PTR));
+
+    /* nothing started ahead */
+    TEST_ASSERT_FALSE(AFE_PipelineTakeConversion(&pipeline, 0u, &conversionStart_ms));
+
+    /* started for the requested string: taken exactly once */
+    AFE_PipelineStartConversion(&pipeline, 1u, 500u);
+    TEST_ASSERT_TRUE(AFE_PipelineTakeConversion(&pipeline, 1u, &conversionStart_ms));
+    TEST_ASSERT_EQUAL_UINT32(500u, conversionStart_ms);
+    TEST_ASSERT_FALSE(AFE_PipelineTakeConversion(&pipeline, 1u, &conversionStart_ms));
+
+    /* started for another string: discarded, the time stamp is not touched */
+    conversionStart_ms = 0u;
+    AFE_PipelineStartConversion(&pipeline, 2u, 600u);
+    TEST_ASSERT_FALSE(AFE_PipelineTakeConversion(&pipeline, 1u, &conversionStart_ms));
+    TEST_ASSERT_EQUAL_UINT32(0u, conversionStart_ms);
+    TEST_ASSERT_FALSE(pipeline.conversionStarted);
+}
+
+void testAFE_PipelineGetRemainingTime(void) {
+    TEST_ASSERT_EQUAL_UINT32(10u, AFE_PipelineGetRemainingTime(100u, 10u, 100u));
+    TEST_ASSERT_EQUAL_UINT32(4u, AFE_PipelineGetRemainingTime(100u, 10u, 106u));
+    TEST_ASSERT_EQUAL_UINT32(0u, AFE_PipelineGetRemainingTime(100u, 10u, 110u));
+    TEST_ASSERT_EQUAL_UINT32(0u, AFE_PipelineGetRemainingTime(100u, 10u, 5000u));
+    /* overflow of the tick counter */
+    TEST_ASSERT_EQUAL_UINT32(7u, AFE_PipelineGetRemainingTime(UINT32_MAX - 1u, 10u, 1u));
+    TEST_ASSERT_EQUAL_UINT32(0u, AFE_PipelineGetRemainingTime(UINT32_MAX - 1u, 10u, 8u));
+}
+
+void testAFE_PipelineRefreshRate(void) {
+    TEST_CompareCycleTimes(&test_phasesLtc);
+}
+
+void testAFE_PipelineRefreshRateLongConversion(void) {
+    /* the conversion is only partly hidden behind the post-processing */
+    TEST_CompareCycleTimes(&test_phasesLongConversion);
+}
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+/** host benchmark: reports the simulated refresh rates of the sequential and the pipelined acquisition */
+void testAFE_PipelineRefreshRateReport(void) {
+    for (uint8_t n = 1u; n <= TEST_MAXIMUM_NUMBER_OF_STRINGS; n++) {
+        const uint32_t sequentialCycleTime_ms = TEST_RunSequentialCycle(&test_phasesLtc, n);
+        const uint32_t pipelinedCycleTime_ms  = TEST_RunPipelinedCycle(&test_phasesLtc, n);
+        char message[100]                     = {0};
+        (void)snprintf(
+            message,
+            sizeof(message),
+            "%2u strings: sequential %3ums (%5.1fHz), pipelined %3ums (%5.1fHz)",
+            (unsigned int)n,
+            (unsigned int)sequentialCycleTime_ms,
+            1000.0 / (double)sequentialCycleTime_ms,
+            (unsigned int)pipelinedCycleTime_ms,
+            1000.0 / (double)pipelinedCycleTime_ms);
+        TEST_MESSAGE(message);
+    }
+}
+#endif
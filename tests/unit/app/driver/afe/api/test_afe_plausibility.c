@@ -43,7 +43,7 @@
  * @file    test_afe_plausibility.c
  * @author  foxBMS Team
  * @date    2020-07-13 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -59,6 +59,14 @@
 #include "afe_plausibility.h"
 #include "test_assert_helper.h"
 
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#include <time.h>
+#endif
+
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_INCLUDE_PATH("../../src/app/driver/afe/api")
 TEST_INCLUDE_PATH("../../src/app/driver/ts/api")
@@ -77,8 +85,125 @@ AFE_PLAUSIBILITY_VALUES_s testGenericLimitsNegative = {
     .minimumPlausibleVoltage_mV = -5000,
 };
 
+/** number of cell blocks of the largest module that is supported by the kernel */
+#define TEST_CELL_BLOCKS (AFE_PLAUSIBILITY_MAXIMUM_CELL_BLOCKS_PER_MODULE)
+
+/** number of randomized modules that are compared against the reference implementations */
+#define TEST_NUMBER_OF_RANDOM_MODULES (500u)
+
+/** plausible cell voltage values of the LTC 681x */
+static const AFE_PLAUSIBILITY_VALUES_s testLtcLimits = {
+    .maximumPlausibleVoltage_mV = 5000,
+    .minimumPlausibleVoltage_mV = -2500,
+};
+
+/** plausible cell voltage values of the ADES183x */
+static const AFE_PLAUSIBILITY_VALUES_s testAdiLimits = {
+    .maximumPlausibleVoltage_mV = 5500,
+    .minimumPlausibleVoltage_mV = -2500,
+};
+
+/** state of the pseudo random number generator */
+static uint32_t testRandomState = 1u;
+
+/** linear congruential generator, so that the randomized tests are reproducible */
+static uint32_t TEST_Random(void) {
+    testRandomState = (testRandomState * 1664525u) + 1013904223u;
+    return testRandomState >> 8u;
+}
+
+/** fills a module with cell voltages of which roughly every eighth is implausible */
+static void TEST_FillModule(int16_t *pCellVoltages_mV, uint8_t *pOpenWire, uint8_t numberOfCellBlocks) {
+    for (uint8_t cb = 0u; cb < numberOfCellBlocks; cb++) {
+        const uint32_t random = TEST_Random();
+        if ((random % 16u) == 0u) {
+            pCellVoltages_mV[cb] = INT16_MAX - (int16_t)(random % 100u);
+        } else if ((random % 16u) == 1u) {
+            pCellVoltages_mV[cb] = INT16_MIN + (int16_t)(random % 100u);
+        } else {
+            pCellVoltages_mV[cb] = (int16_t)(random % 5000u);
+        }
+    }
+    for (uint8_t i = 0u; i <= numberOfCellBlocks; i++) {
+        pOpenWire[i] = ((TEST_Random() % 32u) == 0u) ? 1u : 0u;
+    }
+}
+
+/** random bitmask of previously invalidated cell voltages (e.g., because of a PEC error) */
+static uint64_t TEST_RandomInvalidMask(void) {
+    uint64_t mask = 0u;
+    for (uint8_t cb = 0u; cb < TEST_CELL_BLOCKS; cb++) {
+        if ((TEST_Random() % 20u) == 0u) {
+            mask |= (uint64_t)1u << cb;
+        }
+    }
+    return mask;
+}
+
+/** reference: per-cell loop of the LTC drivers before the kernel was introduced */
+static uint64_t TEST_ReferenceLtc(
+    const int16_t *pCellVoltages_mV,
+    uint8_t numberOfCellBlocks,
+    const uint8_t *pOpenWire,
+    uint64_t invalidCellVoltages,
+    AFE_CELL_VOLTAGE_ACCUMULATOR_s *pAccumulator) {
+    for (uint8_t cb = 0u; cb < numberOfCellBlocks; cb++) {
+        if ((pOpenWire[cb] == 0u) && (pOpenWire[cb + 1u] == 0u) &&
+            ((invalidCellVoltages & ((uint64_t)1u << cb)) == 0u)) {
+            if (STD_OK == AFE_PlausibilityCheckVoltageMeasurementRange(pCellVoltages_mV[cb], testLtcLimits)) {
+                pAccumulator->stringVoltage_mV += pCellVoltages_mV[cb];
+                pAccumulator->numberOfValidCellVoltages++;
+            } else {
+                invalidCellVoltages |= (uint64_t)1u << cb;
+            }
+        } else {
+            invalidCellVoltages |= (uint64_t)1u << cb;
+        }
+    }
+    return invalidCellVoltages;
+}
+
+/** reference: per-cell loop of the Maxim driver before the kernel was introduced */
+static uint64_t TEST_ReferenceMaxim(
+    const int16_t *pCellVoltages_mV,
+    uint8_t numberOfCellBlocks,
+    bool moduleIsConnected,
+    uint64_t invalidCellVoltages,
+    AFE_CELL_VOLTAGE_ACCUMULATOR_s *pAccumulator) {
+    for (uint8_t cb = 0u; cb < numberOfCellBlocks; cb++) {
+        const STD_RETURN_TYPE_e valueIsPlausible =
+            AFE_PlausibilityCheckVoltageMeasurementRange(pCellVoltages_mV[cb], testGenericLimits);
+        if ((valueIsPlausible == STD_OK) && moduleIsConnected) {
+            pAccumulator->numberOfValidCellVoltages++;
+        } else {
+            invalidCellVoltages |= (uint64_t)1u << cb;
+        }
+    }
+    return invalidCellVoltages;
+}
+
+/** reference: evaluation of the ADI and NXP drivers, i.e., previously invalidated cells plus range check */
+static uint64_t TEST_ReferenceWithoutOpenWire(
+    const int16_t *pCellVoltages_mV,
+    uint8_t numberOfCellBlocks,
+    uint64_t invalidCellVoltages,
+    const AFE_PLAUSIBILITY_VALUES_s limits,
+    AFE_CELL_VOLTAGE_ACCUMULATOR_s *pAccumulator) {
+    for (uint8_t cb = 0u; cb < numberOfCellBlocks; cb++) {
+        if (STD_OK != AFE_PlausibilityCheckVoltageMeasurementRange(pCellVoltages_mV[cb], limits)) {
+            invalidCellVoltages |= (uint64_t)1u << cb;
+        }
+        if ((invalidCellVoltages & ((uint64_t)1u << cb)) == 0u) {
+            pAccumulator->stringVoltage_mV += pCellVoltages_mV[cb];
+            pAccumulator->numberOfValidCellVoltages++;
+        }
+    }
+    return invalidCellVoltages;
+}
+
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    testRandomState = 1u;
 }
 
 void tearDown(void) {
@@ -227,3 +352,221 @@ void testAFE_PlausibilityCheckTempMinMaxVerify(void) {
     TEST_ASSERT_EQUAL(STD_NOT_OK, AFE_PlausibilityCheckTempMinMax(upperLimit_ddegC + 1));
     TEST_ASSERT_EQUAL(STD_NOT_OK, AFE_PlausibilityCheckTempMinMax(INT16_MAX));
 }
+
+/** check the input sanitation of the module cell voltage kernel */
+void testAFE_PlausibilityCheckModuleCellVoltagesInvalidInput(void) {
+    int16_t cellVoltages_mV[TEST_CELL_BLOCKS + 1u] = {0};
+    AFE_CELL_VOLTAGE_ACCUMULATOR_s accumulator     = {0};
+    AFE_PLAUSIBILITY_VALUES_s limitsEqualValues    = {
+           .maximumPlausibleVoltage_mV = 42,
+           .minimumPlausibleVoltage_mV = 42,
+    };
+    AFE_PLAUSIBILITY_VALUES_s limitsDescendingOrder = {
+        .maximumPlausibleVoltage_mV = 0,
+        .minimumPlausibleVoltage_mV = 1,
+    };
+
+    TEST_ASSERT_FAIL_ASSERT(
+        AFE_PlausibilityCheckModuleCellVoltages(NULL_PTR, 1u, NULL_PTR, 0u, testGenericLimits, &accumulator));
+    TEST_ASSERT_FAIL_ASSERT(AFE_PlausibilityCheckModuleCellVoltages(
+        cellVoltages_mV, TEST_CELL_BLOCKS + 1u, NULL_PTR, 0u, testGenericLimits, &accumulator));
+    TEST_ASSERT_FAIL_ASSERT(
+        AFE_PlausibilityCheckModuleCellVoltages(cellVoltages_mV, 1u, NULL_PTR, 0u, limitsEqualValues, &accumulator));
+    TEST_ASSERT_FAIL_ASSERT(AFE_PlausibilityCheckModuleCellVoltages(
+        cellVoltages_mV, 1u, NULL_PTR, 0u, limitsDescendingOrder, &accumulator));
+    TEST_ASSERT_FAIL_ASSERT(
+        AFE_PlausibilityCheckModuleCellVoltages(cellVoltages_mV, 1u, NULL_PTR, 0u, testGenericLimits, NULL_PTR));
+}
+
+/** check the kernel with hand-crafted values: open wire, limits and the accumulation across modules */
+void testAFE_PlausibilityCheckModuleCellVoltages(void) {
+    const int16_t cellVoltages_mV[6u]          = {3000, 5001, 5000, 0, -1, 3500};
+    const uint8_t openWire[7u]                 = {0u, 0u, 0u, 0u, 0u, 0u, 1u};
+    AFE_CELL_VOLTAGE_ACCUMULATOR_s accumulator = {.stringVoltage_mV = 100, .numberOfValidCellVoltages = 1u};
+
+    /* cell 1 and 4 are out of range, cell 5 has an open wire at its upper input and cell 0 was already invalid */
+    uint64_t invalid =
+        AFE_PlausibilityCheckModuleCellVoltages(cellVoltages_mV, 6u, openWire, 0x1u, testGenericLimits, &accumulator);
+    TEST_ASSERT_EQUAL_UINT64(0x33u, invalid);
+    TEST_ASSERT_EQUAL_INT32(100 + 5000 + 0, accumulator.stringVoltage_mV);
+    TEST_ASSERT_EQUAL_UINT16(3u, accumulator.numberOfValidCellVoltages);
+
+    /* without open-wire information only the range check and the previous state are taken into account */
+    invalid =
+        AFE_PlausibilityCheckModuleCellVoltages(cellVoltages_mV, 6u, NULL_PTR, 0x0u, testGenericLimits, &accumulator);
+    TEST_ASSERT_EQUAL_UINT64(0x12u, invalid);
+    TEST_ASSERT_EQUAL_INT32(5100 + 3000 + 5000 + 0 + 3500, accumulator.stringVoltage_mV);
+    TEST_ASSERT_EQUAL_UINT16(7u, accumulator.numberOfValidCellVoltages);
+
+    /* an open wire at the lowest input invalidates only the first cell block */
+    const uint8_t openWireLowestInput[7u] = {1u, 0u, 0u, 0u, 0u, 0u, 0u};
+    invalid                               = AFE_PlausibilityCheckModuleCellVoltages(
+        cellVoltages_mV, 6u, openWireLowestInput, 0x0u, testGenericLimits, &accumulator);
+    TEST_ASSERT_EQUAL_UINT64(0x13u, invalid);
+
+    /* a module without cell blocks does not change anything */
+    AFE_CELL_VOLTAGE_ACCUMULATOR_s emptyAccumulator = {0};
+    TEST_ASSERT_EQUAL_UINT64(
+        0x5u,
+        AFE_PlausibilityCheckModuleCellVoltages(
+            cellVoltages_mV, 0u, openWire, 0x5u, testGenericLimits, &emptyAccumulator));
+    TEST_ASSERT_EQUAL_INT32(0, emptyAccumulator.stringVoltage_mV);
+    TEST_ASSERT_EQUAL_UINT16(0u, emptyAccumulator.numberOfValidCellVoltages);
+
+    /* the upper most cell block of the largest supported module is evaluated */
+    int16_t largeModule_mV[TEST_CELL_BLOCKS] = {0};
+    largeModule_mV[TEST_CELL_BLOCKS - 1u]    = INT16_MAX;
+    TEST_ASSERT_EQUAL_UINT64(
+        (uint64_t)1u << (TEST_CELL_BLOCKS - 1u),
+        AFE_PlausibilityCheckModuleCellVoltages(
+            largeModule_mV, TEST_CELL_BLOCKS, NULL_PTR, 0u, testGenericLimits, &emptyAccumulator));
+    TEST_ASSERT_EQUAL_UINT16(TEST_CELL_BLOCKS - 1u, emptyAccumulator.numberOfValidCellVoltages);
+}
+
+/** LTC: kernel with open-wire state and PEC-invalidated cells is equivalent to the former driver loop */
+void testAFE_PlausibilityCheckModuleCellVoltagesEquivalenceLtc(void) {
+    int16_t cellVoltages_mV[TEST_CELL_BLOCKS] = {0};
+    uint8_t openWire[TEST_CELL_BLOCKS + 1u]   = {0u};
+    for (uint16_t i = 0u; i < TEST_NUMBER_OF_RANDOM_MODULES; i++) {
+        const uint8_t numberOfCellBlocks = (uint8_t)((TEST_Random() % TEST_CELL_BLOCKS) + 1u);
+        TEST_FillModule(cellVoltages_mV, openWire, numberOfCellBlocks);
+        const uint64_t previouslyInvalid = TEST_RandomInvalidMask() & (UINT64_MAX >> (64u - numberOfCellBlocks));
+
+        AFE_CELL_VOLTAGE_ACCUMULATOR_s expected = {0};
+        AFE_CELL_VOLTAGE_ACCUMULATOR_s actual   = {0};
+        const uint64_t expectedInvalid =
+            TEST_ReferenceLtc(cellVoltages_mV, numberOfCellBlocks, openWire, previouslyInvalid, &expected);
+        const uint64_t actualInvalid = AFE_PlausibilityCheckModuleCellVoltages(
+            cellVoltages_mV, numberOfCellBlocks, openWire, previouslyInvalid, testLtcLimits, &actual);
+
+        TEST_ASSERT_EQUAL_UINT64(expectedInvalid, actualInvalid);
+        TEST_ASSERT_EQUAL_INT32(expected.stringVoltage_mV, actual.stringVoltage_mV);
+        TEST_ASSERT_EQUAL_UINT16(expected.numberOfValidCellVoltages, actual.numberOfValidCellVoltages);
+    }
+}
+
+/** Maxim: kernel with the connection state as initial mask is equivalent to the former driver loop */
+void testAFE_PlausibilityCheckModuleCellVoltagesEquivalenceMaxim(void) {
+    int16_t cellVoltages_mV[TEST_CELL_BLOCKS] = {0};
+    uint8_t openWire[TEST_CELL_BLOCKS + 1u]   = {0u};
+    for (uint16_t i = 0u; i < TEST_NUMBER_OF_RANDOM_MODULES; i++) {
+        const uint8_t numberOfCellBlocks = (uint8_t)((TEST_Random() % 14u) + 1u);
+        TEST_FillModule(cellVoltages_mV, openWire, numberOfCellBlocks);
+        const bool moduleIsConnected = (TEST_Random() % 4u) != 0u;
+        /* the Maxim driver only sets bits in the database table, it never clears them */
+        const uint64_t tableEntry = TEST_RandomInvalidMask();
+
+        AFE_CELL_VOLTAGE_ACCUMULATOR_s expected = {0};
+        AFE_CELL_VOLTAGE_ACCUMULATOR_s actual   = {0};
+        const uint64_t expectedInvalid =
+            TEST_ReferenceMaxim(cellVoltages_mV, numberOfCellBlocks, moduleIsConnected, tableEntry, &expected);
+        uint64_t notConnectedCellVoltages = 0u;
+        if (moduleIsConnected == false) {
+            notConnectedCellVoltages = UINT64_MAX >> (64u - numberOfCellBlocks);
+        }
+        const uint64_t actualInvalid = tableEntry | AFE_PlausibilityCheckModuleCellVoltages(
+                                                        cellVoltages_mV,
+                                                        numberOfCellBlocks,
+                                                        NULL_PTR,
+                                                        notConnectedCellVoltages,
+                                                        testGenericLimits,
+                                                        &actual);
+
+        TEST_ASSERT_EQUAL_UINT64(expectedInvalid, actualInvalid);
+        TEST_ASSERT_EQUAL_UINT16(expected.numberOfValidCellVoltages, actual.numberOfValidCellVoltages);
+    }
+}
+
+/** ADI: kernel without open-wire state is equivalent to the range check of the stored cell voltages */
+void testAFE_PlausibilityCheckModuleCellVoltagesEquivalenceAdi(void) {
+    int16_t cellVoltages_mV[TEST_CELL_BLOCKS] = {0};
+    uint8_t openWire[TEST_CELL_BLOCKS + 1u]   = {0u};
+    for (uint16_t i = 0u; i < TEST_NUMBER_OF_RANDOM_MODULES; i++) {
+        /* ADES1830: 16 cell inputs */
+        const uint8_t numberOfCellBlocks = (uint8_t)((TEST_Random() % 16u) + 1u);
+        TEST_FillModule(cellVoltages_mV, openWire, numberOfCellBlocks);
+        const uint64_t diagnosticInvalid = TEST_RandomInvalidMask() & (UINT64_MAX >> (64u - numberOfCellBlocks));
+
+        AFE_CELL_VOLTAGE_ACCUMULATOR_s expected = {0};
+        AFE_CELL_VOLTAGE_ACCUMULATOR_s actual   = {0};
+        const uint64_t expectedInvalid          = TEST_ReferenceWithoutOpenWire(
+            cellVoltages_mV, numberOfCellBlocks, diagnosticInvalid, testAdiLimits, &expected);
+        const uint64_t actualInvalid = AFE_PlausibilityCheckModuleCellVoltages(
+            cellVoltages_mV, numberOfCellBlocks, NULL_PTR, diagnosticInvalid, testAdiLimits, &actual);
+
+        TEST_ASSERT_EQUAL_UINT64(expectedInvalid, actualInvalid);
+        TEST_ASSERT_EQUAL_INT32(expected.stringVoltage_mV, actual.stringVoltage_mV);
+        TEST_ASSERT_EQUAL_UINT16(expected.numberOfValidCellVoltages, actual.numberOfValidCellVoltages);
+    }
+}
+
+/** NXP: kernel without open-wire state is equivalent to the evaluation of the raw value validity */
+void testAFE_PlausibilityCheckModuleCellVoltagesEquivalenceNxp(void) {
+    int16_t cellVoltages_mV[TEST_CELL_BLOCKS] = {0};
+    uint8_t openWire[TEST_CELL_BLOCKS + 1u]   = {0u};
+    for (uint16_t i = 0u; i < TEST_NUMBER_OF_RANDOM_MODULES; i++) {
+        /* MC33775A: 14 cell inputs */
+        const uint8_t numberOfCellBlocks = (uint8_t)((TEST_Random() % 14u) + 1u);
+        TEST_FillModule(cellVoltages_mV, openWire, numberOfCellBlocks);
+        const uint64_t rawValueInvalid = TEST_RandomInvalidMask() & (UINT64_MAX >> (64u - numberOfCellBlocks));
+
+        AFE_CELL_VOLTAGE_ACCUMULATOR_s expected = {0};
+        AFE_CELL_VOLTAGE_ACCUMULATOR_s actual   = {0};
+        const uint64_t expectedInvalid          = TEST_ReferenceWithoutOpenWire(
+            cellVoltages_mV, numberOfCellBlocks, rawValueInvalid, testGenericLimits, &expected);
+        const uint64_t actualInvalid = AFE_PlausibilityCheckModuleCellVoltages(
+            cellVoltages_mV, numberOfCellBlocks, NULL_PTR, rawValueInvalid, testGenericLimits, &actual);
+
+        TEST_ASSERT_EQUAL_UINT64(expectedInvalid, actualInvalid);
+        TEST_ASSERT_EQUAL_INT32(expected.stringVoltage_mV, actual.stringVoltage_mV);
+        TEST_ASSERT_EQUAL_UINT16(expected.numberOfValidCellVoltages, actual.numberOfValidCellVoltages);
+    }
+}
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+/** host micro-benchmark: former per-cell LTC loop against the kernel for the largest supported module */
+void testAFE_PlausibilityCheckModuleCellVoltagesBenchmark(void) {
+    const uint32_t iterations                 = 200000u;
+    int16_t cellVoltages_mV[TEST_CELL_BLOCKS] = {0};
+    uint8_t openWire[TEST_CELL_BLOCKS + 1u]   = {0u};
+    TEST_FillModule(cellVoltages_mV, openWire, TEST_CELL_BLOCKS);
+
+    /* the accumulators are reset for every module, as the drivers do for every string */
+    AFE_CELL_VOLTAGE_ACCUMULATOR_s reference = {0};
+    uint64_t referenceInvalid                = 0u;
+    clock_t start                            = clock();
+    for (uint32_t i = 0u; i < iterations; i++) {
+        reference.stringVoltage_mV          = 0;
+        reference.numberOfValidCellVoltages = 0u;
+        referenceInvalid |=
+            TEST_ReferenceLtc(cellVoltages_mV, TEST_CELL_BLOCKS, openWire, (uint64_t)i & 0x3u, &reference);
+    }
+    const clock_t referenceTicks = clock() - start;
+
+    AFE_CELL_VOLTAGE_ACCUMULATOR_s kernel = {0};
+    uint64_t kernelInvalid                = 0u;
+    start                                 = clock();
+    for (uint32_t i = 0u; i < iterations; i++) {
+        kernel.stringVoltage_mV          = 0;
+        kernel.numberOfValidCellVoltages = 0u;
+        kernelInvalid |= AFE_PlausibilityCheckModuleCellVoltages(
+            cellVoltages_mV, TEST_CELL_BLOCKS, openWire, (uint64_t)i & 0x3u, testLtcLimits, &kernel);
+    }
+    const clock_t kernelTicks = clock() - start;
+
+    /* both loops have to produce the same result, otherwise the comparison is meaningless */
+    TEST_ASSERT_EQUAL_UINT64(referenceInvalid, kernelInvalid);
+    TEST_ASSERT_EQUAL_INT32(reference.stringVoltage_mV, kernel.stringVoltage_mV);
+    TEST_ASSERT_EQUAL_UINT16(reference.numberOfValidCellVoltages, kernel.numberOfValidCellVoltages);
+
+    char message[150] = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "%u cell blocks: per-cell loop %.1f ns/module, kernel %.1f ns/module",
+        (unsigned int)TEST_CELL_BLOCKS,
+        (1.0e9 * (double)referenceTicks) / ((double)CLOCKS_PER_SEC * (double)iterations),
+        (1.0e9 * (double)kernelTicks) / ((double)CLOCKS_PER_SEC * (double)iterations));
+    TEST_MESSAGE(message);
+}
+#endif
@@ -0,0 +1,324 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_afe_schedule.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the afe_schedule.c module
+ * @details Besides the module functions, the measurement cycle of an LTC
+ *          daisy-chain is run on a simulated clock for one minute. Each cycle
+ *          of a string consists of the cell voltage measurement, the
+ *          temperature measurement (one multiplexer channel) and the
+ *          open-wire check, if they are due, and the balancing. The achieved
+ *          sample rate and the worst-case staleness (longest time between
+ *          two samples) of each quantity are reported.
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockos.h"
+
+#include "afe_schedule.h"
+#include "afe_schedule_cfg.h"
+#include "test_assert_helper.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#endif
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_INCLUDE_PATH("../../src/app/driver/afe/api")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** simulated duration of the measurement */
+#define TEST_SIMULATION_DURATION_ms (60000u)
+
+/** durations of the steps of the measurement cycle of one string in the timing model */
+typedef struct {
+    uint32_t voltage_ms;     /*!< cell voltage conversion and readout */
+    uint32_t temperature_ms; /*!< configuration of one multiplexer channel, conversion and readout */
+    uint32_t openWire_ms;    /*!< open-wire check (two pull-up and two pull-down conversions) */
+    uint32_t balancing_ms;   /*!< balancing and database access */
+} TEST_STEPS_s;
+
+/** results of one quantity in the timing model */
+typedef struct {
+    uint32_t numberOfSamples;   /*!< number of samples in the simulated duration */
+    uint32_t lastSample_ms;     /*!< time stamp of the last sample */
+    uint32_t worstStaleness_ms; /*!< longest time between two samples */
+} TEST_QUANTITY_s;
+
+/** steps of one LTC daisy-chain in normal mode */
+static const TEST_STEPS_s test_stepsLtc = {
+    .voltage_ms     = 6u,
+    .temperature_ms = 8u,
+    .openWire_ms    = 50u,
+    .balancing_ms   = 4u,
+};
+
+/** rates that correspond to the measurement cycle without multi-rate schedule */
+static const AFE_SCHEDULE_CONFIG_s test_configEveryCycle = {
+    .temperatureDivider      = 1u,
+    .temperatureDividerBoost = 1u,
+    .openWirePeriod_ms       = 0u,
+    .openWirePeriodBoost_ms  = 0u,
+};
+
+/** multi-rate schedule: temperatures with every 4th cycle, open-wire check every 10s (boost: every cycle, 2s) */
+static const AFE_SCHEDULE_CONFIG_s test_configMultiRate = {
+    .temperatureDivider      = 4u,
+    .temperatureDividerBoost = 1u,
+    .openWirePeriod_ms       = 10000u,
+    .openWirePeriodBoost_ms  = 2000u,
+};
+
+/** simulated time, starts shortly before the overflow of the tick counter */
+static uint32_t test_time_ms = 0u;
+
+static void TEST_Sample(TEST_QUANTITY_s *pQuantity) {
+    const uint32_t staleness_ms = test_time_ms - pQuantity->lastSample_ms;
+    if (staleness_ms > pQuantity->worstStaleness_ms) {
+        pQuantity->worstStaleness_ms = staleness_ms;
+    }
+    pQuantity->lastSample_ms = test_time_ms;
+    pQuantity->numberOfSamples++;
+}
+
+static void TEST_Simulate(
+    const AFE_SCHEDULE_CONFIG_s *pConfig,
+    const TEST_STEPS_s *pSteps,
+    TEST_QUANTITY_s *pVoltages,
+    TEST_QUANTITY_s *pTemperatures,
+    TEST_QUANTITY_s *pOpenWire) {
+    AFE_SCHEDULE_s schedule = {0};
+    const uint32_t start_ms = test_time_ms;
+    AFE_ScheduleInitialize(&schedule, pConfig, test_time_ms);
+    *pVoltages     = (TEST_QUANTITY_s){.lastSample_ms = start_ms};
+    *pTemperatures = (TEST_QUANTITY_s){.lastSample_ms = start_ms};
+    *pOpenWire     = (TEST_QUANTITY_s){.lastSample_ms = start_ms};
+
+    /* the measured string is always string 0: the strings are measured one after the other in the same way */
+    while ((test_time_ms - start_ms) < TEST_SIMULATION_DURATION_ms) {
+        test_time_ms += pSteps->voltage_ms;
+        TEST_Sample(pVoltages);
+        if (AFE_ScheduleIsTemperatureMeasurementDue(&schedule, 0u) == true) {
+            test_time_ms += pSteps->temperature_ms;
+            TEST_Sample(pTemperatures);
+        }
+        if (AFE_ScheduleIsOpenWireCheckDue(&schedule, 0u, test_time_ms) == true) {
+            test_time_ms += pSteps->openWire_ms;
+            TEST_Sample(pOpenWire);
+        }
+        test_time_ms += pSteps->balancing_ms;
+    }
+}
+
+/** the check is run at the end of the first cycle after the period has elapsed */
+static void TEST_AssertNumberOfOpenWireChecks(
+    uint32_t period_ms,
+    uint32_t longestCycle_ms,
+    const TEST_QUANTITY_s *pOpenWire) {
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(
+        TEST_SIMULATION_DURATION_ms / (period_ms + longestCycle_ms), pOpenWire->numberOfSamples);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(TEST_SIMULATION_DURATION_ms / period_ms, pOpenWire->numberOfSamples);
+}
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+static void TEST_Report(const char *pName, const TEST_QUANTITY_s *pQuantity) {
+    char message[200] = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "%-24s %7.3fHz, worst-case staleness %5ums",
+        pName,
+        (double)pQuantity->numberOfSamples * 1000.0 / (double)TEST_SIMULATION_DURATION_ms,
+        (unsigned int)pQuantity->worstStaleness_ms);
+    TEST_MESSAGE(message);
+}
+#endif
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    AFE_ScheduleRequestBoost(false);
+    test_time_ms = UINT32_MAX - 100u;
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testAFE_ScheduleConfig(void) {
+    TEST_ASSERT_EQUAL_UINT8(AFE_SCHEDULE_TEMPERATURE_DIVIDER, afe_scheduleConfig.temperatureDivider);
+    TEST_ASSERT_EQUAL_UINT8(AFE_SCHEDULE_TEMPERATURE_DIVIDER_BOOST, afe_scheduleConfig.temperatureDividerBoost);
+    TEST_ASSERT_EQUAL_UINT32(AFE_SCHEDULE_OPEN_WIRE_PERIOD_ms, afe_scheduleConfig.openWirePeriod_ms);
+    TEST_ASSERT_EQUAL_UINT32(AFE_SCHEDULE_OPEN_WIRE_PERIOD_BOOST_ms, afe_scheduleConfig.openWirePeriodBoost_ms);
+}
+
+void testAFE_ScheduleInitialize(void) {
+    AFE_SCHEDULE_s schedule                    = {0};
+    const AFE_SCHEDULE_CONFIG_s invalidConfig  = {.temperatureDivider = 0u, .temperatureDividerBoost = 1u};
+    const AFE_SCHEDULE_CONFIG_s invalidConfig2 = {.temperatureDivider = 1u, .temperatureDividerBoost = 0u};
+    TEST_ASSERT_FAIL_ASSERT(AFE_ScheduleInitialize(NULL_PTR, &test_configMultiRate, 0u));
+    TEST_ASSERT_FAIL_ASSERT(AFE_ScheduleInitialize(&schedule, NULL_PTR, 0u));
+    TEST_ASSERT_FAIL_ASSERT(AFE_ScheduleInitialize(&schedule, &invalidConfig, 0u));
+    TEST_ASSERT_FAIL_ASSERT(AFE_ScheduleInitialize(&schedule, &invalidConfig2, 0u));
+
+    schedule.voltageMeasurementsSinceTemperature[0u] = 3u;
+    AFE_ScheduleInitialize(&schedule, &test_configMultiRate, 1234u);
+    TEST_ASSERT_EQUAL_PTR(&test_configMultiRate, schedule.pConfig);
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        TEST_ASSERT_EQUAL_UINT8(0u, schedule.voltageMeasurementsSinceTemperature[s]);
+        TEST_ASSERT_EQUAL_UINT32(1234u, schedule.lastOpenWireCheck_ms[s]);
+    }
+}
+
+void testAFE_ScheduleIsTemperatureMeasurementDue(void) {
+    AFE_SCHEDULE_s schedule = {0};
+    TEST_ASSERT_FAIL_ASSERT(AFE_ScheduleIsTemperatureMeasurementDue(NULL_PTR, 0u));
+    TEST_ASSERT_FAIL_ASSERT(AFE_ScheduleIsTemperatureMeasurementDue(&schedule, 0u));
+    AFE_ScheduleInitialize(&schedule, &test_configMultiRate, 0u);
+    TEST_ASSERT_FAIL_ASSERT(AFE_ScheduleIsTemperatureMeasurementDue(&schedule, BS_NR_OF_STRINGS));
+
+    /* with the first and then every 4th cell voltage measurement */
+    const bool expected[] = {true, false, false, false, true, false, false, false, true};
+    for (uint8_t i = 0u; i < (sizeof(expected) / sizeof(expected[0])); i++) {
+        TEST_ASSERT_EQUAL(expected[i], AFE_ScheduleIsTemperatureMeasurementDue(&schedule, 0u));
+    }
+
+    /* boost: measured with the next cell voltage measurement at the latest, then with every measurement */
+    AFE_ScheduleRequestBoost(true);
+    TEST_ASSERT_TRUE(AFE_ScheduleIsBoosted());
+    TEST_ASSERT_FALSE(AFE_ScheduleIsTemperatureMeasurementDue(&schedule, 0u));
+    TEST_ASSERT_TRUE(AFE_ScheduleIsTemperatureMeasurementDue(&schedule, 0u));
+    TEST_ASSERT_TRUE(AFE_ScheduleIsTemperatureMeasurementDue(&schedule, 0u));
+
+    /* back to the normal rate */
+    AFE_ScheduleRequestBoost(false);
+    TEST_ASSERT_FALSE(AFE_ScheduleIsBoosted());
+    TEST_ASSERT_TRUE(AFE_ScheduleIsTemperatureMeasurementDue(&schedule, 0u));
+    TEST_ASSERT_FALSE(AFE_ScheduleIsTemperatureMeasurementDue(&schedule, 0u));
+}
+
+void testAFE_ScheduleIsOpenWireCheckDue(void) {
+    AFE_SCHEDULE_s schedule = {0};
+    TEST_ASSERT_FAIL_ASSERT(AFE_ScheduleIsOpenWireCheckDue(NULL_PTR, 0u, 0u));
+    TEST_ASSERT_FAIL_ASSERT(AFE_ScheduleIsOpenWireCheckDue(&schedule, 0u, 0u));
+
+    /* disabled */
+    AFE_ScheduleInitialize(&schedule, &test_configEveryCycle, 0u);
+    TEST_ASSERT_FALSE(AFE_ScheduleIsOpenWireCheckDue(&schedule, 0u, UINT32_MAX));
+    AFE_ScheduleRequestBoost(true);
+    TEST_ASSERT_FALSE(AFE_ScheduleIsOpenWireCheckDue(&schedule, 0u, UINT32_MAX));
+    AFE_ScheduleRequestBoost(false);
+
+    /* periodic, across the overflow of the tick counter */
+    AFE_ScheduleInitialize(&schedule, &test_configMultiRate, UINT32_MAX - 4999u);
+    TEST_ASSERT_FAIL_ASSERT(AFE_ScheduleIsOpenWireCheckDue(&schedule, BS_NR_OF_STRINGS, 0u));
+    TEST_ASSERT_FALSE(AFE_ScheduleIsOpenWireCheckDue(&schedule, 0u, 4999u));
+    TEST_ASSERT_TRUE(AFE_ScheduleIsOpenWireCheckDue(&schedule, 0u, 5001u));
+    TEST_ASSERT_FALSE(AFE_ScheduleIsOpenWireCheckDue(&schedule, 0u, 5002u));
+
+    /* boost: shorter period */
+    AFE_ScheduleRequestBoost(true);
+    TEST_ASSERT_FALSE(AFE_ScheduleIsOpenWireCheckDue(&schedule, 0u, 7000u));
+    TEST_ASSERT_TRUE(AFE_ScheduleIsOpenWireCheckDue(&schedule, 0u, 7001u));
+}
+
+void testAFE_ScheduleSampleRates(void) {
+    TEST_QUANTITY_s voltages     = {0};
+    TEST_QUANTITY_s temperatures = {0};
+    TEST_QUANTITY_s openWire     = {0};
+
+    const uint32_t longestCycle_ms = test_stepsLtc.voltage_ms + test_stepsLtc.temperature_ms +
+                                     test_stepsLtc.openWire_ms + test_stepsLtc.balancing_ms;
+
+    /* temperatures in every cycle, no open-wire check */
+    TEST_Simulate(&test_configEveryCycle, &test_stepsLtc, &voltages, &temperatures, &openWire);
+    const uint32_t voltageSamplesEveryCycle = voltages.numberOfSamples;
+    TEST_ASSERT_EQUAL_UINT32(voltages.numberOfSamples, temperatures.numberOfSamples);
+    TEST_ASSERT_EQUAL_UINT32(0u, openWire.numberOfSamples);
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+    TEST_MESSAGE("temperatures in every cycle:");
+    TEST_Report("  cell voltages", &voltages);
+    TEST_Report("  temperature channels", &temperatures);
+#endif
+
+    /* multi-rate schedule */
+    TEST_Simulate(&test_configMultiRate, &test_stepsLtc, &voltages, &temperatures, &openWire);
+    TEST_ASSERT_GREATER_THAN_UINT32(voltageSamplesEveryCycle, voltages.numberOfSamples);
+    TEST_ASSERT_EQUAL_UINT32((voltages.numberOfSamples + 3u) / 4u, temperatures.numberOfSamples);
+    TEST_AssertNumberOfOpenWireChecks(test_configMultiRate.openWirePeriod_ms, longestCycle_ms, &openWire);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(
+        test_configMultiRate.openWirePeriod_ms + longestCycle_ms, openWire.worstStaleness_ms);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(longestCycle_ms, voltages.worstStaleness_ms);
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+    TEST_MESSAGE("multi-rate schedule (temperatures every 4th cycle, open-wire check every 10s):");
+    TEST_Report("  cell voltages", &voltages);
+    TEST_Report("  temperature channels", &temperatures);
+    TEST_Report("  open-wire checks", &openWire);
+#endif
+
+    /* multi-rate schedule while boosted */
+    AFE_ScheduleRequestBoost(true);
+    TEST_Simulate(&test_configMultiRate, &test_stepsLtc, &voltages, &temperatures, &openWire);
+    TEST_ASSERT_EQUAL_UINT32(voltages.numberOfSamples, temperatures.numberOfSamples);
+    TEST_AssertNumberOfOpenWireChecks(test_configMultiRate.openWirePeriodBoost_ms, longestCycle_ms, &openWire);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(
+        test_configMultiRate.openWirePeriodBoost_ms + longestCycle_ms, openWire.worstStaleness_ms);
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+    TEST_MESSAGE("multi-rate schedule boosted (temperatures every cycle, open-wire check every 2s):");
+    TEST_Report("  cell voltages", &voltages);
+    TEST_Report("  temperature channels", &temperatures);
+    TEST_Report("  open-wire checks", &openWire);
+#endif
+}
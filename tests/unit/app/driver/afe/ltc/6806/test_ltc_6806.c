@@ -43,7 +43,7 @@
  * @file    test_ltc_6806.c
  * @author  foxBMS Team
  * @date    2020-07-13 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -68,6 +68,7 @@
 
 #include "ltc_6806_cfg.h"
 
+#include "foxmath.h"
 #include "ltc.h"
 #include "spi_cfg-helper.h"
 
@@ -85,6 +86,7 @@ TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/common/config")
 TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/dma")
+TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
 TEST_INCLUDE_PATH("../../src/app/driver/io")
 TEST_INCLUDE_PATH("../../src/app/driver/pex")
 TEST_INCLUDE_PATH("../../src/app/driver/spi")
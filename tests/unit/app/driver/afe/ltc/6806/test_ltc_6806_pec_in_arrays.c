@@ -43,7 +43,7 @@
  * @file    test_ltc_6806_pec_in_arrays.c
  * @author  foxBMS Team
  * @date    2020-12-16 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -66,6 +66,7 @@
 #include "Mockpex.h"
 #include "Mockspi.h"
 
+#include "foxmath.h"
 #include "ltc.h"
 #include "ltc_pec.h"
 #include "test_pec_helper.h"
@@ -81,6 +82,7 @@ TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/common/config")
 TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/dma")
+TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
 TEST_INCLUDE_PATH("../../src/app/driver/io")
 TEST_INCLUDE_PATH("../../src/app/driver/pex")
 TEST_INCLUDE_PATH("../../src/app/driver/spi")
@@ -43,7 +43,7 @@
  * @file    test_ltc_6813-1.c
  * @author  foxBMS Team
  * @date    2020-03-30 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -54,12 +54,15 @@
 
 /*========== Includes =======================================================*/
 #include "unity.h"
+#include "Mockafe_pipeline.h"
 #include "Mockafe_plausibility.h"
+#include "Mockafe_schedule.h"
 #include "Mockdatabase.h"
 #include "Mockdiag.h"
 #include "Mockdma.h"
 #include "Mockfassert.h"
 #include "Mockio.h"
+#include "Mockltc_6813-1_frames.h"
 #include "Mockltc_afe_dma.h"
 #include "Mockltc_pec.h"
 #include "Mockos.h"
@@ -69,6 +72,7 @@
 
 #include "ltc_6813-1_cfg.h"
 
+#include "foxmath.h"
 #include "ltc.h"
 
 #include <stdbool.h>
@@ -78,6 +82,7 @@
 TEST_SOURCE_FILE("ltc_6813-1.c")
 
 TEST_INCLUDE_PATH("../../src/app/driver/afe/api")
+TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/6813-1")
 TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/6813-1/config")
 TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/common")
 TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/common")
@@ -85,6 +90,7 @@ TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/common/config")
 TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/dma")
+TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
 TEST_INCLUDE_PATH("../../src/app/driver/io")
 TEST_INCLUDE_PATH("../../src/app/driver/pex")
 TEST_INCLUDE_PATH("../../src/app/driver/spi")
@@ -92,6 +98,9 @@ TEST_INCLUDE_PATH("../../src/app/driver/ts/api")
 TEST_INCLUDE_PATH("../../src/app/engine/diag")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
+/* rates of the multi-rate measurement schedule, the module is mocked */
+const AFE_SCHEDULE_CONFIG_s afe_scheduleConfig = {0};
+
 /* SPI data configuration struct for LTC communication */
 static spiDAT1_t spi_kLtcDataConfig = {
     /* struct is implemented in the TI HAL and uses uppercase true and false */
@@ -111,6 +120,112 @@ SPI_INTERFACE_CONFIG_s spi_ltcInterface[BS_NR_OF_STRINGS] = {
     },
 };
 
+/** getter of a predefined command of the driver */
+typedef void (*TEST_GET_COMMAND_f)(uint8_t data[4]);
+
+/** command transmitted with SPI_TransmitData */
+static uint16_t test_transmittedCommand[4u] = {0u};
+/** number of calls of SPI_TransmitData */
+static uint8_t test_numberOfTransmittedCommands = 0u;
+
+static STD_RETURN_TYPE_e TEST_SPI_TransmitDataStub(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint16 *pTxBuff,
+    uint32 frameLength,
+    int cmock_num_calls) {
+    (void)pSpiInterface;
+    (void)cmock_num_calls;
+    TEST_ASSERT_EQUAL_UINT32(4u, frameLength);
+    for (uint8_t i = 0u; i < 4u; i++) {
+        test_transmittedCommand[i] = pTxBuff[i];
+    }
+    test_numberOfTransmittedCommands++;
+    return STD_OK;
+}
+
+/** ADCV command that the driver selected with if-else chains before the command tables */
+static TEST_GET_COMMAND_f TEST_GetExpectedVoltageCommand(LTC_ADCMODE_e adcMode, LTC_ADCMEAS_CHAN_e adcMeasCh) {
+    TEST_GET_COMMAND_f getCommand = NULL_PTR;
+    if (adcMeasCh == LTC_ADCMEAS_ALLCHANNEL_CELLS) {
+        if (adcMode == LTC_ADCMODE_FAST_DCP0) {
+            getCommand = TEST_LTC_Get_ltc_cmdADCV_fast_DCP0;
+        } else if (adcMode == LTC_ADCMODE_NORMAL_DCP0) {
+            getCommand = TEST_LTC_Get_ltc_cmdADCV_normal_DCP0;
+        } else if (adcMode == LTC_ADCMODE_FILTERED_DCP0) {
+            getCommand = TEST_LTC_Get_ltc_cmdADCV_filtered_DCP0;
+        } else if (adcMode == LTC_ADCMODE_FAST_DCP1) {
+            getCommand = TEST_LTC_Get_ltc_cmdADCV_fast_DCP1;
+        } else if (adcMode == LTC_ADCMODE_NORMAL_DCP1) {
+            getCommand = TEST_LTC_Get_ltc_cmdADCV_normal_DCP1;
+        } else if (adcMode == LTC_ADCMODE_FILTERED_DCP1) {
+            getCommand = TEST_LTC_Get_ltc_cmdADCV_filtered_DCP1;
+        }
+    } else if ((adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_TWOCELLS) && (adcMode == LTC_ADCMODE_FAST_DCP0)) {
+        getCommand = TEST_LTC_Get_ltc_cmdADCV_fast_DCP0_twocells;
+    }
+    return getCommand;
+}
+
+/** ADAX command that the driver selected with if-else chains before the command tables */
+static TEST_GET_COMMAND_f TEST_GetExpectedGpioCommand(LTC_ADCMODE_e adcMode, LTC_ADCMEAS_CHAN_e adcMeasCh) {
+    const bool fast               = (adcMode == LTC_ADCMODE_FAST_DCP0) || (adcMode == LTC_ADCMODE_FAST_DCP1);
+    const bool filtered           = (adcMode == LTC_ADCMODE_FILTERED_DCP0) || (adcMode == LTC_ADCMODE_FILTERED_DCP1);
+    TEST_GET_COMMAND_f getCommand = NULL_PTR;
+    if (adcMeasCh == LTC_ADCMEAS_ALLCHANNEL_GPIOS) {
+        getCommand = fast ? TEST_LTC_Get_ltc_cmdADAX_fast_ALLGPIOS : TEST_LTC_Get_ltc_cmdADAX_normal_ALLGPIOS;
+        if (filtered == true) {
+            getCommand = TEST_LTC_Get_ltc_cmdADAX_filtered_ALLGPIOS;
+        }
+    } else if (adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_GPIO1) {
+        getCommand = fast ? TEST_LTC_Get_ltc_cmdADAX_fast_GPIO1 : TEST_LTC_Get_ltc_cmdADAX_normal_GPIO1;
+        if (filtered == true) {
+            getCommand = TEST_LTC_Get_ltc_cmdADAX_filtered_GPIO1;
+        }
+    } else if (adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_GPIO2) {
+        getCommand = fast ? TEST_LTC_Get_ltc_cmdADAX_fast_GPIO2 : TEST_LTC_Get_ltc_cmdADAX_normal_GPIO2;
+        if (filtered == true) {
+            getCommand = TEST_LTC_Get_ltc_cmdADAX_filtered_GPIO2;
+        }
+    } else if (adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_GPIO3) {
+        getCommand = fast ? TEST_LTC_Get_ltc_cmdADAX_fast_GPIO3 : TEST_LTC_Get_ltc_cmdADAX_normal_GPIO3;
+        if (filtered == true) {
+            getCommand = TEST_LTC_Get_ltc_cmdADAX_filtered_GPIO3;
+        }
+    }
+    return getCommand;
+}
+
+/** checks that a start function transmits the expected command, or nothing if there is none */
+static void TEST_AssertStartCommand(
+    STD_RETURN_TYPE_e (*startMeasurement)(SPI_INTERFACE_CONFIG_s *, LTC_ADCMODE_e, LTC_ADCMEAS_CHAN_e),
+    TEST_GET_COMMAND_f (*getExpectedCommand)(LTC_ADCMODE_e, LTC_ADCMEAS_CHAN_e)) {
+    SPI_TransmitData_Stub(TEST_SPI_TransmitDataStub);
+    for (uint8_t adcMode = 0u; adcMode < (uint8_t)LTC_ADCMODE_E_MAX; adcMode++) {
+        for (uint8_t adcMeasCh = 0u; adcMeasCh < (uint8_t)LTC_ADCMEAS_E_MAX; adcMeasCh++) {
+            const TEST_GET_COMMAND_f getCommand =
+                getExpectedCommand((LTC_ADCMODE_e)adcMode, (LTC_ADCMEAS_CHAN_e)adcMeasCh);
+            test_numberOfTransmittedCommands = 0u;
+            if (getCommand != NULL_PTR) {
+                SPI_TransmitDummyByte_ExpectAndReturn(spi_ltcInterface, LTC_SPI_WAKEUP_WAIT_TIME_US, STD_OK);
+            }
+            const STD_RETURN_TYPE_e retVal =
+                startMeasurement(spi_ltcInterface, (LTC_ADCMODE_e)adcMode, (LTC_ADCMEAS_CHAN_e)adcMeasCh);
+            if (getCommand != NULL_PTR) {
+                uint8_t expected[4u] = {0u};
+                getCommand(expected);
+                TEST_ASSERT_EQUAL(STD_OK, retVal);
+                TEST_ASSERT_EQUAL_UINT8(1u, test_numberOfTransmittedCommands);
+                for (uint8_t i = 0u; i < 4u; i++) {
+                    TEST_ASSERT_EQUAL_HEX16(expected[i], test_transmittedCommand[i]);
+                }
+            } else {
+                TEST_ASSERT_EQUAL(STD_NOT_OK, retVal);
+                TEST_ASSERT_EQUAL_UINT8(0u, test_numberOfTransmittedCommands);
+            }
+        }
+    }
+}
+
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
 }
@@ -153,3 +268,11 @@ void testLTC_ConvertMuxVoltagesToTemperatures(void) {
     x = LTC_ConvertMuxVoltagesToTemperatures(11);
     TEST_ASSERT_EQUAL_INT16(11, x);
 }
+
+void testLTC_StartVoltageMeasurementSelectsCommand(void) {
+    TEST_AssertStartCommand(TEST_LTC_StartVoltageMeasurement, TEST_GetExpectedVoltageCommand);
+}
+
+void testLTC_StartGpioMeasurementSelectsCommand(void) {
+    TEST_AssertStartCommand(TEST_LTC_StartGpioMeasurement, TEST_GetExpectedGpioCommand);
+}
@@ -0,0 +1,288 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_ltc_6813-1_frames.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Test of the prebuilt frames and timing tables of the LTC driver
+ * @details The prebuilt frames are compared with the frames that the driver
+ *          assembled at runtime (LTC_SetMuxChCommand and the PEC calculation
+ *          in LTC_WriteRegister), which are kept as reference in this test.
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+
+#include "ltc_6813-1_cfg.h"
+#include "ltc_cfg.h"
+
+#include "fstd_types.h"
+#include "ltc_6813-1_frames.h"
+#include "ltc_pec.h"
+#include "test_assert_helper.h"
+
+#include <stdint.h>
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#include <time.h>
+#endif
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("ltc_6813-1_frames.c")
+TEST_SOURCE_FILE("ltc_pec.c")
+
+TEST_INCLUDE_PATH("../../src/app/driver/afe/api")
+TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/6813-1")
+TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/6813-1/config")
+TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/common")
+TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/common/config")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/dma")
+TEST_INCLUDE_PATH("../../src/app/driver/io")
+TEST_INCLUDE_PATH("../../src/app/driver/spi")
+TEST_INCLUDE_PATH("../../src/app/engine/diag")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+/** number of repetitions of the host time measurement */
+#define TEST_NUMBER_OF_REPETITIONS (10000u)
+#endif
+
+/** LTC COMM definitions of the driver */
+#define TEST_ICOM_START            (0x60u)
+#define TEST_ICOM_BLANK            (0x00u)
+#define TEST_ICOM_NO_TRANSMIT      (0x70u)
+#define TEST_FCOM_MASTER_NACK      (0x08u)
+#define TEST_FCOM_MASTER_NACK_STOP (0x09u)
+
+/** number of PEC calculations of the reference implementation */
+static uint32_t test_numberOfPecCalculations = 0u;
+
+/** runtime assembly of the multiplexer frames (former LTC_SetMuxChCommand and PEC loop of LTC_WriteRegister) */
+static void TEST_ReferenceSetMuxChannel(uint16_t *pTxBuff, uint8_t mux, uint8_t channel) {
+    for (uint16_t i = 0; i < LTC_N_LTC; i++) {
+#if SLAVE_BOARD_VERSION == 2u
+        uint8_t address = 0x98u | ((mux % 4u) << 1u);
+        uint8_t data    = 1u << (channel % 8u);
+#else
+        uint8_t address = 0x90u | ((mux % 4u) << 1u);
+        uint8_t data    = 0x08u | (channel % 8u);
+#endif
+        if (channel == 0xFFu) {
+            data = 0x00;
+        }
+        pTxBuff[4u + (i * 8u)] = TEST_ICOM_START | ((address >> 4u) & 0x0Fu);
+        pTxBuff[5u + (i * 8u)] = TEST_FCOM_MASTER_NACK | ((address << 4u) & 0xF0u);
+        pTxBuff[6u + (i * 8u)] = TEST_ICOM_BLANK | ((data >> 4u) & 0x0Fu);
+        pTxBuff[7u + (i * 8u)] = TEST_FCOM_MASTER_NACK_STOP | ((data << 4u) & 0xF0u);
+        pTxBuff[8u + (i * 8u)] = TEST_ICOM_NO_TRANSMIT;
+        pTxBuff[9u + (i * 8u)] = 0x00;
+    }
+    uint8_t PEC_Check[LTC_DATA_SIZE_IN_BYTES] = {0};
+    for (uint16_t i = 0u; i < LTC_N_LTC; i++) {
+        for (uint8_t byte = 0u; byte < LTC_DATA_SIZE_IN_BYTES; byte++) {
+            PEC_Check[byte] = (uint8_t)pTxBuff[4u + (i * 8u) + byte];
+        }
+        const uint16_t PEC_result = LTC_CalculatePec15(LTC_DATA_SIZE_IN_BYTES, PEC_Check);
+        test_numberOfPecCalculations++;
+        pTxBuff[10u + (i * 8u)] = (PEC_result >> 8u) & 0xFFu;
+        pTxBuff[11u + (i * 8u)] = PEC_result & 0xFFu;
+    }
+}
+
+/** runtime selection of the conversion time (former LTC_GetMeasurementTimeCycle) */
+static uint16_t TEST_ReferenceGetMeasurementTime(LTC_ADCMODE_e adcMode, LTC_ADCMEAS_CHAN_e adcMeasCh) {
+    uint16_t retVal = LTC_ADCMEAS_UNDEFINED; /* default */
+
+    if (adcMeasCh == LTC_ADCMEAS_ALLCHANNEL_CELLS) {
+        if ((adcMode == LTC_ADCMODE_FAST_DCP0) || (adcMode == LTC_ADCMODE_FAST_DCP1)) {
+            retVal = LTC_STATEMACH_MEAS_ALL_CELLS_FAST_TCYCLE;
+        } else if ((adcMode == LTC_ADCMODE_NORMAL_DCP0) || (adcMode == LTC_ADCMODE_NORMAL_DCP1)) {
+            retVal = LTC_STATEMACH_MEAS_ALL_CELLS_NORMAL_TCYCLE;
+        } else if ((adcMode == LTC_ADCMODE_FILTERED_DCP0) || (adcMode == LTC_ADCMODE_FILTERED_DCP1)) {
+            retVal = LTC_STATEMACH_MEAS_ALL_CELLS_FILTERED_TCYCLE;
+        }
+    } else if (adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_TWOCELLS) {
+        if ((adcMode == LTC_ADCMODE_FAST_DCP0) || (adcMode == LTC_ADCMODE_FAST_DCP1)) {
+            retVal = LTC_STATEMACH_MEAS_TWO_CELLS_FAST_TCYCLE;
+        } else if ((adcMode == LTC_ADCMODE_NORMAL_DCP0) || (adcMode == LTC_ADCMODE_NORMAL_DCP1)) {
+            retVal = LTC_STATEMACH_MEAS_TWO_CELLS_NORMAL_TCYCLE;
+        } else if ((adcMode == LTC_ADCMODE_FILTERED_DCP0) || (adcMode == LTC_ADCMODE_FILTERED_DCP1)) {
+            retVal = LTC_STATEMACH_MEAS_TWO_CELLS_FILTERED_TCYCLE;
+        }
+    } else if (adcMeasCh == LTC_ADCMEAS_ALLCHANNEL_GPIOS) {
+        if ((adcMode == LTC_ADCMODE_FAST_DCP0) || (adcMode == LTC_ADCMODE_FAST_DCP1)) {
+            retVal = LTC_STATEMACH_MEAS_ALL_GPIOS_FAST_TCYCLE;
+        } else if ((adcMode == LTC_ADCMODE_NORMAL_DCP0) || (adcMode == LTC_ADCMODE_NORMAL_DCP1)) {
+            retVal = LTC_STATEMACH_MEAS_ALL_GPIOS_NORMAL_TCYCLE;
+        } else if ((adcMode == LTC_ADCMODE_FILTERED_DCP0) || (adcMode == LTC_ADCMODE_FILTERED_DCP1)) {
+            retVal = LTC_STATEMACH_MEAS_ALL_GPIOS_FILTERED_TCYCLE;
+        }
+    } else if (
+        (adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_GPIO1) || (adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_GPIO2) ||
+        (adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_GPIO3) || (adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_GPIO4) ||
+        (adcMeasCh == LTC_ADCMEAS_SINGLECHANNEL_GPIO5)) {
+        if ((adcMode == LTC_ADCMODE_FAST_DCP0) || (adcMode == LTC_ADCMODE_FAST_DCP1)) {
+            retVal = LTC_STATEMACH_MEAS_SINGLE_GPIO_FAST_TCYCLE;
+        } else if ((adcMode == LTC_ADCMODE_NORMAL_DCP0) || (adcMode == LTC_ADCMODE_NORMAL_DCP1)) {
+            retVal = LTC_STATEMACH_MEAS_SINGLE_GPIO_NORMAL_TCYCLE;
+        } else if ((adcMode == LTC_ADCMODE_FILTERED_DCP0) || (adcMode == LTC_ADCMODE_FILTERED_DCP1)) {
+            retVal = LTC_STATEMACH_MEAS_SINGLE_GPIO_FILTERED_TCYCLE;
+        }
+    } else {
+        retVal = LTC_ADCMEAS_UNDEFINED;
+    }
+
+    return retVal;
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    test_numberOfPecCalculations = 0u;
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testPecOfMuxFramesIsCorrect(void) {
+    const uint8_t channels[] = {0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, LTC_MUX_CHANNEL_DISABLED};
+    for (uint8_t mux = 0u; mux < LTC_NUMBER_OF_MUX_ADDRESSES; mux++) {
+        for (uint8_t i = 0u; i < (sizeof(channels) / sizeof(channels[0])); i++) {
+            const uint8_t *pFrame = TEST_LTC_GetMuxFrame(mux, channels[i]);
+            const uint16_t pec    = LTC_CalculatePec15(LTC_DATA_SIZE_IN_BYTES, pFrame);
+            TEST_ASSERT_EQUAL_HEX8((pec >> 8u) & 0xFFu, pFrame[LTC_DATA_SIZE_IN_BYTES]);
+            TEST_ASSERT_EQUAL_HEX8(pec & 0xFFu, pFrame[LTC_DATA_SIZE_IN_BYTES + 1u]);
+        }
+    }
+}
+
+void testMuxFramesAreIdenticalToRuntimeAssembly(void) {
+    /* all multiplexer IDs and channels, including values that are reduced by the modulo */
+    for (uint16_t mux = 0u; mux <= UINT8_MAX; mux++) {
+        for (uint16_t channel = 0u; channel <= UINT8_MAX; channel++) {
+            uint16_t reference[LTC_N_BYTES_FOR_DATA_TRANSMISSION] = {0u};
+            uint16_t prebuilt[LTC_N_BYTES_FOR_DATA_TRANSMISSION]  = {0u};
+            TEST_ReferenceSetMuxChannel(reference, (uint8_t)mux, (uint8_t)channel);
+            LTC_SetMuxChannelFrames(prebuilt, (uint8_t)mux, (uint8_t)channel);
+            TEST_ASSERT_EQUAL_HEX16_ARRAY(reference, prebuilt, LTC_N_BYTES_FOR_DATA_TRANSMISSION);
+        }
+    }
+}
+
+void testSetMuxChannelFramesInvalidInput(void) {
+    TEST_ASSERT_FAIL_ASSERT(LTC_SetMuxChannelFrames(NULL_PTR, 0u, 0u));
+}
+
+void testMeasurementTimeIsIdenticalToRuntimeSelection(void) {
+    for (uint8_t adcMode = 0u; adcMode <= LTC_ADCMODE_E_MAX; adcMode++) {
+        for (uint8_t adcMeasCh = 0u; adcMeasCh <= LTC_ADCMEAS_E_MAX; adcMeasCh++) {
+            TEST_ASSERT_EQUAL_UINT16(
+                TEST_ReferenceGetMeasurementTime((LTC_ADCMODE_e)adcMode, (LTC_ADCMEAS_CHAN_e)adcMeasCh),
+                LTC_GetMeasurementTime((LTC_ADCMODE_e)adcMode, (LTC_ADCMEAS_CHAN_e)adcMeasCh));
+        }
+    }
+}
+
+void testMuxFramesPecCalculationsPerMeasurementCycle(void) {
+    /* Counts the work of the multiplexer configuration in one measurement
+     * cycle (LTC_NUMBER_OF_MUX_MEASUREMENTS_PER_CYCLE frames to all LTCs). */
+    static uint16_t txBuffer[LTC_N_BYTES_FOR_DATA_TRANSMISSION] = {0u};
+
+    for (uint8_t step = 0u; step < LTC_NUMBER_OF_MUX_MEASUREMENTS_PER_CYCLE; step++) {
+        TEST_ReferenceSetMuxChannel(txBuffer, 0u, step);
+    }
+    /* the runtime assembly calculates one PEC per LTC and frame */
+    TEST_ASSERT_EQUAL_UINT32(LTC_NUMBER_OF_MUX_MEASUREMENTS_PER_CYCLE * LTC_N_LTC, test_numberOfPecCalculations);
+
+    test_numberOfPecCalculations = 0u;
+    for (uint8_t step = 0u; step < LTC_NUMBER_OF_MUX_MEASUREMENTS_PER_CYCLE; step++) {
+        LTC_SetMuxChannelFrames(txBuffer, 0u, step);
+    }
+    /* the prebuilt frames do not calculate any PEC */
+    TEST_ASSERT_EQUAL_UINT32(0u, test_numberOfPecCalculations);
+}
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+void testMuxFramesCpuWorkPerMeasurementCycle(void) {
+    /* Reports the work of the multiplexer configuration in one measurement
+     * cycle (LTC_NUMBER_OF_MUX_MEASUREMENTS_PER_CYCLE frames to all LTCs).
+     * The timing on the host is only reported. */
+    static uint16_t txBuffer[LTC_N_BYTES_FOR_DATA_TRANSMISSION] = {0u};
+
+    const clock_t referenceStart = clock();
+    for (uint32_t repetition = 0u; repetition < TEST_NUMBER_OF_REPETITIONS; repetition++) {
+        for (uint8_t step = 0u; step < LTC_NUMBER_OF_MUX_MEASUREMENTS_PER_CYCLE; step++) {
+            TEST_ReferenceSetMuxChannel(txBuffer, 0u, step);
+        }
+    }
+    const clock_t referenceTicks = clock() - referenceStart;
+    const uint32_t pecPerCycle   = test_numberOfPecCalculations / TEST_NUMBER_OF_REPETITIONS;
+
+    const clock_t prebuiltStart = clock();
+    for (uint32_t repetition = 0u; repetition < TEST_NUMBER_OF_REPETITIONS; repetition++) {
+        for (uint8_t step = 0u; step < LTC_NUMBER_OF_MUX_MEASUREMENTS_PER_CYCLE; step++) {
+            LTC_SetMuxChannelFrames(txBuffer, 0u, step);
+        }
+    }
+    const clock_t prebuiltTicks = clock() - prebuiltStart;
+
+    char message[200] = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "per cycle (%u LTCs): %u PEC calculations over %u bytes (runtime assembly) vs. 0 (prebuilt frames); "
+        "host time %ld vs. %ld clock ticks",
+        (unsigned int)LTC_N_LTC,
+        (unsigned int)pecPerCycle,
+        (unsigned int)(pecPerCycle * LTC_DATA_SIZE_IN_BYTES),
+        (long)referenceTicks,
+        (long)prebuiltTicks);
+    TEST_MESSAGE(message);
+}
+#endif
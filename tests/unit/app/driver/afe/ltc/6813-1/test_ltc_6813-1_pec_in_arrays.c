@@ -43,7 +43,7 @@
  * @file    test_ltc_6813-1_pec_in_arrays.c
  * @author  foxBMS Team
  * @date    2020-03-30 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -54,12 +54,15 @@
 
 /*========== Includes =======================================================*/
 #include "unity.h"
+#include "Mockafe_pipeline.h"
 #include "Mockafe_plausibility.h"
+#include "Mockafe_schedule.h"
 #include "Mockdatabase.h"
 #include "Mockdiag.h"
 #include "Mockdma.h"
 #include "Mockfassert.h"
 #include "Mockio.h"
+#include "Mockltc_6813-1_frames.h"
 #include "Mockltc_afe_dma.h"
 #include "Mockos.h"
 #include "Mockpex.h"
@@ -68,6 +71,7 @@
 
 #include "ltc_6813-1_cfg.h"
 
+#include "foxmath.h"
 #include "ltc.h"
 #include "ltc_pec.h"
 #include "test_pec_helper.h"
@@ -76,6 +80,7 @@
 TEST_SOURCE_FILE("ltc_6813-1.c")
 
 TEST_INCLUDE_PATH("../../src/app/driver/afe/api")
+TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/6813-1")
 TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/6813-1/config")
 TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/common")
 TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/common")
@@ -83,6 +88,7 @@ TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/common/config")
 TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/dma")
+TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
 TEST_INCLUDE_PATH("../../src/app/driver/io")
 TEST_INCLUDE_PATH("../../src/app/driver/pex")
 TEST_INCLUDE_PATH("../../src/app/driver/spi")
@@ -90,6 +96,9 @@ TEST_INCLUDE_PATH("../../src/app/driver/ts/api")
 TEST_INCLUDE_PATH("../../src/app/engine/diag")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
+/* rates of the multi-rate measurement schedule, the module is mocked */
+const AFE_SCHEDULE_CONFIG_s afe_scheduleConfig = {0};
+
 /* SPI data configuration struct for LTC communication */
 static spiDAT1_t spi_kLtcDataConfig = {
     /* struct is implemented in the TI HAL and uses uppercase true and false */
@@ -43,7 +43,7 @@
  * @file    test_ltc_afe_dma.c
  * @author  foxBMS Team
  * @date    2020-06-10 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -58,12 +58,14 @@
 #include "Mockfassert.h"
 #include "Mockio.h"
 #include "Mockltc.h"
+#include "Mockos.h"
 #include "Mockspi.h"
 
 #include "ltc_cfg.h"
 #include "spi_cfg.h"
 
 #include "ltc_afe_dma.h"
+#include "test_assert_helper.h"
 
 #include <stdbool.h>
 #include <stdint.h>
@@ -76,7 +78,10 @@ TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/common")
 TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/common/config")
 TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/io")
+TEST_INCLUDE_PATH("../../src/app/driver/rtc")
 TEST_INCLUDE_PATH("../../src/app/driver/spi")
+TEST_INCLUDE_PATH("../../src/app/task/config")
+TEST_INCLUDE_PATH("../../src/app/task/ftask")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
 uint8_t ltc_RXPECbuffer[LTC_N_BYTES_FOR_DATA_TRANSMISSION] = {0};
@@ -167,8 +172,48 @@ g_dmaCTRL afe_ltcDmaControlPacketRx = {
     .AUTOINIT  = AUTOINIT_OFF,                      /* autoinit                   */
 };
 
+/** simulated time of the operating system */
+static uint32_t test_time_ms = 0u;
+/** time after which the simulated DMA transfer finishes, UINT32_MAX if no transfer is ongoing */
+static uint32_t test_transferDuration_ms = UINT32_MAX;
+/** value that is notified at the end of the simulated wait */
+static uint32_t test_notifiedValue = 0u;
+
+static uint32_t TEST_OS_GetTickCount(int numCalls) {
+    (void)numCalls;
+    return test_time_ms;
+}
+
+static OS_STD_RETURN_e TEST_OS_WaitForNotification(uint32_t *pNotifiedValue, uint32_t timeout, int numCalls) {
+    (void)numCalls;
+    OS_STD_RETURN_e retVal = OS_FAIL;
+    if (test_transferDuration_ms <= timeout) {
+        /* the transfer finishes and the DMA callback notifies the task */
+        test_time_ms                  += test_transferDuration_ms;
+        test_transferDuration_ms       = UINT32_MAX;
+        ltc_stateBase.transmit_ongoing = false;
+        *pNotifiedValue                = LTC_DMA_SPI_FINISHED_NOTIFICATION_VALUE;
+        retVal                         = OS_SUCCESS;
+    } else {
+        test_time_ms += timeout;
+        *pNotifiedValue = test_notifiedValue;
+        if (test_notifiedValue != 0u) {
+            retVal = OS_SUCCESS;
+        }
+    }
+    return retVal;
+}
+
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    test_time_ms             = 1000u;
+    test_transferDuration_ms = UINT32_MAX;
+    test_notifiedValue       = 0u;
+    OS_GetTickCount_Stub(TEST_OS_GetTickCount);
+    OS_WaitForNotification_Stub(TEST_OS_WaitForNotification);
+    ltc_stateBase.timer            = 0u;
+    ltc_stateBase.check_spi_flag   = STD_NOT_OK;
+    ltc_stateBase.transmit_ongoing = false;
 }
 
 void tearDown(void) {
@@ -178,3 +223,49 @@ void tearDown(void) {
 
 void testDummy(void) {
 }
+
+void testAFE_WaitForNextStepInvalidInput(void) {
+    TEST_ASSERT_FAIL_ASSERT(AFE_WaitForNextStep(NULL_PTR));
+}
+
+void testAFE_WaitForNextStepConversionIsTimedWait(void) {
+    /* waiting for a conversion: the full time has to elapse */
+    ltc_stateBase.timer = 5u;
+    AFE_WaitForNextStep(&ltc_stateBase);
+    TEST_ASSERT_EQUAL_UINT32(1005u, test_time_ms);
+    TEST_ASSERT_EQUAL_UINT16(0u, ltc_stateBase.timer);
+}
+
+void testAFE_WaitForNextStepNotificationDoesNotShortenConversion(void) {
+    /* the notification of a conversion command must not shorten the conversion time */
+    ltc_stateBase.timer      = 3u;
+    test_transferDuration_ms = 1u;
+    AFE_WaitForNextStep(&ltc_stateBase);
+    TEST_ASSERT_EQUAL_UINT32(1003u, test_time_ms);
+}
+
+void testAFE_WaitForNextStepReturnsWhenTransferFinishes(void) {
+    ltc_stateBase.timer            = 13u;
+    ltc_stateBase.check_spi_flag   = STD_OK;
+    ltc_stateBase.transmit_ongoing = true;
+    test_transferDuration_ms       = 2u;
+    AFE_WaitForNextStep(&ltc_stateBase);
+    TEST_ASSERT_EQUAL_UINT32(1002u, test_time_ms);
+    TEST_ASSERT_EQUAL_UINT16(0u, ltc_stateBase.timer);
+}
+
+void testAFE_WaitForNextStepTransferTimeout(void) {
+    /* the transfer does not finish: return after the timeout of the state machine */
+    ltc_stateBase.timer            = 13u;
+    ltc_stateBase.check_spi_flag   = STD_OK;
+    ltc_stateBase.transmit_ongoing = true;
+    AFE_WaitForNextStep(&ltc_stateBase);
+    TEST_ASSERT_EQUAL_UINT32(1013u, test_time_ms);
+    TEST_ASSERT_TRUE(ltc_stateBase.transmit_ongoing);
+}
+
+void testAFE_WaitForNextStepWaitsAtLeastMinimumTime(void) {
+    /* no timer and no transfer: the AFE task has to give way to other tasks */
+    AFE_WaitForNextStep(&ltc_stateBase);
+    TEST_ASSERT_EQUAL_UINT32(1000u + LTC_MINIMUM_WAIT_TIME_ms, test_time_ms);
+}
@@ -0,0 +1,279 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_ltc_afe_dma_cycle_time.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Simulation of the cell voltage measurement cycle of the LTC driver
+ * @details The test runs one cell voltage measurement cycle of a daisy-chain
+ *          (start conversion, read the six cell voltage registers, save the
+ *          values) on a simulated clock. The cycle time of the polled driver,
+ *          that advances once per 1ms tick, is compared to the cycle time of
+ *          the driver that advances on the DMA completion notification
+ *          (#AFE_WaitForNextStep).
+ *          The test is compiled with FOXBMS_AFE_DRIVER_TYPE_NO_FSM=1 (see
+ *          project configuration).
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "MockHL_sys_dma.h"
+#include "Mockfassert.h"
+#include "Mockio.h"
+#include "Mockltc.h"
+#include "Mockos.h"
+#include "Mockspi.h"
+
+#include "ltc_6813-1_cfg.h"
+#include "ltc_cfg.h"
+
+#include "ltc_afe_dma.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#endif
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("ltc_afe_dma.c")
+
+TEST_INCLUDE_PATH("../../src/app/driver/afe/api")
+TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/6813-1/config")
+TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/common")
+TEST_INCLUDE_PATH("../../src/app/driver/afe/ltc/common/config")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+TEST_INCLUDE_PATH("../../src/app/driver/io")
+TEST_INCLUDE_PATH("../../src/app/driver/rtc")
+TEST_INCLUDE_PATH("../../src/app/driver/spi")
+TEST_INCLUDE_PATH("../../src/app/task/config")
+TEST_INCLUDE_PATH("../../src/app/task/ftask")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** SPI clock of the daisy-chain in the simulation */
+#define TEST_SPI_CLOCK_kHz (1000u)
+/** duration of the transfer of one register of all ICs in the daisy-chain */
+#define TEST_REGISTER_TRANSFER_TIME_us ((LTC_N_BYTES_FOR_DATA_TRANSMISSION * 8u * 1000u) / TEST_SPI_CLOCK_kHz)
+/** number of cell voltage registers (A to F) */
+#define TEST_NUMBER_OF_CELL_VOLTAGE_REGISTERS (6u)
+/** number of steps of one cell voltage measurement cycle */
+#define TEST_NUMBER_OF_STEPS (TEST_NUMBER_OF_CELL_VOLTAGE_REGISTERS + 2u)
+
+/** one step of the state machine: the timer it sets and the transfer it waits for */
+typedef struct {
+    uint16_t timer;
+    STD_RETURN_TYPE_e checkSpiFlag;
+    uint32_t transferTime_us;
+} TEST_STEP_s;
+
+uint8_t ltc_RXPECbuffer[LTC_N_BYTES_FOR_DATA_TRANSMISSION] = {0};
+uint8_t ltc_TXPECbuffer[LTC_N_BYTES_FOR_DATA_TRANSMISSION] = {0};
+
+OS_TASK_HANDLE ftsk_taskHandleAfe;
+
+LTC_STATE_s ltc_stateBase = {
+    .timer                   = 0,
+    .commandDataTransferTime = 1,
+    .commandTransferTime     = 1,
+    .check_spi_flag          = STD_NOT_OK,
+    .transmit_ongoing        = false,
+};
+
+g_dmaCTRL afe_ltcDmaControlPacketTx = {0};
+g_dmaCTRL afe_ltcDmaControlPacketRx = {0};
+
+/** simulated time */
+static uint32_t test_time_us = 0u;
+/** simulated time at which the ongoing transfer finishes */
+static uint32_t test_transferEnd_us = 0u;
+/** value notified to the AFE task by the DMA callback */
+static uint32_t test_pendingNotification = 0u;
+
+static uint32_t TEST_OS_GetTickCount(int numCalls) {
+    (void)numCalls;
+    return test_time_us / 1000u;
+}
+
+static OS_STD_RETURN_e TEST_OS_NotifyFromIsr(TaskHandle_t taskToNotify, uint32_t notifiedValue, int numCalls) {
+    (void)taskToNotify;
+    (void)numCalls;
+    test_pendingNotification = notifiedValue;
+    return OS_SUCCESS;
+}
+
+static OS_STD_RETURN_e TEST_OS_WaitForNotification(uint32_t *pNotifiedValue, uint32_t timeout, int numCalls) {
+    (void)numCalls;
+    OS_STD_RETURN_e retVal = OS_FAIL;
+    if ((ltc_stateBase.transmit_ongoing == true) && (test_transferEnd_us <= (test_time_us + (timeout * 1000u)))) {
+        /* the transfer finishes while the task waits */
+        test_time_us = test_transferEnd_us;
+        AFE_DmaCallback(0u);
+    } else {
+        test_time_us += timeout * 1000u;
+    }
+    *pNotifiedValue = test_pendingNotification;
+    if (test_pendingNotification != 0u) {
+        retVal = OS_SUCCESS;
+    }
+    test_pendingNotification = 0u;
+    return retVal;
+}
+
+static void TEST_StartStep(const TEST_STEP_s *pStep) {
+    ltc_stateBase.timer            = pStep->timer;
+    ltc_stateBase.check_spi_flag   = pStep->checkSpiFlag;
+    ltc_stateBase.transmit_ongoing = (pStep->transferTime_us > 0u);
+    test_transferEnd_us            = test_time_us + pStep->transferTime_us;
+}
+
+/** mirrors the timer handling at the start of LTC_Trigger, that is called once per 1ms tick */
+static bool TEST_PolledStepContinues(void) {
+    bool continueFunction = true;
+    if ((ltc_stateBase.check_spi_flag == STD_NOT_OK) || (ltc_stateBase.transmit_ongoing == true)) {
+        if (ltc_stateBase.timer > 0u) {
+            if ((--ltc_stateBase.timer) > 0u) {
+                continueFunction = false;
+            }
+        }
+    }
+    return continueFunction;
+}
+
+static uint32_t TEST_RunPolledCycle(const TEST_STEP_s *pSteps) {
+    const uint32_t start_us = test_time_us;
+    for (uint8_t step = 0u; step < TEST_NUMBER_OF_STEPS; step++) {
+        TEST_StartStep(&pSteps[step]);
+        bool continueFunction = false;
+        while (continueFunction == false) {
+            test_time_us += 1000u;
+            if (test_time_us >= test_transferEnd_us) {
+                ltc_stateBase.transmit_ongoing = false;
+            }
+            continueFunction = TEST_PolledStepContinues();
+        }
+    }
+    return test_time_us - start_us;
+}
+
+static uint32_t TEST_RunEventDrivenCycle(const TEST_STEP_s *pSteps) {
+    const uint32_t start_us = test_time_us;
+    for (uint8_t step = 0u; step < TEST_NUMBER_OF_STEPS; step++) {
+        TEST_StartStep(&pSteps[step]);
+        AFE_WaitForNextStep(&ltc_stateBase);
+    }
+    return test_time_us - start_us;
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    test_time_us             = 0u;
+    test_transferEnd_us      = 0u;
+    test_pendingNotification = 0u;
+    OS_GetTickCount_Stub(TEST_OS_GetTickCount);
+    OS_NotifyFromIsr_Stub(TEST_OS_NotifyFromIsr);
+    OS_WaitForNotification_Stub(TEST_OS_WaitForNotification);
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testCellVoltageMeasurementCycleTime(void) {
+    TEST_STEP_s steps[TEST_NUMBER_OF_STEPS] = {0};
+    /* start of the conversion: the command is sent, then the conversion time elapses */
+    steps[0].timer           = ltc_stateBase.commandTransferTime + LTC_STATEMACH_MEAS_ALL_CELLS_NORMAL_TCYCLE;
+    steps[0].checkSpiFlag    = STD_NOT_OK;
+    steps[0].transferTime_us = TEST_REGISTER_TRANSFER_TIME_us;
+    /* read the cell voltage registers */
+    for (uint8_t i = 1u; i <= TEST_NUMBER_OF_CELL_VOLTAGE_REGISTERS; i++) {
+        steps[i].timer           = ltc_stateBase.commandDataTransferTime + LTC_TRANSMISSION_TIMEOUT;
+        steps[i].checkSpiFlag    = STD_OK;
+        steps[i].transferTime_us = TEST_REGISTER_TRANSFER_TIME_us;
+    }
+    /* save the values */
+    steps[TEST_NUMBER_OF_STEPS - 1u].timer        = LTC_STATEMACH_SHORTTIME;
+    steps[TEST_NUMBER_OF_STEPS - 1u].checkSpiFlag = STD_NOT_OK;
+
+    const uint32_t polledCycleTime_us      = TEST_RunPolledCycle(steps);
+    const uint32_t eventDrivenCycleTime_us = TEST_RunEventDrivenCycle(steps);
+
+    /* the conversion time is the lower bound of both drivers */
+    const uint32_t conversionTime_us = steps[0].timer * 1000u;
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(conversionTime_us, eventDrivenCycleTime_us);
+    /* the register reads do not wait for the next tick anymore; the notification of the conversion command
+     * wakes the task within the first tick of the conversion wait, the remaining wait is counted in full ticks */
+    TEST_ASSERT_EQUAL_UINT32(
+        conversionTime_us + ((TEST_NUMBER_OF_CELL_VOLTAGE_REGISTERS + 1u) * TEST_REGISTER_TRANSFER_TIME_us) +
+            (LTC_STATEMACH_SHORTTIME * 1000u),
+        eventDrivenCycleTime_us);
+    TEST_ASSERT_LESS_THAN_UINT32(polledCycleTime_us, eventDrivenCycleTime_us);
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+    char message[80] = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "cycle time: polled %uus, event-driven %uus",
+        (unsigned int)polledCycleTime_us,
+        (unsigned int)eventDrivenCycleTime_us);
+    TEST_MESSAGE(message);
+#endif
+}
+
+void testTransferTimeoutIsKeptByEventDrivenDriver(void) {
+    /* a transfer that never finishes must lead to the same timeout in both drivers */
+    TEST_STEP_s steps[TEST_NUMBER_OF_STEPS] = {0};
+    for (uint8_t i = 0u; i < TEST_NUMBER_OF_STEPS; i++) {
+        steps[i].timer           = ltc_stateBase.commandDataTransferTime + LTC_TRANSMISSION_TIMEOUT;
+        steps[i].checkSpiFlag    = STD_OK;
+        steps[i].transferTime_us = UINT32_MAX / 2u;
+    }
+    const uint32_t polledCycleTime_us      = TEST_RunPolledCycle(steps);
+    const uint32_t eventDrivenCycleTime_us = TEST_RunEventDrivenCycle(steps);
+    TEST_ASSERT_EQUAL_UINT32(polledCycleTime_us, eventDrivenCycleTime_us);
+}
@@ -43,7 +43,7 @@
  * @file    test_mxm_battery_management.c
  * @author  foxBMS Team
  * @date    2020-07-02 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  MXM
@@ -66,6 +66,11 @@
 
 #include "mxm_battery_management.h"
 
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#include <time.h>
+#endif
+
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_INCLUDE_PATH("../../src/app/driver/afe/api")
 TEST_INCLUDE_PATH("../../src/app/driver/afe/maxim/common")
@@ -75,9 +80,54 @@ TEST_INCLUDE_PATH("../../src/app/driver/spi")
 TEST_INCLUDE_PATH("../../src/app/engine/diag")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
+/** number of register addresses that can be addressed by a READALL command */
+#define TEST_NUMBER_OF_REGISTER_ADDRESSES (256u)
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+/** number of READALL commands that are prepared in one measurement cycle (benchmark) */
+#define TEST_READALL_COMMANDS_PER_CYCLE (40u)
+
+/** number of repetitions of the benchmark */
+#define TEST_NUMBER_OF_REPETITIONS (10000u)
+#endif
+
+/** number of calls of #MXM_CRC8() since the last reset */
+static uint32_t test_crc8CallCounter = 0u;
+
+/** deterministic replacement of the CRC that depends on every byte of the frame */
+static uint8_t TEST_Crc8(uint16_t *pData, int32_t lenData) {
+    uint8_t crc = 0xA5u;
+    for (int32_t i = 0; i < lenData; i++) {
+        crc = (uint8_t)(((uint32_t)crc << 1u) | ((uint32_t)crc >> 7u));
+        crc ^= (uint8_t)pData[i];
+    }
+    return crc;
+}
+
+/** stub for #MXM_CRC8() that counts the calls */
+static uint8_t TEST_MXM_CRC8Stub(uint16_t *pData, int32_t lenData, int cmock_num_calls) {
+    (void)cmock_num_calls;
+    test_crc8CallCounter++;
+    return TEST_Crc8(pData, lenData);
+}
+
+/** constructs a READALL frame the way it was done before the PEC bytes were precalculated */
+static void TEST_ReferenceConstructReadall(uint8_t regAddress, uint16_t *pFrame) {
+    for (uint8_t i = 0u; i < COMMAND_BUFFER_LENGTH; i++) {
+        pFrame[i] = 0u;
+    }
+    pFrame[0] = BATTERY_MANAGEMENT_READALL;
+    pFrame[1] = regAddress;
+    pFrame[2] = DATA_CHECK_BYTE_SEED;
+    pFrame[3] = TEST_Crc8(pFrame, 3);
+}
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    test_crc8CallCounter = 0u;
+    MXM_CRC8_Stub(TEST_MXM_CRC8Stub);
+    TEST_MXM_5XInitializeReadallPecTable();
+    test_crc8CallCounter = 0u;
 }
 
 void tearDown(void) {
@@ -87,3 +137,79 @@ void tearDown(void) {
 void testSelfCheckAddressSpaceChecker(void) {
     TEST_ASSERT_EQUAL(STD_OK, MXM_5XUserAccessibleAddressSpaceCheckerSelfCheck());
 }
+
+void testReadallPecTableIsCalculatedOnInitialization(void) {
+    MXM_5X_INSTANCE_s instance = {0};
+    MXM_5X_InitializeStateStruct(&instance);
+    /* the PEC is calculated once for every register address */
+    TEST_ASSERT_EQUAL_UINT32(TEST_NUMBER_OF_REGISTER_ADDRESSES, test_crc8CallCounter);
+
+    /* constructing the READALL command does not calculate the PEC anymore */
+    test_crc8CallCounter               = 0u;
+    instance.commandPayload.model      = MXM_MODEL_ID_MAX17852;
+    instance.commandPayload.regAddress = MXM_REG_VERSION;
+    TEST_ASSERT_EQUAL(STD_OK, TEST_MXM_5XConstructCommandBufferReadall(&instance));
+    TEST_ASSERT_EQUAL_UINT32(0u, test_crc8CallCounter);
+}
+
+void testReadallCommandFrameIsIdenticalToRuntimeCalculation(void) {
+    const MXM_MODEL_ID_e models[] = {MXM_MODEL_ID_MAX17852, MXM_MODEL_ID_MAX17853};
+    for (uint8_t m = 0u; m < (sizeof(models) / sizeof(models[0])); m++) {
+        for (uint16_t regAddress = 0u; regAddress < TEST_NUMBER_OF_REGISTER_ADDRESSES; regAddress++) {
+            MXM_5X_INSTANCE_s instance         = {0};
+            instance.commandPayload.model      = models[m];
+            instance.commandPayload.regAddress = (MXM_REG_NAME_e)regAddress;
+            if (TEST_MXM_5XConstructCommandBufferReadall(&instance) == STD_OK) {
+                uint16_t expectedFrame[COMMAND_BUFFER_LENGTH] = {0u};
+                TEST_ReferenceConstructReadall((uint8_t)regAddress, expectedFrame);
+                TEST_ASSERT_EQUAL_UINT8(BATTERY_MANAGEMENT_TX_LENGTH_READALL, instance.commandBufferCurrentLength);
+                TEST_ASSERT_EQUAL_UINT16_ARRAY(expectedFrame, instance.commandBuffer, COMMAND_BUFFER_LENGTH);
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(0u, test_crc8CallCounter);
+}
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+void testReadallCommandPreparationPerMeasurementCycle(void) {
+    /* host benchmark: the timing is only reported */
+    MXM_5X_INSTANCE_s instance                     = {0};
+    instance.commandPayload.model                  = MXM_MODEL_ID_MAX17852;
+    uint16_t referenceFrame[COMMAND_BUFFER_LENGTH] = {0u};
+    uint32_t checksumReference                     = 0u;
+    uint32_t checksumCached                        = 0u;
+
+    const clock_t startReference = clock();
+    for (uint32_t repetition = 0u; repetition < TEST_NUMBER_OF_REPETITIONS; repetition++) {
+        for (uint8_t i = 0u; i < TEST_READALL_COMMANDS_PER_CYCLE; i++) {
+            TEST_ReferenceConstructReadall(i, referenceFrame);
+            checksumReference += referenceFrame[3];
+        }
+    }
+    const clock_t durationReference = clock() - startReference;
+
+    const clock_t startCached = clock();
+    for (uint32_t repetition = 0u; repetition < TEST_NUMBER_OF_REPETITIONS; repetition++) {
+        for (uint8_t i = 0u; i < TEST_READALL_COMMANDS_PER_CYCLE; i++) {
+            instance.commandPayload.regAddress = (MXM_REG_NAME_e)i;
+            (void)TEST_MXM_5XConstructCommandBufferReadall(&instance);
+            checksumCached += instance.commandBuffer[3];
+        }
+    }
+    const clock_t durationCached = clock() - startCached;
+
+    char message[200] = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "READALL preparation of %u commands x %u cycles: runtime PEC %ld ticks, precalculated PEC %ld ticks "
+        "(checksums %lu and %lu)",
+        (unsigned int)TEST_READALL_COMMANDS_PER_CYCLE,
+        (unsigned int)TEST_NUMBER_OF_REPETITIONS,
+        (long)durationReference,
+        (long)durationCached,
+        (unsigned long)checksumReference,
+        (unsigned long)checksumCached);
+    TEST_MESSAGE(message);
+}
+#endif
@@ -43,7 +43,7 @@
  * @file    test_nxp_mc33775a.c
  * @author  foxBMS Team
  * @date    2021-10-20 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -57,6 +57,7 @@
 #include "MockHL_gio.h"
 #include "MockHL_system.h"
 #include "Mockafe_dma.h"
+#include "Mockafe_plausibility.h"
 #include "Mockdatabase.h"
 #include "Mockdiag.h"
 #include "Mockftask.h"
@@ -43,7 +43,7 @@
  * @file    test_can_cbs_rx_debug.c
  * @author  foxBMS Team
  * @date    2021-04-22 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -57,6 +57,7 @@
 #include "Mockcan.h"
 #include "Mockcan_cbs_tx_debug-response.h"
 #include "Mockcan_cbs_tx_debug-unsupported-multiplexer-values.h"
+#include "Mockcan_cbs_tx_snapshot.h"
 #include "Mockdatabase.h"
 #include "Mockdiag.h"
 #include "Mockfoxmath.h"
@@ -99,6 +100,8 @@ TEST_INCLUDE_PATH("../../src/app/task/ftask")
 #define MULTIPLEXER_VALUE_SOFTWARE_RESET      (2u)
 #define MULTIPLEXER_VALUE_FRAM_INITIALIZATION (3u)
 #define MULTIPLEXER_VALUE_TIME_INFO           (4u)
+#define MULTIPLEXER_VALUE_SNAPSHOT_REQUEST    (5u)
+#define MULTIPLEXER_VALUE_SNAPSHOT_FLOW       (6u)
 #define INVALID_MULTIPLEXER_VALUE             (99u)
 
 CAN_MESSAGE_PROPERTIES_s validRxDebugTestMessage = {
@@ -253,6 +256,24 @@ void testCANRX_DebugTimeInfoMultiplexerValue(void) {
     CANRX_Debug(validRxDebugTestMessage, testCanData, &can_kShim);
 }
 
+/* provide a valid multiplexer value (snapshot request) */
+void testCANRX_DebugSnapshotRequestMultiplexerValue(void) {
+    uint8_t testCanData[CAN_MAX_DLC] = {0};
+
+    testCanData[0] = MULTIPLEXER_VALUE_SNAPSHOT_REQUEST; /* snapshot request multiplexer message */
+    CANTX_RequestSnapshot_Expect(0u);
+    CANRX_Debug(validRxDebugTestMessage, testCanData, &can_kShim);
+}
+
+/* provide a valid multiplexer value (snapshot flow control) */
+void testCANRX_DebugSnapshotFlowControlMultiplexerValue(void) {
+    uint8_t testCanData[CAN_MAX_DLC] = {0};
+
+    testCanData[0] = MULTIPLEXER_VALUE_SNAPSHOT_FLOW; /* snapshot flow control multiplexer message */
+    CANTX_SetSnapshotFlowControl_Expect(CANTX_SNAPSHOT_FLOW_STATUS_CONTINUE_TO_SEND, 0u, 0u);
+    CANRX_Debug(validRxDebugTestMessage, testCanData, &can_kShim);
+}
+
 /*********************************************************************************************************************/
 /* test RTC helper functions */
 void testCANRX_GetHundredthOfSeconds(void) {
@@ -510,3 +531,38 @@ void testCANRX_ProcessTimeInfoMux(void) {
     CANTX_DebugResponse_IgnoreAndReturn(STD_OK);
     TEST_CANRX_ProcessTimeInfoMux(testMessageData, validEndianness);
 }
+
+void testCANRX_ProcessSnapshotRequestMux(void) {
+    /* test endianness assertion */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_ProcessSnapshotRequestMux(testMessageDataZero, invalidEndianness));
+
+    /* the block mask uses all bytes after the multiplexer */
+    uint64_t testMessageData = (((uint64_t)MULTIPLEXER_VALUE_SNAPSHOT_REQUEST) << 56u) | 0x00F0000000000403uLL;
+    CANTX_RequestSnapshot_Expect(0x00F0000000000403uLL);
+    TEST_CANRX_ProcessSnapshotRequestMux(testMessageData, validEndianness);
+}
+
+void testCANRX_ProcessSnapshotFlowControlMux(void) {
+    /* test endianness assertion */
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANRX_ProcessSnapshotFlowControlMux(testMessageDataZero, invalidEndianness));
+
+    /* continue to send, block size of 8 frames, separation time of 20ms */
+    uint64_t testMessageData = (((uint64_t)0u) << 48u) | (((uint64_t)8u) << 40u) | (((uint64_t)20u) << 32u);
+    CANTX_SetSnapshotFlowControl_Expect(CANTX_SNAPSHOT_FLOW_STATUS_CONTINUE_TO_SEND, 8u, 20u);
+    TEST_CANRX_ProcessSnapshotFlowControlMux(testMessageData, validEndianness);
+
+    /* wait */
+    testMessageData = ((uint64_t)1u) << 48u;
+    CANTX_SetSnapshotFlowControl_Expect(CANTX_SNAPSHOT_FLOW_STATUS_WAIT, 0u, 0u);
+    TEST_CANRX_ProcessSnapshotFlowControlMux(testMessageData, validEndianness);
+
+    /* abort */
+    testMessageData = ((uint64_t)2u) << 48u;
+    CANTX_SetSnapshotFlowControl_Expect(CANTX_SNAPSHOT_FLOW_STATUS_ABORT, 0u, 0u);
+    TEST_CANRX_ProcessSnapshotFlowControlMux(testMessageData, validEndianness);
+
+    /* unknown flow status values abort the transfer */
+    testMessageData = ((uint64_t)0x7Fu) << 48u;
+    CANTX_SetSnapshotFlowControl_Expect(CANTX_SNAPSHOT_FLOW_STATUS_ABORT, 0u, 0u);
+    TEST_CANRX_ProcessSnapshotFlowControlMux(testMessageData, validEndianness);
+}
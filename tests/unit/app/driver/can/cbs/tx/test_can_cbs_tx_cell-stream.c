@@ -0,0 +1,396 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_can_cbs_tx_cell-stream.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the delta based streaming of multiplexed cell data
+ * @details Besides the selection rules, a simulation of a large pack compares
+ *          the streaming mode with the plain round-robin multiplexer in
+ *          terms of latency after a value change, maximum refresh interval
+ *          and used frame slots (bus load).
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+
+#include "fstd_types.h"
+
+#include "can_cbs_tx_cell-stream.h"
+#include "test_assert_helper.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#endif
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("can_cbs_tx_cell-stream.c")
+
+TEST_INCLUDE_PATH("../../src/app/driver/can/cbs/tx")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** small stream used to test the selection rules @{*/
+#define TEST_NUMBER_OF_VALUES     (10u)
+#define TEST_VALUES_PER_GROUP     (4u)
+#define TEST_NUMBER_OF_GROUPS     (3u)
+#define TEST_DEADBAND             (5)
+#define TEST_REFRESH_BOUND_FRAMES (20u)
+/**@}*/
+
+/** large stream used in the simulation (1024 cells, 4 cells per frame) @{*/
+#define TEST_SIMULATION_NUMBER_OF_VALUES     (1024u)
+#define TEST_SIMULATION_VALUES_PER_GROUP     (4u)
+#define TEST_SIMULATION_NUMBER_OF_GROUPS     (TEST_SIMULATION_NUMBER_OF_VALUES / TEST_SIMULATION_VALUES_PER_GROUP)
+#define TEST_SIMULATION_REFRESH_BOUND_FRAMES (4u * TEST_SIMULATION_NUMBER_OF_GROUPS)
+#define TEST_SIMULATION_FRAMES               (20000u)
+/** a step of one cell voltage every n frames */
+#define TEST_SIMULATION_STEP_INTERVAL_FRAMES (50u)
+/**@}*/
+
+static int16_t test_transmittedValues[TEST_NUMBER_OF_VALUES]        = {0};
+static uint8_t test_transmittedInvalidFlags[TEST_NUMBER_OF_VALUES]  = {0u};
+static uint16_t test_framesSinceTransmission[TEST_NUMBER_OF_GROUPS] = {0u};
+static int16_t test_values[TEST_NUMBER_OF_VALUES]                   = {0};
+static uint8_t test_invalidFlags[TEST_NUMBER_OF_VALUES]             = {0u};
+static CANTX_CELL_STREAM_s test_stream                              = {0};
+
+static int16_t test_simulationTransmittedValues[TEST_SIMULATION_NUMBER_OF_VALUES]        = {0};
+static uint8_t test_simulationTransmittedInvalidFlags[TEST_SIMULATION_NUMBER_OF_VALUES]  = {0u};
+static uint16_t test_simulationFramesSinceTransmission[TEST_SIMULATION_NUMBER_OF_GROUPS] = {0u};
+
+/** result of one simulation run */
+typedef struct {
+    uint32_t usedFrames;             /*!< frames that were transmitted */
+    uint32_t maximumRefreshInterval; /*!< longest time between two transmissions of a group in frames */
+    uint32_t numberOfSteps;          /*!< number of value steps */
+    uint32_t sumOfStepLatencies;     /*!< sum of the frames from a step until its transmission */
+    uint32_t maximumStepLatency;     /*!< longest time from a step until its transmission in frames */
+} TEST_SIMULATION_RESULT_s;
+
+/** deterministic pseudo random numbers, so that both runs see the same cell values */
+static uint32_t TEST_Random(uint32_t *pState) {
+    *pState = (*pState * 1103515245u) + 12345u;
+    return (*pState >> 16u) & 0x7FFFu;
+}
+
+/**
+ * @brief   simulates a pack with slowly drifting cells and occasional steps
+ * @param[in] streaming  true: streaming mode, false: round-robin multiplexer
+ * @return  statistics of the run
+ */
+static TEST_SIMULATION_RESULT_s TEST_Simulate(bool streaming) {
+    static int16_t values[TEST_SIMULATION_NUMBER_OF_VALUES]            = {0};
+    static uint8_t invalidFlags[TEST_SIMULATION_NUMBER_OF_VALUES]      = {0u};
+    static uint32_t lastTransmission[TEST_SIMULATION_NUMBER_OF_GROUPS] = {0u};
+    static uint32_t pendingStep[TEST_SIMULATION_NUMBER_OF_VALUES]      = {0u};
+
+    TEST_SIMULATION_RESULT_s result = {0};
+    CANTX_CELL_STREAM_s stream      = {
+        .numberOfValues           = TEST_SIMULATION_NUMBER_OF_VALUES,
+        .valuesPerGroup           = TEST_SIMULATION_VALUES_PER_GROUP,
+        .numberOfGroups           = TEST_SIMULATION_NUMBER_OF_GROUPS,
+        .deadband                 = TEST_DEADBAND,
+        .refreshBound_frames      = TEST_SIMULATION_REFRESH_BOUND_FRAMES,
+        .pTransmittedValues       = test_simulationTransmittedValues,
+        .pTransmittedInvalidFlags = test_simulationTransmittedInvalidFlags,
+        .pFramesSinceTransmission = test_simulationFramesSinceTransmission,
+    };
+    uint32_t randomState     = 42u;
+    uint16_t roundRobinGroup = 0u;
+
+    for (uint16_t v = 0u; v < TEST_SIMULATION_NUMBER_OF_VALUES; v++) {
+        values[v]       = (int16_t)(3600 + (int16_t)(TEST_Random(&randomState) % 20u));
+        invalidFlags[v] = 0u;
+        pendingStep[v]  = UINT32_MAX;
+    }
+    for (uint16_t g = 0u; g < TEST_SIMULATION_NUMBER_OF_GROUPS; g++) {
+        lastTransmission[g] = 0u;
+    }
+    CANTX_CellStreamInitialize(&stream);
+
+    for (uint32_t frame = 1u; frame <= TEST_SIMULATION_FRAMES; frame++) {
+        /* slow drift: every frame a few cells move by 1mV */
+        for (uint8_t i = 0u; i < 8u; i++) {
+            const uint16_t cell = (uint16_t)(TEST_Random(&randomState) % TEST_SIMULATION_NUMBER_OF_VALUES);
+            values[cell]       += ((TEST_Random(&randomState) & 1u) == 0u) ? 1 : -1;
+        }
+        /* steps, e.g., a load change on a single cell */
+        if ((frame % TEST_SIMULATION_STEP_INTERVAL_FRAMES) == 0u) {
+            const uint16_t cell = (uint16_t)(TEST_Random(&randomState) % TEST_SIMULATION_NUMBER_OF_VALUES);
+            values[cell]       += ((TEST_Random(&randomState) & 1u) == 0u) ? 50 : -50;
+            if (pendingStep[cell] == UINT32_MAX) {
+                pendingStep[cell] = frame;
+                result.numberOfSteps++;
+            }
+        }
+
+        /* the minimum and maximum cells are the priority values */
+        uint16_t priorityIndices[2u] = {0u, 0u};
+        for (uint16_t v = 1u; v < TEST_SIMULATION_NUMBER_OF_VALUES; v++) {
+            if (values[v] < values[priorityIndices[0u]]) {
+                priorityIndices[0u] = v;
+            }
+            if (values[v] > values[priorityIndices[1u]]) {
+                priorityIndices[1u] = v;
+            }
+        }
+
+        uint16_t group = CANTX_CELL_STREAM_NO_GROUP;
+        if (streaming == true) {
+            group = CANTX_CellStreamSelectGroup(&stream, values, invalidFlags, priorityIndices, 2u);
+        } else {
+            group           = roundRobinGroup;
+            roundRobinGroup = (roundRobinGroup + 1u) % TEST_SIMULATION_NUMBER_OF_GROUPS;
+        }
+
+        if (group != CANTX_CELL_STREAM_NO_GROUP) {
+            result.usedFrames++;
+            const uint32_t interval = frame - lastTransmission[group];
+            if (interval > result.maximumRefreshInterval) {
+                result.maximumRefreshInterval = interval;
+            }
+            lastTransmission[group] = frame;
+            for (uint16_t v = group * TEST_SIMULATION_VALUES_PER_GROUP;
+                 v < ((group + 1u) * TEST_SIMULATION_VALUES_PER_GROUP);
+                 v++) {
+                if (pendingStep[v] != UINT32_MAX) {
+                    const uint32_t latency     = frame - pendingStep[v];
+                    result.sumOfStepLatencies += latency;
+                    if (latency > result.maximumStepLatency) {
+                        result.maximumStepLatency = latency;
+                    }
+                    pendingStep[v] = UINT32_MAX;
+                }
+            }
+        }
+    }
+    /* groups that were never sent again until the end of the simulation */
+    for (uint16_t g = 0u; g < TEST_SIMULATION_NUMBER_OF_GROUPS; g++) {
+        const uint32_t interval = TEST_SIMULATION_FRAMES - lastTransmission[g];
+        if (interval > result.maximumRefreshInterval) {
+            result.maximumRefreshInterval = interval;
+        }
+    }
+    return result;
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    test_stream.numberOfValues           = TEST_NUMBER_OF_VALUES;
+    test_stream.valuesPerGroup           = TEST_VALUES_PER_GROUP;
+    test_stream.numberOfGroups           = TEST_NUMBER_OF_GROUPS;
+    test_stream.deadband                 = TEST_DEADBAND;
+    test_stream.refreshBound_frames      = TEST_REFRESH_BOUND_FRAMES;
+    test_stream.pTransmittedValues       = test_transmittedValues;
+    test_stream.pTransmittedInvalidFlags = test_transmittedInvalidFlags;
+    test_stream.pFramesSinceTransmission = test_framesSinceTransmission;
+    test_stream.isInitialized            = false;
+    for (uint8_t v = 0u; v < TEST_NUMBER_OF_VALUES; v++) {
+        test_values[v]       = (int16_t)(3000 + v);
+        test_invalidFlags[v] = 0u;
+    }
+    CANTX_CellStreamInitialize(&test_stream);
+}
+
+void tearDown(void) {
+}
+
+/** selects the next group of the small stream without priority values */
+static uint16_t TEST_SelectGroup(void) {
+    return CANTX_CellStreamSelectGroup(&test_stream, test_values, test_invalidFlags, NULL_PTR, 0u);
+}
+
+/** sends the initial round, after which all groups are up to date */
+static void TEST_SendInitialRound(void) {
+    for (uint16_t g = 0u; g < TEST_NUMBER_OF_GROUPS; g++) {
+        TEST_ASSERT_EQUAL_UINT16(g, TEST_SelectGroup());
+    }
+}
+
+/*========== Test Cases =====================================================*/
+void testCellStreamInitializeInvalidInput(void) {
+    TEST_ASSERT_FAIL_ASSERT(CANTX_CellStreamInitialize(NULL_PTR));
+
+    test_stream.refreshBound_frames = TEST_NUMBER_OF_GROUPS - 1u;
+    TEST_ASSERT_FAIL_ASSERT(CANTX_CellStreamInitialize(&test_stream));
+    test_stream.refreshBound_frames = TEST_REFRESH_BOUND_FRAMES;
+
+    test_stream.numberOfGroups = 2u;
+    TEST_ASSERT_FAIL_ASSERT(CANTX_CellStreamInitialize(&test_stream));
+    test_stream.numberOfGroups = TEST_NUMBER_OF_GROUPS;
+
+    test_stream.pFramesSinceTransmission = NULL_PTR;
+    TEST_ASSERT_FAIL_ASSERT(CANTX_CellStreamInitialize(&test_stream));
+}
+
+void testCellStreamSelectGroupInvalidInput(void) {
+    TEST_ASSERT_FAIL_ASSERT(CANTX_CellStreamSelectGroup(NULL_PTR, test_values, test_invalidFlags, NULL_PTR, 0u));
+    TEST_ASSERT_FAIL_ASSERT(CANTX_CellStreamSelectGroup(&test_stream, NULL_PTR, test_invalidFlags, NULL_PTR, 0u));
+    TEST_ASSERT_FAIL_ASSERT(CANTX_CellStreamSelectGroup(&test_stream, test_values, NULL_PTR, NULL_PTR, 0u));
+    TEST_ASSERT_FAIL_ASSERT(CANTX_CellStreamSelectGroup(&test_stream, test_values, test_invalidFlags, NULL_PTR, 1u));
+    test_stream.isInitialized = false;
+    TEST_ASSERT_FAIL_ASSERT(TEST_SelectGroup());
+}
+
+void testCellStreamFirstRoundSendsAllGroups(void) {
+    TEST_SendInitialRound();
+    /* nothing changed afterwards */
+    TEST_ASSERT_EQUAL_UINT16(CANTX_CELL_STREAM_NO_GROUP, TEST_SelectGroup());
+    TEST_ASSERT_EQUAL_INT16(test_values[9u], test_transmittedValues[9u]);
+}
+
+void testCellStreamDeadband(void) {
+    TEST_SendInitialRound();
+
+    /* change within the deadband is not sent */
+    test_values[5u] += TEST_DEADBAND;
+    TEST_ASSERT_EQUAL_UINT16(CANTX_CELL_STREAM_NO_GROUP, TEST_SelectGroup());
+
+    /* change beyond the deadband is sent once */
+    test_values[5u] += 1;
+    TEST_ASSERT_EQUAL_UINT16(1u, TEST_SelectGroup());
+    TEST_ASSERT_EQUAL_UINT16(CANTX_CELL_STREAM_NO_GROUP, TEST_SelectGroup());
+
+    /* negative changes are detected as well; the partially used last group is handled */
+    test_values[9u] -= (TEST_DEADBAND + 1);
+    TEST_ASSERT_EQUAL_UINT16(2u, TEST_SelectGroup());
+}
+
+void testCellStreamInvalidFlagChangeIsSent(void) {
+    TEST_SendInitialRound();
+    test_invalidFlags[0u] = 1u;
+    TEST_ASSERT_EQUAL_UINT16(0u, TEST_SelectGroup());
+    TEST_ASSERT_EQUAL_UINT8(1u, test_transmittedInvalidFlags[0u]);
+}
+
+void testCellStreamRoundRobinBetweenChangedGroups(void) {
+    TEST_SendInitialRound();
+    test_values[0u] += 10;
+    test_values[4u] += 10;
+    test_values[8u] += 10;
+    TEST_ASSERT_EQUAL_UINT16(0u, TEST_SelectGroup());
+    /* group 0 changes again, but groups 1 and 2 are served first */
+    test_values[0u] += 10;
+    TEST_ASSERT_EQUAL_UINT16(1u, TEST_SelectGroup());
+    TEST_ASSERT_EQUAL_UINT16(2u, TEST_SelectGroup());
+    TEST_ASSERT_EQUAL_UINT16(0u, TEST_SelectGroup());
+}
+
+void testCellStreamPriorityValuesIgnoreDeadband(void) {
+    TEST_SendInitialRound();
+    const uint16_t priorityIndices[2u] = {9u, 42u};
+    /* group 0 changed beyond the deadband, the priority value only by 1 */
+    test_values[0u] += 10;
+    test_values[9u] += 1;
+    TEST_ASSERT_EQUAL_UINT16(
+        2u, CANTX_CellStreamSelectGroup(&test_stream, test_values, test_invalidFlags, priorityIndices, 2u));
+    TEST_ASSERT_EQUAL_UINT16(
+        0u, CANTX_CellStreamSelectGroup(&test_stream, test_values, test_invalidFlags, priorityIndices, 2u));
+    /* out of range priority indices are ignored */
+    TEST_ASSERT_EQUAL_UINT16(
+        CANTX_CELL_STREAM_NO_GROUP,
+        CANTX_CellStreamSelectGroup(&test_stream, test_values, test_invalidFlags, priorityIndices, 2u));
+}
+
+void testCellStreamRefreshBound(void) {
+    TEST_SendInitialRound();
+    uint32_t lastTransmission[TEST_NUMBER_OF_GROUPS] = {0u, 0u, 0u};
+    uint32_t sentFrames                              = 0u;
+    /* unchanged values: every group is sent at least once per refresh bound */
+    for (uint32_t frame = 1u; frame <= (10u * TEST_REFRESH_BOUND_FRAMES); frame++) {
+        const uint16_t group = TEST_SelectGroup();
+        if (group != CANTX_CELL_STREAM_NO_GROUP) {
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32(TEST_REFRESH_BOUND_FRAMES, frame - lastTransmission[group]);
+            lastTransmission[group] = frame;
+            sentFrames++;
+        }
+    }
+    for (uint16_t g = 0u; g < TEST_NUMBER_OF_GROUPS; g++) {
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(
+            TEST_REFRESH_BOUND_FRAMES, (10u * TEST_REFRESH_BOUND_FRAMES) - lastTransmission[g]);
+    }
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(10u * TEST_NUMBER_OF_GROUPS, sentFrames);
+    TEST_ASSERT_LESS_THAN_UINT32(10u * TEST_REFRESH_BOUND_FRAMES, sentFrames);
+}
+
+void testCellStreamSimulationVersusRoundRobin(void) {
+    const TEST_SIMULATION_RESULT_s roundRobin = TEST_Simulate(false);
+    const TEST_SIMULATION_RESULT_s streaming  = TEST_Simulate(true);
+
+    /* the round-robin multiplexer uses every slot and refreshes once per cycle */
+    TEST_ASSERT_EQUAL_UINT32(TEST_SIMULATION_FRAMES, roundRobin.usedFrames);
+    TEST_ASSERT_EQUAL_UINT32(TEST_SIMULATION_NUMBER_OF_GROUPS, roundRobin.maximumRefreshInterval);
+    /* the stream keeps its refresh bound, so no step stays unsent for longer */
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(TEST_SIMULATION_REFRESH_BOUND_FRAMES, streaming.maximumRefreshInterval);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(TEST_SIMULATION_REFRESH_BOUND_FRAMES, streaming.maximumStepLatency);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(TEST_SIMULATION_FRAMES, streaming.usedFrames);
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+    char message[160] = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "round-robin: bus load %u%%, max. refresh %u frames, step latency mean %u max %u frames",
+        (unsigned int)((100u * roundRobin.usedFrames) / TEST_SIMULATION_FRAMES),
+        (unsigned int)roundRobin.maximumRefreshInterval,
+        (unsigned int)(roundRobin.sumOfStepLatencies / roundRobin.numberOfSteps),
+        (unsigned int)roundRobin.maximumStepLatency);
+    TEST_MESSAGE(message);
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "streaming:   bus load %u%%, max. refresh %u frames, step latency mean %u max %u frames",
+        (unsigned int)((100u * streaming.usedFrames) / TEST_SIMULATION_FRAMES),
+        (unsigned int)streaming.maximumRefreshInterval,
+        (unsigned int)(streaming.sumOfStepLatencies / streaming.numberOfSteps),
+        (unsigned int)streaming.maximumStepLatency);
+    TEST_MESSAGE(message);
+#endif
+}
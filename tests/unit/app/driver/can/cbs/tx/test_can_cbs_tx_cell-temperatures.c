@@ -43,7 +43,7 @@
  * @file    test_can_cbs_tx_cell-temperatures.c
  * @author  foxBMS Team
  * @date    2021-04-22 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -64,6 +64,7 @@
 #include "database_cfg.h"
 
 #include "can_cbs_tx.h"
+#include "can_cbs_tx_cell-stream.h"
 #include "can_cfg_tx-message-definitions.h"
 #include "can_helper.h"
 #include "database_helper.h"
@@ -164,3 +165,32 @@ void testCAN_TxCellTemperature(void) {
     TEST_ASSERT_EQUAL(40, data[6]);
     TEST_ASSERT_EQUAL(246, data[7]);
 }
+
+void testCAN_StreamCellTemperatures(void) {
+    const uint16_t numberOfGroups = (BS_NR_OF_TEMP_SENSORS + 5u) / 6u;
+    DATA_Read2DataBlocks_IgnoreAndReturn(STD_OK);
+
+    /* minimum and maximum cell temperature are in the first group */
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        can_tableMinimumMaximumValues.nrModuleMinimumTemperature[s] = 0u;
+        can_tableMinimumMaximumValues.nrSensorMinimumTemperature[s] = 0u;
+        can_tableMinimumMaximumValues.nrModuleMaximumTemperature[s] = 0u;
+        can_tableMinimumMaximumValues.nrSensorMaximumTemperature[s] = 4u;
+    }
+
+    /* the first round sends every group, afterwards unchanged groups are skipped */
+    for (uint16_t g = 0u; g < numberOfGroups; g++) {
+        TEST_ASSERT_EQUAL_UINT16(g, TEST_CANTX_StreamCellTemperatures(&can_kShim));
+    }
+    TEST_ASSERT_EQUAL_UINT16(CANTX_CELL_STREAM_NO_GROUP, TEST_CANTX_StreamCellTemperatures(&can_kShim));
+
+    /* the group of the minimum/maximum temperature is sent on any change */
+    can_tableTemperatures.cellTemperature_ddegC[0u][0u][2u] += 1;
+    TEST_ASSERT_EQUAL_UINT16(0u, TEST_CANTX_StreamCellTemperatures(&can_kShim));
+
+    /* other groups are sent if a value changes beyond the deadband */
+    can_tableTemperatures.cellTemperature_ddegC[0u][0u][7u] += CANTX_CELL_TEMPERATURES_STREAM_DEADBAND_ddegC;
+    TEST_ASSERT_EQUAL_UINT16(CANTX_CELL_STREAM_NO_GROUP, TEST_CANTX_StreamCellTemperatures(&can_kShim));
+    can_tableTemperatures.cellTemperature_ddegC[0u][0u][7u] += 1;
+    TEST_ASSERT_EQUAL_UINT16(1u, TEST_CANTX_StreamCellTemperatures(&can_kShim));
+}
@@ -43,7 +43,7 @@
  * @file    test_can_cbs_tx_cell-voltages.c
  * @author  foxBMS Team
  * @date    2021-04-22 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -64,6 +64,7 @@
 #include "database_cfg.h"
 
 #include "can_cbs_tx.h"
+#include "can_cbs_tx_cell-stream.h"
 #include "can_cfg_tx-message-definitions.h"
 #include "can_helper.h"
 #include "database_helper.h"
@@ -168,3 +169,37 @@ void testCAN_TxVoltage(void) {
     TEST_ASSERT_EQUAL(0x0E, data[6]);
     TEST_ASSERT_EQUAL(0x74, data[7]);
 }
+
+void testCAN_StreamCellVoltages(void) {
+    const uint16_t numberOfGroups = ((BS_NR_OF_STRINGS * BS_NR_OF_CELL_BLOCKS_PER_STRING) + 3u) / 4u;
+    DATA_Read2DataBlocks_IgnoreAndReturn(STD_OK);
+
+    /* minimum and maximum cell voltage are in the first group */
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        can_tableMinimumMaximumValues.nrModuleMinimumCellVoltage[s] = 0u;
+        can_tableMinimumMaximumValues.nrCellMinimumCellVoltage[s]   = 0u;
+        can_tableMinimumMaximumValues.nrModuleMaximumCellVoltage[s] = 0u;
+        can_tableMinimumMaximumValues.nrCellMaximumCellVoltage[s]   = 3u;
+    }
+
+    /* the first round sends every group, afterwards unchanged groups are skipped */
+    for (uint16_t g = 0u; g < numberOfGroups; g++) {
+        TEST_ASSERT_EQUAL_UINT16(g, TEST_CANTX_StreamCellVoltages(&can_kShim));
+    }
+    TEST_ASSERT_EQUAL_UINT16(CANTX_CELL_STREAM_NO_GROUP, TEST_CANTX_StreamCellVoltages(&can_kShim));
+
+    /* the group of the minimum/maximum cell is sent on any change */
+    can_tableCellVoltages.cellVoltage_mV[0u][0u][1u] += 1;
+    TEST_ASSERT_EQUAL_UINT16(0u, TEST_CANTX_StreamCellVoltages(&can_kShim));
+
+    /* other groups are sent if a value changes beyond the deadband ... */
+    can_tableCellVoltages.cellVoltage_mV[0u][0u][5u] += CANTX_CELL_VOLTAGES_STREAM_DEADBAND_mV;
+    TEST_ASSERT_EQUAL_UINT16(CANTX_CELL_STREAM_NO_GROUP, TEST_CANTX_StreamCellVoltages(&can_kShim));
+    can_tableCellVoltages.cellVoltage_mV[0u][0u][5u] += 1;
+    TEST_ASSERT_EQUAL_UINT16(1u, TEST_CANTX_StreamCellVoltages(&can_kShim));
+
+    /* ... or if an invalid flag changes */
+    can_tableCellVoltages.invalidCellVoltage[BS_NR_OF_STRINGS - 1u][BS_NR_OF_MODULES_PER_STRING - 1u] |=
+        ((uint64_t)1u << (BS_NR_OF_CELL_BLOCKS_PER_MODULE - 1u));
+    TEST_ASSERT_EQUAL_UINT16(numberOfGroups - 1u, TEST_CANTX_StreamCellVoltages(&can_kShim));
+}
@@ -0,0 +1,728 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_can_cbs_tx_snapshot.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the transfer of database snapshots
+ * @details Besides the serialization and the flow control, a loopback test
+ *          reassembles the sent frames, decodes the snapshot and compares it
+ *          with the database entries.
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mockcan.h"
+#include "Mockdatabase.h"
+#include "Mockos.h"
+
+#include "database_cfg.h"
+
+#include "can_cbs_tx_snapshot.h"
+#include "can_cfg.h"
+#include "can_cfg_tx-message-definitions.h"
+#include "test_assert_helper.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#include <time.h>
+#endif
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_SOURCE_FILE("can_cbs_tx_snapshot.c")
+
+TEST_INCLUDE_PATH("../../src/app/driver/can")
+TEST_INCLUDE_PATH("../../src/app/driver/can/cbs/tx")
+TEST_INCLUDE_PATH("../../src/app/driver/config")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+const CAN_NODE_s can_node1 = {
+    .canNodeRegister = canREG1,
+};
+
+/** maximum number of frames that are recorded */
+#define TEST_MAXIMUM_NUMBER_OF_FRAMES (1000u)
+/** maximum size of a decoded data block */
+#define TEST_MAXIMUM_BLOCK_SIZE (CANTX_SNAPSHOT_BUFFER_SIZE)
+/** period of #CANTX_SnapshotTransmit */
+#define TEST_TASK_PERIOD_ms (10u)
+/** calls of #CANTX_SnapshotTransmit needed to serialize all data blocks */
+#define TEST_SERIALIZATION_CALLS                                                 \
+    (((uint32_t)DATA_BLOCK_ID_MAX + CANTX_SNAPSHOT_MAXIMUM_BLOCKS_PER_CALL - 1u) / \
+     CANTX_SNAPSHOT_MAXIMUM_BLOCKS_PER_CALL)
+/** size of a data block that can not be compressed and fills the snapshot buffer exactly */
+#define TEST_LARGE_BLOCK_SIZE                                                                              \
+    (((CANTX_SNAPSHOT_BUFFER_SIZE - CANTX_SNAPSHOT_HEADER_SIZE - CANTX_SNAPSHOT_BLOCK_HEADER_SIZE) * \
+      CANTX_SNAPSHOT_RUN_MAXIMUM_LENGTH) /                                                           \
+     (CANTX_SNAPSHOT_RUN_MAXIMUM_LENGTH + 1u))
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+/** repetitions of the time measurements */
+#define TEST_BENCHMARK_REPETITIONS (1000u)
+#endif
+
+/** data block without a dedicated test entry */
+typedef struct {
+    DATA_BLOCK_HEADER_s header; /*!< Data block header */
+    uint8_t data[64];           /*!< content */
+} TEST_DATA_BLOCK_s;
+
+/** database entry lent by the stub of #DATA_BorrowDataBlock */
+typedef struct {
+    const void *pkDataBlock; /*!< database entry */
+    uint32_t dataLength;     /*!< size of the database entry */
+} TEST_DATABASE_ENTRY_s;
+
+static DATA_BLOCK_CELL_VOLTAGE_s test_tableCellVoltages                = {0};
+static DATA_BLOCK_CELL_TEMPERATURE_s test_tableCellTemperatures        = {0};
+static DATA_BLOCK_PACK_VALUES_s test_tablePackValues                   = {0};
+static DATA_BLOCK_SOC_s test_tableSoc                                  = {0};
+static TEST_DATA_BLOCK_s test_tableOtherBlocks[DATA_BLOCK_ID_MAX]      = {0};
+static TEST_DATABASE_ENTRY_s test_database[DATA_BLOCK_ID_MAX]          = {0};
+static uint8_t test_frames[TEST_MAXIMUM_NUMBER_OF_FRAMES][CAN_MAX_DLC] = {0};
+static uint32_t test_numberOfFrames                                    = 0u;
+static uint32_t test_failingSends                                      = 0u;
+static uint32_t test_failingReturns                                    = 0u;
+static uint32_t test_borrowedBlocks                                    = 0u;
+static uint32_t test_timestamp_ms                                      = 0u;
+static uint8_t test_snapshot[CANTX_SNAPSHOT_BUFFER_SIZE]               = {0u};
+
+/** lends the test entry of the data block */
+static void TEST_BorrowDataBlock(DATA_BLOCK_ID_e blockId, DATA_READ_VIEW_s *pView, int cmock_num_calls) {
+    (void)cmock_num_calls;
+    test_borrowedBlocks++;
+    pView->pkDataBlock = test_database[blockId].pkDataBlock;
+    pView->blockId     = blockId;
+    pView->dataLength  = test_database[blockId].dataLength;
+    pView->version     = 0u;
+}
+
+/** reports the next test_failingReturns returns as concurrently written */
+static STD_RETURN_TYPE_e TEST_ReturnDataBlock(const DATA_READ_VIEW_s *const kpkView, int cmock_num_calls) {
+    (void)kpkView;
+    (void)cmock_num_calls;
+    STD_RETURN_TYPE_e retval = STD_OK;
+    if (test_failingReturns > 0u) {
+        test_failingReturns--;
+        retval = STD_NOT_OK;
+    }
+    return retval;
+}
+
+/** records the frames; the next test_failingSends sends fail as no message box is free */
+static STD_RETURN_TYPE_e TEST_DataSend(
+    CAN_NODE_s *pNode,
+    uint32_t id,
+    CAN_IDENTIFIER_TYPE_e idType,
+    uint8 *pData,
+    int cmock_num_calls) {
+    (void)cmock_num_calls;
+    TEST_ASSERT_EQUAL_PTR(CAN_NODE_DEBUG_MESSAGE, pNode);
+    TEST_ASSERT_EQUAL_UINT32(CANTX_SNAPSHOT_ID, id);
+    TEST_ASSERT_EQUAL(CANTX_SNAPSHOT_IDENTIFIER, idType);
+    STD_RETURN_TYPE_e retval = STD_OK;
+    if (test_failingSends > 0u) {
+        test_failingSends--;
+        retval = STD_NOT_OK;
+    } else {
+        TEST_ASSERT_TRUE(test_numberOfFrames < TEST_MAXIMUM_NUMBER_OF_FRAMES);
+        for (uint8_t i = 0u; i < CAN_MAX_DLC; i++) {
+            test_frames[test_numberOfFrames][i] = pData[i];
+        }
+        test_numberOfFrames++;
+    }
+    return retval;
+}
+
+static uint32_t TEST_GetTickCount(int cmock_num_calls) {
+    (void)cmock_num_calls;
+    return test_timestamp_ms;
+}
+
+/** calls the transfer once and advances the time by one task period */
+static void TEST_Transmit(void) {
+    CANTX_SnapshotTransmit();
+    test_timestamp_ms += TEST_TASK_PERIOD_ms;
+}
+
+static uint16_t TEST_ReadUint16(const uint8_t *pkBuffer) {
+    return (uint16_t)(((uint16_t)pkBuffer[0] << 8u) | pkBuffer[1]);
+}
+
+static uint32_t TEST_ReadUint32(const uint8_t *pkBuffer) {
+    return ((uint32_t)TEST_ReadUint16(&pkBuffer[0]) << 16u) | TEST_ReadUint16(&pkBuffer[2]);
+}
+
+/** decodes runs of zero bytes, returns the decoded length */
+static uint32_t TEST_DecodeZeroRuns(
+    const uint8_t *pkSource,
+    uint32_t sourceLength,
+    uint8_t *pDestination,
+    uint32_t destinationSize) {
+    uint32_t in  = 0u;
+    uint32_t out = 0u;
+    while (in < sourceLength) {
+        const uint8_t control = pkSource[in];
+        in++;
+        if ((control & CANTX_SNAPSHOT_RUN_ZERO_FLAG) != 0u) {
+            const uint32_t zeros = (uint32_t)(control & (uint8_t)~CANTX_SNAPSHOT_RUN_ZERO_FLAG) + 1u;
+            TEST_ASSERT_TRUE((out + zeros) <= destinationSize);
+            (void)memset(&pDestination[out], 0, zeros);
+            out += zeros;
+        } else {
+            const uint32_t literals = (uint32_t)control + 1u;
+            TEST_ASSERT_TRUE((in + literals) <= sourceLength);
+            TEST_ASSERT_TRUE((out + literals) <= destinationSize);
+            (void)memcpy(&pDestination[out], &pkSource[in], literals);
+            out += literals;
+            in  += literals;
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief   reassembles the recorded frames
+ * @return  length of the reassembled snapshot, sequence numbers are checked
+ */
+static uint32_t TEST_ReassembleFrames(uint8_t *pSnapshot, uint32_t snapshotSize) {
+    TEST_ASSERT_TRUE(test_numberOfFrames > 0u);
+    TEST_ASSERT_EQUAL_HEX8(CANTX_SNAPSHOT_FIRST_FRAME, test_frames[0][0] & 0xF0u);
+    uint32_t length = ((uint32_t)(test_frames[0][0] & 0x0Fu) << 8u) | test_frames[0][1];
+    uint8_t offset  = 2u;
+    if (length == 0u) {
+        length = TEST_ReadUint32(&test_frames[0][2]);
+        offset = 6u;
+    }
+    TEST_ASSERT_TRUE(length <= snapshotSize);
+    uint32_t position = 0u;
+    for (uint8_t i = offset; (i < CAN_MAX_DLC) && (position < length); i++) {
+        pSnapshot[position] = test_frames[0][i];
+        position++;
+    }
+    uint8_t sequenceNumber = 1u;
+    for (uint32_t frame = 1u; frame < test_numberOfFrames; frame++) {
+        TEST_ASSERT_EQUAL_HEX8(CANTX_SNAPSHOT_CONSECUTIVE_FRAME | sequenceNumber, test_frames[frame][0]);
+        sequenceNumber = (uint8_t)((sequenceNumber + 1u) & CANTX_SNAPSHOT_CONSECUTIVE_FRAME_SEQUENCE_MASK);
+        for (uint8_t i = 1u; (i < CAN_MAX_DLC) && (position < length); i++) {
+            pSnapshot[position] = test_frames[frame][i];
+            position++;
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(length, position);
+    return length;
+}
+
+/**
+ * @brief   decodes a snapshot and compares every data block with its database entry
+ * @return  number of decoded data blocks
+ */
+static uint8_t TEST_DecodeAndCompareSnapshot(const uint8_t *pkSnapshot, uint32_t length) {
+    static uint8_t block[TEST_MAXIMUM_BLOCK_SIZE] = {0u};
+    TEST_ASSERT_EQUAL_HEX8(CANTX_SNAPSHOT_MAGIC_0, pkSnapshot[0]);
+    TEST_ASSERT_EQUAL_HEX8(CANTX_SNAPSHOT_MAGIC_1, pkSnapshot[1]);
+    TEST_ASSERT_EQUAL_UINT8(CANTX_SNAPSHOT_FORMAT_VERSION, pkSnapshot[2]);
+    TEST_ASSERT_EQUAL_UINT8(sizeof(DATA_BLOCK_ID_e), pkSnapshot[4]);
+    uint32_t position = CANTX_SNAPSHOT_HEADER_SIZE;
+    for (uint8_t record = 0u; record < pkSnapshot[5]; record++) {
+        const uint8_t blockId        = pkSnapshot[position];
+        const uint16_t dataLength    = TEST_ReadUint16(&pkSnapshot[position + 2u]);
+        const uint16_t encodedLength = TEST_ReadUint16(&pkSnapshot[position + 4u]);
+
+        position += CANTX_SNAPSHOT_BLOCK_HEADER_SIZE;
+        TEST_ASSERT_TRUE(blockId < (uint8_t)DATA_BLOCK_ID_MAX);
+        TEST_ASSERT_EQUAL_UINT32(test_database[blockId].dataLength, dataLength);
+        TEST_ASSERT_EQUAL_UINT32(
+            dataLength, TEST_DecodeZeroRuns(&pkSnapshot[position], encodedLength, block, sizeof(block)));
+        TEST_ASSERT_EQUAL_MEMORY(test_database[blockId].pkDataBlock, block, dataLength);
+        position += encodedLength;
+    }
+    TEST_ASSERT_EQUAL_UINT32(length, position);
+    return pkSnapshot[5];
+}
+
+/** requests a snapshot and sends its first frame after the data blocks have been serialized */
+static void TEST_StartTransfer(uint64_t blockMask) {
+    const uint32_t framesBefore = test_numberOfFrames;
+    CANTX_RequestSnapshot(blockMask);
+    for (uint32_t i = 0u; (i < TEST_SERIALIZATION_CALLS) && (test_numberOfFrames == framesBefore); i++) {
+        TEST_Transmit();
+    }
+    TEST_ASSERT_EQUAL_UINT32(framesBefore + 1u, test_numberOfFrames);
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    for (uint8_t blockId = 0u; blockId < (uint8_t)DATA_BLOCK_ID_MAX; blockId++) {
+        test_tableOtherBlocks[blockId].header.uniqueId  = (DATA_BLOCK_ID_e)blockId;
+        test_tableOtherBlocks[blockId].header.timestamp = 1000u + blockId;
+        test_database[blockId].pkDataBlock              = &test_tableOtherBlocks[blockId];
+        test_database[blockId].dataLength               = sizeof(TEST_DATA_BLOCK_s);
+    }
+    /* slowly drifting cell voltages and temperatures of a pack in operation */
+    test_tableCellVoltages.header.uniqueId  = DATA_BLOCK_ID_CELL_VOLTAGE;
+    test_tableCellVoltages.header.timestamp = 123456u;
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        test_tableCellVoltages.stringVoltage_mV[s] = 0;
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            test_tableCellVoltages.moduleVoltage_mV[s][m] = 0u;
+            for (uint8_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_MODULE; c++) {
+                test_tableCellVoltages.cellVoltage_mV[s][m][c] = (int16_t)(3650 + (((s + m + c) * 7) % 23));
+                test_tableCellVoltages.moduleVoltage_mV[s][m] +=
+                    (uint32_t)test_tableCellVoltages.cellVoltage_mV[s][m][c];
+            }
+            test_tableCellVoltages.stringVoltage_mV[s]     += (int32_t)test_tableCellVoltages.moduleVoltage_mV[s][m];
+            test_tableCellVoltages.validModuleVoltage[s][m] = true;
+        }
+        test_tableCellVoltages.nrValidCellVoltages[s] = BS_NR_OF_CELL_BLOCKS_PER_STRING;
+    }
+    test_tableCellTemperatures.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE;
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            for (uint8_t t = 0u; t < BS_NR_OF_TEMP_SENSORS_PER_MODULE; t++) {
+                test_tableCellTemperatures.cellTemperature_ddegC[s][m][t] = (int16_t)(250 + ((m + t) % 5));
+            }
+        }
+        test_tableCellTemperatures.nrValidTemperatures[s] = BS_NR_OF_TEMP_SENSORS_PER_STRING;
+    }
+    test_tablePackValues.header.uniqueId = DATA_BLOCK_ID_PACK_VALUES;
+    test_tablePackValues.packCurrent_mA  = -12345;
+    test_tablePackValues.packPower_W     = 4242;
+    test_tableSoc.header.uniqueId        = DATA_BLOCK_ID_SOC;
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        test_tablePackValues.stringVoltage_mV[s] = test_tableCellVoltages.stringVoltage_mV[s];
+        test_tableSoc.averageSoc_perc[s]         = 55.5f;
+        test_tableSoc.minimumSoc_perc[s]         = 54.0f;
+        test_tableSoc.maximumSoc_perc[s]         = 57.0f;
+    }
+    test_database[DATA_BLOCK_ID_CELL_VOLTAGE].pkDataBlock     = &test_tableCellVoltages;
+    test_database[DATA_BLOCK_ID_CELL_VOLTAGE].dataLength      = sizeof(test_tableCellVoltages);
+    test_database[DATA_BLOCK_ID_CELL_TEMPERATURE].pkDataBlock = &test_tableCellTemperatures;
+    test_database[DATA_BLOCK_ID_CELL_TEMPERATURE].dataLength  = sizeof(test_tableCellTemperatures);
+    test_database[DATA_BLOCK_ID_PACK_VALUES].pkDataBlock      = &test_tablePackValues;
+    test_database[DATA_BLOCK_ID_PACK_VALUES].dataLength       = sizeof(test_tablePackValues);
+    test_database[DATA_BLOCK_ID_SOC].pkDataBlock              = &test_tableSoc;
+    test_database[DATA_BLOCK_ID_SOC].dataLength               = sizeof(test_tableSoc);
+
+    test_numberOfFrames = 0u;
+    test_failingSends   = 0u;
+    test_failingReturns = 0u;
+    test_borrowedBlocks = 0u;
+    test_timestamp_ms   = 5000u;
+
+    DATA_BorrowDataBlock_Stub(TEST_BorrowDataBlock);
+    DATA_ReturnDataBlock_Stub(TEST_ReturnDataBlock);
+    CAN_DataSend_Stub(TEST_DataSend);
+    OS_GetTickCount_Stub(TEST_GetTickCount);
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    TEST_CANTX_ResetSnapshotTransfer();
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testCANTX_EncodeZeroRunsInvalidInput(void) {
+    uint8_t source[4]      = {0u};
+    uint8_t destination[8] = {0u};
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANTX_EncodeZeroRuns(NULL_PTR, 4u, destination, 8u));
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANTX_EncodeZeroRuns(source, 0u, destination, 8u));
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANTX_EncodeZeroRuns(source, 4u, NULL_PTR, 8u));
+}
+
+void testCANTX_EncodeZeroRuns(void) {
+    /* zero runs longer than one control byte can describe are split */
+    uint8_t zeros[300]    = {0u};
+    uint8_t encoded[1000] = {0u};
+    TEST_ASSERT_EQUAL_UINT32(3u, TEST_CANTX_EncodeZeroRuns(zeros, sizeof(zeros), encoded, sizeof(encoded)));
+    TEST_ASSERT_EQUAL_HEX8(0xFFu, encoded[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xFFu, encoded[1]);
+    TEST_ASSERT_EQUAL_HEX8(0x80u | (300u - 257u), encoded[2]);
+
+    /* a single zero byte stays part of the literal run */
+    const uint8_t literals[] = {1u, 0u, 2u, 0u, 0u, 3u};
+    const uint8_t expected[] = {2u, 1u, 0u, 2u, 0x81u, 0u, 3u};
+    TEST_ASSERT_EQUAL_UINT32(
+        sizeof(expected), TEST_CANTX_EncodeZeroRuns(literals, sizeof(literals), encoded, sizeof(encoded)));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, encoded, sizeof(expected));
+}
+
+void testCANTX_EncodeZeroRunsRoundTrip(void) {
+    uint8_t source[700]   = {0u};
+    uint8_t encoded[1000] = {0u};
+    uint8_t decoded[700]  = {0u};
+    /* long literal runs, single zero bytes and zero runs of different lengths */
+    for (uint32_t i = 0u; i < sizeof(source); i++) {
+        if ((i < 200u) || ((i % 17u) == 0u)) {
+            source[i] = (uint8_t)(i + 1u);
+        } else if ((i % 5u) == 0u) {
+            source[i] = 0x5Au;
+        } else {
+            source[i] = 0u;
+        }
+    }
+    const uint32_t encodedLength = TEST_CANTX_EncodeZeroRuns(source, sizeof(source), encoded, sizeof(encoded));
+    TEST_ASSERT_TRUE(encodedLength > 0u);
+    TEST_ASSERT_TRUE(encodedLength < sizeof(source));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(source), TEST_DecodeZeroRuns(encoded, encodedLength, decoded, sizeof(decoded)));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(source, decoded, sizeof(source));
+}
+
+void testCANTX_EncodeZeroRunsDoesNotFit(void) {
+    const uint8_t source[] = {1u, 2u, 3u, 4u, 0u, 0u, 0u};
+    uint8_t encoded[5]     = {0u};
+    TEST_ASSERT_EQUAL_UINT32(0u, TEST_CANTX_EncodeZeroRuns(source, sizeof(source), encoded, 4u));
+    TEST_ASSERT_EQUAL_UINT32(0u, TEST_CANTX_EncodeZeroRuns(source, sizeof(source), encoded, 5u));
+    TEST_ASSERT_EQUAL_UINT32(6u, TEST_CANTX_EncodeZeroRuns(source, sizeof(source), encoded, 6u));
+}
+
+void testCANTX_SerializeSnapshotInvalidInput(void) {
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANTX_SerializeSnapshot(0u, NULL_PTR, CANTX_SNAPSHOT_BUFFER_SIZE));
+    TEST_ASSERT_FAIL_ASSERT(TEST_CANTX_SerializeSnapshot(0u, test_snapshot, CANTX_SNAPSHOT_HEADER_SIZE - 1u));
+}
+
+void testCANTX_SerializeSnapshotHeader(void) {
+    test_timestamp_ms     = 0x12345678u;
+    const uint32_t length = TEST_CANTX_SerializeSnapshot(
+        DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CELL_VOLTAGE), test_snapshot, sizeof(test_snapshot));
+
+    TEST_ASSERT_EQUAL_HEX8(CANTX_SNAPSHOT_MAGIC_0, test_snapshot[0]);
+    TEST_ASSERT_EQUAL_HEX8(CANTX_SNAPSHOT_MAGIC_1, test_snapshot[1]);
+    TEST_ASSERT_EQUAL_UINT8(CANTX_SNAPSHOT_FORMAT_VERSION, test_snapshot[2]);
+    /* the unit tests run on a little endian host */
+    TEST_ASSERT_EQUAL_HEX8(CANTX_SNAPSHOT_FLAG_LITTLE_ENDIAN, test_snapshot[3]);
+    TEST_ASSERT_EQUAL_UINT8(sizeof(DATA_BLOCK_ID_e), test_snapshot[4]);
+    TEST_ASSERT_EQUAL_UINT8(1u, test_snapshot[5]);
+    TEST_ASSERT_EQUAL_HEX32(0x12345678u, TEST_ReadUint32(&test_snapshot[6]));
+
+    TEST_ASSERT_EQUAL_UINT8(DATA_BLOCK_ID_CELL_VOLTAGE, test_snapshot[CANTX_SNAPSHOT_HEADER_SIZE]);
+    TEST_ASSERT_EQUAL_HEX8(0u, test_snapshot[CANTX_SNAPSHOT_HEADER_SIZE + 1u]);
+    TEST_ASSERT_EQUAL_UINT16(
+        sizeof(DATA_BLOCK_CELL_VOLTAGE_s), TEST_ReadUint16(&test_snapshot[CANTX_SNAPSHOT_HEADER_SIZE + 2u]));
+    TEST_ASSERT_EQUAL_UINT32(
+        CANTX_SNAPSHOT_HEADER_SIZE + CANTX_SNAPSHOT_BLOCK_HEADER_SIZE +
+            TEST_ReadUint16(&test_snapshot[CANTX_SNAPSHOT_HEADER_SIZE + 4u]),
+        length);
+    TEST_ASSERT_EQUAL_UINT8(1u, TEST_DecodeAndCompareSnapshot(test_snapshot, length));
+}
+
+void testCANTX_SerializeSnapshotSelectsDataBlocks(void) {
+    /* the data blocks are serialized in the order of their IDs */
+    const uint64_t blockMask = DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_SOC) |
+                               DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CELL_TEMPERATURE);
+    uint32_t length = TEST_CANTX_SerializeSnapshot(blockMask, test_snapshot, sizeof(test_snapshot));
+    TEST_ASSERT_EQUAL_UINT8(2u, TEST_DecodeAndCompareSnapshot(test_snapshot, length));
+    TEST_ASSERT_EQUAL_UINT8(DATA_BLOCK_ID_CELL_TEMPERATURE, test_snapshot[CANTX_SNAPSHOT_HEADER_SIZE]);
+
+    /* no mask selects all data blocks */
+    length = TEST_CANTX_SerializeSnapshot(0u, test_snapshot, sizeof(test_snapshot));
+    TEST_ASSERT_EQUAL_HEX8(0u, test_snapshot[3] & CANTX_SNAPSHOT_FLAG_TRUNCATED);
+    TEST_ASSERT_EQUAL_UINT8(DATA_BLOCK_ID_MAX, TEST_DecodeAndCompareSnapshot(test_snapshot, length));
+}
+
+void testCANTX_SerializeSnapshotRetriesConcurrentlyWrittenDataBlocks(void) {
+    const uint64_t blockMask = DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CELL_VOLTAGE);
+
+    /* the data block has been written during the first attempt */
+    test_failingReturns = 1u;
+    uint32_t length     = TEST_CANTX_SerializeSnapshot(blockMask, test_snapshot, sizeof(test_snapshot));
+    TEST_ASSERT_EQUAL_HEX8(0u, test_snapshot[CANTX_SNAPSHOT_HEADER_SIZE + 1u]);
+    TEST_ASSERT_EQUAL_UINT8(1u, TEST_DecodeAndCompareSnapshot(test_snapshot, length));
+
+    /* the data block has been written during every attempt */
+    test_failingReturns = DATA_MAXIMUM_BORROW_ATTEMPTS;
+    length              = TEST_CANTX_SerializeSnapshot(blockMask, test_snapshot, sizeof(test_snapshot));
+    TEST_ASSERT_EQUAL_UINT32(0u, test_failingReturns);
+    TEST_ASSERT_EQUAL_HEX8(CANTX_SNAPSHOT_BLOCK_FLAG_INCONSISTENT, test_snapshot[CANTX_SNAPSHOT_HEADER_SIZE + 1u]);
+    TEST_ASSERT_EQUAL_UINT8(1u, TEST_DecodeAndCompareSnapshot(test_snapshot, length));
+}
+
+void testCANTX_SerializeSnapshotTruncatesSnapshot(void) {
+    const uint64_t blockMask = DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CELL_VOLTAGE) |
+                               DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CELL_TEMPERATURE);
+    const uint32_t fullLength = TEST_CANTX_SerializeSnapshot(blockMask, test_snapshot, sizeof(test_snapshot));
+
+    /* the buffer lacks one byte for the second data block */
+    const uint32_t length = TEST_CANTX_SerializeSnapshot(blockMask, test_snapshot, fullLength - 1u);
+    TEST_ASSERT_EQUAL_HEX8(CANTX_SNAPSHOT_FLAG_TRUNCATED, test_snapshot[3] & CANTX_SNAPSHOT_FLAG_TRUNCATED);
+    TEST_ASSERT_EQUAL_UINT8(1u, TEST_DecodeAndCompareSnapshot(test_snapshot, length));
+    TEST_ASSERT_TRUE(length < fullLength);
+
+    /* not even the block record header fits */
+    TEST_ASSERT_EQUAL_UINT32(
+        CANTX_SNAPSHOT_HEADER_SIZE, TEST_CANTX_SerializeSnapshot(blockMask, test_snapshot, CANTX_SNAPSHOT_HEADER_SIZE));
+    TEST_ASSERT_EQUAL_HEX8(CANTX_SNAPSHOT_FLAG_TRUNCATED, test_snapshot[3] & CANTX_SNAPSHOT_FLAG_TRUNCATED);
+    TEST_ASSERT_EQUAL_UINT8(0u, test_snapshot[5]);
+}
+
+void testCANTX_SnapshotTransmitWithoutRequest(void) {
+    TEST_Transmit();
+    TEST_ASSERT_EQUAL_UINT32(0u, test_numberOfFrames);
+
+    /* a flow control request without a transfer is ignored */
+    CANTX_SetSnapshotFlowControl(CANTX_SNAPSHOT_FLOW_STATUS_CONTINUE_TO_SEND, 0u, 0u);
+    TEST_Transmit();
+    TEST_ASSERT_EQUAL_UINT32(0u, test_numberOfFrames);
+}
+
+void testCANTX_SnapshotTransmitSerializesDataBlocksIncrementally(void) {
+    CANTX_RequestSnapshot(0u);
+    for (uint32_t i = 1u; i < TEST_SERIALIZATION_CALLS; i++) {
+        TEST_Transmit();
+        TEST_ASSERT_EQUAL_UINT32(i * CANTX_SNAPSHOT_MAXIMUM_BLOCKS_PER_CALL, test_borrowedBlocks);
+        TEST_ASSERT_EQUAL_UINT32(0u, test_numberOfFrames);
+    }
+    /* the first frame is sent with the last data blocks */
+    TEST_Transmit();
+    TEST_ASSERT_EQUAL_UINT32(DATA_BLOCK_ID_MAX, test_borrowedBlocks);
+    TEST_ASSERT_EQUAL_UINT32(1u, test_numberOfFrames);
+
+    /* a new request during the serialization starts again with the first data block */
+    test_borrowedBlocks = 0u;
+    CANTX_RequestSnapshot(0u);
+    TEST_Transmit();
+    CANTX_RequestSnapshot(DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_SOC));
+    TEST_Transmit();
+    TEST_ASSERT_EQUAL_UINT32(CANTX_SNAPSHOT_MAXIMUM_BLOCKS_PER_CALL + 1u, test_borrowedBlocks);
+    TEST_ASSERT_EQUAL_UINT32(2u, test_numberOfFrames);
+    const uint32_t length = TEST_CANTX_SerializeSnapshot(
+        DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_SOC), test_snapshot, sizeof(test_snapshot));
+    TEST_ASSERT_EQUAL_HEX8(CANTX_SNAPSHOT_FIRST_FRAME | (uint8_t)(length >> 8u), test_frames[1][0]);
+    TEST_ASSERT_EQUAL_HEX8((uint8_t)length, test_frames[1][1]);
+}
+
+void testCANTX_SnapshotTransmitFirstFrame(void) {
+    TEST_StartTransfer(DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_SOC));
+    const uint32_t length = TEST_CANTX_SerializeSnapshot(
+        DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_SOC), test_snapshot, sizeof(test_snapshot));
+    TEST_ASSERT_EQUAL_HEX8(CANTX_SNAPSHOT_FIRST_FRAME | (uint8_t)(length >> 8u), test_frames[0][0]);
+    TEST_ASSERT_EQUAL_HEX8((uint8_t)length, test_frames[0][1]);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(test_snapshot, &test_frames[0][2], 6u);
+
+    /* no consecutive frame without a flow control request */
+    for (uint8_t i = 0u; i < 10u; i++) {
+        TEST_Transmit();
+    }
+    TEST_ASSERT_EQUAL_UINT32(1u, test_numberOfFrames);
+}
+
+void testCANTX_SnapshotTransmitFirstFrameOfLongSnapshot(void) {
+    /* a data block that can not be compressed and fills the snapshot buffer */
+    static uint8_t largeBlock[TEST_LARGE_BLOCK_SIZE] = {0u};
+    for (uint32_t i = 0u; i < TEST_LARGE_BLOCK_SIZE; i++) {
+        largeBlock[i] = (uint8_t)((i % 255u) + 1u);
+    }
+    test_database[DATA_BLOCK_ID_USER_MUX].pkDataBlock = largeBlock;
+    test_database[DATA_BLOCK_ID_USER_MUX].dataLength  = TEST_LARGE_BLOCK_SIZE;
+
+    /* the length does not fit into the 12 bit length of the first frame */
+    TEST_StartTransfer(DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_USER_MUX));
+    TEST_ASSERT_EQUAL_HEX8(CANTX_SNAPSHOT_FIRST_FRAME, test_frames[0][0]);
+    TEST_ASSERT_EQUAL_HEX8(0u, test_frames[0][1]);
+    TEST_ASSERT_EQUAL_UINT32(CANTX_SNAPSHOT_BUFFER_SIZE, TEST_ReadUint32(&test_frames[0][2]));
+
+    CANTX_SetSnapshotFlowControl(CANTX_SNAPSHOT_FLOW_STATUS_CONTINUE_TO_SEND, 0u, 0u);
+    for (uint32_t i = 0u; i < TEST_MAXIMUM_NUMBER_OF_FRAMES; i++) {
+        TEST_Transmit();
+    }
+    const uint32_t length = TEST_ReassembleFrames(test_snapshot, sizeof(test_snapshot));
+    TEST_ASSERT_EQUAL_UINT8(1u, TEST_DecodeAndCompareSnapshot(test_snapshot, length));
+}
+
+void testCANTX_SnapshotTransmitRetriesWithoutFreeMessageBox(void) {
+    test_failingSends = 1u;
+    CANTX_RequestSnapshot(0u);
+    for (uint32_t i = 0u; i < TEST_SERIALIZATION_CALLS; i++) {
+        TEST_Transmit();
+    }
+    TEST_ASSERT_EQUAL_UINT32(0u, test_failingSends);
+    TEST_ASSERT_EQUAL_UINT32(0u, test_numberOfFrames);
+    TEST_Transmit();
+    TEST_ASSERT_EQUAL_UINT32(1u, test_numberOfFrames);
+
+    CANTX_SetSnapshotFlowControl(CANTX_SNAPSHOT_FLOW_STATUS_CONTINUE_TO_SEND, 0u, 0u);
+    test_failingSends = 1u;
+    TEST_Transmit();
+    TEST_ASSERT_EQUAL_UINT32(1u, test_numberOfFrames);
+    TEST_Transmit();
+    TEST_ASSERT_EQUAL_UINT32(1u + CANTX_SNAPSHOT_MAXIMUM_FRAMES_PER_CALL, test_numberOfFrames);
+    TEST_ASSERT_EQUAL_HEX8(CANTX_SNAPSHOT_CONSECUTIVE_FRAME | 1u, test_frames[1][0]);
+}
+
+void testCANTX_SnapshotTransmitBlockSize(void) {
+    TEST_StartTransfer(0u);
+    CANTX_SetSnapshotFlowControl(CANTX_SNAPSHOT_FLOW_STATUS_CONTINUE_TO_SEND, 3u, 0u);
+    TEST_Transmit();
+    TEST_ASSERT_EQUAL_UINT32(1u + 3u, test_numberOfFrames);
+
+    /* the next block needs the next flow control request */
+    TEST_Transmit();
+    TEST_ASSERT_EQUAL_UINT32(1u + 3u, test_numberOfFrames);
+    CANTX_SetSnapshotFlowControl(CANTX_SNAPSHOT_FLOW_STATUS_CONTINUE_TO_SEND, 2u, 0u);
+    TEST_Transmit();
+    TEST_ASSERT_EQUAL_UINT32(1u + 3u + 2u, test_numberOfFrames);
+    TEST_ASSERT_EQUAL_HEX8(CANTX_SNAPSHOT_CONSECUTIVE_FRAME | 5u, test_frames[5][0]);
+}
+
+void testCANTX_SnapshotTransmitSeparationTime(void) {
+    TEST_StartTransfer(0u);
+    CANTX_SetSnapshotFlowControl(CANTX_SNAPSHOT_FLOW_STATUS_CONTINUE_TO_SEND, 0u, 20u);
+    /* one frame every 20ms, i.e., every second call */
+    for (uint8_t i = 0u; i < 10u; i++) {
+        TEST_Transmit();
+    }
+    TEST_ASSERT_EQUAL_UINT32(1u + 5u, test_numberOfFrames);
+}
+
+void testCANTX_SnapshotTransmitWaitAndTimeout(void) {
+    TEST_StartTransfer(0u);
+
+    /* a wait request restarts the timeout */
+    for (uint32_t i = 0u; i < ((CANTX_SNAPSHOT_FLOW_CONTROL_TIMEOUT_ms / TEST_TASK_PERIOD_ms) - 1u); i++) {
+        TEST_Transmit();
+    }
+    CANTX_SetSnapshotFlowControl(CANTX_SNAPSHOT_FLOW_STATUS_WAIT, 0u, 0u);
+    TEST_Transmit();
+    for (uint32_t i = 0u; i < ((CANTX_SNAPSHOT_FLOW_CONTROL_TIMEOUT_ms / TEST_TASK_PERIOD_ms) - 1u); i++) {
+        TEST_Transmit();
+    }
+    CANTX_SetSnapshotFlowControl(CANTX_SNAPSHOT_FLOW_STATUS_CONTINUE_TO_SEND, 1u, 0u);
+    TEST_Transmit();
+    TEST_ASSERT_EQUAL_UINT32(2u, test_numberOfFrames);
+
+    /* the host does not respond anymore */
+    for (uint32_t i = 0u; i < (CANTX_SNAPSHOT_FLOW_CONTROL_TIMEOUT_ms / TEST_TASK_PERIOD_ms); i++) {
+        TEST_Transmit();
+    }
+    CANTX_SetSnapshotFlowControl(CANTX_SNAPSHOT_FLOW_STATUS_CONTINUE_TO_SEND, 0u, 0u);
+    TEST_Transmit();
+    TEST_ASSERT_EQUAL_UINT32(2u, test_numberOfFrames);
+}
+
+void testCANTX_SnapshotTransmitAbort(void) {
+    TEST_StartTransfer(0u);
+    CANTX_SetSnapshotFlowControl(CANTX_SNAPSHOT_FLOW_STATUS_ABORT, 0u, 0u);
+    TEST_Transmit();
+    CANTX_SetSnapshotFlowControl(CANTX_SNAPSHOT_FLOW_STATUS_CONTINUE_TO_SEND, 0u, 0u);
+    TEST_Transmit();
+    TEST_ASSERT_EQUAL_UINT32(1u, test_numberOfFrames);
+
+    /* a new request restarts the transfer */
+    TEST_StartTransfer(DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_SOC));
+}
+
+void testCANTX_SnapshotLoopback(void) {
+    static uint8_t reassembled[CANTX_SNAPSHOT_BUFFER_SIZE] = {0u};
+    TEST_StartTransfer(0u);
+    CANTX_SetSnapshotFlowControl(CANTX_SNAPSHOT_FLOW_STATUS_CONTINUE_TO_SEND, 0u, 0u);
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+    /* calls of the transfer up to the last frame, including the start of the transfer */
+    uint32_t calls = 1u;
+#endif
+    for (uint32_t i = 0u; i < TEST_MAXIMUM_NUMBER_OF_FRAMES; i++) {
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+        const uint32_t framesBefore = test_numberOfFrames;
+#endif
+        TEST_Transmit();
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+        if (test_numberOfFrames != framesBefore) {
+            calls = i + 2u;
+        }
+#endif
+    }
+    const uint32_t length = TEST_ReassembleFrames(reassembled, sizeof(reassembled));
+    TEST_ASSERT_EQUAL_HEX8(0u, reassembled[3] & CANTX_SNAPSHOT_FLAG_TRUNCATED);
+    TEST_ASSERT_EQUAL_UINT8(DATA_BLOCK_ID_MAX, TEST_DecodeAndCompareSnapshot(reassembled, length));
+    /* the transfer ends with the last byte of the snapshot */
+    TEST_ASSERT_EQUAL_UINT32(((length - 6u) + 6u) / 7u + 1u, test_numberOfFrames);
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+    uint32_t rawLength = 0u;
+    for (uint8_t blockId = 0u; blockId < (uint8_t)DATA_BLOCK_ID_MAX; blockId++) {
+        rawLength += test_database[blockId].dataLength;
+    }
+
+    clock_t start = clock();
+    for (uint32_t i = 0u; i < TEST_BENCHMARK_REPETITIONS; i++) {
+        (void)TEST_CANTX_SerializeSnapshot(0u, test_snapshot, sizeof(test_snapshot));
+    }
+    const clock_t serializeTicks = clock() - start;
+    start                        = clock();
+    for (uint32_t i = 0u; i < TEST_BENCHMARK_REPETITIONS; i++) {
+        (void)TEST_DecodeAndCompareSnapshot(reassembled, length);
+    }
+    const clock_t decodeTicks = clock() - start;
+
+    char message[200] = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "%u data blocks: %u bytes raw, %u bytes snapshot (%.1f %%), %u frames in %u calls (%u ms at %u ms period)",
+        (unsigned int)DATA_BLOCK_ID_MAX,
+        (unsigned int)rawLength,
+        (unsigned int)length,
+        (100.0 * (double)length) / (double)rawLength,
+        (unsigned int)test_numberOfFrames,
+        (unsigned int)calls,
+        (unsigned int)(calls * TEST_TASK_PERIOD_ms),
+        (unsigned int)TEST_TASK_PERIOD_ms);
+    TEST_MESSAGE(message);
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "serialize: %.2f us/snapshot (%.1f MB/s); reassembled decode and compare: %.2f us/snapshot",
+        (1.0e6 * (double)serializeTicks) / ((double)CLOCKS_PER_SEC * (double)TEST_BENCHMARK_REPETITIONS),
+        ((double)rawLength * (double)TEST_BENCHMARK_REPETITIONS * (double)CLOCKS_PER_SEC) /
+            (1.0e6 * (double)serializeTicks),
+        (1.0e6 * (double)decodeTicks) / ((double)CLOCKS_PER_SEC * (double)TEST_BENCHMARK_REPETITIONS));
+    TEST_MESSAGE(message);
+#endif
+}
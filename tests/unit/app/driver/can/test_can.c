@@ -43,7 +43,7 @@
  * @file    test_can.c
  * @author  foxBMS Team
  * @date    2020-04-01 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -175,12 +175,15 @@ const CAN_SHIM_s can_kShim = {
     .pTableStateRequest    = &can_tableStateRequest,
 };
 
+/** return value of the dummy tx callback */
+static uint32_t test_txCallbackReturnValue = CAN_TX_TRANSMIT_MESSAGE;
+
 static uint32_t TEST_CANTX_DummyCallback(
     CAN_MESSAGE_PROPERTIES_s message,
     uint8_t *pCanData,
     uint8_t *pMuxId,
     const CAN_SHIM_s *const kpkCanShim) {
-    return 0;
+    return test_txCallbackReturnValue;
 }
 
 static uint32_t TEST_CANRX_DummyCallback(
@@ -407,6 +410,18 @@ void testCAN_PeriodicTransmitQueueHasSpace(void) {
     }
 }
 
+void testCAN_PeriodicTransmitSkippedMessage(void) {
+    /* Assume no messages in queue */
+    OS_ReceiveFromQueue_IgnoreAndReturn(OS_FAIL);
+
+    /* callback has nothing to send: neither the message boxes nor the queue are used */
+    test_txCallbackReturnValue = CAN_TX_SKIP_MESSAGE;
+    for (uint16_t i = 0; i <= numberOfRepetitionsToReset; i++) {
+        TEST_CAN_PeriodicTransmit();
+    }
+    test_txCallbackReturnValue = CAN_TX_TRANSMIT_MESSAGE;
+}
+
 void testCAN_IsMessagePeriodElapsed(void) {
     /* Invalid messageIndex */
     TEST_ASSERT_FAIL_ASSERT(TEST_CAN_IsMessagePeriodElapsed(0u, UINT16_MAX));
@@ -43,7 +43,7 @@
  * @file    test_foxmath.c
  * @author  foxBMS Team
  * @date    2020-04-01 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -56,6 +56,13 @@
 #include "unity.h"
 
 #include "foxmath.h"
+#include "fstd_types.h"
+#include "test_assert_helper.h"
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#include <time.h>
+#endif
 
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_INCLUDE_PATH("../../src/app/driver/foxmath")
@@ -187,3 +194,435 @@ void test_MATH_MinimumOfTwoUint16_t(void) {
     TEST_ASSERT_EQUAL_UINT16(0u, MATH_MinimumOfTwoUint16_t(UINT16_MAX, 0u));
     TEST_ASSERT_EQUAL_UINT16(0u, MATH_MinimumOfTwoUint16_t(0u, UINT16_MAX));
 }
+
+void test_MATH_FloatToQ16_16(void) {
+    TEST_ASSERT_EQUAL_INT32(MATH_Q16_16_ONE, MATH_FloatToQ16_16(1.0f));
+    TEST_ASSERT_EQUAL_INT32(-98304, MATH_FloatToQ16_16(-1.5f));
+    /* half an LSB is rounded away from zero */
+    TEST_ASSERT_EQUAL_INT32(1, MATH_FloatToQ16_16(1.0f / 131072.0f));
+    TEST_ASSERT_EQUAL_INT32(-1, MATH_FloatToQ16_16(-1.0f / 131072.0f));
+    /* saturation and invalid values */
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, MATH_FloatToQ16_16(32768.0f));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, MATH_FloatToQ16_16(-40000.0f));
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, MATH_FloatToQ16_16(INFINITY));
+    TEST_ASSERT_EQUAL_INT32(0, MATH_FloatToQ16_16(NAN));
+    /* values with a resolution of at least 2^-16 are converted without loss */
+    TEST_ASSERT_EQUAL_FLOAT(12.25f, MATH_Q16_16ToFloat(MATH_FloatToQ16_16(12.25f)));
+    TEST_ASSERT_EQUAL_FLOAT(-32768.0f, MATH_Q16_16ToFloat(INT32_MIN));
+}
+
+void test_MATH_Int32AndQ16_16(void) {
+    TEST_ASSERT_EQUAL_INT32(196608, MATH_Int32ToQ16_16(3));
+    TEST_ASSERT_EQUAL_INT32(-196608, MATH_Int32ToQ16_16(-3));
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, MATH_Int32ToQ16_16(32768));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, MATH_Int32ToQ16_16(-40000));
+
+    TEST_ASSERT_EQUAL_INT32(2, MATH_Q16_16ToInt32(98304));
+    TEST_ASSERT_EQUAL_INT32(-2, MATH_Q16_16ToInt32(-98304));
+    TEST_ASSERT_EQUAL_INT32(1, MATH_Q16_16ToInt32(98303));
+    TEST_ASSERT_EQUAL_INT32(32768, MATH_Q16_16ToInt32(INT32_MAX));
+}
+
+void test_MATH_AddAndSubtractQ16_16(void) {
+    TEST_ASSERT_EQUAL_INT32(3 * MATH_Q16_16_ONE, MATH_AddQ16_16(MATH_Q16_16_ONE, 2 * MATH_Q16_16_ONE));
+    TEST_ASSERT_EQUAL_INT32(-MATH_Q16_16_ONE, MATH_SubtractQ16_16(MATH_Q16_16_ONE, 2 * MATH_Q16_16_ONE));
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, MATH_AddQ16_16(INT32_MAX, 1));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, MATH_AddQ16_16(INT32_MIN, -1));
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, MATH_SubtractQ16_16(INT32_MAX, -1));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, MATH_SubtractQ16_16(INT32_MIN, 1));
+}
+
+void test_MATH_MultiplyQ16_16(void) {
+    TEST_ASSERT_EQUAL_INT32(3 * MATH_Q16_16_ONE, MATH_MultiplyQ16_16(98304, 2 * MATH_Q16_16_ONE));
+    TEST_ASSERT_EQUAL_INT32(-16384, MATH_MultiplyQ16_16(-32768, 32768));
+    /* the product of the smallest positive values is rounded to 0 */
+    TEST_ASSERT_EQUAL_INT32(0, MATH_MultiplyQ16_16(1, 1));
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, MATH_MultiplyQ16_16(MATH_Int32ToQ16_16(200), MATH_Int32ToQ16_16(200)));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, MATH_MultiplyQ16_16(MATH_Int32ToQ16_16(-200), MATH_Int32ToQ16_16(200)));
+}
+
+void test_MATH_DivideQ16_16(void) {
+    TEST_ASSERT_EQUAL_INT32(98304, MATH_DivideQ16_16(3 * MATH_Q16_16_ONE, 2 * MATH_Q16_16_ONE));
+    TEST_ASSERT_EQUAL_INT32(21845, MATH_DivideQ16_16(MATH_Q16_16_ONE, 3 * MATH_Q16_16_ONE));
+    TEST_ASSERT_EQUAL_INT32(-21845, MATH_DivideQ16_16(-MATH_Q16_16_ONE, 3 * MATH_Q16_16_ONE));
+    TEST_ASSERT_EQUAL_INT32(43691, MATH_DivideQ16_16(2 * MATH_Q16_16_ONE, 3 * MATH_Q16_16_ONE));
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, MATH_DivideQ16_16(MATH_Int32ToQ16_16(30000), MATH_Q16_16_ONE / 2));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, MATH_DivideQ16_16(MATH_Int32ToQ16_16(-30000), MATH_Q16_16_ONE / 2));
+    /* division by zero saturates */
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, MATH_DivideQ16_16(1, 0));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, MATH_DivideQ16_16(-1, 0));
+    TEST_ASSERT_EQUAL_INT32(0, MATH_DivideQ16_16(0, 0));
+}
+
+void test_MATH_DivideInt64ToQ16_16(void) {
+    /* ratio of quantities that exceed the range of Q16.16 */
+    TEST_ASSERT_EQUAL_INT32(21845, MATH_DivideInt64ToQ16_16(1000000000000LL, 3000000000000LL));
+    TEST_ASSERT_EQUAL_INT32(-1638400, MATH_DivideInt64ToQ16_16(-25000000000LL, 1000000000LL));
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, MATH_DivideInt64ToQ16_16(INT64_MAX, 3));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, MATH_DivideInt64ToQ16_16(-32769, 1));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, MATH_DivideInt64ToQ16_16(-32768, 1));
+    TEST_ASSERT_FAIL_ASSERT(MATH_DivideInt64ToQ16_16(1, INT64_MAX));
+    TEST_ASSERT_FAIL_ASSERT(MATH_DivideInt64ToQ16_16(INT64_MIN, 1));
+}
+
+void test_MATH_AccumulateQ16_16(void) {
+    int64_t remainder = 0;
+    int32_t sum       = 0;
+    /* increments that are smaller than one LSB are not lost */
+    for (uint32_t i = 0u; i < 300u; i++) {
+        sum += MATH_AccumulateQ16_16(&remainder, 1, 3);
+    }
+    TEST_ASSERT_EQUAL_INT32(100, sum);
+    TEST_ASSERT_EQUAL_INT64(0, remainder);
+
+    for (uint32_t i = 0u; i < 1000u; i++) {
+        sum += MATH_AccumulateQ16_16(&remainder, -7, 10);
+    }
+    TEST_ASSERT_EQUAL_INT32(-600, sum);
+    TEST_ASSERT_EQUAL_INT64(0, remainder);
+
+    /* the result saturates, the excess is kept in the remainder */
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, MATH_AccumulateQ16_16(&remainder, INT64_MAX, 1));
+    TEST_ASSERT_EQUAL_INT64(INT64_MAX - (int64_t)INT32_MAX, remainder);
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, MATH_AccumulateQ16_16(&remainder, INT64_MAX, 1));
+    TEST_ASSERT_EQUAL_INT64(INT64_MAX - (int64_t)INT32_MAX, remainder);
+
+    TEST_ASSERT_FAIL_ASSERT(MATH_AccumulateQ16_16(NULL_PTR, 1, 1));
+    TEST_ASSERT_FAIL_ASSERT(MATH_AccumulateQ16_16(&remainder, 1, 0));
+}
+
+void test_MATH_LinearInterpolationQ16_16(void) {
+    const MATH_Q16_16 x1 = MATH_Int32ToQ16_16(10);
+    const MATH_Q16_16 y1 = MATH_Int32ToQ16_16(50);
+    const MATH_Q16_16 x2 = MATH_Int32ToQ16_16(20);
+    const MATH_Q16_16 y2 = MATH_Int32ToQ16_16(100);
+
+    TEST_ASSERT_EQUAL_INT32(y1, MATH_LinearInterpolationQ16_16(x1, y1, x1, y2, MATH_Int32ToQ16_16(15)));
+    TEST_ASSERT_EQUAL_INT32(MATH_Int32ToQ16_16(75), MATH_LinearInterpolationQ16_16(x1, y1, x2, y2, 15 * 65536));
+    TEST_ASSERT_EQUAL_INT32(MATH_FloatToQ16_16(87.5f), MATH_LinearInterpolationQ16_16(x1, y1, x2, y2, 1146880));
+    TEST_ASSERT_EQUAL_INT32(
+        MATH_Int32ToQ16_16(-100), MATH_LinearInterpolationQ16_16(x1, y1, x2, y2, MATH_Int32ToQ16_16(-20)));
+    /* interpolation in descending order */
+    TEST_ASSERT_EQUAL_INT32(MATH_Int32ToQ16_16(75), MATH_LinearInterpolationQ16_16(x2, y2, x1, y1, 15 * 65536));
+    /* far extrapolation saturates */
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, MATH_LinearInterpolationQ16_16(x1, y1, x2, y2, MATH_Int32ToQ16_16(10000)));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, MATH_LinearInterpolationQ16_16(x1, y1, x2, y2, MATH_Int32ToQ16_16(-10000)));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, MATH_LinearInterpolationQ16_16(0, INT32_MIN, 1, INT32_MAX, INT32_MIN));
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, MATH_LinearInterpolationQ16_16(0, INT32_MAX, 1, INT32_MIN, INT32_MIN));
+}
+
+void test_MATH_LinearInterpolationQ16_16EquivalentToFloat(void) {
+    /* segment of a SOC lookup table: voltage in mV, SOC in percent */
+    const float_t x1 = 3512.0f;
+    const float_t y1 = 12.3f;
+    const float_t x2 = 3587.0f;
+    const float_t y2 = 31.7f;
+    for (int32_t voltage_mV = 3400; voltage_mV <= 3700; voltage_mV++) {
+        const float_t expected   = MATH_LinearInterpolation(x1, y1, x2, y2, (float_t)voltage_mV);
+        const MATH_Q16_16 actual = MATH_LinearInterpolationQ16_16(
+            MATH_FloatToQ16_16(x1),
+            MATH_FloatToQ16_16(y1),
+            MATH_FloatToQ16_16(x2),
+            MATH_FloatToQ16_16(y2),
+            MATH_Int32ToQ16_16(voltage_mV));
+        /* the quantization of y1 and y2 dominates the difference */
+        TEST_ASSERT_FLOAT_WITHIN(4.0f / 65536.0f, expected, MATH_Q16_16ToFloat(actual));
+    }
+}
+
+void test_MATH_Q31(void) {
+    TEST_ASSERT_EQUAL_INT32(1073741824, MATH_FloatToQ31(0.5f));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, MATH_FloatToQ31(-1.0f));
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, MATH_FloatToQ31(1.0f));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, MATH_FloatToQ31(-2.0f));
+    TEST_ASSERT_EQUAL_INT32(0, MATH_FloatToQ31(NAN));
+    TEST_ASSERT_EQUAL_FLOAT(0.5f, MATH_Q31ToFloat(1073741824));
+    TEST_ASSERT_EQUAL_FLOAT(-1.0f, MATH_Q31ToFloat(INT32_MIN));
+
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, MATH_AddQ31(1073741824, 1073741824));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, MATH_AddQ31(INT32_MIN, -1));
+    TEST_ASSERT_EQUAL_INT32(536870912, MATH_MultiplyQ31(1073741824, 1073741824));
+    TEST_ASSERT_EQUAL_INT32(-536870912, MATH_MultiplyQ31(-1073741824, 1073741824));
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, MATH_MultiplyQ31(INT32_MIN, INT32_MIN));
+
+    TEST_ASSERT_EQUAL_INT32(MATH_Int32ToQ16_16(25), MATH_MultiplyQ16_16ByQ31(MATH_Int32ToQ16_16(100), 536870912));
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, MATH_MultiplyQ16_16ByQ31(INT32_MIN, INT32_MIN));
+}
+
+void test_MATH_StartupSelfTest(void) {
+    MATH_StartupSelfTest();
+}
+
+/** integration of a small current as done by the counting based SOC estimation */
+void test_MATH_AccumulateQ16_16IntegratesWithoutDrift(void) {
+    /* 100 mA every 100 ms for one day, string capacity 3500 mAh */
+    const uint32_t steps          = 864000u;
+    const int64_t current_mA      = 100;
+    const int64_t timeStep_ms     = 100;
+    const int64_t capacity_uAs    = 3500LL * 3600000LL;
+    const double expectedSoc_perc = 100.0 - (100.0 * (double)(current_mA * timeStep_ms * (int64_t)steps)) /
+                                                (double)capacity_uAs;
+
+    MATH_Q16_16 fixedPointSoc_perc = MATH_Int32ToQ16_16(100);
+    int64_t remainder              = 0;
+    for (uint32_t i = 0u; i < steps; i++) {
+        const MATH_Q16_16 deltaSoc_perc =
+            MATH_AccumulateQ16_16(&remainder, current_mA * timeStep_ms * MATH_Q16_16_ONE, capacity_uAs / 100);
+        fixedPointSoc_perc = MATH_SubtractQ16_16(fixedPointSoc_perc, deltaSoc_perc);
+    }
+
+    /* the fixed-point integration is exact up to the resolution of Q16.16 */
+    const double fixedPointError_perc = fabs(expectedSoc_perc - (double)MATH_Q16_16ToFloat(fixedPointSoc_perc));
+    TEST_ASSERT_TRUE(fixedPointError_perc <= (1.0 / 65536.0));
+}
+
+void test_MATH_CountSetBitsUint64_t(void) {
+    TEST_ASSERT_EQUAL_UINT8(0u, MATH_CountSetBitsUint64_t(0u));
+    TEST_ASSERT_EQUAL_UINT8(1u, MATH_CountSetBitsUint64_t(0x8000000000000000uLL));
+    TEST_ASSERT_EQUAL_UINT8(14u, MATH_CountSetBitsUint64_t(0x3FFFu));
+    TEST_ASSERT_EQUAL_UINT8(32u, MATH_CountSetBitsUint64_t(0xAAAAAAAAAAAAAAAAuLL));
+    TEST_ASSERT_EQUAL_UINT8(64u, MATH_CountSetBitsUint64_t(UINT64_MAX));
+
+    /* compare against clearing the lowest set bit until the value is 0 */
+    uint64_t value = 0x0123456789ABCDEFuLL;
+    for (uint16_t i = 0u; i < 1000u; i++) {
+        uint64_t remainingBits = value;
+        uint8_t expected       = 0u;
+        while (remainingBits != 0u) {
+            remainingBits &= (remainingBits - 1u);
+            expected++;
+        }
+        TEST_ASSERT_EQUAL_UINT8(expected, MATH_CountSetBitsUint64_t(value));
+        value = (value * 6364136223846793005uLL) + 1442695040888963407uLL;
+    }
+}
+
+void test_MATH_CountSetBitsInBitmap(void) {
+    const uint64_t bitmap[3] = {0x3u, 0xC000000000000001uLL, 0x0u};
+    TEST_ASSERT_EQUAL_UINT16(5u, MATH_CountSetBitsInBitmap(bitmap, 3u, UINT64_MAX));
+    /* only the selected bits of each word are counted */
+    TEST_ASSERT_EQUAL_UINT16(3u, MATH_CountSetBitsInBitmap(bitmap, 3u, 0x3FFFu));
+    TEST_ASSERT_EQUAL_UINT16(2u, MATH_CountSetBitsInBitmap(bitmap, 1u, UINT64_MAX));
+    TEST_ASSERT_EQUAL_UINT16(0u, MATH_CountSetBitsInBitmap(bitmap, 0u, UINT64_MAX));
+    TEST_ASSERT_FAIL_ASSERT(MATH_CountSetBitsInBitmap(NULL_PTR, 1u, UINT64_MAX));
+}
+
+void test_MATH_AndOrBitmaps(void) {
+    const uint64_t base[2]       = {0x0Fu, 0x8000000000000000uLL};
+    const uint64_t redundancy[2] = {0x3Cu, 0x8000000000000001uLL};
+    uint64_t result[2]           = {0u};
+
+    MATH_AndBitmaps(base, redundancy, result, 2u);
+    TEST_ASSERT_EQUAL_HEX64(0x0Cu, result[0]);
+    TEST_ASSERT_EQUAL_HEX64(0x8000000000000000uLL, result[1]);
+
+    MATH_OrBitmaps(base, redundancy, result, 2u);
+    TEST_ASSERT_EQUAL_HEX64(0x3Fu, result[0]);
+    TEST_ASSERT_EQUAL_HEX64(0x8000000000000001uLL, result[1]);
+
+    /* the result may replace an operand */
+    uint64_t inPlace[2] = {0x0Fu, 0x8000000000000000uLL};
+    MATH_AndBitmaps(inPlace, redundancy, inPlace, 2u);
+    TEST_ASSERT_EQUAL_HEX64(0x0Cu, inPlace[0]);
+    TEST_ASSERT_EQUAL_HEX64(0x8000000000000000uLL, inPlace[1]);
+
+    TEST_ASSERT_FAIL_ASSERT(MATH_AndBitmaps(NULL_PTR, redundancy, result, 2u));
+    TEST_ASSERT_FAIL_ASSERT(MATH_AndBitmaps(base, NULL_PTR, result, 2u));
+    TEST_ASSERT_FAIL_ASSERT(MATH_AndBitmaps(base, redundancy, NULL_PTR, 2u));
+    TEST_ASSERT_FAIL_ASSERT(MATH_OrBitmaps(NULL_PTR, redundancy, result, 2u));
+    TEST_ASSERT_FAIL_ASSERT(MATH_OrBitmaps(base, NULL_PTR, result, 2u));
+    TEST_ASSERT_FAIL_ASSERT(MATH_OrBitmaps(base, redundancy, NULL_PTR, 2u));
+}
+
+void test_MATH_FindFirstSetBitInBitmap(void) {
+    const uint64_t bitmap[3] = {0x0u, 0x8000000000000000uLL | (1uLL << 17u), 0x1u};
+    uint16_t word            = 0xFFFFu;
+    uint8_t bit              = 0xFFu;
+
+    TEST_ASSERT_TRUE(MATH_FindFirstSetBitInBitmap(bitmap, 3u, UINT64_MAX, &word, &bit));
+    TEST_ASSERT_EQUAL_UINT16(1u, word);
+    TEST_ASSERT_EQUAL_UINT8(17u, bit);
+
+    /* bits outside of the mask are ignored */
+    TEST_ASSERT_TRUE(MATH_FindFirstSetBitInBitmap(bitmap, 3u, 0x3FFFu, &word, &bit));
+    TEST_ASSERT_EQUAL_UINT16(2u, word);
+    TEST_ASSERT_EQUAL_UINT8(0u, bit);
+
+    TEST_ASSERT_TRUE(MATH_FindFirstSetBitInBitmap(&bitmap[1], 1u, 0x8000000000000000uLL, &word, &bit));
+    TEST_ASSERT_EQUAL_UINT16(0u, word);
+    TEST_ASSERT_EQUAL_UINT8(63u, bit);
+
+    /* nothing found: outputs are not changed */
+    word = 0xFFFFu;
+    bit  = 0xFFu;
+    TEST_ASSERT_FALSE(MATH_FindFirstSetBitInBitmap(bitmap, 1u, UINT64_MAX, &word, &bit));
+    TEST_ASSERT_EQUAL_UINT16(0xFFFFu, word);
+    TEST_ASSERT_EQUAL_UINT8(0xFFu, bit);
+
+    TEST_ASSERT_FAIL_ASSERT(MATH_FindFirstSetBitInBitmap(NULL_PTR, 1u, UINT64_MAX, &word, &bit));
+    TEST_ASSERT_FAIL_ASSERT(MATH_FindFirstSetBitInBitmap(bitmap, 1u, UINT64_MAX, NULL_PTR, &bit));
+    TEST_ASSERT_FAIL_ASSERT(MATH_FindFirstSetBitInBitmap(bitmap, 1u, UINT64_MAX, &word, NULL_PTR));
+}
+
+/** counting and merging the invalid flags of a large pack as bitmaps gives the same result as bit by bit */
+void test_MATH_BitmapsEquivalentToBitByBit(void) {
+    /* 16 strings with 24 modules of 18 cell blocks each */
+    enum { nrOfStrings = 16, nrOfModules = 24, nrOfCellBlocks = 18 };
+    const uint64_t cellBlockMask = (1uLL << nrOfCellBlocks) - 1u;
+    static uint64_t base[nrOfStrings][nrOfModules];
+    static uint64_t redundancy[nrOfStrings][nrOfModules];
+    static uint64_t bitwiseMerged[nrOfStrings][nrOfModules];
+    static uint64_t bitmapMerged[nrOfStrings][nrOfModules];
+
+    uint64_t random = 1u;
+    for (uint8_t s = 0u; s < nrOfStrings; s++) {
+        for (uint8_t m = 0u; m < nrOfModules; m++) {
+            random           = (random * 6364136223846793005uLL) + 1442695040888963407uLL;
+            base[s][m]       = (random >> 20u) & (random >> 40u) & cellBlockMask;
+            random           = (random * 6364136223846793005uLL) + 1442695040888963407uLL;
+            redundancy[s][m] = (random >> 20u) & (random >> 40u) & cellBlockMask;
+        }
+    }
+
+    /* bit by bit: merge base and redundancy and count the valid cell blocks */
+    uint32_t bitwiseValid = 0u;
+    for (uint8_t s = 0u; s < nrOfStrings; s++) {
+        for (uint8_t m = 0u; m < nrOfModules; m++) {
+            for (uint8_t cb = 0u; cb < nrOfCellBlocks; cb++) {
+                const uint64_t cellBlock = (uint64_t)1u << cb;
+                if (((base[s][m] & cellBlock) != 0u) && ((redundancy[s][m] & cellBlock) != 0u)) {
+                    bitwiseMerged[s][m] |= cellBlock;
+                } else {
+                    bitwiseMerged[s][m] &= ~cellBlock;
+                    bitwiseValid++;
+                }
+            }
+        }
+    }
+
+    /* bitmaps: merge each string at once and count with popcount */
+    uint32_t bitmapValid = 0u;
+    for (uint8_t s = 0u; s < nrOfStrings; s++) {
+        MATH_AndBitmaps(base[s], redundancy[s], bitmapMerged[s], nrOfModules);
+        bitmapValid += (uint32_t)(nrOfModules * nrOfCellBlocks) -
+                       MATH_CountSetBitsInBitmap(bitmapMerged[s], nrOfModules, cellBlockMask);
+    }
+
+    TEST_ASSERT_NOT_EQUAL_UINT32(0u, bitwiseValid);
+    TEST_ASSERT_EQUAL_UINT32(bitwiseValid, bitmapValid);
+    TEST_ASSERT_EQUAL_UINT64_ARRAY(bitwiseMerged, bitmapMerged, nrOfStrings * nrOfModules);
+}
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+/** host benchmark: integration of a small current as done by the counting based SOC estimation */
+void testFixedPointIntegrationBenchmark(void) {
+    /* 100 mA every 100 ms for one day, string capacity 3500 mAh */
+    const uint32_t steps          = 864000u;
+    const int64_t current_mA      = 100;
+    const int64_t timeStep_ms     = 100;
+    const int64_t capacity_uAs    = 3500LL * 3600000LL;
+    const float_t capacity_mAs    = 3500.0f * 3600.0f;
+    const double expectedSoc_perc = 100.0 - (100.0 * (double)(current_mA * timeStep_ms * (int64_t)steps)) /
+                                                (double)capacity_uAs;
+
+    float_t floatSoc_perc = 100.0f;
+    clock_t start         = clock();
+    for (uint32_t i = 0u; i < steps; i++) {
+        floatSoc_perc = floatSoc_perc -
+                        ((((float_t)current_mA * ((float_t)timeStep_ms / 1000.0f)) / capacity_mAs) * 100.0f);
+    }
+    const clock_t floatTicks = clock() - start;
+
+    MATH_Q16_16 fixedPointSoc_perc = MATH_Int32ToQ16_16(100);
+    int64_t remainder              = 0;
+    start                          = clock();
+    for (uint32_t i = 0u; i < steps; i++) {
+        const MATH_Q16_16 deltaSoc_perc =
+            MATH_AccumulateQ16_16(&remainder, current_mA * timeStep_ms * MATH_Q16_16_ONE, capacity_uAs / 100);
+        fixedPointSoc_perc = MATH_SubtractQ16_16(fixedPointSoc_perc, deltaSoc_perc);
+    }
+    const clock_t fixedPointTicks = clock() - start;
+
+    /* the fixed-point integration is exact up to the resolution of Q16.16 */
+    const double fixedPointError_perc = fabs(expectedSoc_perc - (double)MATH_Q16_16ToFloat(fixedPointSoc_perc));
+    const double floatError_perc      = fabs(expectedSoc_perc - (double)floatSoc_perc);
+    TEST_ASSERT_TRUE(fixedPointError_perc <= (1.0 / 65536.0));
+
+    char message[150] = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "float: %.3f us/step, error %.6f %%; fixed-point: %.3f us/step, error %.6f %%",
+        (1.0e6 * (double)floatTicks) / ((double)CLOCKS_PER_SEC * (double)steps),
+        floatError_perc,
+        (1.0e6 * (double)fixedPointTicks) / ((double)CLOCKS_PER_SEC * (double)steps),
+        fixedPointError_perc);
+    TEST_MESSAGE(message);
+}
+
+/** host benchmark: counting and merging the invalid flags of a large pack bit by bit and as bitmaps */
+void testBitmapBenchmark(void) {
+    /* 16 strings with 24 modules of 18 cell blocks each */
+    enum { nrOfStrings = 16, nrOfModules = 24, nrOfCellBlocks = 18 };
+    const uint64_t cellBlockMask = (1uLL << nrOfCellBlocks) - 1u;
+    const uint32_t cycles        = 2000u;
+    static uint64_t base[nrOfStrings][nrOfModules];
+    static uint64_t redundancy[nrOfStrings][nrOfModules];
+    static uint64_t merged[nrOfStrings][nrOfModules];
+
+    uint64_t random = 1u;
+    for (uint8_t s = 0u; s < nrOfStrings; s++) {
+        for (uint8_t m = 0u; m < nrOfModules; m++) {
+            random           = (random * 6364136223846793005uLL) + 1442695040888963407uLL;
+            base[s][m]       = (random >> 20u) & (random >> 40u) & cellBlockMask;
+            random           = (random * 6364136223846793005uLL) + 1442695040888963407uLL;
+            redundancy[s][m] = (random >> 20u) & (random >> 40u) & cellBlockMask;
+        }
+    }
+
+    /* bit by bit: merge base and redundancy and count the valid cell blocks */
+    uint32_t bitwiseValid = 0u;
+    clock_t start         = clock();
+    for (uint32_t cycle = 0u; cycle < cycles; cycle++) {
+        for (uint8_t s = 0u; s < nrOfStrings; s++) {
+            for (uint8_t m = 0u; m < nrOfModules; m++) {
+                for (uint8_t cb = 0u; cb < nrOfCellBlocks; cb++) {
+                    const uint64_t cellBlock = (uint64_t)1u << cb;
+                    if (((base[s][m] & cellBlock) != 0u) && ((redundancy[s][m] & cellBlock) != 0u)) {
+                        merged[s][m] |= cellBlock;
+                    } else {
+                        merged[s][m] &= ~cellBlock;
+                        bitwiseValid++;
+                    }
+                }
+            }
+        }
+    }
+    const clock_t bitwiseTicks = clock() - start;
+
+    /* bitmaps: merge each string at once and count with popcount */
+    uint32_t bitmapValid = 0u;
+    start                = clock();
+    for (uint32_t cycle = 0u; cycle < cycles; cycle++) {
+        for (uint8_t s = 0u; s < nrOfStrings; s++) {
+            MATH_AndBitmaps(base[s], redundancy[s], merged[s], nrOfModules);
+            bitmapValid += (uint32_t)(nrOfModules * nrOfCellBlocks) -
+                           MATH_CountSetBitsInBitmap(merged[s], nrOfModules, cellBlockMask);
+        }
+    }
+    const clock_t bitmapTicks = clock() - start;
+
+    TEST_ASSERT_EQUAL_UINT32(bitwiseValid, bitmapValid);
+
+    const double cellsPerCycle = (double)nrOfStrings * (double)nrOfModules * (double)nrOfCellBlocks;
+    char message[150]          = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "merge and count %.0f cells: bit by bit %.3f us/cycle; bitmap %.3f us/cycle",
+        cellsPerCycle,
+        (1.0e6 * (double)bitwiseTicks) / ((double)CLOCKS_PER_SEC * (double)cycles),
+        (1.0e6 * (double)bitmapTicks) / ((double)CLOCKS_PER_SEC * (double)cycles));
+    TEST_MESSAGE(message);
+}
+#endif
@@ -43,7 +43,7 @@
  * @file    test_htsensor.c
  * @author  foxBMS Team
  * @date    2021-08-05 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -58,6 +58,7 @@
 #include "MockHL_sys_dma.h"
 #include "Mockdatabase.h"
 #include "Mocki2c.h"
+#include "Mocki2c_queue.h"
 #include "Mockos.h"
 
 #include "htsensor.h"
@@ -72,8 +73,30 @@ long FSYS_RaisePrivilege(void) {
     return 0;
 }
 
+/** number of transactions enqueued by the driver */
+static uint32_t testNumberOfEnqueuedTransactions = 0u;
+/** last transaction enqueued by the driver */
+static I2C_TRANSACTION_s testLastTransaction = {0};
+
+/** current tick count of the operating system */
+static uint32_t testTickCount_ms = 0u;
+
+static uint32_t TEST_GetTickCountStub(int numCalls) {
+    return testTickCount_ms;
+}
+
+static STD_RETURN_TYPE_e TEST_EnqueueTransactionStub(const I2C_TRANSACTION_s *pTransaction, int numCalls) {
+    testLastTransaction = *pTransaction;
+    testNumberOfEnqueuedTransactions++;
+    return STD_OK;
+}
+
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    testNumberOfEnqueuedTransactions = 0u;
+    testTickCount_ms                 = 0u;
+    I2C_EnqueueTransaction_StubWithCallback(TEST_EnqueueTransactionStub);
+    OS_GetTickCount_StubWithCallback(TEST_GetTickCountStub);
 }
 
 void tearDown(void) {
@@ -87,3 +110,76 @@ void testCalculateCrc8(void) {
     data[0u]        = 0xBE;
     TEST_ASSERT_EQUAL(0x92, TEST_HTSEN_TestCalculateCrc8(data, 2u));
 }
+
+/** the state machine enqueues one transaction at a time and is advanced by the callbacks */
+void testHTSEN_TriggerIsAdvancedByTransactionCallbacks(void) {
+    /* start of a measurement */
+    HTSEN_Trigger();
+    TEST_ASSERT_EQUAL(1u, testNumberOfEnqueuedTransactions);
+    TEST_ASSERT_EQUAL(I2C_TRANSACTION_WRITE, testLastTransaction.type);
+    TEST_ASSERT_EQUAL(2u, testLastTransaction.nrBytesWrite);
+    TEST_ASSERT_NOT_NULL(testLastTransaction.callback);
+
+    /* nothing is enqueued while the transaction is pending */
+    HTSEN_Trigger();
+    TEST_ASSERT_EQUAL(1u, testNumberOfEnqueuedTransactions);
+
+    /* measurement started: the results are read */
+    testLastTransaction.callback(testLastTransaction.tag, I2C_TRANSACTION_SUCCESSFUL);
+    HTSEN_Trigger();
+    TEST_ASSERT_EQUAL(2u, testNumberOfEnqueuedTransactions);
+    TEST_ASSERT_EQUAL(I2C_TRANSACTION_READ, testLastTransaction.type);
+    TEST_ASSERT_EQUAL(6u, testLastTransaction.nrBytesRead);
+
+    /* results not available yet: the read is retried */
+    testLastTransaction.callback(testLastTransaction.tag, I2C_TRANSACTION_FAILED);
+    HTSEN_Trigger();
+    TEST_ASSERT_EQUAL(3u, testNumberOfEnqueuedTransactions);
+    TEST_ASSERT_EQUAL(I2C_TRANSACTION_READ, testLastTransaction.type);
+
+    /* results available with valid CRCs: they are written to the database and a new measurement is started */
+    const uint8_t results[6u] = {0xBEu, 0xEFu, 0x92u, 0xBEu, 0xEFu, 0x92u};
+    for (uint8_t i = 0u; i < 6u; i++) {
+        testLastTransaction.pReadData[i] = results[i];
+    }
+    DATA_Write1DataBlock_IgnoreAndReturn(STD_OK);
+    testLastTransaction.callback(testLastTransaction.tag, I2C_TRANSACTION_SUCCESSFUL);
+    HTSEN_Trigger();
+    TEST_ASSERT_EQUAL(4u, testNumberOfEnqueuedTransactions);
+    TEST_ASSERT_EQUAL(I2C_TRANSACTION_WRITE, testLastTransaction.type);
+
+    /* failed start of a measurement: the measurement is started again */
+    testLastTransaction.callback(testLastTransaction.tag, I2C_TRANSACTION_FAILED);
+    HTSEN_Trigger();
+    TEST_ASSERT_EQUAL(5u, testNumberOfEnqueuedTransactions);
+    TEST_ASSERT_EQUAL(I2C_TRANSACTION_WRITE, testLastTransaction.type);
+}
+
+/** the results are read until the read window has passed, afterwards a new measurement is started */
+void testHTSEN_TriggerRestartsMeasurementAfterReadWindow(void) {
+    /* bring the state machine to the start of a measurement */
+    HTSEN_Trigger();
+    while (testLastTransaction.type != I2C_TRANSACTION_WRITE) {
+        testLastTransaction.callback(testLastTransaction.tag, I2C_TRANSACTION_FAILED);
+        testTickCount_ms += 100u;
+        HTSEN_Trigger();
+    }
+    testTickCount_ms = 1000u;
+    testLastTransaction.callback(testLastTransaction.tag, I2C_TRANSACTION_SUCCESSFUL);
+    HTSEN_Trigger();
+    TEST_ASSERT_EQUAL(I2C_TRANSACTION_READ, testLastTransaction.type);
+
+    /* polled much faster than the conversion time: all reads within the window are retried */
+    for (uint32_t i = 1u; i < 50u; i++) {
+        testTickCount_ms = 1000u + i;
+        testLastTransaction.callback(testLastTransaction.tag, I2C_TRANSACTION_FAILED);
+        HTSEN_Trigger();
+        TEST_ASSERT_EQUAL(I2C_TRANSACTION_READ, testLastTransaction.type);
+    }
+
+    /* window has passed: a new measurement is started */
+    testTickCount_ms = 1050u;
+    testLastTransaction.callback(testLastTransaction.tag, I2C_TRANSACTION_FAILED);
+    HTSEN_Trigger();
+    TEST_ASSERT_EQUAL(I2C_TRANSACTION_WRITE, testLastTransaction.type);
+}
@@ -0,0 +1,450 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * - &Prime;This product uses parts of foxBMS&reg;&Prime;
+ * - &Prime;This product includes parts of foxBMS&reg;&Prime;
+ * - &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_i2c_queue.c
+ * @author  foxBMS Team
+ * @date    2026-10-19 (date of creation)
+ * @updated 2026-10-19 (date of last update)
+ * @version v1.6.0
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the transaction queue of the I2C driver
+ * @details The functions of the I2C driver are replaced by a mock bus that
+ *          logs the transactions and advances a simulated clock by the time
+ *          the transaction needs on a 400kHz bus. The throughput of the I2C
+ *          task with the blocking calls and fixed delays of the drivers is
+ *          compared to the throughput with the transaction queue.
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "Mocki2c.h"
+#include "Mockos.h"
+
+#include "i2c_queue.h"
+#include "test_assert_helper.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#endif
+
+/*========== Unit Testing Framework Directives ==============================*/
+TEST_INCLUDE_PATH("../../src/app/driver/i2c")
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** time to transfer one byte and its ACK bit at 400kHz */
+#define TEST_BYTE_TIME_ns (22500u)
+/** time of start condition, stop condition, DMA setup and task notification of one transfer */
+#define TEST_TRANSFER_OVERHEAD_ns (30000u)
+/** delay of the I2C task at the end of each cycle and between the blocking calls of the drivers */
+#define TEST_TASK_DELAY_ns (2000000u)
+/** simulated duration of the throughput measurement */
+#define TEST_SIMULATION_DURATION_ns (1000000000u)
+/** maximum number of transactions logged by the mock bus */
+#define TEST_BUS_LOG_LENGTH (8u)
+/** slave address that does not acknowledge on the mock bus */
+#define TEST_NACK_SLAVE_ADDRESS (0x7Fu)
+
+/** functions of the I2C driver called by the queue */
+typedef enum {
+    TEST_BUS_READ,
+    TEST_BUS_READ_DMA,
+    TEST_BUS_WRITE_DMA,
+    TEST_BUS_WRITE_READ,
+    TEST_BUS_WRITE_READ_DMA,
+} TEST_BUS_FUNCTION_e;
+
+/** simulated time */
+static uint64_t test_time_ns = 0u;
+/** number of transactions on the mock bus */
+static uint32_t test_busTransactions = 0u;
+/** functions and slave addresses of the first transactions on the mock bus */
+static TEST_BUS_FUNCTION_e test_busFunctions[TEST_BUS_LOG_LENGTH] = {0};
+static uint32_t test_busSlaveAddresses[TEST_BUS_LOG_LENGTH]       = {0};
+/** number of completed transactions */
+static uint32_t test_completions = 0u;
+/** tags and results of the first completed transactions */
+static uint32_t test_completedTags[TEST_BUS_LOG_LENGTH]                    = {0};
+static I2C_TRANSACTION_RESULT_e test_completedResults[TEST_BUS_LOG_LENGTH] = {0};
+
+static uint8_t test_writeData[3u] = {0x01u, 0x02u, 0x03u};
+static uint8_t test_readData[6u]  = {0};
+
+static STD_RETURN_TYPE_e TEST_BusTransfer(TEST_BUS_FUNCTION_e function, uint32_t slaveAddress, uint32_t nrBytes) {
+    if (test_busTransactions < TEST_BUS_LOG_LENGTH) {
+        test_busFunctions[test_busTransactions]      = function;
+        test_busSlaveAddresses[test_busTransactions] = slaveAddress;
+    }
+    test_busTransactions++;
+    /* slave address and data bytes */
+    test_time_ns += ((1u + (uint64_t)nrBytes) * TEST_BYTE_TIME_ns) + TEST_TRANSFER_OVERHEAD_ns;
+
+    STD_RETURN_TYPE_e retVal = STD_OK;
+    if (slaveAddress == TEST_NACK_SLAVE_ADDRESS) {
+        retVal = STD_NOT_OK;
+    }
+    return retVal;
+}
+
+static STD_RETURN_TYPE_e TEST_Read(i2cBASE_t *pI2c, uint32_t slaveAddress, uint32_t nrBytes, uint8_t *pData, int n) {
+    return TEST_BusTransfer(TEST_BUS_READ, slaveAddress, nrBytes);
+}
+
+static STD_RETURN_TYPE_e TEST_ReadDma(i2cBASE_t *pI2c, uint32_t slaveAddress, uint32_t nrBytes, uint8_t *pData, int n) {
+    return TEST_BusTransfer(TEST_BUS_READ_DMA, slaveAddress, nrBytes);
+}
+
+static STD_RETURN_TYPE_e TEST_WriteDma(
+    i2cBASE_t *pI2c,
+    uint32_t slaveAddress,
+    uint32_t nrBytes,
+    uint8_t *pData,
+    int n) {
+    return TEST_BusTransfer(TEST_BUS_WRITE_DMA, slaveAddress, nrBytes);
+}
+
+static STD_RETURN_TYPE_e TEST_WriteRead(
+    i2cBASE_t *pI2c,
+    uint32_t slaveAddress,
+    uint32_t nrBytesWrite,
+    uint8_t *pWriteData,
+    uint32_t nrBytesRead,
+    uint8_t *pReadData,
+    int n) {
+    /* repeated start: the slave address is sent twice */
+    return TEST_BusTransfer(TEST_BUS_WRITE_READ, slaveAddress, 1u + nrBytesWrite + nrBytesRead);
+}
+
+static STD_RETURN_TYPE_e TEST_WriteReadDma(
+    i2cBASE_t *pI2c,
+    uint32_t slaveAddress,
+    uint32_t nrBytesWrite,
+    uint8_t *pWriteData,
+    uint32_t nrBytesRead,
+    uint8_t *pReadData,
+    int n) {
+    /* repeated start: the slave address is sent twice */
+    return TEST_BusTransfer(TEST_BUS_WRITE_READ_DMA, slaveAddress, 1u + nrBytesWrite + nrBytesRead);
+}
+
+static uint32_t TEST_GetTickCount(int n) {
+    return (uint32_t)(test_time_ns / 1000000u);
+}
+
+static void TEST_Callback(uint32_t tag, I2C_TRANSACTION_RESULT_e result) {
+    if (test_completions < TEST_BUS_LOG_LENGTH) {
+        test_completedTags[test_completions]    = tag;
+        test_completedResults[test_completions] = result;
+    }
+    test_completions++;
+}
+
+/** callback that enqueues the same transaction again */
+static void TEST_CallbackEnqueueAgain(uint32_t tag, I2C_TRANSACTION_RESULT_e result);
+
+static I2C_TRANSACTION_s TEST_Transaction(I2C_TRANSACTION_TYPE_e type, uint32_t slaveAddress, uint32_t nrBytesRead) {
+    I2C_TRANSACTION_s transaction = {
+        .type          = type,
+        .pI2cInterface = i2cREG1,
+        .slaveAddress  = slaveAddress,
+        .nrBytesWrite  = 3u,
+        .pWriteData    = test_writeData,
+        .nrBytesRead   = nrBytesRead,
+        .pReadData     = test_readData,
+        .timeout_ms    = I2C_TRANSACTION_NO_TIMEOUT,
+        .callback      = &TEST_Callback,
+        .tag           = slaveAddress,
+    };
+    return transaction;
+}
+
+static void TEST_CallbackEnqueueAgain(uint32_t tag, I2C_TRANSACTION_RESULT_e result) {
+    I2C_TRANSACTION_s transaction = TEST_Transaction(I2C_TRANSACTION_WRITE, tag, 0u);
+    transaction.callback          = &TEST_CallbackEnqueueAgain;
+    TEST_ASSERT_EQUAL(STD_OK, I2C_EnqueueTransaction(&transaction));
+}
+
+/**
+ * @brief   Enqueues the transactions of one cycle of the I2C task: port
+ *          expander configuration, inputs and outputs of three port expanders
+ *          and the start of a measurement of the humidity/temperature sensor.
+ */
+static void TEST_EnqueueDriverCycle(void) {
+    for (uint32_t phase = 0u; phase < 4u; phase++) {
+        for (uint32_t portExpander = 0u; portExpander < 3u; portExpander++) {
+            I2C_TRANSACTION_s transaction = TEST_Transaction(I2C_TRANSACTION_WRITE, 0x74u + portExpander, 0u);
+            if (phase == 2u) {
+                transaction.type         = I2C_TRANSACTION_WRITE_READ;
+                transaction.nrBytesWrite = 1u;
+                transaction.nrBytesRead  = 2u;
+            }
+            TEST_ASSERT_EQUAL(STD_OK, I2C_EnqueueTransaction(&transaction));
+        }
+    }
+    I2C_TRANSACTION_s transaction = TEST_Transaction(I2C_TRANSACTION_WRITE, 0x44u, 0u);
+    transaction.nrBytesWrite      = 2u;
+    TEST_ASSERT_EQUAL(STD_OK, I2C_EnqueueTransaction(&transaction));
+}
+
+/** simulates OS_DelayTaskUntil() */
+static void TEST_DelayTaskUntil(uint64_t *pPreviousWakeTime_ns, uint64_t delay_ns) {
+    *pPreviousWakeTime_ns += delay_ns;
+    if (test_time_ns < *pPreviousWakeTime_ns) {
+        test_time_ns = *pPreviousWakeTime_ns;
+    }
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    test_time_ns         = 0u;
+    test_busTransactions = 0u;
+    test_completions     = 0u;
+    TEST_I2C_ResetTransactionQueue();
+
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    OS_GetTickCount_StubWithCallback(TEST_GetTickCount);
+    I2C_Read_StubWithCallback(TEST_Read);
+    I2C_ReadDma_StubWithCallback(TEST_ReadDma);
+    I2C_WriteDma_StubWithCallback(TEST_WriteDma);
+    I2C_WriteRead_StubWithCallback(TEST_WriteRead);
+    I2C_WriteReadDma_StubWithCallback(TEST_WriteReadDma);
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testI2C_EnqueueTransactionInvalidInput(void) {
+    I2C_TRANSACTION_s transaction = TEST_Transaction(I2C_TRANSACTION_WRITE_READ, 0x10u, 2u);
+    TEST_ASSERT_FAIL_ASSERT(I2C_EnqueueTransaction(NULL_PTR));
+
+    transaction.pI2cInterface = NULL_PTR;
+    TEST_ASSERT_FAIL_ASSERT(I2C_EnqueueTransaction(&transaction));
+
+    transaction = TEST_Transaction(I2C_TRANSACTION_WRITE_READ, 128u, 2u);
+    TEST_ASSERT_FAIL_ASSERT(I2C_EnqueueTransaction(&transaction));
+
+    transaction      = TEST_Transaction(I2C_TRANSACTION_WRITE_READ, 0x10u, 2u);
+    transaction.type = (I2C_TRANSACTION_TYPE_e)3u;
+    TEST_ASSERT_FAIL_ASSERT(I2C_EnqueueTransaction(&transaction));
+
+    transaction            = TEST_Transaction(I2C_TRANSACTION_WRITE, 0x10u, 0u);
+    transaction.pWriteData = NULL_PTR;
+    TEST_ASSERT_FAIL_ASSERT(I2C_EnqueueTransaction(&transaction));
+
+    transaction              = TEST_Transaction(I2C_TRANSACTION_WRITE_READ, 0x10u, 2u);
+    transaction.nrBytesWrite = 0u;
+    TEST_ASSERT_FAIL_ASSERT(I2C_EnqueueTransaction(&transaction));
+
+    transaction = TEST_Transaction(I2C_TRANSACTION_READ, 0x10u, 0u);
+    TEST_ASSERT_FAIL_ASSERT(I2C_EnqueueTransaction(&transaction));
+
+    transaction           = TEST_Transaction(I2C_TRANSACTION_READ, 0x10u, 2u);
+    transaction.pReadData = NULL_PTR;
+    TEST_ASSERT_FAIL_ASSERT(I2C_EnqueueTransaction(&transaction));
+
+    TEST_ASSERT_EQUAL(0u, I2C_GetNumberOfQueuedTransactions());
+}
+
+/** transactions are run in the order they have been enqueued, one byte is read without DMA */
+void testI2C_ProcessTransactionQueueKeepsOrder(void) {
+    const I2C_TRANSACTION_s transactions[5u] = {
+        TEST_Transaction(I2C_TRANSACTION_READ, 0x10u, 6u),
+        TEST_Transaction(I2C_TRANSACTION_WRITE, 0x11u, 0u),
+        TEST_Transaction(I2C_TRANSACTION_WRITE_READ, 0x12u, 1u),
+        TEST_Transaction(I2C_TRANSACTION_READ, 0x13u, 1u),
+        TEST_Transaction(I2C_TRANSACTION_WRITE_READ, 0x14u, 2u),
+    };
+    const TEST_BUS_FUNCTION_e expectedFunctions[5u] = {
+        TEST_BUS_READ_DMA,
+        TEST_BUS_WRITE_DMA,
+        TEST_BUS_WRITE_READ,
+        TEST_BUS_READ,
+        TEST_BUS_WRITE_READ_DMA,
+    };
+    for (uint8_t i = 0u; i < 5u; i++) {
+        TEST_ASSERT_EQUAL(STD_OK, I2C_EnqueueTransaction(&transactions[i]));
+    }
+    TEST_ASSERT_EQUAL(5u, I2C_GetNumberOfQueuedTransactions());
+    /* nothing is run on the bus before the queue is processed */
+    TEST_ASSERT_EQUAL(0u, test_busTransactions);
+
+    TEST_ASSERT_EQUAL(5u, I2C_ProcessTransactionQueue());
+    TEST_ASSERT_EQUAL(0u, I2C_GetNumberOfQueuedTransactions());
+    TEST_ASSERT_EQUAL(5u, test_busTransactions);
+    TEST_ASSERT_EQUAL(5u, test_completions);
+    for (uint8_t i = 0u; i < 5u; i++) {
+        TEST_ASSERT_EQUAL(expectedFunctions[i], test_busFunctions[i]);
+        TEST_ASSERT_EQUAL(0x10u + i, test_busSlaveAddresses[i]);
+        TEST_ASSERT_EQUAL(0x10u + i, test_completedTags[i]);
+        TEST_ASSERT_EQUAL(I2C_TRANSACTION_SUCCESSFUL, test_completedResults[i]);
+    }
+
+    /* empty queue */
+    TEST_ASSERT_EQUAL(0u, I2C_ProcessTransactionQueue());
+}
+
+void testI2C_EnqueueTransactionQueueFull(void) {
+    const I2C_TRANSACTION_s transaction = TEST_Transaction(I2C_TRANSACTION_WRITE, 0x10u, 0u);
+    for (uint32_t i = 0u; i < I2C_TRANSACTION_QUEUE_LENGTH; i++) {
+        TEST_ASSERT_EQUAL(STD_OK, I2C_EnqueueTransaction(&transaction));
+    }
+    TEST_ASSERT_EQUAL(STD_NOT_OK, I2C_EnqueueTransaction(&transaction));
+    TEST_ASSERT_EQUAL(I2C_TRANSACTION_QUEUE_LENGTH, I2C_GetNumberOfQueuedTransactions());
+
+    /* the ring buffer wraps around */
+    TEST_ASSERT_EQUAL(I2C_TRANSACTION_QUEUE_LENGTH, I2C_ProcessTransactionQueue());
+    TEST_ASSERT_EQUAL(STD_OK, I2C_EnqueueTransaction(&transaction));
+    TEST_ASSERT_EQUAL(1u, I2C_ProcessTransactionQueue());
+    TEST_ASSERT_EQUAL(I2C_TRANSACTION_QUEUE_LENGTH + 1u, test_busTransactions);
+}
+
+/** expired transactions do not access the bus, failed transactions do not stop the queue */
+void testI2C_ProcessTransactionQueueTimeoutAndFailure(void) {
+    I2C_TRANSACTION_s expiring = TEST_Transaction(I2C_TRANSACTION_WRITE, 0x10u, 0u);
+    expiring.timeout_ms        = 5u;
+    I2C_TRANSACTION_s waiting  = TEST_Transaction(I2C_TRANSACTION_WRITE, 0x11u, 0u);
+    I2C_TRANSACTION_s nack     = TEST_Transaction(I2C_TRANSACTION_WRITE, TEST_NACK_SLAVE_ADDRESS, 0u);
+    I2C_TRANSACTION_s inTime   = TEST_Transaction(I2C_TRANSACTION_WRITE, 0x12u, 0u);
+    inTime.timeout_ms          = 5u;
+    nack.tag                   = 0x13u;
+
+    TEST_ASSERT_EQUAL(STD_OK, I2C_EnqueueTransaction(&expiring));
+    TEST_ASSERT_EQUAL(STD_OK, I2C_EnqueueTransaction(&waiting));
+    test_time_ns = 6000000u;
+    TEST_ASSERT_EQUAL(STD_OK, I2C_EnqueueTransaction(&nack));
+    TEST_ASSERT_EQUAL(STD_OK, I2C_EnqueueTransaction(&inTime));
+
+    TEST_ASSERT_EQUAL(4u, I2C_ProcessTransactionQueue());
+    TEST_ASSERT_EQUAL(3u, test_busTransactions);
+    TEST_ASSERT_EQUAL(0x11u, test_busSlaveAddresses[0u]);
+    TEST_ASSERT_EQUAL(TEST_NACK_SLAVE_ADDRESS, test_busSlaveAddresses[1u]);
+    TEST_ASSERT_EQUAL(0x12u, test_busSlaveAddresses[2u]);
+
+    TEST_ASSERT_EQUAL(4u, test_completions);
+    TEST_ASSERT_EQUAL(0x10u, test_completedTags[0u]);
+    TEST_ASSERT_EQUAL(I2C_TRANSACTION_TIMED_OUT, test_completedResults[0u]);
+    TEST_ASSERT_EQUAL(0x11u, test_completedTags[1u]);
+    TEST_ASSERT_EQUAL(I2C_TRANSACTION_SUCCESSFUL, test_completedResults[1u]);
+    TEST_ASSERT_EQUAL(0x13u, test_completedTags[2u]);
+    TEST_ASSERT_EQUAL(I2C_TRANSACTION_FAILED, test_completedResults[2u]);
+    TEST_ASSERT_EQUAL(0x12u, test_completedTags[3u]);
+    TEST_ASSERT_EQUAL(I2C_TRANSACTION_SUCCESSFUL, test_completedResults[3u]);
+}
+
+/** transactions enqueued by callbacks are run, but not more than the queue length per call */
+void testI2C_ProcessTransactionQueueLimitsTransactionsPerCall(void) {
+    I2C_TRANSACTION_s transaction = TEST_Transaction(I2C_TRANSACTION_WRITE, 0x10u, 0u);
+    transaction.callback          = &TEST_CallbackEnqueueAgain;
+    TEST_ASSERT_EQUAL(STD_OK, I2C_EnqueueTransaction(&transaction));
+
+    TEST_ASSERT_EQUAL(I2C_TRANSACTION_QUEUE_LENGTH, I2C_ProcessTransactionQueue());
+    TEST_ASSERT_EQUAL(I2C_TRANSACTION_QUEUE_LENGTH, test_busTransactions);
+    TEST_ASSERT_EQUAL(1u, I2C_GetNumberOfQueuedTransactions());
+}
+
+/** cycles of the I2C task per second with blocking calls and delays compared to the transaction queue */
+void testI2C_TransactionQueueThroughput(void) {
+    /* blocking: the drivers run one transaction per port expander and phase, then delay the task */
+    uint32_t blockingCycles = 0u;
+    uint64_t wakeTime_ns    = 0u;
+    while (test_time_ns < TEST_SIMULATION_DURATION_ns) {
+        for (uint32_t phase = 0u; phase < 4u; phase++) {
+            for (uint32_t portExpander = 0u; portExpander < 3u; portExpander++) {
+                if (phase == 2u) {
+                    (void)I2C_WriteReadDma(i2cREG1, 0x74u + portExpander, 1u, test_writeData, 2u, test_readData);
+                } else {
+                    (void)I2C_WriteDma(i2cREG1, 0x74u + portExpander, 3u, test_writeData);
+                }
+            }
+            TEST_DelayTaskUntil(&wakeTime_ns, TEST_TASK_DELAY_ns);
+        }
+        (void)I2C_WriteDma(i2cREG1, 0x44u, 2u, test_writeData);
+        TEST_DelayTaskUntil(&wakeTime_ns, TEST_TASK_DELAY_ns);
+        /* end of the cycle of the task */
+        wakeTime_ns = test_time_ns;
+        TEST_DelayTaskUntil(&wakeTime_ns, TEST_TASK_DELAY_ns);
+        blockingCycles++;
+    }
+    const uint32_t blockingTransactions = test_busTransactions;
+
+    /* queued: the drivers enqueue all transactions, the task runs them back-to-back */
+    test_time_ns         = 0u;
+    test_busTransactions = 0u;
+    uint32_t queueCycles = 0u;
+    while (test_time_ns < TEST_SIMULATION_DURATION_ns) {
+        TEST_EnqueueDriverCycle();
+        TEST_ASSERT_EQUAL(13u, I2C_ProcessTransactionQueue());
+        /* end of the cycle of the task */
+        wakeTime_ns = test_time_ns;
+        TEST_DelayTaskUntil(&wakeTime_ns, TEST_TASK_DELAY_ns);
+        queueCycles++;
+    }
+    const uint32_t queueTransactions = test_busTransactions;
+
+    TEST_ASSERT_GREATER_THAN_UINT32(blockingCycles, queueCycles);
+    TEST_ASSERT_EQUAL_UINT32(13u * blockingCycles, blockingTransactions);
+    TEST_ASSERT_EQUAL_UINT32(13u * queueCycles, queueTransactions);
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+    char message[120u] = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "blocking calls: %u cycles/s, %u transactions/s",
+        (unsigned int)blockingCycles,
+        (unsigned int)blockingTransactions);
+    TEST_MESSAGE(message);
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "transaction queue: %u cycles/s, %u transactions/s",
+        (unsigned int)queueCycles,
+        (unsigned int)queueTransactions);
+    TEST_MESSAGE(message);
+#endif
+}
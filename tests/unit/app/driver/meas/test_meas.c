@@ -43,7 +43,7 @@
  * @file    test_meas.c
  * @author  foxBMS Team
  * @date    2020-04-01 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -55,6 +55,7 @@
 /*========== Includes =======================================================*/
 #include "unity.h"
 #include "Mockafe.h"
+#include "Mockafe_schedule.h"
 
 #include "meas.h"
 
@@ -74,3 +75,10 @@ void tearDown(void) {
 /*========== Test Cases =====================================================*/
 void testDummy(void) {
 }
+
+void testMEAS_RequestMeasurementBoost(void) {
+    AFE_ScheduleRequestBoost_Expect(true);
+    MEAS_RequestMeasurementBoost(true);
+    AFE_ScheduleRequestBoost_Expect(false);
+    MEAS_RequestMeasurementBoost(false);
+}
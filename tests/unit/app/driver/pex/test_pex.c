@@ -43,7 +43,7 @@
  * @file    test_pex.c
  * @author  foxBMS Team
  * @date    2021-09-29 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -58,6 +58,7 @@
 #include "Mockdatabase.h"
 #include "Mockdiag.h"
 #include "Mocki2c.h"
+#include "Mocki2c_queue.h"
 #include "Mockos.h"
 #include "Mockportmacro.h"
 
@@ -78,8 +79,28 @@ long FSYS_RaisePrivilege(void) {
     return 0;
 }
 
+/** number of transactions in one cycle, four per port expander */
+#define TEST_PEX_TRANSACTIONS_PER_CYCLE (4u * PEX_NR_OF_PORT_EXPANDERS)
+
+/** number of transactions enqueued by the driver */
+static uint32_t testNumberOfEnqueuedTransactions = 0u;
+/** transactions enqueued by the driver */
+static I2C_TRANSACTION_s testTransactions[TEST_PEX_TRANSACTIONS_PER_CYCLE] = {0};
+
+static STD_RETURN_TYPE_e TEST_EnqueueTransactionStub(const I2C_TRANSACTION_s *pTransaction, int numCalls) {
+    TEST_ASSERT_TRUE(testNumberOfEnqueuedTransactions < TEST_PEX_TRANSACTIONS_PER_CYCLE);
+    testTransactions[testNumberOfEnqueuedTransactions] = *pTransaction;
+    testNumberOfEnqueuedTransactions++;
+    return STD_OK;
+}
+
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    testNumberOfEnqueuedTransactions = 0u;
+    I2C_EnqueueTransaction_StubWithCallback(TEST_EnqueueTransactionStub);
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    PEX_Initialize();
 }
 
 void tearDown(void) {
@@ -109,3 +130,46 @@ void testModuleInterfacesWithInvalidValues(void) {
     TEST_ASSERT_FAIL_ASSERT(PEX_SetPinPolarityRetained(5, PEX_PIN00));
     TEST_ASSERT_FAIL_ASSERT(PEX_SetPinPolarityRetained(PEX_PORT_EXPANDER1, 16u));
 }
+
+/** a cycle enqueues all transactions at once and is finished by the callback of the last one */
+void testPEX_TriggerEnqueuesOneCycle(void) {
+    PEX_Trigger();
+    TEST_ASSERT_EQUAL(TEST_PEX_TRANSACTIONS_PER_CYCLE, testNumberOfEnqueuedTransactions);
+
+    /* direction, polarity, inputs and outputs of all port expanders, in this order */
+    for (uint8_t i = 0u; i < PEX_NR_OF_PORT_EXPANDERS; i++) {
+        TEST_ASSERT_EQUAL(I2C_TRANSACTION_WRITE, testTransactions[i].type);
+        TEST_ASSERT_EQUAL(pex_addressList[i], testTransactions[i].slaveAddress);
+        TEST_ASSERT_EQUAL(0x6u, testTransactions[i].pWriteData[0u]);
+        TEST_ASSERT_EQUAL(0x4u, testTransactions[PEX_NR_OF_PORT_EXPANDERS + i].pWriteData[0u]);
+        TEST_ASSERT_EQUAL(I2C_TRANSACTION_WRITE_READ, testTransactions[(2u * PEX_NR_OF_PORT_EXPANDERS) + i].type);
+        TEST_ASSERT_EQUAL(0x0u, testTransactions[(2u * PEX_NR_OF_PORT_EXPANDERS) + i].pWriteData[0u]);
+        TEST_ASSERT_EQUAL(0x2u, testTransactions[(3u * PEX_NR_OF_PORT_EXPANDERS) + i].pWriteData[0u]);
+    }
+
+    /* no new cycle while transactions are pending */
+    PEX_Trigger();
+    TEST_ASSERT_EQUAL(TEST_PEX_TRANSACTIONS_PER_CYCLE, testNumberOfEnqueuedTransactions);
+
+    /* the input state is published and diag notified when the last transaction is completed */
+    I2C_TRANSACTION_s readInputs = testTransactions[2u * PEX_NR_OF_PORT_EXPANDERS];
+    readInputs.pReadData[0u]     = 0x01u;
+    readInputs.pReadData[1u]     = 0x00u;
+    DIAG_Handler_ExpectAndReturn(DIAG_ID_I2C_PEX_ERROR, DIAG_EVENT_OK, DIAG_SYSTEM, 0u, DIAG_HANDLER_RETURN_OK);
+    for (uint32_t i = 0u; i < testNumberOfEnqueuedTransactions; i++) {
+        TEST_ASSERT_EQUAL(0u, PEX_GetPin(PEX_PORT_EXPANDER1, PEX_PIN00));
+        testTransactions[i].callback(testTransactions[i].tag, I2C_TRANSACTION_SUCCESSFUL);
+    }
+    TEST_ASSERT_EQUAL(1u, PEX_GetPin(PEX_PORT_EXPANDER1, PEX_PIN00));
+    TEST_ASSERT_EQUAL(0u, PEX_GetPin(PEX_PORT_EXPANDER1, PEX_PIN10));
+
+    /* a failed transaction is reported to diag */
+    testNumberOfEnqueuedTransactions = 0u;
+    PEX_Trigger();
+    TEST_ASSERT_EQUAL(TEST_PEX_TRANSACTIONS_PER_CYCLE, testNumberOfEnqueuedTransactions);
+    DIAG_Handler_ExpectAndReturn(DIAG_ID_I2C_PEX_ERROR, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u, DIAG_HANDLER_RETURN_OK);
+    testTransactions[0u].callback(testTransactions[0u].tag, I2C_TRANSACTION_FAILED);
+    for (uint32_t i = 1u; i < testNumberOfEnqueuedTransactions; i++) {
+        testTransactions[i].callback(testTransactions[i].tag, I2C_TRANSACTION_SUCCESSFUL);
+    }
+}
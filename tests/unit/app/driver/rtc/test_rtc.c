@@ -43,7 +43,7 @@
  * @file    test_rtc.c
  * @author  foxBMS Team
  * @date    2020-04-01 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -59,6 +59,7 @@
 #include "Mockdatabase.h"
 #include "Mockdiag.h"
 #include "Mocki2c.h"
+#include "Mocki2c_queue.h"
 #include "Mockos.h"
 
 /*========== Unit Testing Framework Directives ==============================*/
@@ -43,7 +43,7 @@
  * @file    test_diag_cfg.c
  * @author  foxBMS Team
  * @date    2020-04-01 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -56,16 +56,84 @@
 #include "unity.h"
 #include "Mockdatabase.h"
 #include "Mockdiag_cbs.h"
+#include "Mockos.h"
 
 #include "diag_cfg.h"
+#include "test_assert_helper.h"
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#endif
 
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_INCLUDE_PATH("../../src/app/engine/diag/cbs")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
+/** duration of the simulated operation */
+#define TEST_SIMULATED_OPERATION_ms (60u * 60u * 1000u)
+/** period in which a MOL flag is set or reset in the simulated operation */
+#define TEST_FLAG_TOGGLE_PERIOD_ms (10000u)
+/** period in which a callback is executed without changing a flag in the simulated operation */
+#define TEST_UNCHANGED_CALLBACK_PERIOD_ms (1000u)
+
+static uint32_t test_databaseWrites = 0u;
+static uint32_t test_writtenBlocks  = 0u;
+
+static STD_RETURN_TYPE_e TEST_Write1DataBlock(void *pDataFromSender0, int numCalls) {
+    (void)pDataFromSender0;
+    (void)numCalls;
+    test_databaseWrites++;
+    test_writtenBlocks += 1u;
+    return STD_OK;
+}
+
+static STD_RETURN_TYPE_e TEST_Write2DataBlocks(void *pDataFromSender0, void *pDataFromSender1, int numCalls) {
+    (void)pDataFromSender0;
+    (void)pDataFromSender1;
+    (void)numCalls;
+    test_databaseWrites++;
+    test_writtenBlocks += 2u;
+    return STD_OK;
+}
+
+static STD_RETURN_TYPE_e TEST_Write3DataBlocks(
+    void *pDataFromSender0,
+    void *pDataFromSender1,
+    void *pDataFromSender2,
+    int numCalls) {
+    (void)pDataFromSender0;
+    (void)pDataFromSender1;
+    (void)pDataFromSender2;
+    (void)numCalls;
+    test_databaseWrites++;
+    test_writtenBlocks += 3u;
+    return STD_OK;
+}
+
+static STD_RETURN_TYPE_e TEST_Write4DataBlocks(
+    void *pDataFromSender0,
+    void *pDataFromSender1,
+    void *pDataFromSender2,
+    void *pDataFromSender3,
+    int numCalls) {
+    (void)pDataFromSender0;
+    (void)pDataFromSender1;
+    (void)pDataFromSender2;
+    (void)pDataFromSender3;
+    (void)numCalls;
+    test_databaseWrites++;
+    test_writtenBlocks += 4u;
+    return STD_OK;
+}
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    TEST_DIAG_ResetFlagPublication();
+    diag_kDatabaseShim.pTableMol->overVoltage[0u] = 0u;
+    test_databaseWrites                          = 0u;
+    test_writtenBlocks                           = 0u;
 }
 
 void tearDown(void) {
@@ -80,3 +148,146 @@ void testDIAG_UpdateFlagsInDatabase(void) {
     DATA_Write4DataBlocks_IgnoreArg_pDataFromSender3();
     DIAG_UpdateFlags();
 }
+
+void testDIAG_NotifyFlagModificationIsProtected(void) {
+    OS_EnterTaskCritical_StopIgnore();
+    OS_ExitTaskCritical_StopIgnore();
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    DIAG_NotifyFlagModification();
+}
+
+void testDIAG_UpdateFlagsOnlyWritesChangedFlagBlocks(void) {
+    /* first call: all flag blocks are written */
+    DATA_Write4DataBlocks_ExpectAndReturn(
+        diag_kDatabaseShim.pTableError,
+        diag_kDatabaseShim.pTableMol,
+        diag_kDatabaseShim.pTableRsl,
+        diag_kDatabaseShim.pTableMsl,
+        STD_OK);
+    DIAG_UpdateFlags();
+
+    /* nothing modified: nothing is written */
+    DIAG_UpdateFlags();
+
+    /* modification notified, but no flag changed: nothing is written */
+    DIAG_NotifyFlagModification();
+    DIAG_UpdateFlags();
+
+    /* MOL flag changed: only the MOL flag block is written */
+    diag_kDatabaseShim.pTableMol->overVoltage[0u] = 1u;
+    DIAG_NotifyFlagModification();
+    DATA_Write1DataBlock_ExpectAndReturn(diag_kDatabaseShim.pTableMol, STD_OK);
+    DIAG_UpdateFlags();
+
+    /* a changed header (timestamps updated by the database) is not a change */
+    diag_kDatabaseShim.pTableMol->header.timestamp++;
+    DIAG_NotifyFlagModification();
+    DIAG_UpdateFlags();
+
+    DIAG_FLAG_PUBLICATION_STATISTICS_s statistics = {0};
+    DIAG_GetFlagPublicationStatistics(&statistics);
+    TEST_ASSERT_EQUAL_UINT32(0u, statistics.generation[DIAG_FLAG_BLOCK_ERROR_STATE]);
+    TEST_ASSERT_EQUAL_UINT32(1u, statistics.generation[DIAG_FLAG_BLOCK_MOL]);
+    TEST_ASSERT_EQUAL_UINT32(0u, statistics.generation[DIAG_FLAG_BLOCK_RSL]);
+    TEST_ASSERT_EQUAL_UINT32(0u, statistics.generation[DIAG_FLAG_BLOCK_MSL]);
+    TEST_ASSERT_EQUAL_UINT32(5u, statistics.publishedBlocks);
+    TEST_ASSERT_EQUAL_UINT32(15u, statistics.skippedBlocks);
+    TEST_ASSERT_EQUAL_UINT32(2u, statistics.databaseWrites);
+    TEST_ASSERT_EQUAL_UINT32(1u, statistics.heartbeats);
+}
+
+void testDIAG_UpdateFlagsWritesAllFlagBlocksWithHeartbeat(void) {
+    DATA_Write4DataBlocks_IgnoreAndReturn(STD_OK);
+    DIAG_UpdateFlags();
+    /* no write until the heartbeat period elapsed */
+    for (uint32_t time_ms = DIAG_UPDATE_FLAGS_PERIOD_ms; time_ms < DIAG_FLAG_HEARTBEAT_PERIOD_ms;
+         time_ms += DIAG_UPDATE_FLAGS_PERIOD_ms) {
+        DIAG_UpdateFlags();
+    }
+    DATA_Write4DataBlocks_ExpectAndReturn(
+        diag_kDatabaseShim.pTableError,
+        diag_kDatabaseShim.pTableMol,
+        diag_kDatabaseShim.pTableRsl,
+        diag_kDatabaseShim.pTableMsl,
+        STD_OK);
+    DIAG_UpdateFlags();
+
+    DIAG_FLAG_PUBLICATION_STATISTICS_s statistics = {0};
+    DIAG_GetFlagPublicationStatistics(&statistics);
+    TEST_ASSERT_EQUAL_UINT32(2u, statistics.heartbeats);
+}
+
+void testDIAG_UpdateFlagsWritesAllFlagBlocksAfterFailedWrite(void) {
+    DATA_Write4DataBlocks_IgnoreAndReturn(STD_OK);
+    DIAG_UpdateFlags();
+
+    diag_kDatabaseShim.pTableMol->overVoltage[0u] = 1u;
+    DIAG_NotifyFlagModification();
+    DATA_Write1DataBlock_ExpectAndReturn(diag_kDatabaseShim.pTableMol, STD_NOT_OK);
+    DIAG_UpdateFlags();
+
+    /* the database queue was full: all flag blocks are written again */
+    DATA_Write4DataBlocks_ExpectAndReturn(
+        diag_kDatabaseShim.pTableError,
+        diag_kDatabaseShim.pTableMol,
+        diag_kDatabaseShim.pTableRsl,
+        diag_kDatabaseShim.pTableMsl,
+        STD_OK);
+    DIAG_UpdateFlags();
+}
+
+void testDIAG_GetFlagPublicationStatisticsInvalidInput(void) {
+    TEST_ASSERT_FAIL_ASSERT(DIAG_GetFlagPublicationStatistics(NULL_PTR));
+}
+
+/** simulates one hour of operation and reports the database accesses before and after the change-driven publication */
+void testDIAG_UpdateFlagsDatabaseAccessesInSimulatedOperation(void) {
+    DATA_Write1DataBlock_StubWithCallback(TEST_Write1DataBlock);
+    DATA_Write2DataBlocks_StubWithCallback(TEST_Write2DataBlocks);
+    DATA_Write3DataBlocks_StubWithCallback(TEST_Write3DataBlocks);
+    DATA_Write4DataBlocks_StubWithCallback(TEST_Write4DataBlocks);
+
+    for (uint32_t time_ms = 0u; time_ms < TEST_SIMULATED_OPERATION_ms; time_ms += DIAG_UPDATE_FLAGS_PERIOD_ms) {
+        if ((time_ms % TEST_FLAG_TOGGLE_PERIOD_ms) == (TEST_FLAG_TOGGLE_PERIOD_ms - 1u)) {
+            diag_kDatabaseShim.pTableMol->overVoltage[0u] ^= 1u;
+            DIAG_NotifyFlagModification();
+        } else if ((time_ms % TEST_UNCHANGED_CALLBACK_PERIOD_ms) == (TEST_UNCHANGED_CALLBACK_PERIOD_ms - 1u)) {
+            DIAG_NotifyFlagModification();
+        } else {
+            /* no diagnosis callback executed */
+        }
+        DIAG_UpdateFlags();
+    }
+
+    /* before: all flag blocks have been written with one database access in every call */
+    const uint32_t nrOfCalls                      = TEST_SIMULATED_OPERATION_ms / DIAG_UPDATE_FLAGS_PERIOD_ms;
+    const uint32_t expectedToggles                = TEST_SIMULATED_OPERATION_ms / TEST_FLAG_TOGGLE_PERIOD_ms;
+    DIAG_FLAG_PUBLICATION_STATISTICS_s statistics = {0};
+    DIAG_GetFlagPublicationStatistics(&statistics);
+    TEST_ASSERT_EQUAL_UINT32(expectedToggles, statistics.generation[DIAG_FLAG_BLOCK_MOL]);
+    TEST_ASSERT_EQUAL_UINT32(test_databaseWrites, statistics.databaseWrites);
+    TEST_ASSERT_EQUAL_UINT32(test_writtenBlocks, statistics.publishedBlocks);
+    TEST_ASSERT_EQUAL_UINT32(
+        nrOfCalls * (uint32_t)DIAG_FLAG_BLOCK_E_MAX, statistics.publishedBlocks + statistics.skippedBlocks);
+    TEST_ASSERT_TRUE(test_databaseWrites < (nrOfCalls / 50u));
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+    char message[128] = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "before: %u database writes, %u flag blocks",
+        (unsigned int)nrOfCalls,
+        (unsigned int)(nrOfCalls * (uint32_t)DIAG_FLAG_BLOCK_E_MAX));
+    TEST_MESSAGE(message);
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "after: %u database writes, %u flag blocks (%u heartbeats)",
+        (unsigned int)test_databaseWrites,
+        (unsigned int)test_writtenBlocks,
+        (unsigned int)statistics.heartbeats);
+    TEST_MESSAGE(message);
+#endif
+}
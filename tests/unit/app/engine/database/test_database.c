@@ -43,7 +43,7 @@
  * @file    test_database.c
  * @author  foxBMS Team
  * @date    2020-04-01 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -66,6 +66,7 @@
 #include "test_assert_helper.h"
 
 #include <stdbool.h>
+#include <stdlib.h>
 
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_INCLUDE_PATH("../../src/app/driver/config")
@@ -87,11 +88,52 @@ OS_QUEUE ftsk_imdCanDataQueue       = NULL_PTR;
 OS_QUEUE ftsk_canRxQueue            = NULL_PTR;
 volatile bool ftsk_allQueuesCreated = true;
 
+/** number of interleavings of a reader and the database task in #testDATA_BorrowedViewsUnderInterleavedWrites() */
+#define TEST_NUMBER_OF_INTERLEAVINGS (1000u)
+
+/** memory that stands in for the database queue, so that #DATA_Task() processes queue messages */
+static uint8_t test_databaseQueueMemory = 0u;
+
+/** table that is written into the database by #TEST_OS_ReceiveWriteMessage() */
+static DATA_BLOCK_CELL_VOLTAGE_s test_cellVoltageWrite = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+
+/** hands a write access of #test_cellVoltageWrite to the database task */
+static OS_STD_RETURN_e TEST_OS_ReceiveWriteMessage(
+    OS_QUEUE xQueue,
+    void *const pvBuffer,
+    uint32_t ticksToWait,
+    int cmock_num_calls) {
+    (void)xQueue;
+    (void)ticksToWait;
+    (void)cmock_num_calls;
+    DATA_QUEUE_MESSAGE_s *pMessage                = pvBuffer;
+    pMessage->accessType                   = DATA_WRITE_ACCESS;
+    pMessage->pDatabaseEntry[DATA_ENTRY_0] = &test_cellVoltageWrite;
+    return OS_SUCCESS;
+}
+
+/** simulates a write of all cell voltages by a writer that preempts the consumer */
+static void TEST_WriteAllCellVoltages(int16_t voltage_mV) {
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+                test_cellVoltageWrite.cellVoltage_mV[s][m][cb] = voltage_mV;
+            }
+        }
+    }
+    DATA_Task();
+}
+
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    OS_ReceiveFromQueue_Stub(&TEST_OS_ReceiveWriteMessage);
+    OS_GetTickCount_IgnoreAndReturn(0u);
+    ftsk_databaseQueue = (OS_QUEUE)&test_databaseQueueMemory;
+    TEST_ASSERT_EQUAL(STD_OK, DATA_Initialize());
 }
 
 void tearDown(void) {
+    ftsk_databaseQueue = NULL_PTR;
 }
 
 void testDummy(void) {
@@ -119,3 +161,153 @@ void testDATA_ExecuteDataBist(void) {
 }
 
 /*========== Test Cases =====================================================*/
+void testDATA_ConsumeWriteNotificationsInvalidSubscriber(void) {
+    TEST_ASSERT_FAIL_ASSERT(DATA_ConsumeWriteNotifications(DATA_SUBSCRIBER_E_MAX));
+}
+
+void testDATA_PublishWriteAccessInvalidBlockId(void) {
+    TEST_ASSERT_FAIL_ASSERT(TEST_DATA_PublishWriteAccess(DATA_BLOCK_ID_MAX));
+}
+
+void testDATA_WriteNotificationsOnlyReachSubscribers(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    /* discard notifications of previous tests */
+    for (uint8_t subscriber = 0u; subscriber < (uint8_t)DATA_SUBSCRIBER_E_MAX; subscriber++) {
+        (void)DATA_ConsumeWriteNotifications((DATA_SUBSCRIBER_e)subscriber);
+    }
+
+    /* a not subscribed data block notifies nobody */
+    TEST_DATA_PublishWriteAccess(DATA_BLOCK_ID_SOC);
+    TEST_ASSERT_EQUAL_UINT64(0u, DATA_ConsumeWriteNotifications(DATA_SUBSCRIBER_AFE_MEASUREMENT_VALIDATION));
+    TEST_ASSERT_EQUAL_UINT64(0u, DATA_ConsumeWriteNotifications(DATA_SUBSCRIBER_PACK_MEASUREMENT_VALIDATION));
+
+    /* raw cell voltages notify the AFE measurement validation only */
+    TEST_DATA_PublishWriteAccess(DATA_BLOCK_ID_CELL_VOLTAGE_BASE);
+    TEST_ASSERT_EQUAL_UINT64(
+        DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CELL_VOLTAGE_BASE),
+        DATA_ConsumeWriteNotifications(DATA_SUBSCRIBER_AFE_MEASUREMENT_VALIDATION));
+    TEST_ASSERT_EQUAL_UINT64(0u, DATA_ConsumeWriteNotifications(DATA_SUBSCRIBER_PACK_MEASUREMENT_VALIDATION));
+
+    /* validated cell voltages and the current sensor notify the pack measurement validation only */
+    TEST_DATA_PublishWriteAccess(DATA_BLOCK_ID_CELL_VOLTAGE);
+    TEST_DATA_PublishWriteAccess(DATA_BLOCK_ID_CURRENT_SENSOR);
+    TEST_ASSERT_EQUAL_UINT64(0u, DATA_ConsumeWriteNotifications(DATA_SUBSCRIBER_AFE_MEASUREMENT_VALIDATION));
+    TEST_ASSERT_EQUAL_UINT64(
+        (DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CELL_VOLTAGE) |
+         DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CURRENT_SENSOR)),
+        DATA_ConsumeWriteNotifications(DATA_SUBSCRIBER_PACK_MEASUREMENT_VALIDATION));
+}
+
+void testDATA_WriteNotificationsAreConsumedOnce(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    (void)DATA_ConsumeWriteNotifications(DATA_SUBSCRIBER_AFE_MEASUREMENT_VALIDATION);
+
+    /* multiple write accesses before the subscriber runs are reported once */
+    TEST_DATA_PublishWriteAccess(DATA_BLOCK_ID_CELL_TEMPERATURE_BASE);
+    TEST_DATA_PublishWriteAccess(DATA_BLOCK_ID_CELL_TEMPERATURE_BASE);
+    TEST_DATA_PublishWriteAccess(DATA_BLOCK_ID_CELL_VOLTAGE_REDUNDANCY0);
+    TEST_ASSERT_EQUAL_UINT64(
+        (DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CELL_TEMPERATURE_BASE) |
+         DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CELL_VOLTAGE_REDUNDANCY0)),
+        DATA_ConsumeWriteNotifications(DATA_SUBSCRIBER_AFE_MEASUREMENT_VALIDATION));
+    TEST_ASSERT_EQUAL_UINT64(0u, DATA_ConsumeWriteNotifications(DATA_SUBSCRIBER_AFE_MEASUREMENT_VALIDATION));
+}
+
+void testDATA_BorrowDataBlockInvalidInput(void) {
+    DATA_READ_VIEW_s view = {0};
+    TEST_ASSERT_FAIL_ASSERT(DATA_BorrowDataBlock(DATA_BLOCK_ID_MAX, &view));
+    TEST_ASSERT_FAIL_ASSERT(DATA_BorrowDataBlock(DATA_BLOCK_ID_CELL_VOLTAGE, NULL_PTR));
+    TEST_ASSERT_FAIL_ASSERT(DATA_ReturnDataBlock(NULL_PTR));
+    view.blockId = DATA_BLOCK_ID_MAX;
+    TEST_ASSERT_FAIL_ASSERT(DATA_ReturnDataBlock(&view));
+}
+
+void testDATA_BorrowDataBlockLendsDatabaseEntry(void) {
+    DATA_READ_VIEW_s view = {0};
+    DATA_BorrowDataBlock(DATA_BLOCK_ID_CELL_VOLTAGE, &view);
+    const DATA_BLOCK_CELL_VOLTAGE_s *pkCellVoltage = view.pkDataBlock;
+    const void *pkDatabaseEntry                    = NULL_PTR;
+    for (uint8_t entry = 0u; entry < (uint8_t)DATA_BLOCK_ID_MAX; entry++) {
+        const DATA_BLOCK_HEADER_s *pkHeader = data_database[entry].pDatabaseEntry;
+        if (pkHeader->uniqueId == DATA_BLOCK_ID_CELL_VOLTAGE) {
+            pkDatabaseEntry = pkHeader;
+        }
+    }
+    TEST_ASSERT_EQUAL_PTR(pkDatabaseEntry, pkCellVoltage);
+    TEST_ASSERT_EQUAL(DATA_BLOCK_ID_CELL_VOLTAGE, pkCellVoltage->header.uniqueId);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(DATA_BLOCK_CELL_VOLTAGE_s), view.dataLength);
+    TEST_ASSERT_EQUAL(STD_OK, DATA_ReturnDataBlock(&view));
+}
+
+void testDATA_ReturnDataBlockDetectsConcurrentWrite(void) {
+    DATA_READ_VIEW_s view = {0};
+    DATA_BorrowDataBlock(DATA_BLOCK_ID_CELL_VOLTAGE, &view);
+    const DATA_BLOCK_CELL_VOLTAGE_s *pkCellVoltage = view.pkDataBlock;
+
+    /* the database task preempts the consumer; the view shows the new values without a copy */
+    TEST_WriteAllCellVoltages(3700);
+    TEST_ASSERT_EQUAL_INT16(3700, pkCellVoltage->cellVoltage_mV[0][0][0]);
+    TEST_ASSERT_EQUAL(STD_NOT_OK, DATA_ReturnDataBlock(&view));
+
+    /* borrowing again yields a consistent view */
+    DATA_BorrowDataBlock(DATA_BLOCK_ID_CELL_VOLTAGE, &view);
+    TEST_ASSERT_EQUAL(STD_OK, DATA_ReturnDataBlock(&view));
+}
+
+void testDATA_ReturnDataBlockIgnoresWritesOfOtherDataBlocks(void) {
+    DATA_READ_VIEW_s view = {0};
+    DATA_BorrowDataBlock(DATA_BLOCK_ID_MIN_MAX, &view);
+    TEST_WriteAllCellVoltages(3700);
+    TEST_ASSERT_EQUAL(STD_OK, DATA_ReturnDataBlock(&view));
+}
+
+/**
+ * interleaving test: the database task preempts a consumer at a random cell
+ * and writes a new state, in which all cell voltages are equal. A view that
+ * is returned successfully must always show one consistent state.
+ */
+void testDATA_BorrowedViewsUnderInterleavedWrites(void) {
+    uint32_t numberOfTornViews      = 0u;
+    uint32_t numberOfDetectedWrites = 0u;
+    int16_t voltage_mV              = 3000;
+    TEST_WriteAllCellVoltages(voltage_mV);
+    srand(7u);
+
+    for (uint32_t interleaving = 0u; interleaving < TEST_NUMBER_OF_INTERLEAVINGS; interleaving++) {
+        const bool isPreempted       = ((rand() % 2) == 0);
+        const uint16_t preemptedCell = (uint16_t)(rand() % BS_NR_OF_CELL_BLOCKS_PER_STRING);
+        DATA_READ_VIEW_s view        = {0};
+        DATA_BorrowDataBlock(DATA_BLOCK_ID_CELL_VOLTAGE, &view);
+        const DATA_BLOCK_CELL_VOLTAGE_s *pkCellVoltage = view.pkDataBlock;
+
+        bool isConsistent             = true;
+        const int16_t firstVoltage_mV = pkCellVoltage->cellVoltage_mV[0][0][0];
+        for (uint16_t c = 0u; c < BS_NR_OF_CELL_BLOCKS_PER_STRING; c++) {
+            if ((isPreempted == true) && (c == preemptedCell)) {
+                voltage_mV++;
+                TEST_WriteAllCellVoltages(voltage_mV);
+            }
+            const int16_t cellVoltage_mV = pkCellVoltage->cellVoltage_mV[0][c / BS_NR_OF_CELL_BLOCKS_PER_MODULE]
+                                                                        [c % BS_NR_OF_CELL_BLOCKS_PER_MODULE];
+            if (cellVoltage_mV != firstVoltage_mV) {
+                isConsistent = false;
+            }
+        }
+
+        if (DATA_ReturnDataBlock(&view) == STD_OK) {
+            TEST_ASSERT_FALSE(isPreempted);
+            TEST_ASSERT_TRUE(isConsistent);
+        } else {
+            TEST_ASSERT_TRUE(isPreempted);
+            numberOfDetectedWrites++;
+        }
+        if (isConsistent == false) {
+            numberOfTornViews++;
+        }
+    }
+    /* the test covers both, torn and consistent views */
+    TEST_ASSERT_GREATER_THAN(0u, numberOfTornViews);
+    TEST_ASSERT_LESS_THAN(TEST_NUMBER_OF_INTERLEAVINGS, numberOfDetectedWrites);
+}
@@ -43,7 +43,7 @@
  * @file    test_database_helper.c
  * @author  foxBMS Team
  * @date    2021-05-05 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -64,9 +64,47 @@
 #include "database_helper.h"
 #include "test_assert_helper.h"
 
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#include <time.h>
+#endif
+
 /*========== Unit Testing Framework Directives ==============================*/
 
 /*========== Definitions and Implementations for Unit Test ==================*/
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+/** number of iterations over the complete pack in the benchmark */
+#define TEST_BENCHMARK_NR_OF_ITERATIONS (200000u)
+#endif
+
+static DATA_BLOCK_CELL_VOLTAGE_s test_cellVoltages          = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+static DATA_BLOCK_BALANCING_CONTROL_s test_balancingControl = {.header.uniqueId = DATA_BLOCK_ID_BALANCING_CONTROL};
+static DATA_BLOCK_CELL_TEMPERATURE_s test_cellTemperatures  = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
+
+/** sets distinct voltages, balancing states and invalid flags for all cell blocks and temperature sensors */
+static void TEST_SetCellBlocks(void) {
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+            test_cellVoltages.invalidCellVoltage[s][m]         = 0u;
+            test_cellTemperatures.invalidCellTemperature[s][m] = 0u;
+            for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+                const uint16_t cellIndex = (uint16_t)((s * BS_NR_OF_CELL_BLOCKS_PER_STRING) +
+                                                      (m * BS_NR_OF_CELL_BLOCKS_PER_MODULE) + cb);
+                test_cellVoltages.cellVoltage_mV[s][m][cb] = (int16_t)(3000 + cellIndex);
+                test_balancingControl.balancingState[s][(m * BS_NR_OF_CELL_BLOCKS_PER_MODULE) + cb] =
+                    (uint8_t)(cellIndex % 2u);
+                if ((cellIndex % 3u) == 0u) {
+                    test_cellVoltages.invalidCellVoltage[s][m] |= ((uint64_t)1u << cb);
+                }
+            }
+            for (uint8_t ts = 0u; ts < BS_NR_OF_TEMP_SENSORS_PER_MODULE; ts++) {
+                if ((ts % 2u) == 1u) {
+                    test_cellTemperatures.invalidCellTemperature[s][m] |= (uint16_t)(1u << ts);
+                }
+            }
+        }
+    }
+}
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
@@ -348,3 +386,151 @@ void testDATA_GetSensorNumberFromTemperatureIndex(void) {
         BS_NR_OF_MODULES_PER_STRING * BS_NR_OF_TEMP_SENSORS_PER_MODULE * BS_NR_OF_STRINGS));
     TEST_ASSERT_FAIL_ASSERT(DATA_GetSensorNumberFromTemperatureIndex(UINT16_MAX));
 }
+
+/** The topology lookup tables are equal to the index conversion functions */
+void testDATA_TopologyLookupTables(void) {
+    for (uint16_t c = 0u; c < DATA_NR_OF_CELL_BLOCKS; c++) {
+        TEST_ASSERT_EQUAL(DATA_GetStringNumberFromVoltageIndex(c), data_kCellBlockPosition[c].stringNumber);
+        TEST_ASSERT_EQUAL(DATA_GetModuleNumberFromVoltageIndex(c), data_kCellBlockPosition[c].moduleNumber);
+        TEST_ASSERT_EQUAL(DATA_GetCellNumberFromVoltageIndex(c), data_kCellBlockPosition[c].number);
+    }
+    for (uint16_t t = 0u; t < BS_NR_OF_TEMP_SENSORS; t++) {
+        TEST_ASSERT_EQUAL(DATA_GetStringNumberFromTemperatureIndex(t), data_kTemperatureSensorPosition[t].stringNumber);
+        TEST_ASSERT_EQUAL(DATA_GetModuleNumberFromTemperatureIndex(t), data_kTemperatureSensorPosition[t].moduleNumber);
+        TEST_ASSERT_EQUAL(DATA_GetSensorNumberFromTemperatureIndex(t), data_kTemperatureSensorPosition[t].number);
+    }
+}
+
+/** This function tests the expansion of the invalid flags into one flag per cell block or temperature sensor */
+void testDATA_ExpandInvalidFlags(void) {
+    TEST_SetCellBlocks();
+
+    uint8_t invalidCellVoltages[DATA_NR_OF_CELL_BLOCKS] = {0u};
+    TEST_ASSERT_FAIL_ASSERT(DATA_ExpandInvalidCellVoltages(NULL_PTR, invalidCellVoltages));
+    TEST_ASSERT_FAIL_ASSERT(DATA_ExpandInvalidCellVoltages(&test_cellVoltages, NULL_PTR));
+    DATA_ExpandInvalidCellVoltages(&test_cellVoltages, invalidCellVoltages);
+    for (uint16_t c = 0u; c < DATA_NR_OF_CELL_BLOCKS; c++) {
+        TEST_ASSERT_EQUAL_UINT8((uint8_t)((c % 3u) == 0u), invalidCellVoltages[c]);
+    }
+
+    uint8_t invalidTemperatures[BS_NR_OF_TEMP_SENSORS] = {0u};
+    TEST_ASSERT_FAIL_ASSERT(DATA_ExpandInvalidCellTemperatures(NULL_PTR, invalidTemperatures));
+    TEST_ASSERT_FAIL_ASSERT(DATA_ExpandInvalidCellTemperatures(&test_cellTemperatures, NULL_PTR));
+    DATA_ExpandInvalidCellTemperatures(&test_cellTemperatures, invalidTemperatures);
+    for (uint16_t t = 0u; t < BS_NR_OF_TEMP_SENSORS; t++) {
+        const uint8_t isInvalid = (uint8_t)((data_kTemperatureSensorPosition[t].number % 2u) == 1u);
+        TEST_ASSERT_EQUAL_UINT8(isInvalid, invalidTemperatures[t]);
+    }
+}
+
+/** The temperature sensor of a cell block is a sensor of the same module */
+void testDATA_TemperatureSensorOfCellBlock(void) {
+    for (uint16_t c = 0u; c < DATA_NR_OF_CELL_BLOCKS; c++) {
+        const uint16_t sensor = data_kTemperatureSensorOfCellBlock[c];
+        TEST_ASSERT_TRUE(sensor < BS_NR_OF_TEMP_SENSORS);
+        const DATA_POSITION_s *const kpkSensorPosition = &data_kTemperatureSensorPosition[sensor];
+        TEST_ASSERT_EQUAL(data_kCellBlockPosition[c].stringNumber, kpkSensorPosition->stringNumber);
+        TEST_ASSERT_EQUAL(data_kCellBlockPosition[c].moduleNumber, kpkSensorPosition->moduleNumber);
+    }
+    /* the first and the last sensor of a module are assigned to the first and the last cell block */
+    TEST_ASSERT_EQUAL(0u, data_kTemperatureSensorOfCellBlock[0u]);
+    TEST_ASSERT_EQUAL(
+        BS_NR_OF_TEMP_SENSORS_PER_MODULE - 1u,
+        data_kTemperatureSensorOfCellBlock[BS_NR_OF_CELL_BLOCKS_PER_MODULE - 1u]);
+    TEST_ASSERT_EQUAL(BS_NR_OF_TEMP_SENSORS - 1u, data_kTemperatureSensorOfCellBlock[DATA_NR_OF_CELL_BLOCKS - 1u]);
+}
+
+/** This function tests the flat view of the cell blocks */
+void testDATA_GetCellView(void) {
+    TEST_SetCellBlocks();
+    DATA_CELL_VIEW_s view = {0};
+    TEST_ASSERT_FAIL_ASSERT(DATA_GetCellView(NULL_PTR, &test_balancingControl, &view));
+    TEST_ASSERT_FAIL_ASSERT(DATA_GetCellView(&test_cellVoltages, NULL_PTR, &view));
+    TEST_ASSERT_FAIL_ASSERT(DATA_GetCellView(&test_cellVoltages, &test_balancingControl, NULL_PTR));
+
+    DATA_GetCellView(&test_cellVoltages, &test_balancingControl, &view);
+
+    for (uint16_t c = 0u; c < DATA_NR_OF_CELL_BLOCKS; c++) {
+        const uint8_t s  = data_kCellBlockPosition[c].stringNumber;
+        const uint8_t m  = data_kCellBlockPosition[c].moduleNumber;
+        const uint8_t cb = data_kCellBlockPosition[c].number;
+        TEST_ASSERT_EQUAL_INT16(test_cellVoltages.cellVoltage_mV[s][m][cb], view.pkCellVoltage_mV[c]);
+        TEST_ASSERT_EQUAL_UINT8((uint8_t)((c % 3u) == 0u), view.invalidCellVoltage[c]);
+        TEST_ASSERT_EQUAL_UINT8((uint8_t)(c % 2u), view.pkBalancingState[c]);
+        TEST_ASSERT_EQUAL_UINT16(data_kTemperatureSensorOfCellBlock[c], view.pkTemperatureSensor[c]);
+    }
+}
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+/** host benchmark: compares nested loops and index conversion functions with the flat view and the lookup tables */
+void testDATA_CellTopologyBenchmark(void) {
+    TEST_SetCellBlocks();
+
+    /* full-pack iteration: sum of the valid voltages of the balanced cell blocks */
+    int32_t nestedSum = 0;
+    clock_t start     = clock();
+    for (uint32_t iteration = 0u; iteration < TEST_BENCHMARK_NR_OF_ITERATIONS; iteration++) {
+        for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+            for (uint8_t m = 0u; m < BS_NR_OF_MODULES_PER_STRING; m++) {
+                for (uint8_t cb = 0u; cb < BS_NR_OF_CELL_BLOCKS_PER_MODULE; cb++) {
+                    const bool isValid = (test_cellVoltages.invalidCellVoltage[s][m] & ((uint64_t)1u << cb)) == 0u;
+                    const uint8_t balancing =
+                        test_balancingControl.balancingState[s][(m * BS_NR_OF_CELL_BLOCKS_PER_MODULE) + cb];
+                    if (isValid && (balancing == 1u)) {
+                        nestedSum += test_cellVoltages.cellVoltage_mV[s][m][cb];
+                    }
+                }
+            }
+        }
+    }
+    const clock_t nestedTicks = clock() - start;
+
+    int32_t flatSum       = 0;
+    DATA_CELL_VIEW_s view = {0};
+    start                 = clock();
+    for (uint32_t iteration = 0u; iteration < TEST_BENCHMARK_NR_OF_ITERATIONS; iteration++) {
+        DATA_GetCellView(&test_cellVoltages, &test_balancingControl, &view);
+        for (uint16_t c = 0u; c < DATA_NR_OF_CELL_BLOCKS; c++) {
+            const int32_t isSummed = (int32_t)((view.invalidCellVoltage[c] == 0u) && (view.pkBalancingState[c] == 1u));
+            flatSum += isSummed * view.pkCellVoltage_mV[c];
+        }
+    }
+    const clock_t flatTicks = clock() - start;
+    TEST_ASSERT_EQUAL_INT32(nestedSum, flatSum);
+
+    /* index conversion: linear index to string, module and cell block */
+    uint32_t functionChecksum = 0u;
+    start                     = clock();
+    for (uint32_t iteration = 0u; iteration < TEST_BENCHMARK_NR_OF_ITERATIONS; iteration++) {
+        for (uint16_t c = 0u; c < DATA_NR_OF_CELL_BLOCKS; c++) {
+            functionChecksum += DATA_GetStringNumberFromVoltageIndex(c) + DATA_GetModuleNumberFromVoltageIndex(c) +
+                                DATA_GetCellNumberFromVoltageIndex(c);
+        }
+    }
+    const clock_t functionTicks = clock() - start;
+
+    uint32_t tableChecksum = 0u;
+    start                  = clock();
+    for (uint32_t iteration = 0u; iteration < TEST_BENCHMARK_NR_OF_ITERATIONS; iteration++) {
+        for (uint16_t c = 0u; c < DATA_NR_OF_CELL_BLOCKS; c++) {
+            tableChecksum += (uint32_t)data_kCellBlockPosition[c].stringNumber +
+                             data_kCellBlockPosition[c].moduleNumber + data_kCellBlockPosition[c].number;
+        }
+    }
+    const clock_t tableTicks = clock() - start;
+    TEST_ASSERT_EQUAL_UINT32(functionChecksum, tableChecksum);
+
+    const double nrOfCells = (double)TEST_BENCHMARK_NR_OF_ITERATIONS * DATA_NR_OF_CELL_BLOCKS;
+    const double toNs      = 1.0e9 / ((double)CLOCKS_PER_SEC * nrOfCells);
+    char message[200]      = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "per cell block: nested loops %.2f ns, flat view %.2f ns; index functions %.2f ns, lookup tables %.2f ns",
+        (double)nestedTicks * toNs,
+        (double)flatTicks * toNs,
+        (double)functionTicks * toNs,
+        (double)tableTicks * toNs);
+    TEST_MESSAGE(message);
+}
+#endif
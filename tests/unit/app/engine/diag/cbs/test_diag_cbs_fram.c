@@ -43,7 +43,7 @@
  * @file    test_diag_cbs_fram.c
  * @author  foxBMS Team
  * @date    2022-02-24 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -112,6 +112,20 @@ void testDIAGFramError(void) {
     TEST_ASSERT_EQUAL(false, diag_kpkDatabaseShim.pTableError->framReadCrcError);
 }
 
+void testDIAGFramErrorLoadSpectrumReset(void) {
+    diag_kpkDatabaseShim.pTableError->loadSpectrumResetError = false;
+    DIAG_FramError(DIAG_ID_LOAD_SPECTRUM_RESET, DIAG_EVENT_OK, &diag_kpkDatabaseShim, 0u);
+    TEST_ASSERT_EQUAL(false, diag_kpkDatabaseShim.pTableError->loadSpectrumResetError);
+
+    DIAG_FramError(DIAG_ID_LOAD_SPECTRUM_RESET, DIAG_EVENT_NOT_OK, &diag_kpkDatabaseShim, 0u);
+    TEST_ASSERT_EQUAL(true, diag_kpkDatabaseShim.pTableError->loadSpectrumResetError);
+    /* the FRAM CRC error is not affected */
+    TEST_ASSERT_EQUAL(false, diag_kpkDatabaseShim.pTableError->framReadCrcError);
+
+    DIAG_FramError(DIAG_ID_LOAD_SPECTRUM_RESET, DIAG_EVENT_RESET, &diag_kpkDatabaseShim, 0u);
+    TEST_ASSERT_EQUAL(false, diag_kpkDatabaseShim.pTableError->loadSpectrumResetError);
+}
+
 /** test against invalid input */
 void testDIAG_FramErrorInvalidInput(void) {
     TEST_ASSERT_FAIL_ASSERT(DIAG_FramError(DIAG_ID_MAX, DIAG_EVENT_OK, &diag_kpkDatabaseShim, 0u));
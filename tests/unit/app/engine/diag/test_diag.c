@@ -43,7 +43,7 @@
  * @file    test_diag.c
  * @author  foxBMS Team
  * @date    2020-04-02 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -56,19 +56,58 @@
 #include "unity.h"
 #include "Mockdatabase.h"
 #include "Mockdiag_cbs.h"
+#include "Mockos.h"
 
 #include "diag_cfg.h"
 
 #include "diag.h"
+#include "test_assert_helper.h"
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#include <time.h>
+#endif
 
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_INCLUDE_PATH("../../src/app/engine/diag")
 TEST_INCLUDE_PATH("../../src/app/engine/diag/cbs")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+/** number of strings of the pack in the benchmark */
+#define TEST_BENCHMARK_NR_OF_STRINGS (16u)
+/** number of simulated 10ms cycles in the benchmark */
+#define TEST_BENCHMARK_NR_OF_CYCLES (100000u)
+#endif
+/** number of events that the SOA checks report per string and cycle */
+#define TEST_EVENTS_PER_STRING (17u)
+
+/** events that the SOA checks report per string in a cycle without violated limit */
+static const DIAG_ID_e test_soaDiagnosisEntries[TEST_EVENTS_PER_STRING] = {
+    DIAG_ID_CELL_VOLTAGE_OVERVOLTAGE_MOL,
+    DIAG_ID_CELL_VOLTAGE_OVERVOLTAGE_RSL,
+    DIAG_ID_CELL_VOLTAGE_OVERVOLTAGE_MSL,
+    DIAG_ID_CELL_VOLTAGE_UNDERVOLTAGE_MOL,
+    DIAG_ID_CELL_VOLTAGE_UNDERVOLTAGE_RSL,
+    DIAG_ID_CELL_VOLTAGE_UNDERVOLTAGE_MSL,
+    DIAG_ID_TEMP_OVERTEMPERATURE_DISCHARGE_MOL,
+    DIAG_ID_TEMP_OVERTEMPERATURE_DISCHARGE_RSL,
+    DIAG_ID_TEMP_OVERTEMPERATURE_DISCHARGE_MSL,
+    DIAG_ID_TEMP_UNDERTEMPERATURE_DISCHARGE_MOL,
+    DIAG_ID_TEMP_UNDERTEMPERATURE_DISCHARGE_RSL,
+    DIAG_ID_TEMP_UNDERTEMPERATURE_DISCHARGE_MSL,
+    DIAG_ID_STRING_OVERCURRENT_CHARGE_MSL,
+    DIAG_ID_OVERCURRENT_CHARGE_CELL_MSL,
+    DIAG_ID_STRING_OVERCURRENT_DISCHARGE_MSL,
+    DIAG_ID_OVERCURRENT_DISCHARGE_CELL_MSL,
+    DIAG_ID_CURRENT_ON_OPEN_STRING,
+};
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    TEST_ASSERT_EQUAL(STD_OK, DIAG_Initialize(&diag_device));
 }
 
 void tearDown(void) {
@@ -77,3 +116,107 @@ void tearDown(void) {
 /*========== Test Cases =====================================================*/
 void testDummy(void) {
 }
+
+void testDIAG_HandleEventsInvalidInput(void) {
+    DIAG_BATCH_EVENT_s events[1u] = {{.diagId = DIAG_ID_FLASHCHECKSUM, .event = DIAG_EVENT_OK}};
+    TEST_ASSERT_FAIL_ASSERT(DIAG_HandleEvents(NULL_PTR, 1u, DIAG_SYSTEM, 0u));
+    TEST_ASSERT_EQUAL(DIAG_HANDLER_INVALID_ERR_IMPACT, DIAG_HandleEvents(events, 1u, (DIAG_IMPACT_LEVEL_e)2u, 0u));
+    TEST_ASSERT_EQUAL(DIAG_HANDLER_INVALID_DATA, DIAG_HandleEvents(events, 1u, DIAG_STRING, BS_NR_OF_STRINGS));
+    events[0u].diagId = DIAG_ID_MAX;
+    TEST_ASSERT_EQUAL(DIAG_HANDLER_RETURN_OK, DIAG_HandleEvents(events, 1u, DIAG_SYSTEM, 0u));
+    TEST_ASSERT_EQUAL(DIAG_HANDLER_RETURN_WRONG_ID, events[0u].result);
+}
+
+void testDIAG_HandleEventsEvaluatesEveryEvent(void) {
+    DIAG_DummyCallback_Ignore();
+    DIAG_BATCH_EVENT_s events[2u] = {
+        {.diagId = DIAG_ID_FLASHCHECKSUM, .event = DIAG_EVENT_NOT_OK, .result = DIAG_HANDLER_RETURN_UNKNOWN},
+        {.diagId = DIAG_ID_CONFIGASSERT, .event = DIAG_EVENT_OK, .result = DIAG_HANDLER_RETURN_UNKNOWN},
+    };
+    TEST_ASSERT_EQUAL(DIAG_HANDLER_RETURN_OK, DIAG_HandleEvents(events, 2u, DIAG_SYSTEM, 0u));
+    /* sensitivity of the first event: the error occurred immediately */
+    TEST_ASSERT_EQUAL(DIAG_HANDLER_RETURN_ERR_OCCURRED, events[0u].result);
+    TEST_ASSERT_EQUAL(DIAG_HANDLER_RETURN_OK, events[1u].result);
+    TEST_ASSERT_EQUAL(STD_NOT_OK, DIAG_GetDiagnosisEntryState(DIAG_ID_FLASHCHECKSUM));
+
+    /* same result as with a single event */
+    TEST_ASSERT_EQUAL(
+        DIAG_HANDLER_RETURN_ERR_OCCURRED, DIAG_Handler(DIAG_ID_FLASHCHECKSUM, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u));
+
+    events[0u].event = DIAG_EVENT_RESET;
+    TEST_ASSERT_EQUAL(DIAG_HANDLER_RETURN_OK, DIAG_HandleEvents(events, 1u, DIAG_SYSTEM, 0u));
+    TEST_ASSERT_EQUAL(DIAG_HANDLER_RETURN_OK, events[0u].result);
+    TEST_ASSERT_EQUAL(STD_OK, DIAG_GetDiagnosisEntryState(DIAG_ID_FLASHCHECKSUM));
+}
+
+/** the batched events of the SOA checks are evaluated as the same events reported one by one */
+void testDIAG_HandleEventsEquivalentToSingleEvents(void) {
+    uint32_t singleResults = 0u;
+    for (uint8_t i = 0u; i < TEST_EVENTS_PER_STRING; i++) {
+        singleResults += (uint32_t)DIAG_Handler(test_soaDiagnosisEntries[i], DIAG_EVENT_OK, DIAG_STRING, 0u);
+    }
+
+    /* the events are classified by the caller */
+    DIAG_BATCH_EVENT_s events[TEST_EVENTS_PER_STRING] = {0};
+    for (uint8_t i = 0u; i < TEST_EVENTS_PER_STRING; i++) {
+        events[i].diagId = test_soaDiagnosisEntries[i];
+        events[i].event  = DIAG_EVENT_OK;
+    }
+    const DIAG_RETURNTYPE_e batchResult = DIAG_HandleEvents(events, TEST_EVENTS_PER_STRING, DIAG_STRING, 0u);
+
+    /* all events have been evaluated as OK in both cases */
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)DIAG_HANDLER_RETURN_OK, singleResults);
+    TEST_ASSERT_EQUAL(DIAG_HANDLER_RETURN_OK, batchResult);
+    for (uint8_t i = 0u; i < TEST_EVENTS_PER_STRING; i++) {
+        TEST_ASSERT_EQUAL(DIAG_HANDLER_RETURN_OK, events[i].result);
+        TEST_ASSERT_EQUAL(STD_OK, DIAG_GetDiagnosisEntryState(test_soaDiagnosisEntries[i]));
+    }
+}
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+/** compares the overhead of the diagnosis reporting of the SOA checks with single and with batched events */
+void testDIAG_HandleEventsBenchmark(void) {
+    /* the unit test configuration has less strings than the benchmarked pack:
+     * the events of all strings are reported for the first string */
+    const uint32_t nrOfEvents = TEST_BENCHMARK_NR_OF_CYCLES * TEST_BENCHMARK_NR_OF_STRINGS * TEST_EVENTS_PER_STRING;
+
+    volatile uint32_t singleResults = 0u;
+    clock_t start                   = clock();
+    for (uint32_t cycle = 0u; cycle < TEST_BENCHMARK_NR_OF_CYCLES; cycle++) {
+        for (uint8_t string = 0u; string < TEST_BENCHMARK_NR_OF_STRINGS; string++) {
+            for (uint8_t i = 0u; i < TEST_EVENTS_PER_STRING; i++) {
+                singleResults += (uint32_t)DIAG_Handler(test_soaDiagnosisEntries[i], DIAG_EVENT_OK, DIAG_STRING, 0u);
+            }
+        }
+    }
+    const clock_t singleTicks = clock() - start;
+
+    /* the events are classified by the caller, this is not part of the diagnosis overhead */
+    DIAG_BATCH_EVENT_s events[TEST_EVENTS_PER_STRING] = {0};
+    for (uint8_t i = 0u; i < TEST_EVENTS_PER_STRING; i++) {
+        events[i].diagId = test_soaDiagnosisEntries[i];
+        events[i].event  = DIAG_EVENT_OK;
+    }
+    volatile uint32_t batchResults = 0u;
+    start                          = clock();
+    for (uint32_t cycle = 0u; cycle < TEST_BENCHMARK_NR_OF_CYCLES; cycle++) {
+        for (uint8_t string = 0u; string < TEST_BENCHMARK_NR_OF_STRINGS; string++) {
+            batchResults += (uint32_t)DIAG_HandleEvents(events, TEST_EVENTS_PER_STRING, DIAG_STRING, 0u);
+        }
+    }
+    const clock_t batchTicks = clock() - start;
+
+    const double nsPerTick = 1.0e9 / (double)CLOCKS_PER_SEC;
+    char message[160]      = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "%u strings, %u events per string: single events %.0f ns/cycle, batched events %.0f ns/cycle (%u events)",
+        (unsigned int)TEST_BENCHMARK_NR_OF_STRINGS,
+        (unsigned int)TEST_EVENTS_PER_STRING,
+        ((double)singleTicks * nsPerTick) / (double)TEST_BENCHMARK_NR_OF_CYCLES,
+        ((double)batchTicks * nsPerTick) / (double)TEST_BENCHMARK_NR_OF_CYCLES,
+        (unsigned int)nrOfEvents);
+    TEST_MESSAGE(message);
+}
+#endif
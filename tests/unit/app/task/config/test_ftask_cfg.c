@@ -43,7 +43,7 @@
  * @file    test_ftask_cfg.c
  * @author  foxBMS Team
  * @date    2020-04-02 (date of creation)
- * @updated 2023-10-12 (date of last update)
+ * @updated 2026-10-19 (date of last update)
  * @version v1.6.0
  * @ingroup UNIT_TEST_IMPLEMENTATION
  * @prefix  TEST
@@ -61,6 +61,7 @@
 #include "Mockbal.h"
 #include "Mockbms.h"
 #include "Mockcan.h"
+#include "Mockcan_cbs_tx_snapshot.h"
 #include "Mockcontactor.h"
 #include "Mockdatabase.h"
 #include "Mockdiag.h"
@@ -68,6 +69,7 @@
 #include "Mockfram.h"
 #include "Mockhtsensor.h"
 #include "Mocki2c.h"
+#include "Mocki2c_queue.h"
 #include "Mockimd.h"
 #include "Mockinterlock.h"
 #include "Mockled.h"
@@ -90,7 +92,16 @@
 #include "sys_mon_cfg.h"
 
 #include "fassert.h"
+#include "fstd_types.h"
 #include "ftask.h"
+#include "test_assert_helper.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+#include <stdio.h>
+#endif
 
 /*========== Unit Testing Framework Directives ==============================*/
 TEST_INCLUDE_PATH("../../src/app/application/algorithm")
@@ -103,6 +114,7 @@ TEST_INCLUDE_PATH("../../src/app/application/redundancy")
 TEST_INCLUDE_PATH("../../src/app/driver/adc")
 TEST_INCLUDE_PATH("../../src/app/driver/afe/api")
 TEST_INCLUDE_PATH("../../src/app/driver/can")
+TEST_INCLUDE_PATH("../../src/app/driver/can/cbs/tx")
 TEST_INCLUDE_PATH("../../src/app/driver/config")
 TEST_INCLUDE_PATH("../../src/app/driver/contactor")
 TEST_INCLUDE_PATH("../../src/app/driver/dma")
@@ -142,6 +154,125 @@ SBC_STATE_s sbc_stateMcuSupervisor;
 
 SYS_STATE_s sys_state = {0};
 
+/** duration of the simulated operation in ms */
+#define TEST_SIMULATION_DURATION_ms (10000u)
+/** period and phase in which the AFE writes a new measurement in ms */
+#define TEST_AFE_MEASUREMENT_PERIOD_ms (40u)
+#define TEST_AFE_MEASUREMENT_PHASE_ms  (3u)
+/** period and phase in which the current sensor writes a new measurement in ms */
+#define TEST_CURRENT_SENSOR_PERIOD_ms (20u)
+#define TEST_CURRENT_SENSOR_PHASE_ms  (7u)
+/** execution cost of the validations and of the remaining 10ms task in arbitrary units */
+#define TEST_AFE_VALIDATION_COST  (80u)
+#define TEST_PACK_VALIDATION_COST (20u)
+#define TEST_REMAINING_10MS_COST  (100u)
+/** cycle time of the 10ms task in ms */
+#define TEST_10MS_CYCLE_TIME_ms (10u)
+
+/** simulated database write notifications and bookkeeping of the simulation */
+typedef struct {
+    uint64_t pendingNotifications[DATA_SUBSCRIBER_E_MAX];
+    uint32_t now_ms;
+    uint32_t cycleCost;
+    bool unvalidatedAfeMeasurement;
+    uint32_t oldestUnvalidatedAfeMeasurement_ms;
+    uint32_t maximumLatency_ms;
+    uint32_t sumLatency_ms;
+    uint32_t numberOfValidatedMeasurements;
+} TEST_SIMULATION_s;
+
+static TEST_SIMULATION_s test_simulation = {0};
+
+/** result of a simulated operation */
+typedef struct {
+    uint32_t worstCaseCycleCost;
+    uint32_t maximumLatency_ms;
+    uint32_t meanLatency_ms;
+} TEST_SIMULATION_RESULT_s;
+
+static uint64_t TEST_ConsumeWriteNotificationsCallback(DATA_SUBSCRIBER_e subscriber, int cmock_num_calls) {
+    (void)cmock_num_calls;
+    const uint64_t writtenBlocks                     = test_simulation.pendingNotifications[subscriber];
+    test_simulation.pendingNotifications[subscriber] = 0u;
+    return writtenBlocks;
+}
+
+static STD_RETURN_TYPE_e TEST_ValidateAfeMeasurementCallback(int cmock_num_calls) {
+    (void)cmock_num_calls;
+    test_simulation.cycleCost += TEST_AFE_VALIDATION_COST;
+    if (test_simulation.unvalidatedAfeMeasurement == true) {
+        /* the SOA checks of the BMS_Trigger evaluate the new values in the same cycle */
+        const uint32_t latency_ms = test_simulation.now_ms - test_simulation.oldestUnvalidatedAfeMeasurement_ms;
+        if (latency_ms > test_simulation.maximumLatency_ms) {
+            test_simulation.maximumLatency_ms = latency_ms;
+        }
+        test_simulation.sumLatency_ms += latency_ms;
+        test_simulation.numberOfValidatedMeasurements++;
+        test_simulation.unvalidatedAfeMeasurement = false;
+    }
+    /* the validated cell voltages are written to the database */
+    test_simulation.pendingNotifications[DATA_SUBSCRIBER_PACK_MEASUREMENT_VALIDATION] |=
+        DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CELL_VOLTAGE);
+    return STD_OK;
+}
+
+static STD_RETURN_TYPE_e TEST_ValidatePackMeasurementCallback(int cmock_num_calls) {
+    (void)cmock_num_calls;
+    test_simulation.cycleCost += TEST_PACK_VALIDATION_COST;
+    return STD_OK;
+}
+
+/** previous implementation: validate both measurements in every fifth cycle */
+static void TEST_ValidateMeasurementsEvery50ms(void) {
+    static uint8_t cyclic10msCounter = 0u;
+    if (cyclic10msCounter == 5u) {
+        (void)MRC_ValidateAfeMeasurement();
+        (void)MRC_ValidatePackMeasurement();
+        cyclic10msCounter = 0u;
+    }
+    cyclic10msCounter++;
+}
+
+static TEST_SIMULATION_RESULT_s TEST_SimulateOperation(bool notificationDriven) {
+    FTSK_MEASUREMENT_VALIDATION_STATE_s state = {0};
+    TEST_SIMULATION_RESULT_s result           = {0};
+    test_simulation                           = (TEST_SIMULATION_s){0};
+    DATA_ConsumeWriteNotifications_Stub(&TEST_ConsumeWriteNotificationsCallback);
+    MRC_ValidateAfeMeasurement_Stub(&TEST_ValidateAfeMeasurementCallback);
+    MRC_ValidatePackMeasurement_Stub(&TEST_ValidatePackMeasurementCallback);
+
+    for (uint32_t time_ms = 1u; time_ms <= TEST_SIMULATION_DURATION_ms; time_ms++) {
+        test_simulation.now_ms = time_ms;
+        if ((time_ms % TEST_AFE_MEASUREMENT_PERIOD_ms) == TEST_AFE_MEASUREMENT_PHASE_ms) {
+            test_simulation.pendingNotifications[DATA_SUBSCRIBER_AFE_MEASUREMENT_VALIDATION] |=
+                DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CELL_VOLTAGE_BASE);
+            if (test_simulation.unvalidatedAfeMeasurement == false) {
+                test_simulation.unvalidatedAfeMeasurement          = true;
+                test_simulation.oldestUnvalidatedAfeMeasurement_ms = time_ms;
+            }
+        }
+        if ((time_ms % TEST_CURRENT_SENSOR_PERIOD_ms) == TEST_CURRENT_SENSOR_PHASE_ms) {
+            test_simulation.pendingNotifications[DATA_SUBSCRIBER_PACK_MEASUREMENT_VALIDATION] |=
+                DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CURRENT_SENSOR);
+        }
+        if ((time_ms % TEST_10MS_CYCLE_TIME_ms) == 0u) {
+            test_simulation.cycleCost = TEST_REMAINING_10MS_COST;
+            if (notificationDriven == true) {
+                TEST_FTSK_ValidateMeasurements(&state);
+            } else {
+                TEST_ValidateMeasurementsEvery50ms();
+            }
+            if (test_simulation.cycleCost > result.worstCaseCycleCost) {
+                result.worstCaseCycleCost = test_simulation.cycleCost;
+            }
+        }
+    }
+    TEST_ASSERT_NOT_EQUAL_UINT32(0u, test_simulation.numberOfValidatedMeasurements);
+    result.maximumLatency_ms = test_simulation.maximumLatency_ms;
+    result.meanLatency_ms    = test_simulation.sumLatency_ms / test_simulation.numberOfValidatedMeasurements;
+    return result;
+}
+
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
 }
@@ -152,3 +283,101 @@ void tearDown(void) {
 /*========== Test Cases =====================================================*/
 void testDummy(void) {
 }
+
+void testFTSK_ValidateMeasurementsInvalidInput(void) {
+    TEST_ASSERT_FAIL_ASSERT(TEST_FTSK_ValidateMeasurements(NULL_PTR));
+}
+
+void testFTSK_ValidateMeasurementsWithoutNewMeasurement(void) {
+    FTSK_MEASUREMENT_VALIDATION_STATE_s state = {0};
+    /* no notification: nothing is validated until the timeout has elapsed */
+    for (uint8_t cycle = 1u; cycle < 5u; cycle++) {
+        DATA_ConsumeWriteNotifications_ExpectAndReturn(DATA_SUBSCRIBER_AFE_MEASUREMENT_VALIDATION, 0u);
+        DATA_ConsumeWriteNotifications_ExpectAndReturn(DATA_SUBSCRIBER_PACK_MEASUREMENT_VALIDATION, 0u);
+        TEST_FTSK_ValidateMeasurements(&state);
+    }
+    /* timeout: both validations are due, they run in consecutive cycles */
+    DATA_ConsumeWriteNotifications_ExpectAndReturn(DATA_SUBSCRIBER_AFE_MEASUREMENT_VALIDATION, 0u);
+    DATA_ConsumeWriteNotifications_ExpectAndReturn(DATA_SUBSCRIBER_PACK_MEASUREMENT_VALIDATION, 0u);
+    MRC_ValidateAfeMeasurement_ExpectAndReturn(STD_OK);
+    TEST_FTSK_ValidateMeasurements(&state);
+    DATA_ConsumeWriteNotifications_ExpectAndReturn(DATA_SUBSCRIBER_AFE_MEASUREMENT_VALIDATION, 0u);
+    DATA_ConsumeWriteNotifications_ExpectAndReturn(DATA_SUBSCRIBER_PACK_MEASUREMENT_VALIDATION, 0u);
+    MRC_ValidatePackMeasurement_ExpectAndReturn(STD_OK);
+    TEST_FTSK_ValidateMeasurements(&state);
+    TEST_ASSERT_EQUAL_UINT8(0u, state.cyclesSincePackValidation);
+    TEST_ASSERT_EQUAL_UINT8(1u, state.cyclesSinceAfeValidation);
+}
+
+void testFTSK_ValidateMeasurementsOncePerNewMeasurement(void) {
+    FTSK_MEASUREMENT_VALIDATION_STATE_s state = {0};
+    DATA_ConsumeWriteNotifications_ExpectAndReturn(
+        DATA_SUBSCRIBER_AFE_MEASUREMENT_VALIDATION,
+        DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CELL_VOLTAGE_BASE));
+    DATA_ConsumeWriteNotifications_ExpectAndReturn(DATA_SUBSCRIBER_PACK_MEASUREMENT_VALIDATION, 0u);
+    MRC_ValidateAfeMeasurement_ExpectAndReturn(STD_OK);
+    TEST_FTSK_ValidateMeasurements(&state);
+
+    /* the same measurement is not validated twice */
+    DATA_ConsumeWriteNotifications_ExpectAndReturn(DATA_SUBSCRIBER_AFE_MEASUREMENT_VALIDATION, 0u);
+    DATA_ConsumeWriteNotifications_ExpectAndReturn(DATA_SUBSCRIBER_PACK_MEASUREMENT_VALIDATION, 0u);
+    TEST_FTSK_ValidateMeasurements(&state);
+    TEST_ASSERT_FALSE(state.afeValidationPending);
+}
+
+void testFTSK_ValidateMeasurementsRunsOneValidationPerCycle(void) {
+    FTSK_MEASUREMENT_VALIDATION_STATE_s state = {.cyclesSinceAfeValidation = 1u, .cyclesSincePackValidation = 3u};
+    /* both are pending: the pack validation waited longer and runs first */
+    DATA_ConsumeWriteNotifications_ExpectAndReturn(
+        DATA_SUBSCRIBER_AFE_MEASUREMENT_VALIDATION,
+        DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CELL_TEMPERATURE_BASE));
+    DATA_ConsumeWriteNotifications_ExpectAndReturn(
+        DATA_SUBSCRIBER_PACK_MEASUREMENT_VALIDATION, DATA_BLOCK_ID_TO_SUBSCRIPTION_MASK(DATA_BLOCK_ID_CURRENT_SENSOR));
+    MRC_ValidatePackMeasurement_ExpectAndReturn(STD_OK);
+    TEST_FTSK_ValidateMeasurements(&state);
+    TEST_ASSERT_TRUE(state.afeValidationPending);
+
+    /* the deferred AFE validation runs in the next cycle */
+    DATA_ConsumeWriteNotifications_ExpectAndReturn(DATA_SUBSCRIBER_AFE_MEASUREMENT_VALIDATION, 0u);
+    DATA_ConsumeWriteNotifications_ExpectAndReturn(DATA_SUBSCRIBER_PACK_MEASUREMENT_VALIDATION, 0u);
+    MRC_ValidateAfeMeasurement_ExpectAndReturn(STD_OK);
+    TEST_FTSK_ValidateMeasurements(&state);
+    TEST_ASSERT_FALSE(state.afeValidationPending);
+    TEST_ASSERT_FALSE(state.packValidationPending);
+}
+
+void testFTSK_ValidateMeasurementsCycleCostAndLatency(void) {
+    /* Simulation of the 10ms task with an AFE measurement every 40ms and
+     * a current sensor measurement every 20ms: compares the worst-case cost of
+     * a 10ms cycle and the latency between a new AFE measurement and its
+     * evaluation by the SOA checks. The costs are model units, not timings. */
+    const TEST_SIMULATION_RESULT_s every50ms          = TEST_SimulateOperation(false);
+    const TEST_SIMULATION_RESULT_s notificationDriven = TEST_SimulateOperation(true);
+
+#ifdef FOXBMS_UNIT_TEST_BENCHMARK
+    char message[160] = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "every 50ms: worst-case cycle cost %u, measurement-to-SOA latency max %ums mean %ums",
+        (unsigned int)every50ms.worstCaseCycleCost,
+        (unsigned int)every50ms.maximumLatency_ms,
+        (unsigned int)every50ms.meanLatency_ms);
+    TEST_MESSAGE(message);
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "notification driven: worst-case cycle cost %u, measurement-to-SOA latency max %ums mean %ums",
+        (unsigned int)notificationDriven.worstCaseCycleCost,
+        (unsigned int)notificationDriven.maximumLatency_ms,
+        (unsigned int)notificationDriven.meanLatency_ms);
+    TEST_MESSAGE(message);
+#endif
+
+    TEST_ASSERT_EQUAL_UINT32(
+        (TEST_REMAINING_10MS_COST + TEST_AFE_VALIDATION_COST), notificationDriven.worstCaseCycleCost);
+    TEST_ASSERT_LESS_THAN_UINT32(every50ms.worstCaseCycleCost, notificationDriven.worstCaseCycleCost);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(TEST_10MS_CYCLE_TIME_ms, notificationDriven.maximumLatency_ms);
+    TEST_ASSERT_LESS_THAN_UINT32(every50ms.maximumLatency_ms, notificationDriven.maximumLatency_ms);
+    TEST_ASSERT_LESS_THAN_UINT32(every50ms.meanLatency_ms, notificationDriven.meanLatency_ms);
+}
@@ -71,6 +71,7 @@ class CellVoltageFrame(  # pylint: disable=too-many-ancestors,too-many-instance-
         modules=8,
         cells_per_module=12,
         pos=None,
+        refresh_bound_s=10.0,
     ):
         wx.Frame.__init__(self, parent=parent, title=title, style=FRAME_STYLE)
         self.SetPosition(pos)
@@ -79,6 +80,13 @@ class CellVoltageFrame(  # pylint: disable=too-many-ancestors,too-many-instance-
         self.strings = strings
         self.modules = modules
         self.cells_per_module = cells_per_module
+        # In streaming mode the BMS sends changed cells first and the
+        # multiplexer values arrive in any order, but every cell is refreshed
+        # at least once within the refresh bound (see
+        # CANTX_CELL_STREAM_REFRESH_BOUND_ms). Cells that have not been
+        # updated within this bound are greyed out.
+        self.refresh_bound_s = refresh_bound_s
+        self.last_update = {}
         self.grid_table = gridlib.Grid(panel)
         self.grid_table.CreateGrid(self.cells_per_module, self.modules)
         self.grid_table.SetRowLabelSize(100)
@@ -116,6 +124,8 @@ class CellVoltageFrame(  # pylint: disable=too-many-ancestors,too-many-instance-
         mux_id = self._get_mux_id(msg_data)
         for i in range(0, 4):
             cell_id = mux_id * 4 + i
+            if not cell_id < self.cells_per_module * self.modules:
+                break
             cell_voltage = msg_data[f"cellVoltage_{str(cell_id).zfill(3)}"]
             cell_voltage = str(cell_voltage)
             cell_position_in_module = cell_id % self.cells_per_module
@@ -123,8 +133,6 @@ class CellVoltageFrame(  # pylint: disable=too-many-ancestors,too-many-instance-
             cell_voltage_invalid = msg_data[
                 f"cellVoltage_{str(cell_id).zfill(3)}_invalidFlag"
             ]
-            if not cell_id < self.cells_per_module * self.modules:
-                break
             self.grid_table.SetCellValue(
                 cell_position_in_module, cell_position_in_string, cell_voltage
             )
@@ -135,8 +143,17 @@ class CellVoltageFrame(  # pylint: disable=too-many-ancestors,too-many-instance-
             self.grid_table.SetCellBackgroundColour(
                 cell_position_in_module, cell_position_in_string, color
             )
+            position = (cell_position_in_module, cell_position_in_string)
+            self.last_update[position] = value.timestamp
+        self._grey_out_stale_cells(value.timestamp)
         self.grid_table.ForceRefresh()
 
+    def _grey_out_stale_cells(self, now: float):
+        """Greys out cells that have not been updated within the refresh bound"""
+        for (row, col), timestamp in self.last_update.items():
+            if now - timestamp > self.refresh_bound_s:
+                self.grid_table.SetCellBackgroundColour(row, col, wx.LIGHT_GREY)
+
     def _get_mux_id(self, msg_data):
         mux_id_str: str = list(msg_data.values())[0]
         mux_id = [
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Copyright (c) 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+# - "This product is derived from foxBMS®"
+
+"""Reports the RAM usage per object file based on the XML link information
+of the TI ARM linker (``foxbms.elf.xml``) and optionally compares it with the
+RAM usage of a different build."""
+
+import argparse
+import logging
+import sys
+import xml.etree.ElementTree as ET
+from pathlib import Path
+from typing import Dict, Tuple
+
+#: input sections that are placed in RAM
+RAM_SECTIONS = (".bss", ".data", ".sysmem", ".stack", ".sharedRAM")
+
+RamUsage = Dict[Tuple[str, str], int]
+
+
+def get_ram_usage(link_info: Path) -> RamUsage:
+    """Sums the size of all RAM input sections per object file and section
+
+    Args:
+        link_info: XML link information file of the TI ARM linker
+
+    Returns:
+        size in bytes per object file and input section
+    """
+    root = ET.parse(link_info).getroot()
+    files = {}
+    for input_file in root.iter("input_file"):
+        files[input_file.get("id")] = input_file.findtext("name", default="")
+    usage: RamUsage = {}
+    for component in root.iter("object_component"):
+        section = component.findtext("name", default="")
+        if not section.startswith(RAM_SECTIONS):
+            continue
+        size = int(component.findtext("size", default="0"), 0)
+        file_ref = component.find("input_file_ref")
+        obj = ""
+        if file_ref is not None:
+            obj = files.get(file_ref.get("idref"), "")
+        key = (obj, section)
+        usage[key] = usage.get(key, 0) + size
+        logging.debug("%s %s: %d bytes", obj, section, size)
+    return usage
+
+
+def print_report(usage: RamUsage, reference: RamUsage, limit: int) -> None:
+    """Prints the largest RAM consumers and their change to the reference
+
+    Args:
+        usage: RAM usage of the build that is reported
+        reference: RAM usage of the reference build (might be empty)
+        limit: number of printed RAM consumers (0 prints all)
+    """
+    keys = set(usage) | set(reference)
+    rows = sorted(
+        keys,
+        key=lambda k: (abs(usage.get(k, 0) - reference.get(k, 0)), usage.get(k, 0)),
+        reverse=True,
+    )
+    if limit:
+        rows = rows[:limit]
+    print(f"{'object file':<32} {'section':<48} {'size':>8} {'change':>8}")
+    for obj, section in rows:
+        size = usage.get((obj, section), 0)
+        change = size - reference.get((obj, section), 0)
+        print(f"{obj:<32} {section:<48} {size:>8} {change:>+8}")
+    total = sum(usage.values())
+    change = total - sum(reference.values())
+    print(f"{'total':<81} {total:>8} {change:>+8}")
+
+
+def main():
+    """Report the RAM usage of a build."""
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        "-v",
+        "--verbosity",
+        dest="verbosity",
+        action="count",
+        default=0,
+        help="set verbosity level",
+    )
+    parser.add_argument(
+        "link_info",
+        type=Path,
+        help="XML link information of the build (e.g., foxbms.elf.xml)",
+    )
+    parser.add_argument(
+        "-r",
+        "--reference",
+        type=Path,
+        default=None,
+        help="XML link information of the reference build",
+    )
+    parser.add_argument(
+        "-n",
+        "--limit",
+        type=int,
+        default=30,
+        help="number of printed RAM consumers (0 prints all)",
+    )
+    args = parser.parse_args()
+
+    if args.verbosity == 1:
+        logging.basicConfig(level=logging.INFO)
+    elif args.verbosity > 1:
+        logging.basicConfig(level=logging.DEBUG)
+    else:
+        logging.basicConfig(level=logging.ERROR)
+
+    if not args.link_info.is_file():
+        logging.error("'%s' does not exist.", args.link_info)
+        sys.exit(1)
+    reference = {}
+    if args.reference:
+        reference = get_ram_usage(args.reference)
+    print_report(get_ram_usage(args.link_info), reference, args.limit)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,505 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Copyright (c) 2010 - 2023, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# - "This product uses parts of foxBMS®"
+# - "This product includes parts of foxBMS®"
+
+"""Decodes database snapshots that foxBMS sends over the debug CAN interface.
+
+The snapshot is requested with the multiplexer value ``foxBMS_SnapshotRequest``
+of the message ``foxBMS_Debug`` and flow controlled with the multiplexer value
+``foxBMS_SnapshotFlowControl`` (see ``can_cbs_tx_snapshot.h``). This script
+reassembles the frames of the message ``foxBMS_Snapshot`` from a CAN log,
+decodes the snapshot and rebuilds the data blocks as defined in
+``database_cfg.h`` of the used configuration."""
+
+import argparse
+import json
+import logging
+import re
+import struct
+import sys
+from dataclasses import dataclass, field
+from pathlib import Path
+from typing import Any, Dict, Iterator, List, Optional, Tuple
+
+#: root directory of the repository
+REPO_ROOT = Path(__file__).parents[2]
+
+#: default CAN ID of the message foxBMS_Snapshot
+SNAPSHOT_ID = 0x228
+
+MAGIC = b"FS"
+FORMAT_VERSION = 1
+HEADER = struct.Struct(">2sBBBBI")
+BLOCK_HEADER = struct.Struct(">BBHH")
+FLAG_LITTLE_ENDIAN = 0x01
+FLAG_TRUNCATED = 0x02
+BLOCK_FLAG_INCONSISTENT = 0x01
+RUN_ZERO_FLAG = 0x80
+
+FIRST_FRAME = 0x1
+CONSECUTIVE_FRAME = 0x2
+
+#: size and alignment of the scalar types on the target (TI ARM EABI)
+SCALAR_TYPES = {
+    "bool": ("?", 1),
+    "uint8_t": ("B", 1),
+    "int8_t": ("b", 1),
+    "uint16_t": ("H", 2),
+    "int16_t": ("h", 2),
+    "uint32_t": ("I", 4),
+    "int32_t": ("i", 4),
+    "uint64_t": ("Q", 8),
+    "int64_t": ("q", 8),
+    "float_t": ("f", 4),
+    "float": ("f", 4),
+}
+
+#: headers that define the array sizes of the data blocks
+MACRO_HEADERS = (
+    "src/app/application/config/battery_system_cfg.h",
+    "src/app/driver/mcu/mcu.h",
+    "src/app/engine/config/database_cfg.h",
+)
+
+ENUM_SIZE_TO_FORMAT = {1: "B", 2: "H", 4: "I"}
+
+
+@dataclass
+class Member:
+    """Member of a data block"""
+
+    name: str
+    type_name: str
+    dimensions: List[int]
+    offset: int = 0
+
+
+@dataclass
+class Struct:
+    """Data block type and its layout on the target"""
+
+    name: str
+    members: List[Member] = field(default_factory=list)
+    size: int = 0
+    alignment: int = 1
+
+
+@dataclass
+class Schema:
+    """Data block types of the configuration"""
+
+    structs: Dict[str, Struct] = field(default_factory=dict)
+    types: Dict[int, Struct] = field(default_factory=dict)
+    names: Dict[int, str] = field(default_factory=dict)
+
+
+@dataclass
+class Layout:
+    """Memory layout of the target"""
+
+    byte_order: str
+    enum_size: int
+    structs: Dict[str, Struct]
+
+
+@dataclass
+class Snapshot:
+    """Decoded snapshot"""
+
+    little_endian: bool
+    truncated: bool
+    enum_size: int
+    timestamp_ms: int
+    blocks: List[Tuple[int, bool, bytes]]
+
+
+def strip_comments(text: str) -> str:
+    """Removes C comments"""
+    text = re.sub(r"/\*.*?\*/", " ", text, flags=re.S)
+    return re.sub(r"//[^\n]*", " ", text)
+
+
+def read_text(path: Path) -> str:
+    """Reads a C file without comments"""
+    return strip_comments(path.read_text(encoding="utf-8"))
+
+
+def read_macros(root: Path) -> Dict[str, str]:
+    """Reads the object-like macros of the headers that define array sizes"""
+    macros = {}
+    for header in MACRO_HEADERS:
+        text = read_text(root / header).replace("\\\n", " ")
+        for match in re.finditer(r"^\s*#define\s+(\w+)\s+(.+)$", text, flags=re.M):
+            macros[match.group(1)] = match.group(2).strip()
+    return macros
+
+
+def evaluate(expression: str, macros: Dict[str, str], depth: int = 0) -> int:
+    """Evaluates an integer constant expression of the configuration"""
+    if depth > 20:
+        raise ValueError(f"recursive macro in '{expression}'")
+    expression = re.sub(r"\((?:u?int\d+_t|unsigned|int)\)", "", expression)
+
+    def replace(match: re.Match) -> str:
+        token = match.group(0)
+        if token in macros:
+            return f"({evaluate(macros[token], macros, depth + 1)})"
+        number = re.fullmatch(r"(0[xX][0-9a-fA-F]+|\d+)[uUlL]*", token)
+        if number:
+            return str(int(number.group(1), 0))
+        raise ValueError(f"unknown symbol '{token}' in '{expression}'")
+
+    expression = re.sub(r"\b\w+\b", replace, expression)
+    if not re.fullmatch(r"[\d\s()+\-*/%<>|&]*", expression):
+        raise ValueError(f"unsupported expression '{expression}'")
+    return int(eval(expression.replace("/", "//")))  # pylint: disable=eval-used
+
+
+def read_block_ids(text: str) -> Dict[str, int]:
+    """Reads the values of DATA_BLOCK_ID_e"""
+    body = re.search(r"typedef enum\s*\{(.*?)\}\s*DATA_BLOCK_ID_e;", text, re.S)
+    if not body:
+        raise ValueError("DATA_BLOCK_ID_e not found")
+    names = re.findall(r"(DATA_BLOCK_ID_\w+)", body.group(1))
+    return {name: value for value, name in enumerate(names)}
+
+
+def read_structs(
+    text: str, macros: Dict[str, str], enum_size: int
+) -> Dict[str, Struct]:
+    """Reads the data block types and computes their layout on the target"""
+    structs: Dict[str, Struct] = {}
+    for match in re.finditer(r"typedef struct\s*\{(.*?)\}\s*(\w+);", text, re.S):
+        struct_ = Struct(match.group(2))
+        offset = 0
+        for declaration in match.group(1).split(";"):
+            declaration = " ".join(declaration.split())
+            if not declaration:
+                continue
+            declaration_match = re.fullmatch(
+                r"(\w+)\s+(\w+)\s*((?:\[[^\]]+\]\s*)*)", declaration
+            )
+            if not declaration_match:
+                logging.debug("%s: skipping '%s'", struct_.name, declaration)
+                struct_ = None
+                break
+            type_name, name, dimensions = declaration_match.groups()
+            if type_name in SCALAR_TYPES:
+                size = alignment = SCALAR_TYPES[type_name][1]
+            elif type_name.endswith("_e"):
+                size = alignment = enum_size
+            elif type_name in structs:
+                size = structs[type_name].size
+                alignment = structs[type_name].alignment
+            else:
+                logging.debug("%s: unknown type '%s'", struct_.name, type_name)
+                struct_ = None
+                break
+            sizes = [
+                evaluate(d, macros) for d in re.findall(r"\[([^\]]+)\]", dimensions)
+            ]
+            offset = (offset + alignment - 1) // alignment * alignment
+            struct_.members.append(Member(name, type_name, sizes, offset))
+            count = 1
+            for dimension in sizes:
+                count *= dimension
+            offset += size * count
+            struct_.alignment = max(struct_.alignment, alignment)
+        if struct_ is not None:
+            alignment = struct_.alignment
+            struct_.size = (offset + alignment - 1) // alignment * alignment
+            structs[struct_.name] = struct_
+    return structs
+
+
+def read_schema(root: Path, enum_size: int) -> Schema:
+    """Maps the data block IDs to the data block types of the configuration
+
+    Args:
+        root: root directory of the repository
+        enum_size: size of an enum on the target
+
+    Returns:
+        data block types, data block type and name per data block ID
+    """
+    header = read_text(root / "src/app/engine/config/database_cfg.h")
+    source = read_text(root / "src/app/engine/config/database_cfg.c")
+    ids = read_block_ids(header)
+    structs = read_structs(header, read_macros(root), enum_size)
+    schema = Schema(structs=structs)
+    for match in re.finditer(
+        r"static\s+(DATA_BLOCK_\w+_s)\s+\w+\s*=\s*"
+        r"\{\s*\.header\.uniqueId\s*=\s*(DATA_BLOCK_ID_\w+)",
+        source,
+    ):
+        if match.group(1) in structs:
+            schema.types[ids[match.group(2)]] = structs[match.group(1)]
+    schema.names = {value: name for name, value in ids.items()}
+    return schema
+
+
+def read_candump(path: Path, can_id: int) -> Iterator[bytes]:
+    """Yields the data of the frames with the given ID of a candump log
+
+    Both the log format (``(1.0) can0 228#1000...``) and the default output
+    format (``can0  228   [8]  10 00 ...``) are supported."""
+    log_line = re.compile(r"^\(\S+\)\s+\S+\s+([0-9A-Fa-f]+)#([0-9A-Fa-f]*)")
+    print_line = re.compile(
+        r"^\s*\S+\s+([0-9A-Fa-f]+)\s+\[\d+\]\s+((?:[0-9A-Fa-f]{2}\s*)*)$"
+    )
+    for line in path.read_text(encoding="utf-8").splitlines():
+        match = log_line.match(line) or print_line.match(line)
+        if match and int(match.group(1), 16) == can_id:
+            yield bytes.fromhex(match.group(2).replace(" ", ""))
+
+
+def read_python_can_log(path: Path, can_id: int) -> Iterator[bytes]:
+    """Yields the data of the frames with the given ID of a python-can log"""
+    import can  # pylint: disable=import-outside-toplevel
+
+    for message in can.LogReader(str(path)):
+        if message.arbitration_id == can_id:
+            yield bytes(message.data)
+
+
+def reassemble(frames: Iterator[bytes]) -> List[bytes]:
+    """Reassembles the snapshots from the first and consecutive frames
+
+    Incomplete transfers and transfers with a wrong sequence number are
+    dropped."""
+    snapshots = []
+    data = bytearray()
+    length = 0
+    sequence_number = 0
+    for frame in frames:
+        frame_type = frame[0] >> 4
+        if frame_type == FIRST_FRAME:
+            length = ((frame[0] & 0x0F) << 8) | frame[1]
+            offset = 2
+            if length == 0:
+                length = struct.unpack(">I", frame[2:6])[0]
+                offset = 6
+            data = bytearray(frame[offset:])
+            sequence_number = 1
+        elif frame_type == CONSECUTIVE_FRAME and length:
+            if (frame[0] & 0x0F) != sequence_number:
+                logging.warning("lost consecutive frame, transfer dropped")
+                length = 0
+                continue
+            sequence_number = (sequence_number + 1) & 0x0F
+            data += frame[1:]
+        else:
+            continue
+        if length and len(data) >= length:
+            snapshots.append(bytes(data[:length]))
+            length = 0
+    if length:
+        logging.warning("incomplete transfer (%d of %d bytes)", len(data), length)
+    return snapshots
+
+
+def decode_zero_runs(data: bytes, length: int) -> bytes:
+    """Decodes the runs of zero bytes of a data block"""
+    out = bytearray()
+    position = 0
+    while position < len(data):
+        control = data[position]
+        position += 1
+        if control & RUN_ZERO_FLAG:
+            out += bytes((control & ~RUN_ZERO_FLAG) + 1)
+        else:
+            out += data[position : position + control + 1]
+            position += control + 1
+    if len(out) != length:
+        raise ValueError(f"decoded {len(out)} bytes instead of {length} bytes")
+    return bytes(out)
+
+
+def parse_snapshot(data: bytes) -> Snapshot:
+    """Parses the snapshot header and decodes the block records"""
+    magic, version, flags, enum_size, blocks, timestamp = HEADER.unpack_from(data)
+    little_endian = bool(flags & FLAG_LITTLE_ENDIAN)
+    truncated = bool(flags & FLAG_TRUNCATED)
+    if magic != MAGIC or version != FORMAT_VERSION:
+        raise ValueError(f"unsupported snapshot (magic {magic!r}, version {version})")
+    position = HEADER.size
+    records = []
+    for _ in range(blocks):
+        block_id, flags, length, encoded = BLOCK_HEADER.unpack_from(data, position)
+        position += BLOCK_HEADER.size
+        raw = decode_zero_runs(data[position : position + encoded], length)
+        position += encoded
+        records.append((block_id, bool(flags & BLOCK_FLAG_INCONSISTENT), raw))
+    return Snapshot(
+        little_endian=little_endian,
+        truncated=truncated,
+        enum_size=enum_size,
+        timestamp_ms=timestamp,
+        blocks=records,
+    )
+
+
+def unpack_struct(struct_: Struct, raw: bytes, layout: Layout) -> Dict[str, Any]:
+    """Rebuilds a data block from its memory image"""
+    values: Dict[str, Any] = {}
+    for member in struct_.members:
+        nested = layout.structs.get(member.type_name)
+        if member.type_name in SCALAR_TYPES:
+            code, size = SCALAR_TYPES[member.type_name]
+        elif member.type_name.endswith("_e"):
+            code, size = ENUM_SIZE_TO_FORMAT[layout.enum_size], layout.enum_size
+        else:
+            code, size = "", nested.size
+        count = 1
+        for dimension in member.dimensions:
+            count *= dimension
+        items: List[Any] = []
+        for i in range(count):
+            offset = member.offset + i * size
+            if code:
+                value = struct.unpack_from(layout.byte_order + code, raw, offset)[0]
+                items.append(value)
+            else:
+                items.append(unpack_struct(nested, raw[offset : offset + size], layout))
+        for dimension in reversed(member.dimensions[1:]):
+            items = [items[i : i + dimension] for i in range(0, len(items), dimension)]
+        values[member.name] = items if member.dimensions else items[0]
+    return values
+
+
+def decode(data: bytes, root: Path) -> Dict[str, Any]:
+    """Decodes a reassembled snapshot into the data blocks of the configuration"""
+    snapshot = parse_snapshot(data)
+    schema = read_schema(root, snapshot.enum_size)
+    layout = Layout(
+        "<" if snapshot.little_endian else ">", snapshot.enum_size, schema.structs
+    )
+    result: Dict[str, Any] = {
+        "timestamp_ms": snapshot.timestamp_ms,
+        "truncated": snapshot.truncated,
+        "blocks": {},
+    }
+    for block_id, inconsistent, raw in snapshot.blocks:
+        name = schema.names.get(block_id, f"DATA_BLOCK_ID_{block_id}")
+        block: Dict[str, Any] = {"inconsistent": inconsistent}
+        struct_ = schema.types.get(block_id)
+        if struct_ is not None and struct_.size == len(raw):
+            block["type"] = struct_.name
+            block["values"] = unpack_struct(struct_, raw, layout)
+        else:
+            # the configuration does not match the configuration of the target
+            logging.warning(
+                "%s: layout does not match %d bytes, kept as raw data", name, len(raw)
+            )
+            block["raw"] = raw.hex()
+        result["blocks"][name] = block
+    return result
+
+
+def main():
+    """Decode the snapshots of a CAN log."""
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        "-v",
+        "--verbosity",
+        dest="verbosity",
+        action="count",
+        default=0,
+        help="set verbosity level",
+    )
+    parser.add_argument(
+        "log",
+        type=Path,
+        help="CAN log (candump; other formats require python-can) or raw snapshot",
+    )
+    parser.add_argument(
+        "--raw",
+        action="store_true",
+        help="the input is a reassembled snapshot instead of a CAN log",
+    )
+    parser.add_argument(
+        "--id",
+        type=lambda x: int(x, 0),
+        default=SNAPSHOT_ID,
+        help="CAN ID of the message foxBMS_Snapshot",
+    )
+    parser.add_argument(
+        "--root",
+        type=Path,
+        default=REPO_ROOT,
+        help="repository with the configuration of the target",
+    )
+    parser.add_argument(
+        "-o",
+        "--output",
+        type=Path,
+        default=None,
+        help="JSON output file (default: standard output)",
+    )
+    args = parser.parse_args()
+
+    if args.verbosity == 1:
+        logging.basicConfig(level=logging.INFO)
+    elif args.verbosity > 1:
+        logging.basicConfig(level=logging.DEBUG)
+    else:
+        logging.basicConfig(level=logging.WARNING)
+
+    if not args.log.is_file():
+        logging.error("'%s' does not exist.", args.log)
+        sys.exit(1)
+    if args.raw:
+        snapshots = [args.log.read_bytes()]
+    elif args.log.suffix.lower() in (".asc", ".blf", ".csv", ".trc"):
+        snapshots = reassemble(read_python_can_log(args.log, args.id))
+    else:
+        snapshots = reassemble(read_candump(args.log, args.id))
+    if not snapshots:
+        logging.error("no complete snapshot found.")
+        sys.exit(1)
+    logging.info("%d snapshot(s) found", len(snapshots))
+    decoded = [decode(s, args.root) for s in snapshots]
+    text = json.dumps(decoded if len(decoded) > 1 else decoded[0], indent=2)
+    if args.output:
+        args.output.write_text(text + "\n", encoding="utf-8")
+    else:
+        print(text)
+
+
+if __name__ == "__main__":
+    main()